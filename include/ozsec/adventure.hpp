@@ -2,6 +2,7 @@
 #include <Preferences.h>
 #include <ozsec/rooms.hpp>
 #include <ozsec/npcs.hpp>
+#include <ozsec/quests.hpp>
 
 // Preferences maintain persistent storage for badge and game state
 extern Preferences preferences;
@@ -14,6 +15,146 @@ typedef void (Adventure::*Callback)();
 typedef void (Adventure::*PromptCallback)(String);
 typedef void (Adventure::*TalkCallback)(int);
 
+#define COMMAND_SLOT_BITS 6                     // Command hash table size in bits, well above the number of names
+#define COMMAND_SLOTS (1 << COMMAND_SLOT_BITS) // Slots in the command hash table
+#define COMMAND_SEED_LIMIT 4096                 // Hash seeds tried to find one that gives every command name its own slot
+
+// How the text after a command name is passed to its handler
+enum CommandArgument : uint8_t
+{
+    COMMAND_NO_ARGUMENT, // Ignored, run() is called
+    COMMAND_TEXT,        // Passed as is to runText()
+    COMMAND_NUMBER       // Read as a number for runNumber(), 0 if missing
+};
+
+// System command, see Adventure::findCommand()
+struct Command
+{
+    const char *name;
+    const char *alias;        // Short name, or NULL
+    CommandArgument argument; // Which handler is used, the constructor picks it from the handler type
+    bool cheat;               // Only works after a cheat code was entered
+    Callback run;
+    PromptCallback runText;
+    TalkCallback runNumber;
+
+    constexpr Command(const char *name, Callback run)
+        : name(name), alias(NULL), argument(COMMAND_NO_ARGUMENT), cheat(false), run(run), runText(NULL), runNumber(NULL)
+    {
+    }
+
+    constexpr Command(const char *name, PromptCallback runText)
+        : name(name), alias(NULL), argument(COMMAND_TEXT), cheat(false), run(NULL), runText(runText), runNumber(NULL)
+    {
+    }
+
+    constexpr Command(const char *name, TalkCallback runNumber)
+        : name(name), alias(NULL), argument(COMMAND_NUMBER), cheat(false), run(NULL), runText(NULL), runNumber(runNumber)
+    {
+    }
+
+    constexpr Command shortName(const char *text) const
+    {
+        Command command = *this;
+        command.alias = text;
+        return command;
+    }
+
+    constexpr Command cheatsOnly() const
+    {
+        Command command = *this;
+        command.cheat = true;
+        return command;
+    }
+};
+
+// Command hash table. Each slot is 0 if empty, otherwise 1 + command index * 2, plus 1 if it holds the alias.
+struct CommandTable
+{
+    uint32_t seed;
+    uint8_t slots[COMMAND_SLOTS];
+};
+
+/// @brief FNV-1a hash of a name, for the hash tables built at compile time
+constexpr uint32_t nameHash(const char *name, size_t length, uint32_t seed)
+{
+    uint32_t hash = 2166136261u ^ seed;
+    for (size_t i = 0; i < length; i++)
+    {
+        hash = (hash ^ (uint8_t)name[i]) * 16777619u;
+    }
+    return hash;
+}
+
+/// @brief Slot of a command name in the command hash table.
+/// Uses the top bits of the hash since the low bits only depend on the low bits of the seed.
+constexpr uint32_t commandSlot(const char *name, size_t length, uint32_t seed)
+{
+    return nameHash(name, length, seed) >> (32 - COMMAND_SLOT_BITS);
+}
+
+/// @brief Length of a command name, for use at compile time
+constexpr size_t commandLength(const char *name)
+{
+    size_t length = 0;
+    while (name[length] != '\0')
+    {
+        length++;
+    }
+    return length;
+}
+
+/// @brief Build the command hash table, trying seeds until no two names share a slot.
+/// @return The table, its seed is COMMAND_SEED_LIMIT if no seed worked
+template <size_t N>
+constexpr CommandTable commandTable(const Command (&commands)[N])
+{
+    for (uint32_t seed = 0; seed < COMMAND_SEED_LIMIT; seed++)
+    {
+        CommandTable table = {seed, {}};
+        bool perfect = true;
+        for (size_t i = 0; i < N * 2 && perfect; i++)
+        {
+            const char *name = i % 2 == 0 ? commands[i / 2].name : commands[i / 2].alias;
+            if (name != NULL)
+            {
+                uint8_t &slot = table.slots[commandSlot(name, commandLength(name), seed)];
+                perfect = slot == 0;
+                slot = i + 1;
+            }
+        }
+        if (perfect)
+        {
+            return table;
+        }
+    }
+    return {COMMAND_SEED_LIMIT, {}};
+}
+
+// What the player's input does, see Adventure::resolve()
+enum ActionType : uint8_t
+{
+    ACTION_PROMPT,    // Answer to a prompt or NPC dialog, passed to the prompt callback
+    ACTION_KONAMI,    // Next step of the Konami code in the Arcade
+    ACTION_DIRECTION, // Walk to a neighbouring room
+    ACTION_ROOM,      // Any other option of the room
+    ACTION_COMMAND,   // System command
+    ACTION_UNKNOWN    // Not an option of the room and not a command
+};
+
+struct RoomAction;
+
+// Input resolved to what it does, the fields after type are only set for their action type
+struct PlayerAction
+{
+    ActionType type;
+    int direction;                // NORTH, EAST, WEST or SOUTH
+    int konami;                   // Position in the Konami code after this step
+    const RoomAction *roomAction; // What the option does, NULL if it does nothing
+    const Command *command;
+    const char *arguments; // Text after the command name
+};
+
 enum InventoryItemIndexes
 {
     INVENTORY_ITEM_A_CUP_OF_COFFEE,
@@ -106,7 +247,6 @@ struct CharacterState
     int dialogIndex; // The dialog entry
     String name;     // Characters name
     int inventory[INVENTORY_ITEM_INDEX_COUNT];
-    String notebook;
     int beacon; // The room ID that the player wants to return to when using a beacon.
 };
 
@@ -117,56 +257,224 @@ struct GameState
 {
     bool cheats;
     bool playing;
-    bool qmodel2023;
-    bool qtraining;
-    bool qtrainingvault;
-    bool qchanute;
-    bool qpittsburg;
-    bool qptsshutdown;
-    bool qptsunplug;
-    bool qkansascity;
-    bool qkcbus1024;
-    bool qkcbus1138;
-    bool qkcbus2018;
-    bool qtopeka;
-    bool qtpkdrive1;
-    bool qtpkdrive2;
-    bool qtpkdrive3;
-    bool qtpkdrive4;
-    bool qtpkdrive5;
-    bool qgoodland;
-    bool qgts1;
-    bool qgts2;
-    bool qgts3;
-    bool qgts4;
-    bool qgts5;
-    bool qdodgecity;
-    bool qdcsherrif;
-    bool qdcassociate;
-    bool qdcconductor;
-    bool qnewton;
-    bool qnwtball;
-    bool qnwtdisc;
-    bool qellsworth;
-    bool qellaptop;
-    bool qellevels;
-    bool qelaccess;
-    bool qwichita;
-    bool ictwatertape;
-    bool ictwaterloaded;
-    bool qictwater;
-    bool qictair1;
-    bool qictair2;
-    bool qictair3;
-    bool qictair4;
-    bool qictair5;
-    bool qictairunlock;
-    bool qictairport;
+    QuestFlags quests;
+    QuestGoals goals; // Goals met by the quest flags, see Adventure::updateQuests()
     String message;
 };
 
 extern GameState game;
 
+#define ROOM_ACTION_NEEDS 2                             // Most requirements one room action can check
+#define ROOM_ACTION_SLOT_BITS 8                         // Room action hash table size in bits, about twice the number of actions
+#define ROOM_ACTION_SLOTS (1 << ROOM_ACTION_SLOT_BITS) // Slots in the room action hash table
+#define ROOM_ACTION_PROBES 3                            // Most slots a lookup may have to check before it finds the action
+#define ROOM_ACTION_SEED_LIMIT 4096                     // Hash seeds tried to find one that keeps every lookup within ROOM_ACTION_PROBES
+
+// Something the player needs before a room action works
+struct RoomNeed
+{
+    int8_t item;           // Item that must be in the inventory, or -1
+    int8_t quest;          // Quest flag that must be set, or -1
+    const char *missing;   // Message shown instead when it is missing, NULL if this need is unused
+};
+
+// What happens when the player types one of a room's options, see Adventure::findRoomAction().
+// Built up in the table like RoomAction(174, "drive").needs(item, "...").flag("...").says("...").
+// When all needs are met the effects run in the order of the fields, a handler runs instead of all of them.
+struct RoomAction
+{
+    int16_t room;
+    const char *verb;
+    RoomNeed need[ROOM_ACTION_NEEDS]; // Checked in order, the first one missing fails the action
+    int8_t npc;                       // NPC to start talking to, or -1
+    int8_t removed;                   // Item taken from the inventory, or -1
+    int8_t added;                     // Item added to the inventory, or -1
+    int8_t quest;                     // Quest flag set, or -1
+    bool saved;                       // Save the player straight away
+    const char *ctf;                  // CTF flag found, or NULL
+    const char *message;              // Message shown, or NULL
+    Callback handler;                 // Runs instead of the effects when the action needs its own code
+
+    constexpr RoomAction(int room, const char *verb)
+        : room(room), verb(verb), need{{-1, -1, NULL}, {-1, -1, NULL}}, npc(-1), removed(-1), added(-1),
+          quest(-1), saved(false), ctf(NULL), message(NULL), handler(NULL)
+    {
+    }
+
+    constexpr RoomAction needs(int item, const char *missing) const
+    {
+        RoomAction action = *this;
+        action.need[need[0].missing == NULL ? 0 : 1] = {(int8_t)item, -1, missing};
+        return action;
+    }
+
+    constexpr RoomAction needs(QuestFlag flag, const char *missing) const
+    {
+        RoomAction action = *this;
+        action.need[need[0].missing == NULL ? 0 : 1] = {-1, (int8_t)flag, missing};
+        return action;
+    }
+
+    constexpr RoomAction talk(int id) const
+    {
+        RoomAction action = *this;
+        action.npc = id;
+        return action;
+    }
+
+    constexpr RoomAction takes(int item) const
+    {
+        RoomAction action = *this;
+        action.removed = item;
+        return action;
+    }
+
+    constexpr RoomAction gives(int item) const
+    {
+        RoomAction action = *this;
+        action.added = item;
+        return action;
+    }
+
+    constexpr RoomAction sets(QuestFlag flag) const
+    {
+        RoomAction action = *this;
+        action.quest = flag;
+        return action;
+    }
+
+    constexpr RoomAction saves() const
+    {
+        RoomAction action = *this;
+        action.saved = true;
+        return action;
+    }
+
+    constexpr RoomAction flag(const char *text) const
+    {
+        RoomAction action = *this;
+        action.ctf = text;
+        return action;
+    }
+
+    constexpr RoomAction says(const char *text) const
+    {
+        RoomAction action = *this;
+        action.message = text;
+        return action;
+    }
+
+    constexpr RoomAction runs(Callback callback) const
+    {
+        RoomAction action = *this;
+        action.handler = callback;
+        return action;
+    }
+};
+
+// Room action hash table, open addressed by (room, verb). Each slot is 0 if empty, otherwise 1 + action index.
+struct RoomActionTable
+{
+    uint32_t seed;
+    uint8_t slots[ROOM_ACTION_SLOTS];
+    int probes;     // Most slots a lookup checks, one more than the furthest any action is from its home slot
+    bool duplicate; // Two actions have the same room and verb
+};
+
+/// @brief Home slot of a room action in the room action hash table
+constexpr uint32_t roomActionSlot(int room, const char *verb, size_t length, uint32_t seed)
+{
+    return nameHash(verb, length, seed ^ (room * 2654435761u)) >> (32 - ROOM_ACTION_SLOT_BITS);
+}
+
+/// @brief Build the room action hash table with linear probing for one seed
+template <size_t N>
+constexpr RoomActionTable roomActionTable(const RoomAction (&actions)[N], uint32_t seed)
+{
+    RoomActionTable table = {seed, {}, 0, false};
+    for (size_t i = 0; i < N; i++)
+    {
+        uint32_t slot = roomActionSlot(actions[i].room, actions[i].verb, commandLength(actions[i].verb), seed);
+        int probes = 1;
+        while (table.slots[slot] != 0)
+        {
+            const RoomAction &other = actions[table.slots[slot] - 1];
+            const char *a = other.verb;
+            const char *b = actions[i].verb;
+            while (*a != '\0' && *a == *b)
+            {
+                a++;
+                b++;
+            }
+            table.duplicate = table.duplicate || (other.room == actions[i].room && *a == *b);
+            slot = (slot + 1) % ROOM_ACTION_SLOTS;
+            probes++;
+        }
+        table.slots[slot] = i + 1;
+        table.probes = probes > table.probes ? probes : table.probes;
+    }
+    return table;
+}
+
+/// @brief Build the room action hash table, trying seeds until no lookup checks more than ROOM_ACTION_PROBES slots.
+/// @return The table, its seed is ROOM_ACTION_SEED_LIMIT if no seed worked
+template <size_t N>
+constexpr RoomActionTable roomActionTable(const RoomAction (&actions)[N])
+{
+    for (uint32_t seed = 0; seed < ROOM_ACTION_SEED_LIMIT; seed++)
+    {
+        RoomActionTable table = roomActionTable(actions, seed);
+        if (table.probes <= ROOM_ACTION_PROBES || table.duplicate)
+        {
+            return table;
+        }
+    }
+    return {ROOM_ACTION_SEED_LIMIT, {}, 0, false};
+}
+
+/// @brief Get the quest flags a list of room actions can set, for the quest graph reachability check
+template <size_t N>
+constexpr uint64_t roomActionQuests(const RoomAction (&actions)[N])
+{
+    uint64_t quests = 0;
+    for (size_t i = 0; i < N; i++)
+    {
+        quests |= actions[i].quest == -1 ? 0 : questMask((QuestFlag)actions[i].quest);
+    }
+    return quests;
+}
+
+// A room that stays locked until a quest goal is met, see Adventure::displayRoom()
+struct RoomGate
+{
+    int16_t room;
+    QuestGoal goal;
+    const char *locked; // Shown when the player is turned back
+};
+
+#define TERMINAL_WIDTH 100 // Width room descriptions are wrapped to, at ROOM_WRAP_WIDTH the wrapping is done by tools/rooms.py
+
+// Game and player state are saved as one blob, see Adventure::save()
+#define SAVE_NAMESPACE "game-save" // Preferences namespace of the save blob
+#define SAVE_KEY_A "state-a"       // Preferences keys of the two save blob slots, written in turn so
+#define SAVE_KEY_B "state-b"       // a damaged write still leaves the save before it to load
+#define SAVE_VERSION 3             // Change when the blob layout changes, older blobs are then ignored
+#define SAVE_FLUSH_INTERVAL 10000  // Minimum time in ms between save blob writes, changes in between are coalesced
+
+// Parts of the game state that changed since the last save, see Adventure::markDirty()
+#define SAVE_DIRTY_FLAGS (1 << 0)     // Quest flags
+#define SAVE_DIRTY_INVENTORY (1 << 1) // Inventory counts
+#define SAVE_DIRTY_PLAYER (1 << 2)    // Name, room and beacon
+
+// Header at the start of the save blob, followed by the player, quest flags, inventory and name
+struct SaveHeader
+{
+    uint32_t version;  // SAVE_VERSION
+    uint32_t sequence; // Counts up with every blob written, the newest valid slot is loaded
+    uint32_t length;   // Length of the blob after the header
+    uint32_t crc;      // CRC32 of the blob after the header
+};
+
 extern String wifiSsid;
 extern String wifiPassword;
 
@@ -176,26 +484,33 @@ enum LightMode
     ADVENTURE
 };
 
+// Bits of the LED map state, one per map LED in all_leds order, plus the RGB strip for Wichita
+#define LED_MAP_WICHITA (1 << 9)
+#define LED_MAP_ALL 0x3FF
+
 class Adventure
 {
 private:
+    friend struct AdventureProbe; // Defined by the native tests in test/ to reach the parts below
     CharacterState player;
-    const Room *room;
     bool hasItem(int item);
     void addItem(int item);
     void removeItem(int item);
     void show();
     void displayMessage();
     void displayRoom();
-    void printWithWrapping(String text, int width);
     void prompt();
-    void systemCommand(String command);
+    bool pending();
+    PlayerAction resolve(const char *text, size_t length);
+    void systemCommand(const PlayerAction &action);
+    static const Command *findCommand(const char *name, size_t length);
     void setNickname(String response);
     void confirmWifi(String response);
     void setWifiSsid(String response);
     void setWifiPassword(String resonse);
-    void roomAction(String action);
-    bool isRoomAction(String action);
+    void roomAction(const PlayerAction &action);
+    static const RoomAction *findRoomAction(int room, const char *verb, size_t length);
+    void runRoomAction(const RoomAction &action);
     void setCallback(Callback callback);
     void unsetCallback();
     void setPromptCallback(PromptCallback callback);
@@ -204,12 +519,25 @@ private:
     void unsetTalkCallback();
     void save();
     void load();
+    void markDirty(uint8_t fields);
+    void setFlag(QuestFlag flag, bool value);
+    void updateQuests(QuestFlag flag);
+    void evaluateQuests();
+    long flushDue();
+    TickType_t flushWait();
+    void flush(bool force);
+    size_t writeSave(uint8_t *blob);
+    bool readSave(const uint8_t *blob, size_t length);
+    bool migrate();
     void printHelp();
     void stateUpdate();
     void talkToNPC(String response);
     bool checkQuest(int npc);
     void displayDialog();
-    void ledMap();
+    static uint32_t ledMapState(uint64_t quests);
+    void ledPublish();
+    void ledNotify();
+    void ledMap(uint32_t state, uint32_t changed);
     void printFlag(String flag);
 
     // System commands
@@ -226,6 +554,7 @@ private:
     void cmdBadge();
     void cmdScan();
     void cmdTwinkle();
+    void cmdStats();
     void cmdNotebook();
     void cmdWriteNote(String note);
     void cmdBeacon();
@@ -235,6 +564,20 @@ private:
     void cmdCompleteQuest(int quest);
     void cmdToggle(int led);
 
+    // Room actions that need their own code, see findRoomAction()
+    void actionTrainingButton();
+    void actionBusToTopeka();
+    void actionAnalyzeDrives();
+    void actionBeacon();
+    void actionClimbLadder();
+    void actionPlayBall();
+    void actionThrowDiscs();
+    void actionSaloonGame();
+    void actionJoinLine();
+    void actionLotteryTicket();
+    void actionEnergyDrink();
+    void actionSimon();
+
     // Debug
     void completeTraining();
 
@@ -1,23 +1,42 @@
 #ifndef Buttons_hpp
 #define Buttons_hpp
 #include <Arduino.h>
-#include <OneButton.h>
 
-// Define the buttons
+#define BUTTON_COUNT 6           // Number of buttons on the badge
+#define BUTTON_DEBOUNCE 30       // Time in ms a button has to stay still before a press or release counts
+#define BUTTON_LONG_PRESS 1500   // Time in ms a button has to be held for a long press
+#define BUTTON_QUEUE_LENGTH 32   // Number of edges or events that can wait in each queue
+#define BUTTON_TASK_STACK 8192   // Stack size in words for the input task, long presses can run a firmware update
+
+enum ButtonId : uint8_t
+{
+    BUTTON_BOOT,
+    BUTTON_SELECT,
+    BUTTON_UP,
+    BUTTON_DOWN,
+    BUTTON_LEFT,
+    BUTTON_RIGHT
+};
+
+// Define the buttons, in ButtonId order. All buttons are active low.
 #ifdef BOARD_SIMON
-OneButton boot_button(GPIO_NUM_0);
-OneButton select_button(GPIO_NUM_36);
-OneButton up_button(GPIO_NUM_37);
-OneButton down_button(GPIO_NUM_38);
-OneButton left_button(GPIO_NUM_46);
-OneButton right_button(GPIO_NUM_35);
+constexpr int button_pins[BUTTON_COUNT] = {GPIO_NUM_0, GPIO_NUM_36, GPIO_NUM_37, GPIO_NUM_38, GPIO_NUM_46, GPIO_NUM_35};
 #else
-OneButton boot_button(GPIO_NUM_0);
-OneButton select_button(GPIO_NUM_47);
-OneButton up_button(GPIO_NUM_21);
-OneButton down_button(GPIO_NUM_48);
-OneButton left_button(GPIO_NUM_14);
-OneButton right_button(GPIO_NUM_45);
+constexpr int button_pins[BUTTON_COUNT] = {GPIO_NUM_0, GPIO_NUM_47, GPIO_NUM_21, GPIO_NUM_48, GPIO_NUM_14, GPIO_NUM_45};
 #endif
 
+class Buttons
+{
+private:
+public:
+    static void init();
+    static void onClick(ButtonId button, void (*handler)());
+    static void onLongPress(ButtonId button, void (*handler)());
+    static void click(ButtonId button);
+    static void isr(void *arg);
+    static void task(void *parameter);
+    static unsigned long edgeCount;   // Edges seen by the button interrupt
+    static unsigned long edgeDropped; // Edges lost because the input task fell behind
+};
+
 #endif
\ No newline at end of file
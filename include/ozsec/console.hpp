@@ -0,0 +1,52 @@
+#ifndef Console_hpp
+#define Console_hpp
+#include <Arduino.h>
+#include <freertos/stream_buffer.h>
+
+#define CONSOLE_BUFFER 4096             // Bytes of output that can wait for the host to read them
+#define CONSOLE_CHUNK 256               // Most bytes the console task hands to the serial port at once
+#define CONSOLE_TASK_STACK 2048         // Stack size in words for the console task
+#define CONSOLE_RETRY 10                // Time in ms the console task waits when the host took nothing
+#define CONSOLE_BLOCK_TIMEOUT 1000      // Longest time in ms CONSOLE_BLOCK pauses the game for one write
+#define CONSOLE_MARKER "\r\n[...]\r\n"  // Printed where CONSOLE_TRUNCATE and CONSOLE_BLOCK cut output
+#define CONSOLE_POLICY CONSOLE_TRUNCATE // Policy when the buffer is full
+
+// What happens to output that does not fit in the buffer, when the host is slow or stopped reading
+enum ConsolePolicy : uint8_t
+{
+    CONSOLE_DROP,     // Drop each write that does not fit
+    CONSOLE_TRUNCATE, // Cut the output with CONSOLE_MARKER and drop everything until the buffer is half empty
+    CONSOLE_BLOCK     // Pause the game until the write fits, then cut like CONSOLE_TRUNCATE after CONSOLE_BLOCK_TIMEOUT
+};
+
+// Serial console output. Writes go into a CONSOLE_BUFFER byte ring and a console task
+// on core 0 hands them to the serial port, so a host that stopped reading can't stall
+// the game loop. Print to Console instead of Serial, input is still read from Serial.
+class ConsoleOutput : public Print
+{
+private:
+    StreamBufferHandle_t buffer; // Output waiting for the console task
+    SemaphoreHandle_t lock;      // Held while writing to the buffer, stream buffers take one writer at a time
+    bool cut;                    // Output was cut, drop writes until the buffer is half empty
+
+    size_t send(const uint8_t *data, size_t length, TickType_t timeout);
+
+public:
+    ConsolePolicy policy;
+    unsigned long queued;  // Bytes put in the buffer
+    unsigned long dropped; // Bytes dropped because the buffer was full
+    uint64_t blockedTime;  // Total time in us the game waited for room with CONSOLE_BLOCK
+
+    void init();
+    size_t write(uint8_t c) override;
+    size_t write(const uint8_t *data, size_t length) override;
+    int availableForWrite() override;
+    void flush() override;
+    size_t drain(TickType_t timeout);
+    static void task(void *parameter);
+    using Print::write;
+};
+
+extern ConsoleOutput Console;
+
+#endif
\ No newline at end of file
@@ -0,0 +1,53 @@
+#ifndef Gamma_hpp
+#define Gamma_hpp
+#include <Arduino.h>
+
+// Generated by tools/gamma.py, do not edit by hand.
+// LEDC duty for each logical map LED level, at 14-bit resolution.
+
+#define LED_GAMMA_BITS 14    // PWM resolution the tables were generated for
+#define LED_GAMMA_LEVELS 256 // Number of logical LED levels
+
+#ifdef BOARD_SIMON
+// OzSec 2023 badge, used for testing, gamma 2.5
+constexpr uint16_t ledGamma[LED_GAMMA_LEVELS] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+    1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 3, 3, 3, 3,
+    4, 4, 4, 4, 5, 5, 6, 6, 6, 7, 7, 8, 8, 8, 9, 9,
+    10, 10, 11, 11, 12, 13, 13, 14, 15, 15, 16, 17, 17, 18, 19, 19,
+    20, 21, 22, 23, 24, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34,
+    35, 37, 38, 39, 40, 41, 42, 44, 45, 46, 48, 49, 50, 52, 53, 54,
+    56, 57, 59, 60, 62, 63, 65, 67, 68, 70, 72, 73, 75, 77, 79, 80,
+    82, 84, 86, 88, 90, 92, 94, 96, 98, 100, 102, 104, 106, 108, 110, 112,
+    115, 117, 119, 122, 124, 126, 129, 131, 133, 136, 138, 141, 143, 146, 149, 151,
+    154, 157, 159, 162, 165, 168, 171, 173, 176, 179, 182, 185, 188, 191, 194, 197,
+    200, 204, 207, 210, 213, 216, 220, 223, 226, 230, 233, 237, 240, 244, 247, 251,
+    254, 258, 262, 265, 269, 273, 276, 280, 284, 288, 292, 296, 300, 304, 308, 312,
+    316, 320, 324, 329, 333, 337, 341, 346, 350, 354, 359, 363, 368, 372, 377, 381,
+    386, 391, 395, 400, 405, 410, 415, 419, 424, 429, 434, 439, 444, 449, 454, 459,
+    465, 470, 475, 480, 486, 491, 496, 502, 507, 513, 518, 524, 529, 535, 541, 546,
+    552, 558, 564, 570, 575, 581, 587, 593, 599, 605, 611, 618, 624, 630, 636, 642,
+};
+#else
+// OzSec 2024 badge, gamma 2.2
+constexpr uint16_t ledGamma[LED_GAMMA_LEVELS] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1,
+    1, 2, 2, 2, 2, 3, 3, 3, 4, 4, 4, 5, 5, 5, 6, 6,
+    7, 7, 8, 8, 9, 9, 10, 10, 11, 12, 12, 13, 13, 14, 15, 16,
+    16, 17, 18, 19, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30,
+    31, 32, 33, 34, 35, 36, 37, 39, 40, 41, 42, 44, 45, 46, 47, 49,
+    50, 52, 53, 54, 56, 57, 59, 60, 62, 63, 65, 67, 68, 70, 72, 73,
+    75, 77, 78, 80, 82, 84, 86, 87, 89, 91, 93, 95, 97, 99, 101, 103,
+    105, 107, 109, 111, 114, 116, 118, 120, 122, 125, 127, 129, 132, 134, 136, 139,
+    141, 143, 146, 148, 151, 153, 156, 159, 161, 164, 166, 169, 172, 174, 177, 180,
+    183, 186, 188, 191, 194, 197, 200, 203, 206, 209, 212, 215, 218, 221, 224, 227,
+    230, 234, 237, 240, 243, 247, 250, 253, 257, 260, 263, 267, 270, 274, 277, 281,
+    284, 288, 291, 295, 299, 302, 306, 310, 313, 317, 321, 325, 329, 332, 336, 340,
+    344, 348, 352, 356, 360, 364, 368, 372, 376, 381, 385, 389, 393, 397, 402, 406,
+    410, 415, 419, 424, 428, 432, 437, 441, 446, 450, 455, 460, 464, 469, 474, 478,
+    483, 488, 493, 497, 502, 507, 512, 517, 522, 527, 532, 537, 542, 547, 552, 557,
+    562, 567, 573, 578, 583, 588, 594, 599, 604, 610, 615, 621, 626, 631, 637, 642,
+};
+#endif
+
+#endif
\ No newline at end of file
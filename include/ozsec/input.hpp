@@ -0,0 +1,34 @@
+#ifndef Input_hpp
+#define Input_hpp
+#include <Arduino.h>
+
+#define INPUT_QUEUE_LENGTH 32 // Number of input events that can wait for the game loop
+#define INPUT_POLL_PERIOD 10  // Time in ms between serial checks when the serial port has no receive callback
+
+enum InputSource : uint8_t
+{
+    INPUT_SERIAL, // Serial data is ready to read
+    INPUT_BUTTON  // A button was clicked
+};
+
+// Input for the game loop, from the serial port or the input task
+struct InputEvent
+{
+    InputSource source;
+    uint8_t button;     // ButtonId for INPUT_BUTTON
+    unsigned long time; // Time in ms the input happened
+};
+
+class Input
+{
+private:
+public:
+    static void init();
+    static void post(const InputEvent &event);
+    static bool wait(InputEvent *event, TickType_t timeout);
+    static void sleep(TickType_t timeout);
+    static void serialReceived(void *arg, esp_event_base_t base, int32_t id, void *data);
+    static uint64_t waitTime; // Total time in us the game loop spent sleeping on input
+};
+
+#endif
\ No newline at end of file
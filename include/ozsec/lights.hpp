@@ -6,37 +6,108 @@
 #ifdef BOARD_SIMON
 // Set LED's for OzSec 2023 badge for testing
 #define SIMPLE_NUM_LEDS 9 // Number of LEDs in the simple LED array, includes RGB eye as individual LED's
-const int all_leds[SIMPLE_NUM_LEDS] = {GPIO_NUM_10, GPIO_NUM_14, GPIO_NUM_13, GPIO_NUM_12, GPIO_NUM_11, GPIO_NUM_15, GPIO_NUM_5, GPIO_NUM_4, GPIO_NUM_3};
+constexpr int all_leds[SIMPLE_NUM_LEDS] = {GPIO_NUM_10, GPIO_NUM_14, GPIO_NUM_13, GPIO_NUM_12, GPIO_NUM_11, GPIO_NUM_15, GPIO_NUM_5, GPIO_NUM_4, GPIO_NUM_3};
 #define STRIP_DATA_PIN 18
 #else
 // Set LED's for OzSec 2024 badge
 #define SIMPLE_NUM_LEDS 9 // Number of LEDs in the simple LED array
-const int all_leds[SIMPLE_NUM_LEDS] = {GPIO_NUM_17, GPIO_NUM_3, GPIO_NUM_46, GPIO_NUM_18, GPIO_NUM_8, GPIO_NUM_13, GPIO_NUM_12, GPIO_NUM_9, GPIO_NUM_11};
+constexpr int all_leds[SIMPLE_NUM_LEDS] = {GPIO_NUM_17, GPIO_NUM_3, GPIO_NUM_46, GPIO_NUM_18, GPIO_NUM_8, GPIO_NUM_13, GPIO_NUM_12, GPIO_NUM_9, GPIO_NUM_11};
 #define STRIP_DATA_PIN 10 // Data PIN for the RGB strip
 #endif
 
 #define STRIP_NUM_LEDS 1                 // Number of LEDs in the RGB strip
-#define LED_MAX_BRIGHTNESS 10            // Maximum brightness for the simple LEDs. Set to 15 so they aren't super bright.
-#define LED_FADE_DELAY 50                // Delay in ms for fading the simple LEDs off and on.
+#define LED_MAX_BRIGHTNESS 255           // Maximum logical level for the simple LEDs, the gamma table keeps it from being super bright.
+#define LED_FADE_TIME 500                // Time in ms for fading the simple LEDs fully off and on.
+#define LED_TWINKLE_STEP (LED_MAX_BRIGHTNESS / 10) // Level change per frame for the stepping twinkle.
+#define LED_PWM_BITS 14                  // LEDC resolution for the map LEDs, matches the gamma tables.
+#define LED_PWM_FREQ 4000                // LEDC frequency in Hz, 14-bit tops out just under 5 kHz.
+#define LED_FRAME_RATE 60                // Animation frames per second.
+#define LED_FRAME_PERIOD (1000 / LED_FRAME_RATE) // Time in ms between animation frames.
+#define LED_FRAME_BUDGET 2000            // CPU time in us a single animation frame should stay under.
 extern struct CRGB leds[STRIP_NUM_LEDS]; // Array to hold color data for the RGB strip LEDs
 extern int ledTwinkleMode;
 
+// Lookup table from GPIO number to LED channel (index in all_leds), built at compile time.
+// Pins without a map LED are set to -1.
+struct LedChannelMap
+{
+    int8_t channel[GPIO_NUM_MAX];
+
+    constexpr LedChannelMap() : channel()
+    {
+        for (int i = 0; i < GPIO_NUM_MAX; i++)
+        {
+            channel[i] = -1;
+        }
+        for (int i = 0; i < SIMPLE_NUM_LEDS; i++)
+        {
+            channel[all_leds[i]] = i;
+        }
+    }
+
+    /// @brief Check every LED maps back to its own channel, a pin used twice in all_leds does not
+    constexpr bool complete() const
+    {
+        for (int i = 0; i < SIMPLE_NUM_LEDS; i++)
+        {
+            if (channel[all_leds[i]] != i)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+};
+
+constexpr LedChannelMap ledChannels;
+static_assert(ledChannels.complete(), "A pin is used for more than one LED in all_leds");
+
+struct Pattern;
+
 class Lights
 {
 private:
 public:
     static void init();
-    static void ledOn(int led, bool fade);
-    static void ledOff(int led, bool fade);
+    static void tick(unsigned long now);
+    static void ledOn(int channel, bool fade);
+    static void ledOff(int channel, bool fade);
+    static void ledFade(int channel, int brightness, int fadeTime);
+    static bool isFading(int channel);
+    static bool isIdle();
     static void stripOn(CRGB color, int brightness);
+    static void stripColor(CRGB color);
     static void stripOff();
     static void stripBrightness(int brightness);
-    static void heartbeat();
-    static void twinkle();
-    static int ledStatus[SIMPLE_NUM_LEDS];
-    static int getLedStatus(int led);
-    static void setLedStatus(int led, int status);
-    static int getLedIndex(int led);
+    static void stripShow(CRGB color, int brightness);
+    static void stripCommit();
+    static void frame(unsigned long now);
+    static void play(const Pattern &pattern, unsigned long now);
+    static void twinkleStep();
+    static void twinkleRandom();
+    static void twinkle(unsigned long now);
+    static void ledWrite(int channel, int level);
+    static void ledOutput(int channel, int level);
+    static unsigned long frameCount;    // Animation frames run
+    static unsigned long frameOverruns; // Animation frames that went over LED_FRAME_BUDGET
+    static uint64_t frameBusy;          // Total CPU time in us spent running animation frames
+    static unsigned long dutyWrites;    // LEDC duty writes for the map LEDs
+    static unsigned long stripShows;    // Strip commits that changed the RGB and were shown
+    static unsigned long stripSkips;    // Strip commits skipped because the RGB was unchanged
+    static int ledStatus[SIMPLE_NUM_LEDS];             // Target brightness of each LED
+    static int ledLevel[SIMPLE_NUM_LEDS];              // Brightness currently written to each LED
+    static int ledFadeTime[SIMPLE_NUM_LEDS];           // Time in ms for a full fade of each LED
+    static unsigned long ledLastStep[SIMPLE_NUM_LEDS]; // Time of the last fade tick for each LED
+    static int getLedStatus(int channel);
+    static void setLedStatus(int channel, int status);
+
+    /// @brief Get the LED channel of the specified GPIO pin, for code that still holds pins.
+    /// The LED functions above take channels, so the game and animations never need this.
+    /// @return Index in all_leds, or -1 if the pin has no map LED
+    static constexpr int getLedIndex(int led)
+    {
+        return (led >= 0 && led < GPIO_NUM_MAX) ? ledChannels.channel[led] : -1;
+    }
 };
 
 #endif
\ No newline at end of file
@@ -0,0 +1,28 @@
+#ifndef Notebook_hpp
+#define Notebook_hpp
+#include <Arduino.h>
+
+#define NOTEBOOK_NAMESPACE "game-notes" // Preferences namespace of the notebook entries
+#define NOTEBOOK_ENTRIES 32             // Number of entries kept, the oldest entry is dropped after that
+#define NOTEBOOK_ENTRY_LENGTH 96        // Longest entry in characters, longer notes are cut short
+
+// Notebook entry as saved, only the used part of text is written
+struct NotebookEntry
+{
+    uint32_t sequence; // Counts up from 1 with every entry written
+    char text[NOTEBOOK_ENTRY_LENGTH];
+};
+
+// Player's notebook, a ring of NOTEBOOK_ENTRIES entries with one Preferences key each.
+// Adding an entry writes only that entry, reading streams one entry at a time.
+class Notebook
+{
+private:
+public:
+    static void load();
+    static bool add(const String &text);
+    static void print(Print &out);
+    static bool clear();
+};
+
+#endif
\ No newline at end of file
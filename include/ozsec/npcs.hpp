@@ -1,24 +1,25 @@
 #include <Arduino.h>
 
+// Dialog and NPC tables are constexpr so they stay in flash, nothing is copied to RAM at boot
 struct Dialog
 {
     int id;
-    String text;
-    String response1;
+    const char *text;
+    const char *response1;
     int response1_id;
-    String response2;
+    const char *response2;
     int response2_id;
 };
 
 struct Npc
 {
     int id;
-    String name;
+    const char *name;
     const Dialog *dialog;
 };
 
 // Dialog object for Simon
-const Dialog dialogSimon[] = {
+constexpr Dialog dialogSimon[] = {
     {0, "Hello, I'm Simon. Have you played a text based adventure before? Games like MUD's and MUSH's of ye olden times?", "Yes, I am familiar, let's get started!", 1, "No, let's have a quick tutorial!", 2},
     {1, "Perfect! I'm sure you can figure it all out then, just remember to try 'help' to see what commands are available.", "Thanks!", 3, "", -1},
     {2, "Alright! I'm sure you already figured out that you type commands to interact. Definitely check out 'help' to see what commands are available to you.", "Ok.", 4, "", -1},
@@ -32,7 +33,7 @@ const Dialog dialogSimon[] = {
     {10, "Good luck with the game! Remember to explore this tutorial area and see what you can find, then talk to Bob outside to enter the full game!", "", -1, "", -1}};
 
 // Dialog object for Bob
-const Dialog dialogBob[] = {
+constexpr Dialog dialogBob[] = {
     {0, "Hi! I'm Bob.", "Hi, Bob.", 1, "I'm ready to leave, Bob.", 4},
     {1, "Would you like a flag?", "Thanks, Bob, I would love a flag!", 2, "Not really.", 3},
     {2, "Here you go: OzSecCTF{B0B_1s_c00l}", "Thanks, Bob.", 3, "I'm ready to leave the tutorial area, Bob.", 4},
@@ -41,7 +42,7 @@ const Dialog dialogBob[] = {
     {5, "Ah, you might want to go explore some then, don't worry, this area isn't very big!", "Will do!", 3, "", -1},
     {6, "Excellent! In that case, you can now press that button and you'll be teleported to the full game.", "Thank you, Bob!", 3, "", -1}}; // Quest completed dialog.
 
-const Dialog dialogChanuteReporter[] = {
+constexpr Dialog dialogChanuteReporter[] = {
     {0, "Hello, I'm a reporter from the Chanute Tribune. I'm here to cover the story of the century!", "What's the story?", 1, "I'm not interested.", 4},
     {1, "I heard rumors that Chanute used to go by another name.. do you know what it is?", "No, but I'll find out!", 5, "I do!", -2}, // -2 triggers quest completion check
     {2, "I don't think you found what I am looking for. Try exploring and see if you can run across any signage or anything that may reveal the old name.", "I'll keep looking.", 6, "", -1},
@@ -50,7 +51,7 @@ const Dialog dialogChanuteReporter[] = {
     {5, "Come back and let me know what you find!", "", -1, "", -1},
     {6, "Keep me informed.", "", -1, "", -1}};
 
-const Dialog dialogWaterManager[] = { // @todo Check this quest dialog, in particular confirm you can return after loading tapes. I might need an additional -2 quest check.
+constexpr Dialog dialogWaterManager[] = { // @todo Check this quest dialog, in particular confirm you can return after loading tapes. I might need an additional -2 quest check.
     {0, "Hello, how can I help you?", "Why are you so worried?", 1, "I am here to help.", 2},
     {1, "We're currently facing a critical situation. Our systems have been compromised by ransomware and everything is offline.", "That's terrible, is there anything I can do to help?", 9, "I actually need to pay my water bill...", 5},
     {2, "Let's see...", "Did that work?", -2, "", -1},
@@ -63,7 +64,7 @@ const Dialog dialogWaterManager[] = { // @todo Check this quest dialog, in parti
     {9, "We have air gapped backup tapes stored in a safe deposit box at the bank. We need someone to retrieve them for us. Can you do that?", "I can do that.", 6, "", -1},
     {10, "Here's a keycard to get you into the data center across the hall. Can you go load them up into the backup drive for me?", "I can do that.", 7, "", -1}};
 
-const Dialog dialogWaterReceptionist[] = {
+constexpr Dialog dialogWaterReceptionist[] = {
     {0, "Hello, how can I help you?", "You look pre-occupied.", 1, "I need to pay my water bill, but I can't login to your website.", 2},
     {1, "We're in a bit of a pickle at the moment.", "I am sure I can help.", 3, "What's going on?", 3},
     {2, "Oh yes, our systems are all down at the moment, and we can't take any payments. Say, you seem smart, do you think you could help us with something?", "Yes, I can help.", 1, "No, I have some other things to do first.", 4},
@@ -71,13 +72,13 @@ const Dialog dialogWaterReceptionist[] = {
     {4, "Oh, well, if you change your mind, I'll be here.", "", -1, "", -1},
     {5, "No, thank you!", "", -1, "", -1}};
 
-const Dialog dialogBankTeller[] = {
+constexpr Dialog dialogBankTeller[] = {
     {0, "Hello, how can I help you?", "I need to access a safe deposit box.", 1, "This is an emergency. I need to get into the Water Co's deposit box!", 1},
     {1, "Are you authorized by the Water Company to access their box?", "Yes, I am.", -2, "The IT Manager sent me here.", -2},
     {2, "", "", -1, "", -1},
     {3, "That works, here is the key. The boxes are in the vault.", "", -1, "", -1}};
 
-const Dialog dialogPittsburgTownHall[] = {
+constexpr Dialog dialogPittsburgTownHall[] = {
     {0, "We're in a bit of a pickle here, dear. Everything's down, phones, email, internet, everything!", "I think I can help.", 3, "Can you check again?", -2},
     {1, "I just did, nothing is working. Think you can do something about this? We have all these experts around and all they care about is scope and insurance!", "I absolutely can.", 3, "", -1},
     {2, "I can't beleive it! Everything is coming back up! You did what consultants and experts couldn't do! Thank you so much.", "I'm glad I could help.", 5, "", -1},
@@ -85,14 +86,14 @@ const Dialog dialogPittsburgTownHall[] = {
     {4, "Thank you for your help! If you happen to fix our computers, be sure you come let me know!", "", -1, "", -1},
     {5, "Thank you for your help! I'm going to take a break now.", "", -1, "", -1}};
 
-const Dialog dialogPittsburgCourthouse[] = {
+constexpr Dialog dialogPittsburgCourthouse[] = {
     {0, "Hello, how can I help you?", "I have something for you.", -2, "Do you know what's going on with the city?", 3},
     {1, "Hm, nope, not for me. Thank you though.", "Sorry about that. Do you know what's going on?", 3, "", -1},
     {2, "Excellent! Another letter for the courts. Thank you so much for delivering this!", "", -1, "", -1},
     {3, "Someone is hacking the whole city. Our network gear has been OK for now, but we did see someone in a hoodie running to the park over to the east.", "I'll go check it out.", 4, "", -1},
     {4, "Thank you for your help! If you happen to fix the city computers, go let town hall know. I am expecting an email from them.", "", -1, "", -1}};
 
-const Dialog dialogPittsburgStacey[] = {
+constexpr Dialog dialogPittsburgStacey[] = {
     {0, "Hey there. This whole town is falling apart ever since that cyber attack took down the entire city network.", "What's going on?", 1, "Did you order a coffee?", 3},
     {1, "It's been a nightmare. I've been trying to get the city network back online, but the attackers have complete network access from somewhere. It's like they've jacked in from somewhere local.", "Who has that kind of network connectivity?", 2, "", -1},
     {2, "Courts? No, post office? I don't think so. Maybe the university? They have a real nice computer lab..", "I'll go check out the university, see what I can find.", 6, "", -1},
@@ -101,13 +102,13 @@ const Dialog dialogPittsburgStacey[] = {
     {5, "Thank you for your help! I'm going to take a much needed coffee break now!", "", -1, "", -1},
     {6, "Thank you.", "", -1, "", -1}};
 
-const Dialog dialogPittsburgDean[] = {
+constexpr Dialog dialogPittsburgDean[] = {
     {0, "I'm sorry, I can't talk right now.", "Is everything OK?", 1, "", -1},
     {1, "Not really, we hired this new IT guy and he's been a real pain in the neck. He's been trying to get us to upgrade our network gear and now everything's offline just like the city.", "Who is the IT guy?", 2, "I'll go see if I can help.", 3},
     {2, "They were affordable, that's who they were. However it's all pointless if everything is down. Plus he's now locked us out of the computer lab.", "I'll go see if I can help.", 3, "", -1},
     {3, "Thank you for your anything you can do!", "", -1, "", -1}};
 
-const Dialog dialogWichitaAirport[] = {
+constexpr Dialog dialogWichitaAirport[] = {
     {0, "Hey, I'm just trying to take a break here.", "You look tired, can I help?", 3, "Is everything OK now?", -2},
     {1, "Not yet, there's still some PC's that are stuck in reboot loops around the airport. Can you go reboot them with the recovery drive?", "Sure.", 5, "", -1},
     {2, "Yes! My monitoring is showing everything back online! Thank you so much for helping run those PC's down!", "Any time.", 6, "", -1},
@@ -116,14 +117,14 @@ const Dialog dialogWichitaAirport[] = {
     {5, "Thank you for your help! Come let me know when you're done.", "", -1, "", -1},
     {6, "Thank you for your help! I'm going to take a break now.", "", -1, "", -1}};
 
-const Dialog dialogGoodlandRepair[] = {
+constexpr Dialog dialogGoodlandRepair[] = {
     {0, "Hey, we're a bit busy right now, can you help?", "Sure, what's wrong?", 1, "", -1},
     {1, "We are tasked with repairing all these robot taxi's that took over the town. I heard that some of them are stuck in the streets. Can you take this key and get them going again?", "I can do that.", 2, "", -1},
     {2, "Thanks! You will probably need to update their firmware, check with the Telecom service on 13th street, they can get you a drive to update the taxi.", "I will.", -2, "", -1},
     {3, "Eh, no one should see this message.", "", -1, "", -1},
     {4, "Thanks, it would really help us out. Once you've repaired them all, go check with Telecom to see if they need anything else.", "", -1, "", -1}};
 
-const Dialog dialogGoodlandTelecom[] = {
+constexpr Dialog dialogGoodlandTelecom[] = {
     {0, "Hey you! You look techy, can you go flash some taxi's? We have a crisis here. They are going haywire.", "Yes", 3, "I already did!", -2},
     {1, "Looks like we are still showing some taxi's are stuck around town. Can you go make sure you fix all of them?", "", -1, "", -1},
     {2, "That's great! Thank you so much for helping us get back online! Looks like we are fully functional now.", "", -1, "", -1},
@@ -131,7 +132,7 @@ const Dialog dialogGoodlandTelecom[] = {
     {4, "Thank you for your help! I'm going to take a break now.", "", -1, "", -1},
     {5, "Thank you for your help! I'm going to take a break now.", "", -1, "", -1}};
 
-const Dialog dialogBusManager[] = {
+constexpr Dialog dialogBusManager[] = {
     {0, "Oh, my. What are you doing here?", "I need to get to Wichita, there's a security conference I want to attend.", 1, "I fixed some buses in the garage.", 4},
     {1, "I see, well right now we are dealing with a situation that has taken down all our buses. All our maintenance techs are busy, can you help make a few buses road worthy?", "Absolutely!", 3, "Maybe, what's it entail?", 3},
     {2, "Come back to me when you're done.", "", -1, "", -1},
@@ -140,7 +141,7 @@ const Dialog dialogBusManager[] = {
     {5, "Looks like a few of them didn't get fixed, can you go check on them all again?.", "Ok.", 2, "", -1},
     {6, "You got them, thank you so much! Here's a ticket to get you on your way to Topeka.", "", -1, "", -1}};
 
-const Dialog dialogPrincipal[] = {
+constexpr Dialog dialogPrincipal[] = {
     {0, "Ah, glad you could make it! I wanted to talk to you about something important.",
      "Sure, what's up?", 1, "", -1},
     {1, "We've been experiencing some issues with our network lately, and I think it's best if you meet with our IT Specialist.",
@@ -152,7 +153,7 @@ const Dialog dialogPrincipal[] = {
     {4, "No problem! Good luck!",
      "", -1, "", -1}};
 
-const Dialog dialogitSpecialist[] = {
+constexpr Dialog dialogitSpecialist[] = {
     {0, "Hey there! Thanks for coming by. We've got a situation on our hands.",
      "What's going on?", 1, "Where you needing this?", 7},
     {1, "After the cyber attack, someone sent me a message saying they ripped my recovery notebook into pieces and spread them around the school.",
@@ -184,19 +185,19 @@ const Dialog dialogitSpecialist[] = {
 
 // Quest completion check -2, dialogIndex +1 if quest failed, +2 if quest completed.
 // Array of all NPC objects, their name, and their dialog variable
-const Npc npc[] = {{0, "Simon", dialogSimon},
-                   {1, "Bob", dialogBob},
-                   {2, "Chanute Reporter", dialogChanuteReporter},
-                   {3, "IT Manager", dialogWaterManager},
-                   {4, "Receptionist", dialogWaterReceptionist},
-                   {5, "Bank Teller", dialogBankTeller},
-                   {6, "Receptionist", dialogPittsburgTownHall},
-                   {7, "Clerk", dialogPittsburgCourthouse},
-                   {8, "Stacey", dialogPittsburgStacey},
-                   {9, "Dean", dialogPittsburgDean},
-                   {10, "Airport IT Guy", dialogWichitaAirport},
-                   {11, "Repair Tech", dialogGoodlandRepair},
-                   {12, "Telecom Tech", dialogGoodlandTelecom},
-                   {13, "Bus Manager", dialogBusManager},
-                   {14, "Principal", dialogPrincipal},
-                   {15, "IT Specialist", dialogitSpecialist}};
+constexpr Npc npc[] = {{0, "Simon", dialogSimon},
+                       {1, "Bob", dialogBob},
+                       {2, "Chanute Reporter", dialogChanuteReporter},
+                       {3, "IT Manager", dialogWaterManager},
+                       {4, "Receptionist", dialogWaterReceptionist},
+                       {5, "Bank Teller", dialogBankTeller},
+                       {6, "Receptionist", dialogPittsburgTownHall},
+                       {7, "Clerk", dialogPittsburgCourthouse},
+                       {8, "Stacey", dialogPittsburgStacey},
+                       {9, "Dean", dialogPittsburgDean},
+                       {10, "Airport IT Guy", dialogWichitaAirport},
+                       {11, "Repair Tech", dialogGoodlandRepair},
+                       {12, "Telecom Tech", dialogGoodlandTelecom},
+                       {13, "Bus Manager", dialogBusManager},
+                       {14, "Principal", dialogPrincipal},
+                       {15, "IT Specialist", dialogitSpecialist}};
@@ -0,0 +1,88 @@
+#ifndef Patterns_hpp
+#define Patterns_hpp
+#include <Arduino.h>
+
+// LED effects described as keyframes, played back by Lights::play() one frame at a time.
+// Each channel moves from one keyframe to the next using the easing of the later keyframe,
+// holds its first keyframe before it starts, and holds its last keyframe after it ends.
+
+#define PATTERN_STRIP 0xFF // Keyframe channel for the RGB strip brightness
+#define PATTERN_LED_ON 230 // Keyframe brightness for a lit map LED, just under full brightness
+
+enum Easing : uint8_t
+{
+    EASE_STEP,   // Jump to the keyframe brightness once its time is reached
+    EASE_LINEAR, // Straight ramp from the previous keyframe
+    EASE_IN,     // Ramp that starts slow and speeds up
+    EASE_OUT     // Ramp that starts fast and slows down
+};
+
+struct Keyframe
+{
+    uint8_t channel;    // LED channel (index in all_leds), or PATTERN_STRIP
+    uint16_t time;      // Time in ms from the start of the loop
+    uint8_t brightness; // 0 - 255, scaled to LED_MAX_BRIGHTNESS for map LEDs, raw brightness for PATTERN_STRIP
+    Easing easing;      // How to get from the previous keyframe of this channel to this one
+};
+
+struct Pattern
+{
+    const Keyframe *keyframes; // Grouped by channel, sorted by time within each channel
+    uint8_t count;             // Number of keyframes
+    uint16_t period;           // Length in ms of one loop of the keyframes
+    uint8_t loops;             // Number of loops played back to back
+    uint16_t duration;         // Length in ms of the whole pattern, the last frame holds after the loops end
+};
+
+/// @brief Check that keyframes of the same channel are in time order
+constexpr bool keyframesSorted(const Keyframe *keyframes, int count)
+{
+    for (int i = 1; i < count; i++)
+    {
+        if (keyframes[i].channel == keyframes[i - 1].channel && keyframes[i].time < keyframes[i - 1].time)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+// One heartbeat, the RGB ramps up, the map LEDs light up one after another as the RGB drops back a
+// little, then the RGB fades out and everything turns off.
+constexpr Keyframe heartbeatKeyframes[] = {
+    {7, 96, 0, EASE_STEP},
+    {7, 105, PATTERN_LED_ON, EASE_LINEAR},
+    {7, 242, 0, EASE_STEP},
+    {8, 106, 0, EASE_STEP},
+    {8, 115, PATTERN_LED_ON, EASE_LINEAR},
+    {8, 242, 0, EASE_STEP},
+    {1, 116, 0, EASE_STEP},
+    {1, 125, PATTERN_LED_ON, EASE_LINEAR},
+    {1, 242, 0, EASE_STEP},
+    {4, 126, 0, EASE_STEP},
+    {4, 135, PATTERN_LED_ON, EASE_LINEAR},
+    {4, 242, 0, EASE_STEP},
+    {2, 136, 0, EASE_STEP},
+    {2, 145, PATTERN_LED_ON, EASE_LINEAR},
+    {2, 242, 0, EASE_STEP},
+    {6, 146, 0, EASE_STEP},
+    {6, 155, PATTERN_LED_ON, EASE_LINEAR},
+    {6, 242, 0, EASE_STEP},
+    {3, 156, 0, EASE_STEP},
+    {3, 165, PATTERN_LED_ON, EASE_LINEAR},
+    {3, 242, 0, EASE_STEP},
+    {5, 166, 0, EASE_STEP},
+    {5, 175, PATTERN_LED_ON, EASE_LINEAR},
+    {5, 242, 0, EASE_STEP},
+    {PATTERN_STRIP, 0, 0, EASE_STEP},
+    {PATTERN_STRIP, 95, 95, EASE_LINEAR},
+    {PATTERN_STRIP, 96, 92, EASE_STEP},
+    {PATTERN_STRIP, 105, 65, EASE_LINEAR},
+    {PATTERN_STRIP, 176, 65, EASE_STEP},
+    {PATTERN_STRIP, 241, 0, EASE_LINEAR}};
+
+// Two heartbeats 1 ms apart followed by a rest
+constexpr Pattern heartbeatPattern = {heartbeatKeyframes, sizeof(heartbeatKeyframes) / sizeof(heartbeatKeyframes[0]), 243, 2, 985};
+static_assert(keyframesSorted(heartbeatKeyframes, sizeof(heartbeatKeyframes) / sizeof(heartbeatKeyframes[0])), "Heartbeat keyframes are out of order");
+
+#endif
@@ -0,0 +1,283 @@
+#ifndef Quests_hpp
+#define Quests_hpp
+#include <Arduino.h>
+#include <atomic>
+
+// Quest flags, each one is a bit in QuestFlags.
+// Saves store the flags by bit, only add new flags to the end so older saves still load.
+enum QuestFlag : uint8_t
+{
+    QUEST_MODEL2023,
+    QUEST_TRAINING,
+    QUEST_TRAININGVAULT,
+    QUEST_CHANUTE,
+    QUEST_PITTSBURG,
+    QUEST_PTSSHUTDOWN,
+    QUEST_PTSUNPLUG,
+    QUEST_KANSASCITY,
+    QUEST_KCBUS1024,
+    QUEST_KCBUS1138,
+    QUEST_KCBUS2018,
+    QUEST_TOPEKA,
+    QUEST_TPKDRIVE1,
+    QUEST_TPKDRIVE2,
+    QUEST_TPKDRIVE3,
+    QUEST_TPKDRIVE4,
+    QUEST_TPKDRIVE5,
+    QUEST_GOODLAND,
+    QUEST_GTS1,
+    QUEST_GTS2,
+    QUEST_GTS3,
+    QUEST_GTS4,
+    QUEST_GTS5,
+    QUEST_DODGECITY,
+    QUEST_DCSHERRIF,
+    QUEST_DCASSOCIATE,
+    QUEST_DCCONDUCTOR,
+    QUEST_NEWTON,
+    QUEST_NWTBALL,
+    QUEST_NWTDISC,
+    QUEST_ELLSWORTH,
+    QUEST_ELLAPTOP,
+    QUEST_ELLEVELS,
+    QUEST_ELACCESS,
+    QUEST_WICHITA,
+    QUEST_ICTWATERTAPE,
+    QUEST_ICTWATERLOADED,
+    QUEST_ICTWATER,
+    QUEST_ICTAIR1,
+    QUEST_ICTAIR2,
+    QUEST_ICTAIR3,
+    QUEST_ICTAIR4,
+    QUEST_ICTAIR5,
+    QUEST_ICTAIRUNLOCK,
+    QUEST_ICTAIRPORT,
+    QUEST_COUNT
+};
+
+static_assert(QUEST_COUNT <= 64, "Quest flags must fit in one 64 bit word");
+
+/// @brief Bit mask of one quest flag
+constexpr uint64_t questMask(QuestFlag flag)
+{
+    return 1ULL << flag;
+}
+
+/// @brief Bit mask of several quest flags, for completion checks with QuestFlags::all()
+template <typename... Flags>
+constexpr uint64_t questMask(QuestFlag flag, Flags... flags)
+{
+    return questMask(flag) | questMask(flags...);
+}
+
+// Quests that complete a city between them
+constexpr uint64_t QUESTS_KC_BUSES = questMask(QUEST_KCBUS1024, QUEST_KCBUS1138, QUEST_KCBUS2018);
+constexpr uint64_t QUESTS_TOPEKA_DRIVES = questMask(QUEST_TPKDRIVE1, QUEST_TPKDRIVE2, QUEST_TPKDRIVE3, QUEST_TPKDRIVE4, QUEST_TPKDRIVE5);
+constexpr uint64_t QUESTS_PITTSBURG_ATTACK = questMask(QUEST_PTSSHUTDOWN, QUEST_PTSUNPLUG);
+constexpr uint64_t QUESTS_GOODLAND_TAXIS = questMask(QUEST_GTS1, QUEST_GTS2, QUEST_GTS3, QUEST_GTS4, QUEST_GTS5);
+constexpr uint64_t QUESTS_DODGECITY_TRAIN = questMask(QUEST_DCCONDUCTOR, QUEST_DCASSOCIATE);
+constexpr uint64_t QUESTS_WICHITA_AIRPORT = questMask(QUEST_ICTAIR1, QUEST_ICTAIR2, QUEST_ICTAIR3, QUEST_ICTAIR4, QUEST_ICTAIR5);
+
+// Cities to complete before Wichita opens
+constexpr uint64_t QUESTS_WICHITA_GATE = questMask(QUEST_KANSASCITY, QUEST_TOPEKA, QUEST_GOODLAND, QUEST_DODGECITY, QUEST_NEWTON,
+                                                   QUEST_ELLSWORTH, QUEST_PITTSBURG, QUEST_CHANUTE);
+
+// Every quest flag
+constexpr uint64_t QUESTS_ALL = (1ULL << QUEST_COUNT) - 1;
+
+// Quest goals, each one is met once all the quest flags it requires are set.
+// Room gates and NPC checks ask whether a goal is met instead of testing the flags again.
+enum QuestGoal : uint8_t
+{
+    GOAL_VAULT_DOOR,           // Training area vault unlocked
+    GOAL_KC_BUSES,             // Kansas City buses fixed
+    GOAL_TOPEKA_DRIVES,        // Topeka hospital drives pulled
+    GOAL_PITTSBURG_ATTACK,     // Pittsburg laptop shut down and unplugged
+    GOAL_GOODLAND_TAXIS,       // Goodland taxis updated
+    GOAL_ELLSWORTH_PLANT,      // Checked in at the Ellsworth water plant
+    GOAL_DODGECITY_TRAIN_DOOR, // Dodge City train unlocked
+    GOAL_DODGECITY_TRAIN,      // Dodge City associate freed
+    GOAL_WICHITA_ROADS,        // Every other city done, the roads to Wichita open
+    GOAL_WICHITA_AIRPORT,      // Wichita airport systems rebooted
+    GOAL_WICHITA_AIRPORT_DOOR, // Wichita airport door unlocked
+    GOAL_WICHITA,              // Wichita water and airport done, the game is complete
+    GOAL_COUNT
+};
+
+static_assert(GOAL_COUNT <= 32, "Quest goals must fit in one 32 bit word");
+
+// One goal in the quest graph, see Adventure::updateQuests().
+// Built up in the graph like QuestNode(GOAL_WICHITA, mask).rewards(QUEST_WICHITA).says("...").flag("...").
+struct QuestNode
+{
+    QuestGoal goal;
+    uint64_t prerequisites; // Quest flags that must all be set
+    int8_t reward;          // Quest flag set as soon as the goal is met, or -1
+    const char *message;    // Printed with the reward, or NULL
+    const char *ctf;        // CTF flag printed with the reward, or NULL
+
+    constexpr QuestNode(QuestGoal goal, uint64_t prerequisites)
+        : goal(goal), prerequisites(prerequisites), reward(-1), message(NULL), ctf(NULL)
+    {
+    }
+
+    constexpr QuestNode rewards(QuestFlag flag) const
+    {
+        QuestNode node = *this;
+        node.reward = flag;
+        return node;
+    }
+
+    constexpr QuestNode says(const char *text) const
+    {
+        QuestNode node = *this;
+        node.message = text;
+        return node;
+    }
+
+    constexpr QuestNode flag(const char *text) const
+    {
+        QuestNode node = *this;
+        node.ctf = text;
+        return node;
+    }
+};
+
+// Goals to check again when a quest flag changes, one mask of QuestGoal bits per flag
+struct QuestDependents
+{
+    uint32_t goals[QUEST_COUNT];
+};
+
+/// @brief Find the goals that require each quest flag
+template <size_t N>
+constexpr QuestDependents questDependents(const QuestNode (&graph)[N])
+{
+    QuestDependents dependents = {};
+
+    for (size_t i = 0; i < N; i++)
+    {
+        for (int flag = 0; flag < QUEST_COUNT; flag++)
+        {
+            if (graph[i].prerequisites & questMask((QuestFlag)flag))
+            {
+                dependents.goals[flag] |= 1u << graph[i].goal;
+            }
+        }
+    }
+    return dependents;
+}
+
+/// @brief Check that the graph has every goal once, in QuestGoal order
+template <size_t N>
+constexpr bool questGraphOrdered(const QuestNode (&graph)[N])
+{
+    for (size_t i = 0; i < N; i++)
+    {
+        if (graph[i].goal != i)
+        {
+            return false;
+        }
+    }
+    return N == GOAL_COUNT;
+}
+
+/// @brief Find the quest flags a player can end up with, following goal rewards until nothing new is set.
+/// @param set Quest flags the game sets on its own, from room actions and NPCs
+template <size_t N>
+constexpr uint64_t questsReachable(const QuestNode (&graph)[N], uint64_t set)
+{
+    bool grown = true;
+
+    while (grown)
+    {
+        grown = false;
+        for (size_t i = 0; i < N; i++)
+        {
+            uint64_t reward = graph[i].reward == -1 ? 0 : questMask((QuestFlag)graph[i].reward);
+            if ((set & graph[i].prerequisites) == graph[i].prerequisites && (set & reward) != reward)
+            {
+                set |= reward;
+                grown = true;
+            }
+        }
+    }
+    return set;
+}
+
+/// @brief Check that every goal in the graph can be met
+/// @param set Quest flags the game sets on its own, from room actions and NPCs
+template <size_t N>
+constexpr bool questGoalsReachable(const QuestNode (&graph)[N], uint64_t set)
+{
+    uint64_t reachable = questsReachable(graph, set);
+
+    for (size_t i = 0; i < N; i++)
+    {
+        if ((reachable & graph[i].prerequisites) != graph[i].prerequisites)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Quest flags packed into one word, owned by the game loop
+struct QuestFlags
+{
+    uint64_t bits;
+
+    bool has(QuestFlag flag) const
+    {
+        return bits & questMask(flag);
+    }
+
+    /// @brief Check that every quest in a mask is done
+    bool all(uint64_t mask) const
+    {
+        return (bits & mask) == mask;
+    }
+
+    void set(QuestFlag flag, bool value)
+    {
+        bits = value ? bits | questMask(flag) : bits & ~questMask(flag);
+    }
+};
+
+// Quest goals that are met, kept up to date by the game loop as flags change
+struct QuestGoals
+{
+    uint32_t met;
+
+    bool has(QuestGoal goal) const
+    {
+        return met & (1u << goal);
+    }
+
+    void set(QuestGoal goal, bool value)
+    {
+        met = value ? met | (1u << goal) : met & ~(1u << goal);
+    }
+};
+
+// Copy of the quest flags for the LED task on core 0, published by the game loop.
+// A seqlock: the sequence is odd while the game loop writes the two halves, and a reader
+// reads again if the sequence was odd or changed underneath it. Neither side ever waits
+// for the other, and a reader never sees half of one update and half of the next.
+class Quests
+{
+private:
+    friend struct QuestsProbe; // Defined by the native tests in test/ to publish half an update
+    static std::atomic<uint32_t> sequence;
+    static std::atomic<uint32_t> low;
+    static std::atomic<uint32_t> high;
+
+public:
+    static unsigned long reads;   // Snapshots read
+    static unsigned long retries; // Reads done again because the game loop was publishing
+
+    static void publish(uint64_t bits);
+    static uint64_t snapshot();
+};
+
+#endif
\ No newline at end of file
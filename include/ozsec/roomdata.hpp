@@ -0,0 +1,4049 @@
+#ifndef RoomData_hpp
+#define RoomData_hpp
+#include <ozsec/rooms.hpp>
+
+// Generated by tools/rooms.py from content/rooms.json, do not edit by hand.
+// 476 rooms, 131828 bytes of text coded into 75273 bytes (57.1%), 58 option words, 2822 list entries, 1458 line breaks.
+
+#define ROOM_ID_COUNT 521 // Room ids are 0 to ROOM_ID_COUNT - 1
+#define ROOM_COUNT 476    // Rooms that exist
+#define ROOM_CODE_BITS 16 // Longest Huffman code in bits
+#define ROOM_WRAP_WIDTH 100 // Width of the line breaks in roomBreaks
+
+// Slot in roomRecords of each room id, ROOM_NONE if there is no room
+constexpr uint16_t roomSlots[ROOM_ID_COUNT] = {
+    0, 1, 2, 3, 65535, 65535, 65535, 65535, 65535, 65535, 4, 5, 6, 7, 8, 9,
+    10, 11, 12, 13, 14, 15, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 16, 17, 18,
+    19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34,
+    35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50,
+    51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66,
+    67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82,
+    83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95, 96, 97, 98,
+    99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114,
+    115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130,
+    131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143, 144, 145, 146,
+    147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159, 160, 161, 162,
+    163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 175, 176, 177, 178,
+    179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191, 192, 193, 194,
+    195, 196, 197, 198, 199, 200, 201, 202, 203, 204, 205, 206, 207, 208, 209, 210,
+    211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224, 225, 226,
+    227, 228, 229, 230, 231, 232, 233, 234, 235, 236, 237, 238, 239, 240, 241, 242,
+    243, 244, 245, 246, 247, 248, 249, 250, 251, 252, 253, 254, 255, 256, 257, 258,
+    259, 260, 261, 262, 263, 264, 265, 266, 267, 268, 269, 270, 271, 272, 273, 274,
+    275, 276, 277, 278, 279, 280, 281, 282, 283, 284, 285, 286, 287, 288, 289, 290,
+    291, 292, 293, 294, 295, 296, 297, 298, 299, 300, 301, 302, 303, 304, 305, 306,
+    307, 308, 309, 310, 311, 312, 313, 314, 315, 316, 317, 318, 319, 320, 321, 322,
+    323, 324, 325, 326, 327, 328, 329, 330, 331, 332, 333, 334, 335, 336, 337, 338,
+    339, 340, 341, 342, 343, 344, 345, 346, 347, 348, 349, 350, 351, 352, 353, 354,
+    355, 356, 357, 358, 359, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369, 370,
+    371, 372, 373, 374, 375, 376, 377, 378, 379, 380, 381, 382, 383, 384, 385, 386,
+    387, 388, 389, 390, 391, 392, 393, 394, 395, 396, 397, 398, 399, 400, 401, 402,
+    403, 404, 405, 406, 407, 408, 409, 410, 411, 412, 413, 414, 415, 416, 417, 418,
+    419, 420, 421, 422, 423, 424, 425, 426, 427, 428, 429, 430, 431, 432, 433, 434,
+    435, 436, 437, 438, 439, 440, 441, 442, 443, 444, 445, 446, 447, 448, 449, 450,
+    451, 452, 453, 454, 455, 456, 457, 458, 459, 460, 461, 462, 463, 464, 465, 466,
+    467, 468, 469, 470, 471, 472, 473, 474, 475,
+};
+
+constexpr RoomRecord roomRecords[ROOM_COUNT] = {
+    {0, 8, 69, 0, 0}, // 0 The Vault
+    {89, 12, 146, 5, 3}, // 1 The Grand Lobby
+    {263, 13, 195, 12, 8}, // 2 The Great Outdoors
+    {525, 11, 227, 21, 13}, // 3 The Training Tent
+    {823, 15, 284, 27, 20}, // 10 Back of Bus 2048
+    {1108, 10, 236, 31, 26}, // 11 Bus 2048
+    {1404, 9, 260, 39, 32}, // 12 Large Garage
+    {1665, 5, 208, 45, 38}, // 13 Garage
+    {1874, 9, 242, 53, 43}, // 14 Bus 1138
+    {2142, 5, 217, 58, 49}, // 15 Garage
+    {2360, 10, 222, 66, 54}, // 16 Bus 2018
+    {2625, 9, 209, 71, 59}, // 17 Garage Ramp
+    {2835, 16, 218, 77, 64}, // 18 Bus Maintenance Building
+    {3054, 19, 234, 87, 69}, // 19 Maintenance Manager's Office
+    {3315, 10, 237, 92, 74}, // 20 Bus Operations
+    {3582, 13, 263, 97, 80}, // 21 Bus Terminal Exit
+    {3882, 14, 253, 102, 86}, // 61 Highway 70 Topeka
+    {4136, 9, 183, 108, 92}, // 62 Highway 70
+    {4320, 9, 177, 114, 97}, // 63 Highway 70
+    {4498, 9, 170, 120, 102}, // 64 Highway 70
+    {4669, 11, 169, 128, 106}, // 65 Washburn Avenue
+    {4839, 11, 152, 136, 110}, // 66 Washburn Avenue
+    {4992, 11, 170, 142, 114}, // 67 Washburn Avenue
+    {5163, 11, 163, 148, 118}, // 68 Washburn Avenue
+    {5327, 11, 168, 154, 122}, // 69 Washburn Avenue
+    {5496, 11, 162, 160, 126}, // 70 Highway 470
+    {5659, 11, 185, 166, 130}, // 71 Highway 470
+    {5845, 11, 151, 172, 134}, // 72 Highway 470
+    {5997, 11, 144, 182, 138}, // 73 Highway 470
+    {6142, 11, 152, 188, 142}, // 74 Highway 470
+    {6295, 11, 164, 196, 146}, // 75 Highway 470
+    {6460, 11, 139, 202, 150}, // 76 Highway 470
+    {6600, 9, 156, 208, 154}, // 77 Highway 70
+    {6757, 9, 149, 216, 158}, // 78 Highway 70
+    {6907, 11, 206, 222, 162}, // 79 Hospital Lobby
+    {7142, 15, 166, 229, 167}, // 80 Administrative Hallway
+    {7309, 10, 179, 237, 171}, // 81 Conference Room
+    {7543, 6, 150, 243, 176}, // 82 Hallway
+    {7694, 6, 141, 249, 180}, // 83 Hallway
+    {7836, 6, 117, 257, 184}, // 84 Hallway
+    {7954, 15, 166, 265, 188}, // 85 IT Manager's Office
+    {8121, 8, 141, 271, 192}, // 86 Server Room
+    {8287, 8, 156, 276, 196}, // 87 Break Room
+    {8466, 6, 114, 281, 200}, // 88 Hallway
+    {8581, 6, 127, 289, 204}, // 89 Office
+    {8733, 6, 123, 294, 208}, // 90 Office
+    {8881, 6, 135, 299, 212}, // 91 Hallway
+    {9017, 6, 142, 307, 216}, // 92 Hallway
+    {9160, 10, 154, 315, 220}, // 93 Network Closet
+    {9335, 8, 140, 320, 224}, // 94 Data Center
+    {9506, 10, 148, 325, 228}, // 95 Conference Room
+    {9655, 17, 172, 329, 232}, // 96 Security Operations Center
+    {9828, 6, 161, 333, 236}, // 97 Hallway
+    {9990, 6, 155, 343, 240}, // 98 Office
+    {10183, 13, 188, 348, 244}, // 99 Cyber Response Firm
+    {10372, 16, 173, 354, 249}, // 100 Plummer Ave and Main St
+    {10580, 8, 68, 363, 253}, // 101 Main Street
+    {10649, 8, 241, 369, 256}, // 102 Main Street
+    {10891, 11, 178, 379, 262}, // 103 Coffee Connection
+    {11168, 10, 150, 385, 267}, // 104 Bank Entrance
+    {11319, 9, 188, 393, 271}, // 105 Bank Lobby
+    {11508, 8, 131, 401, 276}, // 106 Teller Line
+    {11640, 12, 178, 405, 280}, // 107 Banker's Office
+    {11819, 11, 184, 409, 285}, // 108 The Bank Vault
+    {12004, 8, 184, 413, 290}, // 109 Main Street
+    {12189, 9, 138, 421, 295}, // 110 Lincoln Ave
+    {12328, 7, 194, 427, 299}, // 111 Dead End
+    {12523, 8, 154, 431, 304}, // 112 Main Street
+    {12678, 8, 71, 439, 308}, // 113 Main Street
+    {12750, 8, 68, 445, 311}, // 114 Main Street
+    {12819, 19, 87, 451, 314}, // 115 Main Street and Central Avenue
+    {12907, 12, 201, 457, 317}, // 116 Town Hall Lobby
+    {13109, 13, 100, 465, 322}, // 117 The Town Hall-way
+    {13210, 17, 207, 475, 325}, // 118 Visitor Information Center
+    {13446, 8, 132, 480, 330}, // 119 Break Room
+    {13579, 10, 138, 484, 334}, // 120 Mayors Office
+    {13718, 8, 135, 488, 338}, // 121 Back Alley
+    {13854, 8, 61, 496, 342}, // 122 Back Alley
+    {13945, 8, 123, 503, 344}, // 123 Back Alley
+    {14069, 9, 119, 509, 348}, // 124 Parking Lot
+    {14189, 8, 122, 513, 351}, // 125 Back Alley
+    {14312, 8, 96, 517, 355}, // 126 Central Ave
+    {14409, 8, 74, 523, 358}, // 127 Central Ave
+    {14510, 8, 54, 531, 361}, // 128 Central Ave
+    {14565, 12, 120, 539, 363}, // 129 Fast Fuel Station
+    {14686, 19, 63, 545, 366}, // 130 Central Avenue and 14th Street
+    {14781, 9, 60, 554, 368}, // 131 14th Street
+    {14842, 9, 64, 562, 370}, // 132 14th Street
+    {14907, 9, 57, 568, 372}, // 133 14th Street
+    {14965, 9, 172, 574, 374}, // 134 14th Street
+    {15138, 9, 118, 582, 378}, // 135 The Hangzone
+    {15257, 9, 73, 586, 381}, // 136 14th Street
+    {15331, 19, 124, 592, 384}, // 137 Highway to Wichita and Chanute
+    {15489, 9, 134, 601, 387}, // 138 Plummer Ave
+    {15624, 9, 81, 607, 391}, // 139 Plummer Ave
+    {15706, 9, 72, 613, 394}, // 140 Plummer Ave
+    {15779, 9, 129, 621, 397}, // 141 Plummer Ave
+    {15909, 8, 23, 627, 401}, // 142 Room 142
+    {15933, 8, 22, 629, 403}, // 143 Room 143
+    {15956, 8, 22, 631, 405}, // 144 Room 144
+    {15979, 8, 23, 633, 407}, // 145 Room 145
+    {16003, 9, 24, 635, 409}, // 146 Room 146
+    {16028, 8, 23, 637, 411}, // 147 Room 147
+    {16052, 9, 24, 639, 413}, // 148 Room 148
+    {16077, 9, 24, 641, 415}, // 149 Room 149
+    {16102, 12, 225, 643, 417}, // 150 Highway to Chanute
+    {16364, 10, 182, 652, 422}, // 151 Highway 69
+    {16547, 7, 170, 658, 427}, // 152 Broadway
+    {16718, 17, 191, 666, 431}, // 153 The Little Shop of Flowers
+    {16941, 7, 186, 671, 436}, // 154 Broadway
+    {17128, 8, 177, 679, 441}, // 155 Blue Spoon
+    {17306, 7, 190, 683, 446}, // 156 Broadway
+    {17497, 11, 206, 691, 451}, // 157 Root Coffeehouse
+    {17779, 13, 229, 697, 456}, // 158 Broadway and Fourth
+    {18009, 9, 171, 707, 461}, // 159 Fourth Street
+    {18181, 9, 157, 715, 465}, // 160 Fourth Street
+    {18339, 7, 230, 719, 469}, // 161 City Hall
+    {18631, 7, 180, 725, 475}, // 162 Broadway
+    {18812, 16, 209, 733, 480}, // 163 Pittsburg Bank and Trust
+    {19022, 7, 171, 737, 485}, // 164 Broadway
+    {19194, 11, 182, 745, 489}, // 165 Pittsburg Post
+    {19377, 7, 147, 749, 494}, // 166 Broadway
+    {19525, 12, 203, 755, 498}, // 167 Broadway and Ford
+    {19729, 7, 148, 763, 503}, // 168 Broadway
+    {19878, 12, 179, 769, 507}, // 169 Courthouse Lobby
+    {20058, 7, 193, 775, 512}, // 170 Reception
+    {20287, 9, 174, 784, 517}, // 171 Waiting Room
+    {20495, 11, 137, 789, 522}, // 172 Courthouse Hall
+    {20633, 11, 158, 795, 526}, // 173 Courthouse Hall
+    {20792, 17, 197, 803, 530}, // 174 Courthouse Network Closet
+    {21018, 8, 160, 808, 535}, // 175 Ford Street
+    {21179, 8, 137, 814, 539}, // 176 Ford Street
+    {21317, 11, 157, 820, 543}, // 177 Ford and Joplin
+    {21475, 11, 225, 828, 547}, // 178 Pittsburg Park
+    {21791, 6, 138, 834, 552}, // 179 Joplin
+    {21930, 6, 170, 840, 556}, // 180 Joplin
+    {22101, 6, 152, 850, 560}, // 181 Stadium
+    {22254, 6, 144, 854, 564}, // 182 Joplin
+    {22399, 14, 147, 860, 568}, // 183 Joplin and Cleveland
+    {22547, 11, 156, 868, 572}, // 184 Cleveland Street
+    {22704, 7, 171, 874, 576}, // 185 Bookstore
+    {22876, 12, 162, 878, 580}, // 186 Fourth and Joplin
+    {23039, 9, 163, 884, 584}, // 187 Fourth Street
+    {23203, 14, 199, 892, 588}, // 188 Pittsburg Pup Park
+    {23403, 9, 142, 896, 593}, // 189 Fourth Street
+    {23546, 13, 175, 902, 597}, // 190 University Entrance
+    {23722, 6, 166, 908, 601}, // 191 Hallway
+    {23889, 6, 134, 916, 606}, // 192 Hallway
+    {24024, 10, 173, 924, 610}, // 193 Dean's Office
+    {24234, 6, 141, 929, 614}, // 194 Hallway
+    {24376, 7, 172, 937, 618}, // 195 Classroom
+    {24581, 11, 163, 942, 623}, // 196 Pittsburg Court
+    {24745, 6, 98, 946, 627}, // 197 Hallway
+    {24844, 6, 131, 952, 630}, // 198 Hallway
+    {25025, 10, 229, 957, 634}, // 199 Computer Lab
+    {25353, 22, 187, 963, 639}, // 200 Corner of Main Street and 1st Street
+    {25541, 8, 69, 971, 644}, // 201 Main Street
+    {25611, 21, 196, 977, 647}, // 202 Corner of Main Street and Broadway
+    {25808, 8, 180, 983, 652}, // 203 Main Street
+    {25989, 21, 199, 989, 656}, // 204 Corner of Main St and 12th Street
+    {26189, 9, 160, 995, 661}, // 205 12th Street
+    {26350, 21, 122, 1001, 665}, // 206 Newton High School Parking Lot
+    {26497, 21, 169, 1010, 668}, // 207 Corner of 12th Street and Meridian
+    {26667, 10, 152, 1016, 672}, // 208 Meridian Street
+    {26820, 20, 159, 1022, 676}, // 209 Corner of Meridian and Main Street
+    {26980, 8, 158, 1028, 680}, // 210 Main Street
+    {27139, 18, 172, 1034, 684}, // 211 Athletic Park Parking Lot
+    {27312, 8, 23, 1042, 688}, // 212 First Street
+    {27336, 10, 174, 1048, 690}, // 213 Athletic Park
+    {27569, 20, 107, 1054, 695}, // 214 Lobby of Newton High School
+    {27677, 20, 258, 1060, 698}, // 215 Office of Newton High School
+    {27936, 14, 166, 1068, 704}, // 216 Principal's Office
+    {28124, 6, 165, 1073, 708}, // 217 A Hall
+    {28290, 6, 165, 1079, 713}, // 218 A Hall
+    {28456, 6, 210, 1085, 718}, // 219 Commons
+    {28667, 6, 169, 1093, 723}, // 220 A Hall
+    {28837, 8, 155, 1101, 727}, // 221 IT Office
+    {29035, 8, 123, 1109, 731}, // 222 Server Room
+    {29188, 21, 172, 1114, 735}, // 223 Intersection of A Hall and B Hall
+    {29361, 6, 147, 1122, 739}, // 224 B Hall
+    {29509, 8, 191, 1128, 743}, // 225 Gymnasium
+    {29733, 21, 195, 1133, 748}, // 226 Intersection of A Hall and C Hall
+    {29929, 6, 157, 1141, 753}, // 227 C Hall
+    {30087, 6, 183, 1147, 757}, // 228 C Hall
+    {30271, 8, 254, 1153, 762}, // 229 Auditorium
+    {30559, 21, 198, 1158, 768}, // 230 Intersection of A Hall and D Hall
+    {30758, 6, 144, 1166, 773}, // 231 D Hall
+    {30903, 6, 144, 1172, 777}, // 232 D Hall
+    {31048, 21, 201, 1176, 781}, // 233 Intersection of A Hall and E Hall
+    {31250, 6, 183, 1184, 786}, // 234 E Hall
+    {31434, 31, 194, 1190, 791}, // 235 Intersection of E Hall and Computer Lab Hallway
+    {31629, 15, 178, 1196, 795}, // 236 Computer Lab Hallway
+    {31808, 10, 224, 1202, 799}, // 237 Computer Lab
+    {32065, 21, 197, 1207, 804}, // 238 Intersection of A Hall and F Hall
+    {32263, 6, 193, 1213, 809}, // 239 F Hall
+    {32457, 9, 214, 1217, 814}, // 240 Lunch Room
+    {32701, 6, 182, 1224, 819}, // 241 Kitchen
+    {32916, 9, 24, 1229, 824}, // 242 Room 242
+    {32941, 8, 23, 1231, 826}, // 243 Room 243
+    {32965, 8, 23, 1233, 828}, // 244 Room 244
+    {32989, 9, 24, 1235, 830}, // 245 Room 245
+    {33014, 9, 24, 1237, 832}, // 246 Room 246
+    {33039, 9, 24, 1239, 834}, // 247 Room 247
+    {33064, 9, 24, 1241, 836}, // 248 Room 248
+    {33089, 9, 24, 1243, 838}, // 249 Room 249
+    {33114, 22, 217, 1245, 840}, // 250 Highway to Wichita from Ellsworth
+    {33332, 25, 222, 1251, 845}, // 251 Highway 70 to Goodland and Ellsworth
+    {33555, 23, 206, 1257, 850}, // 252 Highway between Ellsworth and Topeka
+    {33762, 10, 207, 1263, 855}, // 253 Douglas Avenue
+    {33970, 11, 193, 1269, 860}, // 254 Douglas and Main
+    {34164, 10, 179, 1279, 865}, // 255 Douglas Avenue
+    {34344, 10, 86, 1285, 870}, // 256 Douglas Avenue
+    {34431, 16, 336, 1293, 873}, // 257 Ellsworth Water Supply
+    {34795, 10, 171, 1298, 880}, // 258 Douglas Avenue
+    {34967, 8, 140, 1306, 884}, // 259 Third Street
+    {35108, 10, 181, 1312, 888}, // 260 Lincoln Avenue
+    {35290, 10, 167, 1320, 893}, // 261 Lincoln Avenue
+    {35458, 9, 166, 1326, 897}, // 262 Fourth Street
+    {35625, 9, 147, 1334, 901}, // 263 Fourth Street
+    {35773, 9, 154, 1340, 905}, // 264 Fourth Street
+    {35928, 20, 186, 1348, 909}, // 265 Ellsworth Water Treatment Plant
+    {36139, 9, 157, 1355, 913}, // 266 Fourth Street
+    {36297, 14, 156, 1361, 917}, // 267 Fourth and Washington
+    {36454, 12, 158, 1367, 921}, // 268 Washington Avenue
+    {36613, 12, 159, 1373, 925}, // 269 Washington Avenue
+    {36773, 13, 155, 1379, 929}, // 270 Washington and Main
+    {36929, 14, 179, 1387, 933}, // 271 Ellsworth City Park
+    {37135, 8, 141, 1392, 937}, // 272 Main Street
+    {37277, 11, 152, 1398, 941}, // 273 Main and Lincoln
+    {37430, 8, 150, 1406, 945}, // 274 Main Street
+    {37581, 10, 160, 1412, 949}, // 275 Douglas Avenue
+    {37742, 10, 159, 1420, 953}, // 276 Douglas Avenue
+    {37902, 9, 117, 1428, 957}, // 277 Fourth Street
+    {38020, 10, 171, 1434, 960}, // 278 Douglas Avenue
+    {38192, 15, 160, 1442, 964}, // 279 Ellsworth Speedy Store
+    {38379, 10, 161, 1447, 968}, // 280 Douglas Avenue
+    {38541, 9, 179, 1453, 972}, // 281 Highway 70
+    {38721, 8, 150, 1461, 976}, // 282 Third Street
+    {38872, 10, 161, 1467, 980}, // 283 Third and Grand
+    {39034, 9, 144, 1473, 984}, // 284 Grand Avenue
+    {39179, 9, 148, 1481, 988}, // 285 Post Office
+    {39352, 8, 154, 1486, 992}, // 286 Main Street
+    {39507, 8, 149, 1492, 996}, // 287 First Street
+    {39657, 9, 150, 1498, 1000}, // 288 Highway 70
+    {39808, 9, 142, 1504, 1004}, // 289 Highway 70
+    {39951, 6, 165, 1510, 1008}, // 290 Office
+    {40117, 6, 132, 1514, 1012}, // 291 Lobby
+    {40271, 6, 119, 1523, 1016}, // 292 Hallway
+    {40391, 6, 145, 1527, 1020}, // 293 Hallway
+    {40537, 16, 153, 1533, 1024}, // 294 Plant Manager's Office
+    {40714, 6, 119, 1538, 1028}, // 295 Hallway
+    {40834, 9, 166, 1544, 1032}, // 296 Control Room
+    {41025, 12, 150, 1551, 1036}, // 297 Quality Control
+    {41194, 14, 156, 1558, 1040}, // 298 Additive Control Room
+    {41394, 10, 152, 1565, 1044}, // 299 Network Closet
+    {41575, 16, 253, 1570, 1048}, // 300 Goodland and Dodge City
+    {41829, 15, 217, 1576, 1054}, // 301 Goodland and Ellsworth
+    {42047, 9, 248, 1582, 1059}, // 302 Highway 70
+    {42350, 9, 196, 1592, 1065}, // 303 Highway 70
+    {42547, 11, 226, 1600, 1070}, // 304 Caldwell Avenue
+    {42811, 9, 193, 1607, 1075}, // 305 Highway 70
+    {43005, 20, 210, 1613, 1080}, // 306 Highway 70 and Commerce Road
+    {43216, 10, 189, 1619, 1085}, // 307 Commerce Road
+    {43406, 20, 207, 1625, 1090}, // 308 Commerce Road and Highway 24
+    {43614, 10, 159, 1633, 1095}, // 309 Commerce Road
+    {43774, 10, 172, 1639, 1099}, // 310 Commerce Road
+    {43947, 10, 165, 1645, 1103}, // 311 Commerce Road
+    {44113, 16, 187, 1651, 1107}, // 312 Commerce and County Road
+    {44301, 9, 196, 1657, 1112}, // 313 County Road
+    {44498, 18, 157, 1663, 1117}, // 314 County Road and Main Avenue
+    {44656, 9, 182, 1671, 1121}, // 315 County Road
+    {44839, 9, 162, 1677, 1126}, // 316 County Road
+    {45002, 9, 202, 1685, 1130}, // 317 Airport Road
+    {45259, 11, 178, 1693, 1135}, // 318 Caldwell Avenue
+    {45438, 11, 155, 1701, 1140}, // 319 Caldwell Avenue
+    {45594, 11, 164, 1709, 1144}, // 320 Caldwell Avenue
+    {45759, 11, 166, 1717, 1148}, // 321 Caldwell Avenue
+    {45926, 17, 199, 1725, 1152}, // 322 Caldwell and Highway 24
+    {46126, 9, 181, 1733, 1157}, // 323 Highway 24
+    {46308, 9, 179, 1739, 1162}, // 324 Highway 24
+    {46488, 12, 210, 1747, 1167}, // 325 Auto Repair Shop
+    {46720, 9, 168, 1752, 1172}, // 326 Highway 24
+    {46889, 9, 177, 1758, 1176}, // 327 Highway 24
+    {47090, 8, 158, 1767, 1180}, // 328 The Kitchen
+    {47249, 9, 174, 1771, 1184}, // 329 13th Street
+    {47424, 9, 184, 1777, 1188}, // 330 13th Street
+    {47609, 11, 178, 1785, 1193}, // 331 Telecom Services
+    {47809, 13, 176, 1790, 1198}, // 332 13th and Broadway
+    {47986, 9, 187, 1798, 1202}, // 333 13th Street
+    {48174, 14, 183, 1804, 1207}, // 334 Main and 13th Street
+    {48358, 8, 160, 1810, 1212}, // 335 Main Avenue
+    {48519, 8, 162, 1816, 1216}, // 336 Main Avenue
+    {48682, 8, 197, 1824, 1220}, // 337 Main Avenue
+    {48880, 9, 23, 1830, 1225}, // 338 Room 338
+    {48904, 8, 190, 1832, 1227}, // 339 Main Avenue
+    {49095, 11, 247, 1840, 1232}, // 340 The Fairgrounds
+    {49399, 8, 200, 1846, 1238}, // 341 5th Street
+    {49600, 12, 179, 1852, 1243}, // 342 5th and Broadway
+    {49780, 8, 155, 1860, 1248}, // 343 5th Street
+    {49936, 7, 161, 1866, 1252}, // 344 Broadway
+    {50098, 13, 182, 1872, 1256}, // 345 Broadway and 10th
+    {50281, 9, 135, 1882, 1261}, // 346 10th Street
+    {50417, 7, 154, 1888, 1265}, // 347 Broadway
+    {50572, 9, 141, 1894, 1269}, // 348 10th Street
+    {50714, 10, 225, 1900, 1273}, // 349 Taxi Parking
+    {50963, 14, 314, 1905, 1279}, // 350 Welcome to Dodge City
+    {51306, 8, 261, 1912, 1286}, // 351 Main Street
+    {51568, 12, 250, 1920, 1292}, // 352 Sheriff's Office
+    {51819, 9, 284, 1926, 1298}, // 353 Jail Block
+    {52136, 8, 242, 1931, 1304}, // 354 Main Street
+    {52379, 5, 271, 1939, 1310}, // 355 Saloon
+    {52680, 6, 212, 1948, 1316}, // 356 The Bar
+    {52911, 8, 247, 1953, 1321}, // 357 Game Room
+    {53188, 8, 190, 1958, 1327}, // 358 Main Street
+    {53379, 13, 231, 1964, 1332}, // 359 Main and Wyatt Earp
+    {53611, 15, 196, 1974, 1337}, // 360 Wyatt Earp Boulevard
+    {53808, 13, 159, 1980, 1342}, // 361 Abandoned Building
+    {53968, 9, 173, 1984, 1346}, // 362 Road Closure
+    {54142, 15, 197, 1988, 1350}, // 363 Wyatt Earp Boulevard
+    {54340, 8, 153, 1994, 1355}, // 364 Side Street
+    {54494, 25, 220, 2002, 1359}, // 365 Dodge the Po'boys Sandwiches and Fuel
+    {54736, 9, 156, 2007, 1364}, // 366 Road Closure
+    {54893, 8, 152, 2011, 1368}, // 367 Main Street
+    {55046, 8, 157, 2017, 1372}, // 368 Main Street
+    {55204, 15, 242, 2025, 1376}, // 369 Highway to Dodge City
+    {55491, 11, 447, 2030, 1382}, // 370 Train to Wichita
+    {55939, 9, 225, 2036, 1392}, // 371 Train Station
+    {56197, 10, 231, 2043, 1397}, // 372 Train Platform
+    {56457, 8, 22, 2050, 1403}, // 373 Room 373
+    {56480, 8, 22, 2052, 1405}, // 374 Room 374
+    {56503, 9, 23, 2054, 1407}, // 375 Room 375
+    {56527, 9, 23, 2056, 1409}, // 376 Room 376
+    {56551, 9, 23, 2058, 1411}, // 377 Room 377
+    {56575, 9, 23, 2060, 1413}, // 378 Room 378
+    {56599, 9, 23, 2062, 1415}, // 379 Room 379
+    {56623, 9, 23, 2064, 1417}, // 380 Room 380
+    {56647, 9, 23, 2066, 1419}, // 381 Room 381
+    {56671, 9, 23, 2068, 1421}, // 382 Room 382
+    {56695, 9, 23, 2070, 1423}, // 383 Room 383
+    {56719, 9, 23, 2072, 1425}, // 384 Room 384
+    {56743, 9, 23, 2074, 1427}, // 385 Room 385
+    {56767, 9, 24, 2076, 1429}, // 386 Room 386
+    {56792, 9, 23, 2078, 1431}, // 387 Room 387
+    {56816, 9, 24, 2080, 1433}, // 388 Room 388
+    {56841, 9, 24, 2082, 1435}, // 389 Room 389
+    {56866, 9, 23, 2084, 1437}, // 390 Room 390
+    {56890, 9, 23, 2086, 1439}, // 391 Room 391
+    {56914, 9, 23, 2088, 1441}, // 392 Room 392
+    {56938, 9, 23, 2090, 1443}, // 393 Room 393
+    {56962, 9, 23, 2092, 1445}, // 394 Room 394
+    {56986, 9, 23, 2094, 1447}, // 395 Room 395
+    {57010, 9, 24, 2096, 1449}, // 396 Room 396
+    {57035, 9, 23, 2098, 1451}, // 397 Room 397
+    {57059, 9, 24, 2100, 1453}, // 398 Room 398
+    {57084, 9, 24, 2102, 1455}, // 399 Room 399
+    {57109, 13, 205, 2104, 1457}, // 400 Kellogg and 235
+    {57315, 6, 215, 2112, 1462}, // 401 Kellogg
+    {57531, 6, 174, 2118, 1467}, // 402 Kellogg
+    {57706, 9, 187, 2126, 1472}, // 403 Airport Road
+    {57894, 9, 203, 2132, 1477}, // 404 Airport Road
+    {58098, 9, 187, 2140, 1482}, // 405 Airport Road
+    {58286, 9, 109, 2146, 1487}, // 406 Airport Road
+    {58396, 9, 190, 2152, 1490}, // 407 Airport Road
+    {58587, 9, 127, 2158, 1495}, // 408 Airport Road
+    {58715, 9, 153, 2166, 1499}, // 409 Airport Road
+    {58869, 9, 110, 2172, 1503}, // 410 Airport Road
+    {58980, 9, 211, 2180, 1506}, // 411 Airport Road
+    {59192, 9, 184, 2186, 1511}, // 412 Airport Road
+    {59377, 9, 179, 2192, 1516}, // 413 Airport Road
+    {59557, 9, 205, 2198, 1521}, // 414 Airport Road
+    {59763, 9, 159, 2206, 1526}, // 415 Storage Room
+    {59923, 9, 181, 2208, 1530}, // 416 Airport Road
+    {60105, 13, 180, 2214, 1535}, // 417 Staff Parking Area
+    {60286, 6, 215, 2218, 1540}, // 418 Kellogg
+    {60502, 6, 117, 2224, 1545}, // 419 Kellogg
+    {60620, 6, 150, 2232, 1548}, // 420 Kellogg
+    {60771, 13, 178, 2238, 1552}, // 421 Kellogg and 135
+    {60950, 12, 172, 2246, 1556}, // 422 Highway to Topeka
+    {61123, 11, 165, 2252, 1560}, // 423 Highway 135
+    {61289, 11, 147, 2258, 1564}, // 424 Highway 135
+    {61437, 11, 187, 2266, 1568}, // 425 Highway 135
+    {61625, 24, 170, 2272, 1573}, // 426 Highway 135 and Highway to Chanute
+    {61796, 12, 171, 2280, 1577}, // 427 Highway to Newton
+    {61968, 9, 170, 2286, 1581}, // 428 Central Exit
+    {62139, 10, 161, 2292, 1585}, // 429 Central Avenue
+    {62301, 10, 148, 2298, 1589}, // 430 Central Avenue
+    {62450, 8, 210, 2306, 1593}, // 431 Mead Street
+    {62661, 8, 165, 2316, 1598}, // 432 Mead Street
+    {62827, 11, 214, 2324, 1602}, // 433 Douglas and Mead
+    {63042, 13, 190, 2332, 1607}, // 434 The Orpheum Theatre
+    {63233, 8, 168, 2336, 1612}, // 435 Mead Street
+    {63402, 14, 153, 2342, 1616}, // 436 Mead Street Dead End
+    {63556, 10, 165, 2346, 1620}, // 437 Douglas Avenue
+    {63722, 13, 180, 2352, 1624}, // 438 Mosley and Douglas
+    {63903, 9, 116, 2362, 1629}, // 439 Mosley Street
+    {64020, 15, 152, 2370, 1632}, // 440 Mosley Street Dead End
+    {64173, 9, 181, 2374, 1636}, // 441 Mosley Street
+    {64355, 9, 141, 2380, 1641}, // 442 Mosley Street
+    {64497, 10, 183, 2388, 1645}, // 443 Central Avenue
+    {64681, 10, 167, 2396, 1650}, // 444 Central Avenue
+    {64849, 10, 159, 2406, 1654}, // 445 Central Avenue
+    {65009, 11, 176, 2412, 1658}, // 446 Main and Central
+    {65186, 8, 193, 2422, 1663}, // 447 Main Street
+    {65380, 9, 131, 2428, 1668}, // 448 Main and Elm
+    {65512, 8, 116, 2434, 1672}, // 449 Elm Street
+    {65629, 8, 147, 2442, 1675}, // 450 Elm Street
+    {65777, 10, 215, 2448, 1679}, // 451 Central Circle
+    {65993, 10, 195, 2458, 1684}, // 452 Central Avenue
+    {66189, 10, 189, 2466, 1689}, // 453 Central Avenue
+    {66379, 15, 209, 2474, 1694}, // 454 The Keeper of the Plains
+    {66589, 8, 156, 2480, 1699}, // 455 Main Street
+    {66746, 8, 152, 2486, 1703}, // 456 Main Street
+    {66899, 11, 199, 2494, 1707}, // 457 Main and Douglas
+    {67099, 10, 174, 2504, 1712}, // 458 Douglas Avenue
+    {67274, 8, 147, 2510, 1717}, // 459 Main Street
+    {67422, 8, 186, 2516, 1721}, // 460 Main Street
+    {67609, 9, 24, 2524, 1726}, // 461 Room 461
+    {67634, 9, 24, 2526, 1728}, // 462 Room 462
+    {67659, 9, 24, 2528, 1730}, // 463 Room 463
+    {67684, 9, 24, 2530, 1732}, // 464 Room 464
+    {67709, 9, 24, 2532, 1734}, // 465 Room 465
+    {67734, 9, 24, 2534, 1736}, // 466 Room 466
+    {67759, 9, 24, 2536, 1738}, // 467 Room 467
+    {67784, 9, 24, 2538, 1740}, // 468 Room 468
+    {67809, 9, 24, 2540, 1742}, // 469 Room 469
+    {67834, 8, 163, 2542, 1744}, // 470 Main Street
+    {67998, 12, 182, 2548, 1748}, // 471 Main Street Exit
+    {68181, 10, 162, 2554, 1753}, // 472 Douglas Avenue
+    {68344, 10, 148, 2562, 1757}, // 473 Douglas Avenue
+    {68493, 12, 183, 2568, 1761}, // 474 McLean Boulevard
+    {68677, 12, 152, 2576, 1766}, // 475 McLean Boulevard
+    {68830, 12, 170, 2582, 1770}, // 476 McLean Boulevard
+    {69001, 10, 164, 2586, 1774}, // 477 Central Avenue
+    {69166, 11, 176, 2592, 1778}, // 478 Highway 235
+    {69343, 11, 166, 2600, 1782}, // 479 Highway 235
+    {69510, 11, 168, 2606, 1786}, // 480 Highway 235
+    {69679, 7, 171, 2612, 1790}, // 481 Departures
+    {69851, 6, 189, 2618, 1795}, // 482 Arrivals
+    {70041, 14, 160, 2628, 1800}, // 483 Information Services
+    {70202, 10, 179, 2634, 1804}, // 484 Luggage Claim
+    {70382, 13, 215, 2640, 1809}, // 485 Security Checkpoint
+    {70662, 8, 183, 2646, 1814}, // 486 Food Court
+    {70909, 7, 162, 2654, 1819}, // 487 Terminal C
+    {71072, 8, 169, 2662, 1823}, // 488 Terminal D
+    {71272, 8, 149, 2669, 1827}, // 489 Terminal E
+    {71422, 8, 148, 2675, 1831}, // 490 Terminal F
+    {71571, 12, 179, 2681, 1835}, // 491 Janitor's Closet
+    {71819, 8, 142, 2687, 1839}, // 492 Terminal B
+    {71997, 7, 145, 2694, 1843}, // 493 Terminal A
+    {72143, 11, 155, 2700, 1847}, // 494 Tarmac Services
+    {72327, 10, 162, 2707, 1851}, // 495 Network Closet
+    {72543, 8, 152, 2712, 1855}, // 496 Gas Station
+    {72741, 7, 122, 2718, 1859}, // 497 The Arcade
+    {72864, 13, 173, 2722, 1863}, // 498 River Town Brewery
+    {73038, 10, 165, 2726, 1867}, // 499 Farmers Market
+    {73236, 4, 181, 2735, 1871}, // 500 Hotel
+    {73461, 13, 162, 2741, 1876}, // 501 Water Co. Reception
+    {73649, 6, 154, 2748, 1880}, // 502 Hallway
+    {73804, 8, 165, 2758, 1884}, // 503 IT Office
+    {73996, 13, 140, 2763, 1888}, // 504 Water Co. Breakroom
+    {74159, 8, 162, 2770, 1892}, // 505 Data Center
+    {74350, 9, 144, 2775, 1896}, // 506 Bank Lobby
+    {74495, 13, 151, 2785, 1900}, // 507 Safe Deposit Boxes
+    {74669, 8, 128, 2790, 1904}, // 508 Teller Line
+    {74816, 9, 140, 2795, 1908}, // 509 Loan Office
+    {75001, 9, 24, 2800, 1912}, // 510 Room 510
+    {75026, 8, 23, 2802, 1914}, // 511 Room 511
+    {75050, 9, 24, 2804, 1916}, // 512 Room 512
+    {75075, 8, 23, 2806, 1918}, // 513 Room 513
+    {75099, 8, 23, 2808, 1920}, // 514 Room 514
+    {75123, 9, 24, 2810, 1922}, // 515 Room 515
+    {75148, 9, 24, 2812, 1924}, // 516 Room 516
+    {75173, 9, 24, 2814, 1926}, // 517 Room 517
+    {75198, 9, 24, 2816, 1928}, // 518 Room 518
+    {75223, 9, 24, 2818, 1930}, // 519 Room 519
+    {75248, 9, 24, 2820, 1932}, // 520 Room 520
+};
+
+// Number of Huffman codes of each length in bits
+constexpr uint16_t roomCodeCounts[ROOM_CODE_BITS + 1] = {
+    0, 0, 0, 2, 7, 3, 8, 7, 1, 6, 15, 12, 9, 3, 5, 0,
+    4,
+};
+
+// Byte of each Huffman code, in code order
+constexpr uint8_t roomCodeSymbols[] = {
+    32, 101, 97, 105, 110, 111, 114, 115, 116, 100, 104, 108, 99, 102, 103, 109,
+    112, 117, 119, 121, 0, 44, 46, 84, 98, 107, 118, 65, 39, 67, 72, 82,
+    83, 120, 10, 13, 49, 51, 52, 66, 68, 69, 77, 80, 87, 91, 93, 113,
+    122, 35, 45, 48, 50, 53, 55, 70, 73, 76, 79, 89, 106, 54, 56, 57,
+    71, 75, 78, 128, 148, 226, 74, 85, 195, 58, 63, 86, 90, 169, 33, 36,
+    81, 167,
+};
+
+constexpr uint8_t roomText[] = {
+    239, 114, 63, 252, 77, 241, 93, 0, 246, 26, 97, 106, 140, 43, 104, 52, 124, 88, 176, 244, 155, 226, 134, 123,
+    227, 1, 243, 31, 228, 240, 113, 33, 26, 195, 71, 197, 191, 255, 62, 143, 163, 189, 204, 16, 178, 37, 245, 35,
+    202, 181, 131, 230, 54, 44, 200, 212, 46, 96, 135, 97, 87, 35, 72, 125, 218, 221, 187, 118, 232, 252, 243, 194,
+    105, 250, 15, 234, 211, 177, 202, 133, 92, 141, 139, 50, 53, 118, 250, 58, 0, 239, 114, 63, 222, 17, 172, 63,
+    179, 248, 241, 207, 64, 239, 117, 144, 178, 16, 97, 35, 66, 33, 247, 107, 12, 63, 143, 28, 245, 28, 45, 92,
+    32, 159, 60, 225, 116, 189, 5, 97, 87, 35, 34, 212, 99, 176, 246, 16, 114, 59, 82, 187, 44, 208, 195, 191,
+    153, 30, 140, 114, 55, 101, 106, 48, 102, 141, 130, 53, 134, 79, 174, 216, 52, 113, 200, 93, 25, 224, 200, 229,
+    247, 237, 244, 125, 29, 238, 96, 251, 164, 32, 194, 70, 132, 100, 177, 150, 248, 72, 26, 154, 76, 15, 73, 190,
+    40, 89, 222, 5, 56, 171, 145, 193, 154, 234, 17, 172, 42, 228, 89, 222, 56, 78, 69, 56, 171, 145, 47, 189,
+    92, 96, 165, 164, 83, 132, 30, 33, 116, 189, 7, 222, 172, 239, 1, 32, 167, 110, 128, 252, 247, 108, 62, 94,
+    127, 65, 237, 84, 117, 218, 133, 56, 221, 176, 249, 121, 21, 114, 61, 38, 248, 161, 103, 120, 237, 244, 116, 239,
+    114, 63, 222, 10, 80, 254, 251, 213, 157, 226, 122, 0, 255, 15, 184, 45, 70, 2, 15, 5, 55, 165, 207, 124,
+    12, 176, 82, 21, 180, 234, 56, 90, 184, 171, 145, 59, 176, 155, 171, 43, 104, 44, 252, 48, 86, 16, 156, 200,
+    118, 21, 114, 50, 76, 106, 17, 172, 54, 41, 145, 207, 124, 13, 33, 38, 76, 246, 250, 63, 195, 238, 18, 8,
+    157, 226, 31, 118, 177, 176, 241, 200, 213, 27, 145, 80, 76, 245, 8, 214, 8, 44, 239, 28, 39, 33, 100, 83,
+    138, 185, 12, 241, 87, 10, 194, 174, 68, 173, 136, 124, 194, 13, 95, 118, 164, 86, 237, 244, 125, 29, 238, 96,
+    251, 164, 32, 241, 141, 200, 241, 189, 83, 176, 58, 248, 54, 177, 176, 86, 8, 24, 164, 120, 228, 84, 19, 219,
+    232, 250, 59, 220, 193, 247, 72, 76, 75, 132, 26, 163, 9, 164, 107, 43, 104, 46, 96, 245, 23, 34, 233, 33,
+    3, 38, 164, 82, 104, 42, 233, 66, 83, 153, 30, 239, 130, 245, 26, 242, 25, 53, 33, 100, 125, 175, 227, 183,
+    187, 160, 252, 252, 158, 127, 65, 222, 230, 15, 186, 66, 15, 9, 84, 96, 216, 65, 176, 242, 121, 201, 34, 193,
+    216, 85, 200, 210, 31, 118, 183, 111, 163, 243, 241, 189, 83, 183, 232, 63, 24, 51, 34, 174, 71, 140, 110, 71,
+    141, 234, 157, 187, 125, 31, 157, 38, 60, 254, 131, 186, 99, 200, 167, 31, 107, 248, 250, 58, 0, 239, 114, 59,
+    194, 43, 43, 104, 59, 150, 174, 128, 252, 142, 50, 125, 72, 167, 21, 114, 52, 77, 79, 255, 231, 209, 244, 119,
+    186, 200, 89, 21, 114, 43, 122, 120, 84, 192, 205, 224, 85, 200, 163, 243, 161, 225, 36, 216, 37, 189, 22, 173,
+    224, 141, 19, 83, 216, 127, 92, 199, 47, 184, 72, 35, 52, 213, 112, 169, 3, 133, 171, 138, 63, 58, 30, 18,
+    77, 134, 137, 169, 158, 161, 224, 112, 141, 66, 156, 102, 186, 111, 4, 45, 7, 222, 131, 176, 229, 247, 128, 252,
+    55, 81, 254, 119, 154, 20, 152, 242, 41, 197, 92, 143, 242, 140, 180, 240, 17, 172, 48, 104, 93, 117, 30, 89,
+    248, 28, 190, 254, 232, 34, 10, 91, 145, 78, 48, 83, 209, 237, 244, 125, 31, 215, 49, 203, 238, 56, 70, 161,
+    78, 52, 52, 16, 120, 133, 57, 138, 222, 158, 21, 49, 212, 35, 88, 104, 104, 102, 154, 174, 21, 32, 112, 181,
+    113, 47, 169, 15, 152, 171, 145, 147, 235, 170, 53, 164, 39, 164, 92, 39, 140, 30, 162, 147, 201, 8, 48, 239,
+    228, 37, 10, 185, 27, 41, 200, 135, 204, 108, 155, 24, 14, 194, 174, 69, 140, 249, 30, 57, 21, 206, 202, 218,
+    15, 118, 201, 177, 143, 119, 110, 128, 252, 246, 77, 140, 126, 131, 226, 82, 194, 174, 70, 201, 177, 129, 43, 84,
+    173, 160, 118, 21, 114, 44, 103, 207, 111, 163, 243, 164, 199, 159, 208, 119, 76, 121, 20, 226, 174, 71, 249, 70,
+    90, 120, 21, 116, 160, 178, 39, 15, 198, 57, 19, 193, 59, 43, 104, 37, 245, 34, 219, 205, 7, 222, 131, 230,
+    42, 228, 81, 106, 237, 244, 116, 251, 83, 47, 33, 243, 31, 110, 242, 63, 143, 240, 251, 63, 215, 160, 255, 15,
+    184, 225, 60, 145, 190, 193, 88, 85, 200, 240, 153, 121, 15, 152, 251, 119, 145, 252, 127, 135, 217, 254, 189, 135,
+    123, 145, 133, 210, 245, 33, 32, 139, 46, 186, 155, 117, 25, 36, 210, 182, 131, 14, 218, 9, 186, 89, 248, 144,
+    254, 140, 10, 185, 28, 60, 48, 205, 60, 66, 228, 31, 49, 87, 34, 74, 84, 246, 29, 238, 69, 247, 212, 62,
+    98, 174, 65, 109, 21, 136, 89, 9, 226, 75, 87, 81, 130, 158, 149, 180, 8, 192, 152, 82, 37, 112, 91, 35,
+    216, 119, 185, 8, 176, 22, 69, 43, 104, 108, 56, 90, 184, 171, 145, 154, 43, 80, 156, 139, 80, 124, 198, 137,
+    47, 133, 98, 17, 172, 31, 22, 27, 237, 119, 196, 209, 142, 123, 15, 196, 152, 86, 208, 62, 244, 42, 228, 112,
+    173, 103, 227, 168, 229, 247, 12, 244, 185, 17, 87, 35, 198, 242, 22, 70, 201, 30, 77, 130, 176, 65, 101, 215,
+    28, 140, 45, 13, 218, 198, 52, 135, 221, 172, 52, 72, 77, 15, 97, 239, 118, 202, 13, 17, 178, 227, 9, 18,
+    38, 145, 172, 48, 190, 72, 149, 193, 106, 26, 110, 145, 101, 70, 144, 172, 42, 228, 77, 210, 207, 196, 246, 31,
+    251, 216, 103, 14, 213, 212, 85, 200, 241, 188, 139, 66, 250, 48, 22, 70, 137, 87, 48, 173, 160, 186, 200, 240,
+    112, 237, 162, 182, 147, 212, 73, 58, 171, 105, 142, 70, 236, 156, 36, 16, 249, 142, 95, 120, 27, 65, 146, 217,
+    30, 221, 0, 232, 251, 119, 145, 252, 127, 135, 217, 254, 189, 0, 255, 15, 184, 213, 60, 145, 203, 239, 3, 132,
+    228, 83, 240, 145, 97, 87, 35, 56, 118, 160, 249, 138, 185, 30, 55, 158, 195, 189, 200, 180, 47, 163, 29, 66,
+    13, 86, 214, 193, 253, 233, 161, 176, 213, 24, 112, 181, 112, 131, 130, 145, 200, 63, 61, 160, 204, 171, 183, 81,
+    135, 127, 50, 55, 219, 168, 154, 72, 172, 27, 10, 113, 36, 142, 95, 126, 195, 221, 247, 45, 155, 221, 66, 10,
+    97, 127, 98, 17, 185, 118, 35, 132, 145, 52, 184, 192, 118, 30, 29, 34, 221, 125, 194, 228, 74, 115, 35, 133,
+    171, 132, 23, 86, 160, 249, 137, 222, 54, 133, 147, 216, 119, 188, 62, 250, 92, 85, 200, 194, 70, 132, 112, 173,
+    105, 186, 156, 91, 168, 229, 247, 18, 72, 171, 145, 233, 38, 134, 168, 173, 69, 145, 178, 35, 68, 132, 208, 137,
+    168, 53, 149, 213, 180, 15, 189, 117, 25, 174, 48, 108, 56, 90, 184, 171, 145, 43, 139, 190, 230, 168, 200, 124,
+    195, 213, 204, 15, 27, 201, 158, 195, 189, 200, 207, 11, 151, 147, 10, 218, 12, 241, 187, 193, 156, 139, 80, 194,
+    233, 122, 145, 162, 250, 34, 174, 68, 236, 153, 16, 140, 30, 174, 99, 135, 140, 91, 28, 141, 48, 252, 118, 232,
+    252, 233, 49, 231, 244, 29, 211, 30, 69, 56, 171, 145, 104, 95, 70, 59, 125, 63, 71, 231, 135, 75, 126, 131,
+    251, 58, 88, 32, 99, 192, 164, 216, 133, 106, 113, 87, 33, 27, 37, 45, 67, 255, 207, 127, 196, 78, 241, 232,
+    174, 48, 141, 145, 19, 204, 209, 215, 183, 211, 244, 116, 254, 201, 26, 17, 254, 233, 9, 161, 232, 249, 81, 219,
+    101, 109, 3, 231, 152, 171, 145, 227, 121, 234, 57, 125, 253, 208, 70, 144, 77, 27, 15, 28, 138, 185, 18, 186,
+    94, 164, 35, 88, 75, 238, 214, 144, 249, 132, 30, 55, 154, 194, 182, 131, 84, 86, 162, 200, 217, 17, 162, 66,
+    104, 123, 14, 247, 35, 36, 244, 97, 159, 121, 19, 178, 100, 65, 202, 238, 100, 112, 181, 113, 87, 35, 44, 35,
+    104, 31, 49, 169, 164, 192, 70, 176, 171, 145, 117, 153, 15, 152, 217, 142, 250, 165, 46, 66, 157, 241, 61, 135,
+    219, 188, 153, 10, 195, 210, 66, 190, 242, 38, 146, 140, 135, 204, 65, 217, 22, 6, 21, 136, 171, 145, 225, 57,
+    159, 252, 255, 175, 251, 151, 212, 136, 57, 21, 244, 173, 160, 117, 192, 202, 232, 218, 25, 234, 30, 174, 98, 68,
+    212, 46, 219, 27, 11, 63, 12, 41, 197, 92, 172, 12, 225, 53, 51, 216, 126, 7, 43, 163, 46, 82, 21, 134,
+    144, 82, 79, 239, 154, 69, 99, 96, 254, 140, 38, 49, 35, 87, 244, 71, 11, 87, 27, 111, 27, 60, 158, 163,
+    36, 164, 195, 232, 173, 160, 217, 34, 164, 35, 88, 100, 237, 59, 226, 149, 180, 25, 92, 229, 231, 11, 53, 61,
+    135, 123, 144, 139, 1, 100, 85, 215, 47, 35, 133, 171, 138, 185, 19, 169, 198, 3, 230, 44, 166, 78, 2, 53,
+    134, 175, 79, 1, 215, 29, 186, 0, 232, 255, 116, 132, 208, 244, 255, 15, 184, 100, 244, 186, 37, 17, 98, 118,
+    48, 21, 169, 197, 92, 141, 218, 198, 52, 135, 221, 172, 52, 72, 77, 15, 81, 197, 204, 17, 87, 32, 183, 165,
+    135, 109, 75, 80, 240, 114, 125, 76, 132, 26, 167, 236, 67, 230, 41, 223, 3, 193, 108, 174, 100, 35, 88, 78,
+    201, 4, 108, 145, 83, 216, 127, 127, 70, 46, 82, 221, 70, 87, 69, 105, 8, 214, 27, 111, 140, 30, 100, 93,
+    27, 65, 156, 62, 162, 104, 156, 15, 5, 53, 158, 162, 10, 91, 145, 78, 46, 235, 52, 46, 83, 215, 35, 39,
+    215, 103, 98, 213, 61, 135, 176, 98, 145, 227, 145, 9, 101, 113, 182, 19, 153, 18, 249, 208, 135, 203, 200, 173,
+    216, 207, 81, 225, 32, 227, 144, 155, 217, 124, 96, 135, 244, 96, 85, 200, 77, 124, 41, 106, 12, 235, 39, 176,
+    239, 114, 51, 195, 188, 5, 145, 170, 71, 147, 97, 194, 213, 198, 200, 173, 70, 195, 10, 198, 70, 155, 173, 149,
+    180, 21, 114, 51, 195, 240, 31, 49, 225, 234, 227, 99, 18, 236, 199, 1, 26, 195, 84, 202, 234, 198, 57, 237,
+    208, 232, 251, 119, 145, 245, 125, 95, 95, 250, 244, 251, 119, 145, 245, 125, 95, 95, 250, 137, 90, 144, 182, 193,
+    10, 193, 106, 69, 140, 174, 140, 148, 108, 39, 103, 174, 163, 14, 254, 85, 180, 18, 250, 158, 46, 148, 51, 120,
+    195, 195, 4, 213, 109, 52, 42, 228, 38, 84, 190, 150, 185, 9, 15, 187, 88, 45, 118, 29, 238, 69, 157, 226,
+    66, 65, 15, 177, 110, 161, 26, 193, 6, 168, 173, 69, 145, 178, 35, 11, 165, 232, 105, 135, 226, 68, 190, 117,
+    142, 66, 180, 173, 143, 97, 222, 228, 43, 81, 133, 120, 11, 34, 150, 220, 143, 27, 208, 155, 191, 18, 37, 116,
+    105, 15, 152, 224, 164, 127, 231, 253, 127, 218, 12, 207, 2, 114, 223, 60, 198, 169, 30, 100, 92, 193, 8, 214,
+    21, 115, 7, 168, 70, 176, 65, 154, 43, 80, 194, 114, 96, 62, 98, 219, 205, 7, 97, 87, 34, 201, 55, 240,
+    233, 22, 236, 61, 152, 62, 44, 17, 96, 102, 184, 163, 3, 10, 100, 59, 7, 98, 31, 49, 87, 34, 74, 84,
+    245, 16, 82, 220, 138, 113, 224, 136, 59, 97, 50, 54, 236, 59, 220, 143, 215, 117, 52, 198, 100, 62, 98, 174,
+    71, 141, 228, 62, 121, 152, 144, 130, 105, 35, 200, 201, 218, 161, 38, 133, 56, 171, 144, 206, 179, 200, 209, 33,
+    52, 61, 186, 0, 252, 243, 92, 81, 143, 208, 124, 78, 216, 76, 136, 171, 145, 146, 120, 86, 8, 176, 51, 92,
+    81, 142, 223, 79, 209, 208, 255, 116, 132, 208, 244, 239, 117, 145, 39, 42, 87, 96, 249, 138, 185, 26, 36, 38,
+    132, 44, 143, 16, 186, 94, 177, 200, 194, 215, 81, 194, 213, 197, 215, 75, 140, 138, 225, 91, 73, 8, 214, 24,
+    72, 208, 140, 209, 164, 100, 177, 150, 248, 74, 86, 208, 85, 200, 69, 142, 195, 242, 120, 243, 52, 148, 174, 210,
+    18, 8, 98, 149, 142, 66, 68, 35, 104, 108, 56, 90, 184, 167, 124, 72, 212, 210, 229, 190, 31, 121, 199, 33,
+    227, 68, 101, 253, 141, 187, 15, 97, 101, 209, 105, 48, 44, 179, 182, 19, 144, 236, 42, 228, 112, 152, 192, 168,
+    76, 188, 200, 118, 209, 213, 180, 26, 162, 181, 22, 70, 200, 138, 73, 243, 61, 135, 123, 145, 57, 22, 160, 249,
+    140, 224, 205, 198, 79, 158, 100, 142, 19, 58, 145, 156, 62, 161, 6, 79, 12, 96, 113, 115, 4, 32, 213, 60,
+    153, 186, 231, 67, 196, 20, 242, 18, 10, 5, 145, 38, 134, 251, 118, 29, 206, 87, 101, 201, 81, 164, 31, 158,
+    87, 70, 208, 143, 16, 167, 49, 164, 19, 74, 218, 72, 73, 21, 115, 200, 213, 253, 17, 224, 215, 4, 176, 73,
+    149, 209, 181, 45, 83, 219, 160, 232, 251, 119, 145, 252, 127, 135, 213, 254, 189, 0, 251, 119, 145, 252, 127, 135,
+    213, 254, 163, 76, 20, 214, 70, 237, 99, 2, 174, 67, 250, 49, 114, 150, 24, 93, 47, 83, 212, 45, 72, 63,
+    58, 48, 175, 3, 56, 51, 124, 114, 56, 73, 185, 183, 97, 222, 228, 120, 222, 66, 200, 221, 159, 44, 183, 217,
+    77, 186, 138, 185, 22, 133, 244, 99, 221, 34, 74, 80, 244, 153, 35, 87, 97, 236, 50, 185, 203, 206, 22, 104,
+    44, 141, 83, 70, 52, 185, 38, 49, 200, 74, 164, 202, 230, 194, 156, 85, 200, 179, 188, 117, 12, 244, 173, 160,
+    171, 165, 10, 185, 19, 178, 65, 20, 176, 70, 208, 102, 119, 130, 24, 155, 72, 244, 97, 115, 92, 146, 149, 219,
+    176, 239, 114, 38, 158, 19, 66, 50, 125, 118, 72, 173, 75, 80, 89, 27, 182, 31, 47, 38, 221, 68, 31, 69,
+    48, 173, 160, 64, 197, 43, 28, 137, 167, 131, 97, 59, 36, 17, 75, 4, 35, 88, 29, 76, 104, 91, 46, 65,
+    253, 119, 93, 181, 45, 93, 135, 223, 232, 199, 53, 117, 109, 2, 109, 177, 72, 144, 172, 30, 44, 99, 168, 148,
+    244, 70, 111, 2, 174, 69, 36, 249, 9, 66, 232, 214, 237, 208, 252, 233, 96, 254, 131, 223, 115, 151, 145, 87,
+    34, 118, 72, 34, 150, 8, 69, 129, 180, 25, 157, 224, 132, 107, 13, 83, 201, 19, 188, 16, 181, 238, 145, 190,
+    194, 156, 78, 199, 46, 223, 79, 209, 208, 255, 116, 132, 208, 143, 138, 107, 183, 64, 239, 114, 52, 72, 77, 8,
+    207, 14, 240, 21, 178, 194, 177, 145, 161, 106, 199, 35, 125, 184, 72, 176, 185, 131, 212, 96, 165, 149, 180, 20,
+    252, 36, 88, 85, 200, 213, 21, 131, 231, 154, 228, 103, 176, 249, 38, 102, 185, 18, 186, 52, 136, 58, 171, 88,
+    29, 118, 195, 242, 76, 138, 113, 194, 86, 87, 21, 114, 176, 38, 142, 193, 26, 195, 130, 144, 54, 135, 163, 149,
+    47, 162, 52, 41, 29, 135, 123, 145, 147, 182, 80, 104, 142, 19, 24, 144, 144, 66, 89, 225, 141, 135, 11, 87,
+    26, 189, 47, 164, 165, 118, 76, 13, 158, 104, 196, 132, 107, 6, 122, 92, 140, 132, 240, 251, 208, 223, 108, 159,
+    85, 109, 5, 66, 43, 43, 104, 36, 204, 171, 180, 246, 29, 238, 69, 150, 105, 26, 132, 190, 237, 96, 249, 136,
+    86, 209, 91, 65, 181, 221, 140, 132, 107, 13, 119, 207, 60, 27, 12, 157, 189, 24, 148, 165, 118, 144, 173, 101,
+    201, 40, 200, 229, 247, 247, 65, 12, 82, 21, 180, 21, 114, 18, 218, 171, 44, 212, 37, 47, 162, 18, 10, 79,
+    110, 128, 232, 251, 119, 145, 248, 34, 181, 22, 70, 200, 143, 183, 117, 197, 149, 180, 232, 255, 15, 184, 45, 70,
+    5, 92, 143, 27, 200, 213, 21, 168, 178, 54, 68, 120, 221, 113, 101, 109, 58, 132, 25, 67, 204, 195, 165, 164,
+    120, 53, 193, 44, 42, 228, 104, 144, 154, 16, 141, 97, 87, 33, 45, 170, 178, 205, 66, 82, 250, 33, 243, 205,
+    114, 51, 216, 119, 185, 9, 5, 2, 200, 76, 47, 162, 56, 90, 184, 76, 169, 125, 45, 115, 216, 123, 240, 99,
+    204, 137, 190, 249, 231, 130, 54, 77, 140, 112, 241, 231, 168, 70, 176, 157, 246, 49, 233, 101, 226, 69, 150, 114,
+    222, 100, 78, 87, 54, 223, 6, 123, 15, 236, 145, 161, 28, 43, 89, 248, 145, 131, 65, 88, 50, 86, 240, 152,
+    24, 93, 47, 93, 66, 13, 176, 82, 81, 168, 101, 116, 109, 8, 206, 31, 81, 87, 33, 34, 151, 53, 201, 83,
+    3, 11, 165, 233, 91, 65, 224, 225, 248, 236, 63, 23, 170, 54, 27, 97, 26, 164, 37, 172, 16, 83, 239, 149,
+    195, 230, 52, 130, 88, 199, 34, 156, 85, 200, 122, 185, 142, 22, 72, 86, 182, 243, 80, 169, 128, 91, 210, 195,
+    182, 165, 171, 183, 64, 232, 252, 17, 90, 139, 35, 100, 71, 224, 140, 154, 24, 247, 72, 254, 249, 230, 185, 30,
+    128, 239, 114, 53, 69, 106, 44, 141, 145, 26, 163, 38, 134, 61, 210, 31, 60, 215, 34, 22, 70, 175, 99, 52,
+    60, 111, 65, 226, 198, 49, 207, 97, 239, 49, 75, 154, 228, 148, 100, 35, 88, 100, 250, 234, 90, 201, 74, 237,
+    34, 232, 218, 7, 97, 87, 35, 132, 198, 39, 168, 155, 191, 25, 36, 171, 104, 57, 41, 18, 31, 49, 99, 101,
+    201, 40, 216, 73, 143, 75, 145, 236, 59, 220, 141, 81, 147, 67, 29, 66, 9, 186, 70, 223, 188, 242, 108, 56,
+    125, 81, 135, 11, 87, 8, 25, 255, 123, 59, 73, 105, 34, 199, 82, 140, 241, 212, 74, 212, 143, 6, 234, 214,
+    8, 44, 103, 200, 217, 112, 108, 56, 90, 184, 179, 229, 190, 165, 170, 66, 53, 134, 168, 173, 69, 145, 178, 35,
+    15, 164, 246, 31, 43, 145, 135, 127, 50, 55, 216, 103, 15, 168, 185, 129, 147, 235, 182, 244, 96, 36, 142, 95,
+    112, 90, 140, 118, 30, 239, 240, 103, 255, 177, 247, 56, 229, 247, 12, 77, 132, 190, 166, 174, 173, 167, 255, 126,
+    225, 55, 33, 39, 204, 140, 183, 138, 199, 61, 69, 93, 247, 210, 225, 158, 134, 237, 229, 90, 216, 231, 183, 64,
+    252, 233, 49, 231, 244, 29, 211, 30, 69, 56, 171, 145, 170, 43, 81, 100, 108, 136, 213, 25, 52, 49, 219, 233,
+    250, 58, 0, 251, 119, 145, 253, 246, 48, 148, 174, 211, 208, 239, 114, 60, 111, 33, 246, 48, 148, 174, 210, 33,
+    223, 80, 178, 16, 93, 125, 16, 249, 140, 62, 139, 52, 185, 38, 6, 216, 70, 101, 109, 59, 15, 236, 145, 161,
+    19, 148, 18, 210, 44, 179, 182, 19, 145, 5, 49, 251, 233, 117, 35, 15, 146, 82, 187, 72, 124, 199, 141, 228,
+    200, 171, 195, 239, 165, 223, 122, 21, 114, 50, 90, 231, 176, 251, 150, 118, 74, 202, 230, 36, 100, 239, 22, 86,
+    74, 34, 31, 122, 50, 17, 172, 32, 206, 206, 214, 20, 226, 208, 190, 140, 79, 184, 100, 250, 235, 187, 46, 73,
+    74, 237, 35, 210, 160, 185, 75, 73, 169, 236, 63, 4, 218, 66, 53, 134, 87, 72, 169, 25, 63, 163, 2, 174,
+    71, 9, 140, 79, 80, 141, 96, 131, 139, 173, 31, 14, 145, 97, 133, 154, 145, 180, 43, 194, 215, 34, 146, 124,
+    207, 97, 237, 170, 218, 104, 85, 200, 120, 209, 25, 127, 99, 97, 149, 209, 231, 168, 151, 212, 187, 17, 116, 145,
+    131, 157, 4, 19, 133, 200, 135, 204, 101, 114, 100, 135, 97, 87, 35, 34, 213, 9, 129, 73, 227, 7, 168, 217,
+    230, 87, 198, 57, 25, 188, 104, 245, 69, 133, 183, 133, 109, 2, 15, 215, 117, 203, 200, 150, 76, 188, 246, 232,
+    252, 242, 185, 50, 127, 65, 222, 230, 15, 186, 66, 9, 194, 228, 67, 230, 50, 185, 50, 67, 176, 171, 145, 73,
+    227, 7, 183, 211, 244, 116, 251, 119, 145, 220, 198, 170, 201, 129, 247, 252, 214, 186, 0, 255, 15, 184, 205, 90,
+    195, 151, 222, 36, 227, 48, 148, 42, 228, 120, 222, 69, 24, 213, 89, 48, 15, 205, 107, 168, 226, 230, 8, 147,
+    232, 194, 96, 120, 222, 76, 132, 130, 48, 172, 108, 55, 216, 35, 88, 65, 75, 114, 51, 120, 22, 59, 36, 86,
+    240, 123, 15, 197, 38, 75, 104, 98, 70, 171, 140, 4, 240, 251, 215, 81, 47, 169, 25, 92, 229, 229, 91, 65,
+    87, 43, 3, 107, 187, 25, 234, 30, 174, 98, 70, 87, 74, 165, 109, 7, 11, 87, 25, 62, 187, 35, 43, 180,
+    246, 29, 238, 71, 141, 228, 83, 142, 239, 177, 242, 130, 105, 26, 210, 31, 122, 234, 22, 164, 88, 205, 43, 37,
+    43, 176, 178, 206, 216, 78, 77, 134, 208, 250, 171, 22, 172, 114, 19, 195, 250, 34, 174, 71, 10, 214, 155, 169,
+    197, 187, 14, 247, 34, 208, 190, 140, 13, 140, 102, 241, 172, 140, 213, 147, 3, 43, 156, 188, 207, 80, 141, 97,
+    87, 32, 182, 138, 196, 29, 86, 164, 32, 195, 240, 35, 125, 124, 96, 245, 18, 186, 50, 97, 91, 64, 181, 34,
+    10, 89, 88, 204, 140, 222, 5, 92, 143, 242, 251, 195, 30, 123, 14, 247, 32, 250, 44, 173, 160, 159, 60, 141,
+    145, 90, 164, 85, 200, 157, 226, 31, 118, 178, 182, 146, 21, 133, 247, 50, 31, 48, 240, 141, 161, 8, 214, 27,
+    111, 27, 96, 246, 232, 252, 252, 111, 63, 160, 246, 30, 55, 144, 178, 56, 69, 165, 109, 6, 111, 3, 100, 153,
+    45, 161, 137, 23, 41, 101, 109, 5, 56, 238, 251, 31, 41, 219, 233, 250, 58, 0, 248, 46, 151, 225, 57, 31,
+    207, 248, 14, 239, 177, 242, 157, 0, 255, 15, 184, 72, 34, 161, 61, 28, 43, 104, 29, 135, 193, 116, 191, 9,
+    200, 254, 127, 195, 168, 226, 235, 149, 196, 212, 26, 202, 230, 65, 73, 161, 79, 194, 69, 135, 252, 35, 74, 72,
+    247, 173, 114, 17, 172, 56, 51, 66, 159, 132, 139, 15, 191, 24, 158, 30, 42, 253, 135, 123, 145, 221, 246, 62,
+    80, 79, 158, 112, 172, 68, 44, 153, 9, 114, 150, 234, 22, 164, 120, 221, 113, 101, 109, 36, 105, 130, 154, 171,
+    104, 55, 107, 24, 21, 114, 39, 118, 236, 59, 194, 103, 154, 228, 37, 116, 105, 10, 214, 92, 146, 136, 223, 108,
+    159, 85, 109, 1, 249, 173, 72, 167, 29, 223, 99, 229, 59, 15, 191, 7, 42, 135, 101, 200, 120, 92, 99, 195,
+    164, 90, 70, 120, 73, 184, 58, 152, 208, 182, 92, 132, 193, 138, 159, 254, 135, 187, 251, 62, 73, 129, 240, 121,
+    217, 105, 48, 62, 70, 61, 46, 70, 71, 220, 179, 27, 237, 70, 221, 135, 200, 159, 35, 219, 20, 97, 146, 151,
+    209, 31, 129, 178, 228, 152, 31, 209, 50, 92, 45, 41, 158, 222, 225, 247, 66, 250, 49, 33, 33, 247, 107, 14,
+    95, 113, 36, 234, 55, 98, 147, 207, 81, 47, 169, 20, 152, 242, 173, 160, 222, 52, 45, 88, 228, 59, 10, 185,
+    88, 27, 93, 216, 207, 110, 128, 232, 248, 46, 151, 225, 57, 31, 207, 248, 116, 247, 187, 82, 182, 234, 218, 7,
+    97, 240, 93, 47, 194, 114, 63, 159, 240, 234, 42, 228, 84, 38, 121, 174, 67, 193, 201, 245, 50, 46, 83, 210,
+    152, 9, 35, 151, 220, 49, 72, 29, 223, 99, 229, 59, 15, 239, 232, 197, 202, 88, 74, 232, 210, 44, 179, 182,
+    19, 145, 194, 67, 43, 105, 33, 60, 62, 244, 61, 221, 206, 87, 101, 201, 48, 62, 229, 207, 53, 203, 124, 82,
+    153, 9, 67, 222, 181, 200, 248, 60, 236, 180, 152, 237, 238, 30, 194, 75, 73, 15, 152, 162, 210, 174, 195, 53,
+    198, 36, 85, 200, 69, 142, 195, 222, 145, 33, 32, 140, 174, 141, 162, 182, 131, 8, 198, 70, 112, 127, 93, 203,
+    86, 57, 234, 17, 172, 57, 125, 195, 61, 46, 68, 35, 5, 108, 160, 164, 155, 13, 160, 201, 108, 136, 124, 193,
+    212, 198, 133, 178, 228, 122, 55, 92, 176, 100, 92, 165, 149, 180, 10, 212, 226, 174, 70, 75, 92, 246, 232, 232,
+    248, 46, 151, 225, 57, 31, 207, 248, 116, 248, 46, 151, 225, 57, 31, 207, 248, 12, 157, 169, 91, 115, 61, 71,
+    11, 87, 7, 230, 181, 34, 156, 119, 125, 143, 148, 31, 231, 121, 160, 151, 41, 110, 195, 189, 200, 201, 107, 159,
+    116, 137, 92, 93, 247, 53, 68, 120, 57, 62, 166, 70, 88, 41, 6, 58, 143, 27, 208, 151, 212, 213, 213, 180,
+    25, 147, 137, 15, 158, 125, 135, 179, 4, 215, 198, 248, 70, 200, 137, 216, 155, 72, 241, 200, 225, 106, 225, 106,
+    68, 172, 22, 30, 48, 144, 173, 167, 81, 227, 122, 10, 211, 69, 44, 31, 49, 114, 150, 86, 208, 83, 240, 145,
+    97, 87, 34, 239, 59, 45, 38, 58, 133, 161, 73, 228, 200, 70, 7, 230, 180, 48, 82, 202, 218, 7, 222, 131,
+    230, 42, 228, 100, 181, 207, 97, 239, 118, 200, 195, 27, 12, 211, 35, 35, 98, 96, 62, 244, 51, 135, 212, 61,
+    92, 192, 244, 110, 185, 96, 207, 110, 128, 232, 248, 46, 151, 225, 57, 31, 207, 248, 116, 246, 96, 126, 107, 66,
+    230, 8, 193, 75, 72, 151, 222, 174, 41, 199, 228, 147, 127, 27, 195, 15, 111, 69, 183, 61, 135, 123, 144, 126,
+    107, 66, 87, 70, 25, 225, 114, 242, 98, 66, 181, 24, 213, 106, 139, 86, 57, 234, 54, 121, 149, 241, 142, 69,
+    183, 34, 156, 32, 213, 49, 158, 237, 149, 43, 183, 97, 222, 19, 60, 215, 32, 150, 244, 178, 240, 166, 70, 165,
+    169, 93, 135, 187, 224, 243, 178, 210, 96, 124, 140, 122, 92, 140, 143, 126, 241, 5, 171, 28, 143, 253, 178, 122,
+    69, 194, 120, 193, 237, 238, 31, 225, 247, 18, 72, 65, 115, 133, 201, 246, 163, 2, 239, 232, 194, 182, 129, 138,
+    64, 171, 145, 146, 215, 35, 34, 212, 99, 168, 90, 145, 6, 195, 40, 121, 145, 60, 235, 225, 240, 61, 44, 175,
+    140, 16, 154, 34, 180, 208, 171, 145, 62, 121, 237, 208, 232, 252, 146, 111, 227, 120, 97, 237, 232, 182, 231, 160,
+    255, 15, 184, 72, 33, 216, 126, 73, 55, 241, 188, 48, 246, 244, 91, 115, 216, 119, 113, 87, 35, 131, 53, 212,
+    85, 200, 194, 70, 132, 77, 70, 249, 86, 240, 67, 230, 42, 228, 93, 231, 101, 164, 192, 195, 190, 179, 212, 120,
+    222, 134, 237, 188, 238, 152, 199, 61, 69, 92, 141, 146, 60, 171, 104, 48, 244, 22, 67, 20, 140, 114, 14, 187,
+    87, 61, 135, 176, 204, 240, 54, 47, 182, 8, 154, 70, 176, 125, 234, 86, 196, 85, 200, 45, 80, 141, 145, 234,
+    19, 109, 138, 66, 182, 131, 39, 108, 247, 147, 96, 240, 51, 141, 230, 161, 40, 219, 176, 239, 114, 46, 243, 178,
+    210, 99, 221, 32, 224, 229, 80, 236, 185, 9, 93, 24, 65, 75, 72, 247, 123, 240, 242, 108, 51, 120, 31, 126,
+    166, 52, 45, 151, 35, 240, 69, 106, 44, 141, 145, 237, 238, 232, 232, 252, 146, 111, 227, 120, 97, 237, 232, 182,
+    231, 160, 247, 187, 82, 182, 234, 218, 4, 195, 182, 131, 242, 73, 191, 141, 225, 135, 183, 162, 219, 158, 163, 151,
+    220, 51, 210, 228, 70, 103, 131, 3, 36, 137, 14, 194, 174, 68, 58, 91, 176, 238, 226, 174, 67, 60, 85, 250,
+    138, 185, 23, 121, 217, 105, 49, 238, 145, 43, 98, 11, 84, 35, 100, 66, 200, 201, 226, 206, 198, 193, 243, 204,
+    112, 181, 113, 146, 111, 74, 236, 41, 54, 61, 135, 226, 108, 102, 161, 81, 164, 89, 103, 45, 230, 69, 92, 137,
+    222, 214, 44, 38, 251, 213, 159, 134, 234, 39, 99, 150, 248, 74, 86, 208, 39, 135, 222, 134, 207, 50, 190, 48,
+    70, 73, 188, 153, 236, 59, 220, 132, 173, 94, 118, 185, 130, 22, 67, 177, 15, 152, 221, 138, 73, 237, 208, 232,
+    252, 146, 111, 227, 120, 97, 237, 232, 182, 231, 160, 252, 146, 111, 227, 120, 97, 237, 232, 182, 228, 92, 193, 11,
+    35, 10, 198, 195, 133, 171, 137, 213, 49, 129, 227, 121, 86, 51, 38, 123, 15, 193, 27, 145, 101, 157, 176, 156,
+    137, 93, 26, 70, 23, 201, 30, 239, 122, 77, 199, 247, 108, 115, 238, 15, 3, 221, 242, 230, 104, 235, 35, 238,
+    126, 27, 175, 184, 93, 90, 149, 180, 9, 67, 196, 58, 88, 192, 163, 149, 217, 114, 76, 5, 153, 220, 200, 86,
+    21, 114, 18, 10, 118, 31, 137, 125, 176, 71, 235, 185, 220, 132, 160, 140, 61, 187, 254, 29, 67, 182, 57, 20,
+    227, 53, 107, 5, 160, 251, 208, 124, 196, 152, 244, 185, 30, 195, 222, 237, 232, 196, 165, 43, 180, 143, 27, 254,
+    223, 176, 79, 15, 189, 4, 25, 115, 224, 194, 85, 38, 94, 66, 103, 153, 202, 149, 180, 21, 114, 50, 90, 231,
+    183, 64, 232, 252, 146, 111, 227, 120, 97, 237, 232, 182, 231, 160, 239, 114, 19, 209, 109, 200, 201, 218, 149, 183,
+    51, 212, 35, 88, 83, 138, 185, 5, 38, 186, 142, 95, 113, 36, 138, 185, 31, 127, 163, 129, 255, 12, 167, 209,
+    192, 252, 55, 147, 190, 189, 135, 193, 248, 62, 140, 117, 11, 65, 54, 216, 164, 72, 203, 15, 38, 221, 71, 11,
+    87, 8, 25, 233, 114, 33, 216, 85, 200, 179, 188, 127, 244, 61, 221, 206, 187, 60, 36, 46, 57, 30, 252, 60,
+    155, 15, 187, 114, 41, 199, 115, 149, 217, 114, 76, 15, 185, 115, 205, 114, 223, 20, 166, 123, 123, 135, 176, 204,
+    240, 41, 247, 133, 154, 145, 52, 141, 96, 251, 212, 173, 143, 81, 135, 127, 42, 218, 11, 44, 166, 219, 58, 181,
+    27, 118, 29, 238, 68, 212, 19, 67, 50, 113, 35, 118, 222, 119, 76, 99, 145, 250, 238, 166, 187, 116, 232, 252,
+    146, 111, 227, 120, 97, 237, 232, 182, 231, 160, 239, 117, 145, 53, 6, 178, 184, 124, 199, 228, 147, 127, 27, 195,
+    15, 111, 69, 183, 33, 100, 126, 187, 169, 163, 29, 135, 202, 160, 154, 194, 233, 122, 145, 158, 23, 47, 38, 2,
+    196, 29, 55, 194, 70, 57, 234, 17, 172, 37, 245, 34, 161, 51, 205, 114, 18, 186, 50, 98, 66, 65, 25, 225,
+    38, 234, 218, 14, 78, 48, 252, 118, 30, 194, 203, 162, 210, 96, 120, 92, 99, 195, 164, 88, 89, 103, 108, 39,
+    50, 17, 129, 136, 120, 26, 153, 148, 208, 133, 105, 162, 150, 15, 152, 75, 122, 49, 75, 39, 82, 213, 61, 135,
+    196, 202, 216, 181, 72, 154, 70, 176, 118, 21, 114, 176, 54, 120, 202, 230, 122, 139, 44, 229, 188, 202, 182, 130,
+    174, 70, 236, 126, 123, 28, 168, 216, 89, 102, 55, 218, 149, 218, 66, 176, 171, 145, 146, 215, 61, 186, 0, 232,
+    248, 46, 151, 225, 57, 31, 103, 243, 254, 29, 0, 255, 15, 184, 130, 153, 92, 124, 23, 75, 240, 156, 143, 179,
+    249, 255, 14, 195, 189, 200, 41, 53, 225, 247, 107, 12, 35, 25, 9, 4, 101, 135, 147, 110, 163, 133, 171, 143,
+    9, 16, 166, 36, 35, 88, 74, 232, 210, 21, 172, 185, 37, 43, 104, 61, 223, 23, 75, 15, 126, 30, 77, 135,
+    221, 185, 20, 227, 250, 182, 75, 98, 213, 219, 220, 59, 184, 171, 145, 193, 154, 234, 42, 228, 93, 116, 191, 9,
+    200, 131, 170, 43, 72, 125, 139, 118, 30, 204, 15, 205, 104, 83, 138, 185, 12, 241, 87, 24, 41, 105, 30, 19,
+    47, 34, 156, 126, 73, 55, 241, 188, 48, 246, 244, 91, 115, 216, 125, 250, 152, 208, 182, 92, 143, 70, 235, 150,
+    12, 137, 216, 155, 13, 146, 107, 168, 149, 130, 210, 60, 97, 33, 91, 78, 221, 0, 232, 248, 46, 151, 225, 57,
+    31, 103, 243, 254, 29, 0, 254, 236, 62, 11, 165, 248, 78, 71, 217, 252, 255, 135, 81, 80, 153, 230, 185, 13,
+    95, 209, 145, 52, 82, 203, 142, 71, 6, 107, 132, 139, 118, 31, 223, 209, 139, 148, 176, 149, 209, 164, 103, 132,
+    155, 142, 18, 25, 91, 73, 255, 232, 123, 189, 235, 92, 240, 182, 35, 185, 202, 236, 185, 38, 7, 245, 153, 220,
+    207, 97, 247, 252, 246, 57, 80, 251, 142, 19, 153, 237, 238, 31, 116, 47, 163, 18, 36, 157, 66, 55, 205, 95,
+    121, 234, 17, 172, 37, 245, 35, 209, 186, 229, 131, 35, 109, 241, 128, 254, 140, 4, 145, 87, 43, 3, 253, 255,
+    31, 144, 158, 102, 142, 178, 53, 76, 103, 187, 101, 74, 237, 216, 119, 185, 16, 150, 87, 30, 33, 210, 217, 36,
+    212, 136, 59, 60, 80, 118, 8, 33, 26, 95, 94, 18, 8, 74, 164, 203, 200, 202, 23, 109, 176, 173, 160, 201,
+    107, 144, 173, 156, 36, 212, 111, 149, 111, 7, 183, 64, 232, 248, 46, 151, 225, 57, 31, 103, 243, 254, 29, 0,
+    248, 46, 151, 225, 57, 31, 103, 243, 254, 3, 39, 106, 86, 220, 207, 97, 221, 197, 92, 142, 12, 215, 80, 180,
+    48, 82, 210, 41, 248, 72, 176, 252, 151, 43, 173, 39, 97, 221, 197, 92, 137, 125, 234, 253, 66, 48, 63, 53,
+    161, 179, 171, 84, 138, 126, 18, 44, 61, 247, 70, 222, 143, 97, 222, 228, 93, 225, 127, 103, 97, 55, 126, 36,
+    85, 200, 157, 161, 56, 194, 182, 131, 8, 214, 156, 147, 99, 212, 120, 222, 129, 244, 88, 92, 193, 234, 37, 116,
+    105, 15, 152, 178, 204, 111, 181, 43, 176, 72, 32, 250, 91, 22, 174, 195, 237, 92, 99, 195, 164, 90, 66, 65,
+    30, 48, 141, 228, 60, 11, 44, 237, 132, 229, 91, 64, 98, 30, 6, 79, 99, 61, 186, 0, 232, 248, 46, 151,
+    225, 57, 31, 103, 243, 254, 29, 0, 239, 114, 46, 186, 95, 132, 228, 92, 193, 25, 147, 137, 11, 47, 132, 163,
+    110, 195, 250, 30, 6, 73, 18, 18, 8, 118, 21, 114, 33, 210, 221, 66, 53, 133, 93, 228, 138, 186, 80, 72,
+    34, 73, 212, 83, 143, 4, 43, 4, 23, 222, 35, 145, 78, 48, 83, 209, 21, 114, 18, 10, 118, 29, 238, 68,
+    249, 228, 120, 58, 43, 72, 167, 25, 97, 247, 176, 127, 70, 58, 141, 86, 33, 225, 91, 65, 87, 34, 139, 73,
+    26, 187, 219, 176, 249, 82, 82, 228, 21, 168, 196, 111, 181, 72, 229, 247, 129, 9, 101, 126, 163, 84, 242, 173,
+    160, 90, 22, 92, 243, 92, 183, 197, 10, 113, 161, 160, 199, 137, 27, 237, 100, 163, 61, 186, 0, 232, 248, 46,
+    151, 225, 57, 31, 103, 243, 254, 29, 0, 239, 115, 7, 221, 33, 24, 31, 154, 208, 185, 130, 48, 82, 202, 218,
+    10, 112, 131, 15, 146, 96, 101, 207, 131, 18, 114, 222, 22, 185, 25, 172, 107, 216, 123, 9, 93, 24, 65, 75,
+    72, 247, 123, 249, 240, 96, 125, 220, 178, 106, 185, 72, 254, 173, 151, 97, 255, 39, 231, 67, 239, 249, 173, 118,
+    247, 15, 247, 95, 69, 133, 92, 140, 150, 185, 225, 108, 66, 204, 238, 103, 168, 171, 145, 154, 198, 163, 85, 210,
+    244, 60, 16, 173, 233, 241, 232, 216, 43, 4, 181, 160, 204, 171, 104, 42, 228, 109, 15, 227, 7, 89, 236, 63,
+    195, 238, 25, 233, 114, 35, 87, 130, 61, 27, 174, 88, 50, 41, 60, 171, 104, 42, 235, 32, 252, 214, 133, 93,
+    24, 111, 59, 166, 59, 116, 232, 248, 46, 151, 225, 57, 31, 103, 243, 254, 29, 0, 247, 187, 82, 182, 234, 218,
+    6, 120, 171, 135, 97, 240, 93, 47, 194, 114, 62, 207, 231, 252, 58, 142, 95, 113, 36, 138, 185, 25, 45, 115,
+    238, 145, 62, 121, 194, 177, 10, 195, 151, 222, 4, 20, 143, 74, 120, 26, 172, 67, 199, 97, 222, 228, 93, 116,
+    191, 9, 200, 89, 24, 51, 35, 39, 109, 12, 209, 176, 185, 131, 212, 120, 222, 129, 193, 202, 161, 217, 114, 18,
+    186, 52, 142, 18, 27, 255, 161, 238, 247, 194, 210, 228, 152, 31, 213, 179, 132, 154, 141, 242, 173, 224, 143, 123,
+    235, 180, 62, 171, 38, 221, 135, 223, 243, 49, 146, 201, 30, 244, 222, 149, 219, 183, 184, 119, 185, 18, 90, 72,
+    171, 165, 9, 125, 77, 93, 91, 64, 178, 36, 194, 190, 243, 142, 66, 106, 179, 35, 72, 126, 36, 77, 67, 182,
+    134, 59, 116, 232, 248, 46, 151, 225, 57, 31, 103, 243, 254, 29, 0, 248, 46, 151, 225, 57, 31, 103, 243, 254,
+    2, 55, 105, 18, 251, 213, 194, 101, 15, 50, 59, 190, 199, 202, 118, 29, 238, 70, 243, 186, 96, 95, 121, 172,
+    16, 249, 140, 150, 185, 21, 9, 158, 107, 144, 89, 19, 191, 139, 110, 109, 216, 125, 248, 57, 84, 59, 46, 67,
+    194, 227, 30, 29, 34, 210, 32, 234, 138, 194, 201, 30, 122, 132, 107, 9, 125, 72, 154, 130, 107, 11, 165, 234,
+    70, 120, 92, 188, 152, 236, 59, 220, 135, 203, 36, 149, 118, 76, 15, 70, 235, 150, 8, 157, 137, 180, 143, 28,
+    245, 30, 55, 161, 87, 34, 29, 44, 51, 39, 18, 55, 109, 231, 116, 198, 57, 7, 93, 171, 158, 221, 0, 232,
+    248, 46, 151, 225, 57, 31, 207, 248, 116, 255, 15, 184, 212, 198, 132, 59, 83, 143, 130, 233, 126, 19, 145, 252,
+    255, 135, 81, 197, 215, 43, 140, 157, 169, 91, 115, 35, 131, 52, 41, 248, 72, 176, 251, 241, 137, 225, 226, 175,
+    216, 119, 185, 15, 177, 97, 14, 150, 15, 158, 102, 36, 32, 201, 218, 161, 38, 133, 56, 171, 145, 80, 251, 248,
+    193, 176, 201, 107, 145, 224, 221, 90, 195, 151, 223, 176, 248, 63, 7, 209, 142, 161, 143, 18, 32, 236, 241, 82,
+    29, 133, 92, 136, 75, 43, 139, 26, 69, 192, 187, 240, 46, 243, 178, 210, 98, 66, 53, 131, 213, 204, 12, 161,
+    105, 114, 76, 9, 49, 233, 114, 50, 19, 40, 121, 145, 87, 34, 14, 138, 236, 18, 8, 63, 61, 140, 41, 108,
+    149, 180, 25, 115, 224, 194, 85, 38, 94, 103, 183, 64, 232, 248, 46, 151, 225, 57, 31, 207, 248, 116, 248, 46,
+    151, 225, 57, 31, 207, 248, 12, 157, 169, 91, 115, 32, 164, 208, 70, 176, 224, 205, 118, 29, 225, 51, 205, 114,
+    18, 186, 52, 132, 183, 165, 146, 45, 11, 232, 196, 138, 112, 158, 157, 108, 59, 190, 199, 202, 11, 110, 69, 56,
+    118, 209, 213, 180, 20, 114, 187, 46, 73, 128, 179, 59, 153, 236, 59, 220, 136, 116, 176, 75, 148, 176, 146, 117,
+    145, 150, 10, 71, 81, 227, 122, 21, 114, 55, 108, 140, 82, 43, 87, 33, 243, 21, 114, 37, 107, 116, 165, 118,
+    28, 21, 210, 242, 29, 135, 47, 191, 97, 236, 36, 180, 144, 249, 141, 227, 66, 217, 114, 50, 125, 118, 56, 145,
+    203, 238, 41, 197, 142, 75, 98, 57, 125, 224, 49, 249, 208, 213, 253, 30, 221, 0, 232, 248, 60, 236, 180, 152,
+    31, 217, 252, 120, 231, 160, 255, 15, 184, 154, 59, 5, 106, 113, 87, 35, 15, 227, 199, 33, 243, 8, 48, 145,
+    161, 23, 121, 217, 105, 49, 212, 120, 222, 130, 180, 209, 75, 7, 204, 85, 200, 222, 119, 76, 15, 27, 205, 96,
+    245, 25, 93, 30, 68, 21, 209, 167, 176, 249, 82, 103, 152, 212, 235, 224, 196, 136, 222, 110, 18, 31, 118, 183,
+    81, 47, 169, 21, 28, 171, 104, 41, 195, 236, 97, 40, 131, 250, 238, 187, 106, 90, 134, 168, 219, 166, 49, 207,
+    97, 239, 125, 118, 222, 140, 9, 202, 9, 105, 22, 89, 219, 9, 200, 132, 105, 125, 67, 61, 25, 22, 58, 163,
+    89, 91, 65, 178, 115, 169, 106, 20, 226, 12, 211, 193, 9, 150, 70, 103, 176, 252, 82, 148, 181, 72, 225, 22,
+    130, 55, 205, 95, 121, 199, 61, 68, 190, 164, 120, 42, 218, 10, 222, 24, 216, 39, 9, 207, 97, 236, 48, 254,
+    60, 114, 63, 31, 120, 155, 191, 18, 16, 103, 133, 203, 201, 133, 109, 4, 229, 4, 176, 225, 106, 225, 24, 62,
+    170, 207, 188, 141, 76, 202, 104, 123, 116, 252, 237, 11, 232, 254, 131, 241, 223, 24, 8, 45, 11, 232, 140, 225,
+    245, 21, 114, 48, 254, 60, 114, 63, 31, 127, 111, 167, 232, 232, 246, 182, 170, 203, 53, 9, 75, 232, 143, 130,
+    99, 28, 39, 61, 0, 239, 114, 46, 152, 199, 9, 200, 193, 75, 43, 104, 41, 197, 92, 132, 182, 170, 203, 53,
+    9, 75, 232, 135, 207, 53, 200, 200, 89, 25, 174, 48, 108, 56, 90, 184, 171, 144, 114, 187, 153, 15, 152, 190,
+    241, 10, 108, 51, 119, 169, 163, 180, 132, 107, 10, 45, 36, 100, 237, 232, 196, 165, 43, 180, 246, 31, 138, 108,
+    96, 102, 184, 50, 18, 8, 154, 131, 195, 4, 240, 251, 208, 73, 19, 73, 158, 97, 42, 142, 187, 80, 167, 16,
+    125, 24, 161, 78, 53, 70, 221, 48, 32, 228, 241, 111, 223, 228, 157, 149, 180, 236, 59, 220, 132, 88, 11, 34,
+    174, 185, 121, 28, 45, 92, 77, 65, 153, 234, 17, 172, 42, 228, 111, 59, 166, 3, 197, 140, 7, 204, 85, 200,
+    187, 206, 203, 73, 128, 178, 19, 196, 150, 174, 221, 0, 232, 247, 187, 102, 96, 182, 68, 124, 93, 245, 232, 239,
+    114, 50, 118, 204, 193, 108, 136, 135, 125, 66, 200, 222, 119, 76, 99, 144, 131, 108, 38, 68, 102, 240, 53, 38,
+    149, 180, 144, 141, 97, 182, 17, 153, 91, 78, 163, 198, 244, 25, 248, 11, 94, 233, 8, 53, 79, 38, 110, 185,
+    208, 201, 245, 213, 26, 195, 34, 212, 99, 176, 246, 96, 117, 218, 185, 30, 31, 230, 31, 49, 103, 109, 234, 68,
+    173, 72, 118, 21, 114, 41, 60, 96, 245, 8, 214, 20, 176, 108, 38, 147, 60, 197, 247, 181, 176, 66, 67, 238,
+    214, 24, 77, 169, 246, 144, 149, 71, 93, 169, 91, 65, 78, 17, 147, 28, 254, 196, 85, 200, 149, 173, 210, 149,
+    219, 176, 239, 114, 39, 34, 212, 31, 49, 52, 152, 35, 39, 207, 50, 70, 21, 180, 49, 61, 135, 226, 155, 24,
+    145, 194, 213, 197, 28, 174, 203, 146, 96, 127, 148, 141, 29, 134, 79, 232, 192, 171, 145, 73, 227, 7, 183, 64,
+    252, 236, 237, 189, 79, 232, 61, 152, 29, 118, 174, 71, 135, 249, 135, 204, 89, 219, 122, 158, 223, 79, 209, 249,
+    163, 38, 57, 253, 143, 232, 61, 153, 49, 207, 236, 69, 210, 44, 45, 11, 232, 200, 205, 224, 85, 200, 187, 206,
+    203, 73, 142, 223, 79, 209, 208, 248, 38, 49, 194, 115, 208, 239, 117, 145, 116, 198, 56, 78, 66, 200, 178, 235,
+    142, 70, 22, 186, 142, 22, 174, 51, 194, 229, 228, 194, 182, 131, 11, 165, 234, 66, 90, 202, 218, 10, 113, 87,
+    35, 118, 41, 60, 132, 173, 94, 118, 185, 131, 216, 119, 185, 22, 119, 137, 20, 226, 79, 163, 9, 128, 249, 230,
+    185, 25, 9, 4, 62, 197, 186, 136, 62, 138, 97, 91, 65, 100, 143, 34, 29, 245, 158, 195, 216, 102, 138, 212,
+    47, 190, 161, 243, 7, 83, 26, 22, 203, 145, 161, 99, 9, 79, 18, 50, 70, 30, 8, 185, 72, 183, 97, 222,
+    228, 111, 59, 166, 5, 247, 154, 193, 15, 152, 187, 206, 203, 73, 129, 52, 153, 230, 22, 68, 29, 176, 153, 27,
+    14, 22, 174, 16, 81, 105, 34, 87, 5, 178, 61, 186, 0, 232, 248, 38, 49, 194, 115, 208, 255, 15, 184, 205,
+    90, 195, 151, 222, 36, 227, 48, 172, 17, 158, 174, 96, 73, 202, 149, 216, 62, 98, 174, 69, 211, 24, 225, 57,
+    236, 63, 3, 101, 201, 48, 50, 72, 169, 9, 4, 39, 132, 107, 59, 27, 117, 8, 214, 18, 250, 144, 127, 93,
+    215, 109, 75, 80, 194, 153, 19, 146, 85, 24, 54, 14, 194, 174, 70, 120, 119, 142, 195, 189, 200, 157, 78, 48,
+    31, 48, 141, 75, 39, 106, 92, 130, 200, 127, 70, 54, 126, 12, 27, 15, 28, 138, 185, 19, 145, 106, 15, 152,
+    70, 249, 169, 174, 123, 15, 249, 122, 92, 140, 132, 240, 251, 208, 158, 102, 142, 161, 247, 164, 208, 200, 72, 34,
+    147, 99, 97, 78, 42, 228, 112, 152, 196, 246, 232, 232, 248, 38, 49, 194, 115, 208, 239, 117, 145, 178, 69, 7,
+    204, 85, 200, 186, 99, 28, 39, 33, 100, 19, 11, 142, 71, 235, 186, 154, 236, 59, 220, 135, 244, 98, 229, 44,
+    54, 77, 21, 180, 19, 204, 209, 212, 29, 86, 164, 62, 89, 36, 171, 178, 96, 104, 145, 227, 6, 195, 83, 50,
+    154, 25, 236, 59, 184, 171, 144, 82, 107, 168, 171, 152, 62, 233, 8, 51, 69, 106, 26, 97, 248, 25, 195, 234,
+    16, 67, 190, 189, 135, 123, 145, 53, 6, 100, 62, 98, 174, 68, 173, 110, 148, 174, 194, 73, 214, 69, 56, 216,
+    198, 165, 40, 138, 185, 8, 177, 219, 160, 232, 254, 189, 199, 224, 140, 154, 24, 247, 72, 254, 249, 230, 185, 30,
+    128, 239, 114, 63, 175, 113, 248, 35, 38, 134, 61, 210, 31, 60, 215, 34, 22, 70, 88, 222, 168, 193, 176, 225,
+    106, 225, 141, 112, 241, 228, 89, 83, 72, 77, 100, 35, 88, 93, 34, 220, 36, 17, 170, 54, 233, 137, 236, 62,
+    89, 65, 45, 34, 203, 59, 97, 57, 24, 86, 50, 31, 49, 147, 216, 132, 107, 3, 16, 240, 53, 51, 41, 161,
+    158, 195, 189, 200, 213, 25, 52, 48, 22, 66, 120, 146, 213, 212, 108, 243, 43, 227, 28, 139, 20, 194, 182, 131,
+    133, 171, 138, 185, 25, 66, 202, 200, 56, 147, 197, 204, 30, 195, 189, 200, 135, 125, 70, 100, 226, 70, 23, 201,
+    21, 114, 14, 203, 145, 106, 48, 31, 48, 131, 15, 42, 218, 15, 9, 85, 130, 19, 68, 86, 154, 21, 114, 50,
+    231, 193, 132, 170, 76, 188, 246, 232, 232, 249, 24, 244, 96, 124, 93, 245, 232, 255, 15, 184, 45, 70, 2, 9,
+    213, 49, 129, 38, 61, 24, 16, 239, 168, 205, 113, 131, 97, 194, 213, 199, 140, 43, 121, 86, 208, 97, 116, 189,
+    72, 70, 176, 190, 250, 234, 173, 160, 63, 174, 235, 182, 165, 171, 176, 254, 236, 67, 230, 42, 228, 126, 62, 249,
+    19, 119, 226, 66, 8, 70, 151, 215, 132, 130, 53, 51, 41, 161, 236, 61, 133, 210, 44, 45, 11, 232, 137, 90,
+    145, 178, 69, 42, 99, 28, 131, 254, 78, 84, 108, 51, 135, 212, 32, 213, 50, 186, 177, 234, 18, 66, 230, 37,
+    245, 46, 196, 96, 231, 65, 88, 32, 190, 241, 28, 246, 29, 238, 66, 44, 5, 145, 147, 190, 7, 141, 232, 77,
+    46, 120, 86, 211, 183, 64, 252, 237, 11, 232, 254, 131, 241, 223, 24, 8, 45, 11, 232, 140, 225, 245, 21, 114,
+    63, 31, 127, 111, 167, 232, 232, 251, 96, 167, 145, 241, 119, 215, 160, 239, 114, 60, 65, 79, 34, 29, 245, 11,
+    33, 4, 210, 71, 145, 147, 181, 66, 77, 10, 113, 87, 34, 139, 74, 187, 3, 137, 60, 92, 193, 236, 61, 135,
+    135, 249, 135, 204, 89, 219, 122, 145, 43, 82, 29, 133, 92, 140, 159, 118, 163, 29, 70, 237, 79, 190, 87, 54,
+    236, 59, 220, 140, 159, 60, 201, 27, 61, 5, 145, 116, 198, 127, 191, 61, 241, 142, 161, 26, 195, 93, 244, 144,
+    144, 68, 228, 149, 70, 13, 130, 67, 238, 214, 236, 61, 135, 141, 241, 131, 74, 195, 195, 164, 88, 89, 103, 108,
+    39, 50, 38, 147, 60, 195, 61, 46, 70, 66, 53, 132, 229, 115, 109, 240, 103, 176, 254, 181, 238, 144, 131, 196,
+    41, 204, 65, 157, 150, 136, 86, 21, 114, 53, 91, 77, 7, 204, 101, 116, 121, 237, 208, 252, 236, 237, 189, 79,
+    232, 59, 167, 146, 16, 120, 127, 152, 124, 197, 157, 183, 169, 237, 244, 253, 29, 0, 248, 38, 49, 194, 115, 208,
+    239, 117, 145, 116, 198, 56, 78, 70, 10, 90, 69, 137, 216, 192, 86, 167, 21, 114, 46, 243, 178, 210, 99, 221,
+    33, 45, 170, 178, 205, 66, 82, 250, 33, 32, 167, 97, 222, 228, 112, 152, 196, 132, 130, 48, 172, 108, 56, 90,
+    184, 217, 226, 161, 22, 164, 62, 99, 100, 154, 22, 88, 57, 83, 196, 246, 29, 238, 70, 23, 75, 212, 140, 240,
+    185, 121, 48, 21, 168, 198, 171, 84, 90, 177, 207, 97, 221, 197, 92, 134, 120, 171, 245, 8, 192, 252, 214, 132,
+    174, 140, 52, 195, 241, 35, 52, 86, 172, 115, 219, 160, 232, 254, 249, 230, 185, 30, 128, 246, 19, 170, 99, 1,
+    243, 205, 114, 35, 133, 171, 141, 85, 151, 84, 192, 177, 201, 227, 176, 239, 114, 44, 103, 200, 89, 25, 99, 122,
+    163, 6, 195, 133, 171, 141, 147, 99, 28, 60, 121, 234, 17, 172, 42, 228, 100, 250, 237, 189, 24, 22, 89, 219,
+    9, 204, 132, 24, 124, 188, 155, 9, 202, 9, 97, 194, 213, 194, 8, 70, 151, 212, 51, 209, 236, 61, 134, 104,
+    173, 66, 117, 56, 192, 124, 198, 79, 158, 100, 140, 43, 104, 98, 123, 15, 235, 94, 233, 25, 96, 164, 10, 186,
+    80, 225, 227, 200, 225, 36, 39, 136, 223, 106, 199, 33, 90, 140, 70, 251, 81, 183, 110, 128, 252, 237, 11, 232,
+    254, 131, 241, 223, 24, 8, 45, 11, 232, 140, 225, 245, 21, 114, 63, 31, 127, 111, 167, 232, 232, 254, 249, 230,
+    185, 30, 128, 239, 117, 144, 249, 230, 185, 16, 178, 39, 11, 165, 235, 28, 140, 36, 104, 99, 168, 216, 197, 211,
+    105, 30, 14, 29, 180, 86, 208, 83, 132, 22, 59, 36, 86, 165, 168, 92, 165, 187, 15, 232, 154, 174, 57, 27,
+    93, 233, 228, 37, 158, 24, 85, 200, 177, 159, 61, 135, 123, 145, 147, 235, 182, 244, 96, 44, 140, 225, 255, 98,
+    221, 69, 150, 118, 194, 114, 173, 160, 70, 6, 33, 224, 106, 102, 83, 67, 216, 123, 9, 168, 51, 35, 194, 99,
+    3, 10, 100, 59, 10, 185, 25, 225, 222, 58, 132, 144, 185, 139, 67, 237, 177, 176, 86, 23, 73, 163, 219, 160,
+    252, 237, 11, 232, 254, 131, 241, 223, 24, 8, 45, 11, 232, 140, 225, 245, 21, 114, 63, 31, 127, 111, 167, 232,
+    232, 248, 38, 49, 194, 115, 208, 239, 114, 46, 152, 199, 9, 200, 185, 130, 51, 39, 18, 50, 118, 154, 133, 202,
+    141, 187, 14, 247, 33, 22, 2, 200, 171, 174, 94, 71, 11, 87, 20, 90, 85, 219, 176, 255, 15, 184, 201, 24,
+    92, 164, 12, 209, 90, 135, 167, 92, 140, 139, 44, 229, 188, 202, 182, 130, 106, 18, 142, 138, 100, 83, 140, 159,
+    95, 9, 66, 174, 68, 35, 75, 235, 194, 65, 9, 84, 153, 121, 236, 59, 220, 142, 19, 24, 144, 144, 66, 89,
+    225, 141, 135, 11, 87, 26, 189, 47, 164, 165, 118, 76, 13, 158, 104, 196, 138, 186, 80, 146, 117, 11, 14, 203,
+    144, 209, 125, 22, 21, 114, 50, 88, 203, 125, 102, 145, 178, 51, 219, 160, 232, 248, 38, 49, 194, 115, 208, 239,
+    114, 46, 152, 199, 9, 200, 45, 105, 23, 48, 122, 143, 16, 141, 149, 213, 180, 20, 225, 3, 26, 225, 227, 200,
+    203, 15, 38, 133, 56, 171, 144, 207, 21, 112, 141, 96, 130, 229, 61, 114, 44, 148, 131, 34, 212, 96, 89, 222,
+    5, 56, 171, 144, 82, 107, 176, 239, 114, 18, 10, 5, 145, 6, 106, 23, 42, 54, 234, 56, 90, 184, 242, 121,
+    201, 34, 193, 50, 200, 204, 141, 145, 142, 36, 120, 194, 183, 149, 109, 4, 27, 118, 31, 251, 141, 11, 80, 103,
+    163, 33, 32, 141, 158, 104, 216, 59, 10, 185, 22, 119, 137, 234, 56, 72, 101, 109, 6, 236, 155, 213, 222, 23,
+    246, 54, 27, 24, 151, 102, 56, 20, 227, 201, 59, 7, 222, 187, 116, 232, 255, 147, 92, 60, 121, 30, 252, 60,
+    154, 232, 246, 25, 66, 107, 177, 176, 99, 92, 60, 121, 25, 97, 228, 208, 205, 113, 131, 97, 194, 213, 197, 35,
+    105, 131, 97, 146, 120, 193, 144, 141, 97, 125, 245, 213, 91, 64, 127, 93, 215, 109, 75, 87, 97, 237, 170, 218,
+    104, 85, 200, 120, 209, 25, 127, 99, 97, 149, 209, 231, 168, 65, 241, 73, 219, 193, 136, 228, 126, 42, 38, 145,
+    173, 33, 247, 174, 163, 39, 102, 57, 81, 176, 167, 21, 114, 24, 215, 15, 30, 66, 176, 70, 9, 111, 223, 119,
+    200, 102, 147, 117, 118, 236, 63, 173, 9, 39, 89, 15, 189, 7, 204, 109, 132, 200, 245, 27, 60, 202, 248, 199,
+    34, 174, 66, 181, 70, 242, 174, 195, 103, 86, 161, 155, 192, 171, 145, 8, 210, 250, 240, 144, 66, 85, 38, 94,
+    123, 116, 252, 246, 95, 208, 127, 132, 111, 34, 174, 71, 197, 39, 111, 6, 35, 145, 248, 175, 211, 244, 116, 251,
+    146, 144, 123, 203, 81, 142, 128, 239, 114, 44, 148, 131, 34, 212, 96, 44, 132, 25, 62, 44, 33, 223, 81, 194,
+    213, 196, 63, 18, 31, 49, 38, 61, 24, 144, 91, 36, 147, 96, 172, 52, 194, 76, 140, 147, 194, 177, 169, 236,
+    59, 220, 139, 239, 168, 124, 198, 169, 149, 213, 140, 133, 144, 153, 100, 250, 236, 140, 166, 195, 199, 35, 60, 36,
+    221, 91, 65, 133, 210, 245, 61, 135, 201, 245, 34, 76, 122, 49, 34, 203, 59, 97, 57, 25, 66, 210, 228, 152,
+    6, 33, 224, 106, 102, 83, 67, 61, 135, 123, 145, 114, 145, 65, 243, 21, 114, 46, 243, 178, 210, 99, 221, 34,
+    203, 162, 210, 96, 62, 198, 18, 149, 218, 66, 200, 221, 172, 96, 74, 157, 15, 110, 128, 252, 237, 11, 232, 254,
+    131, 241, 223, 24, 8, 36, 199, 163, 2, 233, 22, 22, 133, 244, 70, 111, 1, 25, 49, 204, 172, 246, 250, 126,
+    142, 128, 247, 187, 102, 96, 182, 68, 124, 93, 245, 232, 246, 26, 189, 140, 48, 201, 219, 51, 5, 178, 34, 29,
+    245, 28, 45, 92, 32, 194, 70, 132, 82, 120, 193, 8, 214, 6, 52, 118, 125, 87, 33, 149, 209, 98, 123, 14,
+    247, 35, 132, 198, 36, 36, 17, 133, 99, 97, 194, 213, 196, 229, 4, 180, 139, 44, 237, 132, 229, 91, 65, 5,
+    49, 251, 233, 117, 35, 46, 124, 24, 21, 120, 41, 67, 84, 218, 123, 15, 235, 94, 233, 7, 93, 171, 144, 207,
+    199, 81, 177, 139, 166, 210, 32, 228, 90, 177, 200, 222, 77, 134, 111, 1, 24, 29, 76, 104, 91, 46, 70, 164,
+    210, 182, 157, 135, 123, 144, 139, 2, 117, 56, 196, 140, 209, 90, 177, 200, 124, 199, 23, 90, 62, 29, 34, 195,
+    84, 143, 38, 39, 183, 64, 232, 249, 28, 183, 133, 174, 71, 247, 216, 194, 82, 187, 72, 247, 150, 163, 29, 0,
+    255, 15, 184, 154, 59, 5, 106, 113, 87, 35, 228, 114, 222, 22, 185, 31, 223, 99, 9, 74, 237, 35, 222, 90,
+    140, 7, 204, 85, 200, 203, 159, 6, 36, 229, 188, 45, 114, 51, 88, 215, 176, 239, 114, 33, 223, 80, 178, 51,
+    92, 96, 216, 112, 181, 113, 132, 141, 8, 213, 217, 105, 226, 69, 150, 118, 194, 114, 173, 160, 201, 236, 122, 134,
+    53, 195, 199, 145, 101, 77, 33, 53, 158, 161, 26, 194, 175, 5, 40, 38, 12, 84, 246, 30, 204, 152, 230, 106,
+    68, 173, 4, 161, 87, 43, 2, 105, 41, 93, 167, 168, 174, 118, 86, 208, 103, 188, 43, 239, 56, 228, 35, 88,
+    100, 239, 22, 86, 74, 86, 208, 65, 157, 157, 164, 207, 97, 222, 228, 37, 106, 243, 181, 204, 16, 178, 21, 168,
+    180, 145, 227, 122, 25, 190, 91, 201, 183, 110, 128, 232, 248, 38, 49, 194, 115, 208, 246, 19, 130, 124, 245, 26,
+    189, 140, 48, 186, 99, 28, 39, 33, 88, 85, 200, 203, 159, 6, 36, 229, 188, 45, 114, 51, 88, 215, 176, 238,
+    226, 174, 65, 73, 174, 161, 7, 9, 140, 7, 204, 105, 132, 153, 16, 125, 20, 196, 138, 185, 30, 55, 154, 194,
+    182, 131, 228, 114, 222, 22, 185, 31, 223, 99, 9, 74, 237, 35, 222, 90, 140, 117, 28, 92, 193, 24, 72, 208,
+    137, 202, 9, 105, 22, 89, 219, 9, 200, 211, 15, 225, 48, 50, 231, 193, 129, 87, 130, 149, 61, 135, 119, 21,
+    114, 56, 51, 65, 100, 85, 200, 131, 145, 218, 149, 216, 36, 20, 236, 59, 220, 140, 214, 53, 18, 78, 178, 41,
+    199, 130, 18, 133, 92, 140, 222, 14, 112, 237, 65, 243, 25, 62, 190, 18, 149, 180, 21, 114, 50, 231, 193, 132,
+    170, 76, 188, 246, 232, 232, 254, 249, 230, 185, 30, 128, 239, 117, 144, 178, 42, 228, 62, 121, 174, 68, 62, 98,
+    174, 70, 107, 26, 251, 164, 106, 140, 154, 24, 236, 59, 220, 136, 119, 212, 44, 140, 215, 24, 54, 28, 45, 92,
+    77, 37, 31, 222, 249, 254, 250, 185, 253, 233, 20, 40, 229, 118, 124, 62, 156, 246, 30, 195, 39, 198, 14, 84,
+    174, 193, 243, 31, 20, 157, 188, 24, 142, 71, 226, 162, 199, 210, 228, 100, 44, 134, 41, 88, 228, 36, 66, 54,
+    134, 193, 216, 85, 200, 177, 159, 61, 70, 198, 46, 155, 72, 222, 77, 134, 111, 2, 140, 210, 182, 129, 26, 194,
+    199, 209, 195, 237, 169, 106, 236, 59, 220, 141, 81, 147, 67, 1, 100, 22, 210, 30, 100, 216, 43, 12, 157, 226,
+    202, 201, 74, 218, 10, 185, 16, 103, 103, 105, 32, 231, 155, 197, 79, 110, 128, 252, 246, 95, 208, 119, 185, 131,
+    238, 144, 131, 39, 198, 14, 84, 174, 193, 243, 31, 20, 157, 188, 24, 142, 71, 226, 190, 233, 14, 194, 235, 34,
+    198, 124, 246, 250, 126, 142, 128, 247, 243, 224, 192, 248, 153, 217, 218, 72, 254, 139, 26, 244, 255, 15, 184, 72,
+    33, 88, 85, 200, 131, 145, 218, 149, 216, 36, 20, 15, 152, 247, 243, 224, 192, 251, 185, 100, 213, 114, 145, 253,
+    91, 46, 221, 66, 12, 20, 178, 182, 131, 46, 124, 24, 147, 150, 240, 181, 200, 86, 201, 108, 90, 132, 25, 217,
+    218, 72, 205, 99, 94, 195, 189, 200, 131, 145, 218, 149, 217, 102, 134, 144, 77, 72, 229, 247, 28, 45, 92, 32,
+    218, 31, 51, 50, 174, 201, 129, 58, 174, 15, 81, 99, 59, 45, 17, 87, 34, 231, 42, 92, 130, 101, 75, 233,
+    107, 145, 224, 221, 90, 194, 230, 59, 15, 196, 190, 216, 33, 88, 78, 235, 82, 17, 172, 40, 229, 112, 149, 75,
+    4, 106, 254, 136, 158, 23, 58, 199, 61, 65, 215, 195, 219, 149, 109, 6, 241, 161, 108, 185, 236, 62, 216, 124,
+    175, 188, 25, 14, 195, 46, 124, 24, 18, 153, 154, 228, 36, 17, 101, 157, 176, 156, 155, 7, 96, 130, 147, 198,
+    15, 110, 128, 232, 252, 113, 190, 186, 152, 30, 222, 136, 70, 176, 252, 17, 88, 124, 171, 160, 239, 117, 144, 178,
+    16, 101, 15, 51, 14, 150, 158, 163, 133, 171, 132, 26, 167, 249, 120, 23, 93, 47, 194, 114, 46, 82, 202, 218,
+    6, 120, 171, 138, 113, 221, 246, 62, 83, 176, 252, 17, 88, 124, 170, 9, 161, 130, 150, 145, 78, 42, 228, 20,
+    154, 28, 92, 193, 28, 190, 227, 36, 97, 36, 132, 25, 158, 4, 234, 152, 192, 155, 190, 211, 212, 38, 29, 180,
+    28, 45, 92, 119, 126, 24, 124, 19, 24, 10, 194, 174, 69, 150, 105, 27, 35, 216, 124, 159, 122, 184, 124, 197,
+    204, 16, 178, 63, 28, 111, 174, 166, 7, 183, 162, 219, 158, 163, 139, 174, 87, 24, 41, 105, 20, 225, 6, 18,
+    52, 35, 100, 143, 42, 218, 12, 61, 4, 107, 4, 103, 171, 152, 26, 167, 249, 120, 23, 93, 47, 194, 114, 21,
+    133, 92, 139, 44, 210, 54, 71, 183, 64, 252, 246, 121, 163, 31, 160, 246, 27, 60, 209, 129, 116, 145, 224, 150,
+    19, 73, 182, 13, 133, 56, 64, 197, 35, 199, 35, 11, 165, 232, 108, 248, 61, 190, 142, 128, 252, 17, 88, 124,
+    170, 9, 174, 128, 252, 17, 88, 124, 170, 9, 161, 147, 181, 43, 110, 100, 83, 138, 185, 5, 38, 130, 53, 135,
+    6, 104, 103, 15, 168, 185, 131, 216, 124, 143, 163, 9, 129, 58, 166, 48, 38, 239, 180, 140, 43, 17, 87, 34,
+    29, 45, 212, 112, 181, 112, 154, 237, 130, 54, 72, 242, 173, 167, 110, 128, 232, 252, 17, 88, 124, 170, 9, 174,
+    128, 252, 17, 88, 124, 170, 9, 161, 147, 181, 43, 110, 100, 83, 138, 185, 5, 38, 130, 53, 135, 6, 104, 103,
+    15, 168, 185, 131, 216, 123, 106, 237, 160, 171, 145, 58, 166, 48, 38, 239, 180, 133, 97, 87, 89, 21, 9, 98,
+    44, 179, 80, 185, 80, 171, 152, 33, 100, 32, 253, 119, 69, 106, 25, 62, 121, 146, 38, 239, 176, 167, 21, 114,
+    25, 226, 175, 212, 32, 149, 209, 133, 209, 180, 144, 158, 31, 209, 30, 239, 123, 231, 153, 35, 222, 236, 199, 42,
+    87, 111, 112, 177, 217, 114, 165, 109, 2, 12, 159, 60, 201, 25, 111, 176, 74, 21, 114, 50, 45, 70, 3, 230,
+    16, 95, 127, 31, 189, 26, 223, 190, 118, 127, 36, 89, 83, 72, 77, 123, 15, 97, 58, 166, 48, 60, 35, 121,
+    11, 35, 15, 146, 81, 176, 167, 21, 114, 37, 247, 171, 245, 28, 45, 92, 122, 72, 87, 222, 68, 174, 141, 33,
+    45, 232, 197, 44, 171, 104, 42, 229, 96, 66, 81, 144, 141, 97, 180, 61, 183, 202, 164, 35, 88, 73, 143, 75,
+    145, 144, 158, 145, 112, 158, 48, 69, 56, 217, 42, 29, 167, 176, 254, 172, 42, 228, 89, 102, 145, 178, 34, 156,
+    85, 200, 41, 52, 42, 228, 119, 126, 24, 124, 19, 24, 24, 86, 208, 196, 246, 232, 232, 247, 190, 121, 146, 61,
+    238, 204, 114, 165, 118, 232, 246, 19, 170, 99, 3, 39, 207, 50, 68, 221, 246, 28, 45, 92, 32, 201, 255, 110,
+    66, 181, 24, 87, 142, 195, 189, 200, 225, 49, 137, 9, 4, 37, 158, 24, 216, 112, 181, 112, 145, 92, 60, 121,
+    8, 214, 19, 115, 143, 70, 70, 107, 140, 27, 14, 22, 174, 60, 59, 249, 158, 195, 189, 200, 72, 125, 80, 62,
+    99, 56, 51, 124, 114, 60, 65, 224, 216, 100, 249, 230, 72, 205, 113, 137, 21, 114, 17, 99, 176, 239, 115, 4,
+    36, 17, 39, 209, 132, 192, 164, 241, 131, 33, 26, 195, 43, 162, 196, 142, 46, 96, 140, 183, 154, 125, 76, 72,
+    201, 24, 74, 208, 70, 176, 45, 254, 95, 145, 87, 43, 2, 208, 173, 230, 123, 14, 247, 35, 39, 221, 168, 192,
+    89, 26, 163, 49, 176, 241, 200, 206, 20, 181, 177, 200, 240, 144, 179, 73, 34, 10, 91, 145, 78, 41, 60, 144,
+    241, 99, 19, 219, 160, 252, 242, 125, 246, 118, 253, 7, 176, 149, 209, 131, 176, 171, 145, 7, 69, 154, 48, 22,
+    66, 91, 209, 138, 89, 86, 208, 85, 202, 192, 251, 119, 231, 247, 255, 118, 63, 191, 253, 205, 126, 255, 238, 196,
+    100, 251, 236, 237, 61, 190, 143, 207, 193, 76, 157, 191, 65, 236, 39, 84, 198, 4, 174, 140, 44, 118, 92, 169,
+    91, 65, 87, 35, 237, 251, 253, 189, 255, 223, 254, 71, 116, 249, 168, 249, 24, 244, 185, 16, 178, 29, 133, 92,
+    140, 159, 118, 163, 29, 190, 142, 128, 251, 81, 188, 143, 189, 170, 17, 178, 61, 0, 239, 114, 11, 84, 35, 100,
+    69, 56, 65, 58, 166, 48, 60, 66, 54, 87, 15, 152, 65, 135, 201, 48, 60, 35, 121, 236, 59, 220, 141, 48,
+    147, 34, 206, 241, 33, 32, 132, 179, 195, 27, 14, 22, 174, 42, 228, 120, 70, 243, 238, 145, 135, 209, 251, 15,
+    234, 210, 182, 61, 71, 47, 184, 201, 24, 73, 33, 4, 28, 142, 212, 174, 194, 198, 124, 132, 107, 4, 28, 34,
+    210, 182, 129, 32, 160, 225, 106, 227, 39, 215, 55, 138, 79, 24, 35, 43, 162, 196, 246, 29, 238, 96, 132, 130,
+    37, 116, 105, 14, 194, 174, 71, 9, 140, 72, 75, 122, 49, 75, 42, 218, 10, 185, 30, 17, 188, 251, 164, 73,
+    143, 75, 145, 144, 141, 97, 180, 62, 175, 74, 237, 61, 186, 0, 232, 251, 81, 188, 143, 236, 254, 60, 115, 208,
+    239, 114, 48, 254, 60, 114, 31, 49, 87, 34, 117, 76, 96, 120, 70, 242, 60, 66, 54, 87, 236, 59, 220, 137,
+    217, 50, 33, 100, 112, 113, 143, 223, 133, 160, 141, 97, 150, 10, 55, 97, 222, 230, 8, 72, 34, 142, 48, 96,
+    112, 173, 103, 226, 66, 97, 219, 64, 236, 68, 173, 136, 124, 197, 92, 136, 119, 215, 168, 225, 106, 227, 45, 230,
+    159, 83, 18, 56, 69, 165, 109, 2, 176, 194, 177, 236, 63, 171, 10, 185, 25, 22, 163, 29, 69, 92, 193, 11,
+    33, 4, 148, 165, 109, 2, 65, 65, 194, 213, 198, 169, 162, 126, 202, 198, 66, 53, 135, 136, 124, 175, 188, 25,
+    9, 225, 247, 161, 87, 35, 194, 55, 159, 116, 135, 207, 51, 10, 218, 79, 97, 236, 48, 145, 161, 18, 186, 48,
+    118, 21, 114, 56, 76, 96, 89, 103, 108, 39, 50, 42, 228, 120, 70, 243, 238, 145, 170, 204, 171, 176, 154, 74,
+    58, 150, 160, 141, 97, 233, 49, 185, 158, 221, 0, 232, 238, 113, 131, 3, 251, 43, 30, 128, 239, 114, 48, 172,
+    67, 230, 40, 227, 6, 7, 10, 214, 126, 36, 113, 115, 4, 101, 188, 211, 234, 98, 70, 72, 195, 39, 107, 111,
+    149, 10, 185, 88, 30, 17, 188, 171, 104, 42, 17, 165, 50, 165, 118, 158, 195, 189, 200, 163, 140, 24, 144, 144,
+    71, 141, 231, 144, 147, 43, 52, 173, 160, 203, 121, 167, 212, 196, 132, 107, 11, 163, 91, 10, 218, 10, 132, 105,
+    76, 169, 93, 167, 176, 239, 115, 4, 36, 17, 15, 177, 144, 141, 97, 52, 141, 149, 213, 218, 69, 56, 211, 117,
+    177, 21, 114, 48, 172, 67, 230, 50, 222, 105, 245, 49, 33, 26, 192, 180, 239, 4, 60, 88, 199, 110, 128, 232,
+    251, 81, 188, 152, 247, 72, 254, 249, 230, 185, 30, 128, 246, 27, 66, 250, 74, 33, 243, 205, 114, 35, 139, 152,
+    35, 194, 55, 144, 117, 219, 15, 201, 50, 53, 38, 135, 11, 87, 25, 111, 52, 250, 152, 145, 78, 44, 179, 150,
+    243, 34, 174, 86, 6, 106, 200, 217, 42, 96, 49, 54, 158, 195, 189, 200, 124, 243, 92, 136, 89, 25, 239, 12,
+    179, 115, 97, 194, 213, 194, 11, 25, 243, 212, 101, 116, 88, 158, 161, 26, 193, 6, 79, 174, 219, 209, 142, 195,
+    189, 204, 16, 144, 68, 220, 227, 209, 145, 154, 227, 6, 195, 133, 171, 140, 213, 145, 178, 84, 192, 240, 239, 230,
+    66, 53, 132, 25, 125, 227, 35, 61, 135, 123, 145, 194, 99, 18, 18, 8, 75, 60, 49, 176, 225, 106, 227, 35,
+    20, 185, 174, 73, 70, 66, 53, 130, 112, 145, 105, 16, 114, 125, 25, 127, 101, 109, 5, 92, 143, 8, 222, 125,
+    210, 19, 43, 169, 244, 117, 45, 83, 219, 160, 232, 239, 114, 62, 212, 111, 35, 255, 196, 223, 21, 208, 239, 114,
+    46, 186, 95, 28, 137, 57, 111, 4, 36, 20, 15, 152, 171, 145, 225, 27, 200, 226, 230, 8, 244, 152, 221, 60,
+    96, 132, 153, 53, 33, 32, 137, 167, 131, 110, 195, 189, 200, 244, 155, 226, 133, 157, 224, 44, 138, 186, 229, 228,
+    35, 88, 92, 167, 174, 122, 142, 22, 174, 16, 100, 250, 248, 86, 74, 87, 97, 135, 203, 207, 97, 253, 90, 86,
+    199, 168, 171, 152, 33, 32, 136, 126, 36, 62, 98, 83, 51, 92, 139, 29, 158, 86, 135, 135, 249, 153, 8, 214,
+    19, 115, 143, 70, 69, 223, 22, 86, 208, 100, 147, 112, 141, 96, 245, 115, 3, 210, 99, 116, 241, 130, 22, 142,
+    179, 216, 119, 185, 16, 239, 168, 89, 26, 187, 45, 60, 27, 15, 28, 137, 57, 111, 11, 92, 140, 147, 83, 9,
+    33, 26, 194, 15, 235, 186, 193, 145, 59, 28, 149, 48, 19, 122, 187, 194, 254, 201, 74, 236, 41, 194, 101, 145,
+    153, 237, 208, 232, 252, 17, 88, 124, 170, 9, 174, 128, 239, 117, 144, 178, 42, 228, 126, 8, 172, 62, 85, 4,
+    208, 171, 165, 12, 20, 180, 138, 113, 87, 32, 164, 208, 70, 176, 224, 205, 117, 28, 45, 92, 32, 147, 10, 100,
+    62, 98, 117, 76, 96, 77, 223, 105, 20, 226, 174, 71, 6, 107, 176, 239, 114, 59, 191, 12, 62, 9, 140, 5,
+    144, 82, 104, 62, 98, 230, 15, 80, 141, 96, 130, 117, 76, 96, 67, 165, 134, 20, 200, 171, 145, 47, 189, 92,
+    85, 210, 130, 109, 177, 72, 145, 78, 44, 82, 192, 181, 187, 14, 247, 48, 66, 200, 65, 174, 240, 152, 27, 34,
+    181, 27, 7, 97, 87, 34, 29, 44, 46, 96, 245, 22, 59, 46, 84, 173, 160, 171, 145, 247, 164, 85, 197, 150,
+    118, 194, 114, 108, 29, 130, 12, 159, 93, 183, 163, 2, 114, 130, 91, 168, 225, 106, 226, 174, 70, 175, 188, 145,
+    150, 241, 47, 3, 15, 146, 81, 176, 86, 30, 251, 163, 111, 71, 168, 255, 143, 151, 110, 128, 232, 254, 202, 217,
+    62, 24, 123, 122, 61, 0, 246, 19, 170, 99, 29, 68, 36, 28, 114, 42, 19, 209, 193, 176, 135, 75, 118, 29,
+    238, 71, 119, 225, 135, 193, 49, 129, 227, 117, 197, 149, 180, 96, 178, 55, 216, 83, 138, 185, 18, 182, 60, 38,
+    60, 135, 97, 87, 32, 164, 209, 134, 18, 182, 61, 71, 23, 92, 17, 87, 35, 100, 143, 42, 218, 12, 61, 12,
+    222, 5, 92, 143, 8, 222, 70, 72, 195, 193, 18, 75, 10, 113, 87, 35, 131, 53, 216, 127, 77, 226, 174, 96,
+    75, 239, 87, 21, 114, 33, 210, 193, 54, 216, 164, 72, 167, 30, 8, 141, 216, 63, 163, 3, 133, 171, 143, 27,
+    205, 204, 132, 107, 13, 33, 247, 107, 12, 159, 209, 133, 109, 59, 116, 232, 251, 138, 88, 125, 237, 110, 128, 239,
+    114, 33, 210, 192, 181, 164, 92, 193, 234, 56, 90, 184, 65, 147, 239, 182, 8, 124, 199, 132, 111, 32, 235, 182,
+    31, 146, 100, 101, 119, 121, 86, 208, 83, 141, 146, 60, 138, 185, 88, 25, 36, 72, 86, 154, 41, 96, 249, 143,
+    6, 234, 214, 21, 114, 60, 35, 121, 236, 59, 220, 136, 116, 176, 195, 191, 153, 24, 95, 36, 45, 13, 228, 216,
+    83, 140, 157, 152, 229, 66, 156, 85, 200, 151, 222, 175, 212, 120, 222, 133, 210, 68, 171, 100, 71, 130, 88, 63,
+    163, 26, 67, 240, 195, 133, 171, 137, 188, 111, 227, 193, 142, 123, 15, 238, 194, 174, 67, 213, 204, 9, 91, 16,
+    249, 213, 200, 155, 198, 254, 36, 45, 12, 59, 249, 145, 133, 242, 69, 92, 193, 11, 33, 4, 212, 19, 66, 87,
+    70, 21, 116, 161, 116, 145, 224, 150, 15, 232, 198, 144, 252, 48, 225, 106, 227, 210, 177, 158, 195, 250, 230, 29,
+    177, 200, 171, 152, 35, 132, 144, 131, 132, 228, 120, 76, 188, 138, 185, 131, 219, 160, 232, 252, 17, 88, 124, 170,
+    9, 174, 128, 252, 17, 88, 124, 170, 9, 161, 147, 181, 43, 29, 228, 20, 154, 8, 214, 28, 25, 174, 162, 156,
+    85, 200, 41, 52, 21, 133, 92, 139, 44, 210, 54, 68, 85, 204, 16, 178, 17, 158, 174, 96, 106, 159, 229, 224,
+    67, 165, 133, 93, 40, 96, 165, 164, 51, 197, 92, 35, 88, 75, 239, 87, 234, 54, 131, 59, 234, 109, 142, 65,
+    108, 150, 50, 194, 182, 130, 174, 69, 63, 13, 216, 119, 185, 26, 66, 53, 135, 119, 225, 135, 193, 49, 128, 178,
+    48, 249, 37, 27, 10, 113, 87, 34, 95, 122, 184, 124, 197, 204, 30, 163, 133, 171, 132, 24, 72, 208, 143, 7,
+    24, 20, 252, 24, 30, 55, 92, 80, 118, 21, 114, 41, 246, 24, 95, 36, 32, 201, 54, 90, 76, 15, 27, 174,
+    44, 173, 167, 110, 128, 232, 252, 17, 88, 124, 170, 9, 174, 128, 252, 17, 88, 124, 170, 9, 161, 147, 181, 43,
+    29, 228, 20, 154, 8, 214, 28, 25, 174, 163, 133, 171, 138, 185, 19, 119, 219, 101, 109, 5, 150, 106, 23, 42,
+    20, 226, 174, 71, 6, 104, 35, 88, 35, 61, 92, 192, 135, 75, 5, 106, 49, 145, 218, 149, 180, 20, 226, 174,
+    65, 73, 174, 221, 0, 232, 252, 17, 88, 124, 170, 9, 174, 128, 246, 145, 248, 34, 176, 249, 84, 19, 66, 105,
+    34, 164, 83, 141, 76, 104, 71, 11, 87, 8, 207, 87, 48, 33, 210, 221, 66, 208, 100, 136, 126, 36, 92, 193,
+    234, 52, 95, 74, 218, 14, 19, 145, 78, 37, 108, 70, 201, 30, 85, 180, 8, 214, 30, 23, 201, 24, 70, 51,
+    219, 160, 232, 252, 17, 88, 124, 170, 9, 160, 141, 97, 239, 45, 80, 152, 30, 222, 139, 110, 122, 0, 239, 117,
+    144, 178, 42, 228, 43, 81, 140, 142, 212, 174, 193, 243, 31, 130, 43, 15, 149, 65, 52, 17, 172, 61, 229, 170,
+    19, 3, 219, 209, 109, 207, 97, 239, 45, 80, 152, 24, 41, 105, 20, 226, 174, 68, 190, 245, 126, 163, 139, 174,
+    8, 252, 17, 88, 100, 237, 74, 219, 153, 14, 194, 156, 85, 200, 224, 205, 118, 232, 232, 238, 252, 48, 248, 38,
+    48, 63, 179, 248, 241, 207, 64, 239, 114, 48, 254, 60, 114, 31, 49, 87, 35, 187, 240, 195, 224, 152, 192, 89,
+    25, 174, 48, 108, 56, 90, 184, 194, 209, 132, 173, 224, 132, 240, 251, 208, 171, 145, 79, 195, 117, 8, 214, 8,
+    39, 84, 198, 7, 8, 180, 173, 160, 72, 40, 56, 90, 184, 65, 7, 35, 181, 43, 178, 205, 11, 25, 243, 216,
+    123, 9, 93, 24, 59, 10, 185, 22, 51, 228, 65, 75, 72, 247, 125, 169, 151, 145, 253, 146, 140, 117, 31, 238,
+    236, 71, 227, 117, 155, 171, 105, 238, 236, 63, 195, 238, 25, 233, 114, 33, 7, 165, 149, 167, 128, 173, 155, 198,
+    169, 74, 236, 50, 45, 70, 2, 200, 167, 21, 114, 10, 77, 117, 28, 45, 92, 75, 234, 93, 136, 195, 173, 24,
+    86, 208, 39, 135, 222, 187, 14, 247, 35, 187, 240, 195, 224, 152, 192, 186, 99, 3, 5, 45, 34, 156, 85, 200,
+    151, 222, 174, 56, 90, 184, 65, 43, 163, 10, 186, 80, 130, 150, 145, 238, 252, 19, 151, 137, 31, 223, 60, 215,
+    35, 219, 221, 208, 232, 239, 114, 59, 191, 12, 62, 9, 140, 126, 254, 19, 158, 128, 239, 117, 145, 135, 109, 5,
+    211, 24, 225, 57, 24, 41, 105, 20, 226, 174, 71, 224, 156, 188, 72, 254, 249, 230, 185, 16, 141, 97, 87, 35,
+    196, 20, 242, 33, 223, 81, 78, 42, 228, 20, 154, 236, 61, 152, 29, 76, 104, 91, 46, 65, 249, 173, 5, 145,
+    135, 201, 40, 216, 83, 138, 185, 18, 251, 213, 250, 142, 22, 174, 16, 120, 133, 203, 200, 187, 226, 202, 218, 10,
+    185, 22, 119, 128, 159, 229, 35, 183, 64, 232, 255, 241, 101, 105, 224, 127, 86, 205, 227, 84, 165, 118, 30, 242,
+    212, 99, 160, 239, 117, 145, 14, 250, 133, 145, 154, 227, 6, 195, 133, 171, 133, 108, 222, 53, 74, 87, 110, 163,
+    84, 218, 122, 143, 16, 249, 95, 120, 51, 212, 31, 70, 57, 171, 171, 104, 57, 125, 198, 79, 190, 44, 23, 84,
+    209, 88, 142, 46, 88, 97, 223, 202, 182, 131, 55, 128, 173, 155, 198, 169, 74, 237, 216, 127, 248, 144, 175, 188,
+    137, 93, 26, 69, 209, 180, 14, 194, 174, 71, 9, 140, 11, 29, 151, 42, 86, 208, 85, 200, 186, 205, 60, 114,
+    31, 49, 87, 34, 159, 134, 234, 17, 172, 42, 228, 100, 237, 53, 27, 229, 74, 236, 31, 49, 87, 89, 30, 140,
+    114, 59, 191, 12, 62, 9, 140, 118, 30, 194, 117, 76, 96, 82, 120, 193, 8, 214, 21, 195, 140, 174, 139, 18,
+    22, 70, 31, 36, 163, 96, 172, 29, 136, 124, 197, 92, 140, 158, 24, 196, 245, 28, 45, 92, 32, 131, 179, 197,
+    24, 18, 180, 173, 160, 74, 21, 114, 41, 60, 96, 142, 33, 105, 91, 64, 172, 16, 127, 151, 222, 25, 49, 219,
+    160, 252, 233, 49, 231, 244, 29, 238, 68, 29, 158, 40, 192, 89, 5, 52, 48, 41, 199, 16, 180, 69, 214, 68,
+    211, 199, 61, 190, 142, 128, 251, 96, 167, 145, 241, 119, 215, 160, 239, 117, 145, 226, 10, 121, 16, 239, 168, 89,
+    28, 190, 240, 43, 157, 151, 36, 192, 241, 5, 60, 136, 119, 215, 176, 239, 115, 7, 221, 33, 6, 112, 182, 208,
+    132, 107, 4, 25, 62, 237, 70, 58, 142, 22, 174, 16, 74, 183, 145, 194, 213, 223, 122, 8, 52, 72, 240, 154,
+    17, 101, 157, 158, 83, 29, 135, 176, 186, 53, 135, 16, 181, 69, 132, 174, 140, 56, 72, 105, 20, 225, 158, 134,
+    219, 208, 70, 230, 174, 173, 160, 179, 240, 194, 174, 68, 171, 121, 22, 132, 86, 15, 2, 174, 70, 216, 223, 95,
+    6, 7, 11, 140, 11, 167, 162, 60, 17, 146, 99, 6, 193, 52, 69, 110, 221, 0, 232, 252, 19, 151, 137, 31,
+    223, 60, 215, 35, 208, 246, 26, 97, 53, 120, 125, 228, 62, 121, 174, 68, 102, 184, 193, 176, 225, 106, 226, 174,
+    70, 18, 52, 51, 93, 69, 202, 122, 83, 52, 51, 222, 26, 183, 130, 17, 185, 31, 215, 184, 154, 76, 243, 25,
+    62, 248, 176, 93, 83, 69, 99, 216, 119, 185, 26, 167, 47, 18, 50, 186, 44, 4, 219, 98, 145, 34, 156, 120,
+    32, 235, 181, 114, 18, 133, 92, 141, 95, 82, 213, 212, 35, 88, 122, 72, 87, 222, 70, 73, 174, 200, 186, 48,
+    149, 209, 164, 36, 17, 180, 62, 219, 27, 13, 246, 9, 15, 187, 88, 85, 200, 124, 243, 92, 136, 218, 31, 93,
+    169, 91, 65, 6, 86, 197, 170, 69, 56, 244, 244, 123, 116, 232, 251, 83, 47, 35, 219, 24, 60, 244, 239, 114,
+    60, 38, 94, 66, 99, 7, 144, 249, 138, 185, 29, 223, 134, 31, 4, 198, 59, 15, 97, 101, 109, 57, 14, 196,
+    97, 24, 136, 116, 183, 80, 254, 140, 105, 15, 195, 14, 22, 174, 60, 70, 243, 112, 141, 97, 233, 88, 207, 97,
+    222, 228, 38, 48, 121, 25, 59, 82, 182, 230, 71, 135, 171, 130, 147, 65, 26, 195, 131, 53, 216, 119, 113, 87,
+    35, 131, 52, 22, 71, 23, 74, 9, 182, 197, 34, 69, 56, 240, 69, 92, 135, 171, 152, 18, 182, 33, 243, 8,
+    44, 82, 192, 181, 186, 132, 107, 4, 24, 72, 208, 141, 161, 125, 38, 92, 140, 203, 100, 70, 20, 200, 167, 21,
+    114, 10, 77, 118, 232, 232, 251, 83, 47, 35, 219, 24, 60, 244, 239, 114, 19, 24, 60, 140, 157, 169, 91, 115,
+    34, 230, 15, 81, 194, 213, 194, 12, 61, 7, 204, 63, 163, 26, 67, 240, 195, 196, 111, 55, 20, 226, 174, 67,
+    60, 85, 251, 14, 247, 48, 66, 200, 65, 27, 205, 114, 37, 116, 97, 115, 7, 183, 64, 252, 229, 116, 111, 208,
+    123, 8, 222, 107, 145, 53, 4, 208, 149, 209, 130, 200, 201, 253, 24, 54, 10, 195, 55, 194, 166, 135, 183, 209,
+    208, 251, 83, 47, 35, 219, 24, 60, 244, 239, 114, 19, 24, 60, 140, 157, 169, 91, 115, 34, 156, 85, 200, 41,
+    53, 212, 35, 88, 83, 138, 185, 28, 25, 160, 178, 16, 108, 149, 112, 154, 187, 104, 42, 228, 120, 141, 230, 226,
+    174, 148, 48, 82, 210, 41, 199, 23, 74, 9, 182, 197, 34, 69, 56, 240, 66, 13, 146, 60, 171, 104, 48, 245,
+    216, 119, 185, 27, 37, 92, 44, 143, 70, 57, 15, 232, 198, 144, 252, 55, 80, 141, 97, 203, 239, 238, 130, 25,
+    232, 78, 240, 66, 230, 57, 125, 198, 79, 190, 44, 53, 79, 36, 114, 251, 192, 225, 57, 30, 19, 47, 33, 224,
+    51, 215, 110, 128, 232, 252, 82, 60, 171, 104, 63, 179, 215, 64, 246, 24, 72, 208, 141, 146, 60, 171, 104, 48,
+    245, 212, 112, 181, 113, 146, 68, 132, 107, 10, 141, 242, 243, 34, 118, 120, 75, 46, 73, 140, 114, 54, 72, 242,
+    108, 19, 195, 239, 93, 70, 175, 52, 31, 49, 87, 58, 132, 130, 56, 90, 186, 176, 171, 145, 133, 99, 61, 135,
+    123, 152, 33, 100, 59, 17, 81, 190, 94, 69, 93, 40, 77, 35, 90, 67, 239, 93, 66, 208, 195, 191, 153, 24,
+    95, 36, 45, 14, 18, 91, 221, 66, 11, 88, 193, 176, 225, 106, 227, 209, 142, 70, 168, 220, 141, 159, 28, 232,
+    237, 61, 186, 0, 232, 251, 83, 47, 35, 219, 24, 60, 244, 239, 114, 19, 24, 60, 140, 157, 169, 91, 115, 34,
+    156, 85, 200, 224, 205, 117, 8, 214, 21, 117, 144, 178, 16, 88, 165, 129, 107, 118, 30, 195, 9, 26, 17, 180,
+    47, 164, 203, 145, 153, 108, 136, 194, 177, 145, 87, 34, 29, 44, 41, 197, 92, 130, 147, 93, 135, 123, 152, 33,
+    100, 32, 163, 131, 181, 221, 136, 217, 240, 69, 56, 171, 144, 82, 104, 59, 10, 185, 15, 87, 48, 37, 108, 67,
+    230, 42, 228, 102, 91, 35, 212, 35, 88, 85, 204, 17, 135, 127, 50, 41, 199, 130, 16, 108, 243, 70, 4, 210,
+    109, 131, 97, 78, 22, 187, 116, 232, 247, 150, 168, 76, 15, 111, 71, 160, 247, 150, 168, 76, 15, 111, 69, 183,
+    35, 5, 45, 34, 156, 85, 200, 103, 138, 184, 70, 176, 151, 222, 174, 51, 135, 212, 92, 193, 236, 61, 134, 18,
+    52, 35, 104, 95, 73, 151, 35, 50, 217, 17, 133, 99, 34, 174, 71, 6, 104, 74, 216, 135, 204, 85, 200, 204,
+    182, 71, 176, 249, 62, 164, 66, 53, 159, 81, 146, 68, 132, 130, 54, 72, 242, 108, 29, 133, 92, 137, 91, 16,
+    249, 138, 185, 16, 233, 110, 221, 0, 232, 247, 150, 168, 76, 15, 111, 71, 160, 247, 150, 168, 76, 15, 111, 69,
+    183, 35, 39, 106, 86, 220, 200, 103, 138, 184, 70, 176, 151, 222, 175, 216, 119, 185, 130, 22, 66, 10, 76, 96,
+    81, 193, 218, 238, 196, 108, 248, 34, 230, 8, 225, 106, 225, 6, 208, 173, 70, 195, 103, 154, 48, 38, 147, 108,
+    27, 4, 107, 10, 77, 141, 133, 56, 90, 237, 208, 252, 229, 116, 111, 208, 123, 13, 161, 90, 141, 132, 174, 140,
+    22, 69, 38, 198, 194, 156, 85, 200, 204, 182, 71, 183, 209, 208, 247, 150, 168, 76, 15, 111, 71, 160, 247, 150,
+    168, 76, 15, 111, 69, 183, 35, 39, 106, 86, 220, 200, 167, 21, 114, 25, 226, 175, 212, 112, 181, 112, 131, 9,
+    26, 17, 162, 72, 154, 74, 87, 96, 90, 161, 27, 34, 41, 197, 92, 142, 12, 215, 110, 128, 232, 254, 137, 52,
+    63, 166, 231, 3, 229, 73, 74, 237, 208, 246, 24, 72, 208, 140, 247, 56, 19, 73, 74, 236, 22, 69, 204, 30,
+    163, 133, 171, 141, 81, 185, 27, 111, 174, 210, 19, 210, 46, 19, 198, 8, 205, 224, 108, 149, 14, 211, 216, 124,
+    159, 82, 51, 130, 66, 44, 5, 145, 135, 201, 40, 216, 59, 10, 185, 25, 60, 49, 142, 161, 26, 193, 24, 125,
+    255, 254, 12, 174, 145, 161, 129, 52, 148, 174, 193, 100, 31, 69, 133, 204, 30, 195, 239, 249, 173, 72, 193, 75,
+    10, 113, 87, 32, 164, 208, 70, 176, 171, 145, 47, 189, 92, 83, 138, 185, 16, 233, 105, 237, 208, 232, 247, 150,
+    168, 76, 15, 111, 69, 183, 33, 26, 195, 234, 251, 42, 227, 229, 80, 77, 116, 246, 23, 93, 47, 194, 114, 41,
+    197, 92, 130, 147, 67, 5, 45, 34, 156, 126, 43, 85, 62, 55, 141, 47, 212, 35, 88, 125, 95, 101, 92, 124,
+    170, 9, 161, 130, 150, 145, 78, 42, 228, 112, 102, 187, 116, 252, 229, 116, 111, 208, 123, 11, 164, 210, 227, 144,
+    96, 229, 70, 194, 87, 70, 11, 33, 216, 85, 200, 154, 130, 104, 100, 240, 198, 59, 125, 29, 0, 250, 190, 202,
+    184, 249, 84, 19, 93, 0, 250, 190, 202, 184, 249, 84, 19, 67, 5, 45, 34, 156, 85, 200, 41, 52, 17, 172,
+    56, 51, 65, 243, 23, 48, 122, 142, 22, 174, 16, 97, 35, 66, 63, 162, 77, 15, 233, 185, 192, 154, 74, 87,
+    97, 78, 42, 228, 51, 197, 95, 183, 64, 232, 250, 190, 202, 184, 249, 84, 19, 93, 0, 250, 190, 202, 184, 249,
+    84, 19, 67, 39, 106, 86, 220, 200, 167, 21, 114, 56, 51, 65, 26, 192, 164, 208, 124, 197, 204, 30, 163, 84,
+    255, 47, 2, 235, 165, 248, 78, 100, 100, 140, 60, 17, 36, 176, 86, 30, 30, 174, 44, 176, 114, 165, 118, 158,
+    221, 0, 232, 250, 190, 202, 184, 249, 84, 19, 93, 0, 250, 190, 202, 184, 249, 84, 19, 67, 39, 106, 86, 220,
+    200, 167, 21, 114, 56, 51, 65, 26, 192, 164, 215, 81, 87, 48, 66, 109, 177, 72, 145, 78, 60, 16, 130, 12,
+    210, 111, 8, 212, 41, 197, 92, 142, 12, 215, 110, 128, 232, 250, 190, 202, 184, 249, 84, 19, 93, 0, 250, 190,
+    202, 184, 249, 84, 19, 67, 39, 106, 86, 220, 200, 86, 30, 30, 174, 44, 176, 114, 165, 118, 145, 115, 7, 168,
+    70, 176, 65, 6, 105, 55, 132, 106, 12, 154, 155, 14, 247, 35, 224, 141, 167, 236, 236, 66, 200, 167, 21, 114,
+    25, 226, 175, 216, 119, 185, 31, 4, 109, 63, 103, 98, 22, 66, 12, 174, 184, 192, 131, 52, 155, 194, 53, 4,
+    107, 15, 9, 29, 71, 150, 126, 24, 102, 240, 22, 164, 65, 194, 124, 205, 130, 86, 175, 59, 92, 193, 234, 44,
+    112, 185, 43, 239, 35, 55, 123, 117, 8, 214, 28, 45, 136, 147, 131, 149, 43, 176, 124, 197, 161, 91, 204, 246,
+    31, 214, 189, 210, 16, 108, 251, 111, 132, 129, 59, 61, 12, 222, 6, 31, 36, 196, 138, 113, 116, 109, 3, 239,
+    65, 26, 195, 118, 225, 90, 193, 51, 163, 1, 6, 29, 180, 22, 78, 123, 116, 232, 239, 114, 62, 8, 218, 126,
+    206, 199, 160, 239, 114, 62, 8, 218, 126, 206, 196, 44, 132, 25, 93, 113, 129, 6, 105, 55, 132, 106, 8, 214,
+    30, 18, 58, 143, 44, 252, 48, 205, 224, 45, 72, 131, 132, 249, 155, 4, 173, 94, 118, 185, 131, 212, 88, 225,
+    114, 87, 222, 70, 110, 246, 234, 17, 172, 56, 91, 17, 39, 7, 42, 87, 96, 249, 139, 66, 183, 153, 236, 63,
+    173, 123, 164, 32, 217, 246, 223, 9, 2, 118, 122, 25, 188, 12, 62, 73, 137, 20, 226, 232, 218, 7, 222, 130,
+    53, 134, 237, 194, 181, 130, 103, 70, 2, 12, 59, 104, 44, 156, 246, 232, 232, 250, 190, 202, 184, 249, 84, 19,
+    93, 0, 250, 190, 202, 184, 249, 84, 19, 67, 39, 106, 86, 220, 200, 167, 21, 114, 56, 51, 65, 26, 192, 164,
+    215, 80, 131, 84, 255, 47, 2, 235, 165, 248, 78, 70, 72, 195, 193, 18, 75, 10, 185, 28, 25, 161, 197, 215,
+    4, 85, 200, 167, 225, 134, 78, 212, 173, 185, 145, 78, 42, 228, 20, 154, 237, 208, 232, 248, 46, 151, 225, 57,
+    20, 227, 242, 92, 174, 180, 129, 26, 195, 223, 116, 109, 232, 244, 246, 23, 93, 47, 194, 114, 41, 197, 92, 142,
+    12, 208, 193, 75, 72, 167, 31, 146, 229, 117, 164, 234, 56, 186, 224, 133, 97, 87, 34, 203, 52, 141, 145, 20,
+    226, 174, 67, 60, 85, 194, 53, 129, 73, 161, 171, 193, 26, 167, 249, 120, 23, 93, 47, 194, 115, 35, 36, 97,
+    224, 137, 37, 187, 14, 247, 35, 241, 198, 250, 234, 96, 123, 122, 45, 185, 24, 41, 105, 20, 226, 174, 67, 60,
+    85, 199, 23, 92, 17, 245, 125, 149, 113, 242, 168, 38, 133, 202, 90, 69, 56, 171, 144, 82, 107, 183, 64, 252,
+    240, 83, 60, 26, 253, 7, 201, 245, 46, 196, 93, 36, 89, 103, 68, 139, 27, 4, 24, 41, 158, 13, 5, 97,
+    87, 35, 77, 234, 140, 118, 250, 58, 0, 252, 113, 190, 186, 152, 30, 222, 143, 64, 252, 113, 190, 186, 152, 30,
+    222, 139, 110, 70, 10, 90, 69, 56, 171, 144, 207, 21, 112, 141, 97, 47, 189, 92, 103, 15, 168, 185, 131, 212,
+    43, 10, 185, 22, 89, 164, 108, 136, 86, 30, 30, 174, 44, 176, 114, 165, 118, 145, 170, 127, 151, 129, 117, 210,
+    252, 39, 50, 50, 70, 30, 8, 146, 91, 176, 239, 114, 41, 248, 97, 146, 48, 240, 68, 146, 194, 156, 85, 200,
+    41, 52, 31, 49, 115, 7, 168, 225, 106, 227, 210, 66, 190, 242, 60, 110, 184, 178, 182, 147, 216, 123, 12, 36,
+    104, 70, 201, 30, 85, 180, 24, 122, 25, 35, 15, 4, 73, 44, 51, 222, 42, 230, 3, 60, 85, 251, 116, 232,
+    252, 113, 190, 186, 152, 30, 222, 143, 64, 252, 113, 190, 186, 152, 30, 222, 139, 110, 70, 10, 90, 69, 56, 171,
+    144, 207, 21, 112, 141, 97, 47, 189, 95, 168, 225, 106, 227, 84, 255, 47, 2, 235, 165, 248, 78, 100, 43, 15,
+    15, 87, 22, 88, 57, 82, 187, 79, 97, 222, 228, 83, 240, 195, 198, 235, 139, 43, 105, 35, 36, 97, 224, 137,
+    37, 130, 176, 171, 144, 82, 107, 183, 64, 232, 252, 113, 190, 186, 152, 30, 222, 143, 64, 252, 113, 190, 186, 152,
+    30, 222, 139, 110, 70, 78, 212, 173, 185, 145, 78, 42, 228, 51, 197, 92, 35, 88, 75, 239, 87, 234, 17, 172,
+    16, 97, 35, 66, 54, 72, 242, 173, 160, 195, 208, 156, 146, 168, 193, 176, 225, 106, 227, 36, 137, 11, 35, 15,
+    146, 81, 176, 167, 21, 114, 10, 77, 118, 232, 232, 252, 113, 190, 186, 152, 30, 222, 143, 64, 252, 113, 190, 186,
+    152, 30, 222, 139, 110, 70, 78, 212, 173, 185, 145, 78, 42, 228, 51, 197, 92, 35, 88, 75, 239, 87, 234, 56,
+    90, 184, 65, 170, 127, 151, 129, 117, 210, 252, 39, 35, 15, 146, 81, 176, 167, 21, 114, 25, 226, 174, 17, 172,
+    16, 108, 145, 229, 91, 65, 135, 161, 146, 48, 240, 68, 146, 194, 156, 85, 200, 151, 222, 174, 10, 77, 118, 31,
+    211, 120, 171, 152, 18, 251, 213, 194, 200, 70, 122, 185, 129, 170, 127, 151, 129, 117, 210, 252, 39, 61, 71, 23,
+    92, 17, 87, 34, 159, 134, 25, 35, 15, 4, 73, 44, 41, 197, 92, 130, 147, 93, 186, 0, 232, 248, 187, 234,
+    62, 175, 179, 248, 244, 251, 245, 218, 185, 31, 23, 125, 71, 238, 31, 87, 217, 252, 122, 0, 232, 248, 187, 234,
+    62, 175, 179, 235, 232, 251, 245, 218, 185, 31, 23, 125, 71, 238, 31, 87, 217, 245, 244, 232, 248, 187, 234, 62,
+    175, 179, 236, 232, 251, 245, 218, 185, 31, 23, 125, 71, 238, 31, 87, 217, 246, 116, 232, 248, 187, 234, 62, 175,
+    179, 249, 116, 251, 245, 218, 185, 31, 23, 125, 71, 238, 31, 87, 217, 252, 186, 0, 232, 248, 187, 234, 62, 175,
+    179, 253, 58, 0, 251, 245, 218, 185, 31, 23, 125, 71, 238, 31, 87, 217, 254, 157, 0, 232, 248, 187, 234, 62,
+    175, 179, 249, 244, 251, 245, 218, 185, 31, 23, 125, 71, 238, 31, 87, 217, 252, 250, 0, 232, 248, 187, 234, 62,
+    175, 179, 253, 122, 0, 251, 245, 218, 185, 31, 23, 125, 71, 238, 31, 87, 217, 254, 189, 0, 232, 248, 187, 234,
+    62, 175, 179, 253, 186, 0, 251, 245, 218, 185, 31, 23, 125, 71, 238, 31, 87, 217, 254, 221, 0, 232, 248, 46,
+    151, 225, 57, 20, 227, 223, 116, 109, 232, 244, 255, 15, 184, 72, 33, 216, 85, 200, 213, 63, 203, 192, 186, 233,
+    126, 19, 145, 130, 150, 86, 208, 83, 143, 125, 209, 183, 163, 212, 127, 194, 52, 164, 246, 29, 238, 68, 58, 88,
+    77, 65, 172, 174, 100, 22, 182, 12, 206, 57, 9, 114, 150, 234, 50, 222, 169, 91, 65, 87, 135, 223, 75, 143,
+    73, 52, 51, 83, 139, 72, 124, 198, 143, 139, 22, 28, 92, 165, 10, 186, 80, 158, 19, 145, 161, 106, 199, 33,
+    88, 85, 200, 218, 17, 97, 72, 225, 90, 221, 135, 123, 145, 62, 121, 9, 225, 253, 16, 178, 16, 101, 130, 144,
+    15, 207, 100, 105, 33, 243, 30, 49, 185, 234, 44, 245, 70, 195, 133, 171, 138, 185, 15, 150, 73, 42, 236, 152,
+    25, 227, 124, 243, 228, 101, 135, 222, 221, 135, 176, 178, 232, 180, 152, 30, 23, 24, 240, 233, 22, 19, 72, 214,
+    145, 73, 140, 15, 28, 138, 185, 16, 233, 105, 91, 30, 163, 198, 244, 21, 166, 138, 88, 62, 97, 45, 232, 197,
+    44, 171, 104, 22, 130, 200, 178, 206, 216, 78, 85, 180, 8, 39, 121, 217, 114, 87, 222, 113, 200, 205, 53, 92,
+    42, 64, 156, 160, 150, 237, 208, 252, 252, 46, 49, 225, 210, 45, 250, 15, 247, 52, 16, 101, 135, 147, 3, 14,
+    254, 66, 80, 171, 145, 101, 209, 105, 48, 60, 46, 49, 225, 210, 45, 219, 233, 250, 58, 0, 248, 46, 151, 225,
+    57, 31, 233, 254, 221, 0, 248, 46, 151, 225, 57, 31, 233, 254, 195, 83, 26, 25, 23, 48, 122, 138, 132, 105,
+    90, 87, 101, 109, 2, 181, 56, 251, 97, 210, 220, 39, 33, 36, 45, 12, 20, 180, 133, 106, 113, 87, 34, 229,
+    34, 131, 230, 63, 21, 170, 159, 27, 198, 157, 135, 123, 145, 80, 153, 230, 185, 15, 7, 39, 212, 200, 156, 46,
+    151, 172, 114, 44, 90, 76, 117, 8, 214, 28, 190, 225, 158, 151, 34, 53, 120, 34, 87, 70, 144, 249, 140, 151,
+    210, 225, 127, 100, 165, 118, 255, 207, 250, 255, 191, 27, 174, 44, 173, 164, 132, 219, 98, 144, 173, 160, 86, 21,
+    114, 44, 179, 72, 217, 30, 161, 26, 194, 174, 69, 247, 212, 62, 99, 37, 174, 70, 23, 50, 52, 135, 225, 91,
+    65, 135, 222, 198, 59, 14, 247, 33, 246, 44, 51, 83, 139, 72, 209, 125, 17, 194, 114, 41, 196, 239, 227, 120,
+    240, 140, 48, 141, 105, 201, 54, 51, 219, 160, 232, 251, 97, 210, 220, 39, 61, 0, 255, 15, 184, 72, 33, 216,
+    125, 176, 233, 110, 19, 158, 162, 174, 70, 168, 172, 42, 239, 15, 190, 151, 205, 32, 135, 204, 126, 43, 85, 62,
+    55, 141, 59, 14, 247, 34, 106, 9, 160, 178, 48, 172, 108, 56, 90, 184, 253, 119, 69, 106, 30, 33, 114, 242,
+    60, 110, 184, 178, 182, 146, 46, 251, 202, 182, 131, 210, 66, 190, 242, 38, 239, 180, 132, 107, 15, 27, 202, 177,
+    153, 51, 216, 119, 185, 9, 15, 170, 7, 204, 103, 6, 110, 60, 65, 75, 4, 107, 12, 159, 60, 201, 22, 133,
+    206, 164, 103, 15, 168, 98, 145, 227, 145, 146, 103, 255, 207, 255, 167, 176, 238, 226, 174, 71, 6, 107, 168, 65,
+    149, 210, 53, 86, 208, 103, 135, 224, 192, 155, 190, 195, 36, 172, 174, 100, 114, 251, 192, 60, 145, 194, 213, 194,
+    212, 140, 159, 15, 25, 239, 129, 101, 157, 176, 156, 246, 232, 232, 239, 114, 63, 178, 213, 96, 143, 149, 223, 96,
+    249, 143, 233, 135, 224, 196, 244, 249, 81, 219, 101, 109, 2, 181, 56, 239, 114, 63, 178, 213, 96, 143, 149, 223,
+    96, 249, 143, 233, 135, 224, 196, 245, 28, 190, 254, 232, 35, 72, 38, 141, 135, 142, 66, 11, 28, 46, 151, 172,
+    247, 192, 213, 126, 97, 243, 25, 225, 225, 48, 51, 132, 210, 17, 178, 51, 216, 119, 185, 19, 119, 216, 44, 140,
+    159, 246, 231, 168, 205, 113, 131, 97, 194, 213, 199, 165, 241, 8, 212, 60, 62, 255, 174, 230, 164, 35, 88, 108,
+    245, 70, 195, 108, 35, 84, 246, 30, 195, 196, 46, 151, 161, 6, 194, 30, 72, 149, 169, 27, 67, 234, 172, 90,
+    177, 200, 118, 8, 50, 125, 218, 140, 117, 19, 75, 140, 5, 96, 181, 35, 103, 174, 161, 106, 70, 198, 147, 18,
+    61, 28, 122, 53, 200, 70, 176, 133, 202, 225, 88, 100, 248, 120, 236, 59, 220, 137, 187, 237, 228, 157, 140, 9,
+    213, 112, 100, 112, 145, 174, 57, 9, 67, 151, 223, 183, 64, 252, 225, 228, 254, 131, 216, 120, 133, 210, 244, 32,
+    216, 67, 201, 18, 181, 34, 230, 8, 154, 92, 96, 43, 10, 185, 27, 61, 118, 250, 126, 142, 128, 251, 97, 210,
+    220, 39, 61, 0, 251, 97, 210, 220, 39, 35, 39, 106, 86, 220, 200, 185, 131, 212, 120, 222, 107, 10, 218, 14,
+    22, 174, 19, 42, 95, 75, 92, 246, 31, 45, 83, 24, 19, 119, 218, 70, 21, 136, 171, 145, 53, 4, 215, 80,
+    83, 43, 142, 22, 174, 55, 101, 253, 119, 34, 105, 224, 231, 14, 213, 34, 203, 59, 97, 57, 86, 208, 36, 82,
+    202, 50, 96, 104, 239, 105, 234, 17, 169, 127, 93, 204, 245, 8, 214, 24, 124, 147, 3, 40, 76, 234, 123, 15,
+    196, 216, 205, 66, 163, 72, 154, 135, 198, 2, 97, 219, 65, 87, 34, 86, 199, 132, 199, 153, 234, 17, 172, 42,
+    228, 75, 238, 214, 15, 152, 206, 20, 181, 177, 200, 202, 233, 84, 96, 102, 184, 196, 138, 185, 8, 177, 216, 124,
+    170, 9, 161, 132, 215, 105, 9, 103, 134, 54, 28, 45, 92, 93, 27, 69, 109, 6, 120, 126, 12, 15, 9, 62,
+    77, 72, 75, 88, 32, 167, 223, 43, 135, 204, 101, 116, 141, 123, 116, 232, 251, 113, 185, 31, 45, 157, 219, 160,
+    255, 15, 184, 72, 133, 244, 66, 80, 171, 145, 177, 141, 81, 139, 80, 195, 228, 148, 174, 193, 243, 21, 114, 62,
+    220, 110, 71, 203, 103, 118, 25, 187, 216, 84, 111, 151, 158, 195, 189, 200, 244, 190, 33, 26, 135, 140, 110, 71,
+    163, 117, 203, 4, 44, 141, 146, 60, 155, 5, 96, 131, 39, 253, 185, 24, 122, 234, 56, 90, 184, 217, 114, 101,
+    200, 82, 120, 193, 145, 38, 134, 251, 13, 218, 198, 4, 212, 43, 104, 48, 186, 94, 167, 176, 239, 114, 18, 31,
+    84, 15, 152, 209, 247, 141, 77, 9, 168, 38, 134, 110, 246, 11, 33, 98, 12, 172, 210, 248, 193, 236, 61, 134,
+    165, 183, 30, 29, 34, 195, 11, 53, 34, 158, 201, 207, 186, 68, 236, 114, 84, 196, 245, 8, 214, 27, 37, 67,
+    180, 132, 130, 48, 172, 108, 55, 216, 20, 208, 198, 57, 9, 194, 45, 43, 104, 42, 229, 96, 60, 88, 196, 246,
+    232, 232, 251, 97, 210, 220, 39, 61, 0, 246, 145, 203, 238, 54, 135, 200, 155, 4, 195, 182, 131, 237, 135, 75,
+    112, 156, 245, 21, 114, 60, 110, 184, 178, 182, 146, 60, 28, 159, 82, 52, 132, 107, 24, 234, 37, 116, 100, 194,
+    182, 131, 151, 222, 2, 109, 180, 58, 101, 113, 78, 42, 228, 83, 240, 195, 34, 212, 99, 176, 239, 114, 46, 179,
+    79, 11, 144, 72, 202, 235, 71, 42, 222, 8, 89, 28, 28, 99, 247, 237, 6, 76, 122, 54, 234, 38, 239, 198,
+    73, 42, 218, 7, 134, 74, 35, 52, 201, 44, 100, 35, 88, 97, 35, 66, 56, 86, 179, 241, 61, 135, 245, 97,
+    87, 34, 203, 52, 141, 145, 20, 226, 174, 68, 190, 245, 126, 12, 215, 81, 87, 34, 159, 134, 23, 76, 96, 77,
+    35, 90, 70, 208, 250, 171, 22, 172, 115, 216, 127, 235, 121, 161, 47, 189, 92, 62, 98, 230, 15, 81, 253, 31,
+    120, 171, 143, 149, 65, 52, 50, 135, 153, 51, 212, 96, 165, 149, 180, 5, 38, 130, 53, 135, 6, 107, 183, 64,
+    232, 248, 187, 208, 247, 190, 121, 147, 119, 222, 79, 64, 251, 218, 140, 43, 104, 42, 228, 124, 93, 232, 123, 223,
+    60, 201, 187, 239, 39, 168, 229, 247, 247, 65, 5, 189, 28, 62, 198, 195, 199, 34, 174, 68, 46, 87, 19, 145,
+    106, 15, 152, 206, 12, 223, 28, 143, 16, 120, 54, 25, 62, 121, 147, 216, 119, 185, 10, 212, 97, 94, 2, 200,
+    201, 255, 110, 71, 38, 134, 175, 99, 13, 212, 112, 181, 112, 126, 123, 60, 155, 15, 16, 185, 121, 28, 38, 49,
+    33, 26, 195, 39, 215, 55, 138, 79, 24, 34, 74, 82, 182, 157, 135, 176, 203, 125, 131, 230, 50, 124, 243, 36,
+    112, 181, 113, 87, 33, 147, 82, 61, 223, 42, 76, 143, 62, 225, 196, 45, 81, 96, 236, 42, 228, 97, 60, 28,
+    9, 90, 144, 236, 42, 228, 100, 251, 181, 24, 234, 38, 151, 24, 19, 69, 53, 86, 211, 176, 249, 62, 116, 21,
+    172, 164, 107, 188, 174, 67, 108, 39, 50, 21, 133, 92, 143, 9, 151, 157, 33, 247, 107, 117, 25, 65, 74, 86,
+    208, 32, 131, 132, 249, 171, 104, 18, 181, 121, 218, 230, 15, 110, 128, 252, 242, 124, 243, 39, 244, 30, 195, 45,
+    246, 15, 152, 201, 243, 204, 144, 178, 29, 133, 92, 140, 159, 118, 163, 3, 133, 171, 143, 119, 202, 147, 35, 207,
+    184, 113, 11, 84, 88, 59, 10, 185, 24, 79, 7, 29, 190, 159, 163, 243, 240, 83, 39, 111, 208, 124, 141, 14,
+    95, 120, 30, 10, 100, 236, 41, 197, 93, 100, 97, 242, 74, 87, 110, 223, 79, 209, 208, 251, 97, 210, 220, 39,
+    33, 26, 195, 250, 62, 241, 87, 232, 255, 15, 184, 154, 70, 176, 74, 21, 114, 60, 111, 53, 133, 109, 2, 181,
+    24, 147, 149, 43, 176, 124, 199, 219, 14, 150, 225, 57, 8, 214, 31, 209, 247, 138, 184, 249, 84, 19, 93, 135,
+    123, 145, 114, 145, 65, 243, 31, 138, 213, 79, 141, 227, 65, 182, 248, 147, 33, 33, 247, 107, 14, 95, 126, 163,
+    133, 171, 141, 139, 237, 130, 50, 135, 153, 86, 208, 77, 65, 53, 33, 26, 195, 36, 137, 12, 158, 151, 68, 165,
+    109, 5, 92, 138, 187, 195, 239, 165, 243, 72, 51, 216, 119, 113, 87, 34, 95, 122, 185, 73, 174, 162, 174, 70,
+    73, 174, 219, 200, 124, 199, 226, 181, 83, 227, 120, 208, 124, 169, 40, 143, 253, 178, 250, 49, 43, 92, 133, 145,
+    233, 101, 124, 96, 245, 11, 82, 50, 195, 229, 228, 83, 240, 96, 66, 202, 182, 129, 60, 63, 162, 42, 228, 84,
+    19, 79, 180, 246, 29, 238, 69, 63, 12, 46, 152, 192, 194, 153, 20, 226, 174, 71, 6, 107, 168, 70, 176, 205,
+    32, 83, 138, 185, 18, 251, 213, 250, 138, 185, 25, 62, 241, 87, 125, 228, 251, 164, 89, 245, 33, 100, 127, 157,
+    230, 135, 165, 149, 241, 131, 219, 160, 232, 254, 143, 188, 85, 199, 202, 160, 154, 232, 254, 143, 188, 85, 199, 202,
+    160, 154, 7, 231, 69, 173, 34, 230, 15, 80, 131, 245, 221, 77, 24, 16, 233, 97, 133, 99, 97, 194, 213, 197,
+    65, 50, 17, 172, 50, 194, 76, 174, 66, 106, 9, 161, 132, 215, 105, 236, 59, 184, 171, 145, 47, 189, 95, 168,
+    171, 144, 90, 161, 27, 34, 41, 199, 189, 107, 145, 240, 76, 96, 120, 57, 121, 118, 145, 194, 213, 194, 212, 137,
+    164, 163, 142, 70, 79, 141, 245, 105, 8, 214, 25, 225, 52, 145, 158, 55, 170, 48, 173, 160, 86, 21, 114, 60,
+    65, 63, 177, 236, 59, 184, 171, 145, 193, 154, 234, 42, 228, 67, 165, 130, 200, 203, 15, 38, 193, 243, 207, 168,
+    240, 145, 10, 98, 66, 181, 151, 36, 165, 109, 6, 78, 211, 81, 190, 84, 174, 193, 224, 108, 98, 233, 180, 132,
+    27, 24, 213, 24, 181, 12, 176, 243, 188, 30, 221, 0, 232, 254, 143, 188, 85, 199, 202, 160, 154, 232, 239, 114,
+    33, 210, 195, 39, 212, 200, 167, 8, 193, 60, 70, 251, 80, 45, 97, 115, 7, 168, 241, 135, 203, 201, 176, 241,
+    200, 240, 145, 10, 98, 66, 53, 134, 73, 189, 43, 176, 149, 209, 167, 176, 251, 79, 46, 214, 21, 115, 175, 81,
+    87, 35, 100, 244, 117, 45, 67, 69, 244, 100, 112, 156, 138, 112, 254, 140, 105, 15, 195, 13, 33, 38, 66, 53,
+    135, 4, 218, 122, 137, 223, 77, 12, 210, 182, 129, 104, 93, 37, 189, 212, 60, 18, 195, 121, 54, 10, 194, 95,
+    82, 41, 117, 61, 135, 245, 175, 116, 141, 138, 100, 115, 223, 2, 230, 15, 81, 194, 213, 195, 182, 57, 21, 114,
+    44, 179, 72, 212, 37, 247, 107, 72, 124, 197, 92, 138, 126, 24, 65, 76, 174, 173, 160, 229, 247, 128, 82, 39,
+    183, 64, 232, 247, 173, 114, 62, 9, 140, 116, 255, 15, 184, 45, 70, 5, 92, 141, 33, 26, 195, 15, 227, 199,
+    33, 243, 30, 245, 174, 71, 193, 49, 142, 161, 4, 236, 153, 43, 239, 33, 32, 160, 225, 106, 227, 84, 143, 24,
+    35, 60, 59, 196, 132, 107, 11, 174, 151, 25, 21, 194, 182, 147, 216, 123, 8, 57, 29, 169, 93, 133, 140, 249,
+    18, 181, 33, 138, 64, 171, 144, 90, 161, 27, 35, 212, 120, 222, 133, 92, 136, 57, 29, 169, 93, 150, 104, 97,
+    223, 204, 140, 241, 188, 209, 131, 110, 163, 252, 239, 166, 152, 86, 208, 109, 119, 98, 50, 76, 98, 66, 53, 134,
+    201, 177, 142, 30, 60, 246, 31, 137, 125, 176, 66, 176, 157, 214, 164, 22, 209, 52, 33, 88, 73, 133, 125, 228,
+    89, 103, 45, 230, 85, 218, 122, 142, 46, 184, 33, 234, 230, 36, 43, 12, 146, 119, 76, 4, 170, 88, 34, 251,
+    196, 114, 54, 73, 161, 146, 68, 114, 173, 160, 240, 153, 121, 217, 50, 243, 35, 53, 198, 13, 135, 11, 87, 20,
+    114, 184, 63, 174, 235, 182, 165, 171, 176, 239, 114, 18, 181, 121, 218, 230, 8, 89, 8, 53, 95, 152, 124, 198,
+    241, 161, 108, 185, 8, 214, 15, 26, 35, 47, 236, 108, 50, 186, 60, 246, 232, 252, 233, 49, 231, 244, 29, 238,
+    68, 28, 142, 212, 174, 203, 52, 22, 70, 29, 252, 171, 104, 51, 198, 243, 70, 13, 187, 125, 63, 71, 231, 131,
+    84, 99, 244, 29, 238, 96, 251, 164, 32, 193, 170, 48, 18, 214, 131, 50, 108, 41, 197, 92, 140, 159, 120, 171,
+    190, 242, 123, 125, 63, 71, 64, 251, 97, 210, 220, 39, 61, 0, 247, 187, 82, 182, 234, 218, 9, 125, 234, 225,
+    216, 125, 176, 233, 110, 19, 158, 162, 174, 68, 212, 19, 67, 84, 86, 164, 86, 144, 181, 35, 11, 232, 227, 144,
+    88, 198, 156, 246, 29, 238, 70, 79, 188, 85, 223, 121, 35, 14, 250, 200, 86, 21, 114, 44, 179, 72, 217, 30,
+    161, 24, 46, 187, 60, 171, 104, 38, 163, 124, 171, 120, 33, 243, 19, 78, 196, 35, 88, 105, 132, 153, 236, 59,
+    184, 171, 144, 82, 107, 168, 65, 171, 216, 205, 15, 8, 222, 71, 136, 70, 202, 225, 140, 214, 12, 143, 6, 184,
+    37, 131, 213, 204, 9, 167, 131, 156, 59, 84, 245, 11, 82, 51, 76, 146, 196, 84, 37, 150, 149, 217, 48, 57,
+    52, 56, 56, 201, 245, 86, 211, 176, 239, 114, 37, 108, 120, 76, 121, 144, 144, 71, 141, 231, 145, 194, 213, 197,
+    63, 13, 57, 190, 60, 141, 29, 91, 64, 158, 31, 122, 21, 114, 176, 44, 156, 246, 232, 232, 252, 86, 170, 124,
+    111, 26, 15, 181, 27, 200, 70, 176, 239, 27, 205, 116, 239, 114, 63, 21, 170, 159, 27, 198, 131, 237, 70, 242,
+    17, 172, 59, 198, 243, 65, 100, 32, 157, 83, 24, 30, 55, 161, 193, 198, 63, 122, 109, 179, 171, 81, 176, 240,
+    141, 231, 176, 254, 173, 43, 99, 212, 85, 200, 74, 213, 231, 107, 152, 33, 100, 100, 152, 212, 35, 88, 109, 15,
+    153, 153, 87, 100, 199, 97, 236, 40, 227, 6, 6, 21, 136, 141, 218, 66, 97, 219, 64, 236, 68, 173, 143, 80,
+    141, 97, 39, 209, 132, 192, 177, 159, 50, 18, 8, 72, 132, 109, 13, 130, 176, 70, 15, 177, 111, 223, 147, 182,
+    71, 106, 19, 178, 100, 70, 111, 3, 104, 95, 73, 68, 100, 237, 59, 226, 146, 149, 218, 123, 14, 247, 34, 114,
+    45, 65, 243, 25, 193, 155, 140, 159, 60, 201, 24, 86, 208, 196, 245, 8, 214, 18, 249, 208, 240, 153, 121, 210,
+    31, 118, 176, 215, 121, 92, 134, 216, 78, 103, 176, 254, 144, 165, 173, 142, 68, 210, 103, 152, 210, 9, 161, 150,
+    243, 79, 169, 137, 9, 34, 174, 121, 5, 168, 199, 110, 128, 232, 251, 97, 210, 220, 39, 61, 0, 239, 117, 145,
+    53, 6, 178, 184, 124, 199, 219, 14, 150, 225, 57, 11, 35, 10, 198, 195, 133, 171, 132, 26, 175, 204, 62, 97,
+    241, 96, 141, 96, 199, 129, 55, 125, 167, 176, 238, 226, 174, 65, 73, 174, 162, 174, 71, 226, 181, 83, 227, 120,
+    208, 126, 47, 52, 63, 190, 121, 174, 68, 77, 35, 90, 71, 11, 87, 11, 82, 50, 194, 76, 174, 66, 13, 186,
+    142, 46, 180, 122, 132, 107, 15, 24, 220, 137, 93, 25, 52, 61, 135, 244, 195, 240, 96, 120, 127, 153, 144, 150,
+    120, 97, 87, 35, 133, 107, 63, 18, 31, 48, 197, 35, 199, 35, 198, 242, 172, 102, 76, 245, 8, 214, 8, 61,
+    43, 82, 104, 70, 19, 93, 182, 121, 161, 101, 157, 176, 156, 200, 65, 225, 25, 140, 4, 102, 125, 219, 37, 109,
+    2, 48, 223, 108, 159, 85, 109, 5, 63, 12, 51, 51, 75, 233, 49, 219, 160, 232, 252, 86, 170, 124, 111, 26,
+    15, 197, 230, 186, 0, 239, 114, 63, 21, 170, 159, 27, 198, 131, 241, 121, 161, 253, 243, 205, 114, 33, 100, 32,
+    201, 225, 140, 77, 59, 16, 249, 138, 185, 25, 62, 186, 238, 203, 92, 246, 29, 238, 65, 249, 209, 133, 120, 11,
+    33, 44, 240, 198, 195, 133, 171, 141, 146, 161, 94, 151, 32, 117, 241, 131, 172, 245, 8, 214, 10, 210, 182, 61,
+    69, 92, 137, 200, 181, 7, 204, 108, 155, 24, 8, 214, 10, 222, 66, 200, 218, 31, 85, 98, 213, 216, 123, 247,
+    154, 125, 76, 72, 253, 119, 59, 145, 178, 82, 150, 172, 115, 212, 35, 88, 108, 243, 73, 129, 195, 199, 147, 18,
+    14, 121, 174, 74, 90, 177, 200, 151, 138, 26, 162, 224, 120, 55, 86, 176, 171, 145, 147, 238, 212, 98, 123, 15,
+    97, 227, 124, 96, 210, 176, 240, 233, 22, 22, 89, 219, 9, 204, 140, 159, 93, 119, 101, 174, 67, 61, 46, 70,
+    66, 53, 129, 244, 90, 167, 183, 64, 232, 251, 97, 210, 220, 39, 61, 0, 251, 97, 210, 220, 39, 35, 39, 106,
+    86, 220, 200, 151, 222, 175, 194, 69, 133, 204, 30, 162, 174, 71, 141, 215, 22, 86, 210, 71, 131, 147, 234, 173,
+    160, 213, 224, 137, 217, 50, 54, 15, 189, 14, 22, 174, 39, 84, 198, 6, 201, 30, 100, 35, 88, 105, 4, 176,
+    157, 147, 35, 33, 54, 216, 164, 43, 105, 216, 119, 130, 100, 97, 88, 138, 185, 18, 182, 60, 38, 60, 207, 81,
+    87, 43, 3, 5, 61, 25, 27, 67, 250, 91, 43, 104, 38, 233, 99, 216, 119, 185, 9, 175, 133, 70, 200, 133,
+    145, 56, 93, 47, 88, 228, 126, 187, 169, 163, 29, 69, 93, 247, 210, 226, 174, 69, 247, 212, 62, 98, 174, 69,
+    63, 12, 22, 68, 210, 227, 3, 104, 50, 90, 187, 116, 232, 251, 97, 210, 220, 39, 33, 26, 195, 250, 60, 91,
+    160, 246, 161, 87, 33, 90, 140, 73, 202, 149, 216, 62, 99, 237, 135, 75, 112, 156, 132, 107, 15, 232, 241, 97,
+    242, 168, 38, 186, 138, 185, 5, 140, 105, 200, 217, 114, 243, 35, 125, 130, 104, 138, 221, 135, 119, 21, 114, 10,
+    77, 117, 31, 209, 226, 195, 229, 80, 77, 9, 168, 53, 149, 204, 138, 126, 18, 44, 42, 228, 100, 154, 237, 188,
+    135, 204, 126, 43, 85, 62, 55, 141, 7, 202, 146, 136, 255, 219, 47, 163, 18, 181, 207, 81, 233, 101, 124, 96,
+    138, 188, 62, 250, 92, 85, 200, 209, 54, 145, 224, 215, 4, 176, 241, 186, 226, 202, 218, 79, 97, 222, 228, 43,
+    81, 137, 57, 82, 187, 5, 145, 227, 121, 231, 168, 225, 106, 227, 36, 137, 8, 214, 27, 27, 25, 168, 84, 105,
+    26, 191, 165, 109, 2, 176, 76, 96, 89, 96, 229, 74, 237, 61, 135, 176, 154, 130, 104, 107, 188, 174, 74, 140,
+    54, 194, 115, 33, 6, 87, 38, 51, 223, 2, 183, 98, 29, 130, 15, 74, 248, 86, 12, 82, 60, 115, 219, 160,
+    232, 251, 97, 210, 220, 39, 61, 0, 251, 97, 210, 220, 39, 34, 10, 101, 115, 33, 106, 68, 190, 245, 115, 12,
+    40, 198, 170, 219, 200, 185, 131, 212, 101, 190, 53, 86, 74, 86, 208, 37, 10, 185, 19, 73, 71, 28, 140, 159,
+    120, 171, 190, 242, 123, 14, 247, 35, 39, 222, 42, 239, 188, 145, 103, 213, 89, 40, 200, 171, 144, 144, 80, 112,
+    181, 112, 181, 33, 139, 229, 132, 153, 92, 147, 1, 35, 43, 173, 28, 171, 120, 63, 249, 255, 95, 247, 73, 140,
+    12, 159, 27, 234, 211, 212, 105, 8, 214, 19, 71, 105, 234, 17, 172, 16, 89, 245, 54, 16, 239, 159, 97, 222,
+    228, 120, 221, 113, 101, 109, 1, 249, 239, 99, 33, 24, 34, 192, 124, 194, 111, 87, 120, 90, 228, 35, 88, 93,
+    102, 158, 57, 237, 208, 232, 247, 190, 241, 87, 125, 228, 143, 236, 254, 60, 115, 208, 255, 15, 184, 154, 59, 5,
+    106, 113, 87, 35, 39, 222, 42, 239, 188, 145, 135, 241, 227, 158, 163, 139, 152, 34, 174, 66, 86, 175, 59, 92,
+    193, 11, 34, 95, 7, 86, 8, 214, 16, 103, 99, 149, 103, 190, 59, 15, 193, 35, 198, 8, 207, 14, 241, 32,
+    229, 119, 25, 187, 212, 209, 218, 122, 132, 107, 10, 185, 23, 93, 46, 50, 43, 133, 109, 2, 200, 75, 60, 49,
+    176, 225, 106, 225, 225, 146, 136, 202, 232, 214, 56, 83, 19, 216, 126, 37, 246, 193, 28, 34, 208, 118, 30, 11,
+    101, 115, 61, 68, 190, 164, 65, 75, 43, 104, 44, 249, 111, 169, 106, 158, 161, 234, 230, 36, 100, 237, 232, 196,
+    171, 104, 21, 133, 247, 155, 155, 10, 118, 51, 216, 124, 142, 91, 194, 215, 35, 99, 18, 236, 199, 2, 105, 26,
+    195, 132, 172, 175, 158, 248, 12, 82, 5, 92, 130, 213, 8, 217, 30, 221, 0, 232, 248, 156, 142, 212, 174, 221,
+    0, 239, 114, 32, 228, 118, 165, 118, 9, 5, 3, 230, 42, 228, 100, 251, 197, 93, 247, 146, 22, 66, 11, 239,
+    224, 62, 97, 50, 165, 244, 181, 207, 97, 222, 228, 65, 200, 237, 74, 236, 179, 66, 86, 164, 120, 55, 86, 176,
+    65, 73, 140, 11, 25, 243, 212, 103, 8, 212, 185, 38, 49, 200, 131, 156, 25, 186, 182, 130, 230, 1, 213, 23,
+    1, 216, 127, 125, 235, 14, 254, 122, 132, 24, 119, 242, 31, 49, 147, 182, 70, 24, 59, 11, 152, 25, 166, 71,
+    176, 248, 38, 49, 194, 115, 32, 252, 232, 181, 133, 56, 171, 144, 82, 104, 35, 88, 112, 102, 186, 140, 20, 178,
+    182, 130, 156, 122, 72, 87, 222, 70, 79, 188, 84, 59, 235, 33, 26, 193, 243, 205, 114, 51, 216, 119, 185, 18,
+    251, 181, 131, 230, 53, 223, 60, 240, 108, 50, 118, 244, 98, 82, 149, 218, 66, 53, 133, 92, 135, 203, 36, 149,
+    118, 76, 8, 86, 209, 91, 65, 181, 221, 136, 205, 113, 137, 21, 114, 17, 99, 183, 64, 252, 233, 49, 231, 244,
+    29, 238, 68, 28, 142, 212, 174, 203, 52, 51, 132, 106, 92, 147, 24, 228, 65, 206, 12, 220, 200, 254, 251, 214,
+    29, 252, 246, 250, 126, 142, 128, 252, 145, 105, 91, 65, 241, 119, 215, 160, 239, 114, 56, 69, 165, 109, 4, 59,
+    234, 22, 66, 15, 215, 117, 52, 39, 100, 200, 142, 22, 174, 50, 125, 115, 120, 164, 241, 130, 36, 165, 43, 104,
+    17, 172, 37, 243, 161, 133, 210, 244, 173, 167, 97, 236, 56, 125, 81, 132, 173, 72, 74, 8, 39, 84, 198, 5,
+    39, 140, 30, 163, 55, 203, 121, 54, 14, 194, 230, 6, 19, 106, 125, 135, 23, 92, 17, 188, 171, 104, 46, 96,
+    106, 254, 23, 4, 93, 234, 118, 122, 236, 63, 4, 209, 63, 101, 99, 33, 26, 193, 91, 55, 141, 82, 149, 217,
+    48, 54, 77, 118, 190, 13, 72, 72, 33, 138, 86, 57, 9, 16, 141, 161, 176, 118, 8, 37, 108, 69, 39, 140,
+    30, 195, 216, 97, 35, 66, 56, 86, 179, 240, 31, 60, 204, 72, 65, 233, 79, 1, 243, 21, 114, 50, 125, 226,
+    174, 251, 201, 26, 36, 88, 180, 135, 222, 165, 108, 123, 116, 252, 233, 49, 231, 244, 30, 195, 135, 213, 24, 74,
+    212, 135, 97, 115, 3, 9, 181, 62, 195, 121, 86, 208, 92, 192, 187, 212, 236, 245, 219, 233, 250, 58, 0, 247,
+    190, 241, 87, 125, 228, 143, 130, 99, 29, 0, 255, 15, 184, 45, 70, 2, 12, 59, 104, 46, 152, 199, 9, 200,
+    225, 106, 227, 103, 194, 205, 205, 135, 14, 246, 44, 51, 195, 188, 72, 70, 176, 217, 226, 161, 22, 164, 62, 96,
+    205, 19, 169, 176, 255, 59, 219, 67, 35, 10, 202, 218, 10, 185, 28, 38, 49, 61, 135, 123, 144, 139, 2, 117,
+    56, 196, 140, 209, 90, 177, 200, 124, 195, 226, 195, 195, 191, 153, 8, 214, 25, 239, 12, 181, 188, 17, 179, 225,
+    102, 253, 135, 123, 145, 116, 198, 6, 78, 212, 173, 185, 145, 78, 42, 228, 75, 239, 87, 234, 48, 82, 202, 218,
+    11, 19, 177, 128, 173, 78, 42, 228, 100, 251, 197, 93, 247, 147, 219, 160, 232, 247, 190, 241, 87, 125, 228, 143,
+    130, 99, 29, 0, 239, 114, 46, 152, 199, 9, 200, 45, 105, 23, 48, 122, 143, 16, 141, 149, 213, 180, 10, 212,
+    226, 184, 112, 186, 236, 241, 72, 212, 33, 223, 89, 236, 59, 184, 171, 144, 82, 107, 168, 65, 103, 120, 24, 41,
+    105, 20, 226, 174, 67, 26, 225, 227, 200, 203, 15, 38, 186, 141, 82, 60, 155, 15, 119, 182, 245, 119, 133, 253,
+    141, 135, 226, 98, 93, 152, 224, 127, 118, 199, 61, 189, 195, 187, 138, 185, 28, 25, 174, 163, 9, 26, 17, 103,
+    223, 198, 8, 179, 188, 72, 125, 139, 5, 106, 112, 131, 39, 222, 42, 29, 245, 236, 59, 220, 132, 130, 129, 100,
+    126, 187, 169, 174, 163, 133, 171, 135, 108, 114, 42, 228, 75, 231, 66, 251, 234, 31, 48, 127, 93, 215, 109, 75,
+    80, 77, 236, 190, 48, 123, 116, 232, 247, 190, 241, 87, 125, 228, 143, 249, 53, 195, 199, 145, 239, 195, 201, 174,
+    128, 255, 15, 184, 205, 90, 195, 151, 222, 36, 227, 48, 172, 16, 78, 169, 140, 15, 27, 208, 202, 22, 151, 36,
+    192, 135, 125, 70, 107, 140, 27, 14, 22, 174, 36, 199, 163, 18, 17, 172, 24, 215, 15, 30, 85, 180, 7, 245,
+    221, 118, 212, 181, 118, 29, 238, 66, 44, 5, 145, 147, 190, 58, 141, 81, 90, 145, 88, 216, 120, 228, 88, 217,
+    114, 74, 54, 25, 97, 117, 74, 35, 39, 106, 135, 192, 158, 102, 142, 179, 216, 123, 211, 198, 12, 132, 130, 24,
+    165, 99, 144, 241, 162, 50, 254, 198, 221, 66, 53, 130, 181, 151, 36, 167, 129, 133, 210, 245, 35, 198, 21, 188,
+    136, 191, 53, 125, 87, 36, 198, 57, 236, 61, 134, 104, 173, 66, 251, 234, 55, 107, 24, 156, 158, 12, 138, 185,
+    11, 174, 207, 20, 141, 145, 15, 152, 171, 172, 138, 57, 93, 159, 15, 162, 228, 152, 23, 223, 192, 205, 224, 100,
+    251, 197, 93, 247, 146, 31, 99, 9, 74, 237, 61, 186, 0, 252, 237, 11, 232, 254, 131, 216, 73, 143, 70, 2,
+    200, 193, 206, 134, 237, 135, 203, 201, 176, 70, 176, 195, 233, 161, 176, 86, 237, 208, 254, 143, 22, 31, 42, 130,
+    107, 160, 254, 143, 22, 31, 42, 130, 104, 120, 132, 108, 174, 100, 62, 121, 140, 225, 245, 31, 108, 58, 91, 132,
+    231, 168, 193, 75, 43, 104, 21, 169, 198, 87, 72, 213, 91, 65, 6, 86, 197, 169, 83, 1, 138, 233, 127, 15,
+    23, 119, 180, 132, 107, 3, 232, 181, 110, 152, 199, 34, 156, 85, 200, 221, 151, 209, 137, 90, 231, 176, 239, 114,
+    38, 160, 154, 11, 35, 10, 198, 195, 133, 171, 142, 14, 49, 251, 252, 157, 168, 93, 245, 51, 212, 20, 202, 227,
+    133, 171, 133, 169, 15, 195, 13, 217, 127, 93, 200, 202, 233, 9, 149, 24, 236, 61, 247, 92, 90, 11, 13, 176,
+    156, 133, 97, 202, 69, 167, 168, 70, 176, 171, 145, 57, 22, 160, 249, 140, 224, 205, 241, 200, 203, 122, 26, 66,
+    76, 140, 215, 24, 145, 87, 33, 22, 59, 116, 232, 254, 143, 22, 31, 42, 130, 107, 160, 247, 187, 82, 182, 234,
+    218, 4, 195, 182, 131, 250, 60, 88, 124, 170, 9, 174, 163, 151, 220, 51, 210, 228, 69, 92, 137, 222, 33, 247,
+    107, 43, 105, 35, 193, 201, 245, 35, 87, 130, 19, 36, 177, 213, 114, 236, 63, 246, 203, 232, 196, 173, 114, 60,
+    110, 184, 178, 182, 146, 38, 146, 40, 83, 132, 219, 98, 145, 212, 35, 88, 77, 111, 98, 213, 35, 132, 199, 144,
+    240, 60, 47, 146, 19, 14, 218, 10, 185, 18, 182, 60, 38, 60, 207, 97, 222, 228, 77, 65, 52, 22, 68, 221,
+    44, 108, 60, 114, 41, 49, 128, 233, 228, 84, 19, 61, 70, 208, 254, 150, 202, 218, 4, 18, 96, 177, 25, 35,
+    62, 220, 246, 232, 232, 254, 143, 22, 8, 214, 31, 250, 125, 176, 173, 208, 255, 15, 184, 72, 133, 244, 66, 80,
+    171, 144, 173, 70, 36, 229, 74, 236, 31, 49, 253, 30, 44, 62, 85, 4, 208, 70, 176, 255, 211, 237, 133, 97,
+    242, 168, 38, 187, 14, 238, 42, 228, 20, 154, 24, 83, 33, 6, 203, 149, 111, 6, 127, 93, 200, 201, 107, 145,
+    178, 71, 158, 161, 91, 210, 210, 182, 131, 133, 171, 133, 169, 15, 177, 97, 164, 18, 194, 118, 76, 140, 132, 107,
+    13, 176, 156, 233, 15, 187, 88, 31, 215, 117, 219, 82, 213, 216, 119, 185, 10, 212, 98, 78, 84, 174, 193, 100,
+    32, 241, 130, 214, 15, 152, 131, 43, 98, 212, 169, 129, 146, 99, 80, 141, 97, 87, 35, 11, 232, 225, 88, 204,
+    143, 16, 251, 233, 122, 30, 57, 12, 82, 60, 114, 38, 183, 177, 106, 158, 221, 0, 232, 252, 86, 170, 124, 111,
+    26, 15, 197, 35, 207, 64, 239, 114, 50, 90, 228, 108, 145, 228, 44, 132, 27, 20, 200, 231, 190, 3, 164, 172,
+    132, 213, 108, 42, 228, 83, 240, 222, 233, 30, 55, 154, 193, 236, 63, 182, 243, 113, 164, 36, 200, 70, 176, 224,
+    227, 31, 191, 84, 86, 164, 86, 54, 25, 225, 248, 48, 60, 27, 72, 202, 10, 81, 8, 56, 56, 201, 245, 86,
+    208, 37, 106, 243, 181, 204, 30, 195, 216, 127, 239, 229, 246, 138, 190, 250, 248, 22, 133, 244, 70, 73, 89, 92,
+    200, 229, 247, 128, 121, 61, 70, 14, 116, 29, 130, 13, 146, 60, 143, 5, 178, 184, 73, 11, 152, 205, 227, 71,
+    170, 45, 216, 127, 201, 72, 241, 207, 80, 140, 31, 98, 195, 108, 35, 81, 129, 225, 254, 97, 56, 69, 169, 8,
+    24, 240, 54, 194, 53, 117, 27, 24, 204, 229, 88, 228, 74, 254, 198, 195, 55, 128, 130, 85, 180, 193, 25, 225,
+    248, 49, 216, 125, 171, 22, 145, 149, 214, 54, 25, 195, 234, 42, 228, 84, 19, 61, 66, 53, 133, 92, 137, 125,
+    218, 193, 243, 24, 77, 244, 189, 24, 7, 43, 185, 145, 156, 62, 161, 5, 150, 105, 26, 134, 216, 78, 116, 135,
+    221, 173, 219, 160, 252, 237, 11, 232, 254, 131, 189, 204, 31, 116, 132, 31, 251, 249, 125, 162, 175, 190, 190, 5,
+    161, 125, 16, 236, 42, 228, 108, 145, 228, 120, 45, 149, 251, 125, 63, 71, 231, 182, 17, 171, 244, 29, 238, 96,
+    251, 164, 35, 7, 216, 176, 219, 8, 212, 96, 49, 72, 21, 114, 54, 92, 153, 114, 30, 11, 101, 126, 163, 99,
+    25, 156, 171, 28, 137, 95, 216, 216, 102, 240, 16, 74, 182, 152, 35, 60, 63, 6, 59, 125, 63, 71, 64, 255,
+    211, 237, 133, 110, 128, 255, 211, 237, 133, 97, 242, 168, 38, 133, 204, 16, 178, 16, 126, 187, 169, 160, 197, 116,
+    191, 135, 139, 187, 216, 97, 24, 246, 31, 7, 222, 76, 142, 22, 174, 51, 135, 106, 27, 60, 101, 115, 33, 26,
+    195, 131, 140, 126, 250, 45, 99, 97, 162, 69, 139, 72, 194, 177, 21, 114, 38, 160, 154, 236, 62, 38, 86, 197,
+    170, 70, 144, 77, 2, 153, 92, 61, 92, 192, 225, 35, 92, 115, 212, 35, 88, 85, 200, 217, 50, 33, 243, 24,
+    92, 200, 204, 156, 72, 131, 132, 249, 155, 118, 29, 238, 68, 212, 19, 67, 5, 45, 33, 158, 42, 252, 36, 88,
+    83, 240, 145, 97, 171, 193, 16, 101, 108, 90, 149, 48, 18, 10, 79, 110, 128, 232, 255, 211, 237, 133, 110, 128,
+    255, 211, 237, 133, 97, 242, 168, 38, 131, 236, 90, 70, 251, 4, 144, 180, 19, 109, 161, 211, 43, 153, 21, 114,
+    55, 101, 244, 98, 86, 185, 25, 38, 187, 111, 61, 135, 119, 21, 114, 10, 77, 117, 21, 114, 52, 132, 107, 9,
+    164, 178, 239, 168, 154, 70, 180, 132, 144, 130, 140, 210, 106, 90, 133, 56, 171, 145, 57, 93, 223, 30, 233, 9,
+    87, 193, 165, 200, 78, 203, 11, 93, 135, 119, 21, 114, 56, 51, 93, 69, 92, 141, 81, 88, 22, 168, 70, 200,
+    138, 113, 248, 173, 84, 248, 222, 52, 31, 42, 74, 35, 255, 108, 190, 140, 74, 215, 35, 131, 140, 159, 83, 34,
+    107, 123, 22, 169, 8, 214, 30, 150, 86, 158, 36, 38, 23, 201, 28, 45, 92, 45, 72, 194, 53, 167, 36, 216,
+    216, 105, 15, 187, 90, 66, 53, 132, 210, 81, 199, 35, 198, 235, 139, 43, 105, 61, 186, 0, 232, 249, 82, 89,
+    119, 215, 160, 239, 114, 55, 101, 244, 98, 86, 185, 19, 73, 101, 223, 80, 178, 17, 130, 235, 180, 25, 149, 244,
+    68, 212, 111, 149, 111, 4, 112, 181, 113, 79, 193, 133, 109, 7, 140, 20, 202, 230, 36, 35, 88, 32, 212, 210,
+    229, 190, 31, 121, 199, 35, 84, 86, 164, 86, 54, 25, 169, 197, 187, 15, 181, 25, 140, 72, 178, 206, 216, 78,
+    85, 180, 21, 114, 39, 43, 187, 227, 221, 35, 84, 156, 158, 130, 53, 134, 79, 135, 137, 9, 103, 134, 21, 114,
+    15, 206, 140, 43, 199, 97, 222, 228, 37, 106, 243, 181, 204, 16, 178, 63, 93, 212, 208, 103, 227, 168, 241, 189,
+    14, 95, 113, 146, 48, 93, 83, 69, 98, 42, 228, 67, 164, 7, 204, 85, 200, 202, 31, 139, 7, 97, 162, 106,
+    69, 147, 153, 237, 208, 232, 255, 211, 237, 133, 110, 128, 247, 187, 82, 182, 234, 218, 6, 120, 171, 135, 97, 255,
+    167, 219, 10, 195, 229, 80, 77, 117, 21, 114, 11, 122, 88, 118, 212, 181, 15, 7, 39, 212, 200, 213, 224, 132,
+    201, 44, 117, 92, 187, 15, 149, 111, 98, 213, 35, 132, 199, 144, 172, 52, 135, 223, 105, 234, 44, 179, 150, 243,
+    42, 218, 12, 28, 171, 120, 50, 17, 172, 18, 101, 116, 109, 75, 84, 246, 29, 220, 85, 200, 224, 205, 117, 8,
+    60, 59, 249, 154, 120, 35, 36, 172, 174, 100, 114, 251, 192, 74, 162, 212, 174, 221, 66, 212, 142, 21, 172, 252,
+    72, 178, 206, 216, 78, 85, 180, 30, 12, 212, 156, 96, 196, 132, 107, 13, 217, 125, 24, 149, 174, 70, 166, 50,
+    186, 53, 150, 79, 110, 128, 232, 255, 211, 237, 133, 96, 141, 97, 239, 193, 244, 112, 141, 110, 128, 246, 161, 87,
+    33, 90, 140, 73, 202, 149, 216, 62, 99, 255, 79, 182, 21, 130, 53, 135, 191, 7, 209, 194, 53, 135, 202, 160,
+    154, 158, 163, 255, 79, 182, 21, 133, 111, 13, 33, 158, 42, 226, 159, 132, 139, 15, 232, 251, 197, 92, 124, 170,
+    9, 174, 195, 223, 131, 232, 225, 26, 195, 229, 80, 77, 11, 148, 180, 142, 12, 208, 86, 167, 8, 32, 202, 216,
+    181, 42, 96, 36, 20, 236, 59, 220, 140, 158, 24, 192, 89, 24, 95, 71, 28, 245, 28, 45, 92, 32, 213, 126,
+    97, 243, 19, 91, 216, 181, 72, 70, 176, 195, 228, 152, 145, 156, 31, 215, 114, 212, 173, 160, 98, 145, 227, 145,
+    146, 102, 100, 35, 88, 77, 223, 105, 237, 208, 232, 247, 224, 250, 56, 70, 176, 249, 84, 19, 93, 0, 247, 224,
+    250, 56, 70, 176, 249, 84, 19, 65, 100, 32, 202, 233, 26, 171, 104, 32, 202, 216, 181, 42, 96, 67, 165, 187,
+    14, 240, 76, 132, 140, 174, 31, 209, 139, 148, 183, 80, 141, 97, 87, 34, 86, 199, 132, 199, 153, 9, 4, 89,
+    234, 141, 135, 11, 87, 25, 225, 248, 48, 60, 27, 79, 97, 222, 228, 37, 106, 243, 181, 204, 16, 178, 54, 41,
+    145, 207, 124, 117, 28, 45, 92, 85, 200, 124, 178, 73, 87, 100, 192, 151, 221, 172, 31, 49, 149, 215, 22, 130,
+    195, 108, 39, 42, 218, 7, 129, 103, 210, 71, 132, 143, 42, 218, 118, 29, 238, 68, 212, 19, 67, 39, 106, 86,
+    220, 200, 41, 52, 41, 248, 72, 176, 171, 145, 227, 121, 83, 3, 100, 138, 144, 249, 138, 126, 27, 183, 64, 232,
+    251, 93, 252, 205, 60, 30, 128, 255, 147, 53, 131, 96, 156, 39, 33, 138, 64, 171, 145, 187, 47, 163, 18, 181,
+    207, 81, 87, 89, 19, 188, 109, 11, 42, 218, 99, 145, 132, 141, 8, 240, 239, 230, 105, 224, 135, 207, 51, 18,
+    16, 93, 61, 22, 25, 188, 15, 14, 254, 70, 31, 209, 137, 236, 62, 87, 56, 244, 100, 36, 17, 178, 101, 228,
+    216, 112, 181, 112, 153, 37, 142, 171, 144, 163, 243, 169, 234, 51, 92, 169, 93, 186, 132, 107, 4, 25, 63, 237,
+    200, 201, 51, 255, 231, 255, 193, 32, 160, 226, 230, 8, 154, 222, 197, 170, 68, 214, 246, 228, 35, 88, 74, 236,
+    50, 124, 243, 39, 176, 249, 62, 116, 53, 222, 87, 33, 182, 19, 153, 10, 194, 174, 71, 132, 203, 206, 144, 251,
+    181, 186, 132, 107, 10, 185, 19, 145, 106, 15, 152, 99, 192, 240, 239, 230, 66, 200, 86, 167, 249, 174, 73, 74,
+    218, 118, 232, 232, 254, 143, 188, 85, 194, 53, 135, 254, 159, 108, 43, 116, 246, 161, 87, 35, 39, 134, 48, 31,
+    49, 253, 31, 120, 171, 132, 107, 15, 253, 62, 216, 86, 234, 42, 228, 77, 65, 52, 60, 111, 251, 126, 198, 71,
+    11, 87, 9, 149, 47, 165, 174, 123, 14, 247, 35, 118, 95, 70, 37, 107, 145, 133, 50, 41, 197, 92, 137, 125,
+    234, 253, 71, 23, 92, 17, 78, 42, 228, 112, 102, 186, 132, 30, 10, 111, 75, 158, 248, 22, 125, 6, 201, 30,
+    66, 53, 134, 79, 174, 187, 178, 215, 35, 34, 212, 96, 43, 122, 90, 35, 15, 146, 98, 69, 56, 131, 132, 249,
+    132, 107, 9, 124, 149, 48, 191, 177, 236, 59, 220, 133, 106, 49, 39, 42, 87, 96, 178, 16, 120, 193, 107, 7,
+    204, 38, 73, 99, 170, 228, 48, 185, 144, 141, 97, 147, 235, 174, 236, 181, 200, 157, 150, 22, 187, 116, 232, 254,
+    143, 188, 85, 199, 202, 160, 154, 232, 254, 143, 188, 85, 199, 202, 160, 154, 23, 48, 66, 200, 194, 177, 176, 225,
+    106, 227, 195, 239, 75, 250, 238, 68, 221, 246, 158, 163, 36, 207, 255, 159, 255, 79, 80, 141, 97, 162, 99, 6,
+    20, 207, 97, 222, 228, 37, 106, 243, 181, 204, 16, 178, 18, 41, 102, 151, 32, 141, 97, 233, 124, 66, 53, 118,
+    29, 220, 85, 200, 103, 138, 191, 81, 87, 34, 106, 9, 161, 130, 150, 145, 78, 42, 228, 126, 43, 85, 62, 55,
+    141, 7, 227, 190, 195, 241, 72, 243, 212, 32, 205, 61, 60, 45, 17, 59, 61, 12, 222, 5, 159, 64, 252, 49,
+    137, 236, 59, 220, 137, 91, 30, 19, 30, 100, 36, 17, 227, 121, 228, 112, 181, 113, 177, 177, 154, 133, 70, 144,
+    91, 252, 191, 42, 218, 10, 185, 24, 124, 147, 1, 243, 204, 194, 182, 147, 219, 160, 232, 252, 86, 170, 124, 111,
+    26, 15, 199, 125, 135, 226, 145, 231, 160, 239, 114, 63, 21, 170, 159, 27, 198, 131, 241, 223, 97, 248, 164, 121,
+    11, 33, 5, 142, 23, 75, 214, 123, 224, 105, 4, 176, 157, 147, 34, 44, 108, 185, 37, 27, 10, 113, 103, 210,
+    66, 53, 133, 92, 172, 7, 225, 140, 79, 97, 253, 11, 100, 108, 54, 194, 114, 18, 10, 72, 76, 97, 248, 22,
+    125, 36, 83, 136, 221, 134, 112, 78, 57, 234, 56, 186, 224, 143, 5, 178, 185, 144, 141, 97, 178, 228, 203, 144,
+    164, 241, 131, 35, 104, 127, 75, 98, 36, 165, 43, 104, 51, 120, 23, 223, 84, 105, 236, 59, 220, 141, 146, 60,
+    133, 145, 193, 198, 63, 126, 168, 173, 72, 172, 109, 212, 112, 181, 113, 156, 25, 184, 225, 40, 192, 154, 74, 87,
+    105, 8, 214, 9, 162, 225, 107, 144, 127, 93, 215, 109, 75, 87, 97, 222, 228, 127, 151, 231, 61, 240, 37, 247,
+    107, 72, 124, 197, 159, 73, 30, 18, 60, 171, 104, 17, 172, 54, 194, 114, 173, 160, 205, 113, 129, 87, 33, 22,
+    59, 116, 232, 254, 143, 188, 85, 199, 202, 160, 154, 232, 254, 143, 188, 85, 199, 202, 160, 154, 25, 59, 82, 182,
+    230, 71, 6, 107, 132, 139, 117, 26, 66, 91, 116, 198, 57, 24, 41, 101, 109, 7, 132, 203, 200, 167, 225, 34,
+    194, 174, 69, 63, 12, 50, 45, 70, 59, 14, 247, 33, 35, 43, 173, 28, 171, 120, 34, 230, 8, 131, 158, 14,
+    85, 34, 174, 69, 63, 13, 238, 145, 117, 154, 120, 231, 168, 225, 106, 227, 198, 235, 139, 43, 105, 34, 201, 74,
+    218, 15, 9, 151, 145, 78, 42, 228, 20, 140, 114, 62, 175, 246, 254, 31, 194, 123, 15, 102, 165, 253, 119, 34,
+    110, 251, 72, 70, 176, 72, 165, 148, 97, 53, 189, 149, 228, 43, 122, 90, 32, 252, 246, 195, 194, 82, 187, 118,
+    232, 232, 255, 219, 47, 163, 18, 181, 200, 251, 218, 161, 27, 35, 208, 255, 15, 184, 154, 70, 176, 74, 21, 114,
+    52, 132, 107, 2, 213, 8, 217, 17, 78, 63, 21, 170, 159, 27, 198, 131, 229, 73, 68, 127, 237, 151, 209, 137,
+    90, 231, 176, 239, 114, 52, 74, 50, 18, 8, 75, 60, 49, 176, 225, 106, 226, 174, 70, 236, 190, 140, 74, 215,
+    62, 233, 7, 95, 24, 58, 245, 8, 214, 21, 114, 54, 74, 191, 9, 200, 240, 121, 118, 176, 89, 24, 86, 54,
+    28, 45, 92, 120, 70, 99, 18, 44, 179, 182, 19, 149, 109, 4, 229, 119, 124, 4, 202, 234, 125, 29, 75, 84,
+    246, 31, 42, 222, 197, 170, 66, 53, 134, 105, 150, 248, 174, 70, 175, 232, 132, 240, 251, 208, 219, 120, 217, 228,
+    231, 190, 49, 207, 81, 147, 181, 66, 248, 222, 149, 180, 20, 226, 174, 69, 185, 100, 213, 114, 25, 38, 187, 111,
+    32, 183, 165, 135, 109, 75, 87, 110, 128, 232, 248, 38, 49, 194, 115, 208, 254, 173, 43, 98, 42, 228, 110, 203,
+    232, 196, 173, 114, 60, 110, 184, 178, 182, 157, 66, 12, 59, 104, 46, 152, 199, 9, 200, 154, 131, 89, 92, 200,
+    240, 115, 120, 35, 151, 223, 176, 239, 114, 51, 195, 188, 72, 72, 35, 103, 194, 205, 205, 186, 132, 107, 10, 185,
+    28, 38, 49, 33, 32, 139, 28, 158, 18, 141, 135, 11, 87, 19, 91, 216, 181, 4, 138, 225, 227, 200, 70, 176,
+    70, 103, 221, 178, 58, 150, 161, 225, 210, 45, 61, 135, 220, 239, 18, 41, 198, 88, 73, 152, 119, 214, 66, 53,
+    131, 231, 154, 228, 100, 97, 88, 138, 185, 25, 60, 66, 217, 227, 176, 249, 62, 116, 48, 186, 94, 149, 180, 8,
+    214, 25, 62, 185, 188, 82, 120, 193, 18, 82, 149, 180, 9, 5, 36, 101, 5, 40, 132, 96, 173, 233, 105, 91,
+    64, 149, 171, 206, 215, 48, 123, 116, 232, 248, 38, 49, 194, 115, 208, 239, 117, 145, 39, 42, 87, 96, 249, 138,
+    185, 23, 76, 99, 132, 228, 102, 82, 183, 131, 34, 174, 71, 220, 81, 189, 210, 31, 60, 215, 34, 41, 197, 92,
+    130, 147, 65, 26, 193, 6, 31, 47, 38, 194, 206, 240, 41, 197, 92, 142, 12, 208, 213, 35, 201, 176, 247, 123,
+    223, 93, 183, 163, 3, 251, 39, 143, 119, 97, 222, 228, 36, 20, 11, 35, 245, 221, 77, 117, 28, 45, 92, 59,
+    99, 145, 87, 34, 203, 52, 141, 66, 95, 118, 180, 135, 204, 96, 229, 91, 193, 144, 141, 97, 155, 189, 77, 29,
+    167, 176, 246, 18, 90, 72, 124, 194, 100, 150, 58, 170, 13, 140, 122, 75, 25, 21, 114, 17, 99, 183, 64, 232,
+    251, 138, 55, 186, 71, 247, 207, 53, 200, 244, 239, 114, 62, 226, 141, 238, 144, 249, 230, 185, 16, 126, 123, 216,
+    200, 77, 234, 239, 11, 92, 132, 107, 4, 203, 39, 215, 108, 44, 223, 82, 213, 216, 124, 174, 113, 232, 200, 72,
+    35, 53, 198, 13, 135, 11, 87, 30, 29, 252, 207, 80, 141, 97, 87, 35, 132, 198, 36, 89, 103, 108, 39, 33,
+    56, 72, 180, 245, 25, 24, 165, 205, 114, 74, 51, 212, 35, 88, 109, 119, 167, 210, 19, 107, 200, 124, 196, 174,
+    140, 185, 174, 72, 212, 55, 101, 244, 98, 86, 185, 7, 209, 106, 158, 195, 189, 200, 251, 138, 48, 149, 169, 30,
+    13, 213, 172, 17, 130, 235, 180, 25, 149, 244, 70, 169, 119, 209, 27, 145, 99, 62, 122, 139, 172, 139, 148, 176,
+    131, 52, 173, 160, 86, 23, 89, 23, 70, 180, 132, 144, 185, 139, 19, 176, 86, 21, 119, 223, 75, 208, 120, 25,
+    59, 100, 97, 187, 116, 252, 233, 49, 231, 244, 29, 238, 71, 220, 81, 132, 25, 169, 23, 89, 23, 41, 96, 172,
+    46, 178, 46, 141, 105, 30, 13, 213, 172, 42, 228, 88, 207, 158, 223, 79, 209, 208, 248, 38, 49, 194, 115, 208,
+    239, 114, 46, 152, 199, 9, 200, 185, 130, 22, 71, 136, 93, 47, 93, 69, 93, 27, 204, 138, 113, 132, 141, 8,
+    225, 90, 207, 196, 138, 186, 80, 193, 160, 172, 19, 93, 176, 67, 37, 111, 9, 129, 133, 210, 245, 216, 123, 223,
+    92, 222, 41, 60, 96, 143, 5, 178, 185, 144, 144, 70, 207, 43, 74, 236, 108, 19, 14, 218, 10, 185, 28, 38,
+    49, 61, 67, 231, 153, 133, 109, 4, 236, 245, 35, 55, 129, 53, 189, 139, 84, 138, 113, 53, 189, 185, 15, 2,
+    14, 19, 230, 60, 26, 224, 150, 25, 97, 38, 76, 246, 29, 238, 70, 79, 16, 182, 120, 24, 41, 105, 12, 241,
+    87, 20, 252, 36, 88, 106, 240, 70, 88, 73, 152, 119, 214, 123, 116, 232, 247, 225, 38, 97, 223, 94, 128, 255,
+    15, 184, 45, 70, 2, 9, 164, 107, 36, 88, 100, 248, 193, 208, 140, 176, 147, 48, 239, 175, 97, 247, 25, 243,
+    33, 26, 195, 43, 162, 196, 132, 130, 18, 33, 27, 67, 96, 197, 43, 28, 245, 25, 166, 74, 218, 4, 28, 93,
+    104, 248, 116, 139, 4, 161, 87, 35, 56, 118, 174, 195, 224, 252, 31, 70, 58, 137, 93, 26, 67, 230, 53, 69,
+    106, 44, 141, 145, 9, 4, 31, 75, 98, 213, 255, 159, 245, 255, 121, 21, 194, 182, 130, 151, 6, 66, 65, 27,
+    67, 237, 177, 176, 125, 139, 117, 8, 214, 24, 75, 88, 196, 132, 130, 38, 146, 149, 216, 216, 43, 10, 185, 25,
+    60, 49, 142, 195, 250, 208, 77, 182, 41, 18, 42, 228, 67, 190, 161, 100, 110, 214, 49, 163, 171, 104, 32, 236,
+    139, 19, 212, 96, 181, 149, 180, 11, 65, 24, 110, 217, 171, 44, 220, 216, 102, 78, 59, 116, 252, 240, 150, 177,
+    143, 208, 119, 185, 130, 18, 8, 194, 90, 198, 36, 109, 15, 182, 198, 195, 125, 130, 176, 171, 145, 147, 195, 24,
+    237, 244, 253, 29, 0, 252, 86, 170, 124, 111, 26, 15, 123, 239, 21, 208, 239, 114, 50, 125, 226, 161, 223, 81,
+    194, 213, 213, 133, 92, 143, 197, 106, 167, 198, 241, 160, 201, 247, 138, 187, 239, 36, 44, 137, 124, 29, 88, 35,
+    88, 89, 116, 101, 205, 77, 187, 15, 201, 222, 197, 134, 199, 137, 27, 67, 250, 91, 17, 37, 41, 91, 65, 155,
+    192, 127, 18, 99, 209, 137, 234, 17, 172, 42, 228, 127, 157, 237, 161, 247, 72, 240, 91, 43, 137, 164, 107, 72,
+    56, 62, 146, 141, 130, 80, 171, 145, 156, 59, 87, 97, 222, 228, 67, 190, 161, 100, 29, 118, 174, 66, 80, 171,
+    145, 171, 234, 90, 186, 137, 92, 22, 160, 126, 121, 29, 168, 102, 240, 42, 228, 102, 138, 212, 14, 87, 112, 249,
+    140, 221, 234, 104, 237, 35, 56, 125, 65, 196, 158, 46, 96, 133, 97, 87, 35, 198, 235, 139, 43, 105, 219, 160,
+    232, 248, 38, 49, 194, 115, 208, 239, 114, 46, 152, 199, 9, 200, 164, 242, 100, 32, 173, 225, 133, 204, 30, 162,
+    229, 44, 173, 160, 151, 222, 175, 216, 119, 185, 24, 93, 47, 74, 218, 5, 145, 56, 93, 47, 88, 228, 89, 117,
+    212, 199, 80, 141, 97, 87, 34, 95, 118, 180, 135, 204, 38, 84, 190, 150, 185, 25, 165, 143, 97, 253, 104, 102,
+    78, 36, 106, 240, 68, 156, 177, 189, 141, 130, 176, 171, 172, 141, 146, 40, 62, 98, 174, 71, 141, 215, 22, 86,
+    211, 183, 64, 232, 248, 38, 49, 194, 115, 208, 239, 114, 46, 152, 199, 9, 200, 177, 75, 126, 242, 214, 145, 115,
+    7, 168, 225, 106, 225, 159, 139, 152, 32, 226, 72, 167, 26, 63, 97, 240, 126, 15, 163, 29, 71, 47, 184, 103,
+    165, 200, 143, 16, 254, 75, 12, 138, 225, 91, 65, 75, 131, 33, 60, 63, 163, 212, 65, 244, 83, 10, 218, 4,
+    25, 66, 113, 129, 59, 38, 71, 176, 254, 181, 238, 145, 254, 119, 154, 28, 45, 93, 88, 65, 76, 175, 212, 35,
+    88, 114, 251, 140, 157, 165, 108, 96, 113, 115, 87, 48, 57, 125, 198, 79, 190, 44, 50, 194, 235, 224, 111, 176,
+    167, 9, 150, 70, 100, 85, 200, 135, 125, 71, 131, 203, 181, 187, 116, 252, 242, 194, 235, 227, 244, 31, 225, 247,
+    26, 174, 151, 161, 224, 132, 241, 130, 41, 198, 88, 93, 124, 10, 188, 62, 250, 92, 85, 200, 200, 174, 21, 180,
+    10, 212, 226, 174, 68, 59, 234, 24, 252, 232, 89, 222, 59, 125, 63, 71, 64, 247, 190, 187, 111, 70, 7, 246,
+    79, 29, 0, 239, 114, 55, 101, 244, 98, 86, 185, 247, 72, 201, 245, 219, 122, 48, 48, 158, 2, 200, 65, 125,
+    252, 7, 204, 81, 202, 236, 248, 125, 57, 236, 62, 47, 196, 135, 204, 100, 250, 237, 189, 24, 144, 141, 96, 198,
+    184, 120, 242, 173, 160, 63, 174, 235, 182, 165, 168, 102, 184, 192, 171, 145, 14, 250, 245, 16, 141, 162, 182, 131,
+    56, 125, 70, 198, 37, 217, 48, 63, 31, 124, 138, 112, 90, 140, 109, 11, 39, 247, 233, 9, 98, 36, 199, 163,
+    18, 17, 172, 39, 133, 172, 174, 103, 176, 239, 114, 47, 190, 161, 243, 7, 7, 42, 135, 101, 202, 66, 200, 201,
+    218, 105, 26, 187, 15, 240, 251, 134, 122, 92, 136, 171, 165, 9, 125, 72, 63, 174, 235, 182, 165, 168, 38, 219,
+    20, 137, 15, 189, 7, 204, 109, 132, 200, 255, 231, 253, 127, 223, 223, 87, 48, 198, 134, 73, 227, 6, 66, 65,
+    30, 33, 109, 162, 182, 129, 141, 112, 241, 230, 69, 93, 40, 77, 223, 124, 89, 189, 212, 60, 17, 147, 179, 28,
+    168, 219, 168, 70, 176, 65, 132, 218, 159, 96, 178, 46, 145, 110, 22, 13, 130, 181, 56, 171, 145, 146, 215, 33,
+    141, 112, 241, 231, 183, 64, 252, 230, 251, 213, 159, 134, 253, 7, 123, 145, 132, 218, 159, 96, 178, 46, 145, 111,
+    223, 194, 193, 176, 86, 167, 21, 114, 50, 90, 228, 49, 174, 30, 60, 246, 250, 126, 143, 207, 118, 219, 27, 233,
+    250, 15, 190, 174, 97, 141, 12, 147, 198, 12, 132, 130, 60, 66, 219, 69, 109, 5, 92, 141, 217, 125, 24, 149,
+    174, 67, 26, 225, 227, 200, 225, 106, 226, 174, 70, 75, 92, 134, 53, 195, 199, 145, 60, 45, 101, 115, 33, 88,
+    85, 200, 194, 120, 237, 244, 253, 29, 0, 247, 188, 49, 128, 249, 143, 193, 21, 135, 202, 160, 154, 8, 214, 31,
+    84, 208, 249, 84, 19, 93, 0, 246, 161, 87, 35, 39, 134, 48, 31, 49, 248, 34, 176, 249, 84, 19, 65, 26,
+    195, 250, 44, 77, 15, 149, 65, 52, 21, 135, 252, 158, 41, 219, 168, 255, 143, 151, 80, 140, 31, 22, 12, 120,
+    157, 147, 99, 2, 105, 26, 194, 86, 164, 120, 228, 32, 194, 107, 182, 207, 53, 212, 77, 223, 133, 109, 5, 202,
+    91, 10, 198, 66, 120, 125, 232, 32, 203, 159, 6, 2, 85, 38, 94, 66, 80, 171, 145, 135, 201, 48, 46, 186,
+    92, 78, 87, 119, 199, 97, 222, 228, 62, 44, 96, 120, 133, 203, 200, 241, 186, 226, 202, 218, 72, 72, 125, 218,
+    193, 104, 37, 172, 37, 245, 35, 43, 164, 107, 216, 126, 8, 172, 62, 85, 4, 208, 201, 34, 20, 200, 118, 20,
+    226, 174, 67, 60, 85, 199, 23, 92, 17, 253, 22, 38, 135, 202, 160, 154, 7, 231, 69, 173, 34, 156, 85, 200,
+    224, 205, 118, 232, 232, 252, 17, 88, 124, 170, 9, 174, 128, 246, 145, 203, 238, 50, 118, 165, 109, 200, 179, 240,
+    195, 240, 69, 97, 242, 168, 38, 186, 142, 95, 113, 73, 228, 133, 97, 87, 34, 87, 75, 212, 132, 107, 9, 212,
+    227, 18, 18, 71, 47, 184, 217, 38, 71, 164, 133, 125, 228, 77, 60, 25, 8, 214, 16, 102, 147, 120, 70, 169,
+    237, 208, 232, 247, 188, 49, 128, 249, 143, 193, 21, 135, 202, 160, 154, 8, 214, 31, 108, 58, 91, 132, 231, 160,
+    246, 161, 87, 35, 39, 134, 48, 31, 49, 248, 34, 176, 249, 84, 19, 65, 26, 195, 237, 135, 75, 112, 156, 133,
+    97, 255, 39, 138, 118, 234, 63, 227, 229, 212, 93, 102, 158, 23, 33, 226, 23, 47, 35, 198, 235, 139, 43, 105,
+    35, 85, 249, 142, 22, 174, 24, 240, 96, 77, 223, 105, 8, 214, 25, 38, 127, 252, 255, 250, 122, 141, 23, 210,
+    182, 130, 174, 66, 65, 64, 131, 198, 11, 88, 62, 97, 241, 96, 141, 96, 199, 142, 195, 216, 49, 118, 18, 186,
+    48, 207, 11, 151, 147, 18, 31, 122, 149, 177, 8, 48, 249, 38, 5, 149, 140, 117, 28, 93, 112, 66, 6, 41,
+    30, 57, 25, 225, 248, 48, 38, 239, 176, 75, 90, 66, 9, 219, 9, 55, 15, 152, 201, 240, 240, 41, 197, 92,
+    137, 91, 30, 19, 30, 122, 140, 160, 165, 43, 104, 16, 97, 125, 28, 114, 60, 111, 66, 14, 19, 230, 108, 18,
+    181, 121, 218, 230, 15, 110, 128, 232, 252, 17, 88, 124, 170, 9, 174, 128, 252, 17, 88, 124, 170, 9, 160, 172,
+    63, 228, 241, 78, 221, 71, 131, 92, 18, 195, 234, 254, 53, 113, 242, 168, 38, 130, 53, 135, 219, 14, 150, 225,
+    57, 234, 22, 70, 21, 141, 135, 11, 87, 19, 170, 99, 3, 198, 242, 172, 102, 76, 132, 107, 12, 174, 145, 170,
+    182, 131, 196, 46, 94, 71, 141, 215, 22, 86, 210, 69, 93, 40, 100, 155, 86, 240, 69, 92, 138, 126, 27, 221,
+    35, 56, 82, 214, 199, 35, 210, 248, 61, 135, 123, 145, 80, 76, 132, 195, 182, 130, 174, 68, 173, 143, 9, 143,
+    33, 243, 204, 192, 155, 165, 143, 80, 141, 97, 87, 34, 110, 251, 72, 70, 176, 201, 51, 255, 231, 255, 210, 21,
+    189, 45, 17, 177, 125, 176, 69, 56, 154, 125, 130, 183, 81, 170, 121, 86, 208, 45, 4, 30, 55, 158, 68, 236,
+    244, 51, 120, 24, 124, 147, 18, 42, 240, 251, 233, 119, 222, 133, 92, 139, 39, 61, 186, 0, 232, 247, 188, 49,
+    128, 249, 143, 193, 21, 135, 202, 130, 53, 135, 213, 252, 106, 227, 229, 80, 77, 116, 246, 161, 87, 35, 39, 134,
+    48, 31, 49, 245, 127, 26, 184, 249, 84, 19, 65, 26, 195, 237, 135, 75, 112, 156, 133, 97, 255, 39, 138, 118,
+    234, 63, 227, 229, 212, 32, 205, 44, 108, 50, 118, 244, 89, 75, 100, 68, 211, 193, 8, 214, 8, 52, 73, 19,
+    73, 74, 236, 51, 76, 136, 41, 149, 195, 213, 204, 4, 202, 30, 100, 85, 200, 86, 163, 18, 114, 165, 118, 236,
+    59, 220, 137, 91, 30, 19, 30, 100, 77, 223, 129, 47, 169, 28, 20, 142, 161, 26, 194, 174, 68, 225, 248, 253,
+    249, 93, 27, 69, 109, 5, 66, 103, 154, 228, 48, 186, 94, 130, 90, 210, 41, 197, 92, 136, 56, 79, 153, 183,
+    81, 58, 166, 49, 251, 233, 248, 97, 153, 56, 9, 35, 36, 137, 27, 36, 200, 241, 200, 70, 176, 171, 144, 249,
+    100, 146, 174, 201, 129, 147, 183, 163, 18, 148, 174, 194, 208, 185, 212, 138, 188, 62, 250, 92, 85, 200, 253, 119,
+    83, 93, 186, 0, 232, 250, 191, 141, 92, 124, 170, 9, 174, 128, 251, 77, 112, 75, 15, 182, 29, 45, 194, 114,
+    17, 172, 42, 228, 127, 201, 226, 157, 135, 193, 116, 184, 249, 101, 119, 124, 13, 146, 60, 171, 104, 48, 245, 212,
+    125, 95, 198, 174, 62, 85, 4, 208, 89, 24, 86, 54, 28, 45, 92, 62, 44, 96, 93, 245, 51, 212, 78, 169,
+    140, 15, 27, 202, 177, 153, 51, 212, 35, 88, 82, 99, 2, 160, 153, 19, 116, 178, 182, 130, 174, 70, 80, 153,
+    121, 54, 18, 182, 60, 38, 60, 207, 97, 222, 228, 126, 187, 169, 160, 197, 116, 191, 135, 139, 187, 216, 105, 9,
+    109, 211, 24, 228, 97, 125, 22, 145, 190, 193, 138, 64, 171, 145, 57, 93, 223, 29, 71, 23, 48, 68, 214, 246,
+    45, 82, 18, 8, 219, 9, 202, 182, 131, 133, 171, 138, 185, 88, 25, 194, 150, 180, 246, 29, 0, 232, 255, 147,
+    197, 59, 15, 130, 233, 113, 242, 202, 238, 248, 31, 138, 71, 149, 109, 7, 246, 122, 232, 239, 114, 54, 72, 242,
+    173, 160, 195, 208, 149, 169, 7, 93, 171, 145, 41, 232, 140, 222, 2, 12, 207, 3, 209, 186, 229, 131, 35, 100,
+    143, 38, 193, 88, 124, 169, 51, 204, 108, 145, 229, 91, 65, 59, 38, 70, 123, 15, 105, 28, 190, 225, 54, 218,
+    29, 50, 184, 171, 145, 57, 93, 223, 29, 71, 47, 184, 103, 165, 200, 132, 19, 170, 99, 3, 255, 127, 47, 180,
+    90, 23, 209, 18, 181, 74, 218, 6, 63, 58, 20, 225, 216, 135, 204, 85, 200, 244, 110, 185, 96, 207, 110, 128,
+    252, 246, 92, 188, 239, 183, 232, 63, 21, 203, 206, 251, 10, 185, 31, 251, 249, 125, 162, 208, 190, 143, 211, 244,
+    116, 247, 188, 49, 128, 249, 143, 171, 248, 213, 199, 202, 160, 154, 8, 214, 31, 129, 133, 178, 163, 116, 246, 161,
+    87, 35, 39, 134, 48, 31, 49, 245, 127, 26, 184, 249, 84, 19, 65, 26, 195, 240, 48, 182, 84, 96, 172, 63,
+    228, 241, 78, 221, 71, 252, 124, 186, 132, 26, 36, 137, 164, 165, 118, 8, 214, 8, 39, 84, 198, 6, 78, 222,
+    139, 41, 108, 136, 154, 120, 34, 86, 130, 101, 15, 50, 51, 135, 212, 32, 131, 43, 98, 212, 169, 128, 144, 80,
+    112, 181, 113, 171, 216, 205, 11, 190, 242, 103, 176, 239, 114, 21, 168, 196, 156, 169, 93, 134, 100, 226, 71, 235,
+    186, 154, 8, 214, 27, 181, 247, 136, 83, 110, 163, 133, 171, 132, 25, 158, 6, 73, 18, 54, 73, 149, 109, 7,
+    142, 66, 53, 131, 229, 146, 74, 187, 38, 6, 198, 198, 106, 21, 26, 67, 176, 171, 145, 43, 99, 194, 99, 204,
+    246, 232, 232, 252, 12, 45, 149, 24, 124, 170, 9, 174, 128, 252, 12, 45, 149, 24, 124, 170, 9, 160, 172, 63,
+    228, 241, 78, 221, 71, 252, 124, 186, 137, 168, 53, 149, 204, 138, 188, 62, 250, 92, 83, 240, 195, 133, 171, 132,
+    26, 175, 204, 62, 98, 12, 173, 139, 82, 166, 2, 65, 73, 234, 39, 84, 198, 7, 141, 229, 88, 204, 153, 234,
+    17, 172, 31, 98, 194, 118, 76, 140, 246, 29, 238, 68, 58, 88, 44, 140, 43, 27, 14, 22, 174, 42, 9, 144,
+    141, 97, 171, 216, 205, 11, 190, 242, 103, 168, 202, 10, 82, 182, 129, 4, 28, 39, 204, 216, 37, 106, 243, 181,
+    204, 16, 146, 42, 19, 60, 215, 33, 158, 31, 137, 19, 69, 44, 184, 228, 38, 29, 180, 21, 114, 56, 56, 199,
+    239, 168, 79, 71, 6, 194, 31, 122, 61, 186, 0, 232, 247, 188, 49, 128, 249, 143, 192, 194, 217, 81, 130, 53,
+    135, 224, 138, 195, 229, 80, 77, 116, 246, 161, 87, 35, 39, 134, 48, 31, 49, 248, 24, 91, 42, 48, 70, 176,
+    252, 17, 91, 168, 65, 153, 224, 97, 242, 76, 9, 187, 237, 35, 52, 200, 132, 31, 174, 234, 104, 65, 149, 177,
+    106, 84, 192, 72, 41, 212, 101, 5, 41, 91, 64, 131, 198, 11, 88, 62, 98, 117, 76, 96, 120, 222, 85, 140,
+    201, 144, 141, 96, 197, 116, 191, 135, 139, 187, 216, 101, 116, 141, 123, 14, 247, 33, 90, 140, 73, 202, 149, 216,
+    73, 50, 16, 77, 20, 183, 35, 60, 63, 1, 243, 25, 36, 79, 81, 194, 213, 197, 65, 63, 191, 10, 198, 194,
+    86, 199, 132, 199, 153, 27, 67, 250, 91, 43, 104, 38, 233, 98, 51, 120, 21, 119, 146, 54, 73, 149, 109, 7,
+    142, 123, 116, 232, 252, 17, 88, 124, 170, 9, 174, 128, 252, 17, 88, 124, 170, 9, 160, 178, 48, 172, 108, 56,
+    90, 184, 65, 170, 252, 195, 230, 31, 22, 48, 46, 251, 201, 144, 141, 97, 58, 166, 48, 60, 111, 42, 198, 100,
+    207, 81, 162, 250, 86, 208, 85, 200, 72, 40, 16, 100, 255, 183, 61, 70, 23, 209, 183, 239, 86, 25, 147, 142,
+    195, 189, 200, 135, 75, 5, 145, 250, 238, 166, 186, 142, 22, 174, 41, 49, 129, 80, 76, 140, 146, 105, 91, 65,
+    55, 75, 63, 18, 31, 209, 129, 87, 34, 86, 199, 132, 199, 153, 8, 214, 21, 114, 31, 44, 146, 85, 217, 48,
+    50, 72, 27, 36, 202, 182, 131, 199, 61, 135, 119, 21, 114, 10, 77, 14, 95, 112, 207, 75, 145, 21, 114, 54,
+    72, 242, 173, 160, 195, 208, 124, 199, 181, 95, 6, 151, 33, 248, 164, 121, 237, 208, 232, 246, 171, 224, 210, 228,
+    63, 20, 143, 35, 241, 72, 242, 173, 160, 254, 207, 93, 0, 239, 114, 61, 170, 248, 52, 185, 15, 197, 35, 200,
+    217, 35, 202, 182, 131, 15, 65, 100, 120, 222, 107, 10, 218, 14, 22, 174, 50, 72, 144, 146, 60, 173, 164, 109,
+    132, 228, 43, 10, 185, 27, 36, 121, 234, 53, 79, 42, 218, 10, 185, 26, 188, 208, 124, 197, 92, 172, 13, 216,
+    252, 246, 57, 81, 176, 165, 212, 135, 207, 49, 156, 62, 162, 114, 187, 190, 5, 183, 34, 156, 85, 200, 131, 145,
+    106, 25, 115, 224, 192, 74, 164, 203, 207, 97, 253, 147, 125, 47, 70, 6, 107, 140, 72, 171, 144, 139, 3, 139,
+    174, 8, 210, 31, 125, 164, 62, 98, 235, 165, 196, 229, 119, 124, 24, 145, 149, 210, 131, 20, 143, 28, 132, 107,
+    2, 223, 229, 249, 21, 114, 39, 118, 110, 66, 103, 70, 25, 221, 130, 80, 171, 145, 178, 71, 158, 221, 0, 232,
+    254, 139, 19, 67, 229, 80, 77, 116, 251, 245, 218, 185, 31, 23, 125, 71, 238, 31, 199, 234, 254, 61, 0, 232,
+    246, 171, 224, 210, 228, 63, 20, 143, 61, 0, 246, 171, 224, 210, 228, 63, 20, 143, 33, 100, 120, 222, 107, 10,
+    218, 14, 22, 174, 60, 173, 164, 79, 10, 218, 43, 105, 212, 101, 133, 215, 194, 182, 157, 66, 53, 132, 38, 74,
+    218, 4, 202, 30, 100, 85, 200, 210, 18, 103, 145, 154, 156, 90, 122, 130, 223, 229, 249, 86, 208, 85, 200, 157,
+    217, 185, 22, 78, 123, 15, 236, 155, 233, 122, 48, 17, 172, 50, 185, 49, 158, 248, 30, 157, 114, 50, 51, 92,
+    96, 85, 200, 69, 142, 195, 189, 204, 16, 178, 16, 108, 185, 121, 223, 97, 162, 106, 67, 230, 60, 36, 159, 9,
+    140, 9, 164, 138, 86, 208, 37, 10, 185, 12, 82, 60, 114, 60, 38, 48, 44, 169, 171, 181, 187, 15, 96, 197,
+    35, 199, 34, 87, 70, 26, 164, 121, 145, 87, 34, 105, 34, 131, 230, 42, 228, 103, 11, 62, 9, 26, 62, 51,
+    25, 62, 241, 39, 183, 64, 252, 246, 194, 115, 225, 49, 143, 208, 127, 233, 213, 130, 176, 65, 178, 229, 231, 125,
+    134, 137, 169, 15, 152, 240, 146, 124, 38, 49, 219, 233, 250, 63, 58, 188, 63, 22, 89, 202, 127, 65, 182, 19,
+    144, 130, 31, 118, 176, 124, 198, 112, 179, 224, 145, 163, 227, 63, 167, 232, 232, 254, 207, 227, 199, 33, 243, 31,
+    242, 120, 167, 97, 240, 93, 46, 62, 89, 93, 223, 29, 0, 239, 114, 48, 254, 60, 114, 60, 66, 182, 146, 60,
+    38, 94, 67, 60, 210, 99, 69, 64, 146, 57, 125, 193, 106, 48, 42, 228, 89, 222, 36, 35, 88, 36, 17, 104,
+    78, 24, 120, 76, 188, 138, 113, 203, 239, 2, 235, 165, 196, 229, 119, 124, 11, 39, 51, 216, 119, 93, 72, 167,
+    26, 26, 20, 227, 135, 143, 61, 135, 123, 145, 57, 93, 223, 1, 243, 205, 114, 35, 9, 204, 143, 7, 55, 130,
+    57, 125, 251, 116, 232, 254, 249, 230, 185, 16, 249, 143, 249, 60, 83, 176, 248, 46, 151, 31, 44, 174, 239, 142,
+    128, 239, 114, 63, 228, 241, 78, 195, 224, 186, 92, 124, 178, 187, 190, 3, 231, 154, 228, 66, 200, 65, 227, 121,
+    228, 95, 127, 29, 71, 11, 87, 21, 114, 51, 69, 106, 23, 223, 80, 249, 140, 157, 189, 24, 148, 165, 118, 8,
+    214, 16, 173, 162, 182, 131, 107, 187, 25, 25, 174, 48, 173, 160, 171, 144, 139, 1, 36, 77, 38, 121, 141, 78,
+    190, 12, 72, 73, 149, 154, 19, 91, 216, 181, 72, 70, 176, 244, 178, 180, 241, 61, 135, 218, 110, 173, 97, 87,
+    35, 56, 118, 161, 99, 62, 122, 137, 185, 199, 163, 33, 32, 140, 43, 27, 14, 22, 174, 24, 165, 99, 145, 52,
+    153, 121, 54, 27, 38, 198, 36, 35, 88, 78, 87, 119, 192, 212, 234, 240, 158, 23, 10, 157, 71, 23, 92, 16,
+    131, 198, 248, 193, 165, 97, 225, 210, 44, 44, 179, 182, 19, 153, 8, 204, 251, 182, 71, 82, 213, 33, 26, 194,
+    14, 170, 214, 49, 33, 88, 32, 213, 126, 97, 243, 30, 33, 116, 189, 12, 159, 15, 19, 216, 119, 185, 31, 35,
+    148, 26, 72, 228, 105, 4, 212, 142, 95, 113, 194, 213, 194, 9, 213, 112, 66, 53, 130, 182, 111, 26, 200, 229,
+    247, 21, 116, 161, 87, 35, 241, 133, 108, 151, 100, 192, 89, 10, 194, 235, 33, 243, 205, 114, 61, 186, 0, 232,
+    252, 97, 91, 37, 217, 49, 238, 145, 253, 243, 205, 114, 61, 0, 239, 114, 63, 228, 241, 78, 195, 224, 186, 92,
+    124, 178, 187, 190, 6, 208, 173, 146, 236, 152, 247, 72, 124, 243, 92, 136, 89, 20, 182, 228, 35, 88, 60, 104,
+    140, 191, 177, 183, 81, 194, 213, 198, 112, 154, 155, 12, 140, 82, 230, 185, 37, 25, 8, 214, 19, 149, 221, 240,
+    54, 187, 211, 200, 177, 201, 225, 41, 91, 65, 87, 35, 132, 198, 39, 176, 239, 114, 54, 133, 108, 151, 100, 192,
+    149, 169, 9, 66, 235, 34, 198, 124, 245, 16, 125, 41, 225, 91, 65, 178, 108, 99, 135, 143, 61, 71, 23, 92,
+    16, 130, 117, 76, 96, 77, 38, 94, 67, 230, 51, 92, 25, 8, 214, 8, 25, 53, 59, 97, 40, 134, 41, 88,
+    228, 62, 89, 111, 183, 34, 174, 70, 207, 133, 155, 155, 14, 29, 236, 88, 78, 241, 154, 100, 123, 116, 252, 233,
+    49, 231, 244, 29, 211, 30, 69, 56, 171, 145, 248, 194, 182, 75, 178, 99, 233, 250, 58, 0, 246, 31, 4, 198,
+    58, 0, 246, 31, 4, 198, 2, 176, 171, 145, 117, 210, 226, 114, 187, 190, 2, 200, 194, 177, 176, 225, 106, 226,
+    31, 137, 15, 152, 210, 19, 145, 135, 203, 201, 137, 234, 42, 229, 96, 89, 222, 36, 78, 23, 75, 214, 57, 19,
+    150, 249, 230, 108, 51, 135, 212, 114, 82, 36, 62, 99, 121, 61, 135, 123, 145, 158, 55, 120, 51, 145, 106, 24,
+    93, 47, 82, 31, 209, 139, 148, 176, 201, 38, 130, 15, 16, 186, 94, 134, 152, 126, 3, 176, 171, 145, 75, 131,
+    97, 158, 29, 227, 168, 226, 235, 130, 16, 102, 120, 25, 97, 38, 97, 223, 81, 103, 120, 145, 52, 141, 96, 251,
+    22, 234, 48, 106, 149, 180, 21, 114, 37, 247, 107, 7, 204, 89, 102, 145, 168, 101, 116, 170, 48, 17, 172, 48,
+    102, 93, 164, 90, 23, 58, 10, 212, 226, 174, 70, 79, 16, 182, 120, 237, 208, 232, 246, 31, 4, 198, 58, 0,
+    246, 31, 4, 198, 2, 176, 171, 145, 117, 210, 226, 114, 187, 190, 2, 200, 194, 177, 176, 225, 106, 226, 31, 137,
+    15, 152, 210, 19, 145, 135, 203, 201, 137, 234, 42, 229, 96, 89, 222, 36, 78, 23, 75, 214, 57, 19, 150, 249,
+    230, 108, 51, 135, 212, 114, 82, 36, 62, 99, 121, 61, 135, 123, 145, 158, 55, 120, 51, 145, 106, 24, 93, 47,
+    82, 31, 209, 139, 148, 176, 201, 38, 130, 15, 16, 186, 94, 134, 152, 126, 3, 176, 171, 145, 75, 131, 97, 158,
+    29, 227, 168, 226, 235, 130, 16, 102, 120, 25, 97, 38, 97, 223, 81, 103, 120, 145, 52, 141, 96, 251, 22, 234,
+    48, 106, 149, 180, 21, 114, 37, 247, 107, 7, 204, 89, 102, 145, 168, 101, 116, 170, 48, 17, 172, 48, 102, 93,
+    164, 90, 23, 58, 10, 212, 226, 174, 70, 79, 16, 182, 120, 237, 208, 232, 247, 190, 186, 187, 79, 64, 239, 114,
+    46, 186, 92, 78, 87, 119, 192, 247, 190, 186, 187, 72, 72, 40, 22, 66, 9, 217, 50, 87, 222, 122, 135, 216,
+    176, 157, 158, 135, 11, 87, 25, 99, 121, 163, 18, 31, 49, 73, 227, 6, 66, 53, 134, 87, 69, 137, 28, 92,
+    193, 19, 91, 216, 181, 72, 209, 42, 230, 5, 56, 41, 65, 26, 194, 95, 37, 76, 47, 236, 123, 15, 236, 145,
+    161, 28, 43, 89, 248, 145, 131, 65, 88, 109, 130, 213, 200, 124, 195, 37, 111, 9, 129, 133, 210, 245, 212, 120,
+    133, 210, 244, 89, 91, 65, 87, 34, 118, 76, 143, 81, 197, 215, 4, 100, 248, 120, 207, 124, 9, 202, 238, 248,
+    30, 17, 152, 196, 139, 163, 104, 51, 135, 212, 85, 200, 225, 49, 137, 234, 18, 214, 86, 208, 32, 167, 223, 43,
+    135, 204, 78, 87, 119, 192, 157, 150, 22, 187, 14, 239, 100, 231, 168, 187, 240, 125, 24, 234, 42, 228, 67, 190,
+    162, 105, 26, 210, 14, 187, 87, 34, 83, 209, 25, 188, 10, 185, 15, 150, 73, 42, 236, 152, 27, 36, 202, 182,
+    130, 105, 51, 204, 106, 117, 240, 99, 183, 64, 232, 246, 31, 4, 198, 58, 0, 255, 214, 243, 65, 247, 169, 91,
+    17, 87, 35, 250, 247, 31, 223, 60, 215, 34, 21, 135, 176, 248, 38, 49, 212, 85, 200, 201, 226, 22, 207, 1,
+    100, 97, 88, 216, 112, 181, 112, 131, 51, 192, 241, 190, 48, 105, 88, 120, 116, 139, 72, 178, 206, 216, 78, 85,
+    180, 20, 114, 191, 239, 131, 132, 163, 96, 140, 207, 187, 100, 117, 45, 82, 17, 172, 51, 199, 38, 39, 176, 239,
+    114, 18, 10, 5, 145, 250, 238, 166, 140, 10, 186, 48, 171, 145, 6, 104, 62, 98, 174, 69, 211, 24, 234, 56,
+    90, 184, 171, 145, 154, 43, 80, 151, 221, 172, 31, 49, 92, 236, 173, 160, 70, 176, 171, 145, 125, 245, 15, 152,
+    201, 245, 219, 122, 48, 15, 235, 186, 237, 169, 106, 25, 62, 170, 218, 12, 225, 245, 30, 13, 213, 172, 42, 228,
+    127, 94, 227, 251, 231, 154, 228, 69, 157, 227, 183, 64, 232, 254, 189, 199, 247, 207, 53, 200, 244, 239, 114, 63,
+    175, 113, 253, 243, 205, 114, 33, 100, 32, 157, 83, 24, 234, 50, 198, 245, 70, 13, 132, 236, 153, 17, 194, 213,
+    197, 140, 249, 145, 147, 250, 48, 108, 21, 134, 79, 174, 219, 209, 129, 178, 69, 79, 81, 146, 120, 193, 158, 161,
+    26, 195, 87, 101, 167, 137, 236, 59, 220, 142, 19, 24, 144, 144, 70, 21, 141, 135, 11, 87, 19, 115, 143, 70,
+    69, 223, 22, 86, 208, 77, 38, 94, 100, 62, 98, 95, 58, 225, 32, 141, 81, 183, 76, 72, 70, 176, 157, 146,
+    8, 63, 174, 235, 182, 165, 171, 168, 226, 235, 130, 16, 100, 251, 237, 130, 31, 49, 149, 209, 98, 68, 173, 5,
+    97, 87, 35, 39, 134, 48, 51, 120, 19, 91, 216, 181, 72, 146, 124, 171, 104, 40, 229, 113, 115, 141, 187, 116,
+    252, 233, 49, 231, 244, 20, 152, 242, 41, 197, 92, 143, 235, 220, 124, 182, 57, 42, 97, 102, 190, 159, 163, 243,
+    198, 237, 149, 255, 65, 247, 67, 236, 31, 60, 198, 55, 108, 175, 219, 233, 250, 58, 0, 249, 24, 244, 96, 124,
+    93, 245, 232, 239, 117, 145, 38, 61, 24, 16, 239, 168, 89, 26, 188, 17, 133, 242, 66, 12, 176, 242, 104, 85,
+    210, 132, 190, 165, 216, 141, 95, 118, 163, 96, 130, 19, 47, 33, 91, 176, 249, 112, 181, 149, 204, 132, 107, 9,
+    49, 232, 196, 132, 130, 38, 147, 47, 38, 194, 156, 85, 200, 200, 174, 21, 180, 234, 47, 190, 186, 171, 104, 19,
+    132, 231, 176, 239, 115, 4, 44, 132, 31, 241, 255, 231, 224, 56, 90, 184, 118, 33, 243, 21, 114, 36, 199, 163,
+    18, 19, 16, 82, 220, 140, 62, 154, 27, 5, 96, 141, 96, 236, 42, 228, 88, 207, 154, 125, 187, 116, 252, 213,
+    164, 197, 126, 128, 255, 86, 147, 20, 63, 247, 242, 251, 66, 181, 56, 118, 33, 243, 21, 114, 36, 199, 163, 19,
+    244, 253, 29, 0, 254, 173, 70, 36, 229, 74, 236, 31, 49, 236, 62, 9, 140, 4, 107, 15, 180, 124, 19, 24,
+    232, 246, 161, 87, 33, 90, 140, 73, 202, 149, 216, 62, 99, 216, 124, 19, 24, 8, 214, 31, 104, 248, 38, 49,
+    212, 113, 115, 4, 125, 163, 224, 152, 192, 63, 58, 45, 105, 5, 38, 184, 72, 183, 81, 87, 34, 151, 6, 195,
+    60, 59, 192, 193, 75, 72, 167, 225, 34, 193, 4, 63, 1, 243, 24, 124, 188, 152, 144, 141, 97, 150, 18, 102,
+    29, 245, 22, 119, 137, 236, 59, 220, 132, 130, 129, 100, 112, 113, 143, 223, 133, 174, 163, 133, 171, 143, 16, 186,
+    94, 131, 250, 49, 114, 150, 24, 93, 47, 82, 32, 231, 131, 149, 43, 104, 31, 60, 197, 92, 141, 159, 11, 55,
+    54, 19, 188, 102, 153, 25, 8, 214, 25, 36, 210, 182, 129, 4, 209, 75, 114, 52, 195, 240, 44, 252, 48, 171,
+    145, 147, 196, 45, 158, 39, 183, 64, 232, 251, 71, 193, 49, 142, 128, 251, 71, 193, 49, 129, 53, 6, 178, 185,
+    145, 79, 194, 69, 133, 92, 130, 147, 93, 70, 10, 89, 91, 65, 78, 42, 228, 105, 206, 189, 71, 11, 87, 16,
+    252, 72, 124, 198, 31, 47, 38, 36, 97, 89, 91, 65, 87, 35, 132, 198, 36, 35, 88, 32, 204, 240, 60, 22,
+    202, 230, 70, 216, 76, 141, 130, 97, 219, 65, 87, 35, 132, 231, 176, 239, 114, 60, 66, 233, 122, 15, 232, 197,
+    202, 88, 97, 116, 189, 72, 131, 158, 14, 84, 31, 60, 197, 92, 141, 159, 11, 55, 54, 20, 184, 35, 60, 59,
+    199, 81, 166, 235, 101, 109, 5, 92, 141, 146, 174, 41, 248, 72, 176, 171, 145, 103, 223, 198, 8, 179, 188, 72,
+    74, 21, 114, 52, 231, 80, 90, 161, 27, 35, 219, 160, 232, 255, 126, 117, 100, 149, 223, 94, 128, 239, 114, 46,
+    186, 92, 78, 87, 119, 192, 211, 157, 89, 37, 119, 212, 44, 132, 19, 178, 100, 175, 188, 245, 7, 43, 186, 182,
+    130, 29, 245, 3, 133, 171, 141, 159, 11, 55, 54, 23, 72, 183, 14, 246, 25, 225, 222, 36, 35, 88, 120, 193,
+    76, 174, 98, 69, 93, 40, 77, 65, 172, 174, 19, 14, 218, 10, 185, 28, 38, 49, 61, 135, 218, 140, 198, 36,
+    43, 9, 202, 238, 248, 25, 62, 30, 36, 93, 27, 65, 156, 62, 162, 174, 68, 38, 116, 98, 122, 142, 46, 184,
+    34, 174, 70, 18, 52, 34, 114, 120, 62, 29, 34, 193, 26, 195, 194, 79, 147, 94, 19, 24, 23, 119, 218, 68,
+    210, 53, 132, 20, 183, 35, 55, 129, 87, 33, 143, 206, 134, 137, 169, 15, 3, 104, 76, 169, 114, 61, 135, 248,
+    125, 195, 61, 46, 68, 35, 7, 222, 131, 230, 54, 194, 100, 70, 202, 114, 33, 243, 27, 38, 198, 4, 173, 82,
+    182, 129, 216, 85, 200, 241, 130, 153, 92, 196, 246, 232, 252, 246, 92, 188, 239, 183, 232, 54, 92, 188, 239, 176,
+    131, 147, 250, 49, 200, 86, 154, 141, 242, 165, 118, 145, 251, 198, 201, 161, 31, 95, 211, 244, 116, 254, 173, 70,
+    36, 229, 74, 236, 31, 49, 236, 62, 9, 140, 4, 107, 15, 120, 248, 38, 49, 208, 246, 161, 87, 33, 90, 140,
+    73, 202, 149, 216, 62, 99, 216, 124, 19, 24, 8, 214, 30, 241, 240, 76, 99, 168, 171, 145, 147, 196, 45, 158,
+    36, 120, 132, 108, 174, 31, 60, 194, 176, 178, 231, 153, 130, 212, 44, 176, 114, 165, 118, 158, 163, 133, 171, 143,
+    120, 248, 38, 48, 48, 82, 202, 218, 10, 126, 18, 44, 16, 126, 187, 169, 163, 2, 78, 84, 174, 193, 243, 21,
+    114, 39, 43, 187, 227, 176, 239, 114, 56, 76, 98, 66, 65, 24, 86, 54, 28, 45, 92, 120, 223, 24, 52, 172,
+    60, 58, 69, 164, 77, 223, 140, 146, 85, 180, 19, 91, 216, 181, 4, 202, 234, 125, 29, 75, 84, 245, 8, 214,
+    21, 114, 51, 195, 188, 10, 92, 25, 25, 188, 106, 16, 78, 254, 43, 4, 108, 149, 70, 24, 85, 210, 134, 155,
+    173, 140, 138, 185, 28, 39, 34, 175, 15, 190, 151, 21, 114, 56, 56, 199, 239, 194, 208, 157, 147, 35, 219, 160,
+    232, 247, 143, 130, 99, 29, 0, 247, 143, 130, 99, 1, 100, 32, 253, 119, 83, 70, 6, 79, 16, 182, 120, 28,
+    45, 92, 102, 120, 48, 50, 194, 76, 195, 190, 179, 212, 113, 115, 4, 120, 223, 24, 52, 172, 60, 58, 69, 164,
+    89, 103, 108, 39, 35, 103, 154, 49, 35, 55, 129, 87, 35, 125, 178, 125, 85, 180, 27, 97, 57, 9, 135, 109,
+    37, 108, 68, 214, 246, 45, 65, 34, 184, 120, 243, 216, 119, 185, 18, 249, 208, 194, 233, 122, 86, 208, 35, 88,
+    49, 74, 199, 33, 34, 17, 180, 54, 24, 124, 188, 152, 145, 162, 250, 33, 104, 32, 201, 49, 168, 74, 213, 231,
+    107, 152, 61, 70, 10, 89, 91, 65, 164, 37, 183, 76, 99, 145, 79, 194, 69, 133, 92, 140, 25, 145, 227, 121,
+    228, 73, 202, 149, 218, 67, 230, 42, 228, 78, 87, 119, 199, 64, 232, 247, 143, 130, 99, 29, 0, 247, 143, 130,
+    99, 1, 100, 32, 253, 119, 83, 70, 6, 79, 16, 182, 120, 28, 45, 92, 102, 120, 48, 50, 194, 76, 195, 190,
+    179, 212, 113, 115, 4, 120, 223, 24, 52, 172, 60, 58, 69, 164, 89, 103, 108, 39, 35, 103, 154, 49, 35, 55,
+    129, 87, 35, 125, 178, 125, 85, 180, 27, 97, 57, 9, 135, 109, 37, 108, 68, 214, 246, 45, 65, 34, 184, 120,
+    243, 216, 119, 185, 18, 249, 208, 194, 233, 122, 86, 208, 35, 88, 49, 74, 199, 33, 34, 17, 180, 54, 24, 124,
+    188, 152, 145, 162, 250, 33, 104, 32, 201, 49, 168, 74, 213, 231, 107, 152, 61, 70, 10, 89, 91, 65, 164, 37,
+    183, 76, 99, 145, 79, 194, 69, 133, 92, 140, 25, 145, 227, 121, 228, 73, 202, 149, 218, 67, 230, 42, 228, 78,
+    87, 119, 199, 97, 221, 197, 92, 142, 12, 215, 81, 87, 35, 219, 123, 45, 60, 46, 250, 139, 59, 196, 137, 164,
+    107, 7, 216, 183, 110, 128, 232, 246, 222, 203, 79, 11, 190, 189, 0, 239, 114, 19, 123, 45, 60, 46, 250, 133,
+    145, 101, 215, 28, 140, 45, 117, 28, 45, 92, 67, 241, 33, 243, 27, 99, 121, 184, 146, 149, 35, 52, 201, 91,
+    65, 87, 34, 105, 52, 61, 71, 23, 92, 174, 22, 68, 154, 25, 188, 10, 185, 27, 237, 147, 234, 173, 160, 219,
+    9, 207, 81, 222, 228, 126, 75, 251, 36, 88, 62, 99, 251, 254, 221, 135, 123, 145, 52, 154, 16, 178, 18, 207,
+    12, 108, 56, 90, 184, 201, 240, 241, 158, 248, 30, 19, 47, 54, 135, 218, 67, 230, 16, 113, 117, 214, 87, 36,
+    192, 228, 227, 15, 192, 241, 11, 151, 145, 14, 150, 8, 214, 30, 151, 196, 35, 80, 210, 9, 97, 247, 234, 97,
+    49, 97, 239, 90, 231, 168, 226, 235, 130, 54, 135, 218, 70, 23, 201, 8, 39, 36, 131, 148, 63, 1, 26, 194,
+    149, 134, 168, 194, 105, 26, 194, 10, 91, 144, 172, 42, 228, 112, 173, 164, 245, 28, 34, 210, 182, 131, 55, 129,
+    87, 43, 2, 183, 134, 10, 194, 174, 68, 236, 245, 133, 210, 245, 216, 123, 72, 229, 247, 7, 231, 182, 30, 8,
+    171, 145, 52, 154, 17, 203, 238, 44, 179, 147, 250, 48, 54, 72, 160, 249, 138, 185, 16, 114, 127, 70, 57, 10,
+    211, 81, 190, 84, 174, 210, 44, 179, 166, 235, 38, 193, 36, 32, 219, 9, 207, 133, 198, 59, 116, 252, 246, 92,
+    188, 239, 183, 232, 54, 92, 188, 239, 176, 131, 147, 250, 49, 200, 86, 154, 141, 242, 165, 118, 145, 251, 198, 201,
+    161, 31, 199, 233, 250, 58, 0, 254, 173, 70, 36, 229, 74, 236, 31, 49, 236, 62, 9, 140, 4, 107, 15, 184,
+    124, 19, 24, 232, 246, 31, 4, 198, 2, 53, 135, 220, 62, 9, 140, 5, 106, 49, 39, 42, 9, 65, 7, 141,
+    231, 145, 147, 195, 24, 28, 92, 193, 19, 91, 216, 181, 72, 124, 232, 176, 217, 55, 146, 60, 26, 224, 150, 25,
+    97, 38, 76, 245, 28, 45, 92, 125, 195, 224, 152, 192, 193, 75, 43, 104, 41, 248, 72, 176, 171, 145, 57, 41,
+    108, 136, 194, 120, 158, 195, 189, 200, 225, 49, 137, 9, 4, 97, 88, 216, 112, 181, 112, 109, 190, 73, 74, 236,
+    152, 27, 60, 209, 137, 8, 214, 25, 99, 127, 1, 25, 159, 118, 200, 234, 90, 167, 168, 226, 235, 130, 16, 102,
+    120, 30, 11, 101, 115, 35, 104, 127, 75, 98, 39, 103, 169, 20, 226, 86, 135, 130, 197, 42, 226, 174, 71, 136,
+    93, 47, 65, 253, 24, 185, 75, 12, 46, 151, 169, 21, 116, 160, 184, 198, 250, 171, 37, 17, 87, 35, 131, 140,
+    126, 254, 30, 24, 82, 224, 216, 103, 135, 120, 158, 221, 0, 232, 251, 135, 193, 49, 142, 128, 251, 135, 193, 49,
+    128, 178, 48, 172, 108, 56, 90, 184, 156, 148, 182, 68, 101, 132, 153, 135, 125, 100, 35, 88, 97, 60, 79, 81,
+    194, 213, 198, 207, 52, 98, 67, 230, 42, 228, 108, 97, 94, 203, 144, 164, 241, 130, 17, 172, 39, 37, 45, 75,
+    154, 228, 44, 169, 164, 38, 178, 44, 114, 120, 74, 86, 208, 85, 200, 225, 49, 137, 236, 59, 220, 143, 16, 186,
+    94, 134, 23, 75, 212, 135, 244, 98, 229, 44, 32, 231, 131, 149, 7, 207, 49, 87, 34, 151, 6, 195, 60, 59,
+    199, 81, 130, 150, 86, 208, 85, 200, 225, 57, 22, 126, 24, 32, 201, 226, 22, 207, 2, 174, 148, 51, 39, 18,
+    51, 124, 183, 147, 96, 141, 97, 53, 189, 149, 247, 158, 221, 0, 232, 251, 135, 193, 49, 142, 128, 251, 135, 193,
+    49, 128, 178, 48, 172, 108, 56, 90, 184, 156, 148, 182, 68, 101, 132, 153, 135, 125, 100, 35, 88, 97, 60, 79,
+    81, 194, 213, 198, 207, 52, 98, 67, 230, 42, 228, 108, 97, 94, 203, 144, 164, 241, 130, 17, 172, 39, 37, 45,
+    75, 154, 228, 44, 169, 164, 38, 178, 44, 114, 120, 74, 86, 208, 85, 200, 225, 49, 137, 236, 59, 220, 143, 16,
+    186, 94, 134, 23, 75, 212, 135, 244, 98, 229, 44, 32, 231, 131, 149, 7, 207, 49, 87, 34, 151, 6, 195, 60,
+    59, 199, 81, 130, 150, 86, 208, 85, 200, 225, 57, 22, 126, 24, 32, 201, 226, 22, 207, 2, 174, 148, 51, 39,
+    18, 51, 124, 183, 147, 96, 141, 97, 53, 189, 149, 247, 158, 221, 0, 232, 254, 173, 70, 36, 229, 74, 236, 31,
+    49, 236, 62, 9, 140, 4, 107, 15, 188, 124, 19, 24, 232, 246, 161, 87, 33, 90, 140, 73, 202, 149, 216, 62,
+    99, 216, 124, 19, 24, 8, 214, 31, 120, 248, 38, 49, 212, 85, 200, 74, 213, 231, 107, 152, 33, 100, 97, 125,
+    28, 115, 212, 112, 181, 113, 247, 143, 130, 99, 0, 252, 232, 181, 149, 180, 20, 252, 36, 88, 85, 200, 163, 149,
+    217, 240, 250, 114, 50, 194, 76, 195, 190, 178, 17, 172, 48, 158, 39, 176, 239, 114, 56, 76, 98, 66, 65, 9,
+    103, 134, 54, 28, 45, 92, 108, 243, 70, 36, 77, 223, 140, 146, 85, 180, 20, 114, 184, 218, 31, 252, 156, 170,
+    66, 53, 130, 179, 63, 164, 165, 118, 158, 163, 139, 174, 8, 195, 229, 228, 196, 140, 43, 17, 225, 234, 226, 86,
+    198, 67, 230, 42, 228, 100, 241, 11, 103, 142, 163, 40, 41, 74, 218, 4, 30, 151, 196, 35, 80, 157, 147, 34,
+    51, 92, 96, 216, 112, 181, 113, 148, 20, 165, 244, 181, 200, 70, 176, 213, 236, 97, 134, 10, 67, 43, 105, 219,
+    160, 232, 251, 199, 193, 49, 142, 128, 251, 199, 193, 49, 128, 178, 16, 91, 150, 77, 87, 33, 147, 196, 45, 158,
+    5, 141, 151, 36, 163, 97, 78, 40, 229, 118, 124, 62, 156, 245, 24, 86, 54, 28, 45, 92, 101, 132, 153, 135,
+    125, 100, 31, 215, 117, 219, 99, 97, 155, 192, 186, 53, 167, 247, 187, 12, 20, 134, 86, 208, 35, 88, 43, 51,
+    250, 74, 87, 110, 195, 222, 248, 120, 207, 124, 13, 158, 104, 196, 140, 202, 86, 240, 173, 160, 163, 149, 198, 208,
+    255, 228, 229, 82, 17, 172, 50, 123, 43, 104, 50, 118, 200, 237, 82, 44, 114, 120, 74, 34, 174, 71, 9, 140,
+    79, 81, 197, 215, 4, 82, 120, 193, 144, 141, 97, 195, 199, 153, 164, 165, 118, 145, 52, 141, 97, 5, 45, 200,
+    205, 224, 103, 189, 111, 4, 100, 248, 194, 120, 120, 74, 87, 105, 8, 214, 25, 65, 74, 95, 68, 109, 15, 254,
+    78, 85, 33, 88, 85, 214, 65, 99, 26, 26, 92, 132, 236, 153, 30, 221, 0, 232, 254, 173, 70, 36, 229, 74,
+    236, 31, 49, 247, 143, 130, 99, 1, 26, 195, 222, 250, 237, 189, 24, 31, 217, 60, 15, 130, 99, 28, 39, 61,
+    0, 246, 161, 87, 33, 90, 140, 73, 202, 149, 216, 62, 99, 239, 31, 4, 198, 2, 53, 133, 92, 143, 123, 235,
+    182, 244, 96, 127, 100, 240, 46, 152, 199, 9, 207, 81, 87, 34, 118, 76, 136, 241, 191, 237, 251, 25, 28, 45,
+    92, 108, 244, 90, 149, 49, 212, 102, 82, 183, 133, 109, 6, 18, 52, 35, 133, 107, 63, 18, 42, 233, 67, 6,
+    130, 176, 100, 173, 225, 48, 48, 186, 94, 187, 14, 247, 35, 132, 198, 36, 36, 16, 150, 120, 99, 97, 194, 213,
+    197, 28, 175, 251, 224, 225, 40, 216, 108, 243, 70, 39, 168, 226, 235, 130, 24, 164, 120, 228, 89, 222, 36, 96,
+    165, 133, 56, 171, 145, 147, 235, 182, 244, 96, 97, 60, 79, 81, 180, 62, 171, 42, 218, 4, 23, 223, 192, 124,
+    197, 151, 69, 164, 192, 202, 10, 82, 250, 90, 228, 35, 88, 96, 164, 50, 182, 157, 186, 0, 232, 247, 190, 187,
+    111, 70, 7, 246, 79, 3, 224, 152, 199, 9, 207, 64, 246, 161, 87, 33, 90, 140, 73, 202, 149, 216, 62, 99,
+    239, 31, 4, 198, 2, 53, 133, 92, 143, 123, 235, 182, 244, 96, 127, 100, 240, 46, 152, 199, 9, 207, 81, 87,
+    34, 118, 76, 136, 241, 191, 237, 251, 25, 28, 45, 92, 108, 244, 90, 149, 49, 212, 102, 82, 183, 133, 109, 6,
+    18, 52, 35, 133, 107, 63, 18, 42, 233, 67, 6, 130, 176, 100, 173, 225, 48, 48, 186, 94, 187, 14, 247, 35,
+    132, 198, 36, 36, 16, 150, 120, 99, 97, 194, 213, 197, 28, 175, 251, 224, 225, 40, 216, 108, 243, 70, 39, 168,
+    226, 235, 130, 24, 164, 120, 228, 89, 222, 36, 96, 165, 133, 56, 171, 145, 147, 235, 182, 244, 96, 97, 60, 79,
+    81, 180, 62, 171, 42, 218, 4, 23, 223, 192, 124, 197, 151, 69, 164, 192, 202, 10, 82, 250, 90, 228, 35, 88,
+    96, 164, 50, 182, 157, 186, 0, 232, 247, 190, 187, 111, 70, 7, 246, 79, 29, 0, 239, 114, 50, 125, 118, 222,
+    140, 12, 39, 128, 178, 16, 120, 133, 210, 245, 212, 106, 246, 48, 194, 118, 76, 136, 205, 113, 131, 97, 194, 213,
+    196, 63, 18, 31, 49, 56, 39, 200, 177, 159, 52, 251, 12, 159, 93, 183, 163, 19, 212, 20, 202, 224, 254, 187,
+    174, 219, 27, 14, 22, 174, 42, 228, 97, 40, 205, 9, 124, 235, 132, 130, 51, 120, 19, 91, 216, 181, 72, 167,
+    27, 201, 236, 63, 178, 70, 132, 112, 173, 103, 226, 70, 208, 254, 150, 196, 38, 187, 96, 134, 74, 222, 19, 3,
+    11, 165, 235, 168, 226, 235, 130, 60, 111, 140, 26, 86, 30, 29, 34, 210, 44, 179, 182, 19, 145, 147, 217, 91,
+    65, 75, 180, 132, 107, 13, 161, 255, 201, 202, 134, 155, 173, 142, 21, 140, 245, 25, 65, 74, 86, 208, 35, 5,
+    111, 75, 74, 218, 4, 173, 94, 118, 185, 130, 51, 120, 24, 41, 12, 173, 160, 70, 176, 201, 241, 132, 240, 240,
+    148, 174, 221, 135, 181, 82, 101, 115, 97, 78, 42, 228, 113, 117, 163, 225, 210, 44, 22, 66, 13, 147, 66, 31,
+    49, 87, 34, 14, 79, 232, 199, 33, 90, 106, 55, 202, 149, 218, 123, 116, 252, 246, 92, 188, 239, 183, 232, 54,
+    92, 188, 239, 176, 131, 147, 250, 49, 200, 86, 154, 141, 242, 165, 118, 145, 251, 198, 201, 161, 31, 87, 211, 244,
+    116, 254, 173, 70, 36, 229, 74, 236, 31, 49, 236, 62, 9, 140, 4, 107, 15, 232, 62, 9, 140, 116, 246, 161,
+    87, 33, 90, 140, 73, 202, 149, 216, 62, 99, 216, 124, 19, 24, 8, 214, 31, 208, 124, 19, 24, 234, 42, 228,
+    37, 106, 243, 181, 204, 17, 55, 92, 234, 69, 56, 65, 133, 163, 9, 28, 140, 223, 45, 231, 168, 225, 106, 227,
+    250, 15, 130, 99, 3, 5, 44, 173, 160, 167, 225, 34, 194, 174, 71, 222, 218, 97, 102, 227, 44, 36, 204, 59,
+    235, 61, 135, 123, 145, 194, 99, 18, 18, 8, 177, 201, 225, 40, 216, 112, 181, 112, 173, 59, 44, 43, 104, 63,
+    93, 222, 140, 140, 225, 245, 25, 166, 175, 188, 132, 222, 174, 241, 33, 26, 194, 203, 59, 97, 57, 144, 249, 137,
+    173, 236, 90, 135, 16, 180, 173, 167, 81, 148, 20, 165, 109, 2, 14, 18, 53, 8, 214, 10, 222, 150, 149, 180,
+    19, 178, 100, 70, 111, 2, 203, 57, 111, 50, 174, 210, 19, 195, 239, 67, 11, 70, 18, 183, 130, 17, 172, 48,
+    141, 166, 233, 161, 237, 208, 232, 254, 131, 224, 152, 199, 64, 254, 131, 224, 152, 192, 89, 8, 56, 56, 201, 245,
+    86, 208, 100, 241, 11, 103, 129, 99, 101, 201, 40, 216, 83, 143, 189, 180, 194, 205, 196, 214, 246, 83, 61, 70,
+    21, 141, 135, 11, 87, 25, 97, 38, 97, 223, 89, 9, 103, 134, 54, 28, 45, 92, 108, 243, 70, 36, 62, 99,
+    44, 36, 202, 228, 48, 180, 97, 43, 120, 33, 26, 195, 39, 106, 58, 236, 240, 145, 200, 77, 234, 239, 19, 216,
+    119, 185, 28, 38, 49, 35, 50, 149, 188, 17, 101, 157, 176, 156, 200, 124, 196, 214, 246, 45, 67, 136, 90, 86,
+    208, 35, 88, 108, 230, 163, 158, 163, 40, 41, 74, 218, 4, 96, 173, 59, 44, 43, 104, 18, 181, 121, 218, 230,
+    8, 226, 230, 8, 202, 10, 82, 250, 90, 228, 35, 88, 101, 11, 75, 146, 96, 85, 213, 188, 171, 104, 42, 240,
+    190, 143, 81, 197, 215, 4, 100, 255, 183, 34, 10, 89, 91, 64, 206, 254, 100, 43, 122, 90, 35, 245, 221, 77,
+    8, 57, 224, 229, 74, 237, 219, 160, 232, 254, 219, 182, 87, 31, 23, 125, 122, 0, 239, 114, 46, 186, 92, 78,
+    87, 119, 192, 198, 237, 149, 225, 223, 80, 178, 63, 93, 212, 215, 81, 194, 213, 196, 210, 103, 152, 212, 235, 224,
+    196, 137, 201, 42, 140, 27, 4, 161, 87, 35, 14, 218, 10, 79, 24, 51, 212, 82, 121, 86, 208, 32, 241, 5,
+    60, 135, 129, 146, 86, 87, 86, 208, 111, 176, 225, 106, 224, 166, 87, 15, 87, 49, 216, 119, 185, 16, 239, 168,
+    204, 156, 72, 201, 49, 175, 81, 194, 213, 195, 182, 57, 21, 114, 31, 44, 146, 85, 217, 48, 53, 222, 53, 222,
+    3, 230, 50, 118, 244, 98, 82, 149, 216, 35, 88, 85, 200, 203, 10, 222, 67, 230, 50, 124, 243, 36, 107, 190,
+    146, 60, 65, 79, 42, 218, 10, 185, 19, 75, 140, 49, 153, 234, 56, 186, 224, 141, 158, 104, 196, 135, 97, 87,
+    35, 132, 198, 36, 37, 172, 16, 83, 239, 149, 195, 230, 50, 124, 60, 10, 113, 87, 34, 118, 76, 143, 97, 246,
+    195, 240, 195, 194, 104, 49, 187, 101, 115, 35, 55, 129, 87, 34, 105, 51, 204, 74, 208, 118, 14, 196, 62, 98,
+    174, 69, 39, 140, 25, 237, 208, 252, 246, 92, 188, 239, 183, 232, 54, 92, 188, 239, 176, 198, 237, 149, 198, 111,
+    3, 250, 247, 31, 45, 142, 74, 152, 89, 175, 167, 232, 232, 255, 133, 172, 174, 91, 160, 239, 114, 46, 186, 92,
+    78, 87, 119, 192, 242, 181, 149, 203, 5, 144, 131, 198, 243, 88, 86, 208, 78, 201, 145, 28, 45, 92, 77, 34,
+    182, 12, 200, 154, 39, 3, 39, 221, 168, 196, 245, 24, 72, 208, 135, 244, 90, 122, 132, 107, 10, 185, 23, 223,
+    80, 249, 133, 107, 111, 53, 10, 152, 9, 182, 216, 84, 108, 140, 246, 29, 225, 57, 144, 249, 140, 221, 236, 18,
+    8, 218, 14, 201, 6, 193, 88, 49, 74, 16, 252, 79, 81, 197, 215, 4, 85, 200, 72, 125, 80, 62, 99, 56,
+    51, 124, 114, 50, 119, 242, 108, 53, 41, 137, 25, 174, 49, 34, 174, 66, 44, 118, 30, 194, 119, 157, 151, 37,
+    125, 231, 28, 135, 222, 131, 230, 54, 194, 100, 70, 78, 254, 124, 59, 249, 18, 181, 33, 216, 85, 200, 203, 122,
+    165, 109, 7, 135, 72, 176, 225, 106, 225, 6, 202, 114, 33, 243, 27, 38, 198, 4, 210, 229, 229, 91, 64, 251,
+    215, 110, 128, 252, 246, 92, 188, 239, 183, 232, 54, 92, 188, 239, 176, 131, 147, 250, 49, 200, 86, 154, 141, 242,
+    165, 118, 145, 251, 198, 201, 161, 31, 103, 211, 244, 116, 248, 187, 234, 63, 143, 217, 252, 122, 0, 251, 245, 218,
+    185, 31, 23, 125, 71, 238, 31, 199, 236, 254, 61, 0, 232, 248, 187, 234, 63, 143, 217, 245, 244, 251, 245, 218,
+    185, 31, 23, 125, 71, 238, 31, 199, 236, 250, 250, 0, 232, 248, 187, 234, 63, 143, 217, 246, 116, 251, 245, 218,
+    185, 31, 23, 125, 71, 238, 31, 199, 236, 251, 58, 0, 232, 248, 187, 234, 63, 143, 217, 252, 186, 0, 251, 245,
+    218, 185, 31, 23, 125, 71, 238, 31, 199, 236, 254, 93, 0, 232, 248, 187, 234, 63, 143, 217, 254, 157, 0, 251,
+    245, 218, 185, 31, 23, 125, 71, 238, 31, 199, 236, 255, 78, 128, 232, 248, 187, 234, 63, 143, 217, 252, 250, 0,
+    251, 245, 218, 185, 31, 23, 125, 71, 238, 31, 199, 236, 254, 125, 0, 232, 248, 187, 234, 63, 143, 217, 254, 189,
+    0, 251, 245, 218, 185, 31, 23, 125, 71, 238, 31, 199, 236, 255, 94, 128, 232, 248, 187, 234, 63, 143, 217, 254,
+    221, 0, 251, 245, 218, 185, 31, 23, 125, 71, 238, 31, 199, 236, 255, 110, 128, 232, 248, 46, 151, 225, 57, 20,
+    227, 242, 92, 174, 180, 131, 56, 125, 71, 223, 140, 79, 15, 21, 126, 128, 255, 15, 184, 72, 33, 216, 85, 200,
+    186, 233, 126, 19, 145, 130, 150, 86, 208, 103, 15, 168, 251, 241, 137, 225, 226, 174, 41, 199, 228, 185, 93, 105,
+    59, 14, 247, 33, 246, 44, 33, 210, 194, 106, 13, 101, 115, 33, 46, 82, 221, 71, 135, 139, 24, 54, 30, 57,
+    16, 248, 194, 182, 131, 108, 34, 180, 132, 107, 10, 185, 15, 150, 73, 42, 236, 152, 25, 99, 121, 163, 1, 243,
+    21, 4, 207, 97, 222, 228, 78, 236, 38, 234, 198, 71, 136, 93, 47, 88, 231, 168, 70, 176, 65, 153, 224, 100,
+    145, 35, 100, 153, 30, 57, 236, 61, 168, 32, 98, 145, 227, 145, 6, 104, 77, 62, 221, 69, 66, 122, 56, 49,
+    34, 14, 107, 140, 10, 185, 88, 28, 37, 24, 30, 30, 171, 6, 122, 137, 125, 72, 124, 197, 92, 234, 52, 133,
+    213, 50, 86, 208, 37, 10, 185, 15, 107, 10, 73, 162, 17, 172, 53, 222, 53, 222, 21, 180, 9, 225, 247, 161,
+    87, 35, 132, 163, 3, 245, 221, 48, 181, 200, 86, 31, 126, 49, 60, 60, 85, 251, 116, 232, 248, 46, 151, 225,
+    57, 31, 207, 248, 10, 113, 254, 238, 246, 194, 53, 130, 53, 135, 223, 140, 79, 15, 21, 126, 128, 255, 15, 184,
+    205, 90, 195, 151, 222, 36, 227, 48, 236, 62, 11, 165, 248, 78, 71, 243, 254, 29, 69, 202, 89, 91, 65, 193,
+    154, 20, 252, 36, 88, 127, 187, 189, 176, 141, 110, 195, 189, 200, 194, 53, 167, 36, 216, 133, 144, 131, 87, 148,
+    92, 131, 230, 52, 124, 88, 176, 205, 78, 45, 35, 118, 177, 128, 131, 210, 77, 9, 243, 207, 97, 246, 174, 49,
+    225, 210, 45, 33, 45, 232, 197, 44, 145, 135, 201, 48, 18, 170, 19, 42, 87, 105, 234, 60, 111, 65, 216, 140,
+    146, 178, 185, 145, 203, 239, 0, 242, 127, 250, 30, 239, 191, 24, 158, 30, 42, 227, 242, 74, 48, 63, 172, 206,
+    230, 127, 243, 254, 191, 239, 237, 122, 172, 27, 15, 201, 40, 192, 246, 244, 139, 132, 241, 130, 61, 174, 82, 221,
+    189, 195, 216, 100, 251, 237, 130, 18, 130, 8, 116, 180, 173, 136, 154, 70, 176, 178, 206, 91, 204, 138, 185, 19,
+    80, 141, 161, 20, 147, 68, 62, 98, 174, 71, 9, 70, 5, 92, 243, 238, 244, 65, 108, 159, 118, 163, 6, 221,
+    186, 0, 232, 248, 46, 151, 225, 57, 30, 13, 112, 75, 15, 191, 24, 158, 30, 42, 225, 26, 195, 187, 236, 124,
+    167, 64, 239, 117, 145, 53, 6, 178, 184, 124, 199, 193, 116, 191, 9, 200, 254, 127, 192, 96, 165, 164, 20, 154,
+    20, 252, 36, 88, 119, 125, 143, 148, 236, 59, 220, 143, 242, 251, 195, 30, 66, 200, 147, 5, 143, 81, 194, 213,
+    198, 171, 131, 33, 243, 15, 177, 97, 14, 150, 8, 214, 22, 89, 164, 106, 23, 120, 95, 217, 218, 123, 15, 97,
+    154, 106, 184, 228, 109, 190, 49, 33, 253, 24, 20, 227, 43, 156, 188, 138, 185, 88, 26, 166, 221, 69, 92, 143,
+    43, 105, 25, 62, 187, 97, 21, 149, 180, 9, 225, 247, 161, 87, 35, 61, 217, 185, 20, 147, 68, 43, 10, 185,
+    88, 28, 37, 24, 30, 30, 171, 6, 123, 14, 247, 35, 100, 130, 213, 32, 252, 242, 186, 54, 132, 112, 241, 10,
+    108, 52, 194, 54, 70, 122, 141, 75, 82, 187, 43, 104, 42, 228, 65, 200, 181, 6, 60, 72, 79, 15, 189, 15,
+    191, 24, 158, 30, 42, 254, 233, 28, 37, 24, 19, 190, 219, 99, 158, 221, 0, 232, 251, 159, 125, 48, 146, 61,
+    189, 22, 220, 244, 251, 159, 125, 48, 146, 61, 189, 22, 220, 137, 49, 232, 200, 73, 30, 30, 174, 16, 106, 138,
+    194, 106, 9, 160, 141, 96, 130, 235, 165, 248, 78, 65, 249, 209, 107, 43, 104, 60, 30, 93, 172, 42, 228, 100,
+    181, 200, 200, 181, 24, 236, 59, 220, 132, 244, 91, 114, 22, 70, 21, 141, 135, 11, 87, 31, 174, 232, 173, 66,
+    110, 251, 72, 70, 176, 186, 205, 60, 46, 67, 198, 235, 139, 43, 105, 61, 135, 246, 124, 147, 18, 38, 161, 241,
+    128, 152, 118, 208, 85, 200, 149, 177, 225, 49, 230, 122, 138, 187, 239, 165, 199, 47, 184, 103, 165, 200, 137, 125,
+    72, 201, 219, 209, 137, 74, 87, 105, 9, 4, 82, 182, 134, 195, 133, 171, 140, 157, 178, 48, 193, 253, 24, 21,
+    114, 54, 57, 111, 133, 72, 20, 147, 68, 62, 98, 174, 69, 63, 13, 238, 145, 194, 81, 142, 195, 216, 89, 244,
+    16, 115, 222, 76, 138, 113, 104, 86, 242, 51, 135, 212, 32, 219, 123, 91, 7, 168, 150, 92, 243, 86, 208, 45,
+    12, 147, 122, 87, 222, 113, 207, 110, 128, 232, 251, 159, 125, 48, 146, 17, 172, 63, 4, 86, 232, 246, 161, 87,
+    35, 198, 243, 88, 86, 208, 43, 81, 137, 57, 82, 187, 7, 204, 125, 207, 190, 152, 73, 8, 214, 31, 130, 43,
+    117, 19, 170, 99, 2, 110, 251, 72, 178, 206, 216, 78, 70, 79, 135, 140, 247, 192, 78, 25, 91, 73, 8, 214,
+    10, 222, 150, 149, 180, 28, 43, 89, 248, 22, 89, 219, 9, 204, 246, 29, 238, 66, 67, 234, 129, 243, 25, 193,
+    155, 143, 16, 82, 195, 132, 206, 164, 103, 15, 168, 64, 197, 35, 199, 35, 194, 121, 49, 207, 97, 248, 151, 219,
+    4, 104, 149, 115, 1, 88, 78, 169, 140, 13, 33, 247, 218, 122, 137, 125, 72, 149, 219, 101, 109, 6, 112, 250,
+    140, 183, 218, 66, 53, 134, 144, 186, 166, 74, 218, 118, 30, 195, 100, 153, 49, 227, 145, 147, 235, 169, 106, 158,
+    163, 221, 240, 79, 68, 114, 251, 134, 122, 92, 141, 132, 190, 166, 174, 173, 160, 124, 243, 9, 225, 247, 161, 87,
+    35, 132, 163, 3, 9, 71, 28, 255, 247, 238, 232, 232, 251, 159, 125, 48, 146, 61, 189, 22, 220, 244, 247, 187,
+    82, 182, 234, 218, 4, 195, 182, 131, 238, 125, 244, 194, 72, 246, 244, 91, 115, 212, 85, 200, 185, 72, 160, 249,
+    138, 185, 20, 252, 48, 131, 232, 166, 36, 45, 72, 202, 233, 26, 246, 31, 211, 15, 193, 129, 225, 254, 102, 66,
+    89, 225, 135, 10, 214, 126, 39, 168, 70, 176, 240, 91, 43, 153, 15, 158, 102, 4, 25, 161, 224, 177, 74, 184,
+    155, 165, 185, 21, 4, 207, 97, 236, 51, 60, 8, 50, 182, 45, 82, 50, 186, 80, 125, 234, 86, 196, 32, 201,
+    51, 255, 231, 255, 221, 71, 141, 232, 85, 200, 222, 119, 76, 12, 174, 76, 5, 145, 100, 215, 98, 198, 221, 135,
+    187, 240, 228, 100, 249, 230, 72, 164, 154, 50, 38, 161, 27, 66, 41, 236, 156, 245, 247, 7, 98, 32, 234, 145,
+    230, 123, 15, 119, 225, 188, 208, 240, 68, 190, 166, 174, 173, 160, 86, 21, 114, 56, 74, 49, 219, 221, 208, 232,
+    251, 159, 125, 48, 146, 61, 189, 22, 220, 244, 251, 159, 125, 48, 146, 50, 118, 165, 109, 204, 138, 113, 87, 33,
+    158, 42, 225, 26, 194, 95, 122, 191, 81, 78, 42, 228, 20, 154, 11, 34, 174, 65, 106, 132, 108, 136, 124, 197,
+    92, 143, 191, 24, 151, 225, 226, 174, 63, 13, 217, 114, 93, 147, 3, 242, 74, 48, 62, 91, 237, 182, 57, 9,
+    109, 85, 150, 106, 18, 151, 209, 15, 158, 107, 145, 158, 221, 0, 232, 251, 241, 137, 225, 226, 174, 63, 36, 163,
+    3, 229, 190, 219, 99, 158, 128, 255, 15, 184, 72, 133, 244, 66, 80, 171, 145, 171, 216, 205, 4, 182, 170, 203,
+    53, 9, 75, 232, 135, 207, 53, 200, 135, 204, 85, 200, 201, 107, 145, 194, 81, 129, 147, 235, 178, 55, 61, 135,
+    123, 145, 227, 117, 197, 149, 180, 11, 35, 118, 73, 157, 245, 86, 211, 168, 225, 106, 225, 4, 174, 187, 96, 137,
+    93, 24, 39, 135, 244, 69, 92, 139, 59, 199, 97, 253, 90, 86, 199, 168, 58, 237, 135, 228, 153, 9, 4, 39,
+    141, 255, 111, 216, 112, 181, 112, 153, 82, 250, 90, 231, 168, 171, 149, 129, 154, 100, 100, 26, 202, 230, 195, 133,
+    171, 140, 157, 178, 48, 221, 135, 176, 225, 227, 201, 129, 52, 118, 144, 251, 215, 81, 55, 79, 42, 218, 11, 172,
+    139, 148, 176, 73, 23, 34, 147, 201, 144, 130, 87, 97, 156, 62, 161, 7, 135, 170, 193, 236, 61, 223, 145, 12,
+    77, 133, 56, 205, 126, 98, 174, 178, 56, 74, 48, 22, 103, 114, 37, 221, 186, 251, 133, 200, 215, 122, 163, 19,
+    216, 126, 41, 177, 137, 9, 4, 77, 65, 225, 130, 101, 15, 50, 42, 228, 88, 207, 158, 161, 26, 193, 6, 169,
+    176, 124, 197, 92, 140, 150, 185, 247, 72, 225, 40, 192, 194, 177, 145, 116, 109, 36, 59, 10, 185, 28, 38, 49,
+    216, 123, 13, 32, 150, 30, 79, 57, 36, 88, 97, 76, 140, 157, 167, 101, 203, 119, 222, 113, 200, 118, 21, 114,
+    44, 103, 207, 97, 222, 228, 106, 140, 154, 24, 24, 119, 243, 34, 106, 12, 201, 183, 81, 27, 248, 240, 173, 160,
+    186, 200, 163, 174, 216, 51, 216, 123, 191, 174, 97, 219, 28, 142, 8, 201, 247, 197, 134, 202, 219, 58, 181, 10,
+    185, 27, 67, 248, 193, 215, 175, 184, 92, 137, 93, 47, 61, 186, 0, 252, 252, 158, 114, 72, 183, 232, 61, 134,
+    144, 75, 15, 39, 156, 146, 44, 22, 67, 176, 171, 145, 99, 62, 123, 125, 63, 71, 64, 251, 159, 125, 48, 146,
+    61, 189, 22, 220, 244, 251, 159, 125, 48, 146, 61, 189, 22, 220, 140, 157, 169, 91, 115, 61, 71, 11, 87, 31,
+    35, 147, 181, 135, 202, 160, 154, 30, 33, 27, 43, 171, 104, 31, 60, 197, 56, 171, 144, 82, 107, 176, 239, 114,
+    38, 160, 154, 11, 35, 11, 232, 227, 158, 163, 198, 244, 42, 230, 15, 186, 66, 48, 221, 172, 99, 45, 226, 11,
+    80, 124, 198, 236, 82, 79, 97, 236, 52, 135, 223, 96, 249, 138, 37, 147, 67, 18, 52, 74, 185, 137, 9, 15,
+    187, 88, 32, 205, 247, 106, 69, 110, 162, 201, 10, 218, 2, 153, 92, 61, 92, 192, 167, 20, 147, 68, 85, 200,
+    225, 40, 199, 97, 222, 229, 96, 65, 76, 169, 93, 164, 66, 54, 132, 103, 15, 168, 178, 206, 155, 205, 10, 113,
+    147, 182, 70, 27, 168, 70, 176, 171, 158, 71, 235, 186, 229, 231, 28, 141, 95, 209, 14, 221, 186, 0, 232, 239,
+    117, 139, 15, 149, 65, 53, 208, 239, 117, 139, 15, 149, 65, 52, 22, 66, 15, 215, 117, 52, 96, 85, 222, 31,
+    125, 47, 154, 65, 24, 86, 54, 28, 45, 92, 106, 246, 51, 66, 239, 169, 144, 141, 97, 58, 166, 48, 60, 111,
+    42, 198, 100, 207, 97, 239, 186, 226, 208, 88, 109, 132, 228, 59, 10, 185, 18, 182, 60, 38, 60, 207, 81, 227,
+    122, 28, 190, 225, 253, 24, 185, 72, 8, 54, 72, 45, 67, 36, 198, 21, 180, 15, 189, 117, 30, 239, 185, 219,
+    221, 66, 208, 173, 228, 103, 15, 168, 171, 145, 119, 146, 41, 236, 156, 255, 254, 123, 135, 123, 145, 229, 109, 33,
+    158, 221, 68, 147, 170, 182, 152, 228, 39, 9, 4, 62, 98, 174, 66, 204, 238, 123, 116, 232, 254, 202, 217, 62,
+    24, 123, 122, 45, 185, 232, 254, 202, 217, 62, 24, 123, 122, 45, 185, 19, 80, 107, 43, 153, 12, 241, 87, 8,
+    214, 18, 251, 213, 250, 137, 49, 233, 91, 64, 146, 16, 120, 125, 218, 201, 28, 143, 6, 184, 37, 132, 25, 91,
+    22, 165, 76, 4, 130, 146, 17, 172, 42, 228, 43, 91, 121, 168, 84, 192, 147, 149, 60, 118, 29, 220, 85, 200,
+    224, 205, 117, 30, 13, 213, 172, 16, 101, 116, 86, 253, 248, 86, 242, 51, 45, 145, 234, 22, 69, 92, 142, 18,
+    140, 12, 211, 37, 194, 215, 61, 135, 119, 21, 114, 10, 77, 117, 21, 114, 56, 74, 48, 42, 10, 86, 165, 168,
+    109, 132, 106, 24, 119, 214, 123, 15, 97, 99, 133, 244, 99, 145, 81, 190, 94, 70, 219, 227, 18, 55, 219, 168,
+    221, 176, 233, 101, 109, 6, 73, 38, 67, 230, 60, 61, 86, 13, 135, 9, 70, 5, 56, 212, 154, 21, 114, 39,
+    123, 88, 176, 177, 213, 26, 221, 186, 0, 232, 254, 202, 217, 62, 24, 123, 122, 45, 185, 232, 246, 145, 203, 238,
+    54, 135, 200, 155, 4, 195, 182, 131, 251, 43, 100, 248, 97, 237, 232, 182, 231, 168, 171, 145, 153, 108, 149, 180,
+    15, 152, 171, 145, 194, 81, 129, 80, 82, 181, 45, 67, 108, 35, 80, 179, 234, 172, 148, 100, 85, 200, 41, 52,
+    97, 132, 173, 143, 97, 236, 56, 120, 242, 96, 77, 35, 90, 67, 239, 82, 182, 61, 68, 236, 83, 202, 182, 131,
+    120, 208, 181, 99, 144, 173, 78, 16, 109, 119, 99, 216, 123, 191, 229, 250, 142, 8, 186, 122, 45, 238, 161, 155,
+    238, 214, 21, 114, 37, 247, 140, 136, 228, 215, 95, 112, 185, 18, 156, 207, 97, 238, 252, 75, 237, 130, 18, 8,
+    208, 213, 43, 104, 37, 114, 243, 219, 220, 59, 220, 141, 33, 61, 45, 114, 31, 49, 87, 34, 86, 183, 74, 87,
+    96, 178, 54, 76, 108, 158, 48, 123, 116, 232, 254, 143, 188, 85, 199, 202, 160, 154, 232, 246, 161, 87, 33, 90,
+    140, 73, 202, 149, 216, 62, 99, 250, 62, 241, 87, 31, 42, 130, 104, 35, 88, 127, 101, 108, 159, 12, 61, 189,
+    22, 220, 245, 21, 114, 42, 19, 60, 215, 32, 178, 39, 100, 137, 61, 135, 123, 145, 194, 81, 129, 80, 82, 181,
+    45, 67, 108, 35, 87, 186, 70, 208, 255, 53, 213, 107, 144, 178, 15, 165, 177, 106, 234, 56, 90, 184, 217, 118,
+    50, 17, 172, 53, 76, 174, 172, 99, 145, 233, 101, 124, 96, 143, 7, 151, 107, 10, 185, 25, 150, 200, 246, 30,
+    195, 46, 114, 194, 205, 9, 167, 218, 69, 56, 131, 154, 227, 2, 235, 35, 195, 213, 96, 132, 160, 131, 109, 252,
+    97, 114, 20, 155, 117, 30, 55, 160, 153, 209, 128, 236, 68, 174, 221, 69, 200, 157, 150, 164, 45, 7, 222, 186,
+    139, 44, 233, 188, 209, 183, 110, 128, 232, 254, 143, 188, 85, 199, 202, 160, 154, 232, 254, 143, 188, 85, 199, 202,
+    160, 154, 25, 59, 82, 182, 230, 122, 140, 43, 27, 14, 22, 174, 41, 49, 128, 233, 230, 69, 93, 40, 100, 147,
+    66, 201, 182, 216, 54, 19, 116, 179, 241, 33, 216, 85, 200, 217, 61, 29, 75, 87, 97, 222, 228, 111, 59, 166,
+    4, 190, 237, 105, 15, 152, 171, 144, 197, 116, 191, 135, 139, 187, 216, 36, 17, 59, 248, 182, 230, 221, 135, 176,
+    222, 151, 11, 92, 142, 30, 60, 152, 25, 92, 229, 230, 66, 11, 243, 104, 70, 174, 162, 110, 158, 85, 180, 23,
+    89, 23, 41, 96, 153, 209, 129, 70, 105, 91, 65, 87, 35, 132, 163, 29, 135, 187, 189, 214, 66, 203, 123, 168,
+    104, 239, 110, 190, 225, 114, 53, 222, 168, 196, 246, 232, 232, 254, 143, 188, 85, 199, 202, 160, 154, 232, 246, 219,
+    104, 116, 202, 234, 218, 10, 185, 28, 37, 24, 21, 5, 43, 82, 212, 54, 194, 53, 117, 28, 190, 225, 158, 151,
+    34, 17, 130, 182, 80, 82, 77, 132, 156, 183, 133, 174, 70, 208, 100, 182, 71, 176, 239, 114, 17, 96, 100, 145,
+    10, 100, 32, 205, 21, 168, 101, 115, 170, 228, 152, 19, 145, 106, 236, 61, 135, 249, 125, 52, 48, 54, 73, 147,
+    35, 199, 61, 69, 204, 12, 211, 34, 39, 40, 221, 178, 185, 176, 86, 22, 89, 201, 245, 205, 226, 130, 72, 155,
+    145, 43, 180, 140, 225, 245, 8, 56, 74, 48, 60, 61, 86, 15, 97, 238, 238, 147, 70, 66, 113, 158, 248, 235,
+    238, 19, 114, 15, 207, 44, 34, 235, 34, 156, 51, 135, 98, 21, 134, 201, 20, 185, 111, 132, 142, 221, 0, 232,
+    251, 241, 137, 225, 226, 174, 63, 36, 163, 3, 188, 20, 173, 75, 80, 252, 112, 141, 93, 0, 249, 82, 53, 149,
+    180, 9, 66, 174, 65, 106, 132, 108, 136, 167, 21, 114, 56, 74, 48, 42, 10, 86, 165, 168, 109, 132, 106, 234,
+    16, 73, 203, 120, 90, 228, 105, 186, 69, 132, 229, 27, 210, 178, 254, 198, 71, 47, 191, 97, 238, 249, 82, 81,
+    28, 190, 240, 60, 111, 42, 198, 103, 175, 184, 92, 137, 78, 100, 102, 177, 174, 57, 236, 62, 211, 117, 107, 11,
+    174, 189, 69, 92, 140, 211, 37, 194, 215, 35, 198, 255, 183, 236, 100, 112, 181, 112, 153, 82, 250, 90, 231, 176,
+    252, 158, 60, 152, 145, 171, 250, 34, 251, 196, 41, 182, 57, 234, 17, 172, 19, 9, 26, 200, 201, 24, 120, 35,
+    52, 86, 172, 114, 46, 82, 44, 51, 135, 212, 112, 181, 117, 110, 195, 221, 249, 31, 119, 162, 52, 122, 8, 37,
+    107, 116, 165, 118, 23, 48, 122, 251, 133, 92, 141, 55, 72, 176, 75, 90, 123, 116, 252, 242, 185, 203, 202, 183,
+    232, 61, 247, 57, 121, 10, 195, 133, 171, 138, 185, 26, 110, 145, 110, 223, 79, 209, 208, 254, 143, 188, 85, 199,
+    202, 160, 154, 232, 254, 143, 188, 85, 199, 202, 160, 154, 23, 48, 66, 200, 194, 177, 176, 225, 106, 227, 39, 253,
+    185, 23, 125, 76, 132, 107, 14, 14, 49, 251, 232, 181, 141, 134, 137, 22, 45, 61, 135, 196, 202, 216, 181, 72,
+    72, 33, 247, 160, 236, 42, 229, 96, 108, 241, 149, 204, 245, 22, 89, 203, 121, 149, 109, 5, 92, 140, 37, 25,
+    160, 199, 137, 236, 61, 223, 212, 93, 44, 41, 197, 94, 31, 128, 251, 208, 215, 144, 90, 150, 8, 217, 232, 62,
+    98, 95, 125, 186, 251, 131, 177, 28, 62, 168, 195, 39, 215, 108, 34, 180, 246, 30, 238, 247, 35, 132, 163, 3,
+    84, 177, 11, 66, 146, 104, 138, 49, 11, 227, 7, 183, 184, 124, 12, 6, 43, 165, 252, 60, 6, 123, 72, 86,
+    19, 206, 187, 37, 95, 158, 221, 0, 232, 254, 143, 188, 85, 194, 53, 135, 228, 147, 117, 109, 41, 219, 160, 246,
+    161, 87, 33, 90, 140, 73, 202, 149, 216, 62, 99, 250, 62, 241, 87, 31, 42, 130, 104, 35, 88, 126, 73, 55,
+    86, 210, 157, 135, 183, 162, 219, 158, 161, 4, 234, 152, 192, 210, 31, 35, 28, 137, 167, 130, 38, 145, 173, 33,
+    216, 85, 200, 201, 225, 140, 118, 30, 194, 87, 70, 10, 194, 174, 71, 10, 214, 126, 4, 20, 180, 245, 30, 239,
+    181, 234, 176, 108, 63, 36, 163, 3, 228, 248, 176, 254, 251, 215, 111, 112, 246, 22, 56, 95, 70, 57, 21, 27,
+    229, 228, 110, 216, 116, 180, 140, 161, 40, 207, 81, 227, 122, 21, 115, 207, 186, 8, 253, 119, 92, 188, 227, 145,
+    44, 149, 149, 205, 134, 251, 15, 28, 132, 111, 154, 190, 242, 50, 222, 105, 245, 49, 61, 186, 0, 232, 252, 146,
+    110, 173, 165, 59, 15, 111, 69, 183, 61, 0, 252, 146, 110, 173, 165, 59, 15, 111, 69, 183, 34, 55, 105, 12,
+    241, 87, 8, 214, 18, 251, 213, 250, 140, 43, 27, 14, 22, 174, 50, 186, 70, 170, 218, 11, 190, 242, 103, 176,
+    246, 26, 162, 224, 100, 145, 10, 96, 106, 158, 76, 139, 172, 136, 125, 218, 211, 212, 120, 222, 134, 201, 188, 153,
+    20, 226, 147, 201, 8, 37, 118, 25, 195, 234, 46, 178, 51, 194, 79, 158, 195, 224, 70, 144, 186, 166, 70, 122,
+    141, 119, 170, 48, 173, 160, 79, 15, 189, 10, 185, 28, 37, 24, 247, 72, 123, 88, 82, 77, 30, 195, 221, 248,
+    39, 62, 8, 254, 162, 110, 251, 226, 194, 120, 90, 202, 226, 156, 100, 249, 230, 79, 95, 112, 185, 31, 229, 252,
+    153, 23, 76, 103, 251, 238, 82, 40, 219, 28, 246, 232, 232, 252, 146, 110, 173, 165, 59, 15, 111, 69, 183, 61,
+    0, 247, 187, 82, 182, 234, 218, 4, 195, 182, 131, 242, 73, 186, 182, 148, 236, 61, 189, 22, 220, 245, 28, 190,
+    225, 158, 151, 34, 48, 156, 52, 138, 222, 25, 91, 65, 226, 31, 134, 22, 51, 178, 209, 21, 114, 39, 104, 86,
+    243, 131, 18, 35, 118, 101, 109, 59, 15, 119, 245, 21, 188, 49, 176, 213, 88, 135, 207, 62, 190, 224, 131, 84,
+    97, 41, 204, 138, 113, 117, 144, 197, 116, 191, 135, 142, 195, 221, 255, 46, 54, 117, 106, 10, 195, 121, 86, 208,
+    120, 75, 14, 18, 140, 7, 97, 87, 35, 72, 73, 158, 222, 225, 222, 228, 49, 93, 47, 225, 224, 38, 144, 76,
+    245, 26, 150, 165, 118, 86, 208, 93, 100, 109, 132, 106, 144, 144, 91, 221, 67, 52, 133, 109, 7, 7, 24, 5,
+    106, 230, 59, 116, 232, 252, 146, 110, 173, 165, 59, 4, 107, 15, 193, 21, 186, 0, 255, 15, 184, 72, 133, 244,
+    66, 80, 171, 144, 173, 70, 36, 229, 74, 236, 31, 49, 249, 36, 221, 91, 74, 118, 30, 222, 139, 110, 66, 53,
+    135, 224, 138, 195, 229, 80, 77, 118, 29, 238, 70, 75, 92, 141, 146, 60, 138, 113, 87, 32, 164, 208, 240, 114,
+    242, 237, 35, 133, 171, 140, 111, 55, 26, 65, 44, 99, 158, 163, 198, 244, 51, 60, 24, 27, 23, 219, 4, 36,
+    16, 91, 252, 191, 42, 218, 5, 161, 79, 100, 231, 176, 247, 187, 122, 49, 41, 74, 237, 35, 151, 220, 63, 163,
+    23, 41, 2, 15, 167, 199, 162, 18, 31, 118, 176, 171, 145, 194, 81, 128, 179, 59, 158, 163, 133, 171, 137, 216,
+    229, 190, 18, 149, 216, 39, 135, 222, 133, 92, 140, 147, 121, 61, 186, 0, 232, 251, 241, 137, 225, 226, 174, 61,
+    235, 92, 143, 197, 35, 207, 64, 239, 114, 50, 90, 228, 108, 145, 228, 44, 141, 231, 116, 198, 57, 8, 46, 158,
+    139, 7, 204, 65, 194, 124, 210, 149, 219, 168, 225, 106, 227, 43, 174, 45, 5, 134, 216, 78, 85, 180, 8, 214,
+    25, 166, 171, 133, 50, 54, 92, 153, 114, 242, 173, 167, 97, 221, 236, 156, 245, 21, 114, 18, 181, 121, 218, 230,
+    8, 89, 19, 191, 139, 110, 109, 216, 119, 185, 26, 67, 238, 214, 159, 36, 236, 96, 89, 112, 186, 22, 172, 114,
+    40, 181, 164, 83, 138, 185, 25, 225, 248, 49, 224, 218, 122, 143, 27, 208, 217, 55, 147, 35, 56, 63, 174, 229,
+    171, 28, 138, 113, 194, 236, 69, 214, 71, 136, 126, 59, 15, 119, 189, 27, 221, 64, 250, 44, 11, 127, 151, 228,
+    32, 180, 43, 121, 15, 152, 225, 40, 192, 118, 8, 44, 156, 140, 47, 146, 42, 235, 61, 125, 194, 228, 97, 53,
+    45, 83, 219, 160, 252, 229, 236, 159, 160, 254, 249, 230, 96, 32, 151, 178, 10, 113, 87, 35, 72, 125, 218, 211,
+    228, 157, 140, 125, 63, 71, 64, 252, 17, 88, 124, 170, 9, 174, 128, 252, 17, 88, 124, 170, 9, 160, 178, 48,
+    172, 108, 56, 90, 184, 157, 83, 24, 30, 55, 149, 99, 50, 100, 35, 88, 100, 153, 255, 243, 255, 233, 234, 60,
+    111, 67, 84, 110, 69, 211, 209, 18, 186, 52, 133, 107, 46, 73, 74, 218, 2, 145, 142, 70, 88, 121, 222, 12,
+    246, 30, 195, 39, 207, 50, 68, 221, 246, 23, 73, 8, 25, 233, 114, 63, 253, 15, 119, 191, 15, 38, 194, 219,
+    145, 78, 56, 74, 48, 63, 93, 211, 11, 92, 133, 153, 220, 207, 111, 112, 252, 82, 161, 218, 67, 239, 82, 182,
+    34, 203, 57, 111, 50, 42, 19, 209, 194, 182, 130, 156, 49, 72, 241, 200, 167, 225, 164, 102, 240, 39, 125, 182,
+    194, 153, 237, 208, 232, 252, 17, 88, 35, 88, 127, 101, 108, 159, 13, 208, 246, 161, 87, 33, 90, 140, 73, 202,
+    149, 216, 62, 99, 240, 69, 97, 242, 168, 38, 130, 53, 135, 246, 86, 201, 240, 195, 219, 209, 109, 207, 81, 87,
+    33, 117, 217, 50, 160, 249, 138, 185, 28, 37, 24, 11, 51, 185, 11, 32, 250, 91, 22, 174, 195, 216, 49, 226,
+    118, 77, 140, 9, 164, 107, 11, 44, 237, 132, 230, 69, 202, 91, 10, 198, 66, 120, 125, 232, 85, 200, 202, 22,
+    86, 123, 15, 97, 148, 63, 22, 26, 37, 92, 196, 132, 135, 221, 172, 16, 65, 217, 226, 140, 12, 157, 173, 190,
+    84, 173, 160, 86, 163, 30, 148, 241, 61, 135, 187, 224, 252, 11, 164, 138, 185, 28, 37, 24, 9, 158, 103, 42,
+    54, 28, 190, 255, 253, 251, 132, 220, 132, 159, 51, 219, 160, 232, 252, 17, 88, 124, 170, 9, 174, 128, 239, 117,
+    145, 39, 42, 87, 96, 249, 143, 193, 21, 135, 202, 160, 154, 11, 35, 245, 221, 77, 24, 21, 116, 97, 188, 238,
+    152, 236, 62, 87, 125, 188, 147, 177, 137, 19, 72, 214, 15, 189, 74, 216, 245, 28, 37, 101, 117, 109, 5, 92,
+    137, 217, 34, 72, 205, 222, 133, 66, 103, 154, 229, 216, 123, 15, 9, 228, 192, 158, 9, 218, 69, 214, 69, 157,
+    226, 104, 237, 212, 74, 233, 117, 109, 59, 15, 119, 189, 27, 221, 67, 194, 121, 35, 133, 171, 190, 244, 50, 193,
+    70, 28, 37, 24, 235, 238, 23, 34, 83, 153, 20, 225, 6, 201, 50, 99, 199, 61, 135, 123, 145, 58, 156, 96,
+    62, 99, 56, 51, 113, 226, 10, 88, 44, 134, 122, 79, 24, 228, 39, 137, 45, 93, 186, 0, 232, 251, 159, 125,
+    48, 146, 61, 189, 22, 220, 244, 251, 159, 125, 48, 146, 61, 189, 22, 220, 140, 157, 169, 91, 115, 33, 158, 42,
+    252, 36, 91, 168, 225, 106, 227, 189, 214, 44, 62, 85, 4, 208, 241, 8, 217, 93, 91, 64, 249, 230, 41, 197,
+    92, 142, 12, 215, 97, 236, 56, 74, 48, 44, 179, 80, 190, 55, 165, 118, 21, 27, 229, 228, 44, 141, 146, 60,
+    155, 6, 41, 30, 57, 234, 46, 141, 101, 109, 3, 239, 66, 119, 219, 108, 41, 145, 78, 52, 132, 163, 158, 248,
+    16, 101, 108, 90, 167, 176, 247, 119, 186, 55, 145, 203, 239, 215, 220, 16, 112, 250, 163, 9, 78, 103, 168, 202,
+    18, 216, 86, 208, 32, 201, 36, 135, 204, 120, 122, 172, 27, 14, 18, 140, 118, 30, 239, 200, 142, 12, 17, 103,
+    225, 133, 56, 125, 224, 97, 38, 133, 161, 246, 237, 238, 232, 232, 251, 159, 125, 48, 146, 61, 189, 22, 220, 244,
+    254, 155, 197, 92, 192, 76, 59, 104, 62, 231, 223, 76, 36, 143, 111, 69, 183, 61, 71, 244, 125, 226, 174, 62,
+    85, 4, 208, 185, 75, 72, 124, 243, 20, 226, 174, 65, 73, 174, 195, 189, 200, 74, 213, 231, 107, 152, 35, 72,
+    126, 36, 106, 240, 66, 181, 183, 154, 133, 76, 117, 28, 45, 92, 112, 144, 110, 251, 201, 144, 141, 97, 154, 101,
+    79, 10, 103, 176, 252, 158, 60, 152, 145, 52, 141, 96, 251, 212, 173, 143, 81, 101, 156, 183, 153, 86, 208, 93,
+    248, 21, 114, 56, 74, 48, 22, 103, 114, 46, 146, 46, 152, 163, 97, 180, 61, 183, 202, 149, 219, 176, 247, 126,
+    68, 100, 141, 238, 160, 251, 24, 74, 35, 118, 177, 129, 87, 50, 70, 78, 214, 90, 87, 105, 235, 238, 14, 196,
+    74, 115, 61, 186, 0, 232, 254, 143, 188, 85, 199, 202, 160, 154, 232, 254, 143, 188, 85, 199, 202, 160, 154, 23,
+    48, 66, 200, 193, 153, 21, 9, 232, 224, 219, 168, 193, 75, 43, 104, 41, 248, 72, 176, 171, 144, 251, 212, 249,
+    88, 169, 15, 152, 167, 225, 187, 15, 97, 43, 163, 14, 18, 26, 67, 230, 33, 210, 220, 60, 121, 9, 114, 150,
+    236, 59, 220, 137, 92, 22, 200, 133, 145, 226, 31, 201, 96, 237, 142, 71, 142, 69, 92, 139, 44, 210, 53, 11,
+    239, 168, 124, 198, 169, 149, 213, 140, 114, 51, 135, 212, 85, 200, 225, 40, 192, 168, 41, 90, 150, 161, 182, 17,
+    171, 183, 64, 232, 251, 159, 125, 48, 146, 61, 189, 22, 220, 244, 251, 159, 125, 48, 146, 61, 189, 22, 220, 140,
+    157, 169, 91, 115, 34, 159, 132, 139, 10, 185, 12, 241, 87, 48, 192, 219, 66, 31, 49, 79, 195, 117, 28, 92,
+    193, 11, 66, 161, 26, 86, 149, 218, 66, 181, 56, 125, 139, 11, 174, 151, 225, 57, 158, 195, 189, 200, 249, 108,
+    77, 185, 31, 42, 120, 35, 68, 145, 52, 148, 174, 194, 156, 85, 200, 224, 205, 5, 144, 130, 251, 248, 15, 152,
+    76, 169, 125, 45, 115, 216, 123, 247, 154, 125, 76, 72, 63, 53, 161, 194, 213, 199, 132, 210, 67, 230, 37, 147,
+    47, 50, 60, 111, 65, 156, 120, 62, 140, 38, 134, 123, 15, 119, 182, 48, 31, 122, 15, 152, 180, 43, 121, 158,
+    190, 224, 236, 70, 79, 174, 216, 69, 105, 236, 61, 223, 127, 162, 194, 174, 68, 189, 144, 102, 251, 181, 34, 176,
+    89, 22, 126, 27, 183, 187, 160, 232, 251, 241, 137, 225, 226, 174, 62, 91, 19, 110, 71, 202, 158, 15, 64, 239,
+    114, 52, 73, 19, 73, 74, 236, 22, 71, 141, 230, 176, 173, 167, 81, 227, 122, 20, 90, 85, 216, 93, 27, 73,
+    10, 194, 174, 66, 44, 118, 29, 238, 70, 88, 49, 228, 43, 102, 241, 172, 140, 183, 154, 125, 76, 72, 171, 165,
+    10, 185, 231, 221, 232, 136, 221, 131, 239, 65, 243, 30, 30, 171, 6, 195, 132, 163, 1, 26, 194, 95, 58, 22,
+    133, 111, 51, 216, 123, 9, 93, 24, 59, 10, 185, 22, 119, 129, 5, 45, 61, 71, 187, 238, 220, 138, 113, 87,
+    35, 132, 163, 1, 102, 119, 61, 71, 4, 36, 17, 187, 39, 140, 17, 78, 54, 135, 244, 182, 35, 55, 221, 169,
+    21, 133, 161, 91, 204, 246, 247, 15, 197, 42, 29, 164, 96, 167, 162, 44, 178, 155, 108, 234, 212, 109, 219, 160,
+    252, 229, 236, 159, 160, 255, 115, 65, 4, 189, 144, 102, 240, 29, 177, 200, 255, 253, 254, 29, 191, 215, 253, 126,
+    159, 163, 160, 251, 159, 125, 48, 146, 61, 189, 22, 220, 244, 246, 161, 87, 33, 158, 42, 230, 24, 27, 104, 67,
+    230, 62, 252, 98, 120, 120, 171, 245, 31, 115, 239, 166, 18, 71, 183, 162, 219, 145, 224, 232, 173, 34, 156, 106,
+    99, 66, 21, 169, 197, 92, 139, 174, 151, 225, 57, 236, 59, 220, 135, 216, 176, 135, 75, 15, 7, 47, 46, 211,
+    212, 120, 222, 132, 190, 164, 84, 39, 163, 131, 18, 46, 101, 105, 40, 246, 30, 195, 52, 213, 113, 200, 177, 240,
+    148, 100, 113, 115, 87, 48, 41, 198, 78, 212, 173, 185, 15, 2, 13, 111, 12, 41, 197, 63, 12, 51, 120, 19,
+    190, 219, 97, 76, 246, 30, 239, 234, 46, 82, 44, 42, 228, 49, 249, 208, 167, 225, 131, 250, 48, 22, 91, 221,
+    65, 51, 204, 229, 70, 221, 125, 193, 216, 137, 78, 100, 93, 246, 57, 239, 140, 115, 219, 160, 232, 248, 46, 151,
+    225, 57, 31, 207, 248, 116, 255, 15, 184, 154, 70, 176, 74, 21, 114, 63, 206, 237, 149, 43, 176, 124, 199, 193,
+    116, 191, 9, 200, 254, 127, 195, 168, 65, 170, 127, 151, 128, 82, 107, 247, 240, 102, 132, 62, 244, 66, 101, 15,
+    50, 63, 225, 26, 82, 123, 15, 102, 7, 230, 180, 37, 116, 97, 179, 171, 84, 137, 125, 234, 226, 159, 132, 139,
+    15, 191, 24, 158, 30, 42, 253, 135, 123, 145, 6, 104, 36, 20, 23, 48, 66, 200, 202, 31, 139, 27, 14, 22,
+    174, 61, 27, 174, 88, 51, 216, 123, 15, 69, 172, 240, 36, 227, 18, 60, 61, 86, 13, 135, 9, 70, 2, 80,
+    86, 207, 9, 70, 195, 104, 92, 140, 245, 20, 158, 85, 180, 9, 111, 72, 212, 154, 16, 249, 138, 185, 18, 181,
+    186, 82, 187, 118, 31, 116, 47, 163, 18, 52, 141, 245, 241, 130, 60, 111, 67, 109, 227, 43, 164, 145, 87, 58,
+    134, 118, 53, 115, 131, 51, 219, 160, 232, 239, 117, 139, 15, 149, 65, 53, 208, 239, 117, 139, 15, 149, 65, 52,
+    46, 96, 133, 145, 133, 99, 97, 194, 213, 199, 235, 186, 43, 80, 187, 239, 38, 66, 53, 130, 9, 213, 49, 129,
+    182, 19, 157, 33, 247, 107, 118, 29, 238, 68, 240, 173, 164, 137, 225, 57, 26, 22, 172, 114, 21, 133, 92, 143,
+    16, 79, 236, 122, 143, 27, 208, 103, 25, 93, 113, 104, 44, 18, 8, 219, 9, 202, 182, 157, 135, 176, 205, 247,
+    106, 69, 96, 172, 42, 228, 108, 145, 228, 44, 138, 77, 141, 131, 231, 159, 80, 130, 87, 70, 16, 82, 202, 218,
+    15, 119, 220, 227, 254, 94, 135, 254, 228, 255, 231, 253, 127, 223, 228, 148, 96, 123, 221, 169, 53, 86, 74, 54,
+    237, 238, 29, 238, 68, 210, 227, 12, 102, 66, 200, 38, 20, 246, 232, 232, 239, 117, 139, 4, 107, 15, 247, 132,
+    107, 116, 239, 117, 139, 15, 149, 65, 52, 22, 70, 88, 121, 54, 25, 239, 21, 115, 3, 131, 53, 212, 89, 96,
+    229, 74, 218, 10, 132, 207, 53, 200, 75, 239, 87, 20, 227, 253, 225, 26, 195, 219, 209, 109, 207, 97, 246, 164,
+    66, 228, 150, 50, 60, 97, 242, 242, 42, 228, 112, 156, 245, 8, 214, 22, 52, 251, 192, 149, 209, 164, 108, 234,
+    212, 42, 228, 49, 224, 67, 239, 71, 176, 246, 25, 59, 77, 70, 249, 82, 187, 14, 30, 60, 152, 18, 181, 33,
+    138, 71, 142, 122, 137, 93, 182, 86, 208, 103, 15, 168, 65, 146, 53, 18, 193, 26, 195, 72, 93, 83, 37, 109,
+    59, 15, 119, 189, 27, 221, 64, 250, 44, 52, 52, 16, 88, 228, 90, 133, 161, 91, 200, 118, 21, 114, 63, 203,
+    248, 235, 238, 23, 34, 83, 153, 237, 208, 232, 255, 120, 70, 176, 246, 244, 91, 115, 208, 255, 120, 70, 176, 246,
+    244, 91, 114, 22, 68, 221, 44, 108, 60, 114, 41, 248, 48, 173, 160, 168, 38, 122, 135, 207, 51, 10, 218, 4,
+    16, 103, 101, 162, 51, 135, 212, 85, 200, 157, 219, 176, 239, 114, 54, 121, 160, 249, 230, 185, 17, 78, 42, 228,
+    20, 154, 11, 35, 198, 242, 166, 5, 93, 24, 111, 59, 166, 59, 15, 196, 190, 216, 35, 245, 220, 238, 70, 251,
+    117, 26, 163, 114, 46, 248, 178, 182, 131, 6, 168, 196, 132, 181, 160, 204, 155, 10, 113, 146, 215, 33, 243, 205,
+    114, 84, 196, 245, 27, 65, 157, 245, 79, 24, 228, 122, 117, 201, 91, 65, 87, 43, 3, 39, 108, 140, 52, 132,
+    240, 251, 208, 171, 145, 194, 81, 142, 221, 0, 232, 252, 94, 104, 127, 124, 243, 92, 143, 64, 254, 173, 43, 98,
+    42, 228, 78, 169, 140, 126, 250, 126, 24, 108, 243, 65, 243, 205, 114, 61, 69, 92, 132, 173, 94, 118, 185, 130,
+    22, 69, 22, 147, 216, 119, 185, 25, 96, 199, 145, 47, 21, 34, 175, 15, 190, 151, 27, 46, 12, 135, 204, 106,
+    139, 142, 163, 76, 35, 100, 173, 160, 223, 96, 146, 57, 125, 193, 106, 49, 216, 123, 191, 174, 99, 151, 223, 221,
+    4, 92, 193, 9, 225, 247, 161, 87, 35, 132, 163, 1, 158, 151, 35, 61, 71, 4, 127, 157, 230, 132, 150, 161,
+    87, 58, 135, 222, 186, 251, 132, 220, 137, 78, 103, 176, 246, 30, 55, 198, 13, 43, 15, 14, 145, 97, 133, 154,
+    145, 190, 214, 74, 50, 29, 133, 92, 137, 90, 221, 41, 93, 187, 116, 252, 246, 127, 15, 243, 253, 7, 190, 231,
+    47, 35, 151, 222, 7, 227, 219, 251, 246, 31, 107, 252, 254, 159, 163, 160, 252, 17, 88, 124, 170, 9, 174, 128,
+    252, 17, 88, 124, 170, 9, 161, 6, 119, 212, 200, 185, 131, 212, 92, 165, 149, 180, 5, 38, 133, 63, 9, 22,
+    21, 114, 41, 248, 97, 145, 106, 49, 216, 119, 185, 23, 125, 76, 132, 130, 50, 186, 70, 170, 218, 117, 30, 55,
+    161, 170, 55, 34, 203, 59, 97, 57, 18, 186, 52, 136, 41, 101, 109, 7, 187, 254, 92, 126, 73, 70, 7, 183,
+    164, 92, 39, 140, 30, 222, 225, 255, 37, 116, 191, 135, 137, 25, 59, 122, 49, 36, 59, 13, 158, 50, 185, 158,
+    162, 110, 144, 173, 160, 226, 233, 67, 11, 85, 130, 21, 179, 120, 213, 41, 93, 133, 92, 242, 46, 158, 143, 97,
+    240, 125, 136, 213, 91, 76, 25, 28, 45, 92, 103, 27, 205, 66, 82, 187, 5, 97, 87, 43, 3, 211, 174, 70,
+    123, 116, 232, 254, 139, 19, 67, 229, 80, 77, 116, 246, 161, 87, 33, 90, 140, 73, 202, 149, 216, 62, 99, 250,
+    44, 77, 15, 149, 65, 52, 17, 172, 63, 4, 86, 234, 42, 228, 83, 240, 195, 50, 113, 33, 49, 171, 205, 11,
+    25, 49, 70, 221, 135, 219, 188, 171, 25, 147, 33, 32, 140, 176, 242, 108, 30, 3, 236, 97, 41, 91, 64, 236,
+    48, 186, 173, 27, 11, 190, 241, 61, 135, 176, 103, 165, 200, 143, 14, 145, 96, 178, 50, 127, 70, 13, 135, 11,
+    87, 25, 227, 147, 18, 19, 195, 239, 67, 132, 163, 2, 203, 53, 11, 227, 122, 87, 97, 179, 171, 84, 132, 107,
+    9, 76, 205, 114, 54, 131, 146, 111, 74, 237, 61, 135, 123, 145, 193, 93, 47, 65, 243, 21, 114, 50, 133, 149,
+    144, 178, 15, 165, 177, 106, 237, 208, 232, 248, 46, 151, 225, 57, 31, 207, 248, 116, 239, 9, 232, 225, 91, 64,
+    82, 104, 59, 15, 130, 233, 126, 19, 145, 252, 255, 135, 81, 87, 33, 246, 44, 33, 210, 193, 100, 32, 154, 72,
+    242, 50, 118, 168, 73, 161, 78, 42, 228, 84, 62, 254, 48, 108, 41, 248, 97, 224, 221, 90, 195, 151, 223, 176,
+    249, 46, 141, 35, 132, 134, 15, 152, 247, 126, 73, 70, 7, 245, 153, 220, 200, 86, 31, 126, 49, 60, 60, 85,
+    255, 243, 254, 191, 239, 229, 79, 151, 145, 255, 189, 135, 218, 115, 120, 35, 239, 106, 48, 173, 167, 111, 112, 246,
+    21, 27, 229, 228, 97, 210, 198, 195, 133, 171, 143, 15, 85, 131, 97, 194, 81, 129, 59, 19, 105, 27, 36, 215,
+    81, 114, 150, 86, 208, 83, 240, 145, 97, 87, 34, 159, 134, 237, 208, 232, 248, 46, 151, 225, 57, 31, 207, 248,
+    116, 248, 20, 178, 182, 131, 131, 52, 29, 135, 193, 116, 191, 9, 200, 254, 127, 195, 168, 171, 145, 57, 22, 49,
+    200, 89, 8, 60, 99, 120, 15, 152, 205, 78, 45, 33, 26, 194, 124, 243, 216, 123, 8, 51, 66, 105, 246, 9,
+    114, 150, 9, 111, 70, 41, 100, 200, 203, 5, 24, 102, 153, 46, 22, 148, 200, 70, 176, 217, 233, 60, 96, 142,
+    18, 140, 127, 231, 253, 127, 218, 8, 56, 83, 152, 205, 224, 84, 39, 163, 131, 19, 216, 123, 12, 211, 85, 199,
+    34, 14, 107, 140, 72, 171, 149, 129, 225, 234, 176, 103, 168, 131, 133, 62, 141, 133, 56, 205, 90, 194, 174, 71,
+    9, 70, 5, 204, 17, 73, 52, 100, 51, 198, 169, 142, 221, 0, 232, 254, 249, 230, 185, 30, 128, 239, 117, 145,
+    58, 166, 48, 31, 60, 215, 34, 60, 28, 59, 105, 34, 156, 85, 200, 213, 25, 52, 48, 31, 49, 87, 35, 93,
+    217, 114, 93, 147, 3, 132, 163, 3, 39, 215, 100, 110, 123, 15, 129, 18, 181, 33, 40, 93, 100, 88, 207, 158,
+    162, 119, 136, 125, 218, 198, 195, 199, 34, 105, 50, 243, 33, 243, 16, 118, 120, 169, 8, 214, 28, 37, 24, 18,
+    154, 237, 130, 17, 147, 28, 201, 158, 195, 224, 178, 51, 76, 136, 89, 22, 132, 225, 135, 11, 87, 25, 165, 46,
+    155, 158, 195, 221, 249, 31, 119, 162, 24, 250, 48, 36, 150, 8, 220, 213, 213, 180, 24, 95, 36, 85, 214, 122,
+    251, 133, 200, 148, 230, 71, 235, 186, 154, 199, 61, 135, 187, 228, 250, 151, 98, 22, 69, 38, 187, 24, 86, 208,
+    112, 181, 112, 251, 192, 158, 102, 142, 189, 189, 221, 0, 232, 254, 207, 227, 199, 61, 0, 239, 114, 48, 254, 60,
+    114, 31, 49, 87, 35, 132, 163, 2, 160, 165, 106, 90, 134, 216, 70, 160, 178, 16, 93, 125, 16, 249, 132, 202,
+    151, 210, 215, 61, 135, 123, 145, 7, 35, 181, 43, 178, 205, 11, 163, 91, 6, 66, 15, 9, 16, 154, 16, 249,
+    141, 174, 236, 70, 73, 140, 79, 81, 115, 0, 252, 246, 131, 50, 174, 194, 106, 17, 88, 219, 176, 247, 126, 71,
+    221, 4, 89, 213, 180, 7, 209, 142, 106, 234, 218, 14, 8, 201, 27, 175, 184, 77, 200, 131, 177, 74, 145, 78,
+    50, 76, 96, 196, 246, 29, 238, 69, 22, 149, 118, 10, 194, 174, 66, 44, 5, 145, 178, 99, 100, 241, 131, 219,
+    160, 252, 233, 49, 231, 244, 29, 211, 30, 69, 56, 171, 145, 7, 35, 181, 43, 178, 205, 125, 63, 71, 64, 248,
+    38, 49, 194, 115, 208, 239, 117, 145, 187, 65, 213, 35, 202, 120, 193, 23, 76, 99, 132, 228, 44, 140, 43, 27,
+    14, 22, 174, 44, 239, 18, 48, 82, 202, 218, 10, 113, 233, 33, 95, 121, 15, 158, 107, 145, 158, 195, 189, 200,
+    225, 49, 137, 9, 4, 37, 158, 24, 216, 112, 181, 113, 41, 153, 174, 70, 207, 52, 98, 66, 53, 134, 208, 249,
+    27, 111, 9, 129, 149, 210, 42, 123, 15, 97, 254, 81, 150, 158, 6, 175, 180, 138, 185, 25, 225, 222, 58, 142,
+    46, 179, 88, 86, 208, 75, 231, 88, 228, 83, 143, 16, 83, 200, 171, 145, 43, 130, 217, 30, 221, 0, 232, 248,
+    38, 49, 194, 115, 208, 239, 114, 46, 152, 199, 9, 200, 185, 130, 22, 71, 235, 186, 154, 49, 212, 96, 165, 149,
+    180, 20, 252, 36, 88, 85, 200, 219, 8, 212, 53, 70, 77, 12, 123, 164, 62, 121, 174, 68, 83, 138, 185, 18,
+    251, 213, 251, 15, 97, 227, 124, 96, 210, 176, 240, 233, 22, 22, 89, 219, 9, 204, 141, 78, 175, 33, 26, 195,
+    120, 208, 181, 6, 122, 92, 140, 246, 31, 221, 136, 201, 43, 43, 153, 28, 190, 240, 15, 39, 255, 161, 238, 255,
+    219, 38, 245, 119, 133, 253, 141, 135, 182, 89, 25, 145, 247, 26, 57, 81, 183, 254, 127, 215, 253, 252, 78, 207,
+    20, 62, 91, 206, 203, 146, 190, 242, 61, 178, 165, 244, 181, 200, 254, 186, 234, 108, 169, 71, 28, 246, 247, 116,
+    232, 252, 112, 141, 67, 240, 70, 77, 12, 123, 164, 127, 124, 243, 92, 143, 64, 239, 114, 54, 194, 53, 13, 81,
+    147, 67, 30, 233, 15, 158, 107, 145, 11, 35, 44, 111, 84, 96, 216, 112, 181, 113, 227, 27, 157, 161, 90, 164,
+    35, 88, 81, 202, 236, 185, 38, 6, 168, 219, 166, 39, 176, 248, 17, 52, 141, 105, 15, 232, 192, 65, 99, 62,
+    70, 79, 232, 193, 176, 86, 25, 93, 34, 167, 168, 186, 200, 60, 153, 19, 146, 51, 43, 104, 51, 120, 8, 211,
+    193, 137, 236, 61, 223, 145, 12, 77, 133, 56, 205, 90, 194, 174, 68, 190, 241, 145, 15, 152, 171, 172, 139, 166,
+    94, 122, 251, 133, 200, 148, 230, 69, 141, 24, 213, 88, 219, 28, 246, 30, 239, 196, 190, 216, 33, 32, 140, 159,
+    118, 165, 109, 3, 176, 222, 123, 123, 186, 0, 252, 233, 49, 231, 244, 29, 211, 30, 69, 56, 171, 145, 182, 17,
+    168, 106, 140, 154, 24, 237, 244, 253, 29, 0, 248, 38, 49, 194, 115, 208, 239, 117, 145, 147, 196, 45, 158, 6,
+    10, 90, 69, 56, 171, 145, 147, 181, 67, 224, 67, 190, 162, 156, 85, 200, 151, 222, 175, 216, 119, 185, 24, 93,
+    47, 74, 218, 12, 240, 185, 121, 49, 34, 112, 186, 94, 177, 207, 80, 141, 97, 87, 34, 251, 234, 31, 49, 170,
+    101, 117, 99, 28, 141, 33, 248, 145, 135, 222, 198, 59, 15, 97, 37, 164, 135, 204, 111, 26, 22, 203, 145, 177,
+    141, 74, 81, 145, 87, 33, 22, 59, 14, 231, 43, 178, 228, 168, 210, 47, 188, 71, 35, 100, 154, 234, 42, 229,
+    96, 102, 153, 25, 26, 66, 235, 219, 160, 232, 247, 187, 84, 62, 7, 197, 223, 94, 128, 239, 114, 50, 118, 168,
+    124, 8, 119, 212, 44, 138, 185, 12, 99, 209, 25, 22, 163, 1, 243, 21, 114, 56, 74, 48, 42, 10, 86, 165,
+    168, 109, 132, 106, 236, 63, 7, 101, 167, 137, 22, 89, 219, 9, 200, 65, 225, 34, 19, 66, 31, 49, 100, 164,
+    234, 53, 223, 43, 135, 204, 45, 12, 240, 147, 117, 109, 4, 27, 4, 193, 138, 158, 195, 189, 200, 193, 75, 10,
+    57, 93, 151, 37, 70, 30, 18, 14, 57, 9, 151, 150, 126, 48, 109, 161, 145, 203, 239, 3, 104, 50, 91, 35,
+    216, 123, 190, 92, 205, 29, 100, 36, 17, 147, 235, 180, 62, 171, 38, 221, 125, 194, 228, 74, 115, 61, 135, 187,
+    228, 250, 151, 99, 238, 145, 170, 50, 237, 190, 18, 149, 180, 21, 114, 50, 185, 213, 114, 76, 12, 31, 71, 18,
+    32, 234, 244, 113, 207, 111, 119, 64, 252, 233, 49, 231, 244, 29, 211, 30, 69, 56, 171, 145, 130, 150, 20, 114,
+    187, 46, 74, 141, 219, 233, 250, 58, 0, 255, 254, 221, 48, 181, 200, 247, 187, 84, 62, 58, 0, 254, 172, 42,
+    228, 126, 187, 166, 22, 185, 9, 51, 188, 35, 100, 66, 65, 78, 162, 142, 87, 101, 201, 81, 164, 78, 80, 154,
+    248, 193, 20, 225, 25, 49, 207, 236, 71, 9, 70, 4, 166, 187, 96, 207, 97, 220, 205, 10, 223, 193, 144, 141,
+    97, 224, 167, 147, 18, 50, 198, 245, 70, 5, 92, 142, 30, 60, 206, 201, 145, 158, 195, 221, 239, 118, 164, 213,
+    89, 26, 134, 15, 163, 137, 9, 4, 62, 121, 138, 185, 25, 93, 34, 167, 175, 184, 59, 16, 126, 121, 97, 23,
+    89, 236, 61, 223, 145, 23, 79, 68, 83, 137, 190, 244, 44, 252, 48, 171, 145, 59, 237, 182, 57, 30, 14, 111,
+    4, 106, 240, 70, 197, 246, 193, 26, 26, 18, 185, 121, 237, 238, 232, 252, 242, 185, 203, 207, 232, 61, 247, 57,
+    121, 21, 114, 48, 125, 28, 79, 211, 244, 116, 246, 181, 150, 151, 209, 30, 247, 106, 135, 192, 248, 187, 235, 208,
+    239, 117, 145, 14, 250, 140, 157, 170, 31, 18, 42, 228, 37, 172, 180, 190, 140, 133, 106, 135, 182, 249, 27, 5,
+    106, 113, 87, 35, 132, 163, 2, 119, 219, 108, 115, 216, 123, 97, 35, 89, 30, 9, 216, 43, 100, 102, 81, 171,
+    28, 245, 8, 214, 25, 59, 84, 62, 6, 200, 199, 18, 51, 194, 77, 199, 9, 12, 173, 164, 246, 29, 238, 67,
+    26, 225, 227, 200, 203, 15, 38, 133, 56, 171, 144, 207, 21, 112, 178, 19, 252, 164, 117, 25, 39, 140, 25, 23,
+    77, 174, 159, 178, 69, 177, 200, 201, 217, 142, 84, 109, 216, 123, 187, 221, 100, 44, 183, 186, 132, 239, 182, 207,
+    38, 194, 156, 120, 33, 246, 45, 215, 220, 16, 81, 202, 236, 185, 42, 48, 131, 170, 71, 153, 237, 208, 252, 224,
+    205, 60, 31, 208, 124, 76, 211, 193, 21, 114, 48, 125, 28, 72, 167, 21, 114, 54, 131, 233, 95, 121, 199, 35,
+    203, 63, 12, 52, 119, 176, 201, 219, 53, 211, 120, 74, 87, 110, 223, 79, 209, 208, 255, 147, 92, 60, 121, 30,
+    252, 60, 154, 232, 239, 114, 39, 84, 198, 3, 26, 225, 227, 200, 203, 15, 38, 130, 200, 202, 19, 93, 141, 130,
+    53, 133, 222, 187, 15, 145, 143, 70, 36, 35, 88, 67, 239, 70, 36, 120, 194, 183, 145, 169, 171, 189, 151, 36,
+    198, 57, 234, 60, 111, 65, 24, 110, 201, 189, 93, 225, 127, 99, 97, 132, 218, 159, 96, 178, 50, 118, 99, 149,
+    27, 10, 113, 87, 34, 121, 154, 58, 246, 31, 217, 88, 200, 124, 198, 169, 133, 201, 95, 121, 25, 61, 136, 156,
+    161, 241, 128, 153, 67, 204, 133, 169, 19, 148, 18, 221, 135, 123, 172, 133, 145, 87, 34, 95, 120, 200, 135, 204,
+    85, 200, 186, 101, 228, 38, 121, 156, 169, 91, 65, 87, 35, 132, 163, 2, 160, 165, 106, 90, 134, 216, 70, 174,
+    221, 0, 252, 247, 109, 177, 190, 159, 160, 255, 219, 109, 141, 244, 21, 114, 39, 121, 217, 114, 87, 222, 70, 19,
+    106, 125, 187, 125, 63, 71, 64, 255, 119, 123, 97, 26, 193, 26, 195, 238, 123, 104, 71, 189, 107, 158, 128, 255,
+    15, 184, 72, 33, 216, 85, 200, 186, 233, 126, 19, 145, 53, 6, 178, 186, 182, 131, 193, 174, 9, 97, 254, 238,
+    246, 194, 53, 130, 53, 135, 220, 246, 208, 143, 122, 215, 61, 135, 123, 144, 251, 22, 16, 233, 96, 178, 51, 194,
+    55, 147, 97, 227, 145, 233, 38, 129, 249, 236, 141, 38, 67, 230, 54, 132, 88, 82, 48, 141, 110, 163, 133, 171,
+    138, 185, 23, 120, 95, 217, 216, 77, 65, 172, 174, 173, 160, 45, 108, 25, 156, 114, 18, 229, 45, 216, 119, 185,
+    19, 231, 144, 178, 16, 120, 133, 198, 21, 26, 135, 140, 110, 122, 132, 107, 7, 203, 36, 149, 118, 76, 12, 177,
+    188, 209, 137, 15, 152, 168, 38, 71, 136, 41, 228, 85, 200, 213, 217, 233, 219, 144, 249, 138, 185, 25, 225, 40,
+    97, 26, 211, 146, 108, 123, 14, 247, 34, 251, 234, 31, 49, 101, 154, 70, 161, 80, 153, 230, 185, 5, 145, 154,
+    43, 87, 81, 227, 122, 28, 190, 225, 158, 151, 34, 17, 134, 237, 188, 238, 152, 13, 190, 190, 12, 7, 204, 67,
+    248, 122, 20, 159, 53, 145, 251, 46, 219, 43, 104, 60, 115, 212, 85, 202, 192, 146, 210, 241, 35, 198, 21, 188,
+    171, 104, 18, 69, 92, 242, 25, 61, 46, 137, 68, 38, 244, 236, 250, 190, 243, 142, 123, 116, 232, 255, 119, 123,
+    97, 26, 193, 26, 195, 239, 198, 39, 135, 138, 191, 64, 239, 117, 144, 178, 42, 228, 93, 116, 191, 9, 200, 171,
+    165, 12, 157, 152, 229, 82, 63, 221, 222, 216, 70, 176, 167, 31, 126, 49, 60, 60, 85, 251, 14, 247, 34, 29,
+    44, 46, 96, 133, 145, 58, 187, 213, 250, 142, 22, 174, 51, 131, 55, 199, 35, 100, 86, 163, 97, 133, 99, 35,
+    77, 214, 202, 218, 10, 185, 28, 39, 61, 135, 244, 83, 139, 72, 124, 196, 238, 217, 225, 248, 49, 34, 120, 78,
+    70, 133, 171, 28, 133, 97, 87, 35, 196, 19, 251, 16, 236, 10, 213, 204, 9, 91, 30, 195, 216, 102, 120, 16,
+    254, 30, 133, 39, 205, 100, 108, 147, 35, 199, 61, 69, 92, 172, 9, 193, 62, 69, 140, 174, 141, 34, 14, 120,
+    57, 82, 182, 130, 174, 68, 238, 216, 93, 47, 93, 135, 123, 158, 68, 147, 168, 167, 30, 8, 185, 75, 43, 104,
+    41, 248, 72, 176, 255, 119, 123, 97, 26, 221, 71, 249, 117, 101, 109, 5, 92, 141, 33, 248, 86, 208, 54, 250,
+    248, 48, 31, 48, 155, 211, 179, 234, 251, 200, 244, 110, 185, 96, 200, 86, 21, 114, 18, 10, 118, 232, 232, 248,
+    46, 151, 225, 57, 31, 207, 248, 116, 255, 15, 184, 205, 90, 195, 151, 222, 36, 227, 48, 236, 62, 11, 165, 248,
+    78, 71, 243, 254, 29, 66, 13, 83, 252, 188, 4, 138, 49, 200, 141, 217, 149, 180, 5, 38, 130, 53, 135, 6,
+    107, 176, 239, 9, 158, 107, 144, 89, 23, 41, 233, 76, 11, 152, 61, 71, 141, 232, 75, 234, 106, 234, 218, 13,
+    219, 121, 221, 48, 50, 74, 202, 230, 71, 47, 188, 4, 170, 45, 74, 237, 255, 159, 245, 255, 104, 33, 252, 61,
+    10, 79, 154, 133, 145, 53, 190, 94, 66, 176, 171, 145, 170, 218, 216, 33, 243, 21, 114, 33, 210, 221, 70, 79,
+    174, 216, 52, 113, 200, 221, 181, 127, 74, 218, 118, 31, 214, 164, 93, 63, 100, 139, 12, 46, 151, 169, 25, 225,
+    38, 226, 47, 205, 95, 85, 201, 49, 142, 122, 132, 107, 4, 96, 155, 217, 124, 96, 132, 193, 138, 30, 33, 210,
+    217, 36, 212, 140, 225, 245, 11, 82, 39, 98, 158, 76, 79, 80, 114, 187, 171, 104, 19, 40, 121, 145, 87, 34,
+    235, 165, 248, 78, 123, 15, 239, 87, 48, 61, 27, 174, 88, 50, 50, 77, 233, 95, 121, 199, 35, 84, 99, 191,
+    163, 1, 33, 247, 107, 5, 174, 163, 198, 244, 42, 228, 67, 248, 122, 20, 159, 53, 16, 117, 69, 105, 27, 180,
+    25, 217, 218, 87, 209, 237, 208, 252, 211, 6, 43, 244, 30, 204, 19, 6, 40, 44, 143, 5, 91, 65, 226, 29,
+    45, 146, 77, 12, 225, 245, 21, 114, 41, 62, 107, 219, 233, 250, 63, 58, 79, 154, 254, 131, 218, 168, 235, 181,
+    10, 113, 115, 141, 133, 92, 138, 79, 154, 246, 250, 126, 142, 128, 248, 46, 151, 225, 57, 31, 207, 248, 116, 248,
+    46, 151, 225, 57, 31, 207, 248, 12, 157, 169, 91, 115, 34, 230, 15, 81, 53, 6, 178, 186, 182, 129, 90, 156,
+    85, 200, 178, 205, 35, 100, 71, 135, 171, 130, 147, 65, 26, 195, 131, 53, 216, 119, 185, 25, 225, 248, 15, 152,
+    168, 76, 243, 92, 130, 200, 154, 41, 110, 122, 142, 22, 174, 17, 130, 76, 188, 86, 165, 168, 62, 99, 209, 186,
+    229, 131, 61, 71, 141, 232, 67, 248, 122, 20, 159, 53, 144, 144, 67, 61, 46, 69, 60, 99, 145, 180, 31, 73,
+    130, 213, 216, 119, 185, 228, 106, 254, 136, 86, 25, 59, 197, 149, 146, 141, 134, 201, 84, 97, 167, 168, 171, 149,
+    128, 201, 233, 116, 74, 87, 97, 60, 205, 29, 100, 73, 58, 171, 105, 142, 68, 242, 217, 27, 118, 29, 238, 69,
+    247, 212, 62, 96, 182, 138, 198, 66, 53, 133, 92, 135, 203, 36, 149, 118, 76, 11, 187, 121, 25, 65, 74, 33,
+    4, 243, 174, 215, 118, 228, 62, 98, 235, 165, 248, 78, 68, 190, 237, 105, 237, 208, 232, 247, 166, 45, 193, 198,
+    7, 183, 162, 219, 158, 128, 247, 166, 45, 193, 198, 7, 183, 162, 219, 144, 173, 70, 36, 229, 82, 46, 96, 245,
+    28, 45, 92, 124, 23, 75, 240, 156, 143, 227, 246, 12, 161, 230, 85, 180, 20, 226, 174, 67, 60, 85, 194, 53,
+    135, 193, 116, 191, 9, 200, 254, 127, 192, 83, 138, 185, 18, 251, 213, 251, 14, 238, 42, 228, 20, 154, 19, 72,
+    214, 144, 131, 39, 195, 204, 166, 1, 73, 56, 23, 124, 89, 91, 64, 131, 84, 153, 95, 68, 65, 218, 30, 219,
+    229, 74, 236, 31, 49, 255, 226, 182, 69, 168, 122, 70, 31, 238, 250, 95, 221, 35, 52, 213, 247, 145, 178, 43,
+    82, 182, 157, 135, 123, 145, 162, 163, 80, 72, 174, 30, 60, 138, 126, 12, 72, 79, 15, 232, 245, 11, 82, 61,
+    47, 136, 70, 161, 147, 225, 226, 70, 78, 213, 9, 52, 173, 160, 77, 17, 90, 104, 85, 200, 159, 60, 246, 31,
+    23, 240, 244, 41, 62, 107, 33, 242, 201, 37, 93, 147, 24, 228, 108, 155, 201, 12, 82, 60, 115, 212, 36, 133,
+    204, 109, 15, 164, 38, 186, 155, 10, 112, 155, 109, 7, 37, 74, 34, 174, 70, 91, 226, 183, 132, 192, 194, 53,
+    181, 72, 243, 219, 160, 252, 246, 69, 106, 86, 211, 244, 31, 213, 167, 99, 149, 10, 185, 24, 72, 208, 143, 255,
+    21, 178, 45, 67, 210, 48, 255, 119, 210, 227, 100, 86, 165, 109, 59, 125, 63, 71, 64, 248, 46, 151, 225, 57,
+    31, 207, 248, 116, 254, 236, 42, 235, 34, 106, 13, 101, 112, 249, 143, 130, 233, 126, 19, 145, 252, 255, 135, 81,
+    87, 35, 37, 174, 103, 36, 216, 135, 204, 127, 187, 189, 176, 141, 96, 117, 49, 161, 145, 78, 42, 228, 51, 197,
+    95, 168, 226, 235, 130, 31, 98, 195, 53, 56, 180, 131, 243, 162, 214, 20, 226, 174, 68, 190, 245, 126, 195, 189,
+    200, 135, 75, 5, 145, 103, 170, 54, 28, 45, 92, 67, 248, 122, 20, 159, 53, 158, 162, 174, 86, 6, 208, 100,
+    182, 68, 120, 57, 62, 170, 218, 13, 94, 8, 201, 219, 34, 213, 9, 70, 193, 36, 114, 251, 132, 219, 104, 116,
+    202, 226, 174, 70, 75, 92, 246, 31, 39, 212, 138, 79, 154, 200, 146, 117, 20, 227, 76, 45, 101, 126, 162, 112,
+    252, 43, 104, 44, 252, 48, 221, 143, 207, 99, 149, 27, 99, 144, 240, 39, 131, 30, 149, 180, 19, 133, 210, 245,
+    142, 71, 131, 155, 193, 25, 60, 65, 202, 149, 180, 21, 114, 176, 50, 125, 226, 79, 110, 128, 232, 248, 46, 151,
+    225, 57, 31, 207, 248, 4, 107, 15, 123, 235, 169, 140, 136, 248, 186, 91, 160, 239, 114, 46, 186, 95, 132, 228,
+    92, 193, 11, 35, 100, 138, 84, 198, 57, 25, 97, 228, 216, 103, 188, 85, 204, 10, 113, 87, 35, 131, 53, 212,
+    112, 181, 113, 225, 34, 20, 196, 132, 107, 14, 18, 25, 91, 65, 43, 163, 72, 86, 178, 228, 148, 173, 160, 201,
+    218, 106, 55, 202, 149, 216, 60, 4, 96, 173, 146, 216, 181, 118, 29, 220, 85, 200, 41, 53, 212, 124, 23, 75,
+    240, 156, 143, 231, 252, 4, 29, 81, 90, 67, 236, 91, 176, 246, 96, 126, 107, 66, 19, 93, 133, 56, 171, 144,
+    207, 21, 113, 130, 150, 145, 78, 61, 239, 174, 166, 50, 35, 226, 233, 110, 163, 139, 152, 35, 44, 111, 52, 98,
+    67, 230, 39, 84, 198, 4, 211, 193, 144, 141, 97, 55, 125, 164, 100, 140, 60, 17, 36, 183, 97, 236, 51, 60,
+    8, 127, 15, 66, 147, 230, 178, 41, 60, 145, 87, 32, 252, 214, 186, 141, 76, 104, 173, 160, 146, 154, 224, 204,
+    227, 144, 237, 78, 61, 239, 174, 166, 50, 35, 226, 233, 110, 221, 0, 232, 247, 190, 186, 152, 200, 143, 139, 165,
+    186, 0, 247, 190, 186, 152, 200, 143, 139, 165, 129, 249, 209, 107, 72, 103, 138, 191, 9, 22, 234, 48, 172, 108,
+    56, 90, 184, 70, 9, 16, 156, 135, 204, 78, 169, 140, 9, 187, 237, 61, 68, 25, 164, 222, 17, 170, 122, 132,
+    107, 12, 210, 107, 247, 230, 239, 96, 251, 214, 13, 79, 97, 222, 228, 74, 216, 240, 152, 243, 33, 32, 143, 27,
+    205, 97, 91, 65, 194, 213, 198, 197, 246, 193, 234, 60, 111, 66, 174, 68, 58, 90, 66, 65, 22, 125, 85, 146,
+    141, 135, 142, 68, 63, 135, 161, 73, 243, 89, 234, 56, 41, 233, 91, 65, 224, 215, 4, 176, 190, 250, 163, 126,
+    251, 66, 250, 44, 50, 72, 145, 194, 213, 198, 73, 140, 183, 194, 81, 176, 218, 14, 75, 42, 237, 216, 119, 113,
+    87, 34, 95, 122, 191, 81, 87, 35, 84, 255, 47, 3, 224, 186, 95, 132, 228, 127, 63, 224, 47, 190, 178, 56,
+    90, 184, 201, 218, 105, 26, 133, 66, 103, 154, 229, 219, 160, 232, 247, 190, 186, 152, 200, 143, 139, 165, 130, 53,
+    135, 193, 116, 191, 9, 200, 254, 63, 103, 64, 246, 161, 87, 89, 30, 55, 158, 66, 181, 24, 147, 149, 43, 183,
+    81, 239, 125, 117, 49, 145, 31, 23, 75, 12, 157, 169, 91, 115, 33, 158, 42, 225, 26, 194, 95, 122, 191, 81,
+    197, 215, 4, 124, 23, 75, 240, 156, 143, 227, 246, 12, 20, 180, 130, 147, 66, 175, 15, 190, 151, 20, 252, 55,
+    97, 221, 197, 92, 142, 12, 215, 80, 131, 9, 26, 17, 6, 145, 112, 96, 35, 88, 112, 144, 110, 251, 201, 19,
+    79, 4, 97, 223, 89, 234, 22, 164, 108, 145, 229, 91, 65, 135, 161, 154, 227, 6, 195, 133, 171, 143, 15, 87,
+    25, 59, 122, 45, 74, 236, 152, 30, 141, 215, 44, 25, 8, 214, 11, 108, 17, 15, 225, 232, 82, 124, 214, 123,
+    14, 247, 34, 147, 230, 178, 36, 157, 69, 56, 201, 219, 72, 58, 37, 17, 115, 7, 168, 151, 212, 130, 212, 97,
+    91, 64, 141, 96, 126, 107, 74, 218, 10, 185, 27, 36, 121, 86, 208, 36, 20, 10, 193, 24, 22, 182, 12, 200,
+    195, 190, 221, 186, 0, 232, 247, 190, 186, 152, 200, 143, 139, 165, 186, 0, 247, 190, 186, 152, 200, 143, 139, 165,
+    134, 78, 212, 173, 185, 145, 78, 38, 160, 214, 87, 12, 241, 87, 8, 214, 18, 251, 213, 250, 140, 240, 141, 228,
+    216, 120, 228, 122, 72, 87, 222, 68, 221, 246, 217, 91, 65, 145, 106, 49, 33, 26, 192, 165, 24, 83, 61, 135,
+    123, 145, 53, 4, 208, 89, 24, 95, 71, 28, 245, 30, 55, 160, 130, 75, 73, 15, 152, 221, 138, 73, 24, 86,
+    208, 196, 132, 145, 171, 193, 16, 254, 30, 133, 39, 205, 100, 38, 219, 20, 142, 162, 95, 82, 44, 179, 182, 19,
+    149, 109, 1, 136, 74, 92, 135, 131, 116, 244, 175, 31, 249, 255, 95, 247, 52, 251, 108, 173, 160, 79, 17, 190,
+    213, 142, 67, 192, 201, 99, 44, 43, 104, 60, 97, 242, 243, 34, 14, 197, 40, 219, 28, 246, 232, 232, 247, 190,
+    186, 152, 200, 143, 139, 165, 186, 0, 239, 117, 145, 179, 197, 43, 176, 124, 199, 189, 245, 212, 198, 68, 124, 93,
+    44, 22, 70, 21, 141, 135, 11, 87, 19, 177, 201, 83, 21, 200, 154, 120, 50, 17, 172, 60, 62, 244, 191, 174,
+    228, 77, 223, 105, 236, 63, 19, 99, 53, 10, 141, 35, 133, 107, 63, 31, 190, 110, 251, 117, 15, 150, 73, 42,
+    236, 152, 199, 35, 76, 35, 100, 173, 160, 225, 33, 113, 200, 74, 21, 114, 21, 178, 130, 146, 173, 160, 109, 245,
+    240, 96, 62, 98, 31, 195, 208, 164, 249, 172, 141, 146, 101, 91, 65, 227, 158, 195, 216, 102, 120, 20, 159, 53,
+    145, 116, 244, 70, 219, 227, 6, 193, 253, 24, 234, 42, 229, 96, 93, 63, 100, 139, 12, 46, 151, 169, 25, 225,
+    38, 234, 218, 117, 25, 38, 242, 173, 160, 213, 89, 224, 89, 102, 55, 218, 149, 218, 66, 176, 168, 76, 243, 92,
+    187, 116, 232, 247, 190, 186, 152, 200, 143, 139, 165, 186, 0, 247, 190, 186, 152, 200, 143, 139, 165, 133, 204, 17,
+    36, 235, 35, 118, 222, 119, 76, 99, 145, 147, 182, 134, 104, 219, 176, 248, 191, 135, 161, 73, 243, 89, 22, 125,
+    85, 146, 136, 171, 145, 132, 99, 61, 68, 190, 164, 106, 254, 149, 180, 9, 65, 6, 80, 156, 99, 168, 122, 185,
+    137, 11, 108, 43, 104, 18, 131, 218, 193, 27, 76, 25, 236, 59, 220, 137, 167, 131, 156, 59, 84, 136, 57, 224,
+    229, 65, 88, 85, 202, 192, 217, 240, 179, 115, 96, 126, 116, 97, 94, 36, 36, 138, 185, 228, 50, 122, 93, 18,
+    136, 171, 145, 148, 63, 22, 54, 19, 80, 77, 118, 31, 210, 55, 154, 132, 163, 97, 104, 95, 70, 36, 93, 219,
+    200, 187, 195, 79, 80, 150, 178, 182, 130, 156, 85, 200, 210, 31, 133, 109, 6, 73, 147, 237, 119, 110, 123, 116,
+    232, 247, 190, 186, 152, 200, 132, 107, 15, 123, 238, 213, 200, 248, 186, 91, 160, 246, 161, 87, 89, 31, 231, 118,
+    202, 149, 219, 168, 247, 190, 186, 152, 200, 143, 139, 165, 135, 162, 98, 67, 231, 152, 167, 21, 114, 25, 226, 174,
+    82, 107, 168, 241, 189, 4, 203, 35, 50, 22, 71, 140, 62, 94, 77, 135, 142, 69, 29, 118, 120, 72, 228, 67,
+    165, 188, 97, 242, 243, 61, 135, 201, 116, 105, 28, 36, 48, 124, 196, 58, 88, 101, 135, 157, 224, 200, 75, 148,
+    183, 97, 221, 197, 92, 130, 147, 93, 66, 9, 213, 49, 129, 147, 238, 213, 200, 135, 75, 12, 20, 180, 138, 126,
+    18, 44, 42, 228, 34, 198, 207, 21, 216, 123, 12, 43, 16, 249, 136, 127, 15, 66, 147, 230, 178, 22, 71, 235,
+    185, 220, 216, 111, 176, 74, 21, 114, 60, 36, 66, 228, 150, 61, 69, 92, 172, 2, 218, 43, 25, 11, 108, 43,
+    104, 18, 66, 230, 19, 132, 90, 86, 208, 49, 224, 43, 77, 70, 249, 82, 187, 79, 110, 128, 232, 247, 190, 237,
+    92, 143, 139, 165, 186, 0, 255, 15, 184, 168, 79, 71, 1, 48, 237, 160, 65, 250, 238, 166, 134, 79, 187, 87,
+    34, 29, 45, 212, 103, 132, 111, 38, 195, 199, 34, 118, 132, 227, 10, 218, 12, 210, 53, 194, 53, 187, 15, 247,
+    124, 88, 176, 205, 78, 45, 34, 106, 13, 101, 113, 78, 42, 228, 93, 225, 127, 103, 110, 161, 90, 140, 70, 251,
+    81, 176, 118, 199, 35, 199, 34, 174, 67, 229, 146, 74, 187, 38, 6, 105, 26, 221, 247, 147, 216, 127, 86, 21,
+    114, 44, 179, 72, 217, 17, 78, 42, 228, 20, 154, 234, 42, 228, 34, 198, 207, 20, 22, 71, 165, 149, 241, 131,
+    212, 112, 181, 113, 58, 166, 48, 54, 194, 49, 145, 99, 57, 22, 178, 182, 131, 72, 76, 142, 123, 227, 28, 246,
+    30, 195, 51, 192, 135, 240, 244, 41, 62, 107, 35, 40, 221, 100, 132, 195, 182, 130, 174, 68, 58, 91, 168, 146,
+    117, 86, 211, 28, 135, 222, 131, 230, 54, 194, 100, 66, 176, 171, 172, 136, 222, 19, 2, 77, 82, 182, 157, 186,
+    0, 232, 247, 190, 237, 92, 143, 139, 165, 130, 53, 135, 224, 138, 195, 219, 209, 109, 207, 64, 246, 161, 87, 89,
+    10, 212, 98, 78, 84, 174, 221, 69, 92, 140, 159, 118, 174, 68, 58, 88, 120, 132, 108, 174, 100, 75, 239, 87,
+    20, 252, 36, 88, 126, 8, 172, 61, 189, 22, 220, 245, 24, 41, 101, 109, 2, 181, 56, 171, 145, 79, 195, 12,
+    139, 81, 142, 195, 189, 200, 72, 40, 22, 68, 152, 44, 122, 143, 27, 208, 229, 247, 12, 244, 185, 16, 131, 44,
+    111, 52, 96, 62, 98, 31, 195, 208, 164, 249, 172, 141, 18, 174, 96, 216, 49, 72, 21, 114, 50, 135, 153, 135,
+    75, 79, 81, 87, 43, 3, 87, 244, 117, 45, 82, 39, 150, 202, 240, 236, 191, 177, 176, 73, 11, 152, 205, 241,
+    135, 225, 91, 64, 130, 110, 144, 108, 44, 176, 114, 165, 244, 123, 116, 232, 247, 190, 237, 92, 143, 139, 165, 186,
+    0, 247, 187, 82, 182, 234, 218, 2, 147, 65, 216, 85, 200, 201, 247, 106, 228, 67, 165, 186, 138, 185, 24, 70,
+    180, 228, 155, 17, 224, 232, 173, 34, 156, 77, 215, 58, 236, 59, 220, 138, 126, 24, 120, 57, 62, 166, 70, 175,
+    4, 109, 15, 170, 177, 106, 20, 226, 174, 68, 190, 245, 126, 163, 133, 171, 136, 119, 206, 159, 105, 8, 214, 19,
+    178, 193, 145, 226, 10, 121, 86, 208, 85, 200, 159, 60, 225, 88, 246, 29, 220, 85, 200, 41, 53, 212, 85, 200,
+    69, 141, 158, 40, 105, 15, 196, 134, 41, 6, 58, 132, 107, 14, 95, 113, 146, 48, 185, 72, 21, 114, 44, 179,
+    72, 212, 33, 210, 3, 230, 17, 99, 40, 76, 232, 22, 209, 88, 207, 97, 236, 51, 60, 8, 127, 15, 66, 147,
+    230, 178, 18, 8, 217, 35, 201, 176, 76, 59, 104, 42, 228, 67, 165, 165, 108, 122, 138, 185, 88, 5, 180, 86,
+    50, 37, 112, 90, 187, 116, 232, 247, 190, 237, 92, 143, 139, 165, 186, 0, 239, 114, 50, 125, 218, 185, 16, 233,
+    97, 53, 6, 178, 185, 145, 193, 154, 225, 34, 195, 193, 186, 181, 135, 47, 191, 81, 197, 215, 4, 83, 138, 185,
+    5, 38, 134, 20, 200, 246, 88, 217, 226, 135, 197, 210, 221, 135, 119, 21, 114, 37, 247, 171, 245, 30, 244, 197,
+    184, 56, 192, 246, 244, 91, 114, 60, 28, 188, 187, 72, 225, 106, 226, 174, 70, 208, 250, 172, 144, 249, 141, 227,
+    194, 48, 194, 230, 123, 15, 139, 248, 122, 20, 159, 53, 144, 144, 70, 175, 4, 109, 7, 210, 96, 181, 11, 152,
+    61, 68, 190, 164, 92, 165, 149, 180, 20, 252, 36, 88, 85, 200, 69, 141, 158, 43, 168, 122, 185, 137, 10, 199,
+    231, 182, 23, 36, 241, 142, 70, 29, 246, 86, 208, 120, 76, 188, 138, 126, 18, 44, 42, 228, 83, 240, 221, 186,
+    0, 232, 246, 88, 217, 226, 135, 197, 210, 221, 0, 255, 15, 184, 72, 133, 244, 66, 80, 171, 144, 139, 27, 60,
+    87, 81, 197, 204, 17, 87, 35, 100, 143, 42, 218, 12, 61, 5, 144, 131, 43, 163, 210, 228, 39, 34, 199, 176,
+    251, 159, 246, 45, 33, 243, 9, 189, 62, 169, 70, 194, 78, 51, 253, 246, 133, 244, 173, 160, 164, 249, 172, 132,
+    130, 52, 133, 182, 31, 47, 38, 221, 65, 76, 174, 18, 168, 235, 181, 43, 104, 41, 193, 106, 48, 42, 228, 82,
+    124, 212, 108, 145, 229, 91, 65, 135, 161, 78, 42, 228, 51, 197, 95, 176, 239, 114, 176, 36, 180, 188, 72, 146,
+    117, 25, 59, 103, 188, 155, 117, 25, 38, 242, 173, 160, 171, 157, 69, 56, 255, 47, 53, 130, 51, 120, 27, 60,
+    173, 43, 176, 225, 106, 239, 189, 13, 83, 202, 182, 131, 104, 125, 32, 204, 246, 29, 238, 66, 44, 5, 145, 154,
+    227, 6, 195, 133, 171, 131, 131, 149, 67, 178, 228, 50, 186, 234, 100, 35, 88, 85, 200, 226, 235, 16, 173, 160,
+    124, 193, 193, 202, 161, 114, 26, 189, 60, 79, 110, 128, 252, 233, 62, 107, 250, 15, 106, 163, 174, 212, 41, 197,
+    206, 54, 21, 114, 41, 62, 107, 219, 233, 250, 63, 58, 92, 188, 154, 253, 7, 176, 178, 206, 73, 22, 54, 27,
+    97, 24, 138, 92, 188, 154, 11, 33, 216, 85, 200, 210, 31, 118, 183, 111, 167, 232, 232, 247, 166, 45, 193, 198,
+    7, 183, 162, 219, 158, 128, 247, 166, 45, 193, 198, 7, 183, 162, 219, 145, 147, 181, 43, 110, 100, 75, 239, 87,
+    225, 34, 195, 56, 125, 69, 204, 30, 163, 133, 171, 138, 185, 20, 252, 48, 240, 114, 125, 85, 180, 22, 45, 38,
+    59, 14, 238, 42, 228, 112, 102, 186, 138, 185, 25, 162, 198, 144, 251, 181, 164, 36, 17, 233, 101, 124, 96, 245,
+    30, 55, 161, 187, 111, 59, 166, 49, 207, 81, 87, 33, 32, 160, 89, 19, 194, 70, 170, 218, 14, 22, 174, 33,
+    252, 61, 10, 79, 154, 207, 97, 222, 231, 145, 171, 250, 33, 88, 73, 58, 171, 105, 142, 68, 35, 89, 245, 27,
+    37, 81, 134, 158, 162, 95, 82, 50, 88, 203, 10, 218, 10, 185, 26, 67, 238, 214, 145, 197, 215, 4, 61, 92,
+    196, 136, 58, 162, 176, 154, 74, 87, 100, 142, 71, 11, 87, 23, 79, 217, 34, 195, 11, 165, 234, 70, 120, 73,
+    186, 182, 157, 186, 0, 232, 247, 166, 45, 193, 198, 7, 183, 162, 219, 158, 128, 246, 145, 203, 238, 54, 135, 200,
+    155, 4, 195, 182, 131, 222, 152, 183, 7, 24, 30, 222, 139, 110, 122, 142, 95, 112, 207, 75, 145, 8, 33, 252,
+    61, 10, 79, 154, 137, 167, 219, 99, 96, 172, 42, 228, 106, 182, 182, 8, 124, 197, 92, 136, 116, 183, 81, 116,
+    253, 146, 44, 48, 186, 94, 164, 120, 194, 183, 149, 109, 59, 15, 235, 67, 36, 222, 76, 132, 26, 171, 60, 10,
+    132, 207, 53, 200, 127, 148, 212, 36, 135, 171, 152, 30, 141, 215, 44, 25, 12, 158, 151, 68, 162, 18, 31, 118,
+    176, 90, 236, 59, 184, 171, 145, 193, 154, 234, 63, 149, 92, 124, 170, 9, 161, 226, 17, 178, 185, 144, 249, 231,
+    212, 96, 165, 149, 180, 22, 39, 99, 1, 90, 156, 85, 200, 167, 225, 187, 116, 232, 247, 166, 45, 193, 198, 7,
+    183, 162, 219, 158, 128, 247, 166, 45, 193, 198, 7, 183, 162, 219, 145, 147, 181, 43, 110, 100, 92, 193, 234, 21,
+    168, 196, 156, 169, 91, 65, 194, 213, 199, 213, 252, 42, 227, 229, 80, 77, 10, 113, 87, 35, 131, 53, 216, 119,
+    185, 13, 190, 190, 12, 7, 204, 67, 248, 122, 20, 159, 53, 144, 173, 148, 20, 147, 33, 158, 151, 34, 158, 49,
+    207, 97, 242, 125, 72, 72, 35, 100, 143, 38, 194, 233, 181, 211, 246, 72, 182, 57, 9, 135, 109, 5, 92, 140,
+    183, 143, 19, 212, 113, 117, 193, 15, 87, 49, 35, 76, 45, 136, 149, 193, 106, 199, 34, 207, 195, 10, 185, 19,
+    80, 77, 118, 31, 137, 177, 154, 133, 70, 145, 194, 86, 87, 21, 115, 168, 225, 106, 225, 6, 171, 243, 15, 152,
+    203, 120, 87, 149, 174, 66, 53, 134, 78, 217, 24, 110, 221, 0, 232, 247, 166, 45, 193, 198, 7, 183, 162, 219,
+    158, 128, 239, 114, 19, 209, 109, 200, 154, 131, 89, 92, 200, 103, 138, 184, 70, 176, 151, 222, 175, 212, 120, 222,
+    133, 92, 132, 173, 94, 118, 185, 130, 22, 69, 22, 147, 216, 119, 113, 87, 35, 131, 53, 212, 125, 95, 93, 92,
+    124, 170, 9, 160, 249, 230, 98, 66, 8, 125, 232, 132, 225, 57, 25, 195, 234, 42, 228, 106, 138, 194, 174, 240,
+    251, 233, 124, 210, 15, 97, 241, 127, 15, 66, 147, 230, 178, 18, 8, 203, 27, 205, 24, 54, 9, 66, 174, 66,
+    181, 24, 147, 149, 43, 183, 81, 87, 43, 3, 87, 244, 117, 45, 82, 12, 66, 82, 229, 216, 127, 118, 34, 147,
+    230, 163, 37, 140, 176, 100, 85, 200, 241, 135, 203, 200, 131, 177, 74, 54, 199, 61, 71, 23, 92, 16, 140, 245,
+    115, 1, 109, 131, 33, 90, 199, 53, 101, 163, 142, 123, 116, 232, 247, 166, 45, 193, 198, 2, 53, 135, 193, 116,
+    191, 9, 200, 254, 63, 103, 64, 255, 15, 184, 130, 153, 92, 85, 200, 213, 63, 203, 192, 86, 163, 18, 114, 165,
+    118, 15, 152, 247, 166, 45, 193, 198, 7, 183, 162, 219, 144, 141, 97, 240, 93, 47, 194, 114, 63, 143, 217, 216,
+    119, 185, 25, 67, 204, 195, 165, 164, 44, 143, 27, 205, 97, 91, 78, 163, 198, 244, 33, 252, 61, 10, 79, 154,
+    200, 179, 234, 172, 148, 69, 92, 138, 132, 207, 53, 203, 176, 239, 115, 200, 213, 253, 17, 194, 213, 198, 167, 43,
+    163, 46, 73, 129, 180, 28, 150, 85, 216, 114, 104, 97, 50, 242, 42, 228, 37, 147, 106, 79, 11, 133, 174, 67,
+    230, 47, 190, 168, 194, 208, 190, 140, 79, 81, 146, 111, 42, 218, 9, 223, 197, 96, 139, 44, 198, 251, 82, 187,
+    79, 97, 222, 228, 83, 240, 211, 155, 227, 200, 146, 117, 28, 36, 115, 212, 100, 147, 74, 218, 13, 216, 164, 242,
+    52, 194, 54, 70, 66, 80, 171, 144, 155, 211, 179, 234, 251, 200, 244, 110, 185, 96, 207, 110, 128, 232, 248, 46,
+    151, 225, 57, 31, 199, 236, 232, 248, 46, 151, 225, 57, 31, 199, 236, 7, 231, 69, 173, 32, 164, 208, 70, 176,
+    224, 205, 11, 152, 61, 70, 21, 141, 135, 11, 87, 30, 30, 220, 137, 187, 237, 61, 66, 111, 78, 32, 236, 139,
+    3, 34, 212, 98, 122, 132, 107, 12, 146, 5, 138, 96, 196, 221, 118, 158, 195, 189, 200, 241, 188, 171, 25, 147,
+    33, 32, 143, 27, 207, 61, 71, 141, 232, 106, 141, 200, 146, 117, 27, 65, 124, 178, 223, 101, 54, 28, 45, 92,
+    73, 143, 75, 146, 182, 130, 31, 195, 208, 164, 249, 172, 246, 29, 238, 71, 163, 117, 203, 6, 71, 235, 185, 220,
+    141, 246, 15, 189, 74, 216, 141, 18, 19, 67, 61, 66, 112, 139, 74, 218, 13, 81, 90, 139, 35, 100, 67, 192,
+    131, 178, 44, 79, 81, 87, 43, 2, 203, 162, 210, 96, 89, 103, 108, 39, 50, 51, 194, 77, 213, 180, 22, 84,
+    209, 158, 105, 114, 26, 153, 148, 208, 207, 110, 128, 232, 248, 46, 151, 225, 57, 31, 199, 236, 232, 239, 117, 145,
+    39, 42, 87, 96, 249, 143, 130, 233, 126, 19, 145, 252, 126, 192, 178, 54, 72, 165, 203, 124, 36, 99, 145, 147,
+    182, 134, 104, 216, 112, 181, 113, 15, 225, 232, 82, 124, 214, 69, 202, 89, 91, 65, 79, 194, 69, 130, 48, 77,
+    233, 196, 29, 145, 96, 77, 223, 97, 78, 42, 228, 51, 197, 95, 176, 239, 114, 41, 62, 107, 32, 181, 24, 8,
+    214, 7, 230, 180, 42, 228, 102, 153, 46, 22, 185, 10, 193, 4, 209, 75, 114, 38, 160, 166, 189, 135, 224, 114,
+    186, 50, 229, 33, 26, 194, 142, 87, 101, 201, 81, 164, 112, 241, 228, 82, 193, 193, 153, 199, 61, 69, 92, 172,
+    12, 211, 35, 34, 110, 252, 43, 104, 37, 116, 105, 15, 152, 205, 41, 116, 220, 246, 29, 238, 70, 78, 211, 72,
+    212, 47, 190, 161, 243, 7, 7, 42, 133, 200, 106, 244, 241, 35, 53, 198, 36, 85, 200, 69, 142, 221, 0, 232,
+    246, 222, 156, 124, 78, 200, 176, 62, 87, 125, 186, 0, 254, 173, 43, 98, 42, 228, 38, 244, 226, 14, 200, 176,
+    38, 239, 183, 81, 87, 34, 118, 76, 136, 186, 72, 240, 75, 10, 132, 105, 205, 227, 83, 97, 78, 19, 44, 159,
+    93, 94, 201, 68, 28, 28, 170, 23, 32, 141, 96, 155, 211, 234, 148, 108, 41, 62, 107, 61, 135, 181, 189, 35,
+    100, 108, 50, 125, 118, 222, 140, 9, 230, 104, 235, 33, 26, 192, 224, 229, 80, 236, 185, 3, 250, 238, 187, 106,
+    90, 131, 229, 150, 251, 114, 15, 163, 28, 140, 158, 24, 199, 97, 236, 33, 252, 61, 10, 79, 154, 133, 97, 87,
+    35, 68, 132, 208, 132, 170, 58, 237, 82, 41, 198, 216, 223, 64, 181, 39, 25, 133, 106, 112, 131, 43, 164, 104,
+    173, 160, 154, 74, 87, 110, 161, 106, 70, 78, 204, 114, 167, 137, 25, 239, 175, 140, 43, 104, 18, 66, 230, 53,
+    89, 76, 46, 140, 109, 216, 119, 57, 93, 151, 37, 70, 145, 27, 205, 194, 120, 125, 235, 168, 213, 25, 52, 86,
+    208, 65, 217, 22, 36, 35, 88, 75, 231, 92, 36, 17, 190, 214, 74, 51, 219, 160, 252, 233, 49, 231, 244, 29,
+    211, 30, 69, 56, 171, 145, 7, 100, 88, 20, 114, 191, 111, 167, 232, 232, 248, 46, 151, 225, 57, 31, 199, 236,
+    232, 248, 46, 151, 225, 57, 31, 199, 236, 25, 59, 82, 182, 230, 69, 204, 30, 163, 198, 244, 42, 228, 37, 106,
+    243, 181, 204, 16, 178, 55, 105, 53, 88, 86, 211, 176, 248, 191, 135, 161, 73, 243, 89, 22, 125, 85, 146, 136,
+    171, 145, 14, 150, 225, 57, 234, 37, 245, 35, 87, 244, 173, 160, 49, 9, 75, 146, 99, 28, 246, 30, 195, 51,
+    192, 164, 249, 172, 139, 167, 162, 38, 159, 109, 141, 130, 98, 159, 67, 87, 49, 212, 85, 202, 192, 158, 102, 142,
+    178, 36, 157, 85, 180, 199, 33, 88, 77, 35, 91, 199, 35, 87, 177, 236, 63, 189, 92, 192, 180, 47, 163, 18,
+    25, 61, 46, 137, 68, 100, 155, 210, 190, 243, 142, 122, 141, 218, 119, 130, 31, 49, 87, 33, 55, 167, 103, 213,
+    247, 145, 232, 221, 114, 193, 159, 112, 99, 243, 161, 171, 250, 51, 219, 160, 232, 248, 46, 151, 225, 57, 31, 199,
+    236, 232, 246, 161, 87, 89, 27, 58, 181, 7, 97, 240, 93, 47, 194, 114, 63, 143, 217, 212, 83, 138, 185, 12,
+    241, 87, 11, 33, 6, 207, 182, 248, 72, 16, 102, 147, 120, 70, 160, 201, 169, 176, 247, 119, 185, 31, 240, 181,
+    149, 203, 118, 247, 14, 247, 35, 100, 143, 42, 218, 12, 61, 5, 145, 154, 227, 6, 221, 67, 61, 15, 243, 188,
+    208, 225, 106, 227, 100, 168, 118, 159, 112, 201, 34, 71, 141, 232, 38, 37, 199, 11, 87, 16, 254, 30, 133, 39,
+    205, 103, 168, 213, 27, 144, 249, 142, 46, 185, 92, 93, 61, 17, 87, 43, 2, 233, 251, 36, 88, 97, 116, 189,
+    72, 118, 236, 62, 79, 169, 20, 159, 53, 145, 227, 15, 151, 145, 178, 71, 149, 109, 4, 236, 153, 25, 15, 0,
+    181, 66, 54, 70, 122, 140, 147, 121, 86, 208, 103, 27, 205, 66, 82, 187, 4, 213, 219, 65, 233, 101, 105, 226,
+    123, 116, 252, 233, 62, 107, 250, 15, 106, 163, 174, 212, 41, 197, 206, 54, 21, 114, 41, 62, 107, 219, 233, 250,
+    58, 0, 239, 114, 63, 225, 107, 43, 150, 232, 255, 15, 184, 154, 59, 5, 106, 113, 238, 239, 114, 63, 225, 107,
+    43, 150, 235, 238, 8, 50, 127, 219, 145, 6, 105, 55, 132, 106, 30, 89, 248, 97, 155, 192, 90, 145, 119, 212,
+    205, 115, 130, 50, 119, 242, 173, 167, 97, 222, 228, 36, 62, 168, 31, 49, 156, 25, 190, 57, 27, 65, 217, 32,
+    216, 106, 83, 18, 51, 92, 98, 69, 92, 132, 88, 236, 62, 227, 59, 45, 17, 87, 35, 43, 163, 200, 125, 234,
+    86, 199, 168, 171, 144, 173, 70, 21, 224, 44, 142, 18, 53, 8, 214, 10, 222, 150, 149, 180, 236, 63, 20, 168,
+    118, 145, 101, 156, 183, 153, 21, 114, 55, 109, 231, 116, 192, 240, 110, 158, 149, 224, 62, 98, 174, 68, 63, 135,
+    161, 73, 243, 89, 15, 232, 192, 185, 72, 174, 70, 165, 49, 61, 186, 0, 232, 250, 190, 186, 184, 249, 84, 19,
+    93, 0, 250, 190, 186, 184, 249, 84, 19, 64, 252, 232, 181, 164, 112, 102, 184, 72, 176, 206, 31, 81, 115, 7,
+    176, 239, 114, 38, 160, 154, 11, 35, 245, 221, 77, 24, 234, 60, 111, 66, 174, 70, 208, 100, 182, 68, 62, 98,
+    31, 195, 208, 164, 249, 172, 133, 145, 52, 184, 192, 103, 164, 241, 131, 216, 119, 185, 228, 105, 133, 177, 9, 135,
+    109, 5, 92, 136, 116, 183, 80, 249, 100, 146, 174, 201, 140, 114, 54, 77, 229, 91, 64, 172, 126, 123, 97, 114,
+    79, 24, 228, 120, 57, 188, 17, 6, 119, 213, 91, 65, 87, 43, 2, 31, 122, 51, 216, 124, 76, 173, 139, 84,
+    142, 18, 178, 184, 206, 31, 81, 87, 43, 3, 103, 140, 174, 103, 168, 221, 138, 79, 33, 60, 62, 244, 42, 228,
+    105, 15, 194, 182, 129, 183, 215, 193, 128, 249, 132, 222, 157, 159, 87, 222, 71, 163, 117, 203, 6, 123, 116, 232,
+    250, 190, 186, 184, 249, 84, 19, 93, 0, 254, 236, 42, 235, 34, 106, 13, 101, 112, 249, 143, 171, 235, 171, 143,
+    149, 65, 53, 212, 32, 163, 131, 147, 235, 174, 236, 185, 37, 43, 180, 137, 49, 233, 114, 50, 31, 60, 215, 34,
+    60, 110, 184, 178, 182, 130, 105, 26, 210, 41, 197, 92, 137, 125, 234, 253, 135, 123, 145, 227, 117, 197, 149, 180,
+    9, 182, 197, 34, 71, 141, 231, 158, 163, 133, 171, 131, 174, 216, 126, 73, 145, 171, 250, 86, 208, 95, 120, 133,
+    54, 199, 33, 90, 86, 199, 176, 249, 62, 164, 112, 241, 228, 196, 137, 163, 176, 125, 234, 86, 196, 83, 141, 83,
+    201, 25, 38, 49, 61, 69, 92, 172, 3, 243, 218, 12, 202, 187, 72, 162, 210, 123, 15, 139, 248, 122, 20, 159,
+    53, 144, 249, 100, 146, 174, 201, 140, 114, 54, 223, 24, 27, 236, 41, 197, 92, 140, 183, 143, 3, 193, 205, 224,
+    139, 66, 250, 86, 208, 62, 121, 141, 95, 82, 213, 35, 9, 70, 59, 116, 232, 238, 112, 114, 125, 71, 200, 199,
+    165, 200, 207, 64, 254, 173, 43, 98, 42, 228, 81, 193, 201, 245, 215, 118, 92, 146, 149, 218, 67, 231, 154, 228,
+    122, 138, 185, 9, 90, 188, 237, 115, 4, 44, 140, 225, 26, 151, 46, 195, 239, 215, 108, 63, 36, 200, 178, 69,
+    15, 6, 184, 37, 131, 231, 154, 228, 100, 35, 88, 101, 191, 133, 203, 6, 122, 141, 174, 236, 100, 109, 6, 100,
+    216, 83, 138, 185, 88, 5, 34, 123, 15, 195, 124, 82, 237, 130, 40, 229, 118, 92, 149, 26, 71, 249, 223, 77,
+    48, 70, 73, 140, 72, 70, 176, 213, 217, 105, 224, 78, 80, 75, 72, 178, 206, 216, 78, 85, 180, 12, 107, 135,
+    143, 34, 105, 43, 121, 51, 216, 119, 185, 19, 188, 104, 66, 176, 135, 240, 244, 41, 62, 106, 19, 42, 95, 75,
+    92, 137, 39, 89, 20, 227, 193, 19, 80, 138, 202, 218, 12, 159, 93, 119, 101, 201, 41, 93, 131, 26, 225, 227,
+    204, 246, 232, 252, 233, 49, 231, 244, 29, 211, 30, 69, 56, 171, 145, 71, 43, 178, 228, 168, 221, 190, 159, 163,
+    160, 250, 190, 186, 184, 70, 176, 251, 97, 210, 220, 39, 61, 0, 246, 161, 87, 33, 90, 140, 73, 202, 149, 216,
+    62, 99, 234, 250, 234, 227, 229, 80, 77, 4, 107, 15, 182, 29, 45, 194, 115, 212, 84, 38, 121, 174, 65, 100,
+    92, 167, 165, 49, 216, 125, 176, 233, 110, 19, 145, 27, 180, 134, 120, 171, 132, 107, 9, 125, 234, 253, 68, 152,
+    244, 173, 160, 73, 8, 53, 69, 96, 145, 70, 57, 21, 120, 125, 244, 184, 167, 225, 187, 15, 139, 248, 122, 20,
+    159, 53, 144, 144, 70, 216, 45, 75, 158, 248, 23, 48, 122, 138, 185, 88, 27, 65, 146, 217, 17, 146, 111, 42,
+    218, 9, 223, 197, 96, 139, 44, 198, 251, 82, 187, 72, 73, 21, 115, 200, 205, 23, 2, 156, 37, 147, 106, 20,
+    227, 43, 163, 104, 173, 160, 168, 76, 243, 92, 134, 201, 84, 97, 164, 36, 137, 213, 222, 175, 142, 66, 72, 190,
+    250, 163, 11, 66, 250, 49, 61, 186, 0, 232, 250, 190, 186, 184, 249, 84, 19, 93, 0, 250, 190, 186, 184, 249,
+    84, 19, 67, 39, 106, 86, 220, 207, 81, 227, 122, 21, 114, 33, 210, 193, 46, 82, 193, 100, 108, 145, 74, 152,
+    199, 35, 198, 31, 47, 38, 195, 199, 33, 4, 210, 99, 6, 194, 31, 195, 208, 164, 249, 175, 97, 253, 106, 69,
+    211, 246, 72, 176, 194, 233, 122, 145, 158, 18, 111, 212, 35, 88, 45, 3, 170, 212, 132, 18, 249, 208, 202, 235,
+    169, 236, 63, 189, 92, 192, 244, 110, 185, 96, 200, 213, 24, 239, 232, 192, 72, 125, 218, 193, 104, 100, 144, 115,
+    223, 24, 231, 176, 239, 114, 60, 110, 184, 178, 182, 146, 19, 14, 218, 10, 185, 19, 80, 77, 4, 130, 16, 106,
+    191, 48, 249, 136, 50, 182, 45, 74, 152, 23, 125, 76, 132, 107, 9, 213, 49, 129, 227, 121, 86, 51, 38, 122,
+    138, 185, 88, 15, 150, 91, 236, 141, 82, 31, 196, 152, 244, 173, 160, 171, 145, 57, 22, 35, 133, 171, 140, 157,
+    178, 48, 221, 186, 0, 232, 252, 17, 88, 35, 88, 125, 95, 93, 92, 124, 170, 9, 174, 128, 255, 15, 184, 72,
+    133, 244, 66, 80, 171, 145, 147, 195, 24, 15, 152, 252, 17, 88, 123, 122, 45, 185, 8, 214, 31, 87, 215, 87,
+    31, 42, 130, 107, 176, 239, 114, 18, 10, 5, 145, 131, 50, 50, 118, 208, 205, 27, 117, 15, 158, 102, 21, 180,
+    8, 60, 66, 156, 196, 25, 217, 104, 140, 225, 245, 21, 114, 33, 252, 61, 10, 79, 154, 140, 174, 143, 61, 135,
+    120, 38, 70, 21, 136, 171, 145, 43, 99, 194, 99, 204, 245, 8, 214, 8, 51, 60, 13, 141, 140, 212, 42, 52,
+    137, 168, 124, 96, 96, 172, 239, 7, 28, 246, 29, 238, 68, 212, 19, 88, 93, 47, 82, 46, 96, 139, 167, 162,
+    60, 18, 194, 13, 67, 230, 181, 70, 195, 133, 171, 137, 45, 47, 19, 212, 108, 243, 43, 227, 28, 138, 112, 153,
+    100, 250, 234, 246, 74, 34, 174, 66, 111, 78, 207, 171, 239, 35, 209, 186, 229, 131, 61, 186, 0, 232, 252, 17,
+    88, 123, 122, 45, 185, 232, 252, 17, 88, 123, 122, 45, 185, 19, 80, 107, 43, 153, 12, 241, 87, 8, 214, 18,
+    251, 213, 250, 137, 49, 233, 91, 64, 146, 29, 136, 124, 197, 92, 138, 126, 27, 221, 35, 104, 93, 82, 57, 16,
+    233, 105, 236, 59, 220, 132, 244, 91, 114, 22, 70, 21, 141, 135, 11, 87, 15, 158, 107, 145, 30, 55, 92, 89,
+    91, 73, 8, 214, 26, 238, 203, 146, 236, 152, 18, 99, 210, 228, 103, 176, 239, 114, 33, 252, 61, 10, 79, 154,
+    200, 72, 35, 51, 193, 129, 115, 7, 168, 241, 189, 10, 185, 88, 27, 65, 146, 217, 16, 178, 38, 151, 24, 12,
+    244, 185, 20, 241, 131, 216, 124, 159, 82, 18, 8, 217, 35, 201, 176, 76, 59, 104, 42, 228, 77, 65, 53, 212,
+    22, 209, 88, 200, 91, 97, 91, 65, 43, 130, 213, 142, 123, 116, 232, 252, 17, 88, 123, 122, 45, 185, 232, 247,
+    187, 82, 182, 234, 218, 4, 195, 182, 131, 240, 69, 97, 237, 232, 182, 231, 168, 229, 247, 16, 83, 43, 138, 185,
+    10, 212, 98, 78, 84, 174, 195, 133, 171, 143, 171, 248, 85, 199, 202, 160, 154, 20, 226, 174, 65, 73, 174, 195,
+    189, 200, 157, 226, 31, 118, 178, 182, 146, 60, 28, 159, 82, 53, 120, 35, 120, 240, 141, 212, 112, 181, 113, 73,
+    140, 24, 30, 55, 92, 89, 91, 73, 8, 214, 10, 217, 65, 73, 54, 25, 187, 208, 168, 76, 243, 92, 187, 15,
+    139, 248, 122, 20, 159, 53, 145, 148, 110, 178, 71, 142, 68, 209, 75, 46, 57, 234, 60, 111, 66, 230, 8, 171,
+    158, 68, 147, 168, 167, 10, 212, 116, 132, 162, 53, 120, 34, 117, 119, 171, 227, 145, 194, 213, 197, 66, 89, 105,
+    93, 147, 2, 161, 51, 205, 114, 237, 208, 232, 252, 17, 88, 123, 122, 45, 185, 232, 239, 117, 145, 178, 69, 7,
+    204, 126, 8, 172, 61, 189, 22, 220, 133, 145, 133, 99, 97, 194, 213, 198, 18, 52, 33, 243, 205, 114, 35, 198,
+    235, 139, 43, 105, 33, 26, 195, 37, 174, 68, 152, 244, 185, 17, 154, 100, 184, 90, 83, 61, 135, 123, 144, 145,
+    149, 214, 142, 85, 188, 16, 178, 53, 123, 24, 110, 163, 133, 171, 141, 48, 147, 35, 52, 201, 44, 100, 35, 88,
+    78, 9, 242, 44, 101, 116, 105, 236, 59, 220, 137, 91, 30, 19, 30, 100, 36, 17, 227, 121, 228, 112, 181, 113,
+    180, 62, 102, 101, 93, 147, 19, 212, 35, 88, 67, 248, 122, 20, 159, 53, 145, 166, 22, 196, 120, 231, 168, 124,
+    178, 73, 87, 100, 198, 57, 19, 79, 182, 202, 218, 10, 113, 131, 67, 100, 153, 45, 161, 137, 22, 89, 58, 248,
+    72, 243, 216, 119, 185, 10, 212, 116, 132, 165, 118, 15, 152, 77, 233, 217, 245, 125, 228, 122, 55, 92, 176, 100,
+    38, 219, 20, 137, 26, 188, 17, 37, 53, 193, 153, 23, 48, 123, 116, 232, 248, 187, 234, 62, 191, 175, 253, 122,
+    0, 251, 245, 218, 185, 31, 23, 125, 71, 238, 250, 254, 191, 245, 232, 232, 252, 17, 88, 123, 122, 45, 185, 232,
+    246, 161, 87, 89, 31, 231, 118, 202, 183, 131, 212, 126, 8, 172, 61, 189, 22, 220, 139, 148, 180, 137, 125, 234,
+    253, 70, 10, 89, 91, 65, 225, 50, 242, 41, 248, 72, 176, 171, 145, 114, 145, 65, 243, 21, 114, 41, 248, 110,
+    195, 187, 138, 185, 12, 241, 87, 234, 22, 134, 78, 204, 114, 169, 28, 45, 92, 85, 200, 201, 247, 106, 228, 67,
+    165, 133, 93, 40, 96, 165, 164, 83, 138, 185, 8, 177, 179, 197, 118, 31, 23, 240, 244, 41, 62, 107, 33, 32,
+    141, 160, 250, 76, 22, 174, 163, 84, 110, 69, 202, 89, 91, 65, 79, 194, 69, 133, 92, 132, 88, 217, 226, 131,
+    192, 171, 145, 79, 195, 12, 139, 81, 142, 195, 189, 202, 192, 213, 253, 29, 75, 84, 132, 130, 53, 53, 119, 178,
+    228, 152, 234, 60, 111, 65, 24, 110, 214, 49, 150, 241, 5, 168, 62, 99, 118, 218, 13, 151, 42, 79, 11, 133,
+    174, 71, 146, 118, 145, 177, 125, 176, 67, 176, 54, 208, 246, 232, 232, 239, 114, 63, 162, 44, 105, 15, 187, 90,
+    122, 0, 239, 114, 51, 69, 141, 33, 247, 107, 72, 72, 33, 48, 190, 136, 225, 106, 225, 50, 165, 244, 181, 207,
+    81, 119, 154, 86, 208, 113, 116, 160, 155, 108, 82, 36, 83, 143, 4, 32, 212, 217, 79, 164, 199, 239, 171, 157,
+    77, 134, 102, 105, 125, 38, 59, 15, 196, 190, 216, 33, 88, 28, 39, 135, 132, 162, 50, 121, 173, 245, 50, 11,
+    104, 154, 16, 172, 53, 124, 188, 143, 9, 85, 131, 61, 66, 53, 135, 162, 214, 120, 145, 39, 24, 8, 193, 34,
+    19, 144, 249, 140, 221, 237, 33, 26, 195, 40, 76, 234, 123, 15, 131, 240, 125, 24, 234, 42, 228, 102, 102, 151,
+    209, 9, 90, 188, 237, 115, 4, 44, 141, 82, 32, 216, 120, 228, 85, 200, 218, 12, 150, 200, 135, 204, 54, 250,
+    152, 125, 228, 67, 248, 122, 20, 159, 53, 158, 195, 189, 207, 35, 40, 126, 44, 42, 228, 108, 145, 229, 91, 64,
+    144, 82, 66, 53, 129, 244, 88, 22, 202, 29, 50, 184, 223, 103, 97, 177, 177, 154, 133, 70, 19, 178, 100, 103,
+    168, 171, 149, 129, 116, 253, 146, 44, 48, 186, 94, 164, 120, 194, 183, 149, 109, 2, 72, 171, 158, 66, 85, 29,
+    118, 161, 78, 25, 61, 46, 137, 68, 85, 200, 201, 219, 67, 52, 108, 52, 135, 221, 173, 61, 186, 0, 252, 233,
+    62, 107, 250, 15, 106, 163, 174, 212, 41, 197, 206, 54, 21, 114, 41, 62, 107, 219, 233, 250, 63, 60, 29, 63,
+    65, 242, 125, 75, 177, 23, 73, 24, 57, 208, 65, 177, 140, 206, 85, 142, 66, 181, 38, 84, 43, 120, 242, 121,
+    24, 58, 118, 250, 126, 142, 128, 254, 85, 113, 242, 168, 38, 186, 0, 254, 85, 113, 242, 168, 38, 132, 110, 210,
+    10, 77, 4, 107, 14, 12, 208, 185, 131, 212, 73, 143, 74, 218, 4, 144, 131, 245, 221, 77, 24, 9, 138, 48,
+    201, 75, 232, 138, 113, 87, 35, 198, 242, 166, 6, 168, 172, 33, 210, 211, 216, 119, 185, 19, 80, 77, 5, 145,
+    6, 86, 197, 169, 83, 29, 71, 11, 87, 25, 93, 35, 85, 109, 5, 223, 121, 50, 17, 172, 56, 56, 199, 239,
+    242, 118, 161, 132, 225, 167, 176, 248, 191, 135, 161, 73, 243, 89, 15, 150, 73, 42, 236, 152, 199, 35, 100, 153,
+    30, 57, 234, 60, 111, 66, 174, 86, 3, 111, 175, 131, 18, 18, 8, 204, 240, 99, 176, 247, 221, 113, 104, 44,
+    54, 194, 114, 21, 135, 41, 22, 145, 187, 88, 192, 171, 145, 194, 86, 87, 207, 124, 3, 201, 144, 249, 141, 146,
+    11, 84, 245, 28, 93, 195, 229, 146, 74, 187, 38, 49, 200, 211, 8, 217, 16, 198, 61, 62, 243, 142, 66, 80,
+    171, 144, 155, 211, 179, 234, 251, 200, 244, 110, 185, 96, 207, 110, 128, 232, 254, 85, 112, 141, 97, 246, 195, 165,
+    184, 78, 122, 0, 246, 161, 87, 33, 90, 140, 73, 202, 149, 216, 62, 99, 249, 85, 199, 202, 160, 154, 8, 214,
+    31, 108, 58, 91, 132, 231, 168, 171, 145, 80, 153, 230, 185, 5, 106, 45, 43, 154, 153, 236, 62, 216, 116, 183,
+    9, 200, 89, 30, 55, 154, 194, 182, 157, 66, 53, 132, 63, 135, 161, 73, 243, 89, 9, 4, 109, 15, 170, 177,
+    106, 14, 217, 16, 154, 34, 183, 97, 242, 125, 72, 164, 249, 172, 139, 153, 90, 74, 33, 40, 85, 200, 86, 163,
+    18, 114, 165, 118, 234, 50, 77, 229, 91, 65, 170, 179, 192, 177, 194, 115, 61, 135, 226, 108, 102, 161, 81, 164,
+    112, 139, 67, 36, 222, 149, 247, 156, 114, 18, 134, 80, 243, 60, 38, 60, 207, 80, 90, 119, 133, 109, 5, 92,
+    138, 79, 154, 200, 201, 245, 34, 156, 100, 250, 237, 131, 68, 77, 62, 210, 60, 28, 222, 8, 202, 30, 101, 91,
+    78, 221, 0, 232, 254, 85, 113, 242, 168, 38, 186, 0, 254, 85, 113, 242, 168, 38, 134, 78, 212, 173, 185, 158,
+    163, 39, 102, 57, 82, 182, 130, 156, 123, 211, 22, 224, 227, 3, 219, 209, 109, 200, 167, 21, 114, 10, 77, 4,
+    107, 15, 182, 29, 45, 194, 114, 41, 197, 92, 142, 12, 215, 97, 222, 228, 67, 165, 130, 200, 213, 236, 97, 40,
+    227, 145, 227, 121, 231, 168, 241, 189, 8, 127, 15, 66, 147, 230, 178, 18, 8, 65, 147, 235, 171, 176, 149, 210,
+    245, 216, 127, 118, 34, 147, 230, 161, 54, 216, 164, 72, 167, 30, 8, 201, 99, 44, 43, 104, 42, 228, 120, 195,
+    229, 228, 65, 216, 165, 27, 99, 158, 161, 106, 71, 131, 116, 244, 175, 2, 208, 156, 43, 104, 50, 222, 21, 247,
+    145, 135, 127, 50, 51, 135, 212, 120, 230, 105, 26, 198, 39, 183, 64, 232, 251, 97, 210, 220, 39, 61, 0, 251,
+    97, 210, 220, 39, 34, 230, 8, 141, 218, 67, 60, 85, 194, 53, 132, 190, 245, 126, 163, 10, 198, 195, 133, 171,
+    137, 187, 237, 61, 70, 73, 153, 158, 161, 26, 195, 198, 242, 172, 102, 76, 246, 29, 238, 68, 173, 143, 9, 143,
+    50, 18, 8, 202, 31, 139, 27, 117, 8, 214, 21, 114, 38, 160, 154, 11, 35, 53, 198, 13, 135, 11, 87, 30,
+    30, 174, 47, 190, 168, 223, 190, 208, 190, 139, 12, 146, 36, 35, 88, 67, 248, 122, 20, 159, 53, 158, 195, 189,
+    200, 164, 249, 172, 141, 95, 209, 10, 193, 227, 68, 101, 253, 141, 134, 201, 84, 97, 167, 168, 241, 189, 7, 203,
+    36, 149, 118, 76, 13, 48, 181, 149, 204, 140, 147, 121, 33, 60, 70, 251, 80, 154, 125, 164, 60, 13, 216, 252,
+    246, 57, 81, 176, 173, 225, 167, 183, 64, 232, 251, 97, 210, 220, 39, 33, 26, 195, 234, 254, 21, 126, 128, 246,
+    161, 87, 33, 90, 140, 73, 202, 149, 216, 62, 99, 237, 135, 75, 112, 156, 132, 107, 15, 171, 248, 85, 199, 202,
+    160, 154, 234, 42, 228, 78, 69, 136, 89, 25, 93, 30, 151, 46, 195, 226, 254, 30, 133, 39, 205, 100, 101, 135,
+    208, 85, 200, 86, 163, 18, 114, 165, 118, 234, 37, 245, 34, 105, 49, 131, 97, 194, 213, 197, 211, 246, 72, 176,
+    194, 233, 122, 145, 158, 18, 110, 173, 167, 80, 245, 115, 18, 25, 61, 46, 137, 74, 218, 13, 219, 104, 54, 92,
+    169, 60, 99, 158, 195, 238, 133, 244, 98, 69, 221, 188, 133, 97, 156, 111, 53, 9, 74, 237, 212, 35, 88, 108,
+    108, 102, 161, 81, 164, 112, 83, 209, 25, 36, 28, 247, 198, 57, 21, 120, 125, 244, 184, 171, 145, 147, 182, 134,
+    105, 93, 187, 14, 247, 34, 86, 183, 74, 87, 97, 36, 235, 34, 156, 120, 32, 206, 73, 132, 165, 109, 59, 116,
+    232, 250, 191, 133, 92, 124, 170, 9, 174, 128, 250, 191, 133, 92, 124, 170, 9, 160, 126, 116, 90, 210, 10, 77,
+    4, 107, 14, 12, 215, 80, 249, 230, 97, 91, 64, 130, 12, 236, 180, 70, 112, 250, 138, 185, 25, 59, 104, 102,
+    141, 135, 219, 14, 150, 225, 57, 236, 59, 220, 137, 168, 38, 130, 200, 193, 153, 25, 67, 241, 99, 110, 163, 198,
+    244, 33, 252, 61, 10, 79, 154, 200, 72, 34, 105, 113, 129, 180, 25, 45, 93, 135, 123, 158, 70, 175, 232, 137,
+    162, 150, 92, 115, 212, 85, 202, 192, 135, 222, 140, 137, 39, 85, 109, 49, 200, 221, 147, 60, 206, 84, 108, 60,
+    114, 42, 228, 89, 102, 55, 218, 149, 218, 65, 196, 158, 46, 96, 246, 232, 232, 251, 97, 210, 220, 39, 61, 0,
+    251, 97, 210, 220, 39, 35, 39, 106, 86, 220, 200, 185, 131, 212, 120, 222, 133, 92, 138, 132, 207, 53, 200, 44,
+    139, 22, 147, 216, 124, 95, 195, 208, 164, 249, 172, 132, 130, 15, 163, 28, 241, 115, 7, 168, 70, 176, 171, 149,
+    128, 219, 235, 224, 196, 137, 39, 81, 78, 60, 16, 173, 148, 20, 149, 109, 59, 15, 147, 234, 69, 39, 205, 100,
+    93, 61, 17, 52, 251, 108, 108, 19, 20, 250, 26, 185, 142, 163, 36, 222, 85, 180, 30, 30, 171, 5, 142, 94,
+    103, 176, 239, 114, 17, 96, 44, 140, 215, 24, 54, 28, 45, 92, 85, 200, 151, 221, 173, 33, 243, 11, 108, 43,
+    104, 11, 104, 172, 100, 35, 88, 85, 200, 124, 178, 73, 87, 100, 192, 149, 130, 193, 88, 85, 200, 178, 205, 35,
+    100, 123, 116, 232, 250, 191, 133, 92, 124, 170, 9, 174, 128, 254, 236, 62, 175, 225, 87, 31, 42, 130, 107, 168,
+    167, 21, 114, 10, 77, 5, 145, 239, 76, 91, 131, 140, 15, 111, 69, 183, 61, 71, 23, 48, 68, 63, 135, 161,
+    73, 243, 89, 25, 99, 121, 163, 1, 88, 105, 5, 40, 192, 109, 245, 240, 98, 123, 14, 238, 42, 228, 112, 102,
+    130, 200, 251, 97, 210, 220, 39, 61, 70, 91, 196, 22, 172, 114, 50, 118, 208, 205, 27, 14, 22, 174, 38, 147,
+    24, 54, 20, 159, 53, 144, 141, 97, 156, 111, 53, 9, 70, 194, 208, 190, 140, 79, 97, 222, 228, 74, 214, 233,
+    74, 236, 46, 96, 133, 145, 69, 164, 143, 27, 208, 156, 46, 151, 172, 114, 48, 102, 70, 87, 71, 165, 203, 183,
+    64, 232, 238, 159, 53, 31, 138, 71, 149, 109, 58, 0, 255, 15, 184, 72, 133, 244, 66, 80, 65, 132, 141, 8,
+    164, 249, 168, 217, 35, 202, 182, 131, 15, 65, 138, 64, 171, 144, 139, 27, 60, 87, 97, 222, 228, 36, 20, 11,
+    33, 88, 89, 101, 34, 19, 158, 163, 133, 171, 140, 159, 118, 172, 25, 145, 15, 225, 232, 82, 124, 214, 71, 174,
+    85, 180, 25, 188, 13, 146, 60, 171, 104, 39, 100, 200, 207, 97, 253, 216, 138, 79, 154, 143, 24, 124, 188, 200,
+    171, 144, 90, 161, 27, 34, 11, 82, 193, 199, 61, 66, 212, 139, 167, 236, 145, 97, 133, 210, 245, 35, 60, 36,
+    221, 91, 64, 173, 145, 153, 70, 172, 115, 216, 127, 122, 185, 129, 73, 243, 89, 23, 118, 242, 42, 229, 96, 28,
+    28, 170, 29, 151, 33, 119, 134, 144, 172, 16, 89, 103, 39, 139, 35, 80, 158, 117, 218, 238, 220, 245, 21, 114,
+    176, 39, 153, 163, 172, 137, 39, 85, 109, 49, 200, 127, 70, 56, 185, 198, 166, 221, 135, 123, 145, 57, 22, 33,
+    100, 32, 163, 52, 154, 150, 161, 78, 42, 228, 25, 201, 48, 148, 173, 160, 89, 157, 204, 142, 22, 174, 42, 228,
+    38, 244, 236, 250, 190, 242, 51, 193, 53, 219, 160, 252, 233, 62, 107, 250, 15, 106, 163, 174, 212, 41, 197, 206,
+    54, 21, 114, 41, 62, 107, 219, 233, 250, 58, 0, 252, 142, 50, 125, 72, 167, 31, 115, 219, 66, 61, 235, 92,
+    244, 252, 142, 50, 125, 72, 167, 31, 115, 219, 66, 61, 235, 92, 245, 28, 92, 193, 21, 114, 39, 101, 133, 160,
+    249, 138, 185, 31, 223, 22, 31, 145, 154, 21, 120, 95, 70, 66, 106, 182, 154, 26, 189, 140, 48, 165, 212, 207,
+    97, 249, 59, 216, 176, 205, 50, 75, 25, 15, 152, 148, 195, 187, 72, 70, 176, 208, 177, 132, 192, 154, 120, 50,
+    48, 172, 69, 92, 139, 111, 53, 200, 213, 21, 132, 212, 19, 93, 65, 244, 254, 85, 180, 11, 170, 104, 100, 62,
+    99, 39, 227, 195, 243, 33, 26, 193, 247, 172, 39, 19, 216, 123, 72, 229, 247, 9, 182, 208, 233, 149, 197, 92,
+    138, 126, 27, 221, 35, 131, 140, 159, 82, 37, 116, 110, 163, 151, 220, 78, 207, 65, 5, 183, 154, 228, 127, 76,
+    46, 219, 24, 31, 254, 152, 113, 99, 233, 114, 35, 28, 171, 104, 21, 133, 92, 139, 44, 87, 81, 178, 69, 42,
+    99, 28, 139, 173, 172, 88, 110, 214, 48, 16, 86, 249, 208, 124, 197, 163, 145, 164, 36, 207, 97, 236, 41, 42,
+    140, 27, 6, 122, 33, 100, 37, 82, 101, 115, 97, 78, 22, 186, 138, 185, 23, 70, 183, 16, 180, 173, 160, 190,
+    241, 10, 109, 255, 208, 247, 119, 185, 30, 211, 47, 146, 165, 16, 178, 21, 133, 67, 239, 227, 7, 176, 255, 220,
+    145, 87, 89, 20, 226, 231, 27, 11, 174, 189, 189, 195, 189, 200, 177, 244, 185, 17, 36, 235, 33, 247, 160, 249,
+    141, 176, 153, 16, 172, 42, 235, 34, 55, 154, 92, 132, 154, 165, 109, 58, 133, 169, 20, 173, 200, 156, 160, 150,
+    25, 225, 114, 242, 97, 91, 65, 47, 157, 99, 158, 221, 0, 252, 243, 194, 237, 177, 143, 208, 119, 79, 36, 32,
+    195, 191, 144, 148, 42, 228, 127, 76, 46, 219, 24, 31, 254, 152, 127, 167, 232, 232, 252, 17, 88, 124, 170, 9,
+    174, 128, 255, 15, 184, 154, 59, 7, 106, 113, 248, 34, 176, 249, 84, 19, 93, 69, 92, 139, 148, 138, 15, 152,
+    251, 158, 218, 17, 239, 90, 231, 176, 239, 114, 56, 119, 177, 97, 225, 210, 45, 194, 99, 200, 202, 10, 121, 145,
+    187, 88, 198, 110, 245, 212, 35, 88, 85, 200, 157, 216, 100, 147, 82, 48, 237, 160, 155, 165, 159, 137, 9, 148,
+    60, 200, 171, 145, 109, 230, 185, 16, 233, 110, 195, 187, 138, 185, 28, 25, 174, 162, 174, 71, 202, 230, 23, 60,
+    253, 210, 63, 190, 121, 174, 68, 77, 35, 90, 71, 11, 87, 11, 82, 56, 41, 87, 48, 108, 37, 116, 97, 60,
+    43, 104, 173, 160, 208, 181, 99, 144, 172, 42, 228, 120, 130, 127, 99, 216, 119, 185, 19, 145, 106, 15, 152, 193,
+    74, 185, 128, 141, 97, 166, 237, 179, 241, 99, 3, 10, 218, 24, 144, 172, 42, 228, 34, 199, 97, 253, 88, 85,
+    200, 178, 205, 35, 100, 69, 56, 171, 145, 47, 189, 92, 164, 215, 81, 87, 33, 91, 210, 210, 182, 131, 76, 63,
+    1, 243, 21, 114, 37, 48, 238, 195, 193, 203, 203, 180, 138, 132, 244, 112, 98, 66, 53, 134, 31, 36, 196, 132,
+    194, 249, 61, 135, 123, 145, 79, 195, 12, 201, 196, 143, 215, 117, 52, 60, 111, 67, 132, 172, 175, 158, 248, 234,
+    18, 66, 230, 46, 248, 178, 182, 129, 106, 71, 136, 41, 87, 237, 208, 232, 249, 92, 194, 231, 159, 186, 71, 247,
+    207, 53, 200, 244, 239, 114, 62, 87, 48, 185, 231, 238, 145, 253, 243, 205, 114, 33, 100, 32, 154, 222, 45, 200,
+    241, 186, 226, 202, 218, 7, 204, 82, 235, 224, 192, 70, 176, 154, 118, 61, 65, 249, 239, 101, 109, 2, 111, 87,
+    120, 90, 231, 176, 239, 114, 51, 135, 106, 22, 119, 128, 178, 39, 11, 165, 235, 28, 132, 255, 41, 29, 66, 53,
+    133, 92, 133, 106, 48, 175, 1, 100, 89, 117, 199, 35, 11, 93, 135, 245, 105, 91, 30, 162, 174, 69, 140, 249,
+    11, 35, 44, 111, 84, 96, 216, 112, 181, 113, 194, 53, 27, 13, 158, 104, 196, 132, 107, 4, 20, 144, 203, 55,
+    54, 30, 18, 218, 30, 195, 217, 129, 215, 106, 228, 105, 187, 8, 76, 188, 139, 163, 105, 33, 216, 85, 200, 225,
+    49, 142, 195, 252, 62, 225, 158, 151, 34, 42, 228, 39, 137, 45, 145, 15, 152, 171, 145, 55, 48, 185, 231, 212,
+    120, 222, 134, 104, 173, 67, 93, 245, 241, 133, 109, 6, 73, 89, 92, 200, 229, 247, 128, 149, 69, 169, 93, 134,
+    112, 250, 138, 185, 31, 229, 23, 3, 35, 140, 72, 167, 21, 114, 56, 51, 93, 135, 123, 144, 149, 171, 206, 215,
+    48, 66, 200, 162, 210, 122, 132, 144, 185, 137, 57, 65, 169, 24, 86, 208, 192, 86, 21, 114, 38, 233, 103, 226,
+    123, 116, 232, 255, 210, 46, 7, 219, 135, 203, 207, 64, 255, 15, 184, 45, 70, 5, 92, 143, 242, 139, 129, 227,
+    15, 151, 158, 163, 139, 152, 33, 97, 216, 120, 72, 145, 39, 100, 132, 162, 51, 130, 108, 250, 140, 225, 245, 25,
+    38, 212, 190, 150, 185, 236, 59, 220, 132, 130, 129, 100, 78, 201, 18, 122, 142, 22, 174, 29, 177, 200, 65, 58,
+    166, 48, 50, 122, 8, 214, 8, 60, 111, 151, 147, 65, 88, 20, 202, 227, 35, 140, 118, 31, 213, 131, 177, 15,
+    152, 171, 145, 145, 198, 39, 168, 65, 170, 48, 149, 169, 31, 174, 234, 107, 28, 245, 22, 131, 50, 108, 21, 130,
+    9, 186, 70, 195, 198, 19, 47, 34, 119, 90, 21, 116, 161, 147, 181, 66, 77, 72, 225, 106, 226, 174, 68, 111,
+    166, 134, 194, 119, 136, 125, 218, 202, 218, 79, 97, 240, 34, 184, 91, 91, 6, 69, 214, 69, 95, 125, 124, 72,
+    171, 190, 250, 94, 179, 223, 24, 231, 176, 239, 117, 145, 174, 243, 67, 193, 30, 238, 247, 35, 218, 101, 242, 84,
+    163, 219, 220, 62, 4, 97, 223, 204, 141, 246, 9, 35, 151, 220, 38, 219, 67, 166, 87, 234, 16, 105, 133, 215,
+    83, 1, 243, 23, 125, 136, 86, 23, 89, 7, 147, 61, 135, 187, 189, 207, 62, 239, 68, 104, 244, 53, 35, 15,
+    151, 147, 97, 190, 221, 125, 194, 228, 113, 117, 157, 140, 79, 97, 238, 251, 119, 161, 194, 213, 197, 92, 136, 93,
+    47, 66, 157, 241, 61, 70, 198, 46, 155, 72, 229, 247, 25, 35, 9, 52, 53, 35, 56, 39, 183, 187, 160, 252,
+    224, 237, 132, 231, 244, 31, 19, 182, 19, 144, 131, 201, 231, 36, 139, 14, 22, 174, 42, 228, 127, 76, 46, 219,
+    24, 31, 254, 152, 127, 167, 232, 232, 252, 17, 88, 124, 170, 9, 174, 128, 251, 83, 47, 33, 216, 126, 8, 172,
+    62, 85, 4, 215, 81, 87, 34, 159, 134, 26, 162, 181, 34, 180, 133, 169, 18, 96, 177, 25, 167, 255, 63, 255,
+    210, 199, 176, 239, 114, 35, 121, 165, 200, 120, 221, 113, 101, 109, 36, 31, 79, 228, 132, 30, 57, 209, 216, 131,
+    9, 212, 120, 222, 135, 47, 184, 103, 165, 200, 137, 223, 197, 96, 139, 171, 84, 135, 204, 106, 246, 48, 203, 92,
+    255, 231, 253, 127, 218, 9, 74, 56, 194, 209, 22, 89, 184, 178, 206, 80, 77, 99, 145, 171, 238, 212, 108, 29,
+    130, 8, 119, 206, 159, 110, 161, 24, 28, 28, 170, 23, 33, 132, 215, 97, 179, 205, 9, 174, 112, 108, 41, 198,
+    29, 252, 140, 47, 146, 52, 73, 24, 93, 47, 74, 218, 118, 29, 238, 68, 166, 29, 216, 83, 138, 185, 5, 38,
+    132, 37, 149, 40, 200, 225, 35, 90, 184, 70, 176, 171, 145, 174, 249, 231, 131, 97, 47, 187, 90, 67, 230, 54,
+    84, 103, 26, 239, 43, 144, 180, 46, 116, 42, 240, 251, 233, 112, 181, 34, 120, 86, 209, 91, 65, 103, 120, 158,
+    195, 189, 200, 217, 42, 226, 95, 122, 184, 193, 75, 72, 207, 120, 171, 152, 10, 212, 226, 174, 69, 202, 69, 7,
+    204, 125, 207, 109, 8, 247, 173, 115, 219, 160, 232, 249, 38, 29, 219, 160, 239, 114, 37, 48, 238, 193, 100, 32,
+    194, 250, 56, 228, 25, 164, 241, 133, 155, 234, 90, 133, 93, 40, 100, 155, 86, 240, 100, 85, 200, 51, 37, 178,
+    33, 243, 21, 114, 63, 190, 44, 63, 35, 53, 216, 126, 78, 246, 44, 41, 60, 96, 200, 70, 176, 202, 232, 177,
+    35, 53, 198, 5, 92, 136, 119, 215, 168, 70, 176, 65, 135, 109, 7, 132, 129, 27, 180, 132, 195, 182, 130, 174,
+    65, 73, 163, 12, 56, 76, 99, 176, 252, 82, 161, 218, 70, 88, 75, 5, 97, 147, 241, 225, 249, 23, 74, 144,
+    141, 97, 225, 222, 164, 100, 237, 232, 196, 144, 254, 140, 11, 66, 183, 153, 234, 56, 186, 224, 132, 27, 42, 50,
+    205, 13, 176, 156, 200, 65, 254, 83, 118, 174, 69, 110, 196, 43, 10, 185, 25, 60, 49, 142, 195, 218, 131, 177,
+    15, 152, 171, 145, 73, 227, 6, 122, 138, 185, 19, 115, 11, 158, 98, 86, 164, 22, 210, 30, 100, 216, 43, 10,
+    185, 24, 124, 147, 1, 143, 19, 178, 108, 99, 168, 65, 150, 251, 7, 204, 100, 249, 230, 72, 154, 41, 170, 182,
+    131, 193, 149, 177, 23, 93, 123, 15, 129, 18, 78, 178, 32, 225, 62, 102, 221, 70, 236, 156, 36, 16, 249, 132,
+    110, 66, 235, 177, 107, 43, 104, 42, 31, 127, 24, 61, 135, 220, 239, 18, 48, 82, 192, 164, 208, 167, 21, 114,
+    60, 36, 4, 107, 9, 125, 234, 226, 156, 85, 200, 209, 53, 34, 29, 245, 237, 208, 252, 242, 195, 177, 253, 7,
+    181, 81, 215, 106, 20, 227, 44, 59, 17, 87, 34, 110, 98, 23, 57, 30, 79, 57, 36, 91, 183, 211, 244, 116,
+    239, 114, 62, 212, 142, 128, 255, 15, 184, 77, 182, 135, 76, 174, 42, 228, 120, 72, 234, 56, 185, 130, 42, 228,
+    120, 72, 162, 214, 48, 54, 124, 44, 220, 200, 211, 9, 50, 100, 112, 181, 112, 131, 44, 20, 97, 9, 167, 97,
+    246, 155, 171, 88, 93, 117, 234, 38, 231, 30, 140, 132, 130, 48, 172, 108, 56, 90, 184, 240, 245, 88, 50, 31,
+    49, 197, 214, 124, 158, 122, 141, 21, 186, 132, 107, 7, 171, 152, 19, 178, 194, 212, 245, 21, 114, 176, 48, 158,
+    14, 36, 102, 150, 54, 30, 55, 161, 87, 35, 39, 106, 45, 82, 21, 189, 45, 43, 105, 216, 119, 185, 30, 18,
+    40, 181, 140, 117, 8, 35, 125, 52, 54, 26, 163, 14, 22, 174, 16, 121, 86, 176, 157, 87, 7, 168, 103, 180,
+    132, 145, 203, 238, 19, 109, 161, 211, 43, 246, 30, 239, 202, 233, 94, 236, 96, 45, 15, 7, 168, 154, 132, 109,
+    12, 127, 247, 238, 23, 33, 39, 204, 246, 29, 238, 66, 86, 175, 59, 92, 193, 11, 35, 131, 140, 159, 85, 109,
+    58, 132, 23, 79, 69, 134, 112, 250, 138, 185, 28, 60, 66, 153, 15, 189, 74, 216, 246, 232, 252, 237, 10, 222,
+    127, 65, 237, 62, 70, 111, 1, 5, 161, 91, 207, 111, 167, 232, 232, 255, 116, 212, 143, 139, 190, 189, 0, 239,
+    114, 52, 77, 72, 135, 125, 66, 200, 205, 113, 131, 97, 194, 213, 197, 92, 140, 174, 149, 70, 2, 53, 134, 19,
+    125, 47, 70, 3, 230, 54, 74, 135, 105, 5, 191, 203, 242, 173, 160, 65, 6, 118, 90, 61, 135, 197, 247, 107,
+    10, 79, 24, 50, 18, 8, 156, 146, 168, 193, 176, 171, 195, 239, 165, 223, 122, 234, 46, 243, 74, 218, 15, 73,
+    10, 251, 200, 201, 34, 193, 26, 194, 147, 198, 13, 62, 195, 68, 212, 207, 97, 222, 228, 78, 69, 168, 62, 98,
+    159, 194, 101, 147, 132, 107, 9, 217, 113, 131, 96, 152, 35, 99, 26, 148, 163, 34, 174, 66, 44, 118, 30, 212,
+    29, 136, 164, 241, 131, 212, 32, 210, 31, 125, 131, 230, 54, 194, 114, 98, 65, 109, 19, 67, 33, 88, 32, 185,
+    74, 54, 26, 38, 164, 62, 99, 103, 242, 99, 176, 254, 236, 67, 230, 42, 231, 94, 161, 4, 221, 35, 111, 222,
+    121, 54, 26, 38, 190, 48, 99, 168, 201, 43, 43, 153, 28, 190, 240, 52, 79, 216, 132, 107, 13, 12, 214, 240,
+    100, 102, 240, 57, 125, 197, 56, 255, 46, 173, 216, 123, 189, 233, 4, 83, 138, 51, 67, 151, 222, 6, 55, 203,
+    207, 255, 126, 225, 114, 50, 186, 99, 5, 180, 50, 56, 90, 184, 65, 56, 228, 105, 10, 221, 186, 0, 252, 246,
+    194, 115, 250, 15, 240, 251, 251, 189, 17, 224, 150, 10, 222, 150, 141, 133, 56, 219, 9, 200, 217, 252, 152, 237,
+    244, 253, 29, 0, 252, 17, 88, 124, 170, 9, 174, 128, 247, 187, 82, 182, 234, 218, 4, 195, 182, 131, 240, 69,
+    97, 242, 168, 38, 186, 138, 185, 20, 252, 55, 186, 71, 235, 186, 154, 25, 93, 35, 80, 91, 209, 195, 237, 35,
+    151, 223, 176, 239, 114, 60, 110, 184, 178, 182, 146, 46, 96, 132, 130, 51, 60, 24, 234, 17, 172, 42, 228, 75,
+    238, 214, 145, 156, 62, 162, 174, 68, 166, 29, 216, 102, 150, 33, 90, 156, 85, 200, 240, 153, 121, 210, 31, 118,
+    183, 97, 236, 43, 125, 124, 96, 240, 77, 132, 62, 49, 35, 9, 251, 46, 57, 9, 148, 60, 200, 171, 145, 178,
+    85, 251, 14, 247, 34, 124, 242, 19, 195, 250, 34, 106, 13, 101, 115, 35, 133, 177, 8, 214, 25, 96, 164, 117,
+    8, 214, 28, 190, 227, 50, 112, 42, 228, 112, 87, 75, 208, 124, 197, 92, 143, 233, 133, 219, 99, 3, 255, 211,
+    14, 21, 135, 47, 188, 13, 159, 47, 38, 186, 132, 16, 117, 86, 177, 128, 249, 142, 95, 120, 26, 172, 202, 187,
+    118, 232, 232, 252, 17, 88, 35, 88, 126, 92, 165, 80, 251, 210, 54, 232, 255, 15, 184, 72, 133, 244, 66, 80,
+    171, 144, 173, 70, 36, 229, 74, 236, 31, 49, 248, 34, 176, 249, 84, 19, 65, 26, 195, 242, 229, 42, 135, 222,
+    145, 176, 251, 95, 124, 31, 73, 22, 236, 59, 220, 140, 161, 230, 97, 210, 210, 36, 199, 163, 33, 36, 32, 200,
+    181, 66, 96, 108, 234, 212, 21, 135, 220, 246, 208, 143, 122, 215, 61, 135, 119, 21, 114, 10, 77, 117, 31, 151,
+    41, 84, 62, 244, 141, 135, 218, 251, 224, 250, 72, 176, 63, 58, 45, 105, 20, 252, 36, 88, 49, 224, 192, 177,
+    244, 112, 251, 106, 90, 167, 168, 226, 235, 130, 41, 197, 92, 142, 12, 215, 80, 180, 48, 82, 210, 60, 38, 94,
+    66, 181, 56, 171, 145, 117, 154, 120, 92, 134, 201, 21, 33, 243, 20, 252, 55, 97, 222, 228, 77, 65, 52, 37,
+    116, 105, 25, 65, 79, 34, 112, 186, 94, 177, 200, 86, 21, 114, 56, 86, 183, 97, 222, 228, 37, 106, 243, 181,
+    204, 17, 153, 56, 145, 149, 210, 52, 54, 234, 18, 66, 230, 42, 228, 83, 240, 193, 106, 78, 51, 11, 35, 132,
+    90, 86, 208, 102, 240, 37, 245, 53, 117, 109, 5, 56, 186, 109, 177, 110, 221, 0, 232, 252, 185, 74, 161, 247,
+    164, 108, 62, 215, 223, 7, 210, 69, 186, 0, 252, 185, 74, 161, 247, 164, 108, 62, 215, 223, 7, 210, 69, 134,
+    78, 212, 173, 185, 145, 115, 7, 168, 241, 130, 214, 86, 208, 85, 200, 124, 88, 112, 181, 113, 87, 33, 143, 29,
+    135, 224, 246, 48, 194, 106, 9, 172, 46, 151, 169, 25, 59, 84, 36, 208, 225, 106, 226, 174, 68, 111, 52, 185,
+    4, 140, 174, 180, 114, 173, 224, 246, 29, 238, 68, 58, 88, 44, 140, 43, 27, 14, 22, 174, 39, 84, 198, 4,
+    221, 246, 158, 162, 174, 251, 233, 113, 170, 55, 33, 54, 216, 164, 12, 176, 242, 109, 216, 119, 185, 22, 89, 164,
+    106, 18, 251, 181, 131, 230, 16, 84, 34, 176, 226, 235, 53, 130, 14, 87, 115, 61, 68, 29, 85, 172, 173, 160,
+    229, 247, 15, 152, 171, 144, 251, 212, 173, 136, 225, 227, 22, 236, 61, 134, 103, 129, 79, 195, 78, 111, 143, 35,
+    100, 153, 30, 57, 234, 41, 118, 217, 91, 65, 87, 43, 2, 233, 82, 21, 134, 144, 77, 43, 105, 219, 160, 232,
+    246, 240, 141, 103, 99, 97, 246, 238, 184, 178, 182, 157, 0, 246, 96, 248, 183, 80, 158, 17, 172, 236, 108, 60,
+    110, 184, 178, 182, 130, 105, 26, 210, 46, 96, 245, 11, 82, 56, 86, 179, 241, 35, 195, 164, 88, 216, 111, 176,
+    70, 176, 225, 49, 137, 28, 20, 171, 152, 54, 30, 57, 20, 186, 158, 195, 253, 225, 51, 205, 105, 69, 213, 170,
+    66, 80, 217, 38, 135, 165, 149, 167, 137, 234, 17, 172, 42, 228, 89, 222, 5, 209, 180, 145, 56, 93, 47, 88,
+    228, 39, 249, 72, 236, 63, 171, 74, 216, 245, 19, 116, 179, 241, 35, 39, 108, 138, 96, 113, 116, 163, 232, 192,
+    147, 148, 26, 145, 170, 233, 122, 30, 8, 186, 218, 197, 187, 14, 247, 33, 22, 4, 234, 113, 137, 15, 152, 182,
+    243, 65, 26, 195, 55, 141, 30, 168, 176, 212, 234, 240, 166, 123, 116, 232, 248, 186, 88, 123, 240, 243, 188, 30,
+    128, 239, 114, 33, 210, 194, 230, 8, 89, 25, 97, 228, 216, 62, 121, 142, 22, 174, 56, 119, 177, 97, 225, 34,
+    20, 196, 132, 107, 9, 93, 26, 66, 181, 151, 36, 165, 109, 6, 78, 211, 81, 190, 84, 174, 193, 46, 82, 221,
+    135, 218, 121, 118, 176, 171, 145, 225, 34, 20, 196, 245, 21, 114, 54, 79, 71, 82, 212, 60, 28, 159, 83, 35,
+    118, 62, 139, 117, 8, 214, 11, 94, 233, 25, 96, 164, 10, 186, 80, 171, 145, 178, 85, 194, 200, 221, 165, 51,
+    61, 135, 176, 177, 167, 222, 4, 174, 140, 54, 117, 106, 145, 225, 50, 242, 42, 228, 112, 156, 142, 95, 113, 146,
+    106, 123, 14, 247, 34, 87, 5, 178, 33, 100, 110, 210, 106, 176, 173, 167, 80, 141, 97, 203, 238, 51, 39, 1,
+    4, 225, 116, 189, 12, 174, 184, 192, 177, 157, 150, 136, 171, 145, 194, 70, 162, 119, 110, 221, 0, 232, 252, 185,
+    74, 161, 247, 164, 108, 62, 215, 223, 7, 210, 69, 186, 0, 252, 185, 74, 161, 247, 164, 108, 62, 215, 223, 7,
+    210, 69, 134, 78, 212, 173, 185, 144, 82, 107, 132, 139, 118, 29, 238, 68, 58, 88, 120, 57, 62, 166, 68, 234,
+    239, 87, 49, 212, 43, 89, 114, 74, 86, 208, 65, 200, 181, 13, 81, 90, 139, 35, 100, 123, 14, 238, 42, 228,
+    51, 197, 95, 168, 65, 162, 72, 154, 74, 87, 97, 147, 234, 100, 43, 83, 143, 74, 120, 234, 22, 164, 49, 118,
+    18, 186, 48, 207, 11, 151, 147, 10, 218, 118, 29, 238, 70, 175, 99, 12, 50, 118, 244, 89, 75, 100, 70, 78,
+    213, 9, 53, 35, 133, 171, 138, 185, 16, 102, 131, 230, 42, 228, 83, 240, 222, 233, 30, 149, 169, 52, 33, 12,
+    213, 205, 46, 93, 135, 176, 204, 240, 50, 72, 144, 144, 70, 201, 30, 77, 131, 239, 82, 182, 61, 66, 53, 135,
+    47, 184, 201, 24, 92, 164, 10, 185, 25, 162, 181, 11, 239, 168, 124, 194, 48, 69, 129, 147, 181, 150, 149, 216,
+    199, 110, 128, 232, 249, 45, 136, 249, 84, 19, 93, 0, 246, 12, 145, 15, 192, 149, 177, 19, 80, 77, 15, 16,
+    141, 149, 204, 135, 207, 49, 115, 7, 168, 193, 75, 43, 104, 41, 248, 72, 176, 171, 145, 162, 72, 154, 74, 87,
+    110, 195, 189, 200, 217, 61, 29, 75, 80, 89, 25, 66, 101, 228, 219, 168, 70, 176, 224, 155, 72, 157, 161, 247,
+    161, 87, 135, 223, 75, 138, 185, 26, 38, 211, 216, 123, 48, 124, 88, 120, 92, 185, 203, 4, 96, 163, 72, 77,
+    17, 90, 104, 32, 204, 182, 71, 168, 205, 227, 71, 170, 45, 216, 119, 185, 9, 5, 2, 200, 253, 119, 83, 93,
+    68, 167, 162, 51, 120, 21, 114, 44, 179, 72, 212, 37, 247, 107, 7, 204, 32, 132, 178, 184, 219, 9, 202, 182,
+    131, 56, 125, 69, 92, 141, 18, 68, 210, 82, 187, 118, 232, 232, 251, 158, 218, 17, 87, 35, 241, 127, 119, 135,
+    230, 71, 201, 26, 220, 46, 87, 50, 17, 172, 63, 166, 231, 29, 0, 239, 114, 52, 73, 19, 73, 74, 236, 17,
+    172, 37, 26, 220, 46, 87, 19, 119, 216, 44, 132, 19, 170, 99, 0, 205, 39, 140, 44, 223, 82, 212, 56, 90,
+    184, 65, 156, 41, 107, 99, 144, 149, 171, 206, 215, 48, 123, 14, 247, 34, 114, 45, 65, 243, 25, 193, 155, 227,
+    145, 170, 88, 137, 70, 183, 11, 149, 204, 142, 19, 58, 145, 87, 135, 223, 75, 138, 185, 8, 177, 216, 127, 86,
+    149, 177, 234, 42, 228, 101, 131, 30, 67, 198, 136, 203, 251, 25, 19, 115, 143, 70, 68, 211, 229, 228, 216, 112,
+    181, 113, 44, 153, 121, 144, 141, 97, 104, 86, 243, 61, 135, 176, 201, 223, 6, 5, 247, 214, 68, 190, 117, 142,
+    122, 140, 215, 24, 54, 28, 45, 92, 100, 248, 176, 240, 125, 24, 77, 12, 246, 30, 239, 131, 208, 178, 115, 212,
+    44, 183, 186, 130, 215, 255, 126, 225, 87, 35, 44, 24, 242, 32, 234, 145, 230, 123, 15, 119, 179, 2, 198, 52,
+    228, 90, 21, 188, 141, 87, 75, 208, 179, 142, 95, 113, 163, 189, 187, 123, 186, 0, 252, 237, 10, 222, 127, 65,
+    254, 240, 158, 2, 48, 44, 99, 78, 69, 161, 91, 207, 111, 167, 232, 232, 248, 186, 88, 123, 240, 243, 188, 30,
+    128, 254, 155, 197, 92, 192, 41, 53, 212, 126, 92, 165, 80, 251, 210, 54, 31, 107, 239, 131, 233, 34, 193, 100,
+    120, 195, 229, 228, 216, 120, 228, 100, 237, 53, 27, 229, 74, 236, 15, 235, 186, 237, 169, 106, 236, 63, 178, 70,
+    132, 74, 232, 210, 56, 72, 96, 249, 136, 116, 176, 203, 15, 59, 193, 158, 161, 26, 193, 225, 27, 66, 50, 118,
+    50, 48, 172, 69, 92, 141, 140, 46, 166, 140, 118, 31, 147, 199, 147, 18, 18, 8, 103, 226, 230, 8, 167, 30,
+    8, 146, 91, 168, 70, 176, 171, 145, 170, 101, 117, 99, 28, 137, 90, 144, 182, 193, 236, 63, 173, 9, 39, 89,
+    21, 114, 29, 177, 200, 225, 57, 25, 188, 112, 145, 96, 178, 60, 38, 94, 69, 92, 142, 19, 145, 203, 238, 50,
+    77, 79, 110, 128, 232, 252, 17, 88, 124, 170, 9, 174, 128, 252, 17, 88, 124, 170, 9, 161, 147, 181, 43, 110,
+    100, 75, 239, 87, 225, 34, 221, 69, 92, 143, 27, 174, 44, 173, 164, 143, 7, 39, 213, 91, 65, 59, 36, 73,
+    142, 195, 189, 200, 187, 194, 254, 206, 193, 246, 45, 35, 125, 186, 132, 107, 14, 95, 113, 146, 48, 146, 69, 92,
+    138, 132, 86, 19, 73, 74, 236, 21, 133, 92, 139, 44, 210, 54, 71, 176, 239, 114, 42, 19, 47, 50, 52, 194,
+    181, 5, 97, 87, 34, 119, 108, 46, 151, 174, 162, 106, 13, 101, 117, 109, 5, 63, 9, 22, 21, 114, 55, 111,
+    44, 252, 55, 97, 236, 36, 180, 144, 249, 132, 106, 92, 151, 100, 165, 118, 25, 174, 49, 35, 151, 223, 168, 222,
+    52, 86, 208, 114, 251, 138, 113, 180, 25, 144, 237, 219, 160, 232, 252, 17, 88, 124, 170, 9, 174, 128, 246, 161,
+    87, 89, 27, 58, 181, 7, 97, 248, 34, 176, 249, 84, 19, 93, 69, 92, 138, 126, 24, 102, 78, 36, 38, 53,
+    121, 161, 155, 198, 143, 84, 91, 176, 238, 226, 174, 65, 73, 174, 161, 6, 201, 87, 24, 41, 105, 20, 252, 36,
+    88, 85, 200, 186, 233, 126, 19, 158, 163, 139, 174, 8, 167, 21, 114, 56, 51, 93, 69, 92, 130, 213, 8, 217,
+    17, 78, 42, 228, 84, 34, 176, 154, 74, 87, 96, 156, 34, 212, 246, 29, 238, 69, 150, 105, 26, 132, 190, 237,
+    96, 249, 132, 21, 8, 172, 46, 240, 192, 229, 119, 51, 212, 32, 195, 240, 17, 172, 46, 155, 181, 43, 104, 25,
+    232, 246, 30, 195, 66, 213, 130, 60, 65, 63, 177, 19, 75, 18, 42, 228, 91, 121, 160, 148, 57, 125, 224, 102,
+    77, 118, 232, 232, 248, 46, 151, 225, 57, 20, 227, 238, 123, 104, 71, 189, 107, 158, 128, 239, 114, 46, 186, 95,
+    132, 228, 77, 65, 172, 174, 100, 62, 245, 212, 100, 236, 199, 42, 86, 208, 125, 207, 109, 8, 247, 173, 114, 41,
+    197, 92, 136, 51, 65, 243, 31, 240, 141, 41, 61, 135, 123, 145, 14, 150, 23, 41, 101, 109, 1, 73, 161, 79,
+    194, 69, 135, 228, 185, 93, 105, 2, 200, 203, 15, 38, 195, 55, 129, 147, 180, 212, 111, 149, 43, 183, 81, 132,
+    141, 8, 240, 145, 10, 98, 66, 53, 132, 174, 141, 34, 203, 7, 42, 86, 208, 84, 39, 163, 131, 18, 41, 196,
+    147, 228, 38, 40, 195, 37, 47, 162, 33, 247, 163, 61, 135, 247, 97, 87, 35, 72, 125, 218, 221, 71, 47, 184,
+    103, 165, 200, 132, 103, 171, 152, 31, 211, 11, 182, 198, 7, 255, 166, 28, 88, 250, 92, 143, 80, 182, 45, 75,
+    146, 96, 83, 138, 185, 14, 196, 114, 251, 140, 223, 118, 176, 41, 24, 83, 29, 135, 245, 161, 116, 144, 129, 158,
+    136, 74, 164, 202, 230, 223, 253, 15, 119, 248, 125, 253, 208, 67, 176, 171, 145, 11, 165, 232, 84, 38, 94, 123,
+    15, 248, 39, 97, 163, 171, 105, 219, 220, 59, 220, 141, 76, 202, 104, 68, 21, 108, 222, 50, 50, 57, 125, 224,
+    65, 151, 199, 163, 219, 160, 252, 243, 194, 237, 177, 143, 208, 123, 15, 233, 133, 219, 99, 3, 255, 211, 14, 22,
+    67, 176, 171, 145, 164, 62, 237, 110, 161, 104, 93, 36, 32, 103, 162, 18, 169, 50, 185, 176, 167, 11, 93, 190,
+    159, 163, 160, 239, 8, 172, 41, 199, 228, 185, 93, 105, 58, 0, 255, 15, 184, 72, 33, 90, 86, 196, 32, 156,
+    19, 231, 168, 213, 236, 97, 133, 66, 43, 15, 15, 187, 88, 102, 240, 63, 37, 202, 235, 73, 216, 119, 185, 25,
+    36, 66, 166, 132, 44, 137, 217, 50, 87, 222, 122, 142, 22, 174, 50, 125, 115, 120, 164, 241, 130, 36, 165, 43,
+    104, 55, 218, 239, 137, 163, 6, 193, 88, 75, 231, 67, 52, 241, 11, 151, 97, 253, 146, 52, 35, 100, 103, 132,
+    213, 114, 28, 43, 89, 248, 144, 249, 230, 96, 77, 110, 204, 173, 160, 244, 167, 137, 15, 152, 171, 145, 255, 8,
+    210, 146, 48, 141, 105, 201, 54, 33, 36, 45, 8, 222, 110, 100, 120, 231, 255, 63, 235, 254, 234, 228, 104, 248,
+    177, 97, 125, 204, 135, 204, 113, 114, 148, 51, 83, 139, 72, 70, 176, 171, 145, 233, 38, 131, 236, 88, 79, 149,
+    50, 50, 130, 148, 66, 13, 151, 42, 222, 12, 254, 187, 145, 57, 22, 61, 135, 201, 243, 160, 154, 248, 82, 212,
+    48, 186, 94, 149, 180, 8, 214, 21, 114, 52, 45, 88, 34, 47, 205, 95, 80, 249, 138, 185, 21, 8, 173, 238,
+    145, 171, 210, 187, 13, 161, 253, 45, 136, 65, 146, 99, 85, 109, 2, 86, 175, 59, 92, 193, 236, 63, 20, 153,
+    45, 161, 137, 9, 15, 187, 88, 114, 251, 132, 130, 11, 104, 154, 27, 5, 97, 250, 238, 166, 130, 101, 75, 233,
+    105, 76, 255, 244, 37, 245, 34, 10, 88, 120, 119, 243, 33, 224, 49, 226, 118, 77, 140, 79, 80, 245, 115, 18,
+    56, 120, 242, 29, 134, 19, 106, 125, 167, 168, 70, 176, 65, 153, 224, 74, 235, 182, 57, 26, 39, 236, 67, 239,
+    66, 174, 71, 10, 214, 126, 36, 97, 230, 130, 176, 171, 190, 250, 94, 187, 15, 102, 15, 232, 197, 202, 88, 35,
+    51, 238, 217, 29, 75, 80, 202, 235, 169, 158, 163, 221, 255, 47, 192, 77, 182, 135, 76, 174, 173, 160, 252, 151,
+    43, 173, 39, 97, 248, 224, 164, 145, 180, 29, 146, 8, 167, 22, 89, 58, 248, 72, 243, 219, 220, 59, 184, 171,
+    144, 82, 107, 168, 65, 38, 131, 230, 39, 11, 101, 109, 5, 157, 226, 70, 10, 90, 69, 63, 9, 22, 21, 114,
+    51, 135, 106, 15, 152, 171, 145, 80, 138, 193, 26, 195, 133, 198, 3, 236, 88, 59, 83, 138, 185, 23, 93, 47,
+    194, 114, 21, 135, 228, 185, 93, 105, 6, 251, 59, 4, 136, 95, 73, 142, 221, 0, 232, 239, 8, 172, 62, 84,
+    148, 174, 221, 0, 239, 114, 62, 231, 182, 132, 123, 214, 185, 21, 8, 172, 38, 146, 149, 216, 44, 132, 31, 174,
+    232, 173, 67, 198, 235, 139, 43, 105, 212, 65, 213, 89, 103, 34, 212, 31, 48, 131, 199, 58, 59, 16, 97, 59,
+    15, 201, 222, 197, 135, 130, 217, 92, 200, 194, 177, 21, 114, 54, 194, 86, 111, 26, 245, 8, 214, 8, 61, 43,
+    82, 104, 70, 88, 124, 188, 139, 163, 105, 35, 56, 125, 69, 92, 135, 244, 98, 232, 218, 117, 11, 82, 46, 141,
+    105, 25, 195, 254, 197, 130, 176, 165, 212, 246, 31, 213, 165, 108, 122, 138, 185, 25, 59, 91, 124, 169, 224, 89,
+    255, 99, 33, 88, 32, 202, 232, 176, 24, 252, 232, 83, 138, 185, 20, 185, 121, 52, 50, 125, 218, 140, 117, 23,
+    89, 23, 74, 27, 111, 140, 27, 12, 63, 1, 253, 24, 23, 89, 7, 147, 61, 135, 123, 145, 23, 230, 175, 170,
+    228, 41, 114, 242, 173, 160, 124, 194, 6, 41, 30, 57, 25, 97, 242, 242, 17, 172, 42, 228, 75, 231, 66, 89,
+    224, 200, 124, 197, 92, 140, 157, 173, 190, 84, 240, 50, 130, 148, 66, 13, 138, 100, 115, 223, 1, 53, 240, 168,
+    217, 30, 221, 0, 252, 242, 195, 177, 253, 7, 181, 81, 215, 106, 20, 227, 44, 59, 17, 87, 35, 39, 107, 111,
+    149, 60, 123, 164, 121, 60, 228, 145, 110, 223, 79, 209, 208, 239, 8, 172, 63, 28, 37, 102, 241, 175, 64, 255,
+    15, 184, 154, 70, 176, 118, 21, 114, 42, 17, 88, 109, 132, 172, 222, 53, 30, 12, 173, 136, 65, 56, 39, 207,
+    81, 171, 216, 195, 10, 132, 86, 25, 59, 84, 36, 210, 182, 130, 110, 145, 182, 57, 28, 45, 92, 85, 200, 154,
+    74, 87, 111, 116, 135, 197, 191, 126, 105, 55, 87, 99, 97, 149, 210, 53, 236, 59, 220, 138, 132, 86, 9, 182,
+    197, 34, 66, 111, 79, 170, 81, 183, 81, 125, 245, 213, 91, 65, 250, 238, 166, 177, 200, 225, 106, 227, 9, 69,
+    168, 22, 49, 167, 61, 135, 176, 149, 209, 131, 31, 157, 10, 113, 87, 34, 206, 240, 21, 172, 185, 37, 25, 21,
+    116, 160, 131, 39, 107, 111, 149, 60, 123, 164, 121, 60, 228, 145, 96, 178, 32, 254, 187, 172, 27, 12, 222, 2,
+    101, 75, 233, 41, 93, 187, 14, 247, 34, 206, 241, 34, 14, 168, 172, 50, 195, 201, 183, 80, 156, 34, 210, 182,
+    129, 55, 171, 188, 47, 236, 148, 174, 221, 135, 123, 145, 178, 85, 195, 60, 85, 198, 10, 90, 71, 132, 203, 200,
+    167, 21, 114, 38, 146, 149, 219, 168, 226, 235, 130, 41, 197, 92, 130, 147, 67, 10, 100, 35, 3, 174, 213, 200,
+    195, 215, 110, 128, 252, 224, 237, 132, 231, 244, 31, 19, 182, 19, 145, 87, 35, 39, 107, 111, 149, 60, 123, 164,
+    121, 60, 228, 145, 110, 223, 79, 209, 208, 248, 187, 234, 62, 191, 231, 245, 244, 251, 245, 218, 185, 31, 23, 125,
+    71, 238, 250, 255, 159, 215, 208, 232, 248, 187, 234, 62, 191, 231, 246, 116, 251, 245, 218, 185, 31, 23, 125, 71,
+    238, 250, 255, 159, 217, 208, 232, 248, 187, 234, 62, 191, 231, 252, 186, 0, 251, 245, 218, 185, 31, 23, 125, 71,
+    238, 250, 255, 159, 242, 232, 232, 248, 187, 234, 62, 191, 231, 254, 157, 0, 251, 245, 218, 185, 31, 23, 125, 71,
+    238, 250, 255, 159, 250, 116, 232, 248, 187, 234, 62, 191, 231, 252, 250, 0, 251, 245, 218, 185, 31, 23, 125, 71,
+    238, 250, 255, 159, 243, 232, 232, 248, 187, 234, 62, 191, 231, 254, 189, 0, 251, 245, 218, 185, 31, 23, 125, 71,
+    238, 250, 255, 159, 250, 244, 232, 248, 187, 234, 62, 191, 231, 254, 221, 0, 251, 245, 218, 185, 31, 23, 125, 71,
+    238, 250, 255, 159, 251, 116, 232, 248, 187, 234, 62, 191, 245, 254, 29, 0, 251, 245, 218, 185, 31, 23, 125, 71,
+    238, 250, 255, 215, 248, 116, 232, 248, 187, 234, 62, 191, 245, 250, 186, 0, 251, 245, 218, 185, 31, 23, 125, 71,
+    238, 250, 255, 215, 234, 232, 232, 248, 187, 234, 62, 191, 245, 254, 61, 0, 251, 245, 218, 185, 31, 23, 125, 71,
+    238, 250, 255, 215, 248, 244, 232, 248, 187, 234, 62, 191, 245, 250, 250, 0, 251, 245, 218, 185, 31, 23, 125, 71,
+    238, 250, 255, 215, 235, 232, 232, 248, 187, 234, 62, 191, 245, 251, 58, 0, 251, 245, 218, 185, 31, 23, 125, 71,
+    238, 250, 255, 215, 236, 232, 232, 248, 187, 234, 62, 191, 245, 254, 93, 0, 251, 245, 218, 185, 31, 23, 125, 71,
+    238, 250, 255, 215, 249, 116, 232, 248, 187, 234, 62, 191, 245, 255, 78, 128, 251, 245, 218, 185, 31, 23, 125, 71,
+    238, 250, 255, 215, 253, 58, 0, 232, 248, 187, 234, 62, 191, 245, 254, 125, 0, 251, 245, 218, 185, 31, 23, 125,
+    71, 238, 250, 255, 215, 249, 244, 232, 248, 187, 234, 62, 191, 245, 255, 94, 128, 251, 245, 218, 185, 31, 23, 125,
+    71, 238, 250, 255, 215, 253, 122, 0, 232, 248, 187, 234, 62, 191, 245, 255, 110, 128, 251, 245, 218, 185, 31, 23,
+    125, 71, 238, 250, 255, 215, 253, 186, 0, 232, 248, 187, 234, 62, 191, 246, 254, 29, 0, 251, 245, 218, 185, 31,
+    23, 125, 71, 238, 250, 255, 219, 248, 116, 232, 248, 187, 234, 62, 191, 246, 250, 186, 0, 251, 245, 218, 185, 31,
+    23, 125, 71, 238, 250, 255, 219, 234, 232, 232, 248, 187, 234, 62, 191, 246, 254, 61, 0, 251, 245, 218, 185, 31,
+    23, 125, 71, 238, 250, 255, 219, 248, 244, 232, 248, 187, 234, 62, 191, 246, 250, 250, 0, 251, 245, 218, 185, 31,
+    23, 125, 71, 238, 250, 255, 219, 235, 232, 232, 248, 187, 234, 62, 191, 246, 251, 58, 0, 251, 245, 218, 185, 31,
+    23, 125, 71, 238, 250, 255, 219, 236, 232, 232, 248, 187, 234, 62, 191, 246, 254, 93, 0, 251, 245, 218, 185, 31,
+    23, 125, 71, 238, 250, 255, 219, 249, 116, 232, 248, 187, 234, 62, 191, 246, 255, 78, 128, 251, 245, 218, 185, 31,
+    23, 125, 71, 238, 250, 255, 219, 253, 58, 0, 232, 248, 187, 234, 62, 191, 246, 254, 125, 0, 251, 245, 218, 185,
+    31, 23, 125, 71, 238, 250, 255, 219, 249, 244, 232, 248, 187, 234, 62, 191, 246, 255, 94, 128, 251, 245, 218, 185,
+    31, 23, 125, 71, 238, 250, 255, 219, 253, 122, 0, 232, 248, 187, 234, 62, 191, 246, 255, 110, 128, 251, 245, 218,
+    185, 31, 23, 125, 71, 238, 250, 255, 219, 253, 186, 0, 232, 255, 131, 140, 62, 154, 4, 107, 15, 227, 245, 255,
+    46, 128, 255, 15, 184, 72, 33, 40, 85, 200, 241, 188, 214, 21, 180, 10, 212, 99, 43, 163, 104, 67, 230, 63,
+    224, 227, 15, 166, 131, 219, 209, 109, 200, 70, 176, 254, 173, 70, 38, 146, 136, 254, 63, 95, 242, 236, 59, 220,
+    136, 116, 128, 249, 138, 132, 207, 53, 200, 102, 184, 196, 138, 185, 8, 176, 18, 70, 73, 18, 17, 172, 42, 55,
+    203, 204, 143, 217, 223, 81, 227, 144, 236, 42, 228, 107, 190, 41, 127, 126, 17, 136, 186, 233, 126, 19, 153, 19,
+    80, 107, 43, 171, 104, 21, 130, 99, 2, 203, 7, 42, 87, 105, 236, 63, 222, 9, 97, 117, 210, 252, 39, 34,
+    87, 70, 144, 254, 140, 92, 165, 134, 206, 173, 67, 131, 52, 41, 248, 72, 176, 251, 158, 218, 17, 239, 90, 228,
+    35, 88, 20, 154, 20, 252, 36, 88, 89, 248, 106, 126, 24, 126, 75, 149, 214, 147, 168, 171, 149, 129, 7, 60,
+    28, 169, 125, 17, 59, 198, 105, 145, 145, 166, 10, 106, 173, 160, 221, 172, 96, 85, 200, 157, 219, 11, 165, 235,
+    183, 64, 232, 255, 131, 140, 62, 154, 116, 255, 131, 140, 62, 154, 15, 111, 69, 183, 35, 39, 106, 86, 220, 200,
+    185, 130, 18, 66, 14, 22, 196, 31, 158, 200, 210, 67, 230, 50, 118, 202, 13, 16, 141, 96, 147, 181, 211, 21,
+    212, 103, 132, 111, 38, 195, 199, 34, 104, 156, 13, 55, 72, 180, 34, 226, 123, 14, 238, 42, 228, 20, 154, 234,
+    42, 228, 79, 158, 103, 40, 77, 140, 72, 124, 197, 159, 134, 167, 225, 135, 228, 185, 93, 105, 4, 44, 144, 154,
+    34, 180, 208, 171, 145, 119, 133, 253, 157, 186, 142, 46, 184, 34, 156, 85, 200, 224, 205, 117, 21, 114, 33, 210,
+    220, 39, 34, 106, 13, 101, 115, 35, 194, 101, 228, 83, 240, 145, 97, 87, 33, 90, 140, 101, 116, 109, 15, 97,
+    253, 253, 24, 185, 75, 117, 8, 177, 148, 38, 116, 18, 114, 45, 96, 141, 97, 99, 57, 22, 176, 167, 225, 34,
+    194, 174, 66, 44, 108, 241, 67, 210, 202, 248, 193, 20, 226, 174, 68, 190, 245, 114, 147, 93, 69, 92, 172, 2,
+    218, 43, 25, 24, 41, 233, 91, 65, 80, 139, 137, 15, 152, 151, 221, 172, 19, 40, 121, 145, 87, 34, 124, 243,
+    219, 160, 232, 255, 131, 140, 62, 154, 116, 239, 114, 46, 186, 95, 132, 228, 95, 125, 100, 112, 181, 113, 147, 180,
+    210, 53, 10, 132, 207, 53, 200, 36, 142, 95, 112, 155, 109, 14, 153, 92, 35, 3, 243, 90, 16, 154, 236, 48,
+    82, 202, 218, 9, 125, 234, 226, 159, 132, 139, 15, 201, 114, 186, 210, 15, 234, 212, 97, 146, 149, 216, 123, 44,
+    108, 241, 93, 135, 246, 72, 208, 143, 24, 220, 137, 93, 26, 69, 150, 118, 194, 114, 39, 157, 124, 62, 36, 62,
+    97, 22, 54, 194, 49, 144, 141, 97, 70, 53, 86, 76, 11, 44, 28, 169, 93, 167, 176, 238, 226, 174, 65, 73,
+    174, 163, 254, 14, 48, 250, 104, 61, 189, 22, 220, 140, 146, 33, 76, 135, 97, 79, 194, 69, 133, 92, 139, 148,
+    138, 15, 152, 171, 145, 146, 215, 61, 70, 208, 250, 172, 171, 104, 53, 120, 32, 252, 214, 164, 35, 88, 111, 30,
+    17, 130, 91, 209, 106, 222, 12, 246, 232, 232, 246, 88, 217, 226, 135, 197, 210, 221, 0, 255, 15, 184, 212, 198,
+    132, 59, 83, 143, 101, 141, 158, 40, 124, 93, 45, 212, 97, 88, 216, 112, 181, 112, 197, 43, 28, 141, 81, 151,
+    45, 224, 216, 97, 26, 211, 146, 108, 173, 160, 70, 176, 213, 236, 97, 134, 23, 75, 208, 217, 240, 103, 176, 251,
+    87, 24, 240, 233, 22, 144, 150, 244, 98, 150, 72, 201, 32, 65, 106, 76, 72, 70, 176, 98, 145, 227, 145, 119,
+    163, 137, 236, 59, 220, 139, 44, 210, 53, 9, 125, 218, 193, 243, 31, 228, 208, 45, 162, 177, 145, 164, 63, 18,
+    48, 251, 216, 192, 73, 28, 190, 226, 229, 44, 37, 247, 171, 138, 126, 18, 44, 42, 228, 81, 141, 85, 147, 19,
+    216, 119, 185, 16, 233, 96, 178, 39, 87, 122, 191, 81, 7, 60, 28, 169, 91, 65, 87, 35, 83, 75, 150, 248,
+    125, 228, 106, 138, 212, 89, 27, 34, 43, 157, 151, 36, 192, 124, 194, 48, 86, 163, 12, 148, 174, 201, 128, 139,
+    27, 60, 87, 110, 128, 232, 246, 88, 217, 226, 135, 197, 210, 221, 0, 247, 187, 82, 182, 234, 218, 4, 195, 182,
+    131, 217, 99, 103, 138, 31, 23, 75, 117, 28, 190, 227, 100, 153, 21, 114, 11, 84, 35, 100, 69, 56, 65, 59,
+    66, 113, 133, 109, 4, 221, 226, 191, 125, 24, 212, 108, 145, 229, 91, 65, 162, 66, 104, 69, 56, 171, 144, 82,
+    107, 168, 90, 145, 131, 232, 226, 68, 210, 101, 228, 216, 97, 124, 144, 131, 39, 108, 160, 209, 24, 79, 28, 194,
+    181, 95, 176, 255, 124, 36, 207, 239, 45, 150, 30, 77, 135, 9, 143, 60, 39, 50, 50, 118, 99, 149, 10, 185,
+    27, 36, 121, 86, 208, 77, 70, 249, 86, 240, 100, 83, 138, 185, 20, 99, 85, 100, 196, 246, 29, 220, 85, 200,
+    151, 222, 175, 212, 85, 200, 213, 21, 133, 24, 213, 89, 49, 35, 39, 212, 133, 106, 113, 158, 248, 192, 244, 167,
+    142, 162, 174, 86, 6, 175, 99, 12, 18, 50, 186, 209, 202, 183, 130, 51, 41, 91, 194, 182, 130, 120, 39, 101,
+    109, 6, 91, 199, 163, 33, 26, 195, 9, 26, 17, 194, 181, 159, 137, 237, 208, 232, 246, 88, 217, 226, 135, 197,
+    210, 221, 0, 246, 145, 203, 238, 45, 9, 192, 98, 144, 96, 83, 138, 185, 20, 99, 85, 100, 196, 245, 15, 232,
+    197, 202, 88, 74, 232, 210, 52, 221, 108, 71, 47, 184, 167, 225, 34, 194, 199, 100, 138, 222, 12, 132, 107, 4,
+    136, 95, 73, 137, 31, 231, 121, 160, 236, 42, 228, 61, 92, 192, 149, 177, 15, 152, 171, 145, 148, 60, 207, 9,
+    143, 61, 135, 123, 145, 14, 150, 225, 57, 28, 45, 139, 72, 185, 131, 212, 104, 190, 149, 180, 27, 96, 181, 114,
+    31, 49, 14, 250, 140, 222, 6, 201, 30, 77, 134, 73, 18, 41, 198, 29, 44, 17, 172, 55, 108, 58, 88, 112,
+    181, 119, 222, 130, 235, 177, 178, 182, 130, 161, 51, 205, 114, 236, 59, 220, 140, 211, 36, 177, 15, 152, 171, 145,
+    70, 53, 86, 76, 15, 27, 174, 44, 173, 160, 211, 5, 53, 145, 194, 213, 196, 28, 240, 114, 165, 244, 70, 152,
+    73, 144, 141, 97, 169, 164, 192, 76, 178, 45, 83, 219, 160, 232, 246, 88, 217, 226, 135, 197, 210, 221, 0, 239,
+    114, 39, 98, 108, 48, 186, 173, 11, 67, 237, 34, 87, 70, 92, 215, 36, 106, 199, 33, 88, 85, 214, 66, 65,
+    78, 161, 36, 114, 251, 132, 219, 104, 116, 202, 226, 174, 70, 168, 172, 17, 99, 103, 138, 30, 55, 92, 89, 91,
+    65, 194, 213, 198, 198, 198, 106, 21, 26, 70, 80, 243, 42, 218, 4, 107, 14, 19, 30, 85, 180, 9, 140, 4,
+    240, 251, 215, 97, 253, 48, 147, 117, 109, 6, 23, 75, 212, 132, 130, 36, 150, 10, 194, 174, 69, 150, 105, 27,
+    35, 219, 160, 232, 246, 88, 217, 226, 135, 197, 210, 221, 0, 246, 96, 139, 27, 60, 80, 217, 240, 185, 17, 148,
+    110, 178, 96, 44, 141, 146, 60, 155, 11, 152, 61, 66, 212, 140, 46, 151, 169, 25, 225, 38, 234, 218, 5, 106,
+    49, 170, 213, 22, 172, 114, 18, 66, 48, 124, 243, 92, 140, 13, 93, 150, 158, 36, 85, 200, 154, 41, 110, 68,
+    212, 20, 212, 62, 99, 209, 186, 229, 131, 61, 135, 123, 144, 249, 230, 185, 24, 234, 56, 41, 10, 218, 4, 25,
+    66, 206, 195, 118, 92, 222, 53, 8, 214, 9, 233, 82, 158, 4, 238, 218, 97, 38, 76, 245, 26, 162, 181, 34,
+    180, 132, 30, 151, 69, 194, 53, 13, 160, 201, 108, 143, 97, 221, 197, 92, 130, 147, 93, 66, 68, 47, 164, 196,
+    132, 107, 11, 29, 146, 43, 120, 50, 50, 70, 30, 8, 146, 91, 168, 225, 106, 227, 36, 137, 27, 36, 121, 54,
+    234, 38, 145, 172, 173, 167, 80, 141, 97, 52, 251, 108, 173, 160, 76, 96, 38, 29, 180, 21, 114, 33, 210, 221,
+    186, 0, 232, 246, 88, 217, 226, 135, 197, 210, 221, 0, 239, 114, 33, 210, 193, 26, 194, 161, 51, 205, 114, 19,
+    135, 226, 70, 78, 210, 182, 48, 158, 49, 200, 185, 131, 212, 36, 141, 139, 237, 130, 38, 159, 97, 78, 60, 17,
+    131, 65, 247, 160, 240, 52, 52, 21, 187, 14, 247, 35, 100, 143, 42, 218, 9, 168, 223, 42, 222, 8, 70, 176,
+    130, 212, 152, 25, 36, 72, 201, 24, 120, 34, 73, 97, 78, 42, 228, 51, 197, 92, 62, 98, 230, 15, 80, 141,
+    97, 87, 34, 29, 44, 50, 118, 165, 99, 188, 138, 113, 87, 32, 164, 208, 167, 225, 34, 194, 199, 100, 138, 222,
+    12, 132, 107, 4, 136, 95, 73, 137, 237, 208, 232, 246, 88, 217, 226, 135, 197, 210, 221, 0, 246, 28, 45, 136,
+    202, 30, 100, 112, 152, 242, 22, 70, 200, 173, 70, 193, 48, 237, 160, 171, 145, 14, 150, 23, 48, 122, 141, 161,
+    253, 45, 149, 180, 18, 250, 158, 46, 148, 37, 51, 34, 161, 61, 28, 12, 222, 6, 198, 198, 106, 21, 26, 70,
+    112, 250, 138, 185, 8, 177, 179, 197, 10, 113, 87, 35, 100, 143, 42, 218, 13, 18, 19, 66, 17, 172, 32, 181,
+    38, 6, 73, 1, 32, 167, 97, 248, 151, 219, 4, 31, 154, 208, 171, 144, 139, 27, 60, 80, 70, 176, 225, 22,
+    130, 67, 238, 214, 25, 188, 10, 185, 88, 16, 182, 51, 212, 113, 117, 193, 15, 87, 49, 33, 32, 143, 243, 188,
+    208, 72, 133, 244, 173, 160, 70, 176, 45, 70, 21, 180, 21, 114, 17, 99, 103, 138, 237, 208, 232, 246, 88, 217,
+    226, 135, 197, 210, 221, 0, 238, 226, 174, 68, 190, 245, 112, 178, 42, 228, 22, 168, 70, 200, 245, 15, 1, 100,
+    45, 10, 185, 7, 230, 181, 212, 62, 98, 174, 69, 142, 201, 21, 188, 25, 9, 5, 3, 230, 42, 228, 34, 198,
+    207, 21, 216, 123, 210, 36, 35, 88, 84, 111, 151, 153, 24, 86, 34, 174, 68, 58, 91, 132, 228, 92, 193, 234,
+    54, 92, 188, 171, 104, 55, 216, 108, 147, 37, 180, 49, 61, 135, 123, 145, 14, 150, 25, 59, 82, 182, 230, 66,
+    176, 240, 245, 113, 101, 131, 149, 43, 180, 246, 232, 232, 246, 88, 217, 226, 135, 197, 210, 221, 0, 255, 15, 184,
+    72, 33, 216, 85, 200, 246, 88, 217, 226, 135, 197, 210, 195, 37, 140, 176, 173, 160, 72, 125, 218, 194, 174, 70,
+    69, 170, 19, 3, 100, 143, 42, 218, 9, 168, 223, 42, 222, 12, 135, 204, 85, 200, 69, 141, 158, 43, 176, 239,
+    114, 33, 210, 194, 230, 8, 203, 120, 244, 100, 104, 90, 177, 200, 103, 138, 191, 9, 22, 234, 48, 172, 108, 56,
+    90, 184, 98, 149, 142, 69, 66, 235, 169, 176, 155, 198, 254, 36, 35, 88, 74, 232, 210, 44, 176, 114, 165, 109,
+    5, 66, 103, 154, 228, 41, 248, 72, 176, 171, 144, 139, 27, 60, 80, 63, 53, 169, 236, 59, 184, 171, 144, 207,
+    21, 126, 162, 174, 68, 58, 88, 100, 237, 74, 219, 153, 20, 252, 36, 88, 85, 200, 63, 53, 161, 225, 50, 242,
+    29, 169, 199, 252, 28, 97, 244, 208, 123, 122, 45, 185, 236, 59, 184, 171, 145, 193, 154, 234, 42, 228, 67, 165,
+    134, 10, 90, 71, 132, 203, 200, 167, 225, 34, 194, 174, 66, 68, 47, 164, 196, 132, 107, 11, 29, 146, 43, 120,
+    50, 63, 103, 99, 61, 186, 0, 232, 246, 88, 217, 226, 135, 197, 210, 221, 0, 247, 187, 82, 182, 234, 218, 4,
+    195, 182, 130, 174, 71, 178, 198, 207, 20, 63, 179, 190, 195, 226, 233, 110, 163, 151, 220, 108, 147, 34, 159, 131,
+    10, 218, 13, 146, 60, 171, 104, 52, 72, 77, 12, 138, 113, 203, 239, 2, 23, 75, 215, 81, 87, 43, 3, 7,
+    209, 196, 141, 82, 60, 155, 14, 22, 174, 60, 66, 233, 122, 13, 190, 190, 12, 72, 205, 224, 20, 158, 67, 39,
+    165, 209, 41, 93, 187, 14, 247, 34, 29, 44, 46, 82, 210, 25, 226, 175, 212, 105, 186, 217, 91, 65, 203, 238,
+    41, 248, 72, 176, 171, 144, 126, 107, 66, 19, 93, 164, 100, 236, 199, 42, 86, 208, 120, 76, 188, 138, 113, 255,
+    7, 24, 125, 52, 30, 222, 139, 110, 123, 14, 238, 42, 228, 75, 239, 87, 234, 42, 228, 97, 223, 97, 14, 150,
+    24, 41, 105, 30, 19, 47, 34, 159, 132, 139, 10, 185, 26, 162, 176, 163, 26, 171, 38, 2, 65, 73, 237, 208,
+    232, 246, 88, 217, 226, 135, 197, 210, 221, 0, 246, 161, 87, 33, 158, 42, 230, 27, 87, 154, 27, 58, 181, 7,
+    204, 85, 200, 246, 88, 217, 226, 135, 246, 119, 216, 124, 93, 45, 212, 85, 200, 217, 42, 227, 193, 209, 90, 69,
+    56, 203, 120, 244, 71, 6, 107, 132, 139, 118, 31, 223, 209, 139, 148, 176, 149, 209, 164, 43, 89, 114, 74, 34,
+    174, 148, 42, 228, 31, 154, 208, 167, 31, 240, 113, 135, 211, 65, 237, 232, 182, 228, 44, 132, 185, 75, 118, 29,
+    220, 85, 200, 224, 205, 117, 21, 114, 48, 239, 176, 135, 75, 12, 157, 169, 91, 115, 61, 68, 210, 69, 43, 104,
+    22, 164, 65, 173, 225, 133, 63, 9, 22, 21, 114, 40, 198, 170, 201, 137, 236, 59, 184, 171, 145, 47, 189, 95,
+    168, 229, 247, 25, 35, 8, 53, 9, 145, 28, 190, 240, 54, 74, 184, 240, 153, 121, 20, 252, 36, 88, 85, 200,
+    185, 72, 160, 249, 138, 185, 8, 177, 179, 197, 118, 232, 232, 246, 88, 217, 226, 135, 197, 210, 221, 0, 255, 15,
+    184, 72, 33, 40, 85, 200, 224, 205, 24, 97, 150, 241, 232, 135, 204, 85, 200, 246, 88, 217, 226, 135, 246, 119,
+    216, 124, 93, 45, 212, 100, 250, 237, 131, 74, 218, 10, 185, 25, 44, 101, 130, 18, 31, 118, 176, 171, 145, 145,
+    106, 132, 192, 217, 35, 202, 182, 129, 32, 164, 246, 29, 220, 85, 200, 41, 53, 212, 85, 200, 135, 75, 12, 20,
+    180, 143, 9, 151, 145, 79, 194, 69, 133, 92, 132, 88, 217, 226, 129, 249, 173, 8, 77, 118, 158, 195, 187, 138,
+    185, 28, 25, 174, 162, 174, 68, 58, 88, 100, 237, 74, 219, 153, 20, 252, 36, 88, 73, 143, 75, 145, 9, 5,
+    36, 35, 88, 31, 69, 171, 116, 198, 57, 16, 114, 118, 99, 149, 72, 225, 106, 226, 174, 70, 168, 172, 19, 109,
+    161, 211, 43, 136, 116, 180, 246, 29, 220, 85, 200, 151, 222, 175, 212, 85, 200, 195, 190, 194, 29, 44, 32, 214,
+    240, 210, 41, 248, 72, 176, 171, 144, 145, 11, 233, 49, 33, 26, 194, 199, 100, 138, 222, 12, 143, 217, 216, 207,
+    110, 128, 232, 249, 83, 194, 104, 71, 197, 223, 94, 128, 255, 15, 184, 154, 59, 5, 106, 112, 130, 203, 174, 57,
+    24, 90, 19, 79, 9, 161, 16, 239, 168, 173, 242, 242, 108, 19, 132, 228, 120, 55, 86, 176, 171, 144, 139, 27,
+    60, 80, 205, 50, 92, 45, 41, 158, 195, 229, 73, 151, 153, 15, 152, 124, 88, 31, 215, 117, 219, 82, 213, 212,
+    100, 145, 111, 14, 145, 97, 225, 254, 102, 122, 132, 107, 13, 217, 108, 90, 151, 53, 79, 24, 35, 84, 202, 234,
+    198, 57, 27, 36, 84, 140, 177, 189, 81, 129, 87, 34, 118, 76, 143, 97, 236, 51, 69, 106, 19, 169, 198, 3,
+    230, 53, 92, 88, 240, 17, 172, 45, 188, 208, 216, 199, 164, 177, 145, 87, 33, 22, 59, 15, 235, 66, 73, 214,
+    70, 29, 180, 25, 188, 104, 245, 69, 135, 142, 69, 92, 137, 164, 207, 62, 221, 0, 232, 246, 88, 217, 226, 135,
+    197, 210, 221, 0, 239, 117, 145, 53, 6, 178, 184, 124, 199, 178, 198, 207, 20, 62, 46, 150, 11, 35, 245, 221,
+    77, 24, 234, 36, 199, 165, 109, 6, 168, 173, 142, 66, 72, 65, 147, 179, 28, 169, 224, 120, 53, 193, 44, 42,
+    228, 106, 138, 193, 22, 54, 120, 161, 154, 100, 184, 90, 83, 33, 26, 194, 174, 67, 239, 70, 4, 152, 244, 185,
+    16, 144, 82, 123, 14, 247, 34, 29, 44, 22, 70, 120, 70, 242, 108, 60, 114, 24, 165, 99, 145, 80, 186, 234,
+    108, 46, 109, 161, 158, 161, 26, 193, 242, 201, 37, 93, 147, 3, 9, 174, 219, 60, 212, 137, 164, 107, 8, 41,
+    110, 69, 56, 194, 233, 122, 21, 114, 56, 78, 66, 103, 70, 5, 183, 159, 61, 135, 245, 97, 87, 34, 203, 52,
+    141, 145, 234, 57, 125, 198, 72, 194, 229, 32, 85, 200, 205, 21, 168, 67, 164, 7, 204, 34, 198, 80, 153, 208,
+    164, 242, 173, 160, 124, 243, 237, 208, 232, 249, 82, 103, 152, 252, 82, 60, 171, 104, 61, 160, 167, 64, 255, 15,
+    184, 205, 90, 195, 151, 222, 36, 227, 48, 172, 42, 228, 34, 198, 207, 21, 238, 145, 52, 153, 230, 54, 72, 242,
+    173, 160, 72, 41, 212, 32, 244, 147, 67, 15, 67, 53, 198, 13, 135, 11, 87, 25, 36, 72, 124, 199, 164, 133,
+    125, 228, 106, 158, 76, 132, 107, 13, 94, 199, 19, 216, 123, 12, 207, 0, 235, 182, 31, 146, 100, 100, 140, 60,
+    17, 36, 176, 185, 75, 43, 104, 41, 195, 192, 206, 31, 81, 87, 43, 3, 209, 186, 229, 131, 61, 71, 132, 182,
+    134, 68, 240, 173, 162, 182, 131, 56, 125, 70, 17, 185, 72, 180, 132, 135, 221, 172, 42, 229, 96, 49, 203, 204,
+    246, 29, 238, 66, 65, 64, 178, 56, 56, 199, 239, 194, 208, 70, 176, 213, 217, 105, 224, 216, 120, 228, 73, 203,
+    120, 90, 228, 100, 154, 152, 73, 26, 190, 237, 70, 193, 216, 82, 99, 3, 103, 193, 158, 221, 0, 232, 255, 131,
+    140, 62, 154, 116, 239, 114, 15, 207, 100, 105, 33, 243, 31, 240, 113, 135, 211, 65, 237, 232, 182, 228, 77, 65,
+    172, 174, 100, 22, 182, 12, 206, 57, 5, 38, 130, 53, 135, 6, 107, 168, 65, 11, 227, 195, 176, 124, 194, 78,
+    215, 76, 80, 203, 122, 165, 109, 5, 94, 31, 125, 46, 42, 228, 100, 181, 207, 186, 67, 239, 83, 229, 98, 167,
+    176, 239, 114, 42, 19, 60, 215, 32, 178, 38, 138, 91, 145, 227, 122, 24, 51, 35, 39, 109, 12, 209, 176, 185,
+    131, 216, 125, 171, 140, 120, 116, 139, 72, 75, 122, 49, 75, 36, 111, 182, 79, 170, 182, 129, 42, 161, 50, 165,
+    118, 144, 172, 63, 37, 202, 235, 73, 212, 103, 15, 168, 215, 121, 59, 235, 34, 156, 97, 242, 76, 11, 43, 24,
+    158, 195, 189, 200, 187, 194, 254, 206, 194, 156, 85, 200, 41, 52, 46, 173, 82, 18, 133, 92, 137, 243, 204, 229,
+    9, 177, 137, 15, 152, 179, 240, 212, 252, 55, 81, 197, 215, 4, 83, 138, 185, 28, 25, 174, 162, 174, 70, 17,
+    173, 57, 38, 196, 120, 57, 62, 166, 70, 175, 4, 62, 197, 130, 53, 132, 111, 9, 142, 221, 0, 232, 255, 131,
+    140, 62, 154, 116, 246, 219, 104, 116, 202, 234, 218, 4, 26, 167, 249, 120, 7, 230, 181, 212, 114, 251, 137, 36,
+    74, 232, 210, 21, 172, 185, 37, 43, 104, 61, 223, 115, 240, 212, 252, 48, 252, 151, 43, 173, 39, 184, 112, 181,
+    112, 145, 15, 196, 141, 157, 90, 149, 180, 18, 251, 213, 251, 14, 247, 34, 235, 165, 248, 78, 68, 38, 187, 72,
+    185, 130, 39, 101, 132, 192, 210, 19, 35, 158, 248, 199, 61, 66, 99, 15, 194, 182, 131, 209, 186, 229, 131, 34,
+    156, 88, 206, 69, 172, 41, 248, 72, 176, 171, 145, 146, 215, 35, 34, 212, 99, 183, 64, 232, 255, 131, 140, 62,
+    154, 116, 239, 114, 46, 186, 95, 132, 228, 100, 237, 74, 219, 153, 5, 38, 184, 72, 183, 81, 224, 228, 250, 171,
+    104, 48, 102, 70, 241, 225, 24, 36, 142, 95, 113, 130, 158, 136, 171, 145, 146, 215, 62, 233, 25, 60, 17, 224,
+    221, 90, 221, 135, 197, 210, 210, 182, 33, 42, 161, 50, 165, 118, 145, 224, 228, 250, 145, 59, 36, 73, 142, 162,
+    14, 216, 76, 141, 135, 142, 68, 212, 26, 202, 230, 67, 230, 31, 98, 195, 53, 56, 180, 132, 107, 12, 177, 188,
+    209, 137, 15, 152, 168, 38, 123, 14, 247, 34, 124, 242, 51, 39, 18, 48, 145, 161, 129, 115, 7, 168, 225, 106,
+    226, 174, 69, 222, 23, 246, 118, 19, 80, 107, 43, 171, 104, 31, 122, 10, 193, 49, 129, 101, 131, 149, 43, 180,
+    246, 232, 232, 255, 131, 140, 62, 154, 4, 107, 15, 171, 235, 254, 93, 0, 246, 161, 87, 89, 26, 167, 249, 120,
+    10, 212, 99, 43, 163, 104, 122, 143, 248, 56, 195, 233, 160, 246, 244, 91, 114, 21, 168, 196, 156, 170, 71, 11,
+    87, 31, 213, 168, 196, 210, 81, 31, 87, 215, 252, 187, 15, 146, 232, 201, 161, 22, 88, 57, 84, 138, 132, 244,
+    112, 98, 65, 73, 161, 79, 194, 69, 133, 92, 143, 248, 70, 148, 145, 223, 120, 109, 151, 201, 8, 214, 29, 223,
+    99, 229, 58, 134, 120, 171, 138, 126, 18, 44, 63, 228, 241, 78, 221, 66, 53, 135, 6, 104, 120, 76, 188, 133,
+    106, 113, 87, 34, 229, 34, 131, 230, 63, 37, 202, 235, 73, 216, 119, 185, 23, 223, 80, 249, 138, 132, 207, 53,
+    200, 103, 15, 168, 215, 124, 82, 237, 130, 44, 176, 114, 165, 118, 145, 148, 20, 163, 33, 6, 78, 211, 72, 212,
+    60, 38, 94, 109, 15, 176, 124, 196, 190, 237, 110, 221, 0, 232, 248, 46, 151, 225, 57, 20, 227, 187, 236, 124,
+    167, 64, 248, 20, 178, 182, 128, 164, 215, 81, 87, 34, 235, 165, 248, 78, 69, 66, 52, 173, 43, 180, 133, 106,
+    113, 87, 35, 254, 17, 165, 36, 119, 222, 27, 101, 242, 122, 132, 20, 248, 192, 135, 75, 10, 186, 80, 218, 31,
+    85, 147, 33, 4, 234, 239, 87, 8, 214, 22, 88, 57, 80, 135, 222, 136, 167, 29, 223, 99, 229, 59, 14, 247,
+    34, 119, 136, 125, 218, 202, 218, 72, 240, 114, 125, 72, 86, 202, 10, 74, 182, 152, 228, 70, 240, 152, 234, 56,
+    90, 184, 244, 147, 66, 106, 13, 101, 115, 33, 243, 25, 164, 107, 132, 107, 7, 96, 86, 174, 96, 74, 216, 246,
+    31, 223, 44, 146, 85, 217, 48, 32, 205, 9, 167, 218, 66, 53, 132, 152, 244, 185, 16, 144, 82, 71, 136, 41,
+    228, 111, 176, 171, 145, 171, 179, 211, 183, 33, 243, 21, 114, 45, 11, 232, 246, 232, 232, 248, 46, 151, 225, 57,
+    31, 87, 215, 252, 186, 0, 254, 173, 70, 38, 146, 136, 250, 190, 191, 228, 38, 160, 214, 87, 50, 25, 226, 174,
+    17, 172, 37, 247, 171, 139, 152, 61, 135, 119, 21, 114, 25, 226, 175, 212, 74, 232, 210, 21, 172, 185, 37, 17,
+    99, 52, 172, 148, 174, 210, 48, 190, 72, 255, 147, 197, 59, 4, 107, 15, 125, 209, 183, 163, 216, 119, 113, 87,
+    34, 95, 122, 191, 81, 87, 34, 235, 165, 248, 78, 70, 10, 90, 71, 132, 203, 200, 167, 225, 34, 194, 207, 195,
+    83, 240, 195, 242, 92, 174, 180, 157, 135, 123, 145, 14, 150, 11, 35, 60, 35, 121, 54, 30, 57, 18, 251, 181,
+    135, 132, 136, 83, 18, 44, 114, 120, 74, 54, 28, 45, 92, 36, 82, 205, 46, 66, 198, 87, 70, 145, 99, 178,
+    229, 74, 218, 15, 248, 70, 148, 145, 132, 107, 78, 73, 177, 158, 221, 0, 232, 248, 46, 151, 225, 57, 31, 87,
+    215, 252, 186, 0, 239, 114, 21, 168, 196, 210, 81, 25, 59, 82, 182, 230, 66, 212, 137, 162, 150, 228, 108, 149,
+    126, 195, 217, 129, 249, 173, 8, 77, 118, 20, 226, 174, 65, 73, 161, 180, 63, 165, 177, 144, 153, 100, 102, 69,
+    56, 247, 150, 168, 76, 15, 111, 69, 183, 61, 66, 13, 83, 252, 188, 4, 138, 48, 169, 129, 14, 150, 21, 116,
+    161, 150, 245, 34, 175, 15, 190, 151, 31, 146, 229, 117, 164, 247, 72, 222, 60, 35, 6, 43, 165, 252, 60, 93,
+    222, 211, 216, 127, 127, 70, 46, 82, 194, 87, 70, 144, 152, 49, 66, 208, 190, 140, 72, 167, 27, 237, 147, 234,
+    173, 160, 147, 30, 151, 35, 33, 26, 195, 103, 86, 169, 15, 152, 86, 163, 6, 107, 183, 64, 232, 248, 46, 151,
+    225, 57, 31, 87, 215, 252, 186, 0, 255, 15, 184, 72, 33, 216, 35, 3, 131, 233, 40, 216, 73, 202, 149, 216,
+    62, 98, 174, 66, 181, 24, 154, 74, 61, 67, 231, 153, 133, 109, 2, 13, 145, 158, 19, 85, 200, 122, 83, 192,
+    124, 197, 92, 137, 222, 33, 247, 107, 43, 104, 18, 10, 118, 29, 220, 85, 200, 224, 205, 117, 21, 114, 50, 90,
+    230, 114, 77, 136, 124, 199, 228, 185, 93, 105, 6, 237, 155, 226, 210, 56, 90, 184, 90, 145, 170, 252, 195, 230,
+    53, 123, 24, 97, 227, 117, 197, 149, 180, 144, 141, 97, 117, 154, 120, 92, 147, 1, 35, 43, 173, 28, 171, 120,
+    61, 135, 123, 144, 126, 107, 66, 156, 123, 203, 84, 38, 7, 183, 162, 219, 144, 178, 61, 44, 175, 140, 17, 78,
+    42, 228, 75, 239, 87, 234, 56, 186, 224, 138, 185, 23, 93, 47, 194, 114, 50, 118, 165, 109, 204, 134, 120, 171,
+    240, 145, 97, 79, 194, 69, 132, 234, 152, 193, 129, 79, 195, 79, 110, 128, 232, 248, 46, 151, 225, 57, 31, 87,
+    215, 252, 130, 53, 135, 193, 116, 191, 9, 200, 167, 30, 251, 163, 111, 71, 160, 246, 161, 87, 89, 31, 231, 118,
+    202, 149, 219, 168, 171, 144, 173, 70, 38, 146, 136, 157, 176, 181, 61, 71, 11, 87, 8, 60, 66, 54, 87, 24,
+    41, 101, 109, 1, 73, 161, 79, 194, 69, 135, 190, 232, 219, 209, 236, 63, 178, 70, 132, 63, 163, 23, 41, 97,
+    43, 163, 72, 218, 31, 210, 216, 140, 176, 82, 5, 150, 14, 84, 174, 211, 212, 35, 88, 85, 200, 135, 75, 112,
+    156, 200, 178, 250, 49, 161, 26, 66, 100, 115, 223, 24, 231, 176, 239, 114, 48, 141, 105, 201, 54, 33, 46, 82,
+    195, 193, 201, 245, 50, 53, 120, 35, 135, 123, 27, 117, 23, 86, 165, 109, 2, 80, 171, 145, 149, 209, 180, 35,
+    56, 125, 70, 241, 225, 24, 83, 136, 222, 19, 0, 183, 165, 135, 109, 75, 84, 246, 232, 232, 248, 46, 151, 225,
+    57, 20, 227, 254, 79, 20, 237, 208, 239, 9, 232, 225, 91, 64, 207, 21, 126, 18, 45, 212, 85, 200, 86, 163,
+    19, 73, 68, 92, 165, 164, 83, 240, 145, 97, 255, 39, 138, 118, 236, 59, 220, 138, 132, 207, 53, 200, 85, 213,
+    164, 62, 245, 212, 35, 88, 85, 200, 125, 139, 8, 116, 176, 75, 148, 176, 89, 10, 222, 150, 149, 180, 236, 59,
+    184, 171, 145, 47, 189, 95, 168, 252, 151, 43, 173, 39, 186, 68, 249, 231, 10, 196, 44, 132, 22, 89, 164, 106,
+    18, 184, 187, 238, 106, 136, 77, 17, 90, 104, 85, 200, 159, 60, 246, 31, 23, 75, 74, 216, 132, 170, 132, 202,
+    149, 218, 71, 131, 147, 234, 70, 103, 131, 29, 68, 29, 176, 153, 27, 15, 28, 138, 185, 18, 186, 237, 130, 60,
+    20, 222, 185, 15, 152, 255, 132, 105, 73, 247, 72, 100, 173, 225, 48, 48, 141, 105, 201, 54, 51, 219, 160, 232,
+    247, 150, 168, 76, 15, 191, 230, 181, 208, 255, 15, 184, 164, 242, 69, 92, 131, 243, 90, 16, 154, 236, 31, 60,
+    199, 245, 106, 49, 52, 148, 71, 213, 245, 255, 32, 237, 78, 61, 229, 170, 19, 3, 219, 209, 109, 207, 97, 222,
+    228, 66, 107, 176, 203, 120, 244, 100, 78, 174, 245, 124, 115, 212, 88, 206, 69, 172, 173, 160, 240, 88, 165, 92,
+    85, 200, 56, 62, 146, 141, 133, 215, 75, 240, 156, 246, 29, 238, 68, 190, 237, 105, 15, 152, 171, 144, 173, 70,
+    38, 146, 136, 205, 44, 122, 136, 59, 97, 50, 54, 30, 57, 21, 114, 53, 120, 35, 15, 146, 97, 127, 99, 96,
+    206, 178, 100, 62, 99, 37, 174, 68, 212, 19, 83, 255, 159, 245, 255, 119, 118, 242, 173, 160, 187, 195, 79, 81,
+    101, 154, 70, 161, 43, 5, 167, 168, 70, 176, 171, 145, 174, 241, 174, 240, 31, 49, 188, 120, 70, 24, 92, 207,
+    110, 128, 232, 247, 150, 168, 76, 15, 111, 69, 183, 61, 0, 247, 150, 168, 76, 15, 111, 69, 183, 34, 230, 8,
+    217, 38, 76, 141, 218, 198, 5, 92, 138, 126, 12, 43, 104, 38, 163, 124, 171, 120, 33, 243, 31, 213, 168, 196,
+    210, 81, 31, 87, 215, 252, 187, 14, 247, 34, 106, 9, 160, 178, 48, 172, 108, 56, 90, 184, 213, 236, 102, 133,
+    223, 83, 33, 26, 194, 117, 76, 96, 120, 222, 85, 140, 201, 158, 160, 166, 87, 28, 45, 92, 45, 72, 126, 24,
+    101, 116, 132, 202, 140, 118, 30, 251, 174, 45, 5, 134, 216, 78, 66, 176, 206, 29, 168, 114, 145, 105, 234, 17,
+    172, 54, 54, 51, 80, 168, 210, 56, 76, 121, 9, 135, 109, 5, 92, 137, 91, 30, 19, 30, 103, 168, 75, 89,
+    91, 64, 130, 75, 73, 15, 152, 201, 245, 215, 118, 90, 228, 83, 138, 185, 9, 5, 59, 116, 232, 247, 150, 168,
+    76, 15, 111, 69, 183, 61, 0, 239, 117, 145, 53, 6, 178, 184, 124, 199, 188, 181, 66, 96, 123, 122, 45, 185,
+    11, 35, 210, 248, 132, 106, 234, 56, 90, 184, 65, 170, 252, 195, 230, 31, 22, 8, 214, 12, 120, 9, 25, 93,
+    104, 229, 91, 193, 236, 59, 184, 171, 145, 193, 154, 234, 42, 228, 126, 73, 70, 7, 189, 245, 217, 27, 145, 240,
+    255, 254, 25, 35, 15, 4, 73, 45, 216, 126, 5, 44, 62, 85, 4, 208, 86, 163, 18, 114, 169, 23, 48, 122,
+    140, 20, 178, 182, 130, 95, 122, 184, 167, 225, 34, 194, 174, 71, 247, 197, 135, 119, 225, 133, 150, 106, 23, 42,
+    234, 60, 179, 240, 195, 55, 128, 181, 32, 181, 24, 164, 86, 212, 181, 4, 107, 6, 93, 47, 88, 92, 207, 110,
+    128, 232, 252, 10, 88, 124, 170, 9, 174, 128, 255, 15, 184, 205, 90, 195, 151, 222, 36, 227, 48, 236, 63, 2,
+    150, 31, 42, 130, 107, 168, 65, 149, 210, 53, 86, 208, 85, 222, 31, 125, 47, 154, 65, 27, 39, 163, 97, 194,
+    213, 196, 27, 15, 16, 185, 121, 144, 141, 97, 133, 99, 97, 194, 213, 196, 22, 127, 73, 70, 195, 132, 131, 119,
+    222, 76, 138, 222, 24, 216, 43, 83, 140, 62, 117, 61, 70, 137, 140, 24, 83, 61, 66, 53, 129, 74, 48, 166,
+    123, 14, 238, 42, 228, 112, 102, 186, 132, 24, 95, 71, 28, 140, 210, 53, 49, 35, 84, 143, 38, 130, 200, 86,
+    25, 239, 140, 9, 225, 91, 78, 163, 209, 107, 60, 72, 124, 243, 48, 173, 160, 206, 12, 220, 109, 15, 109, 242,
+    33, 26, 193, 34, 150, 81, 147, 3, 71, 123, 79, 97, 221, 197, 92, 130, 147, 93, 66, 12, 62, 73, 129, 148,
+    38, 116, 60, 65, 224, 199, 33, 91, 210, 209, 145, 178, 84, 59, 72, 225, 106, 226, 174, 68, 228, 90, 131, 230,
+    46, 251, 72, 70, 176, 171, 145, 180, 62, 171, 36, 62, 99, 39, 197, 135, 130, 99, 183, 64, 232, 252, 10, 88,
+    124, 170, 9, 174, 128, 252, 10, 88, 100, 237, 74, 219, 153, 23, 48, 122, 142, 22, 174, 42, 228, 102, 145, 169,
+    137, 26, 164, 121, 52, 17, 172, 60, 65, 224, 199, 35, 61, 226, 174, 96, 83, 138, 185, 12, 241, 87, 234, 17,
+    172, 53, 120, 34, 207, 195, 83, 240, 194, 106, 9, 169, 20, 226, 174, 68, 190, 245, 126, 195, 187, 138, 185, 28,
+    25, 161, 133, 50, 42, 228, 22, 168, 70, 200, 135, 204, 32, 195, 228, 152, 9, 25, 37, 143, 80, 181, 33, 139,
+    176, 194, 233, 122, 145, 158, 23, 47, 38, 21, 180, 10, 222, 150, 149, 180, 199, 32, 250, 44, 45, 188, 43, 104,
+    42, 228, 89, 57, 236, 59, 220, 137, 125, 218, 210, 31, 49, 178, 183, 132, 198, 6, 169, 149, 213, 140, 132, 107,
+    12, 38, 250, 94, 140, 9, 217, 113, 128, 173, 78, 42, 228, 77, 65, 53, 219, 160, 232, 251, 159, 125, 48, 146,
+    17, 172, 63, 2, 150, 232, 246, 161, 87, 33, 90, 140, 73, 202, 149, 216, 62, 99, 238, 125, 244, 194, 72, 246,
+    244, 91, 114, 17, 172, 63, 2, 150, 31, 42, 130, 107, 168, 171, 145, 146, 215, 62, 233, 23, 41, 21, 224, 165,
+    5, 145, 178, 99, 100, 241, 131, 216, 125, 207, 190, 152, 73, 30, 222, 139, 110, 71, 141, 230, 176, 100, 112, 181,
+    113, 80, 153, 230, 185, 117, 30, 30, 174, 61, 27, 174, 91, 225, 32, 35, 88, 108, 108, 102, 161, 81, 187, 15,
+    149, 65, 52, 54, 49, 155, 198, 166, 36, 22, 163, 20, 138, 195, 100, 153, 49, 62, 57, 234, 17, 172, 42, 228,
+    36, 62, 168, 31, 49, 147, 231, 153, 33, 26, 195, 194, 121, 54, 26, 59, 218, 71, 9, 157, 72, 206, 31, 80,
+    197, 35, 199, 35, 36, 204, 207, 97, 222, 228, 93, 102, 158, 23, 33, 255, 182, 87, 97, 242, 164, 165, 118, 30,
+    55, 92, 89, 91, 65, 52, 141, 105, 27, 67, 239, 108, 114, 41, 197, 92, 142, 12, 215, 80, 130, 140, 210, 106,
+    90, 133, 56, 171, 145, 146, 215, 62, 233, 16, 185, 92, 108, 147, 93, 186, 0, 232, 239, 114, 63, 188, 109, 115,
+    190, 163, 189, 202, 84, 30, 128, 255, 15, 184, 154, 70, 176, 240, 115, 120, 34, 174, 71, 247, 141, 174, 119, 212,
+    119, 185, 74, 131, 212, 32, 240, 83, 122, 92, 247, 198, 57, 16, 102, 158, 13, 135, 162, 219, 145, 100, 165, 109,
+    7, 132, 203, 200, 167, 21, 114, 62, 175, 246, 254, 63, 194, 123, 15, 235, 82, 53, 72, 253, 119, 36, 35, 51,
+    238, 217, 25, 27, 237, 147, 234, 173, 160, 155, 191, 19, 212, 35, 88, 85, 200, 120, 100, 162, 51, 79, 254, 127,
+    255, 165, 136, 204, 165, 111, 6, 66, 181, 66, 228, 148, 70, 73, 30, 149, 180, 144, 141, 97, 233, 90, 147, 66,
+    48, 186, 94, 149, 180, 236, 59, 221, 247, 210, 226, 174, 69, 157, 226, 66, 65, 25, 111, 16, 90, 177, 200, 203,
+    15, 38, 221, 70, 207, 52, 98, 69, 213, 168, 37, 10, 185, 25, 111, 138, 222, 19, 0, 250, 45, 82, 42, 233,
+    67, 196, 20, 171, 145, 133, 204, 133, 106, 113, 87, 35, 37, 174, 123, 116, 232, 252, 10, 88, 124, 170, 9, 174,
+    128, 239, 114, 37, 247, 171, 152, 96, 90, 193, 243, 31, 129, 75, 15, 149, 65, 52, 52, 135, 226, 71, 235, 186,
+    154, 49, 212, 85, 200, 190, 243, 88, 33, 243, 22, 126, 26, 159, 134, 26, 47, 165, 109, 7, 9, 200, 167, 8,
+    53, 120, 34, 76, 22, 32, 183, 165, 135, 109, 75, 87, 97, 242, 213, 49, 142, 163, 15, 146, 99, 28, 254, 247,
+    225, 141, 132, 221, 246, 144, 249, 230, 96, 35, 82, 254, 187, 153, 8, 214, 25, 111, 10, 242, 180, 166, 123, 14,
+    247, 34, 106, 9, 161, 150, 248, 213, 89, 40, 200, 86, 8, 50, 223, 31, 190, 199, 247, 202, 101, 212, 120, 60,
+    187, 88, 113, 117, 202, 227, 10, 100, 32, 204, 182, 70, 223, 189, 243, 204, 36, 20, 26, 164, 121, 54, 28, 45,
+    92, 123, 191, 229, 199, 120, 51, 178, 76, 171, 105, 238, 18, 186, 52, 246, 232, 232, 252, 10, 88, 124, 170, 9,
+    161, 247, 20, 176, 251, 218, 221, 0, 255, 15, 191, 187, 209, 16, 83, 43, 155, 10, 185, 5, 172, 31, 49, 248,
+    20, 176, 249, 84, 19, 93, 135, 176, 247, 124, 93, 44, 61, 248, 121, 54, 247, 9, 93, 24, 120, 195, 229, 230,
+    70, 123, 197, 92, 192, 217, 38, 83, 67, 212, 35, 88, 120, 60, 187, 88, 45, 117, 8, 193, 253, 24, 210, 31,
+    134, 24, 122, 28, 45, 92, 85, 200, 131, 171, 35, 84, 135, 204, 35, 7, 197, 134, 137, 34, 105, 41, 93, 132,
+    210, 53, 164, 74, 224, 181, 99, 158, 195, 189, 200, 241, 186, 226, 202, 218, 5, 145, 225, 210, 44, 108, 55, 219,
+    168, 70, 176, 210, 19, 60, 214, 148, 37, 173, 35, 39, 195, 192, 167, 11, 82, 56, 41, 87, 48, 108, 56, 76,
+    98, 123, 116, 232, 251, 159, 125, 48, 146, 61, 189, 22, 220, 244, 251, 159, 125, 48, 146, 61, 189, 22, 220, 139,
+    152, 33, 100, 97, 88, 216, 112, 181, 112, 131, 85, 249, 135, 204, 106, 246, 48, 194, 105, 224, 231, 14, 213, 33,
+    26, 194, 235, 52, 240, 185, 38, 7, 141, 215, 22, 86, 210, 123, 14, 238, 42, 228, 20, 154, 234, 42, 228, 43,
+    81, 137, 57, 82, 187, 14, 22, 174, 63, 2, 150, 31, 42, 130, 104, 96, 165, 164, 120, 76, 188, 138, 126, 18,
+    44, 42, 228, 100, 181, 207, 186, 67, 46, 151, 172, 46, 103, 176, 238, 226, 174, 71, 6, 107, 168, 171, 144, 158,
+    139, 110, 68, 212, 26, 202, 230, 69, 63, 9, 22, 21, 114, 61, 163, 202, 52, 164, 143, 138, 250, 49, 212, 113,
+    115, 4, 32, 194, 70, 132, 108, 108, 102, 161, 81, 135, 136, 91, 104, 68, 236, 141, 34, 174, 71, 9, 70, 59,
+    116, 232, 252, 30, 112, 121, 8, 214, 31, 115, 239, 166, 18, 122, 0, 246, 161, 87, 35, 40, 121, 152, 116, 180,
+    135, 204, 126, 15, 56, 60, 143, 149, 65, 52, 17, 172, 62, 231, 223, 76, 36, 143, 111, 69, 183, 61, 69, 92,
+    130, 198, 52, 228, 44, 140, 47, 163, 142, 123, 15, 149, 65, 52, 18, 40, 37, 158, 26, 69, 92, 137, 91, 25,
+    15, 152, 241, 186, 226, 202, 218, 79, 80, 141, 97, 155, 189, 133, 70, 249, 121, 144, 144, 70, 201, 30, 77, 130,
+    97, 219, 65, 87, 35, 45, 227, 199, 80, 249, 230, 97, 91, 64, 131, 210, 66, 154, 228, 62, 99, 45, 214, 85,
+    140, 246, 31, 131, 206, 15, 35, 229, 80, 77, 12, 20, 180, 134, 120, 171, 133, 106, 112, 130, 160, 181, 185, 22,
+    89, 168, 92, 168, 112, 181, 112, 145, 67, 68, 198, 12, 41, 158, 161, 26, 194, 95, 122, 184, 167, 225, 34, 195,
+    245, 221, 77, 24, 12, 87, 75, 248, 120, 187, 189, 167, 183, 64, 232, 252, 30, 112, 121, 31, 42, 130, 107, 160,
+    248, 20, 178, 182, 130, 95, 122, 184, 118, 31, 131, 206, 15, 35, 229, 80, 77, 117, 21, 114, 39, 120, 135, 221,
+    172, 173, 164, 143, 7, 39, 212, 141, 94, 8, 131, 43, 98, 212, 169, 142, 195, 216, 122, 86, 164, 208, 141, 18,
+    68, 210, 82, 187, 10, 113, 87, 32, 164, 215, 97, 222, 9, 145, 133, 98, 42, 228, 74, 216, 240, 152, 243, 61,
+    70, 208, 254, 150, 202, 218, 9, 186, 88, 132, 107, 4, 20, 251, 229, 112, 249, 134, 74, 222, 8, 77, 86, 194,
+    174, 70, 241, 225, 24, 73, 170, 86, 211, 183, 64, 232, 252, 30, 112, 121, 31, 42, 130, 104, 125, 197, 44, 62,
+    246, 183, 64, 252, 30, 112, 121, 31, 42, 130, 104, 22, 180, 139, 152, 33, 88, 32, 253, 119, 83, 67, 45, 241,
+    251, 236, 127, 124, 166, 66, 119, 136, 125, 218, 198, 195, 199, 34, 117, 76, 96, 93, 245, 50, 56, 90, 184, 224,
+    227, 31, 190, 139, 88, 216, 104, 145, 98, 211, 216, 123, 238, 184, 180, 22, 27, 97, 57, 10, 193, 3, 20, 143,
+    28, 142, 82, 45, 212, 85, 202, 192, 194, 111, 165, 232, 192, 205, 113, 133, 109, 5, 92, 132, 88, 236, 63, 173,
+    123, 164, 32, 216, 166, 71, 61, 240, 50, 118, 168, 73, 161, 78, 42, 228, 120, 222, 107, 10, 218, 12, 150, 185,
+    19, 80, 77, 72, 255, 59, 205, 4, 25, 158, 7, 140, 62, 94, 100, 39, 9, 207, 110, 128, 232, 252, 30, 112,
+    121, 31, 42, 130, 107, 160, 252, 31, 210, 182, 129, 158, 42, 225, 216, 126, 15, 56, 60, 143, 149, 65, 53, 212,
+    114, 251, 134, 122, 92, 136, 171, 145, 227, 117, 197, 149, 180, 145, 80, 141, 43, 74, 236, 41, 198, 80, 82, 151,
+    209, 19, 178, 100, 103, 255, 63, 235, 254, 210, 40, 77, 111, 101, 121, 234, 21, 172, 118, 45, 98, 212, 42, 229,
+    40, 196, 245, 8, 214, 7, 44, 28, 169, 114, 30, 31, 122, 95, 215, 115, 61, 135, 123, 144, 82, 104, 74, 216,
+    135, 204, 85, 200, 154, 130, 104, 44, 139, 62, 170, 201, 70, 195, 199, 34, 174, 71, 132, 203, 200, 45, 80, 141,
+    145, 15, 152, 70, 9, 25, 37, 143, 80, 181, 35, 196, 46, 94, 71, 9, 140, 72, 75, 60, 49, 176, 225, 106,
+    227, 39, 195, 198, 123, 224, 107, 188, 38, 36, 88, 236, 185, 82, 182, 131, 44, 36, 202, 228, 61, 45, 139, 141,
+    19, 82, 50, 186, 66, 101, 70, 39, 183, 64, 232, 252, 30, 112, 121, 31, 42, 130, 107, 160, 239, 114, 18, 181,
+    121, 218, 230, 8, 185, 130, 22, 71, 165, 241, 8, 213, 216, 119, 113, 87, 32, 164, 215, 81, 87, 35, 251, 226,
+    195, 187, 240, 195, 250, 36, 106, 98, 71, 224, 145, 228, 208, 89, 10, 195, 61, 241, 129, 60, 43, 105, 212, 62,
+    121, 152, 86, 208, 103, 6, 110, 54, 135, 182, 249, 30, 162, 232, 214, 213, 44, 70, 80, 153, 212, 245, 8, 214,
+    24, 95, 68, 107, 188, 174, 93, 135, 188, 181, 66, 96, 123, 122, 45, 185, 24, 83, 34, 156, 85, 200, 103, 138,
+    191, 81, 147, 179, 28, 169, 91, 65, 203, 238, 60, 38, 94, 69, 56, 171, 145, 170, 43, 4, 138, 48, 166, 67,
+    230, 42, 228, 100, 181, 207, 110, 128, 232, 247, 150, 168, 76, 15, 111, 69, 183, 61, 0, 246, 161, 87, 33, 90,
+    140, 73, 202, 149, 216, 62, 99, 222, 90, 161, 48, 61, 189, 22, 220, 132, 107, 15, 193, 231, 7, 145, 242, 168,
+    38, 186, 142, 95, 127, 116, 17, 164, 19, 70, 195, 199, 34, 174, 68, 174, 151, 160, 249, 138, 185, 31, 146, 229,
+    117, 164, 31, 146, 81, 129, 239, 45, 70, 5, 56, 171, 145, 193, 154, 234, 17, 129, 182, 249, 37, 43, 178, 96,
+    102, 153, 46, 22, 185, 28, 45, 92, 43, 81, 132, 202, 151, 209, 7, 231, 117, 240, 181, 33, 60, 62, 244, 56,
+    74, 48, 50, 118, 147, 30, 146, 149, 219, 176, 238, 226, 174, 68, 190, 245, 126, 163, 240, 121, 193, 228, 124, 170,
+    9, 161, 130, 150, 145, 225, 50, 242, 41, 248, 72, 176, 171, 144, 145, 82, 44, 179, 80, 185, 87, 97, 222, 228,
+    102, 145, 169, 137, 26, 164, 121, 52, 60, 111, 251, 126, 198, 69, 56, 171, 145, 47, 189, 92, 164, 215, 110, 128,
+    232, 247, 150, 168, 76, 15, 111, 69, 183, 61, 0, 239, 117, 144, 144, 80, 62, 99, 222, 90, 161, 48, 61, 189,
+    22, 220, 135, 216, 180, 133, 106, 112, 130, 118, 76, 149, 247, 145, 182, 19, 246, 78, 195, 189, 200, 186, 205, 60,
+    46, 67, 251, 198, 215, 59, 234, 59, 220, 165, 65, 19, 72, 214, 145, 180, 62, 246, 199, 34, 156, 85, 200, 103,
+    138, 191, 80, 181, 35, 44, 36, 202, 228, 18, 50, 186, 209, 202, 183, 130, 50, 118, 168, 73, 165, 109, 7, 11,
+    87, 21, 114, 53, 123, 24, 97, 227, 117, 197, 149, 180, 144, 197, 35, 199, 61, 135, 119, 21, 114, 37, 247, 171,
+    245, 8, 193, 35, 43, 240, 156, 132, 179, 195, 27, 14, 22, 174, 48, 186, 94, 164, 106, 145, 230, 69, 92, 130,
+    213, 8, 217, 17, 78, 42, 228, 127, 124, 88, 119, 126, 24, 127, 68, 141, 76, 72, 252, 18, 60, 154, 237, 208,
+    232, 247, 150, 168, 76, 15, 111, 69, 183, 61, 0, 247, 150, 168, 76, 15, 111, 69, 183, 35, 39, 106, 86, 220,
+    200, 41, 52, 17, 172, 56, 51, 66, 230, 15, 81, 133, 99, 97, 194, 213, 194, 13, 87, 230, 31, 48, 249, 230,
+    185, 17, 227, 117, 197, 149, 180, 144, 141, 97, 6, 105, 55, 132, 106, 158, 195, 187, 138, 185, 28, 25, 174, 162,
+    174, 71, 228, 185, 93, 105, 7, 228, 148, 96, 123, 203, 81, 128, 178, 61, 44, 175, 140, 30, 161, 106, 68, 28,
+    240, 114, 165, 244, 71, 10, 214, 126, 36, 105, 133, 106, 86, 208, 43, 10, 185, 19, 187, 118, 29, 238, 69, 150,
+    105, 26, 133, 247, 212, 62, 98, 235, 165, 248, 78, 69, 66, 103, 154, 228, 50, 70, 30, 8, 185, 72, 176, 205,
+    21, 171, 28, 133, 97, 87, 35, 194, 101, 231, 72, 125, 218, 221, 186, 0, 232, 252, 17, 88, 35, 88, 123, 203,
+    84, 38, 58, 0, 246, 161, 87, 35, 198, 243, 200, 86, 163, 18, 114, 165, 118, 15, 152, 252, 17, 88, 124, 170,
+    9, 160, 141, 97, 239, 45, 80, 152, 30, 222, 139, 110, 122, 138, 185, 25, 45, 114, 51, 39, 18, 19, 11, 232,
+    246, 29, 225, 51, 205, 114, 24, 93, 47, 82, 50, 118, 168, 124, 10, 185, 25, 225, 248, 15, 152, 201, 34, 122,
+    132, 107, 12, 161, 230, 120, 76, 121, 144, 144, 70, 107, 140, 27, 14, 22, 174, 54, 54, 51, 80, 168, 211, 216,
+    123, 12, 159, 60, 201, 19, 119, 216, 59, 10, 185, 25, 60, 49, 129, 224, 229, 229, 218, 71, 11, 87, 21, 114,
+    18, 31, 84, 15, 152, 206, 12, 223, 28, 136, 116, 154, 54, 30, 10, 52, 246, 29, 238, 71, 228, 148, 96, 123,
+    223, 93, 145, 185, 30, 55, 92, 89, 91, 65, 135, 201, 40, 216, 127, 157, 230, 133, 56, 171, 145, 193, 154, 237,
+    208, 232, 252, 17, 88, 124, 170, 9, 174, 128, 252, 17, 88, 124, 170, 9, 160, 201, 16, 252, 72, 156, 46, 151,
+    172, 114, 46, 96, 245, 20, 158, 85, 180, 14, 193, 6, 175, 4, 43, 82, 234, 148, 70, 100, 227, 176, 239, 114,
+    60, 110, 184, 178, 182, 146, 18, 8, 124, 88, 199, 81, 194, 213, 196, 190, 164, 89, 41, 91, 65, 225, 50, 242,
+    41, 197, 92, 130, 145, 142, 71, 241, 254, 21, 113, 145, 106, 222, 57, 234, 42, 229, 96, 120, 133, 203, 200, 205,
+    63, 249, 255, 254, 150, 50, 40, 227, 10, 218, 9, 167, 133, 50, 31, 49, 87, 35, 100, 154, 236, 59, 220, 137,
+    168, 38, 134, 91, 199, 163, 33, 158, 42, 252, 36, 91, 168, 226, 19, 109, 149, 180, 9, 15, 187, 88, 85, 200,
+    252, 151, 43, 173, 39, 239, 249, 27, 105, 194, 229, 228, 123, 223, 118, 174, 71, 193, 102, 158, 23, 36, 192, 252,
+    55, 147, 190, 189, 66, 13, 33, 26, 195, 198, 235, 139, 43, 104, 56, 90, 184, 65, 150, 31, 47, 34, 159, 131,
+    29, 186, 0, 232, 252, 17, 88, 35, 88, 125, 248, 215, 160, 252, 17, 88, 124, 170, 9, 160, 173, 70, 36, 229,
+    82, 56, 90, 184, 251, 241, 168, 249, 84, 19, 65, 40, 85, 214, 71, 235, 186, 43, 80, 201, 225, 140, 118, 31,
+    126, 53, 31, 42, 130, 104, 96, 165, 164, 112, 102, 133, 63, 9, 22, 21, 114, 60, 38, 94, 67, 230, 42, 228,
+    126, 73, 70, 7, 189, 245, 217, 27, 158, 195, 216, 78, 169, 140, 13, 146, 60, 142, 22, 174, 60, 22, 202, 230,
+    66, 53, 132, 221, 44, 69, 65, 50, 21, 189, 45, 25, 27, 36, 201, 137, 241, 200, 167, 27, 38, 242, 66, 53,
+    129, 111, 242, 252, 138, 185, 19, 188, 67, 238, 214, 86, 210, 123, 116, 232, 251, 241, 168, 249, 84, 19, 93, 0,
+    251, 241, 168, 249, 84, 19, 66, 230, 8, 89, 31, 174, 234, 107, 168, 194, 177, 176, 225, 106, 225, 6, 171, 243,
+    15, 152, 131, 43, 98, 212, 169, 129, 227, 117, 197, 149, 180, 144, 141, 97, 58, 166, 48, 31, 60, 215, 35, 61,
+    135, 119, 21, 114, 37, 247, 171, 245, 21, 114, 60, 38, 94, 69, 157, 224, 62, 98, 174, 71, 228, 185, 93, 105,
+    7, 228, 148, 96, 123, 223, 93, 145, 185, 19, 72, 214, 144, 159, 229, 35, 168, 218, 31, 109, 141, 131, 236, 88,
+    112, 181, 112, 130, 117, 76, 96, 77, 59, 30, 221, 0, 232, 251, 241, 168, 249, 84, 19, 93, 0, 251, 241, 168,
+    249, 84, 19, 67, 45, 227, 209, 145, 161, 106, 199, 34, 230, 15, 81, 130, 150, 86, 208, 83, 240, 145, 96, 131,
+    9, 26, 17, 80, 153, 230, 185, 12, 150, 50, 193, 20, 226, 174, 68, 190, 245, 126, 195, 189, 200, 154, 130, 104,
+    44, 137, 186, 88, 216, 120, 228, 82, 99, 1, 211, 200, 168, 38, 122, 138, 185, 88, 24, 41, 232, 200, 141, 230,
+    176, 173, 160, 151, 206, 177, 200, 86, 21, 114, 60, 65, 63, 177, 236, 59, 184, 171, 144, 82, 107, 168, 251, 241,
+    168, 249, 84, 19, 67, 136, 77, 164, 36, 62, 237, 110, 163, 104, 127, 75, 101, 109, 2, 101, 145, 153, 30, 19,
+    47, 34, 159, 132, 139, 10, 185, 25, 45, 115, 238, 145, 147, 193, 237, 208, 232, 247, 150, 168, 76, 15, 122, 198,
+    88, 61, 0, 255, 15, 184, 72, 133, 244, 66, 80, 247, 150, 168, 76, 15, 122, 198, 88, 61, 66, 12, 36, 104,
+    66, 53, 129, 193, 209, 26, 177, 200, 177, 149, 209, 141, 132, 62, 237, 100, 240, 251, 208, 75, 60, 49, 176, 225,
+    106, 225, 6, 17, 173, 57, 38, 198, 193, 103, 8, 214, 10, 194, 174, 70, 69, 168, 199, 97, 222, 228, 44, 225,
+    26, 195, 50, 149, 188, 25, 8, 41, 248, 48, 173, 160, 156, 183, 198, 213, 188, 17, 170, 88, 135, 204, 43, 81,
+    138, 225, 89, 91, 65, 169, 164, 192, 72, 202, 122, 137, 231, 95, 15, 133, 253, 149, 180, 27, 178, 215, 33, 26,
+    195, 104, 125, 32, 204, 246, 31, 42, 130, 106, 68, 37, 149, 40, 135, 222, 184, 72, 176, 86, 9, 140, 11, 44,
+    28, 169, 93, 167, 255, 161, 247, 227, 81, 242, 168, 38, 133, 56, 171, 144, 207, 21, 126, 163, 240, 203, 251, 20,
+    97, 246, 190, 248, 62, 146, 44, 41, 197, 92, 137, 125, 234, 253, 66, 53, 135, 188, 181, 66, 96, 123, 122, 45,
+    185, 19, 80, 107, 43, 171, 104, 10, 77, 4, 107, 14, 12, 215, 110, 128, 232, 247, 150, 168, 76, 15, 111, 69,
+    183, 61, 0, 247, 150, 168, 76, 15, 111, 69, 183, 34, 230, 8, 89, 24, 86, 54, 28, 45, 92, 111, 180, 228,
+    152, 35, 195, 239, 75, 250, 238, 100, 35, 88, 36, 80, 209, 49, 131, 10, 103, 168, 171, 149, 129, 194, 181, 159,
+    137, 19, 119, 227, 36, 149, 109, 6, 31, 36, 192, 72, 165, 154, 159, 112, 225, 227, 204, 246, 29, 238, 68, 212,
+    19, 65, 100, 97, 125, 28, 115, 212, 112, 181, 113, 55, 125, 182, 49, 33, 26, 193, 34, 129, 106, 190, 242, 169,
+    53, 34, 106, 31, 24, 86, 208, 38, 29, 180, 21, 114, 37, 108, 120, 76, 121, 158, 195, 187, 138, 185, 5, 38,
+    186, 143, 121, 106, 132, 192, 246, 244, 91, 114, 50, 118, 165, 109, 204, 138, 126, 18, 44, 42, 228, 100, 181, 207,
+    186, 70, 91, 226, 183, 132, 192, 178, 205, 66, 229, 93, 71, 23, 92, 17, 78, 42, 228, 112, 102, 186, 133, 161,
+    130, 150, 145, 225, 50, 242, 41, 197, 92, 143, 121, 106, 132, 192, 247, 172, 101, 131, 219, 160, 232, 247, 150, 168,
+    76, 15, 111, 69, 183, 61, 0, 239, 117, 145, 39, 77, 75, 80, 124, 199, 188, 181, 66, 96, 123, 122, 45, 185,
+    11, 35, 245, 221, 77, 24, 234, 31, 60, 204, 43, 104, 16, 120, 193, 107, 7, 204, 100, 250, 234, 99, 37, 76,
+    7, 207, 53, 200, 200, 70, 176, 224, 227, 31, 191, 84, 86, 164, 86, 54, 9, 178, 69, 106, 90, 135, 141, 215,
+    22, 86, 210, 123, 14, 247, 35, 242, 74, 48, 61, 239, 174, 200, 220, 133, 145, 233, 101, 124, 96, 138, 113, 87,
+    35, 131, 53, 212, 113, 117, 193, 20, 226, 174, 68, 190, 245, 126, 161, 6, 201, 87, 225, 57, 24, 41, 105, 20,
+    252, 36, 88, 123, 187, 220, 143, 248, 39, 99, 1, 243, 21, 114, 63, 28, 34, 180, 251, 132, 210, 86, 231, 168,
+    65, 43, 163, 46, 107, 146, 53, 12, 35, 91, 84, 143, 35, 139, 152, 34, 174, 71, 218, 186, 4, 107, 15, 236,
+    181, 88, 35, 218, 60, 163, 74, 72, 133, 244, 98, 70, 78, 222, 140, 104, 123, 116, 232, 239, 114, 63, 224, 157,
+    140, 7, 204, 85, 200, 252, 112, 138, 211, 208, 255, 15, 184, 154, 70, 176, 240, 115, 120, 34, 174, 71, 187, 254,
+    9, 216, 192, 124, 197, 92, 143, 199, 8, 173, 61, 125, 193, 7, 217, 246, 126, 252, 221, 232, 82, 99, 2, 104,
+    156, 9, 203, 124, 109, 91, 193, 15, 152, 70, 31, 213, 172, 186, 22, 125, 228, 112, 145, 10, 241, 212, 36, 107,
+    34, 17, 100, 216, 83, 138, 185, 19, 231, 158, 195, 189, 200, 154, 74, 220, 137, 164, 107, 72, 118, 8, 54, 135,
+    213, 218, 158, 57, 9, 66, 174, 70, 78, 217, 227, 114, 217, 16, 249, 138, 185, 21, 195, 136, 95, 70, 39, 176,
+    254, 139, 4, 90, 55, 214, 65, 108, 150, 50, 193, 21, 114, 60, 36, 158, 163, 11, 66, 219, 194, 182, 128, 250,
+    44, 173, 160, 133, 173, 211, 19, 216, 125, 176, 182, 208, 200, 201, 217, 142, 84, 42, 228, 77, 37, 110, 69, 56,
+    171, 145, 11, 232, 199, 132, 111, 51, 212, 62, 121, 152, 86, 208, 108, 140, 240, 154, 174, 67, 210, 158, 36, 62,
+    98, 174, 70, 75, 92, 137, 243, 206, 21, 143, 110, 128, 232, 252, 17, 88, 124, 170, 9, 174, 128, 252, 17, 88,
+    124, 170, 9, 161, 115, 4, 44, 140, 43, 27, 14, 22, 174, 46, 179, 79, 11, 144, 241, 186, 226, 202, 218, 72,
+    201, 219, 209, 138, 54, 10, 212, 227, 87, 177, 134, 30, 55, 149, 99, 50, 103, 176, 246, 24, 124, 147, 3, 195,
+    191, 153, 167, 130, 56, 90, 184, 202, 10, 121, 86, 208, 112, 239, 98, 195, 60, 59, 196, 133, 111, 75, 70, 71,
+    47, 184, 167, 7, 231, 182, 30, 8, 90, 145, 55, 56, 244, 103, 176, 238, 226, 174, 68, 190, 245, 126, 162, 174,
+    68, 212, 19, 67, 39, 106, 86, 220, 200, 167, 225, 34, 194, 12, 173, 139, 82, 166, 3, 21, 210, 254, 30, 46,
+    239, 105, 234, 56, 186, 224, 138, 185, 25, 45, 114, 50, 45, 70, 6, 20, 200, 167, 21, 114, 25, 226, 175, 219,
+    160, 232, 252, 17, 88, 124, 170, 9, 174, 128, 246, 161, 87, 89, 10, 212, 98, 78, 84, 174, 221, 66, 9, 213,
+    49, 128, 152, 193, 228, 83, 138, 185, 5, 38, 134, 10, 90, 69, 56, 65, 117, 181, 139, 12, 159, 120, 174, 82,
+    44, 51, 92, 96, 216, 112, 181, 113, 146, 103, 255, 207, 255, 164, 35, 88, 36, 82, 202, 48, 155, 190, 211, 216,
+    119, 185, 19, 145, 106, 15, 152, 206, 12, 220, 108, 147, 80, 166, 66, 53, 135, 136, 60, 27, 12, 159, 60, 201,
+    11, 32, 181, 46, 74, 218, 118, 31, 130, 43, 15, 149, 65, 52, 50, 118, 165, 109, 204, 134, 120, 171, 138, 126,
+    18, 44, 42, 228, 120, 222, 107, 10, 218, 11, 63, 13, 79, 195, 4, 107, 9, 125, 234, 226, 159, 132, 139, 15,
+    215, 117, 52, 96, 77, 65, 53, 61, 186, 0, 232, 252, 17, 88, 35, 88, 125, 207, 190, 152, 73, 232, 255, 15,
+    191, 187, 209, 16, 83, 43, 155, 10, 185, 30, 151, 196, 35, 80, 86, 163, 18, 114, 165, 118, 15, 152, 252, 17,
+    88, 124, 170, 9, 160, 141, 97, 247, 62, 250, 97, 36, 123, 122, 45, 185, 236, 59, 221, 100, 44, 138, 185, 23,
+    41, 20, 31, 49, 103, 225, 169, 248, 97, 249, 46, 87, 90, 78, 163, 139, 152, 35, 87, 177, 134, 19, 231, 153,
+    202, 19, 99, 18, 53, 38, 133, 214, 105, 225, 114, 25, 166, 73, 99, 61, 135, 202, 160, 154, 26, 239, 43, 146,
+    163, 72, 216, 198, 111, 26, 135, 97, 147, 195, 24, 158, 161, 26, 195, 55, 123, 15, 69, 172, 241, 33, 243, 204,
+    192, 65, 233, 33, 77, 114, 31, 49, 71, 93, 169, 91, 65, 80, 82, 167, 176, 239, 114, 18, 10, 5, 144, 152,
+    95, 68, 112, 181, 113, 177, 125, 176, 71, 15, 30, 85, 180, 234, 38, 239, 182, 202, 218, 117, 8, 214, 5, 191,
+    203, 242, 173, 160, 171, 145, 146, 215, 62, 233, 15, 158, 102, 21, 180, 158, 221, 0, 232, 251, 159, 125, 48, 146,
+    61, 189, 22, 220, 244, 251, 159, 125, 48, 146, 61, 189, 22, 220, 139, 152, 33, 100, 32, 241, 130, 214, 15, 152,
+    171, 144, 248, 176, 70, 176, 99, 199, 97, 221, 197, 92, 130, 147, 93, 69, 92, 137, 168, 38, 134, 10, 90, 69,
+    63, 9, 22, 21, 114, 46, 179, 79, 11, 144, 251, 142, 17, 156, 125, 203, 53, 11, 149, 117, 30, 89, 248, 97,
+    155, 192, 90, 145, 187, 47, 235, 185, 19, 119, 218, 66, 53, 129, 74, 48, 166, 123, 14, 238, 42, 228, 112, 102,
+    186, 133, 161, 114, 150, 145, 225, 50, 242, 41, 248, 72, 176, 171, 145, 146, 215, 62, 233, 25, 60, 30, 195, 189,
+    200, 79, 69, 183, 33, 100, 97, 88, 216, 112, 181, 113, 170, 86, 240, 69, 65, 51, 212, 109, 15, 233, 108, 173,
+    160, 155, 165, 136, 167, 27, 27, 25, 168, 84, 105, 14, 194, 174, 71, 11, 98, 37, 108, 120, 76, 121, 158, 221,
+    0, 232, 252, 17, 88, 124, 170, 9, 174, 128, 252, 17, 88, 124, 170, 9, 161, 224, 232, 173, 34, 156, 126, 187,
+    169, 161, 103, 225, 130, 72, 229, 247, 26, 191, 162, 37, 247, 171, 240, 145, 110, 195, 189, 200, 241, 186, 226, 202,
+    218, 72, 72, 34, 110, 241, 70, 58, 132, 107, 10, 185, 27, 38, 68, 62, 99, 11, 153, 18, 78, 178, 16, 120,
+    90, 19, 135, 224, 199, 97, 242, 213, 49, 129, 178, 71, 153, 8, 214, 26, 65, 44, 39, 100, 200, 200, 124, 243,
+    48, 16, 65, 157, 150, 136, 206, 31, 81, 87, 35, 120, 240, 140, 11, 122, 88, 118, 212, 181, 118, 29, 238, 68,
+    212, 19, 67, 39, 106, 86, 220, 200, 167, 225, 34, 194, 174, 70, 75, 92, 251, 164, 65, 149, 177, 106, 84, 192,
+    72, 41, 61, 186, 0, 232, 252, 17, 88, 124, 170, 9, 174, 128, 246, 161, 87, 89, 27, 58, 181, 117, 31, 130,
+    43, 15, 149, 65, 52, 21, 168, 196, 156, 170, 71, 11, 87, 8, 63, 93, 209, 90, 132, 173, 136, 154, 130, 104,
+    83, 138, 185, 28, 25, 174, 163, 5, 44, 173, 160, 86, 167, 8, 24, 174, 151, 240, 241, 119, 123, 7, 204, 101,
+    116, 141, 85, 180, 23, 125, 76, 142, 22, 174, 56, 56, 199, 239, 242, 118, 161, 132, 225, 167, 176, 239, 114, 38,
+    160, 154, 194, 233, 122, 145, 115, 4, 36, 17, 99, 43, 163, 27, 5, 96, 131, 210, 181, 38, 132, 77, 115, 131,
+    212, 37, 172, 173, 160, 167, 21, 114, 18, 10, 123, 164, 112, 113, 147, 234, 173, 160, 74, 213, 231, 107, 152, 61,
+    135, 119, 21, 114, 37, 247, 171, 245, 21, 114, 38, 160, 154, 19, 135, 216, 200, 208, 181, 99, 145, 103, 225, 184,
+    72, 183, 81, 117, 106, 86, 208, 37, 10, 185, 15, 189, 79, 149, 138, 144, 249, 138, 185, 25, 45, 115, 219, 160,
+    232, 248, 187, 234, 62, 207, 244, 250, 186, 0, 251, 245, 218, 185, 31, 23, 125, 71, 238, 31, 103, 250, 125, 93,
+    0, 232, 248, 187, 234, 62, 207, 244, 254, 61, 0, 251, 245, 218, 185, 31, 23, 125, 71, 238, 31, 103, 250, 127,
+    30, 128, 232, 248, 187, 234, 62, 207, 244, 250, 250, 0, 251, 245, 218, 185, 31, 23, 125, 71, 238, 31, 103, 250,
+    125, 125, 0, 232, 248, 187, 234, 62, 207, 244, 251, 58, 0, 251, 245, 218, 185, 31, 23, 125, 71, 238, 31, 103,
+    250, 125, 157, 0, 232, 248, 187, 234, 62, 207, 244, 254, 93, 0, 251, 245, 218, 185, 31, 23, 125, 71, 238, 31,
+    103, 250, 127, 46, 128, 232, 248, 187, 234, 62, 207, 244, 255, 78, 128, 251, 245, 218, 185, 31, 23, 125, 71, 238,
+    31, 103, 250, 127, 167, 64, 232, 248, 187, 234, 62, 207, 244, 254, 125, 0, 251, 245, 218, 185, 31, 23, 125, 71,
+    238, 31, 103, 250, 127, 62, 128, 232, 248, 187, 234, 62, 207, 244, 255, 94, 128, 251, 245, 218, 185, 31, 23, 125,
+    71, 238, 31, 103, 250, 127, 175, 64, 232, 248, 187, 234, 62, 207, 244, 255, 110, 128, 251, 245, 218, 185, 31, 23,
+    125, 71, 238, 31, 103, 250, 127, 183, 64, 232, 252, 17, 88, 124, 170, 9, 174, 128, 252, 17, 88, 124, 170, 9,
+    161, 147, 181, 43, 110, 100, 92, 193, 234, 42, 17, 165, 105, 93, 149, 180, 25, 195, 234, 42, 228, 120, 222, 107,
+    10, 218, 11, 63, 13, 79, 195, 10, 113, 250, 238, 166, 140, 6, 43, 165, 252, 60, 93, 222, 211, 216, 119, 185,
+    18, 182, 60, 38, 60, 200, 72, 35, 10, 198, 195, 133, 171, 138, 130, 100, 113, 119, 146, 48, 83, 209, 145, 27,
+    205, 96, 137, 124, 235, 28, 133, 97, 87, 35, 196, 19, 251, 30, 195, 187, 138, 185, 12, 241, 87, 234, 42, 228,
+    100, 181, 207, 186, 68, 249, 231, 10, 196, 44, 143, 75, 43, 227, 7, 168, 226, 235, 130, 41, 197, 92, 130, 147,
+    93, 66, 48, 63, 53, 161, 9, 174, 195, 5, 45, 35, 194, 101, 228, 59, 83, 138, 185, 26, 162, 176, 186, 233,
+    126, 19, 158, 221, 0, 232, 252, 17, 88, 124, 170, 9, 161, 247, 252, 214, 186, 0, 255, 15, 184, 205, 90, 195,
+    151, 222, 36, 227, 48, 148, 42, 228, 31, 154, 208, 132, 215, 97, 147, 179, 28, 169, 91, 65, 248, 34, 176, 249,
+    84, 19, 66, 156, 85, 200, 186, 233, 126, 19, 158, 195, 222, 145, 35, 83, 26, 16, 237, 78, 42, 228, 66, 107,
+    183, 80, 153, 100, 112, 97, 41, 91, 64, 146, 42, 231, 145, 254, 93, 88, 85, 200, 207, 15, 192, 124, 197, 66,
+    103, 154, 229, 216, 127, 127, 70, 46, 82, 194, 87, 70, 145, 179, 171, 80, 167, 225, 34, 194, 207, 195, 83, 240,
+    195, 242, 92, 174, 180, 130, 156, 85, 200, 103, 138, 184, 70, 176, 255, 131, 140, 62, 154, 15, 111, 69, 183, 34,
+    156, 85, 200, 41, 53, 216, 119, 185, 23, 223, 80, 249, 143, 70, 235, 150, 12, 133, 145, 147, 180, 210, 53, 117,
+    28, 154, 21, 115, 7, 221, 33, 4, 150, 146, 31, 48, 251, 22, 99, 50, 46, 96, 246, 232, 232, 251, 159, 125,
+    48, 146, 61, 189, 22, 220, 244, 251, 159, 125, 48, 146, 61, 189, 22, 220, 139, 152, 33, 100, 122, 95, 16, 141,
+    67, 133, 171, 132, 202, 151, 210, 215, 61, 135, 202, 160, 154, 24, 77, 118, 145, 194, 213, 195, 195, 37, 17, 99,
+    43, 163, 72, 194, 177, 21, 114, 37, 108, 120, 76, 121, 158, 161, 26, 195, 195, 239, 75, 250, 238, 68, 221, 246,
+    145, 101, 157, 176, 156, 140, 159, 15, 25, 239, 129, 194, 181, 159, 128, 145, 8, 218, 29, 75, 84, 246, 29, 220,
+    85, 200, 41, 53, 212, 85, 200, 79, 69, 183, 35, 5, 45, 35, 194, 101, 228, 83, 240, 145, 97, 87, 34, 229,
+    34, 131, 230, 44, 252, 53, 63, 13, 212, 113, 117, 193, 20, 226, 174, 71, 6, 107, 168, 90, 9, 182, 208, 233,
+    149, 204, 138, 185, 30, 209, 229, 26, 82, 71, 197, 125, 24, 237, 208, 232, 251, 159, 125, 48, 146, 61, 189, 22,
+    220, 244, 239, 117, 145, 53, 6, 178, 184, 124, 199, 220, 251, 233, 132, 145, 237, 232, 182, 228, 44, 143, 215, 117,
+    52, 99, 168, 225, 106, 227, 51, 193, 129, 177, 177, 154, 133, 70, 144, 141, 96, 131, 87, 130, 32, 225, 62, 102,
+    193, 43, 87, 157, 174, 96, 246, 31, 45, 83, 24, 25, 38, 102, 67, 231, 153, 128, 251, 213, 157, 224, 73, 74,
+    86, 211, 168, 226, 230, 8, 217, 42, 29, 164, 74, 236, 50, 124, 243, 36, 35, 88, 112, 149, 149, 197, 92, 142,
+    30, 49, 97, 163, 143, 28, 246, 29, 220, 85, 200, 224, 205, 117, 28, 190, 227, 36, 97, 36, 138, 185, 9, 25,
+    92, 200, 124, 194, 15, 16, 182, 208, 140, 161, 230, 85, 180, 21, 114, 33, 125, 24, 237, 208, 232, 252, 50, 254,
+    197, 24, 125, 175, 190, 15, 164, 139, 116, 246, 161, 87, 33, 90, 140, 73, 202, 149, 216, 62, 99, 238, 125, 244,
+    194, 72, 246, 244, 91, 114, 17, 172, 63, 12, 191, 177, 70, 31, 107, 239, 131, 233, 34, 221, 69, 92, 140, 150,
+    185, 26, 147, 82, 42, 228, 66, 250, 49, 156, 59, 87, 97, 248, 101, 253, 138, 48, 251, 95, 124, 31, 73, 22,
+    17, 187, 72, 103, 138, 184, 70, 176, 151, 222, 174, 19, 14, 218, 10, 185, 5, 38, 135, 132, 111, 33, 243, 21,
+    114, 61, 163, 202, 52, 164, 143, 138, 250, 49, 216, 119, 113, 87, 33, 158, 42, 253, 68, 47, 163, 25, 195, 181,
+    13, 146, 60, 200, 124, 243, 48, 52, 130, 88, 78, 201, 145, 144, 141, 97, 194, 99, 202, 182, 131, 100, 171, 207,
+    97, 221, 197, 92, 137, 125, 234, 253, 69, 92, 143, 15, 190, 15, 164, 139, 12, 157, 169, 91, 115, 34, 159, 132,
+    139, 8, 50, 182, 45, 74, 152, 9, 5, 39, 183, 64, 232, 252, 50, 254, 197, 24, 125, 175, 190, 15, 164, 139,
+    116, 252, 50, 254, 197, 24, 125, 175, 190, 15, 164, 139, 11, 152, 33, 243, 204, 196, 137, 200, 178, 228, 61, 41,
+    226, 67, 230, 42, 228, 123, 71, 148, 105, 73, 31, 21, 244, 99, 176, 255, 211, 233, 161, 137, 8, 214, 25, 115,
+    150, 22, 106, 68, 221, 32, 138, 185, 27, 37, 95, 132, 230, 122, 132, 107, 10, 185, 18, 251, 181, 164, 62, 98,
+    174, 70, 75, 92, 132, 130, 37, 243, 162, 198, 195, 199, 34, 174, 70, 120, 126, 21, 180, 28, 37, 24, 236, 59,
+    220, 136, 95, 70, 4, 236, 145, 231, 6, 70, 237, 99, 2, 174, 68, 238, 221, 66, 53, 131, 229, 146, 74, 187,
+    38, 7, 135, 74, 145, 146, 48, 240, 68, 146, 194, 208, 185, 210, 182, 129, 48, 237, 167, 110, 128, 232, 252, 50,
+    254, 197, 24, 125, 175, 190, 15, 164, 139, 116, 254, 155, 197, 92, 192, 151, 222, 174, 29, 135, 225, 151, 246, 40,
+    195, 237, 125, 240, 125, 36, 91, 168, 171, 145, 59, 196, 62, 237, 101, 109, 36, 120, 57, 62, 164, 106, 240, 69,
+    66, 55, 235, 186, 227, 176, 239, 114, 55, 143, 8, 195, 8, 214, 156, 147, 98, 52, 95, 70, 71, 9, 200, 167,
+    26, 188, 16, 201, 91, 194, 96, 78, 69, 140, 115, 216, 123, 9, 213, 49, 129, 178, 152, 7, 231, 69, 173, 33,
+    90, 156, 85, 200, 133, 244, 99, 168, 226, 230, 8, 216, 190, 216, 35, 53, 155, 135, 129, 43, 174, 216, 228, 22,
+    255, 47, 200, 171, 145, 38, 11, 45, 115, 216, 119, 185, 30, 31, 124, 31, 73, 22, 25, 59, 82, 182, 230, 67,
+    60, 85, 199, 132, 203, 200, 167, 225, 34, 194, 174, 70, 75, 92, 251, 164, 37, 84, 38, 84, 174, 211, 219, 160,
+    232, 247, 150, 168, 76, 15, 111, 69, 183, 61, 0, 247, 150, 168, 76, 15, 111, 69, 183, 34, 12, 239, 169, 145,
+    115, 7, 168, 202, 30, 101, 91, 64, 254, 140, 15, 195, 47, 236, 81, 135, 218, 251, 224, 250, 72, 176, 244, 168,
+    16, 77, 111, 22, 228, 120, 133, 182, 135, 176, 239, 114, 60, 66, 219, 66, 31, 60, 204, 72, 217, 25, 225, 53,
+    92, 135, 165, 60, 72, 124, 197, 92, 136, 95, 70, 2, 53, 133, 92, 140, 150, 185, 19, 231, 156, 43, 30, 195,
+    187, 138, 185, 5, 38, 186, 143, 121, 106, 132, 192, 246, 244, 91, 114, 48, 82, 210, 60, 38, 94, 66, 181, 56,
+    171, 145, 188, 120, 70, 25, 60, 30, 195, 187, 138, 185, 28, 25, 174, 161, 104, 100, 237, 74, 219, 153, 10, 212,
+    227, 245, 221, 77, 24, 16, 101, 108, 90, 149, 48, 24, 174, 151, 240, 241, 119, 123, 79, 110, 128, 232, 248, 46,
+    151, 225, 57, 31, 199, 235, 254, 93, 0, 255, 15, 184, 72, 33, 40, 85, 200, 118, 253, 240, 154, 236, 41, 199,
+    193, 116, 191, 9, 200, 254, 63, 95, 242, 234, 56, 186, 229, 113, 135, 125, 164, 36, 62, 237, 97, 87, 35, 131,
+    52, 97, 129, 182, 132, 62, 99, 242, 92, 174, 180, 157, 135, 119, 21, 114, 25, 226, 175, 212, 85, 200, 186, 233,
+    126, 19, 145, 130, 150, 145, 79, 194, 69, 132, 234, 152, 193, 129, 79, 195, 72, 194, 249, 35, 239, 198, 39, 135,
+    138, 191, 81, 194, 213, 193, 249, 236, 141, 43, 232, 140, 212, 226, 210, 17, 172, 31, 98, 194, 124, 169, 144, 152,
+    118, 208, 85, 200, 225, 57, 236, 59, 220, 137, 125, 218, 193, 243, 21, 9, 158, 107, 144, 89, 8, 38, 138, 91,
+    145, 104, 118, 61, 66, 53, 133, 92, 142, 21, 172, 50, 72, 133, 50, 42, 228, 78, 69, 168, 62, 98, 174, 67,
+    236, 88, 67, 165, 187, 116, 232, 248, 46, 151, 225, 57, 31, 199, 235, 254, 93, 0, 248, 20, 178, 182, 130, 95,
+    122, 184, 118, 31, 5, 210, 252, 39, 35, 248, 253, 127, 203, 168, 171, 145, 146, 215, 51, 146, 108, 71, 131, 162,
+    180, 138, 113, 7, 247, 157, 76, 104, 123, 15, 181, 113, 143, 14, 145, 105, 9, 111, 70, 41, 100, 141, 246, 201,
+    245, 86, 208, 31, 154, 212, 132, 107, 12, 62, 73, 129, 227, 121, 86, 51, 38, 123, 14, 247, 35, 8, 198, 66,
+    65, 19, 171, 189, 92, 35, 88, 112, 113, 143, 223, 170, 43, 82, 43, 27, 117, 9, 140, 63, 10, 218, 12, 222,
+    2, 12, 159, 92, 222, 41, 60, 96, 139, 66, 250, 61, 135, 123, 145, 117, 210, 252, 39, 35, 45, 227, 209, 145,
+    161, 106, 199, 61, 70, 111, 140, 63, 10, 218, 10, 185, 12, 149, 188, 38, 6, 78, 212, 251, 196, 135, 204, 85,
+    200, 194, 53, 187, 116, 232, 248, 46, 151, 225, 57, 31, 199, 235, 254, 93, 0, 246, 219, 104, 116, 202, 234, 218,
+    10, 185, 18, 251, 213, 204, 48, 86, 163, 25, 93, 27, 67, 212, 124, 23, 75, 240, 156, 143, 227, 245, 255, 32,
+    249, 230, 98, 65, 249, 173, 72, 167, 225, 34, 195, 254, 14, 48, 250, 104, 61, 189, 22, 220, 132, 107, 10, 185,
+    26, 162, 176, 72, 163, 10, 100, 62, 99, 242, 92, 174, 180, 157, 135, 123, 145, 80, 153, 230, 185, 5, 108, 160,
+    164, 153, 9, 35, 151, 220, 49, 72, 21, 114, 50, 90, 231, 168, 225, 106, 227, 209, 186, 229, 131, 35, 83, 26,
+    43, 104, 17, 172, 44, 190, 140, 104, 173, 160, 194, 249, 34, 174, 70, 120, 126, 3, 230, 16, 66, 250, 49, 216,
+    127, 127, 70, 46, 82, 221, 68, 174, 141, 35, 77, 214, 196, 90, 23, 209, 137, 20, 226, 174, 86, 5, 140, 210,
+    178, 82, 187, 79, 110, 128, 232, 251, 142, 201, 21, 188, 25, 232, 255, 15, 184, 154, 59, 5, 106, 113, 87, 35,
+    238, 59, 36, 86, 240, 100, 93, 49, 128, 249, 143, 201, 114, 186, 210, 15, 234, 212, 97, 146, 149, 216, 123, 44,
+    108, 241, 93, 135, 123, 144, 144, 80, 44, 131, 243, 217, 26, 87, 209, 234, 56, 90, 184, 186, 233, 113, 145, 92,
+    43, 105, 33, 26, 195, 9, 26, 17, 194, 181, 159, 137, 21, 116, 161, 131, 65, 88, 38, 187, 96, 134, 74, 222,
+    19, 3, 11, 165, 235, 176, 251, 151, 69, 164, 192, 178, 206, 216, 78, 100, 77, 223, 129, 158, 23, 75, 208, 86,
+    205, 227, 84, 165, 118, 234, 17, 172, 42, 19, 209, 193, 137, 24, 86, 35, 125, 130, 80, 165, 203, 201, 161, 147,
+    238, 212, 98, 123, 14, 247, 33, 43, 87, 157, 174, 96, 133, 144, 131, 85, 249, 135, 204, 31, 158, 75, 71, 82,
+    212, 17, 172, 55, 141, 11, 101, 207, 110, 128, 232, 246, 136, 95, 73, 137, 232, 239, 114, 61, 162, 23, 210, 98,
+    69, 211, 24, 11, 33, 6, 216, 76, 136, 124, 196, 29, 217, 93, 164, 35, 88, 112, 113, 147, 234, 103, 176, 254,
+    137, 170, 225, 76, 132, 107, 12, 225, 75, 90, 71, 8, 180, 10, 104, 99, 28, 134, 41, 2, 174, 71, 132, 211,
+    68, 208, 140, 176, 139, 175, 81, 57, 35, 50, 182, 130, 174, 70, 80, 252, 88, 102, 240, 51, 77, 87, 10, 144,
+    51, 76, 140, 246, 31, 219, 125, 52, 77, 8, 201, 33, 247, 147, 137, 23, 223, 80, 146, 60, 38, 146, 60, 29,
+    21, 133, 56, 77, 182, 41, 29, 135, 176, 177, 201, 225, 41, 125, 16, 173, 52, 152, 194, 82, 187, 127, 231, 253,
+    127, 218, 12, 38, 187, 8, 50, 117, 241, 133, 109, 2, 11, 239, 170, 48, 205, 116, 222, 15, 254, 127, 215, 253,
+    228, 149, 149, 204, 142, 95, 120, 7, 147, 212, 37, 172, 173, 160, 70, 9, 20, 179, 75, 144, 167, 223, 43, 138,
+    113, 87, 34, 118, 76, 143, 110, 128, 232, 254, 173, 155, 198, 169, 74, 236, 62, 70, 61, 46, 70, 122, 0, 246,
+    96, 173, 155, 198, 169, 74, 236, 44, 103, 200, 154, 70, 180, 139, 152, 61, 68, 210, 103, 153, 176, 241, 200, 65,
+    156, 41, 107, 99, 145, 7, 35, 181, 43, 178, 205, 14, 46, 227, 14, 254, 100, 20, 208, 192, 167, 9, 50, 179,
+    93, 135, 219, 15, 149, 247, 131, 33, 26, 195, 84, 218, 66, 65, 12, 82, 177, 200, 72, 132, 109, 13, 131, 176,
+    171, 145, 147, 238, 212, 99, 176, 239, 114, 39, 34, 212, 31, 49, 156, 25, 184, 207, 15, 193, 137, 25, 195, 234,
+    16, 49, 72, 241, 200, 244, 146, 66, 90, 210, 16, 112, 113, 147, 234, 173, 160, 167, 223, 43, 246, 29, 238, 66,
+    65, 64, 178, 44, 101, 116, 99, 97, 78, 53, 79, 36, 84, 39, 163, 131, 18, 51, 39, 1, 40, 20, 147, 219,
+    160, 232, 254, 219, 233, 162, 104, 71, 191, 8, 186, 244, 255, 15, 184, 72, 133, 244, 66, 80, 171, 145, 141, 244,
+    209, 52, 35, 44, 34, 234, 18, 10, 117, 28, 92, 193, 27, 36, 201, 109, 12, 72, 225, 22, 134, 111, 2, 174,
+    86, 7, 132, 210, 123, 14, 247, 34, 118, 76, 136, 89, 25, 238, 217, 82, 187, 38, 7, 38, 134, 79, 174, 111,
+    20, 158, 48, 122, 142, 22, 174, 36, 165, 43, 104, 18, 10, 72, 70, 176, 178, 232, 180, 152, 22, 89, 219, 9,
+    204, 137, 187, 240, 173, 160, 207, 11, 165, 232, 77, 37, 111, 38, 123, 15, 97, 187, 47, 235, 185, 9, 20, 54,
+    83, 145, 255, 207, 250, 255, 180, 24, 77, 118, 19, 116, 216, 216, 110, 217, 35, 50, 227, 145, 133, 242, 66, 11,
+    239, 170, 48, 240, 246, 231, 255, 63, 235, 254, 210, 214, 144, 173, 80, 186, 110, 69, 56, 171, 144, 245, 115, 28,
+    44, 145, 189, 46, 22, 146, 21, 24, 78, 201, 145, 237, 208, 232, 249, 28, 183, 133, 174, 71, 190, 231, 47, 59,
+    58, 181, 116, 239, 114, 36, 229, 188, 45, 114, 50, 185, 203, 206, 206, 173, 65, 100, 37, 202, 91, 168, 225, 106,
+    227, 8, 198, 69, 140, 174, 140, 148, 108, 51, 120, 22, 92, 243, 48, 90, 133, 66, 122, 56, 48, 38, 146, 183,
+    147, 61, 135, 127, 151, 176, 77, 11, 84, 132, 170, 58, 237, 66, 156, 28, 243, 92, 148, 181, 99, 145, 166, 235,
+    98, 54, 73, 146, 218, 24, 145, 87, 135, 223, 75, 138, 185, 27, 67, 228, 102, 123, 15, 180, 221, 90, 194, 174,
+    70, 87, 57, 121, 217, 213, 171, 168, 65, 132, 141, 8, 178, 206, 216, 78, 68, 229, 4, 176, 146, 117, 145, 78,
+    60, 17, 170, 99, 61, 219, 42, 87, 101, 109, 58, 137, 173, 242, 242, 21, 130, 12, 59, 236, 31, 49, 7, 195,
+    189, 43, 105, 216, 119, 186, 200, 146, 117, 145, 78, 60, 17, 146, 111, 42, 218, 4, 22, 56, 78, 66, 176, 202,
+    231, 47, 33, 91, 168, 73, 21, 114, 48, 172, 66, 109, 177, 72, 145, 78, 60, 17, 164, 63, 10, 218, 12, 59,
+    104, 96, 112, 181, 119, 222, 134, 175, 233, 91, 78, 221, 0, 252, 224, 248, 119, 175, 208, 123, 11, 44, 237, 132,
+    228, 120, 55, 86, 176, 171, 145, 39, 45, 225, 107, 145, 149, 206, 94, 118, 117, 106, 12, 77, 164, 83, 143, 4,
+    65, 240, 239, 70, 221, 190, 159, 163, 243, 194, 177, 253, 7, 254, 157, 88, 85, 200, 147, 150, 240, 181, 200, 194,
+    177, 237, 244, 253, 29, 0, 254, 142, 246, 30, 247, 222, 43, 160, 239, 114, 51, 119, 176, 201, 247, 138, 11, 33,
+    6, 23, 209, 199, 33, 32, 160, 205, 113, 131, 97, 194, 213, 197, 92, 132, 135, 213, 3, 230, 61, 36, 43, 239,
+    35, 45, 214, 85, 140, 255, 231, 253, 127, 222, 112, 102, 248, 228, 120, 79, 38, 195, 101, 253, 191, 100, 234, 37,
+    127, 111, 219, 10, 218, 15, 27, 198, 134, 39, 168, 70, 176, 72, 125, 82, 151, 33, 147, 231, 153, 61, 135, 120,
+    79, 71, 6, 36, 65, 194, 124, 194, 80, 164, 241, 131, 61, 65, 111, 242, 252, 171, 104, 53, 41, 137, 30, 14,
+    111, 4, 85, 202, 192, 207, 11, 165, 234, 123, 15, 102, 30, 203, 27, 60, 80, 254, 189, 197, 28, 174, 203, 146,
+    163, 9, 90, 144, 148, 16, 100, 240, 198, 5, 39, 140, 30, 162, 87, 109, 149, 180, 25, 62, 121, 146, 17, 172,
+    48, 239, 229, 91, 65, 87, 125, 244, 189, 103, 190, 49, 200, 74, 8, 41, 60, 96, 215, 110, 128, 252, 233, 49,
+    231, 244, 30, 204, 61, 150, 54, 120, 161, 253, 123, 138, 57, 93, 151, 37, 70, 11, 34, 233, 233, 91, 64, 131,
+    39, 207, 50, 123, 125, 63, 71, 231, 104, 95, 71, 244, 30, 195, 255, 127, 47, 180, 90, 23, 209, 11, 34, 86,
+    169, 91, 64, 236, 42, 228, 82, 120, 193, 250, 126, 142, 128, 238, 99, 85, 100, 192, 247, 244, 238, 99, 85, 100,
+    192, 247, 133, 145, 226, 23, 75, 208, 70, 176, 157, 147, 37, 125, 231, 168, 225, 106, 227, 60, 59, 199, 239, 167,
+    253, 249, 21, 194, 182, 131, 133, 107, 63, 18, 31, 60, 204, 43, 104, 61, 41, 226, 67, 230, 54, 194, 49, 145,
+    73, 243, 85, 109, 3, 176, 171, 145, 27, 183, 9, 207, 97, 242, 41, 74, 218, 4, 130, 146, 18, 8, 63, 174,
+    235, 182, 198, 195, 133, 171, 140, 174, 145, 162, 182, 130, 105, 41, 93, 167, 176, 252, 82, 100, 182, 134, 36, 112,
+    139, 67, 100, 165, 45, 88, 231, 168, 151, 212, 130, 218, 67, 204, 155, 5, 97, 225, 223, 204, 135, 129, 99, 233,
+    114, 51, 216, 127, 127, 70, 46, 82, 193, 25, 159, 118, 200, 234, 90, 164, 109, 15, 233, 108, 70, 120, 93, 47,
+    67, 125, 172, 148, 103, 183, 64, 232, 238, 99, 85, 100, 192, 251, 186, 0, 255, 15, 184, 225, 49, 228, 43, 83,
+    142, 230, 53, 86, 76, 15, 187, 168, 226, 230, 8, 209, 40, 200, 72, 35, 198, 243, 88, 86, 208, 112, 181, 112,
+    153, 82, 250, 90, 231, 176, 246, 30, 85, 231, 200, 98, 145, 227, 145, 36, 235, 34, 156, 120, 35, 84, 198, 123,
+    182, 84, 174, 202, 218, 117, 11, 82, 39, 40, 37, 134, 120, 92, 188, 152, 86, 208, 36, 133, 160, 149, 71, 93,
+    170, 69, 56, 131, 225, 222, 132, 29, 138, 81, 182, 57, 236, 63, 20, 153, 45, 161, 137, 26, 97, 27, 34, 18,
+    130, 208, 240, 115, 120, 35, 87, 244, 173, 160, 118, 236, 59, 220, 132, 130, 129, 100, 102, 184, 193, 176, 225, 106,
+    226, 174, 68, 190, 237, 105, 15, 152, 135, 198, 21, 180, 19, 186, 214, 73, 38, 66, 53, 133, 150, 105, 26, 134,
+    78, 222, 140, 74, 82, 187, 79, 110, 128, 252, 224, 248, 119, 175, 208, 123, 15, 42, 243, 228, 126, 62, 240, 178,
+    32, 248, 119, 165, 109, 6, 78, 211, 72, 213, 142, 123, 125, 63, 71, 64, 238, 99, 85, 100, 192, 251, 250, 0,
+    238, 99, 85, 100, 192, 251, 194, 200, 253, 119, 83, 70, 58, 137, 49, 233, 91, 65, 153, 224, 192, 207, 11, 165,
+    234, 66, 80, 171, 172, 138, 93, 79, 97, 239, 125, 115, 120, 164, 241, 130, 36, 165, 43, 104, 18, 10, 72, 86,
+    244, 180, 70, 201, 50, 91, 67, 18, 41, 196, 28, 39, 207, 176, 254, 201, 26, 16, 145, 92, 60, 121, 145, 99,
+    178, 229, 74, 218, 15, 248, 70, 148, 145, 132, 107, 78, 73, 177, 144, 150, 120, 97, 87, 35, 132, 198, 39, 176,
+    239, 114, 40, 198, 170, 201, 128, 126, 116, 90, 210, 41, 197, 92, 137, 125, 234, 253, 70, 10, 89, 91, 65, 79,
+    194, 69, 130, 90, 203, 74, 236, 152, 26, 37, 25, 8, 214, 25, 166, 75, 133, 165, 51, 219, 160, 232, 238, 99,
+    85, 100, 192, 254, 157, 0, 246, 161, 220, 198, 170, 201, 129, 253, 58, 138, 185, 9, 90, 188, 237, 115, 4, 44,
+    140, 147, 26, 246, 30, 195, 51, 192, 168, 79, 71, 6, 36, 36, 17, 37, 40, 219, 168, 225, 22, 149, 180, 25,
+    188, 15, 14, 145, 101, 109, 2, 51, 62, 237, 145, 212, 181, 79, 97, 222, 228, 97, 116, 189, 43, 104, 22, 68,
+    190, 117, 212, 101, 5, 41, 91, 64, 130, 14, 19, 230, 173, 160, 45, 233, 97, 219, 82, 213, 216, 119, 113, 87,
+    34, 95, 122, 191, 80, 130, 203, 57, 65, 52, 44, 239, 3, 9, 224, 224, 216, 123, 189, 183, 171, 188, 47, 236,
+    108, 63, 19, 18, 236, 199, 3, 251, 182, 57, 247, 13, 151, 245, 220, 200, 229, 247, 129, 150, 240, 175, 43, 92,
+    246, 232, 232, 255, 210, 50, 211, 199, 186, 71, 191, 15, 38, 186, 0, 255, 15, 184, 205, 90, 195, 151, 222, 36,
+    227, 48, 172, 16, 78, 169, 140, 15, 242, 140, 180, 241, 238, 145, 150, 30, 77, 117, 25, 99, 122, 163, 6, 195,
+    133, 171, 140, 176, 81, 149, 180, 19, 190, 219, 97, 76, 132, 107, 3, 250, 238, 187, 106, 90, 187, 15, 97, 38,
+    131, 230, 60, 158, 100, 93, 36, 120, 37, 134, 14, 116, 29, 130, 12, 177, 189, 81, 131, 97, 99, 62, 122, 141,
+    140, 93, 54, 145, 155, 198, 143, 84, 88, 43, 11, 164, 209, 236, 62, 211, 117, 107, 10, 185, 22, 119, 142, 163,
+    151, 220, 51, 210, 228, 66, 15, 199, 222, 14, 171, 84, 173, 160, 65, 47, 157, 13, 48, 252, 117, 19, 91, 229,
+    228, 43, 4, 30, 29, 232, 97, 223, 96, 236, 16, 120, 198, 228, 78, 80, 75, 127, 231, 253, 127, 218, 9, 92,
+    22, 161, 146, 99, 3, 55, 128, 147, 43, 52, 141, 145, 237, 208, 252, 252, 158, 127, 65, 236, 36, 208, 124, 199,
+    147, 204, 142, 12, 17, 131, 157, 7, 97, 87, 34, 198, 124, 246, 250, 126, 143, 206, 15, 135, 122, 253, 7, 176,
+    252, 125, 226, 86, 164, 120, 55, 86, 176, 171, 145, 103, 120, 234, 42, 228, 78, 80, 75, 9, 173, 242, 242, 21,
+    130, 15, 14, 244, 48, 239, 183, 111, 167, 232, 232, 238, 99, 85, 100, 192, 251, 122, 0, 238, 99, 85, 100, 192,
+    251, 66, 200, 194, 250, 56, 231, 168, 225, 106, 226, 79, 163, 9, 129, 158, 23, 75, 212, 143, 14, 145, 101, 109,
+    4, 187, 183, 97, 236, 48, 145, 161, 22, 93, 22, 147, 2, 87, 70, 77, 8, 178, 206, 216, 78, 66, 200, 206,
+    31, 246, 45, 212, 77, 111, 151, 144, 172, 16, 120, 119, 161, 135, 125, 130, 53, 134, 104, 184, 86, 208, 83, 141,
+    161, 253, 45, 136, 202, 55, 201, 83, 3, 60, 46, 151, 160, 173, 155, 198, 169, 74, 237, 216, 123, 44, 108, 241,
+    66, 105, 51, 204, 73, 58, 141, 217, 56, 72, 33, 243, 21, 114, 22, 103, 114, 18, 69, 92, 242, 18, 168, 181,
+    133, 56, 217, 38, 75, 104, 98, 123, 116, 252, 224, 248, 119, 175, 208, 123, 11, 46, 139, 73, 129, 43, 163, 38,
+    132, 126, 62, 240, 178, 38, 183, 203, 200, 86, 8, 60, 59, 208, 195, 190, 221, 190, 159, 163, 160, 238, 99, 85,
+    100, 192, 246, 232, 238, 99, 85, 100, 192, 246, 11, 33, 216, 135, 204, 85, 200, 69, 141, 158, 43, 221, 35, 84,
+    86, 23, 223, 196, 246, 31, 43, 190, 210, 17, 172, 60, 62, 244, 191, 174, 230, 70, 21, 136, 171, 145, 194, 99,
+    207, 9, 207, 80, 249, 230, 97, 91, 65, 132, 154, 253, 250, 171, 111, 68, 109, 188, 101, 116, 147, 34, 156, 84,
+    39, 163, 131, 19, 216, 119, 185, 19, 145, 106, 15, 152, 206, 12, 220, 100, 172, 201, 171, 176, 135, 198, 36, 103,
+    15, 168, 64, 197, 35, 199, 35, 194, 121, 49, 200, 89, 5, 169, 114, 86, 211, 176, 239, 114, 40, 198, 170, 201,
+    128, 126, 116, 90, 210, 37, 247, 171, 138, 126, 18, 44, 32, 205, 66, 229, 70, 193, 32, 164, 246, 232, 232, 238,
+    145, 170, 100, 62, 70, 61, 46, 70, 122, 0, 255, 15, 184, 72, 33, 40, 85, 200, 45, 80, 141, 145, 20, 226,
+    174, 69, 36, 106, 153, 9, 49, 233, 114, 50, 18, 10, 118, 31, 239, 15, 187, 88, 101, 7, 129, 232, 221, 114,
+    193, 144, 141, 96, 127, 93, 215, 109, 75, 80, 72, 35, 210, 202, 248, 193, 21, 120, 125, 244, 184, 194, 70, 132,
+    112, 173, 103, 226, 123, 15, 97, 114, 158, 185, 22, 119, 129, 132, 240, 112, 108, 61, 223, 242, 107, 135, 143, 35,
+    223, 135, 147, 94, 224, 178, 36, 229, 188, 27, 14, 22, 174, 17, 129, 193, 202, 161, 217, 114, 24, 124, 188, 246,
+    29, 238, 66, 65, 64, 178, 32, 205, 66, 229, 70, 221, 70, 165, 26, 131, 182, 57, 25, 188, 4, 222, 174, 240,
+    191, 177, 176, 216, 196, 187, 49, 199, 110, 128, 252, 247, 108, 62, 94, 127, 65, 255, 182, 195, 229, 228, 85, 200,
+    99, 92, 60, 121, 25, 97, 228, 208, 179, 188, 118, 250, 126, 142, 128, 255, 147, 92, 60, 121, 30, 252, 60, 154,
+    232, 254, 173, 43, 98, 42, 228, 49, 174, 30, 60, 140, 176, 242, 107, 168, 147, 30, 140, 72, 70, 176, 99, 92,
+    60, 121, 86, 208, 31, 215, 117, 219, 82, 212, 47, 190, 163, 245, 221, 77, 99, 158, 195, 222, 158, 48, 100, 36,
+    16, 197, 43, 28, 135, 141, 17, 151, 246, 54, 234, 17, 172, 21, 172, 185, 37, 60, 12, 46, 151, 169, 30, 48,
+    173, 228, 69, 249, 171, 234, 185, 38, 49, 207, 97, 255, 182, 177, 129, 87, 35, 195, 213, 62, 162, 110, 113, 159,
+    80, 131, 241, 247, 140, 146, 178, 185, 145, 203, 239, 1, 42, 139, 82, 187, 127, 231, 253, 127, 218, 212, 141, 93,
+    150, 158, 5, 150, 118, 194, 115, 33, 7, 140, 110, 68, 229, 4, 183, 80, 173, 101, 201, 41, 91, 64, 180, 24,
+    155, 72, 74, 162, 212, 174, 221, 186, 0, 252, 224, 248, 119, 175, 208, 123, 15, 199, 222, 22, 69, 111, 151, 147,
+    96, 156, 39, 35, 118, 177, 129, 87, 35, 195, 213, 62, 162, 110, 113, 159, 80, 129, 138, 71, 142, 70, 174, 203,
+    79, 2, 233, 33, 7, 140, 110, 68, 229, 4, 183, 111, 167, 232, 232, 255, 116, 145, 242, 164, 165, 118, 232, 255,
+    15, 184, 45, 70, 2, 9, 213, 49, 129, 162, 72, 154, 74, 87, 97, 147, 183, 162, 202, 91, 34, 38, 158, 15,
+    97, 222, 228, 100, 239, 128, 139, 3, 39, 107, 45, 43, 178, 182, 129, 100, 32, 224, 227, 39, 212, 136, 56, 83,
+    159, 97, 242, 185, 199, 163, 33, 32, 137, 167, 203, 201, 176, 225, 106, 226, 89, 50, 243, 61, 69, 161, 91, 204,
+    245, 8, 214, 26, 172, 228, 113, 132, 98, 251, 200, 168, 79, 71, 1, 104, 235, 61, 135, 176, 201, 240, 241, 158,
+    248, 22, 89, 219, 9, 200, 75, 122, 49, 75, 38, 69, 92, 140, 37, 25, 161, 135, 170, 49, 200, 255, 41, 151,
+    157, 158, 187, 14, 247, 35, 36, 155, 169, 129, 164, 19, 82, 57, 125, 199, 11, 87, 8, 25, 237, 219, 160, 252,
+    233, 114, 242, 107, 244, 31, 142, 241, 149, 210, 72, 65, 135, 170, 49, 200, 165, 203, 201, 174, 223, 79, 209, 249,
+    218, 21, 188, 254, 131, 253, 225, 60, 4, 96, 88, 198, 156, 139, 66, 183, 158, 223, 79, 209, 208, 239, 114, 61,
+    163, 36, 177, 232, 239, 114, 18, 50, 75, 16, 178, 16, 51, 205, 38, 52, 92, 133, 211, 209, 97, 154, 227, 6,
+    195, 133, 171, 140, 176, 147, 43, 144, 209, 53, 51, 216, 119, 185, 18, 251, 181, 164, 62, 99, 101, 111, 9, 140,
+    13, 83, 43, 171, 25, 234, 14, 14, 85, 14, 203, 144, 255, 42, 218, 96, 207, 80, 141, 96, 90, 175, 188, 170,
+    77, 46, 67, 108, 39, 38, 36, 102, 184, 192, 171, 144, 139, 29, 135, 219, 11, 165, 235, 28, 140, 159, 15, 6,
+    195, 11, 165, 234, 70, 120, 73, 184, 86, 17, 126, 106, 250, 142, 22, 174, 42, 228, 104, 154, 153, 237, 208, 232,
+    248, 175, 163, 3, 187, 240, 195, 237, 131, 193, 142, 122, 0, 255, 15, 184, 154, 59, 5, 106, 113, 241, 95, 70,
+    7, 119, 225, 135, 219, 7, 131, 28, 245, 8, 56, 72, 212, 35, 88, 43, 122, 90, 86, 208, 78, 201, 145, 28,
+    45, 92, 70, 243, 75, 144, 225, 222, 197, 133, 191, 249, 255, 246, 79, 29, 135, 123, 144, 144, 250, 160, 124, 199,
+    136, 60, 43, 104, 60, 19, 1, 26, 194, 83, 211, 199, 34, 203, 55, 50, 51, 92, 98, 69, 92, 132, 88, 236,
+    63, 20, 168, 118, 145, 43, 65, 40, 85, 200, 240, 144, 17, 172, 18, 31, 118, 176, 164, 241, 131, 61, 65, 109,
+    19, 67, 96, 172, 48, 190, 142, 57, 25, 59, 122, 49, 41, 74, 237, 61, 135, 246, 72, 208, 142, 21, 172, 252,
+    72, 124, 243, 48, 61, 41, 226, 67, 230, 42, 228, 66, 250, 49, 212, 22, 186, 54, 74, 218, 10, 185, 9, 175,
+    133, 70, 200, 246, 232, 232, 254, 137, 26, 152, 145, 248, 36, 121, 53, 208, 239, 114, 51, 72, 212, 196, 141, 82,
+    60, 154, 11, 33, 7, 141, 230, 176, 173, 160, 125, 139, 126, 244, 88, 30, 139, 110, 70, 107, 140, 27, 14, 22,
+    174, 38, 147, 24, 144, 249, 230, 97, 91, 65, 156, 25, 184, 218, 30, 219, 228, 122, 139, 163, 91, 84, 177, 25,
+    66, 103, 83, 212, 35, 88, 97, 242, 76, 11, 28, 46, 73, 146, 153, 236, 63, 252, 45, 103, 137, 5, 170, 251,
+    202, 164, 210, 228, 152, 199, 34, 110, 144, 66, 182, 111, 26, 165, 43, 176, 79, 15, 189, 10, 185, 88, 26, 59,
+    218, 123, 15, 97, 52, 152, 192, 125, 140, 37, 60, 12, 146, 178, 185, 145, 203, 239, 0, 242, 122, 138, 185, 228,
+    73, 58, 138, 113, 224, 132, 159, 42, 218, 13, 139, 237, 130, 51, 120, 25, 171, 35, 100, 169, 128, 150, 244, 185,
+    30, 221, 0, 252, 246, 77, 118, 190, 13, 126, 131, 251, 231, 153, 128, 131, 100, 215, 107, 224, 208, 167, 21, 114,
+    38, 147, 24, 15, 177, 132, 167, 142, 223, 79, 209, 208, 248, 61, 28, 116, 255, 15, 184, 45, 70, 2, 13, 94,
+    198, 24, 93, 232, 224, 97, 252, 120, 228, 102, 184, 193, 176, 225, 106, 225, 146, 183, 132, 192, 194, 233, 122, 8,
+    214, 25, 59, 81, 215, 103, 132, 142, 70, 123, 195, 44, 221, 91, 73, 236, 61, 133, 151, 69, 164, 192, 149, 209,
+    130, 51, 62, 237, 145, 145, 238, 254, 255, 183, 200, 228, 63, 143, 240, 254, 63, 103, 95, 112, 86, 178, 228, 148,
+    173, 160, 65, 151, 62, 12, 73, 203, 120, 90, 228, 100, 237, 153, 130, 217, 16, 178, 41, 60, 171, 104, 54, 194,
+    100, 123, 15, 198, 31, 51, 50, 174, 201, 137, 28, 45, 92, 120, 75, 104, 100, 35, 88, 97, 27, 148, 139, 72,
+    213, 253, 16, 158, 31, 122, 234, 11, 104, 154, 43, 104, 21, 133, 150, 114, 222, 101, 93, 167, 176, 239, 114, 18,
+    181, 121, 218, 230, 8, 89, 5, 140, 104, 105, 114, 8, 214, 25, 188, 112, 145, 111, 223, 135, 127, 42, 218, 118,
+    232, 252, 229, 116, 111, 208, 127, 127, 219, 228, 114, 31, 199, 248, 127, 31, 179, 233, 250, 63, 63, 5, 50, 118,
+    253, 7, 200, 208, 229, 247, 129, 224, 166, 78, 194, 156, 85, 214, 70, 31, 36, 165, 118, 237, 208, 252, 146, 140,
+    15, 123, 246, 31, 19, 145, 218, 149, 219, 160, 239, 114, 32, 228, 118, 165, 118, 9, 5, 3, 230, 42, 228, 126,
+    73, 70, 7, 189, 245, 217, 27, 145, 240, 255, 254, 11, 34, 112, 79, 144, 141, 97, 180, 62, 102, 101, 93, 147,
+    29, 135, 176, 194, 70, 132, 39, 235, 186, 66, 239, 168, 240, 110, 173, 97, 87, 34, 14, 71, 106, 87, 101, 154,
+    247, 72, 177, 159, 33, 45, 105, 8, 50, 76, 106, 173, 160, 218, 12, 150, 200, 245, 25, 174, 48, 108, 56, 90,
+    184, 201, 240, 241, 158, 248, 25, 172, 223, 176, 239, 114, 32, 228, 118, 165, 118, 89, 160, 155, 108, 82, 36, 100,
+    237, 145, 134, 54, 234, 54, 49, 116, 218, 71, 8, 180, 173, 160, 205, 224, 46, 187, 60, 82, 53, 6, 60, 72,
+    120, 22, 41, 133, 109, 7, 11, 87, 8, 193, 102, 119, 61, 186, 0, 252, 233, 49, 231, 244, 30, 194, 14, 71,
+    106, 87, 101, 154, 24, 119, 243, 35, 39, 108, 140, 49, 183, 111, 167, 232, 232, 248, 38, 49, 194, 115, 208, 246,
+    31, 174, 234, 104, 93, 49, 142, 19, 145, 53, 6, 178, 185, 145, 224, 230, 240, 71, 47, 191, 80, 184, 198, 250,
+    171, 37, 27, 15, 28, 137, 124, 232, 97, 116, 189, 43, 105, 216, 127, 72, 77, 77, 134, 215, 122, 125, 33, 54,
+    188, 135, 204, 97, 242, 76, 14, 18, 140, 9, 125, 227, 35, 33, 26, 195, 39, 105, 49, 233, 41, 93, 129, 207,
+    55, 138, 145, 133, 98, 42, 228, 112, 152, 196, 246, 29, 238, 69, 211, 24, 225, 57, 24, 41, 105, 20, 227, 210,
+    66, 190, 242, 44, 118, 72, 173, 75, 84, 142, 22, 174, 172, 42, 228, 100, 250, 236, 141, 207, 80, 83, 43, 139,
+    27, 46, 73, 70, 194, 156, 22, 157, 225, 91, 65, 87, 35, 37, 174, 125, 210, 56, 74, 48, 63, 93, 211, 11,
+    92, 246, 232, 232, 254, 189, 199, 247, 207, 53, 200, 244, 239, 114, 63, 175, 112, 249, 230, 185, 16, 178, 51, 92,
+    96, 216, 112, 181, 113, 99, 62, 100, 101, 141, 234, 140, 27, 14, 22, 174, 53, 118, 90, 120, 158, 163, 201, 231,
+    195, 164, 90, 122, 132, 107, 9, 165, 203, 207, 33, 158, 140, 246, 29, 238, 71, 245, 238, 63, 4, 100, 208, 192,
+    149, 169, 9, 65, 7, 15, 30, 102, 146, 149, 219, 168, 195, 191, 149, 109, 7, 15, 16, 166, 193, 36, 92, 138,
+    231, 99, 35, 61, 225, 95, 121, 199, 61, 135, 200, 199, 163, 18, 60, 97, 91, 200, 86, 8, 50, 120, 99, 29,
+    66, 53, 131, 26, 225, 227, 200, 178, 166, 144, 154, 200, 201, 253, 24, 8, 56, 186, 209, 240, 233, 22, 236, 59,
+    220, 132, 88, 11, 34, 174, 185, 121, 28, 45, 92, 85, 200, 190, 250, 135, 204, 31, 215, 117, 219, 82, 213, 219,
+    160, 252, 233, 49, 231, 244, 29, 238, 71, 245, 238, 63, 4, 100, 208, 192, 195, 191, 153, 28, 60, 66, 155, 118,
+    250, 126, 142, 128, 252, 146, 140, 15, 123, 246, 31, 108, 20, 243, 14, 250, 244, 239, 114, 60, 65, 79, 48, 239,
+    168, 89, 25, 63, 237, 207, 80, 249, 230, 97, 91, 64, 130, 12, 236, 180, 70, 111, 0, 235, 182, 31, 146, 103,
+    176, 246, 25, 62, 121, 146, 53, 76, 174, 172, 70, 155, 198, 152, 50, 18, 66, 208, 241, 7, 137, 8, 51, 131,
+    55, 27, 61, 118, 30, 247, 215, 55, 138, 79, 24, 35, 43, 162, 196, 132, 107, 4, 18, 249, 160, 86, 244, 180,
+    68, 28, 39, 205, 41, 93, 187, 15, 97, 227, 124, 96, 210, 176, 240, 233, 22, 22, 89, 219, 9, 204, 140, 159,
+    93, 145, 185, 8, 204, 251, 182, 71, 82, 213, 33, 26, 195, 39, 215, 93, 217, 107, 144, 125, 22, 169, 237, 208,
+    252, 242, 124, 243, 39, 244, 31, 239, 9, 224, 32, 203, 125, 131, 230, 50, 124, 243, 39, 183, 211, 244, 116, 251,
+    146, 144, 123, 203, 81, 142, 128, 255, 15, 184, 45, 70, 5, 92, 139, 37, 32, 200, 181, 24, 234, 16, 73, 203,
+    120, 34, 29, 245, 25, 174, 48, 108, 56, 90, 184, 132, 203, 204, 135, 204, 73, 143, 70, 36, 35, 88, 77, 60,
+    38, 132, 88, 250, 92, 140, 246, 29, 238, 66, 44, 5, 145, 147, 190, 58, 141, 81, 90, 145, 88, 216, 120, 228,
+    67, 248, 222, 104, 101, 133, 213, 40, 140, 157, 170, 31, 2, 121, 154, 58, 207, 97, 236, 41, 54, 35, 194, 101,
+    231, 125, 133, 161, 125, 17, 43, 82, 31, 98, 221, 71, 8, 180, 173, 160, 205, 224, 32, 164, 216, 138, 113, 224,
+    140, 58, 88, 219, 176, 239, 114, 63, 93, 212, 208, 226, 235, 1, 243, 25, 163, 72, 221, 172, 98, 114, 120, 50,
+    42, 228, 46, 187, 60, 82, 54, 68, 62, 98, 174, 178, 33, 223, 94, 221, 0, 252, 240, 233, 111, 208, 127, 103,
+    75, 4, 20, 155, 16, 173, 78, 42, 228, 120, 76, 188, 239, 176, 180, 47, 163, 219, 233, 250, 58, 0, 251, 81,
+    188, 143, 236, 254, 60, 115, 208, 239, 114, 60, 35, 121, 24, 127, 30, 57, 11, 32, 224, 232, 141, 93, 71, 11,
+    87, 26, 164, 120, 193, 25, 225, 222, 36, 35, 88, 93, 116, 184, 200, 174, 21, 180, 158, 195, 223, 188, 211, 234,
+    98, 70, 175, 232, 132, 240, 251, 215, 80, 149, 69, 172, 173, 160, 167, 21, 114, 176, 51, 86, 70, 201, 83, 1,
+    137, 180, 246, 30, 195, 72, 70, 176, 202, 232, 214, 56, 83, 2, 232, 218, 72, 127, 70, 46, 82, 221, 70, 73,
+    52, 173, 160, 65, 194, 70, 163, 76, 63, 29, 135, 123, 144, 149, 171, 206, 215, 48, 71, 132, 194, 54, 70, 70,
+    208, 249, 153, 149, 118, 76, 44, 234, 56, 90, 184, 65, 193, 198, 79, 170, 182, 131, 50, 113, 219, 160, 232, 249,
+    38, 100, 125, 199, 103, 149, 161, 246, 191, 204, 207, 64, 239, 117, 145, 39, 45, 224, 136, 119, 212, 93, 247, 147,
+    34, 31, 137, 15, 152, 148, 204, 139, 29, 158, 86, 135, 135, 249, 153, 236, 59, 220, 132, 88, 11, 34, 251, 205,
+    205, 186, 131, 174, 215, 73, 95, 217, 91, 65, 87, 35, 39, 108, 214, 197, 169, 83, 11, 92, 135, 204, 85, 200,
+    157, 147, 35, 216, 123, 15, 8, 222, 67, 231, 154, 228, 96, 77, 35, 90, 71, 142, 69, 56, 73, 149, 154, 25,
+    111, 52, 250, 152, 144, 153, 100, 102, 85, 180, 21, 114, 176, 61, 38, 55, 79, 24, 51, 216, 119, 185, 26, 154,
+    76, 97, 114, 19, 114, 88, 62, 98, 174, 71, 135, 249, 153, 16, 115, 193, 202, 164, 85, 200, 151, 206, 134, 23,
+    75, 210, 182, 157, 186, 0, 252, 223, 98, 223, 160, 254, 251, 22, 8, 37, 51, 34, 199, 103, 149, 161, 225, 254,
+    125, 190, 159, 163, 160, 238, 113, 131, 3, 251, 43, 30, 128, 239, 114, 40, 227, 6, 6, 21, 136, 89, 19, 73,
+    158, 102, 195, 199, 35, 56, 82, 214, 199, 35, 104, 124, 204, 202, 187, 38, 36, 65, 75, 114, 41, 194, 76, 172,
+    208, 225, 106, 226, 161, 26, 83, 42, 87, 105, 236, 61, 251, 205, 62, 166, 36, 112, 139, 67, 100, 165, 45, 88,
+    228, 43, 12, 43, 30, 161, 26, 194, 174, 69, 28, 96, 196, 131, 158, 107, 146, 150, 172, 114, 46, 141, 108, 16,
+    83, 43, 136, 63, 174, 230, 107, 176, 239, 114, 39, 34, 212, 31, 49, 156, 25, 184, 217, 54, 48, 17, 172, 21,
+    188, 133, 144, 207, 75, 145, 79, 24, 34, 230, 15, 110, 128, 252, 233, 49, 231, 244, 31, 45, 138, 121, 20, 225,
+    5, 28, 96, 199, 111, 167, 232, 232, 254, 206, 140, 63, 190, 121, 174, 71, 160, 239, 114, 48, 232, 193, 243, 205,
+    114, 33, 100, 32, 253, 119, 83, 66, 118, 76, 136, 177, 149, 209, 141, 134, 111, 1, 91, 247, 216, 237, 87, 25,
+    59, 78, 248, 164, 165, 118, 158, 195, 237, 135, 202, 251, 193, 145, 147, 235, 178, 66, 182, 131, 14, 140, 54, 135,
+    182, 249, 84, 132, 130, 24, 165, 99, 144, 145, 8, 218, 27, 7, 96, 130, 147, 198, 15, 80, 173, 233, 105, 91,
+    65, 203, 238, 41, 198, 10, 67, 13, 94, 15, 97, 236, 51, 86, 70, 201, 83, 1, 45, 233, 101, 224, 44, 132,
+    244, 139, 132, 241, 130, 41, 197, 150, 114, 222, 100, 62, 212, 174, 210, 17, 172, 17, 167, 131, 3, 245, 220, 205,
+    43, 180, 246, 232, 252, 246, 77, 118, 190, 13, 126, 131, 216, 108, 154, 237, 124, 26, 25, 62, 187, 36, 43, 104,
+    48, 232, 195, 104, 123, 111, 149, 72, 89, 30, 14, 154, 43, 104, 41, 199, 130, 41, 60, 150, 237, 244, 253, 29,
+    0, 248, 187, 234, 63, 151, 213, 252, 58, 0, 251, 245, 218, 185, 31, 23, 125, 71, 238, 31, 203, 234, 254, 29,
+    0, 232, 248, 187, 234, 63, 151, 213, 245, 116, 251, 245, 218, 185, 31, 23, 125, 71, 238, 31, 203, 234, 250, 186,
+    0, 232, 248, 187, 234, 63, 151, 213, 252, 122, 0, 251, 245, 218, 185, 31, 23, 125, 71, 238, 31, 203, 234, 254,
+    61, 0, 232, 248, 187, 234, 63, 151, 213, 245, 244, 251, 245, 218, 185, 31, 23, 125, 71, 238, 31, 203, 234, 250,
+    250, 0, 232, 248, 187, 234, 63, 151, 213, 246, 116, 251, 245, 218, 185, 31, 23, 125, 71, 238, 31, 203, 234, 251,
+    58, 0, 232, 248, 187, 234, 63, 151, 213, 252, 186, 0, 251, 245, 218, 185, 31, 23, 125, 71, 238, 31, 203, 234,
+    254, 93, 0, 232, 248, 187, 234, 63, 151, 213, 254, 157, 0, 251, 245, 218, 185, 31, 23, 125, 71, 238, 31, 203,
+    234, 255, 78, 128, 232, 248, 187, 234, 63, 151, 213, 252, 250, 0, 251, 245, 218, 185, 31, 23, 125, 71, 238, 31,
+    203, 234, 254, 125, 0, 232, 248, 187, 234, 63, 151, 213, 254, 189, 0, 251, 245, 218, 185, 31, 23, 125, 71, 238,
+    31, 203, 234, 255, 94, 128, 232, 248, 187, 234, 63, 151, 213, 254, 221, 0, 251, 245, 218, 185, 31, 23, 125, 71,
+    238, 31, 203, 234, 255, 110, 128, 232, 248, 187, 234, 63, 151, 241, 254, 29, 0, 251, 245, 218, 185, 31, 23, 125,
+    71, 238, 31, 203, 248, 255, 14, 128, 232,
+};
+
+constexpr char roomWords[] =
+    "flag" "\0"
+    "e" "\0"
+    "unlock" "\0"
+    "w" "\0"
+    "s" "\0"
+    "key" "\0"
+    "button" "\0"
+    "talk" "\0"
+    "n" "\0"
+    "paper" "\0"
+    "load" "\0"
+    "filter" "\0"
+    "tire" "\0"
+    "cheese" "\0"
+    "bus" "\0"
+    "drive" "\0"
+    "donuts" "\0"
+    "analyze" "\0"
+    "pi" "\0"
+    "poster" "\0"
+    "coupon" "\0"
+    "beacon" "\0"
+    "sign" "\0"
+    "leaflet" "\0"
+    "billboard" "\0"
+    "rose" "\0"
+    "coffee" "\0"
+    "letter" "\0"
+    "plant" "\0"
+    "ladder" "\0"
+    "climb" "\0"
+    "shutdown" "\0"
+    "unplug" "\0"
+    "pickup" "\0"
+    "playball" "\0"
+    "throwdiscs" "\0"
+    "lunch" "\0"
+    "insert" "\0"
+    "keycard" "\0"
+    "checkin" "\0"
+    "soda" "\0"
+    "pobox" "\0"
+    "check" "\0"
+    "restore" "\0"
+    "alert" "\0"
+    "taxi" "\0"
+    "painting" "\0"
+    "ticket" "\0"
+    "leg" "\0"
+    "flipper" "\0"
+    "replay" "\0"
+    "clone" "\0"
+    "drink" "\0"
+    "play" "\0"
+    "reboot" "\0"
+    "line" "\0"
+    "pamphlet" "\0"
+    "open" "\0";
+
+constexpr uint16_t roomLists[] = {
+    2, 0, 5, 2, 1, 3, 7, 14, 16, 12, 0, 2, 5, 18, 22, 29,
+    34, 5, 3, 1, 3, 3, 36, 29, 14, 4, 2, 1, 34, 1, 11, 4,
+    29, 42, 5, 16, 10, 12, 10, 2, 5, 14, 6, 13, 11, 3, 5, 14,
+    16, 14, 15, 12, 14, 2, 47, 34, 1, 13, 3, 34, 5, 14, 7, 17,
+    16, 13, 2, 54, 14, 4, 15, 2, 34, 16, 9, 18, 15, 4, 34, 5,
+    14, 16, 15, 21, 19, 20, 17, 2, 29, 14, 4, 18, 2, 59, 5, 2,
+    18, 2, 66, 16, 8, 18, 2, 5, 14, 6, 21, 62, 2, 5, 14, 6,
+    61, 63, 2, 5, 14, 6, 62, 64, 3, 5, 14, 16, 14, 63, 78, 65,
+    3, 34, 14, 16, 13, 64, 79, 66, 2, 34, 16, 9, 65, 67, 2, 34,
+    16, 9, 66, 68, 2, 34, 16, 9, 67, 69, 2, 34, 16, 9, 68, 70,
+    2, 34, 14, 5, 69, 71, 2, 5, 14, 6, 70, 72, 4, 34, 5, 14,
+    16, 15, 73, 71, 422, 100, 2, 34, 16, 9, 74, 72, 3, 34, 5, 16,
+    11, 75, 99, 73, 2, 34, 16, 9, 76, 74, 2, 34, 16, 9, 77, 75,
+    3, 5, 14, 16, 14, 78, 252, 76, 2, 5, 14, 6, 64, 77, 3, 70,
+    5, 14, 6, 65, 80, 3, 34, 5, 14, 7, 81, 79, 82, 3, 76, 83,
+    16, 8, 80, 2, 5, 14, 6, 80, 83, 3, 34, 5, 16, 11, 88, 82,
+    84, 3, 34, 5, 16, 11, 83, 87, 85, 2, 34, 14, 5, 84, 86, 2,
+    70, 5, 2, 85, 2, 76, 14, 4, 84, 3, 34, 14, 16, 13, 91, 89,
+    83, 2, 70, 5, 2, 88, 2, 70, 5, 2, 91, 3, 34, 14, 16, 13,
+    92, 90, 88, 3, 34, 5, 16, 11, 93, 94, 91, 2, 91, 16, 8, 92,
+    2, 70, 14, 4, 92, 1, 34, 1, 97, 1, 14, 4, 97, 4, 34, 5,
+    14, 16, 15, 98, 96, 99, 95, 2, 91, 16, 8, 97, 2, 5, 14, 6,
+    97, 74, 4, 94, 34, 5, 16, 11, 72, 101, 141, 2, 5, 14, 6, 102,
+    100, 4, 34, 5, 14, 16, 15, 103, 109, 101, 104, 3, 101, 108, 16, 8,
+    102, 3, 34, 14, 16, 13, 102, 107, 105, 3, 34, 14, 16, 13, 104, 108,
+    106, 1, 34, 1, 105, 1, 5, 2, 104, 1, 5, 2, 105, 3, 5, 14,
+    16, 14, 112, 102, 110, 2, 34, 16, 9, 109, 111, 1, 34, 1, 110, 3,
+    5, 14, 16, 14, 113, 109, 116, 2, 5, 14, 6, 114, 112, 2, 5, 14,
+    6, 115, 113, 2, 14, 16, 12, 114, 126, 3, 34, 5, 16, 11, 112, 118,
+    117, 4, 34, 5, 14, 16, 15, 116, 119, 120, 121, 2, 29, 14, 4, 116,
+    1, 14, 4, 117, 1, 5, 2, 117, 3, 34, 5, 14, 7, 117, 125, 122,
+    3, 115, 5, 14, 6, 121, 123, 2, 5, 14, 6, 122, 124, 1, 14, 4,
+    140, 1, 14, 4, 121, 2, 34, 16, 9, 115, 127, 4, 101, 115, 34, 16,
+    9, 126, 128, 3, 34, 14, 16, 13, 127, 129, 130, 2, 5, 16, 10, 128,
+    131, 4, 115, 34, 5, 14, 7, 128, 150, 131, 3, 34, 5, 14, 7, 129,
+    130, 132, 2, 5, 14, 6, 131, 133, 2, 5, 14, 6, 132, 134, 3, 34,
+    5, 14, 7, 135, 133, 136, 1, 16, 8, 134, 2, 5, 14, 6, 134, 137,
+    4, 120, 34, 5, 14, 7, 138, 136, 426, 2, 34, 16, 9, 139, 137, 2,
+    34, 16, 9, 140, 138, 3, 34, 5, 16, 11, 141, 124, 139, 2, 34, 16,
+    9, 100, 140, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 4, 128, 14, 34, 16, 13, 130, 130, 151, 2, 34, 16, 9,
+    150, 152, 3, 34, 14, 16, 13, 151, 153, 154, 2, 138, 5, 2, 152, 3,
+    34, 5, 16, 11, 152, 155, 156, 1, 14, 4, 154, 3, 34, 5, 16, 11,
+    154, 157, 158, 3, 108, 143, 14, 4, 156, 4, 34, 5, 14, 16, 15, 156,
+    189, 159, 162, 3, 5, 14, 16, 14, 158, 160, 161, 1, 5, 2, 159, 3,
+    29, 150, 34, 1, 159, 3, 34, 5, 16, 11, 158, 163, 164, 1, 14, 4,
+    162, 3, 34, 5, 16, 11, 162, 165, 166, 1, 14, 4, 164, 2, 34, 16,
+    9, 164, 167, 3, 34, 5, 16, 11, 166, 175, 168, 2, 34, 16, 9, 167,
+    169, 2, 34, 16, 9, 168, 170, 4, 29, 34, 5, 14, 7, 169, 171, 172,
+    2, 29, 14, 4, 170, 2, 5, 16, 10, 170, 173, 3, 34, 5, 14, 7,
+    172, 174, 196, 2, 70, 14, 4, 173, 2, 5, 14, 6, 176, 167, 2, 5,
+    14, 6, 177, 175, 3, 34, 5, 14, 7, 179, 178, 176, 3, 70, 157, 14,
+    4, 177, 2, 34, 16, 9, 180, 177, 4, 34, 5, 14, 16, 15, 182, 181,
+    190, 179, 1, 14, 4, 180, 2, 34, 16, 9, 183, 180, 3, 34, 14, 16,
+    13, 186, 184, 182, 2, 5, 16, 10, 183, 185, 1, 34, 1, 184, 2, 14,
+    16, 12, 187, 183, 3, 34, 5, 14, 7, 188, 186, 189, 1, 16, 8, 187,
+    2, 5, 14, 6, 187, 158, 2, 5, 14, 6, 180, 191, 3, 5, 14, 16,
+    14, 190, 194, 192, 3, 34, 5, 14, 7, 191, 193, 199, 2, 29, 14, 4,
+    192, 3, 34, 5, 14, 7, 195, 191, 197, 2, 163, 16, 8, 194, 1, 5,
+    2, 173, 2, 5, 16, 10, 194, 198, 2, 170, 34, 1, 197, 3, 176, 185,
+    5, 2, 192, 3, 34, 14, 16, 13, 201, 211, 427, 2, 34, 16, 9, 202,
+    200, 2, 34, 16, 9, 203, 201, 2, 34, 16, 9, 204, 202, 2, 14, 16,
+    12, 205, 203, 2, 5, 14, 6, 204, 206, 4, 192, 34, 5, 14, 7, 214,
+    205, 207, 2, 5, 16, 10, 206, 208, 2, 34, 16, 9, 207, 209, 2, 34,
+    5, 3, 208, 210, 2, 5, 14, 6, 211, 209, 3, 34, 5, 14, 7, 213,
+    200, 210, 2, 5, 14, 6, 200, 211, 3, 199, 208, 16, 8, 211, 2, 34,
+    16, 9, 215, 206, 3, 34, 5, 16, 11, 216, 217, 214, 2, 29, 16, 8,
+    215, 2, 5, 14, 6, 218, 215, 2, 34, 14, 5, 219, 217, 3, 34, 5,
+    16, 11, 220, 240, 218, 3, 34, 14, 16, 13, 223, 221, 219, 4, 219, 29,
+    5, 14, 6, 220, 222, 2, 225, 5, 2, 221, 3, 34, 5, 16, 11, 226,
+    224, 220, 2, 5, 14, 6, 225, 223, 2, 192, 14, 4, 224, 3, 34, 14,
+    16, 13, 230, 227, 223, 2, 5, 14, 6, 226, 228, 2, 5, 14, 6, 227,
+    229, 2, 192, 5, 2, 228, 3, 34, 5, 16, 11, 233, 231, 226, 2, 5,
+    14, 6, 232, 230, 1, 14, 4, 231, 3, 34, 14, 16, 13, 238, 234, 230,
+    2, 5, 14, 6, 233, 235, 2, 34, 5, 3, 236, 234, 2, 34, 16, 9,
+    237, 235, 2, 192, 16, 8, 236, 2, 5, 16, 10, 239, 233, 1, 14, 4,
+    238, 3, 192, 5, 14, 6, 241, 219, 2, 192, 14, 4, 240, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 34, 16,
+    9, 253, 478, 2, 5, 14, 6, 289, 301, 2, 5, 14, 6, 77, 288, 2,
+    34, 16, 9, 254, 250, 4, 34, 5, 14, 16, 15, 255, 274, 287, 253, 2,
+    34, 16, 9, 256, 254, 3, 34, 5, 16, 11, 258, 257, 255, 2, 232, 14,
+    4, 256, 3, 34, 5, 16, 11, 275, 259, 256, 2, 5, 14, 6, 260, 258,
+    3, 34, 14, 16, 13, 261, 259, 273, 2, 34, 16, 9, 262, 260, 3, 5,
+    14, 16, 14, 263, 277, 261, 2, 5, 14, 6, 264, 262, 3, 5, 14, 16,
+    14, 266, 263, 265, 3, 240, 34, 16, 9, 264, 291, 2, 5, 14, 6, 267,
+    264, 2, 14, 16, 12, 266, 268, 2, 34, 16, 9, 267, 269, 2, 34, 16,
+    9, 268, 270, 3, 34, 5, 14, 7, 269, 271, 272, 2, 248, 14, 4, 270,
+    2, 5, 14, 6, 270, 273, 3, 34, 5, 14, 7, 260, 272, 274, 2, 5,
+    14, 6, 273, 254, 3, 34, 14, 16, 13, 276, 282, 258, 3, 34, 5, 16,
+    11, 278, 277, 275, 2, 5, 14, 6, 262, 276, 3, 34, 14, 16, 13, 280,
+    279, 276, 2, 248, 5, 2, 278, 2, 34, 16, 9, 281, 278, 3, 5, 14,
+    16, 14, 288, 289, 280, 2, 5, 14, 6, 275, 283, 2, 5, 16, 10, 282,
+    284, 3, 34, 5, 16, 11, 283, 285, 286, 2, 253, 14, 4, 284, 2, 34,
+    5, 3, 284, 287, 2, 5, 14, 6, 254, 286, 2, 5, 14, 6, 252, 281,
+    2, 5, 14, 6, 281, 251, 1, 14, 4, 256, 4, 29, 34, 5, 14, 7,
+    265, 293, 295, 1, 14, 4, 291, 2, 14, 16, 12, 291, 294, 2, 29, 34,
+    1, 293, 2, 5, 16, 10, 291, 296, 3, 29, 34, 16, 9, 295, 297, 3,
+    259, 34, 5, 3, 296, 298, 3, 265, 34, 14, 5, 299, 297, 2, 185, 16,
+    8, 298, 2, 34, 16, 9, 302, 350, 2, 5, 14, 6, 251, 302, 5, 273,
+    279, 5, 14, 16, 14, 301, 303, 300, 3, 34, 5, 14, 7, 304, 302, 305,
+    3, 284, 34, 16, 9, 322, 303, 2, 5, 14, 6, 303, 306, 2, 34, 5,
+    3, 307, 305, 2, 34, 16, 9, 308, 306, 3, 34, 5, 16, 11, 309, 327,
+    307, 2, 34, 16, 9, 310, 308, 2, 34, 16, 9, 311, 309, 2, 34, 16,
+    9, 312, 310, 2, 5, 16, 10, 313, 311, 2, 5, 14, 6, 314, 312, 3,
+    5, 14, 16, 14, 315, 313, 339, 2, 5, 14, 6, 316, 314, 3, 5, 14,
+    16, 14, 317, 315, 318, 4, 279, 293, 34, 14, 5, 349, 316, 3, 34, 14,
+    16, 13, 316, 340, 319, 3, 34, 14, 16, 13, 318, 343, 320, 3, 34, 14,
+    16, 13, 319, 348, 321, 3, 34, 14, 16, 13, 320, 329, 322, 3, 34, 14,
+    16, 13, 321, 323, 304, 2, 5, 14, 6, 322, 324, 3, 34, 5, 14, 7,
+    325, 323, 326, 2, 29, 16, 8, 324, 2, 5, 14, 6, 324, 327, 4, 279,
+    34, 5, 14, 7, 328, 326, 308, 1, 16, 8, 327, 2, 5, 14, 6, 321,
+    330, 3, 5, 14, 16, 14, 329, 332, 331, 2, 29, 34, 1, 330, 3, 34,
+    5, 14, 7, 347, 330, 333, 2, 5, 14, 6, 332, 334, 2, 34, 5, 3,
+    335, 333, 2, 34, 16, 9, 336, 334, 3, 34, 5, 16, 11, 337, 346, 335,
+    2, 34, 16, 9, 339, 336, 0, 0, 3, 34, 5, 16, 11, 314, 341, 337,
+    3, 279, 300, 5, 2, 318, 2, 5, 14, 6, 342, 339, 3, 5, 14, 16,
+    14, 343, 341, 344, 2, 5, 14, 6, 319, 342, 2, 34, 16, 9, 342, 345,
+    4, 34, 5, 14, 16, 15, 344, 348, 346, 347, 2, 5, 14, 6, 345, 336,
+    2, 34, 16, 9, 345, 332, 2, 5, 14, 6, 320, 345, 2, 279, 16, 8,
+    317, 3, 304, 34, 16, 9, 300, 351, 3, 34, 14, 16, 13, 350, 352, 354,
+    2, 5, 14, 6, 351, 353, 2, 312, 5, 2, 352, 3, 34, 5, 16, 11,
+    351, 355, 358, 4, 319, 5, 14, 16, 14, 356, 354, 357, 2, 325, 14, 4,
+    355, 2, 331, 34, 1, 355, 2, 34, 16, 9, 354, 359, 4, 34, 5, 14,
+    16, 15, 358, 363, 360, 367, 2, 5, 14, 6, 359, 362, 1, 5, 2, 360,
+    1, 5, 2, 360, 2, 5, 14, 6, 364, 359, 3, 34, 5, 14, 7, 365,
+    366, 363, 2, 325, 16, 8, 364, 1, 14, 4, 364, 2, 34, 16, 9, 359,
+    368, 3, 34, 5, 14, 7, 367, 369, 371, 2, 304, 14, 4, 368, 2, 5,
+    14, 6, 400, 372, 3, 319, 5, 16, 10, 368, 372, 3, 312, 34, 5, 3,
+    371, 370, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 3, 34, 5, 14, 7, 480, 401, 369,
+    2, 5, 14, 6, 402, 400, 3, 5, 14, 16, 14, 418, 401, 403, 2, 34,
+    16, 9, 402, 404, 3, 34, 5, 16, 11, 403, 416, 405, 2, 34, 16, 9,
+    404, 406, 2, 34, 16, 9, 405, 407, 2, 34, 5, 3, 406, 408, 3, 5,
+    14, 16, 14, 409, 407, 481, 2, 5, 14, 6, 410, 408, 3, 5, 14, 16,
+    14, 411, 409, 482, 2, 34, 14, 5, 412, 410, 2, 34, 16, 9, 413, 411,
+    2, 14, 16, 12, 414, 412, 3, 5, 14, 16, 14, 413, 416, 417, 0, 0,
+    2, 5, 14, 6, 414, 404, 1, 34, 1, 414, 2, 5, 14, 6, 419, 402,
+    3, 5, 14, 16, 14, 420, 418, 471, 2, 5, 14, 6, 421, 419, 3, 34,
+    5, 14, 7, 423, 422, 420, 2, 5, 14, 6, 72, 421, 2, 34, 16, 9,
+    424, 421, 3, 34, 5, 16, 11, 425, 428, 423, 2, 34, 16, 9, 426, 424,
+    3, 34, 5, 16, 11, 427, 137, 425, 2, 34, 16, 9, 200, 426, 2, 34,
+    14, 5, 429, 424, 2, 14, 16, 12, 430, 428, 3, 5, 14, 16, 14, 429,
+    444, 431, 4, 34, 5, 14, 16, 15, 430, 498, 499, 432, 3, 34, 14, 16,
+    13, 431, 497, 433, 3, 34, 14, 16, 13, 432, 437, 435, 1, 16, 8, 444,
+    2, 34, 16, 9, 433, 436, 1, 34, 1, 435, 2, 5, 14, 6, 433, 438,
+    4, 34, 5, 14, 16, 15, 441, 437, 458, 439, 3, 34, 5, 16, 11, 438,
+    496, 440, 1, 34, 1, 439, 2, 34, 16, 9, 442, 438, 3, 34, 5, 16,
+    11, 443, 499, 441, 3, 5, 14, 16, 14, 444, 445, 442, 4, 34, 5, 14,
+    16, 15, 434, 430, 443, 499, 2, 5, 14, 6, 443, 446, 4, 34, 5, 14,
+    16, 15, 447, 445, 453, 455, 2, 34, 16, 9, 448, 446, 2, 14, 16, 12,
+    449, 447, 3, 5, 14, 16, 14, 448, 450, 504, 2, 5, 16, 10, 449, 451,
+    4, 34, 5, 14, 16, 15, 450, 452, 477, 475, 3, 34, 5, 14, 7, 501,
+    453, 451, 3, 5, 14, 16, 14, 446, 452, 454, 2, 34, 16, 9, 453, 472,
+    2, 34, 16, 9, 446, 456, 3, 34, 5, 16, 11, 455, 506, 457, 4, 34,
+    5, 14, 16, 15, 456, 458, 472, 459, 2, 5, 14, 6, 438, 457, 2, 34,
+    16, 9, 457, 460, 3, 34, 14, 16, 13, 459, 500, 470, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 34,
+    5, 3, 460, 471, 2, 34, 14, 5, 419, 470, 3, 34, 5, 14, 7, 454,
+    457, 473, 2, 5, 14, 6, 472, 474, 3, 34, 5, 16, 11, 475, 473, 476,
+    2, 34, 16, 9, 451, 474, 1, 34, 1, 474, 2, 5, 14, 6, 451, 478,
+    3, 34, 5, 16, 11, 250, 477, 479, 2, 34, 16, 9, 478, 480, 2, 34,
+    16, 9, 479, 400, 2, 34, 5, 3, 409, 482, 4, 34, 5, 14, 16, 15,
+    409, 484, 481, 483, 2, 34, 16, 9, 482, 485, 2, 14, 16, 12, 482, 486,
+    3, 336, 343, 34, 1, 483, 4, 70, 29, 34, 16, 9, 484, 487, 3, 34,
+    5, 14, 7, 486, 488, 492, 3, 336, 5, 14, 6, 489, 487, 2, 14, 16,
+    12, 488, 490, 2, 34, 16, 9, 489, 491, 3, 18, 336, 34, 1, 490, 3,
+    336, 5, 14, 6, 487, 493, 2, 5, 16, 10, 492, 494, 3, 7, 34, 5,
+    3, 493, 495, 2, 336, 14, 4, 494, 3, 293, 325, 14, 4, 439, 1, 5,
+    2, 432, 1, 14, 4, 431, 4, 348, 34, 5, 14, 7, 444, 431, 442, 3,
+    115, 108, 5, 2, 460, 3, 29, 34, 16, 9, 502, 452, 4, 34, 5, 14,
+    16, 15, 504, 503, 505, 501, 2, 29, 14, 4, 502, 3, 143, 34, 16, 9,
+    449, 502, 2, 42, 5, 2, 502, 4, 34, 5, 14, 16, 15, 507, 508, 456,
+    509, 2, 357, 16, 8, 506, 2, 29, 14, 4, 506, 2, 348, 34, 1, 506,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0,
+};
+
+constexpr uint16_t roomBreaks[] = {
+    2, 52, 103, 4, 99, 128, 223, 243, 4, 100, 192, 242, 325, 6, 22, 121,
+    217, 225, 323, 380, 5, 95, 193, 292, 386, 484, 5, 90, 190, 287, 388, 406,
+    5, 100, 197, 296, 396, 452, 4, 94, 192, 291, 369, 5, 99, 195, 296, 395,
+    424, 4, 99, 197, 295, 387, 4, 99, 198, 296, 381, 4, 99, 191, 287, 370,
+    4, 95, 187, 288, 366, 4, 99, 196, 290, 380, 5, 100, 199, 296, 396, 410,
+    5, 91, 190, 287, 386, 455, 5, 100, 193, 290, 384, 409, 4, 97, 198, 297,
+    306, 4, 98, 196, 288, 297, 3, 100, 195, 282, 3, 99, 195, 279, 3, 98,
+    188, 255, 3, 101, 201, 271, 3, 100, 200, 264, 3, 95, 181, 281, 3, 96,
+    195, 258, 3, 100, 195, 289, 3, 97, 197, 244, 3, 100, 198, 245, 3, 99,
+    199, 241, 3, 100, 195, 264, 3, 94, 191, 218, 3, 101, 197, 263, 3, 96,
+    196, 250, 4, 98, 194, 294, 347, 3, 101, 188, 280, 4, 99, 198, 298, 304,
+    3, 96, 194, 262, 3, 101, 202, 246, 3, 94, 188, 205, 3, 97, 198, 275,
+    3, 96, 195, 236, 3, 98, 195, 267, 3, 92, 189, 197, 3, 101, 202, 214,
+    3, 96, 194, 211, 3, 93, 188, 237, 3, 98, 197, 254, 3, 96, 193, 255,
+    3, 99, 197, 242, 3, 99, 194, 248, 3, 96, 197, 280, 3, 101, 198, 281,
+    3, 97, 193, 268, 4, 96, 197, 292, 313, 3, 98, 198, 283, 2, 100, 108,
+    5, 99, 194, 290, 383, 426, 4, 101, 200, 299, 306, 3, 98, 198, 255, 4,
+    100, 198, 295, 324, 3, 99, 200, 230, 4, 96, 193, 288, 301, 4, 97, 196,
+    290, 314, 4, 99, 199, 298, 328, 3, 98, 199, 236, 4, 98, 195, 288, 345,
+    3, 98, 197, 271, 2, 93, 118, 2, 98, 109, 2, 99, 124, 4, 101, 195,
+    292, 337, 2, 98, 155, 4, 101, 201, 295, 345, 3, 98, 197, 223, 3, 101,
+    202, 230, 3, 98, 198, 235, 1, 97, 3, 94, 194, 210, 2, 97, 197, 3,
+    101, 201, 222, 2, 100, 163, 2, 100, 124, 1, 85, 2, 101, 199, 1, 77,
+    1, 92, 1, 98, 1, 89, 3, 100, 198, 295, 2, 98, 195, 2, 96, 118,
+    2, 95, 191, 3, 96, 192, 230, 2, 94, 128, 2, 96, 116, 3, 97, 195,
+    219, 1, 16, 1, 16, 1, 16, 1, 16, 1, 16, 1, 16, 1, 16, 1,
+    16, 4, 101, 200, 297, 382, 4, 97, 197, 289, 300, 3, 95, 191, 285, 4,
+    99, 200, 299, 306, 4, 95, 192, 293, 322, 4, 95, 192, 293, 306, 4, 97,
+    198, 297, 328, 4, 96, 196, 295, 345, 4, 100, 198, 298, 386, 3, 100, 198,
+    296, 3, 94, 193, 268, 5, 96, 194, 292, 393, 399, 4, 98, 192, 285, 317,
+    4, 100, 199, 300, 345, 3, 99, 194, 291, 4, 100, 200, 299, 306, 3, 101,
+    200, 253, 4, 101, 193, 291, 341, 3, 99, 200, 252, 4, 97, 194, 292, 305,
+    4, 101, 200, 301, 340, 4, 96, 191, 285, 301, 3, 97, 195, 230, 3, 100,
+    199, 262, 4, 101, 202, 298, 320, 3, 92, 189, 273, 3, 101, 198, 231, 3,
+    101, 200, 263, 4, 101, 195, 291, 378, 3, 99, 198, 244, 3, 101, 199, 297,
+    3, 93, 185, 265, 3, 99, 197, 247, 3, 94, 192, 238, 3, 99, 199, 266,
+    3, 100, 200, 287, 3, 96, 191, 268, 3, 99, 194, 271, 4, 99, 200, 295,
+    328, 3, 98, 197, 232, 3, 94, 192, 285, 4, 98, 192, 282, 293, 3, 97,
+    197, 232, 3, 100, 201, 293, 3, 97, 191, 248, 4, 101, 200, 297, 302, 3,
+    99, 199, 276, 2, 97, 164, 3, 101, 197, 220, 4, 97, 191, 290, 385, 4,
+    94, 195, 291, 296, 2, 99, 111, 4, 97, 192, 288, 307, 3, 101, 202, 301,
+    4, 101, 202, 300, 318, 3, 96, 193, 267, 2, 99, 176, 3, 101, 200, 271,
+    3, 93, 189, 256, 3, 96, 196, 254, 3, 94, 187, 270, 3, 97, 196, 275,
+    1, 16, 4, 93, 186, 282, 289, 2, 100, 155, 5, 99, 197, 286, 383, 431,
+    3, 101, 197, 270, 4, 96, 193, 285, 294, 4, 96, 193, 285, 294, 4, 95,
+    195, 293, 369, 3, 98, 199, 287, 3, 92, 191, 265, 3, 96, 195, 210, 3,
+    95, 190, 272, 3, 98, 196, 257, 4, 99, 193, 289, 335, 4, 99, 193, 288,
+    315, 3, 98, 195, 273, 4, 98, 195, 292, 320, 5, 93, 193, 292, 390, 440,
+    4, 101, 188, 284, 322, 3, 100, 199, 251, 3, 100, 199, 251, 4, 101, 197,
+    294, 325, 4, 98, 197, 297, 318, 3, 93, 193, 290, 3, 93, 193, 290, 4,
+    93, 191, 289, 387, 4, 97, 194, 292, 316, 4, 96, 190, 290, 339, 4, 100,
+    201, 302, 373, 4, 100, 201, 301, 320, 1, 16, 1, 16, 1, 16, 1, 16,
+    1, 16, 1, 16, 1, 16, 1, 16, 4, 101, 202, 303, 354, 4, 99, 190,
+    289, 336, 4, 100, 199, 300, 325, 4, 96, 196, 297, 356, 4, 100, 201, 302,
+    316, 4, 93, 192, 290, 297, 2, 98, 134, 6, 90, 186, 287, 387, 485, 572,
+    3, 98, 199, 291, 3, 99, 200, 234, 4, 98, 197, 298, 312, 3, 100, 196,
+    279, 3, 100, 200, 281, 3, 99, 197, 246, 3, 100, 200, 261, 3, 101, 199,
+    289, 3, 96, 187, 264, 3, 96, 195, 244, 3, 101, 201, 253, 3, 99, 196,
+    261, 3, 95, 190, 255, 3, 95, 194, 290, 3, 92, 192, 231, 3, 99, 197,
+    252, 3, 98, 197, 250, 3, 89, 185, 263, 3, 93, 194, 265, 2, 100, 197,
+    3, 100, 198, 285, 3, 100, 200, 263, 3, 98, 195, 269, 3, 100, 201, 299,
+    3, 100, 197, 247, 3, 99, 200, 267, 3, 98, 192, 242, 3, 99, 200, 248,
+    3, 96, 191, 260, 3, 100, 201, 261, 3, 97, 195, 238, 3, 98, 191, 237,
+    3, 94, 192, 280, 3, 100, 199, 230, 3, 101, 195, 203, 3, 96, 180, 231,
+    3, 101, 202, 244, 3, 101, 199, 204, 3, 97, 190, 280, 3, 101, 202, 242,
+    3, 96, 187, 253, 3, 92, 190, 257, 5, 100, 200, 294, 395, 425, 4, 95,
+    195, 292, 364, 5, 100, 192, 292, 390, 416, 4, 99, 194, 286, 338, 4, 100,
+    196, 292, 378, 4, 97, 197, 297, 328, 4, 101, 200, 299, 343, 4, 96, 197,
+    295, 312, 4, 96, 195, 293, 341, 3, 92, 187, 265, 3, 93, 193, 284, 3,
+    95, 191, 283, 4, 95, 192, 290, 307, 4, 98, 197, 298, 333, 3, 95, 193,
+    257, 4, 99, 199, 293, 324, 3, 98, 196, 273, 4, 89, 190, 285, 351, 4,
+    95, 187, 283, 299, 3, 97, 196, 256, 3, 101, 201, 272, 3, 101, 193, 284,
+    4, 100, 199, 297, 317, 4, 91, 187, 287, 307, 4, 100, 191, 287, 308, 4,
+    98, 197, 295, 357, 3, 100, 198, 279, 3, 99, 194, 293, 3, 101, 201, 267,
+    3, 98, 196, 295, 4, 99, 200, 296, 310, 4, 100, 194, 292, 301, 3, 100,
+    201, 293, 4, 99, 199, 299, 318, 4, 96, 192, 289, 309, 3, 97, 191, 279,
+    3, 91, 192, 276, 4, 95, 185, 281, 343, 1, 15, 4, 100, 200, 294, 332,
+    5, 96, 196, 294, 395, 429, 4, 99, 198, 290, 347, 4, 99, 200, 292, 301,
+    3, 99, 197, 260, 3, 95, 192, 275, 4, 92, 189, 289, 303, 3, 97, 189,
+    229, 3, 97, 195, 270, 3, 101, 201, 236, 5, 97, 192, 286, 387, 393, 6,
+    100, 200, 294, 389, 489, 539, 5, 99, 195, 296, 391, 458, 5, 100, 200, 299,
+    398, 431, 5, 100, 198, 297, 396, 484, 5, 101, 197, 297, 395, 419, 5, 98,
+    196, 297, 394, 491, 4, 101, 202, 301, 369, 5, 98, 198, 296, 391, 428, 4,
+    101, 201, 299, 324, 4, 99, 197, 298, 395, 4, 97, 194, 292, 327, 3, 101,
+    200, 263, 3, 101, 201, 300, 4, 99, 193, 293, 334, 3, 101, 200, 267, 4,
+    100, 196, 296, 341, 3, 98, 195, 261, 3, 99, 194, 261, 3, 100, 199, 281,
+    5, 101, 202, 296, 393, 406, 9, 99, 194, 287, 382, 476, 570, 671, 770, 783,
+    4, 100, 197, 290, 389, 5, 100, 201, 300, 398, 402, 1, 15, 1, 15, 1,
+    15, 1, 15, 1, 15, 1, 15, 1, 15, 1, 15, 1, 15, 1, 15, 1,
+    15, 1, 15, 1, 15, 1, 15, 1, 15, 1, 15, 1, 15, 1, 15, 1,
+    15, 1, 15, 1, 15, 1, 15, 1, 15, 1, 15, 1, 15, 1, 15, 1,
+    15, 4, 100, 198, 290, 338, 4, 90, 190, 285, 383, 4, 97, 196, 289, 300,
+    4, 93, 194, 289, 325, 4, 101, 197, 293, 350, 4, 101, 200, 301, 325, 2,
+    97, 182, 4, 100, 192, 291, 333, 3, 98, 193, 224, 3, 97, 197, 270, 2,
+    97, 188, 4, 100, 198, 299, 366, 4, 95, 195, 296, 311, 4, 96, 191, 289,
+    310, 4, 96, 197, 298, 361, 3, 96, 195, 266, 4, 96, 197, 296, 316, 4,
+    100, 196, 296, 302, 4, 101, 200, 291, 377, 2, 98, 192, 3, 98, 194, 263,
+    3, 100, 197, 287, 3, 99, 194, 294, 3, 101, 199, 274, 3, 94, 194, 246,
+    4, 101, 195, 289, 320, 3, 99, 196, 264, 3, 98, 199, 286, 3, 100, 196,
+    281, 3, 100, 198, 276, 3, 100, 193, 245, 4, 95, 190, 288, 370, 3, 97,
+    195, 293, 4, 97, 196, 297, 361, 4, 97, 194, 292, 311, 3, 98, 197, 280,
+    3, 99, 197, 248, 3, 101, 199, 284, 4, 99, 194, 288, 302, 2, 99, 196,
+    3, 98, 194, 239, 4, 101, 200, 297, 308, 3, 100, 197, 235, 4, 100, 188,
+    286, 310, 3, 101, 200, 281, 3, 99, 197, 267, 4, 97, 195, 291, 296, 4,
+    97, 195, 291, 319, 3, 100, 201, 218, 2, 101, 189, 3, 97, 197, 250, 4,
+    98, 194, 294, 369, 4, 96, 194, 293, 335, 4, 86, 187, 284, 316, 4, 93,
+    189, 289, 346, 3, 92, 191, 275, 3, 99, 195, 263, 4, 96, 190, 291, 335,
+    4, 101, 197, 292, 302, 3, 99, 197, 254, 4, 92, 193, 292, 329, 1, 16,
+    1, 16, 1, 16, 1, 16, 1, 16, 1, 16, 1, 16, 1, 16, 1, 16,
+    3, 99, 197, 282, 4, 100, 199, 293, 307, 3, 99, 198, 273, 3, 97, 197,
+    251, 4, 98, 197, 298, 304, 3, 96, 197, 250, 3, 100, 200, 279, 3, 99,
+    198, 275, 3, 101, 199, 296, 3, 101, 199, 269, 3, 98, 199, 277, 4, 99,
+    188, 285, 293, 4, 98, 199, 299, 318, 3, 95, 196, 272, 4, 100, 195, 290,
+    296, 4, 100, 200, 301, 367, 4, 97, 191, 292, 301, 3, 101, 196, 273, 3,
+    93, 192, 292, 3, 92, 186, 255, 3, 88, 188, 246, 3, 101, 202, 296, 3,
+    101, 200, 242, 3, 93, 187, 248, 3, 100, 201, 257, 3, 91, 185, 263, 3,
+    96, 188, 261, 3, 91, 190, 205, 3, 100, 199, 284, 3, 100, 200, 278, 4,
+    97, 195, 289, 305, 3, 98, 195, 266, 3, 96, 192, 264, 3, 96, 197, 277,
+    3, 96, 190, 225, 3, 99, 199, 281, 3, 100, 194, 241, 3, 87, 178, 248,
+    3, 98, 196, 223, 3, 95, 187, 237, 1, 16, 1, 16, 1, 16, 1, 16,
+    1, 16, 1, 16, 1, 16, 1, 16, 1, 16, 1, 16, 1, 16,
+};
+
+#endif
\ No newline at end of file
@@ -1,15 +1,18 @@
+#ifndef Rooms_hpp
+#define Rooms_hpp
+#include <Arduino.h>
 
-#define MAX_ROOM_OPTIONS 6
 #define MAX_ROOM_NEIGHBORS 4
+#define ROOM_NONE 0xFFFF // Slot of a room id without a room
 
-struct Room
+// Packed room, generated into roomdata.hpp by tools/rooms.py from content/rooms.json
+struct RoomRecord
 {
-    const int id;
-    const char *title;
-    const char *description;
-    const char *actions;
-    const char *options[MAX_ROOM_OPTIONS];
-    int neighbors[MAX_ROOM_NEIGHBORS];
+    uint32_t text;        // Offset in roomText of the coded title, the description and actions follow it
+    uint16_t description; // Offset of the description from the title
+    uint16_t actions;     // Offset of the actions from the title
+    uint16_t lists;       // Offset in roomLists of the option count, options, neighbour mask and neighbours
+    uint16_t breaks;      // Offset in roomBreaks of the description's line breaks at ROOM_WRAP_WIDTH
 };
 
 #pragma region Room Ids
@@ -30,526 +33,39 @@ struct Room
 #define WEST 2
 #define SOUTH 3
 
-// Room definitions
-const Room rooms[] = {
-    {0, "The Vault", "A glittering golden vault full of jewels and gold!\n\nThere is some kind of pennant here on the ground...", "[flag] Inspect the pennant.\n", {"flag", "e"}, {-1, 1, -1, -1}},
-    {1, "The Grand Lobby", "This is a large round lobby, with a skylight in the center. A receptionist looks very uninterested and completely ignores you.\n\nThere's a large circular metal vault door to the west, and the doorway to the south leads to a bright outdoor area.", "[unlock] Attempt to unlock the vault door.\n", {"unlock", "w", "s"}, {-1, -1, 0, 2}},
-    {2, "The Great Outdoors", "You enter a beautiful clearing, with the sun shining down in rays on the calm and peaceful grasses.\nYou are surrounded by many trees, and a doorway is to the north in the side of a mountain.\n\nThere's a blue button embedded in a nearby tree.\n\nThere's also a man standing here, he has a name tag that says 'Hi, my name is Bob.'", "[key] There's a battered red keycard on the ground.\n[button] Press the blue button.\n[talk] Talk to Bob\n", {"key", "button", "talk", "n", "e"}, {1, 3, -1, -1}},
-    {3, "The Training Tent", "Welcome to the game!\n\nThis is the tutorial for the text based adventure game. If you are familiar with text based games, or want to figure it out on your own, just talk to the janitor and let him know you're ready to leave.\n\nIf you want to get a brief tutorial, and get familiar with some of the commands available, take a look at the piece of paper on the desk by typing 'paper'.", "[paper] Read the paper sitting on the desk.\n[talk] Talk to the janitor that is slowly sweeping some dust out of the tent.\n", {"paper", "talk", "w"}, {-1, -1, 2, -1}},
-    {4, "", "", "", {}, {}},
-    {5, "", "", "", {}, {}},
-    {6, "", "", "", {}, {}},
-    {7, "", "", "", {}, {}},
-    {8, "", "", "", {}, {}},
-    {9, "", "", "", {}, {}},
-    {10, "Back of Bus 2048", "You wake up in the back of Bus 2048. The lights are dimmed, casting long shadows over the worn fabric of the seats. The hum of the engine is absent, leaving an eerie silence. The air is tinged with the faint scent of gasoline and old upholstery. Peering out the window, you notice the bus is parked in a dimly lit underground garage. Concrete pillars stand like silent guardians in the shadows. Up front, the bus driver is gathering his belongings, seemingly unaware of your presence.", "", {"n"}, {11, -1, -1, -1}},
-    {11, "Bus 2048", "You make your way toward the front of the bus. The driver, a middle-aged man with a weary expression, looks up, startled to see you. 'Didn't realize anyone was still on board,' he says with a hint of surprise. Through the large windshield, you see the vast maintenance garage stretching out, filled with the silhouettes of other buses. The flickering fluorescent lights give the space an otherworldly glow.", "[talk] Talk to the driver.\r\n[load] Load a new tape into the ancient VCR surveillance system.\r\n", {"talk", "load", "e", "s"}, {-1, 12, -1, 10}},
-    {12, "Large Garage", "Stepping off the bus, you're greeted by the sights and sounds of a bustling maintenance garage. The cavernous space echoes with the clang of metal and the hiss of pneumatic tools. Buses in various states of repair line the bays—some receiving oil changes, others stripped down to their frames. Mechanics in grease-stained overalls move with purpose, cataloging parts and consulting checklists. The air is thick with the smell of diesel and motor oil.", "", {"e", "w"}, {-1, 13, 11, -1}},
-    {13, "Garage", "You navigate deeper into the underground garage, where the environment becomes a maze of tool benches and spare parts. Overhead, chains and pulleys hang from steel beams, ready to hoist heavy components. A nearby radio plays soft rock tunes, barely audible over the ambient noise. The floor is marked with painted lines guiding the flow of both personnel and machinery.", "", {"e", "w", "s"}, {-1, 15, 12, 14}},
-    {14, "Bus 1138", "Bus 1138 sits idle in its designated spot, looking somewhat forlorn amidst the activity around it. The doors are open, and a maintenance light glows softly inside. The interior is tidy but shows signs of wear—a few scuff marks here and there, and a faint layer of dust on the dashboard. An old air filter lies on one of the seats, ready to be replaced. The quietness of the bus offers a stark contrast to the noisy garage.", "[filter] Replace the cabin air filter.\r\n", {"filter", "n"}, {13, -1, -1, -1}},
-    {15, "Garage", "This section of the garage is brightly lit, with high ceilings and large fans circulating the air. Workstations are neatly arranged with tools meticulously organized. A digital display on the wall tracks ongoing maintenance tasks. The scent of fresh coffee wafts from a corner where a makeshift break area is set up. Technicians exchange brief greetings as they move between assignments.", "", {"n", "e", "w"}, {17, 16, 13, -1}},
-    {16, "Bus 2018", "Bus 2018 gleams under the overhead lights, its exterior freshly washed. The bus is unoccupied, the driver's seat vacant. A checklist is magnetically attached to the door, noting that the spare tire pressure needs verification. The storage compartment is unlocked, revealing a neatly stored spare tire and emergency equipment. Everything appears in order, save for the task at hand.", "[tire] Check the spare tire air pressure and make sure it's up to spec.\r\n", {"tire", "w"}, {-1, -1, 15, -1}},
-    {17, "Garage Ramp", "The garage floor inclines gently upward here, leading toward the main offices. Safety signs remind employees to watch their step and wear protective gear. The concrete walls are adorned with motivational posters and notices about upcoming training sessions. The distant sound of ringing phones and muffled conversations indicates you're nearing the administrative areas.", "", {"n", "s"}, {18, -1, -1, 15}},
-    {18, "Bus Maintenance Building", "You enter the bus maintenance building, a crossroads between the garage and the administrative offices. The area is alive with activity. Clerks shuffle paperwork, and supervisors discuss schedules. Large windows let in natural light, a pleasant change from the artificial lighting below. Potted plants add a touch of greenery to the otherwise industrial environment.", "", {"n", "e", "w", "s"}, {21, 19, 20, 17}},
-    {19, "Maintenance Manager's Office", "The maintenance manager's office is modest but orderly. Certificates and commendations hang on the walls, showcasing years of dedicated service. The manager, a sharp-eyed woman with a no-nonsense demeanor, sits behind a desk piled with documents and maintenance logs. She looks up from her computer as you enter. 'Yes? Do you need something?' she asks curtly, though not unkindly.", "[talk] Talk to the maintenance manager.\r\n", {"talk", "w"}, {-1, -1, 18, -1}},
-    {20, "Bus Operations", "The bus operations room is a hive of logistical planning. Large screens display real-time locations of buses throughout the city. Dispatchers coordinate routes and respond to drivers' communications via headsets. Maps and charts cover the walls, and a whiteboard lists priority tasks. Amidst the organized chaos, someone has left a slice of cheese on the central table, possibly forgotten during a quick snack.", "[cheese] There's a slice of cheese on the table.\r\n", {"cheese", "e"}, {-1, 18, -1, -1}},
-    {21, "Bus Terminal Exit", "You find yourself at the bus terminal exit, where several buses are lined up and ready for departure. Passengers mill about, some checking their phones, others chatting with companions. The bus to Topeka stands out, its destination displayed prominently above the windshield. The driver performs final checks, and the engine emits a low rumble, signaling its readiness for the journey. The evening sky paints the surroundings in hues of orange and purple.", "[bus] A bus is waiting for passengers heading to Topeka.\r\n", {"bus", "s"}, {-1, -1, -1, 18}},
-    {22, "", "", "", {}, {}},
-    {23, "", "", "", {}, {}},
-    {24, "", "", "", {}, {}},
-    {25, "", "", "", {}, {}},
-    {26, "", "", "", {}, {}},
-    {27, "", "", "", {}, {}},
-    {28, "", "", "", {}, {}},
-    {29, "", "", "", {}, {}},
-    {30, "", "", "", {}, {}},
-    {31, "", "", "", {}, {}},
-    {32, "", "", "", {}, {}},
-    {33, "", "", "", {}, {}},
-    {34, "", "", "", {}, {}},
-    {35, "", "", "", {}, {}},
-    {36, "", "", "", {}, {}},
-    {37, "", "", "", {}, {}},
-    {38, "", "", "", {}, {}},
-    {39, "", "", "", {}, {}},
-    {40, "", "", "", {}, {}},
-    {41, "", "", "", {}, {}},
-    {42, "", "", "", {}, {}},
-    {43, "", "", "", {}, {}},
-    {44, "", "", "", {}, {}},
-    {45, "", "", "", {}, {}},
-    {46, "", "", "", {}, {}},
-    {47, "", "", "", {}, {}},
-    {48, "", "", "", {}, {}},
-    {49, "", "", "", {}, {}},
-    {50, "", "", "", {}, {}},
-    {51, "", "", "", {}, {}},
-    {52, "", "", "", {}, {}},
-    {53, "", "", "", {}, {}},
-    {54, "", "", "", {}, {}},
-    {55, "", "", "", {}, {}},
-    {56, "", "", "", {}, {}},
-    {57, "", "", "", {}, {}},
-    {58, "", "", "", {}, {}},
-    {59, "", "", "", {}, {}},
-    {60, "", "", "", {}, {}}, // End of Kansas City
-    {61, "Highway 70 Topeka", "You are traveling on Highway 70, which stretches east toward Kansas City and west toward Ellsworth. The Topeka skyline rises ahead, its buildings gleaming under the sun. Traffic signs indicate upcoming exits to Topeka. Electronic billboards flash emergency alerts: 'Local Hospital Services Disrupted. Seek Alternative Medical Facilities.' Drivers around you seem uneasy, some talking urgently on their phones.", "", {"e", "w"}, {-1, 21, 62, -1}},
-    {62, "Highway 70", "Continuing on Highway 70, the traffic becomes heavier as you near Topeka. Overhead signs display warnings about 'Technical Difficulties at City Hospital.' A sense of tension fills the air. Cars are changing lanes frequently, and you notice an increased presence of emergency vehicles heading into the city.", "", {"e", "w"}, {-1, 61, 63, -1}},
-    {63, "Highway 70", "Highway 70 continues, with exits to Topeka just ahead. The city's silhouette becomes clearer, but something feels off. An ambulance speeds by with its siren blaring, but instead of heading toward the hospital, it takes an exit leading out of the city. Concerned faces peer out from other vehicles.", "", {"e", "w"}, {-1, 62, 64, -1}},
-    {64, "Highway 70", "An exit here leads south to Washburn Avenue. The exit sign flickers intermittently, possibly due to a malfunction. Traffic advisories mention 'Hospital Services Currently Unavailable.' You see a helicopter hovering near the city center, its red cross symbol visible against the sky.", "", {"e", "w", "s"}, {-1, 63, 78, 65}},
-    {65, "Washburn Avenue", "You are on Washburn Avenue. To the west, the large structure of the hospital looms, but unusually, the parking lot is nearly empty. A few people stand outside the entrance, appearing confused or frustrated. The hospital's electronic sign reads 'Closed for Emergency Maintenance.'", "", {"n", "w", "s"}, {64, -1, 79, 66}},
-    {66, "Washburn Avenue", "Continuing along Washburn Avenue, you notice fewer cars on the road. To the north, the hospital's side entrance is cordoned off with caution tape. Pedestrians discuss the sudden shutdown, speculating about possible causes. The atmosphere is one of unease.", "", {"n", "s"}, {65, -1, -1, 67}},
-    {67, "Washburn Avenue", "Washburn Avenue here is lined with small businesses. Many display signs like 'Cash Only' or 'Systems Down,' hinting at broader technical issues in the area. People queue at an ATM, only to find it out of service. Conversations buzz about a cyberattack affecting the city.", "", {"n", "s"}, {66, -1, -1, 68}},
-    {68, "Washburn Avenue", "The avenue continues, and to the east, you see the Evel Knievel Museum. However, it appears closed, with a notice on the door: 'Temporarily Closed Due to Technical Difficulties.' A few tourists stand outside, looking disappointed. The street feels unusually quiet.", "", {"n", "s"}, {67, -1, -1, 69}},
-    {69, "Washburn Avenue", "This stretch of Washburn Avenue is quieter. Streetlights flicker irregularly, and some traffic signals are flashing yellow. A digital billboard displays an error message instead of advertisements. Residents stand on their porches, discussing the unexpected disruptions in the city.", "", {"n", "s"}, {68, -1, -1, 70}},
-    {70, "Highway 470", "You reach Highway 470. The eastbound lanes are closed, with barriers and signs indicating 'Road Closed Due to Incident.' To the west, the highway remains open. An exit to the north leads back to Washburn Avenue. Emergency vehicles speed past, sirens blaring.", "", {"n", "w"}, {69, -1, 71, -1}},
-    {71, "Highway 470", "On Highway 470, traffic moves steadily westward. Overhead signs flash warnings: 'Citywide Technical Issues. Expect Delays.' Drivers seem anxious, and some vehicles pull over as their GPS systems malfunction. The radio broadcasts report on a ransomware attack crippling city infrastructure.", "", {"e", "w"}, {-1, 70, 72, -1}},
-    {72, "Highway 470", "Highway 470 continues. To the west, it leads toward Wichita. To the south, an exit points toward Chanute. The horizon shows the sprawling landscape, but even here, signs of disruption are evident. Billboards are blank or displaying error codes.", "", {"n", "e", "w", "s"}, {73, 71, 422, 100}},
-    {73, "Highway 470", "The highway here feels isolated. Few cars are on the road, and those that are seem to be in a hurry to leave the area. The sky begins to cloud over, mirroring the tense mood. Static interrupts your radio, making it difficult to get news updates.", "", {"n", "s"}, {74, -1, -1, 72}},
-    {74, "Highway 470", "There's an exit here leading to a local cybersecurity firm. A sign reads 'Cyber Dynamics Inc. Next Exit.' Given the citywide issues, the firm might be involved in addressing the problems. You notice more vehicles taking this exit than usual.", "", {"n", "e", "s"}, {75, 99, -1, 73}},
-    {75, "Highway 470", "Continuing north on Highway 470, you see the city's skyline in your rearview mirror. The highway is less congested here, but electronic signs warn: 'Critical Infrastructure Compromised. Exercise Caution.' The sense that something is seriously amiss grows stronger.", "", {"n", "s"}, {76, -1, -1, 74}},
-    {76, "Highway 470", "Highway 470 runs south across Topeka. The usual hustle of city traffic is subdued. Electronic billboards remain dark, and some streetlights flicker. The occasional vehicle speeds by, but the road feels unusually empty.", "", {"n", "s"}, {77, -1, -1, 75}},
-    {77, "Highway 70", "You merge onto Highway 70, which continues west toward Ellsworth. The open road offers a contrast to the troubled city behind you. However, news reports on the radio detail how hospitals and other critical services across the region are experiencing cyberattacks.", "", {"e", "w", "s"}, {-1, 78, 252, 76}},
-    {78, "Highway 70", "Highway 70 continues east and west. Traffic signs advise drivers to avoid Topeka due to ongoing technical issues. The road ahead seems clear, but the uncertainty of the situation weighs on you. A sense of urgency compels you to decide your next move.", "", {"e", "w"}, {-1, 64, 77, -1}},
-    {79, "Hospital Lobby", "You step into the lobby of a large hospital, but instead of the usual bustle, chaos reigns. Staff members rush around, some trying to operate equipment manually. Computer screens display ransom notes demanding payment to restore access. Patients wait anxiously, some being turned away. A lobby PC shows a flickering screen with an ominous message.", "[drive] Pull a drive from the lobby PC.\r\n", {"drive", "e", "w"}, {-1, 65, 80, -1}},
-    {80, "Administrative Hallway", "The hallway leading to the administrative offices is filled with the echoes of hurried footsteps and tense conversations. Paper files are strewn about as staff attempt to revert to manual record-keeping. The air is thick with stress, and the usual order of the hospital is absent.", "", {"n", "e", "w"}, {81, 79, 82, -1}},
-    {81, "Conference Room", "The conference room is usually a place for meetings and planning, but now it's a makeshift command center. An empty box of donuts sits on the table, and tired staff huddle around laptops attempting to analyze the situation. The scent of stale coffee lingers. Papers with technical jargon cover the table.", "[donuts] An empty box of donuts.\r\n[analyze] Analyze hard drives for the hospital.\r\n", {"donuts", "analyze", "s"}, {-1, -1, -1, 80}},
-    {82, "Hallway", "This hallway is dimly lit, with flickering lights adding to the uneasy atmosphere. The doors to several offices are open, revealing dark rooms. A faint hum of emergency generators can be heard. The usual hustle of hospital staff is replaced with a tense silence.", "", {"e", "w"}, {-1, 80, 83, -1}},
-    {83, "Hallway", "You find yourself in another section of the hallway. Medical carts are abandoned, and some equipment lies scattered on the floor. The smell of antiseptic is overpowered by the scent of anxiety. Notices about system outages are taped to the walls.", "", {"n", "e", "s"}, {88, 82, -1, 84}},
-    {84, "Hallway", "This part of the hallway is eerily quiet. The overhead paging system emits occasional garbled messages. To the east, there's a faint glow from a room. The stress of the situation seems to permeate the air.", "", {"n", "e", "s"}, {83, 87, -1, 85}},
-    {85, "IT Manager's Office", "The IT Manager's office is cluttered with network diagrams and hardware manuals. Screens display lines of code and error messages. The manager is absent, possibly dealing with the crisis elsewhere. The room feels like the epicenter of a losing battle against the cyberattack.", "", {"n", "w"}, {84, -1, 86, -1}},
-    {86, "Server Room", "You enter a small server room filled with blinking lights and humming equipment. One of the PCs shows a ransomware message. A hard drive sits partially ejected from a machine, as if someone left in a hurry. The air is cool but stifling.", "[drive] Pull a drive from the PC.\r\n", {"drive", "e"}, {-1, 85, -1, -1}},
-    {87, "Break Room", "The break room is a stark contrast to the tension elsewhere. A box of donuts sits on the counter, untouched. The coffee pot is half-full, and mugs are scattered around. A bulletin board displays staff notices and schedules. It's a brief respite in the midst of chaos.", "[donuts] Take a box of donuts.\r\n", {"donuts", "w"}, {-1, -1, 84, -1}},
-    {88, "Hallway", "This hallway leads deeper into the hospital's administrative area. The walls are lined with portraits of past directors. The lights flicker intermittently. To the north, an exit sign glows faintly.", "", {"n", "w", "s"}, {91, -1, 89, 83}},
-    {89, "Office", "A small office with minimal decor. The desk is cluttered with paperwork, and the computer displays a locked screen with a ransom note. A faint smell of coffee lingers. It's clear that work was abruptly interrupted.", "[drive] Pull a drive from the PC.\r\n", {"drive", "e"}, {-1, 88, -1, -1}},
-    {90, "Office", "This office is slightly larger, perhaps belonging to a department head. Family photos adorn the desk. The computer is frozen, displaying an error message. A stress ball lies on the floor, as if dropped in haste.", "[drive] Pull a drive from the PC.\r\n", {"drive", "e"}, {-1, 91, -1, -1}},
-    {91, "Hallway", "The hallway here feels constricted. The air is thick with tension. You can hear faint voices discussing strategies to combat the ransomware attack. The walls are adorned with motivational posters that seem ironic given the circumstances.", "", {"n", "w", "s"}, {92, -1, 90, 88}},
-    {92, "Hallway", "The hallway ends here, branching to a network closet to the north and a heavy data center door to the east. The area is restricted, with keycard access panels blinking red. Urgent notes are posted on the doors, warning unauthorized personnel to keep out.", "", {"n", "e", "s"}, {93, 94, -1, 91}},
-    {93, "Network Closet", "A cramped network closet filled with tangled cables and humming equipment. Amidst the organized chaos, a Raspberry Pi stands out, connected to the network in an ad-hoc fashion. It seems out of place, possibly the intrusion point for the ransomware attack.", "[pi] Yank the Raspberry Pi\r\n", {"pi", "s"}, {-1, -1, -1, 92}},
-    {94, "Data Center", "The data center is a cold room with rows of servers encased in glass cabinets. The hum of machines is accompanied by flashing lights. Some servers display critical error messages. The heart of the hospital's digital operations is under siege.", "[drive] Pull a server hard drive for analysis.\r\n", {"drive", "w"}, {-1, -1, 92, -1}},
-    {95, "Conference Room", "A modern conference room with a large table and ergonomic chairs. The walls are lined with screens displaying real-time cyber threat maps. It's empty now, perhaps recently used for an emergency meeting. The air smells faintly of whiteboard markers.", "", {"n"}, {97, -1, -1, -1}},
-    {96, "Security Operations Center", "You step into the Security Operations Center of the cybersecurity firm. The room is filled with large monitors displaying code, network diagrams, and threat alerts. Analysts sit at their stations, typing furiously and coordinating responses. The atmosphere is intense but focused.", "", {"w"}, {-1, -1, 97, -1}},
-    {97, "Hallway", "A sleek, modern hallway in the cybersecurity firm. To the east, a wall of glass reveals the bustling Security Operations Center, where large screens display global cyber threats. To the west is the reception area. The firm seems to be at the forefront of combating the cyberattack.", "", {"n", "e", "w", "s"}, {98, 96, 99, 95}},
-    {98, "Office", "This is the office of the firm's manager. The room is filled with state-of-the-art technology. A collection of Raspberry Pi devices is neatly arranged on the desk, perhaps used for testing and development. The manager is engrossed in coordinating the response efforts.", "[pi] There's a collection of Raspberry Pi's on his desk.\r\n", {"pi", "s"}, {-1, -1, -1, 97}},
-    {99, "Cyber Response Firm", "You are in the reception area of Cyber Dynamics Inc., a leading cybersecurity incident response firm. The receptionist greets you with a professional smile, despite the hectic activity behind her. People in suits and tech attire move swiftly, embodying urgency. Brochures on cyber safety are displayed on a table.", "", {"e", "w"}, {-1, 97, 74, -1}}, // End Topeka
-    {100, "Plummer Ave and Main St", "This is a crossroads, with a major highway heading north to Topeka. Main Street leads to the east where you can see a few small shops, along with Town Hall in the distance. South of here is Plummer Avenue, which leads to a large parking lot and another major highway in the distance.", "[poster] A poster has been stapled to a nearby light pole.\n", {"poster", "n", "e", "s"}, {72, 101, -1, 141}},
-    {101, "Main Street", "Main Street continues to the east and west from here. Several small shops line the road, with ample parking.", "", {"e", "w"}, {-1, 102, 100, -1}},
-    {102, "Main Street", "Main Street continues to the east and west from here. Among the small shops in this trade district there is a quaint coffee shop to the north, a sign hangs above 'Coffee Connection' depicting a coffee cup at the center of a hub-and-spoke diagram. A small bank is located to the south, with various signs advertising their rates and products and services available to patrons. In the distance to the east the Town Hall lingers.", "", {"n", "e", "w", "s"}, {103, 109, 101, 104}},
-    {103, "Coffee Connection", "A small coffee shop with a cozy interior. The walls are adorned with artwork and shelves filled with books. The aroma of freshly brewed coffee fills the air. There are several tables and chairs where customers can sit and enjoy their drinks. The counter is manned by friendly baristas ready to take orders.", "[coupon] A sign on the register is advertising their Buy-One-Get-One coupons.\n[beacon] A small sign depicting the BEACON Taxi Service is on the counter.\n", {"coupon", "beacon", "s"}, {-1, -1, -1, 102}},
-    {104, "Bank Entrance", "The entrance to a small branch of a local bank. The glass doors are adorned with the bank's logo. Inside, you can see a reception desk and a waiting area with comfortable chairs. There are signs on the walls advertising the bank's services and promotions.", "", {"n", "w", "s"}, {102, -1, 107, 105}},
-    {105, "Bank Lobby", "The lobby of the small bank branch. The space is well-lit and clean. There are teller windows along one side of the room, with customers waiting in line. In the center, there is a seating area with magazines and brochures about the bank's offerings. A large sign on the wall displays the bank's mission statement and values.", "", {"n", "w", "s"}, {104, -1, 108, 106}},
-    {106, "Teller Line", "The line of teller windows where customers can conduct their banking transactions. The tellers are busy assisting customers and handling transactions. There are ropes and stanchions to guide the line of customers and ensure order.", "", {"n"}, {105, -1, -1, -1}},
-    {107, "Banker's Office", "A private office where bank employees meet with customers to discuss their financial needs. The office is furnished with a desk, chairs, and a computer. There are shelves filled with financial books and resources. The walls are adorned with certificates and awards recognizing the bank's achievements.", "", {"e"}, {-1, 104, -1, -1}},
-    {108, "The Bank Vault", "The highly secure area of the bank where valuable assets are stored. The vault door is thick and heavy, with a combination lock. Inside, there are rows of safety deposit boxes and shelves holding cash and other valuable items. The room is monitored by security cameras and requires special authorization to access.", "", {"e"}, {-1, 105, -1, -1}},
-    {109, "Main Street", "This is the Main Street that leads to the east and west, with a series of small shops to the west. The Town Hall is east of here, and a small road lies the south that appears to dead end. There is a mural painted on the road here, depicting the Earth displayed on a computer screen, with the mouse cursor located in Chanute, KS.", "", {"e", "w", "s"}, {-1, 112, 102, 110}},
-    {110, "Lincoln Ave", "A small, rarely traveled road. The Town Hall buildingn is up to the sidewalk on the eastern side, while the parking lot for the bank can be seen to the west. Further south the road appears to be run over with bushes and ground covering.", "", {"n", "s"}, {109, -1, -1, 111}},
-    {111, "Dead End", "The road ends here, with a couple of bank employees choosing to park their cars instead of behind the bank. The road looks like it used to connect to the south, but has since been overgrown with shrubbery. On the other side ofthe shrubs it looks like there is a street sign that has been overgrown with vines. If only there was a way back there.", "", {"n"}, {110, -1, -1, -1}},
-    {112, "Main Street", "Main Street contineus east and west, to the east in the distance there is another major road that leads north and south, presumedly encircling the town. The grand Town Hall is located to the south of here, with a large bell tower built on the top like a capital building.", "", {"e", "w", "s"}, {-1, 113, 109, 116}},
-    {113, "Main Street", "Main Street contineus east and west, with the shopping district to the west and another road intercepting to the east.", "", {"e", "w"}, {-1, 114, 112, -1}},
-    {114, "Main Street", "As Main Street starts to merge with another road, it narrows here, giving way to side parking and bike lanes.", "", {"e", "w"}, {-1, 115, 113, -1}},
-    {115, "Main Street and Central Avenue", "This is the interception of Main Street and Central Avenue. Central leads to the south, while Main continues on to the west.", "", {"w", "s"}, {-1, -1, 114, 126}},
-    {116, "Town Hall Lobby", "The lobby of the Town Hall is filled with literature about the town, and a small waiting area with a receptionist desk. A sign on the desk reads 'Back Later, Gone Phishing'. You notice a visitor information center is to the east, with someone loitering about. The Town Hall hall leads to the south with a sign that reads 'Mayors Office.'", "", {"n", "e", "s"}, {112, 118, -1, 117}},
-    {117, "The Town Hall-way", "This long hallway leads to the Mayors Office and the break room to the east. An emergency exit is located to the south, with a brick holding the door ajar.", "", {"n", "e", "w", "s"}, {116, 119, 120, 121}},
-    {118, "Visitor Information Center", "This room is filled with information, maps, brochures, everything you could imagine when looking for information. Various signs hang on the wall depicting the history of the town, and the construction of this very Town Hall. A small table and two chairs is located in one of the corners, with a reporter siting at the table writing in a journal.", "[talk] The reporter is eager to write his story.\n", {"talk", "w"}, {-1, -1, 116, -1}},
-    {119, "Break Room", "This break room is your typical break room. There's a fridge and a counter, with a sink without a garbage disposal. A hand written sign warns to not put anything down the sink drain or the plumber will have be called again.", "", {"w"}, {-1, -1, 117, -1}},
-    {120, "Mayors Office", "A glamorous office filled with the largest, heaviest furnture any IT staff could imagine. The mayors chair appears to be empty at the moment, and various campaign signs are propped up around the office prompting residents to vote.", "", {"e"}, {-1, 117, -1, -1}},
-    {121, "Back Alley", "The back alley of the Town Hall. A dingy one lane road, overgrown with brush and vines. The alley continues both east and west. To the west is what appears to be the other side of a dead end, and a large privacy fence lies to the east.", "", {"n", "e", "w"}, {117, 125, 122, -1}},
-    {122, "Back Alley", "The alley continues here, with a lot of overgrown brush to the north. There is a rusty sign here.", "[sign] A rusty street sign is covered in foliage.\n", {"sign", "e", "w"}, {-1, 121, 123, -1}},
-    {123, "Back Alley", "The alley continues to the east, and to the west is a path among the brush that leads to what appears to be a parking lot. The path is very overgrown, and you're not sure if you could make your way back or not.", "", {"e", "w"}, {-1, 122, 124, -1}},
-    {124, "Parking Lot", "A large parking lot, with cars and trucks sporadically parked about, most of them are within the lines. There is one truck that stands out, it looks like it wasn't rendered with very many polygons.", "", {"w"}, {-1, -1, 140, -1}},
-    {125, "Back Alley", "The alley continues to the west, and this is a dead end. A large privacy fence lines the road to the east. There is a telephone pole to the east on the other side of the fence, and there looks to be a poster stapled to it.", "", {"w"}, {-1, -1, 121, -1}},
-    {126, "Central Ave", "Central Avenue leads to the north and south from here. A large privacy fence lines the west side of the fence. Some random cars are parked on the side of the road.", "", {"n", "s"}, {115, -1, -1, 127}},
-    {127, "Central Ave", "Central Avenue continues north and south. There is a tall telephone pole here with a printed poster stapled and taped to it.", "[sign] A printed sign is taped to the fence.\n", {"coupon", "sign", "n", "s"}, {126, -1, -1, 128}},
-    {128, "Central Ave", "Central Avenue continues to the north, with a large gas station entrance to the west.", "", {"n", "w", "s"}, {127, -1, 129, 130}},
-    {129, "Fast Fuel Station", "A large fuel station is here, with many pumps available for patrons. Some free air is located on the corner, and an EV charger station is even here. Exits lead to the east and the south to the roads.", "", {"e", "s"}, {-1, 128, -1, 131}},
-    {130, "Central Avenue and 14th Street", "A highway to the east leads to Pittsburgh, and 14th Street leads to the west.", "[sign] A hastily erected sign is on the street corner.\n", {"sign", "n", "e", "w"}, {128, 150, 131, -1}},
-    {131, "14th Street", "14th Street leads to the east and west of here, with a large Fast Fuel station to the north.", "", {"n", "e", "w"}, {129, 130, 132, -1}},
-    {132, "14th Street", "14th Street continues to the west and east of here, major highways can be seen in both directions.", "", {"e", "w"}, {-1, 131, 133, -1}},
-    {133, "14th Street", "14th Street continues to the west and east, there appears to be a restaurant to the west.", "", {"e", "w"}, {-1, 132, 134, -1}},
-    {134, "14th Street", "14th Street continues in both directions here, and a restaurant named The Hangzone is to the north. The Hangzone is a chill restaurant and bar, known for its relaxed atmosphere, delicious food, and wide selection of drinks. It's a popular spot for locals to hang out and unwind after a long day.", "", {"n", "e", "w"}, {135, 133, 136, -1}},
-    {135, "The Hangzone", "The Hangzone is a chill restaurant and bar, known for its relaxed atmosphere, delicious food, and wide selection of drinks. It's a popular spot for locals to hang out and unwind after a long day.", "", {"s"}, {-1, -1, -1, 134}},
-    {136, "14th Street", "14th Street continues to the west and east, a major highway can be seen the west while the town continues to the east.", "", {"e", "w"}, {-1, 134, 137, -1}},
-    {137, "Highway to Wichita and Chanute", "A highway to the west leads to Wichita, while in the distance to the north and east more major highways can be seen. The Plummer Avenue leads to the north while 14th Street heads to the east.", "[leaflet] Someone has disgarded a leaflet in the gutter.\n", {"leaflet", "n", "e", "w"}, {138, 136, 426, -1}},
-    {138, "Plummer Ave", "Plummer Avenue leads to the north and south from here, in the distance in both directions major highways can be seen. The town can be seen to the east of here, with various buildings. A large parking lot can be seen further north.", "", {"n", "s"}, {139, -1, -1, 137}},
-    {139, "Plummer Ave", "Plummer Avenue leads to the north and south, with major highways in both directions. The town buildings can be seen in the east.", "", {"n", "s"}, {140, -1, -1, 138}},
-    {140, "Plummer Ave", "Plummer Avenue continues to the north and south, and a large parking lot scattered with cars is located to the east.", "", {"n", "e", "s"}, {141, 124, -1, 139}},
-    {141, "Plummer Ave", "Plummer Avenue continues to the north and south, with a major highway located to the north and a parking lot can be seen to the south east. Further south is another major highway, while the town can be seen to the east.", "", {"n", "s"}, {100, -1, -1, 140}},
-    {142, "Room 142", "Empty Room # 142", "", {}, {-1, -1, -1, -1}},
-    {143, "Room 143", "Empty Room # 143", "", {}, {-1, -1, -1, -1}},
-    {144, "Room 144", "Empty Room # 144", "", {}, {-1, -1, -1, -1}},
-    {145, "Room 145", "Empty Room # 145", "", {}, {-1, -1, -1, -1}},
-    {146, "Room 146", "Empty Room # 146", "", {}, {-1, -1, -1, -1}},
-    {147, "Room 147", "Empty Room # 147", "", {}, {-1, -1, -1, -1}},
-    {148, "Room 148", "Empty Room # 148", "", {}, {-1, -1, -1, -1}},
-    {149, "Room 149", "Empty Room # 149", "", {}, {-1, -1, -1, -1}},
-    {150, "Highway to Chanute", "You are on the major highway leading to Chanute, Kansas. The road stretches endlessly ahead, cutting through vast fields of golden wheat that sway gently in the prairie wind. The sky above is a clear expanse of blue, dotted with the occasional fluffy cloud. A digital billboard stands tall by the roadside, but instead of advertising it is displaying a suspiciously familiar screen.", "[billboard] Get a closer look at the digital billboard.\r\n", {"billboard", "w", "n", "s"}, {130, -1, 130, 151}},
-    {151, "Highway 69", "Highway 69 merges here, transitioning into Broadway as it leads into the heart of Pittsburg. The traffic becomes slightly denser, and you notice more signs of civilization—buildings appearing in the distance, and the hum of city life growing louder. The open fields give way to suburban landscapes.", "", {"n", "s"}, {150, -1, -1, 152}},
-    {152, "Broadway", "You are on Broadway, the main thoroughfare of Pittsburg. The street is lined with quaint brick buildings housing various shops and businesses. The aroma of fresh bread and coffee drifts from nearby cafés. To the west, a charming flower shop catches your eye with its colorful display.", "", {"n", "w", "s"}, {151, -1, 153, 154}},
-    {153, "The Little Shop of Flowers", "Stepping into The Little Shop of Flowers, you're greeted by a delightful mix of floral fragrances. The shop is cozy, filled with vibrant bouquets and potted plants. A bright red rose sits prominently on a counter, still in its pot, its petals velvety and rich in color. The shopkeeper smiles warmly at you.", "[rose] A bright red rose sits here still in the pot.\r\n", {"rose", "e"}, {-1, 152, -1, -1}},
-    {154, "Broadway", "Broadway continues here, bustling with activity. Small shops line the street, each with unique storefronts displaying artisanal goods, antiques, and local crafts. Pedestrians stroll along the sidewalks, and the sound of friendly chatter fills the air. Street lamps adorned with hanging flower baskets add a touch of charm.", "", {"n", "e", "s"}, {152, 155, -1, 156}},
-    {155, "Blue Spoon", "You arrive at the permanent location of the Blue Spoon food truck. The vibrant blue vehicle is parked in a cozy lot, with picnic tables set up under string lights. The aroma of gourmet street food is irresistible. A menu board lists today's specials, and patrons are lined up eagerly awaiting their orders.", "", {"w"}, {-1, -1, 154, -1}},
-    {156, "Broadway", "As you proceed along Broadway, the buildings become grander, signaling your approach to the town center. The historic architecture is well-preserved, showcasing ornate facades and large windows. In the distance to the southwest, the town hall stands prominently. Just south of here, Fourth Street crosses, leading east and west.", "", {"n", "e", "s"}, {154, 157, -1, 158}},
-    {157, "Root Coffeehouse", "Entering the Root Coffeehouse, you're enveloped by the rich scent of freshly brewed coffee. The interior is cozy yet modern, with exposed brick walls and comfortable seating. A cup of coffee with the name 'Stacey' written on the label sits on the counter, still steaming. Soft indie music plays in the background, creating a relaxing atmosphere.", "[coffee] A cup of coffee is on the counter with 'Stacey' written on the label.\r\n[beacon] Set your beacon to this location.\r\n", {"beacon", "coffee", "w"}, {-1, -1, 156, -1}},
-    {158, "Broadway and Fourth", "You stand at the bustling intersection of Broadway and Fourth Street. The heart of Pittsburg pulses around you, with people crossing streets and cars navigating the thoroughfares. To the southeast, the campus of Pittsburg State University is visible, its clock tower rising above the treetops. The town hall lies to the west, and far to the south, the courthouse's dome is just visible.", "", {"n", "e", "w", "s"}, {156, 189, 159, 162}},
-    {159, "Fourth Street", "Fourth Street extends here, a quieter road lined with trees and classic street lamps. To the south, the entrance to City Hall beckons with its stately columns and flags fluttering in the breeze. To the west, the road is closed off, barriers indicating construction or perhaps a permanent closure.", "", {"e", "w", "s"}, {-1, 158, 160, 161}},
-    {160, "Fourth Street", "The road comes to an abrupt end here, blocked by barriers and caution signs. Beyond them, the pavement gives way to overgrown grass and weeds, suggesting it hasn't been used in some time. It's peaceful here, with only the distant sounds of the town reaching your ears.", "", {"e"}, {-1, 159, -1, -1}},
-    {161, "City Hall", "You enter the grand lobby of City Hall, a spacious area with marble floors and high ceilings. A reception desk sits near the entrance, but the receptionist looks flustered, juggling phone calls and paperwork. People in suits engage in serious discussions, while others in casual attire hurry past carrying backpacks filled with tech equipment. The atmosphere is a mix of urgency and organized chaos.", "[talk] The receptionist is looking flustered.\r\n[letter] There's a letter addressed to the courthouse.\r\n", {"talk", "letter", "n"}, {159, -1, -1, -1}},
-    {162, "Broadway", "Continuing south on Broadway, the street maintains its lively energy. The courthouse looms in the distance, an imposing structure of stone and glass. To the east, a modest bank branch nestles between other storefronts, its facade traditional yet welcoming. The sidewalks are busy with townsfolk going about their day.", "", {"n", "e", "s"}, {158, 163, -1, 164}},
-    {163, "Pittsburg Bank and Trust", "The Pittsburg Bank and Trust is a small but well-appointed bank. Inside, the atmosphere is calm and professional. A teller line runs along one side, and several desks are arranged in an open-concept space for private consultations. The scent of fresh coffee lingers, and soft background music plays. Friendly staff greet customers as they enter.", "", {"w"}, {-1, -1, 162, -1}},
-    {164, "Broadway", "This stretch of Broadway is lined with a mix of old and new shops. To the east, the Pittsburg Post Office stands with its classic red, white, and blue signage. Flower boxes adorn the windows of nearby businesses, and a vintage lamppost displays a banner announcing an upcoming town festival.", "", {"n", "e", "s"}, {162, 165, -1, 166}},
-    {165, "Pittsburg Post", "The Pittsburg Post Office is a cornerstone of the community. The exterior is adorned with patriotic emblems, and inside, the scent of paper and ink is prominent. Customers queue patiently, and postal workers efficiently sort mail behind the counters. A bulletin board displays community notices and events.", "", {"w"}, {-1, -1, 164, -1}},
-    {166, "Broadway", "Broadway continues southward here, the buildings becoming more spaced out with small parks and green spaces appearing. Trees line the sidewalks, their leaves providing shade. The ambiance is slightly quieter, though the hum of the town is still present.", "", {"n", "s"}, {164, -1, -1, 167}},
-    {167, "Broadway and Ford", "At the intersection of Broadway and Ford Street, the energy picks up again. To the east, Ford Street stretches toward the campus of Pittsburg State University, visible through the gaps between buildings. The intersection is busy, with cars and pedestrians moving in all directions. A street musician plays a cheerful tune on a violin nearby.", "", {"n", "e", "s"}, {166, 175, -1, 168}},
-    {168, "Broadway", "Broadway reaches its southern terminus here, culminating at the stately courthouse. The courthouse dominates the area with its neoclassical architecture—tall columns, grand steps, and a domed roof. The building exudes an air of authority and history.", "", {"n", "s"}, {167, -1, -1, 169}},
-    {169, "Courthouse Lobby", "You step into the courthouse lobby, where the atmosphere is solemn and respectful. Marble floors echo footsteps, and the high ceiling is adorned with ornate chandeliers. People wait on benches, some reading documents, others conversing in hushed tones. Security personnel stand watchful near the entrance.", "", {"n", "s"}, {168, -1, -1, 170}},
-    {170, "Reception", "The reception area of the courthouse is a hub of activity. The receptionist sits behind a tall desk, frantically refreshing her email on Outlook, a look of concern on her face. Hallways extend to the east and west, leading to various courtrooms and offices. The sound of muffled conversations and the occasional ringing phone fills the air.", "[talk] The receptionist frantically refreshes Outlook.\r\n", {"talk", "n", "e", "w"}, {169, 171, 172, -1}},
-    {171, "Waiting Room", "The waiting room is a quiet space with comfortable seating and soft lighting. A woman sits at a small table, focused on her laptop while using her mobile hotspot. Magazines and informational pamphlets are neatly arranged on a side table. A large window offers a view of the courthouse gardens outside.", "[talk] A woman sits on her laptop using her hotspot.\r\n", {"talk", "w"}, {-1, -1, 170, -1}},
-    {172, "Courthouse Hall", "You enter a long hallway with polished wooden floors and portraits of esteemed judges lining the walls. The air smells faintly of old books and furniture polish. The hall continues to the south, leading deeper into the courthouse.", "", {"e", "s"}, {-1, 170, -1, 173}},
-    {173, "Courthouse Hall", "The hallway ends here, branching into two important rooms. To the east, a door leads to the network closet, marked 'Authorized Personnel Only.' To the west, large double doors open into a courtroom. The area is quiet, with only the soft hum of equipment audible.", "", {"n", "e", "w"}, {172, 174, 196, -1}},
-    {174, "Courthouse Network Closet", "You find yourself in a small but critical room filled with servers and networking equipment. The air is cool, maintained by dedicated climate control systems. Cables are neatly organized, and indicator lights blink rhythmically. A faint hum underscores the importance of this technological hub for courthouse operations.", "[drive] A server is left unlocked and logged in.", {"drive", "w"}, {-1, -1, 173, -1}},
-    {175, "Ford Street", "Ford Street branches off from Broadway, leading into charming residential neighborhoods and eventually to the university. The street is lined with well-kept homes, each with its own unique character. Children play in yards, and the scent of freshly cut grass fills the air.", "", {"e", "w"}, {-1, 176, 167, -1}},
-    {176, "Ford Street", "Continuing along Ford Street, you notice the surroundings become more academic. University buildings start to appear, and students walk or bike along the sidewalks. The street is shaded by tall oak trees, providing a serene canopy.", "", {"e", "w"}, {-1, 177, 175, -1}},
-    {177, "Ford and Joplin", "You arrive at the intersection of Ford Street and Joplin Street. To the east lies a picturesque city park, inviting with its open green spaces and playground equipment. The intersection is a blend of residential calm and the liveliness brought by nearby students.", "", {"n", "e", "w"}, {179, 178, 176, -1}},
-    {178, "Pittsburg Park", "The city park is a peaceful oasis amid the town's bustle. Lush grass and well-maintained flower beds create a welcoming atmosphere. A USB thumb drive catches your eye, left on a park bench as if forgotten. Nearby, an open planter box awaits a new plant, perfectly sized for a single flower. Birds chirp from the trees, and the sound of laughter echoes from a distant playground.", "[drive] There's a USB thumb drive on the park bench.\r\n[plant] There's an open planter near the picnic bench, perfectly sized for a single flower.\r\n", {"drive", "plant", "w"}, {-1, -1, 177, -1}},
-    {179, "Joplin", "Joplin Street here is a quiet neighborhood lane. Houses with front porches and well-tended gardens line the street. Residents greet each other warmly, and the pace of life feels relaxed. The street leads northward toward more residential areas.", "", {"n", "s"}, {180, -1, -1, 177}},
-    {180, "Joplin", "Joplin Street opens up as it approaches the university campus. To the east, the grand stadium stands as a testament to the school's athletic spirit. To the west, the main entrance to Pittsburg State University welcomes students and visitors alike with its landscaped grounds and stately buildings.", "", {"n", "e", "w", "s"}, {182, 181, 190, 179}},
-    {181, "Stadium", "The university stadium is an impressive structure with towering bleachers and a meticulously maintained field. Banners displaying the school's mascot and colors adorn the exterior. The atmosphere is quiet now, but you can imagine the roar of the crowd on game days.", "", {"w"}, {-1, -1, 180, -1}},
-    {182, "Joplin", "Continuing north on Joplin Street, the environment becomes more academic. Students walk in groups, discussing lectures and assignments. To the west, a bookstore catches your attention, its windows displaying bestsellers and university merchandise.", "", {"n", "s"}, {183, -1, -1, 180}},
-    {183, "Joplin and Cleveland", "At the intersection of Joplin and Cleveland Streets, Joplin turns north toward Fourth Street. Cleveland Street heads west into a residential area. The corner is lively, with a mix of students and locals frequenting nearby cafes and shops.", "", {"n", "w", "s"}, {186, -1, 184, 182}},
-    {184, "Cleveland Street", "Cleveland Street is a charming residential road. Trees arch overhead, and the sidewalks are dotted with flower beds. The atmosphere is peaceful, with the occasional sound of children playing or dogs barking. The street continues east toward the busier parts of town.", "", {"e", "s"}, {-1, 183, -1, 185}},
-    {185, "Bookstore", "Nestled away near the university, this surprisingly large bookstore offers a haven for book lovers. Shelves are packed with academic texts, fiction, and a cozy café area where students study and sip coffee. Soft music plays in the background, and the scent of new books is intoxicating.", "", {"n"}, {184, -1, -1, -1}},
-    {186, "Fourth and Joplin", "At the corner of Fourth and Joplin, the street buzzes with activity. The university lies to the south, while to the west, a beautiful dog park and community center invite locals to relax and socialize. The intersection is a blend of academic life and community spirit.", "", {"w", "s"}, {-1, -1, 187, 183}},
-    {187, "Fourth Street", "Fourth Street here is lined with boutique shops, cafés, and galleries. The atmosphere is artistic and vibrant. To the north, the street leads to the Pittsburg Pup Park, a favorite spot for dog owners. The sidewalks are busy with pedestrians enjoying the local offerings.", "", {"n", "e", "w"}, {188, 186, 189, -1}},
-    {188, "Pittsburg Pup Park", "The Pittsburg Pup Park is a delightful green space dedicated to dogs and their owners. Fenced play areas allow dogs to run freely, while benches and picnic tables provide seating for humans. The park is well-maintained, with fresh water stations and agility equipment. The joyful sounds of dogs barking and playing fill the air.", "", {"s"}, {-1, -1, -1, 187}},
-    {189, "Fourth Street", "Fourth Street continues westward, gradually leading back toward the town center. The architecture here reflects the town's history, with buildings dating back to the early 1900s. Antique shops and artisan studios invite exploration.", "", {"e", "w"}, {-1, 187, 158, -1}},
-    {190, "University Entrance", "You stand at the grand entrance to Pittsburg State University. The gates are adorned with the university's emblem, and the pathway beyond is lined with banners displaying school achievements. Students and faculty move about purposefully, contributing to the dynamic campus environment.", "", {"e", "w"}, {-1, 180, 191, -1}},
-    {191, "Hallway", "Inside the university building, a long hallway stretches before you. The floors are polished, and the walls are decorated with student artwork and announcement boards. Doors to classrooms and offices line the corridor. Soft lighting and comfortable seating areas create an inviting atmosphere.", "", {"e", "w", "s"}, {-1, 190, 194, 192}},
-    {192, "Hallway", "This section of the hallway features the Dean's office to the east and a locked door to the west marked 'Computer Lab'. The area is quiet, with only the distant sounds of lectures and footsteps. A sense of academia pervades the air.", "", {"n", "e", "w"}, {191, 193, 199, -1}},
-    {193, "Dean's Office", "The Dean's office exudes authority and accomplishment. Shelves are filled with books, and the walls display awards, certificates, and photographs of significant university events. The Dean sits behind an impressive mahogany desk, his head resting in his hands as if deep in thought or concern.", "[talk] The Dean rests his head in his hands behind the desk.\r\n", {"talk", "w"}, {-1, -1, 192, -1}},
-    {194, "Hallway", "The hallway here is bright, thanks to large windows that let in ample natural light. Comfortable benches are positioned along the walls, offering spots for students to study or relax between classes. The corridor leads north toward more classrooms.", "", {"n", "e", "w"}, {195, 191, 197, -1}},
-    {195, "Classroom", "You enter a standard college classroom. Desks and chairs are arranged neatly, facing a whiteboard at the front. However, signs of maintenance are evident—ceiling tiles are propped open, and ladders are stationed in the corner. It appears the room is undergoing repairs, lending it an unfinished feel.", "[ladder] There are ladders propped up in the corner.\r\n", {"ladder", "s"}, {-1, -1, -1, 194}},
-    {196, "Pittsburg Court", "The courtroom within the Pittsburg courthouse is solemn and dignified. Wooden pews provide seating for observers, and the judge's bench stands elevated at the front. The room is empty at the moment, silent except for the faint echo of footsteps from elsewhere in the building.", "", {"e"}, {-1, 173, -1, -1}},
-    {197, "Hallway", "The hallway takes a turn here, heading south. The lighting is slightly dimmer, and the sounds of activity fade. It feels more secluded in this part of the building.", "", {"e", "s"}, {-1, 194, -1, 198}},
-    {198, "Hallway", "The hallway dead-ends here, with nowhere else to go. However, you notice broken ceiling tiles above, revealing a crawl space. It's just within reach, and you consider whether you could climb up to access the room beyond.", "[climb] You might be able to climb through the ceiling into the room next door.\r\n", {"climb", "n"}, {197, -1, -1, -1}},
-    {199, "Computer Lab", "The university's computer lab is a hub of technology. Rows of computers and networking equipment fill the room, ranging from personal PCs to enterprise-grade servers and switches. The hum of electronics is constant. You notice that some equipment appears out of place—Ethernet cables are bridging networks that shouldn't be connected, and a laptop is hardwired into the city network.", "[shutdown] The laptop is hard-wired into the city network.\r\n[unplug] Ethernet cables are bridging the university network with the city network switches in the lab.\r\n", {"shutdown", "unplug", "e"}, {-1, 192, -1, -1}},
-    {200, "Corner of Main Street and 1st Street", "At the corner of Main Street and First Street in Newton, KS, an old newspaper stand sits by a lamppost, showing headlines about a cyber attack at the local high school. The older brick buildings around it add some charm. Main Street carries on to the north while First Street extends to the west.", "", {"n", "w", "s"}, {201, -1, 211, 427}},
-    {201, "Main Street", "As you continue down Main Street, you take in the sights and smells as you pass various stores and restaurants.", "", {"n", "s"}, {202, -1, -1, 200}},
-    {202, "Corner of Main Street and Broadway", "At the corner of Main Street and Broadway in Newton, KS, historic brick buildings mix with newer shops and cafés, giving the area a blend of old and new. A neon sign flickers outside a local diner, while a nearby flower shop adds a splash of color to the sidewalk, creating a lively but relaxed atmosphere.", "", {"n", "s"}, {203, -1, -1, 201}},
-    {203, "Main Street", "Main Street in Newton, between 12th Street and Broadway, is lined with small businesses and charming brick buildings that capture the town's friendly vibe. The trees along the sidewalk offer shade, and the shops and cafés invite people to stop in, making it a busy spot for locals throughout the day.", "", {"n", "s"}, {204, -1, -1, 202}},
-    {204, "Corner of Main St and 12th Street", "At the corner of 12th Street and Broadway in Newton, KS, a faded convenience store and a gas station face each other across the intersection. The sidewalks show some wear, and the slow-changing traffic light adds to the relaxed, small-town feel as cars pass by and the occasional conversation drifts through the quiet.", "", {"w", "s"}, {-1, -1, 205, 203}},
-    {205, "12th Street", "Between Broadway and the Newton High School parking lot, 12th Street is lined with older homes, small businesses, and tall trees shading the cracked sidewalks. The quiet neighborhood gradually livens up near the school, where students are playing with their friends. ", "", {"e", "w"}, {-1, 204, 206, -1}},
-    {206, "Newton High School Parking Lot", "The parking lot sits empty save for a few vehicles parked in Staff parking spaces. As you approach the school, you notice a small USB drive sitting next to one of the vehicles.", "[pickup] Pickup the USB drive\r\n", {"pickup", "n", "e", "w"}, {214, 205, 207, -1}},
-    {207, "Corner of 12th Street and Meridian", "At the corner of 12th Street and Meridian in Newton, KS, a gas station and a small convenience store sit across from a residential area with modest houses. The intersection feels quiet and unhurried, with a few cars passing by and occasional pedestrians on the sidewalks.", "", {"e", "s"}, {-1, 206, -1, 208}},
-    {208, "Meridian Street", "Meridian Street in Newton, KS, stretches through town with a mix of residential areas, small businesses, and open spaces. The road is lined with trees and modest houses, creating a relaxed atmosphere as traffic flows steadily along the well-traveled route.", "", {"n", "s"}, {207, -1, -1, 209}},
-    {209, "Corner of Meridian and Main Street", "At the corner of Meridian and Main, a few local shops face a quiet residential area, creating a blend of small businesses and neighborhood charm. The intersection sees a steady flow of cars, with tree-lined sidewalks providing shade for those passing by.", "", {"n", "e"}, {208, 210, -1, -1}},
-    {210, "Main Street", "Main Street is lined with a mix of older houses and small businesses, giving the area a cozy, lived-in feel. The road is quiet, with tall trees casting shadows over the sidewalks and the occasional car passing by. To the east you notice the parking lot of Athletic Park.", "", {"e", "w"}, {-1, 211, 209, -1}},
-    {211, "Athletic Park Parking Lot", "The Athletic Park parking lot is bustling with cars as kids play in the park, making the most of their unexpected time off from school due to the recent cyber attack. Laughter fills the air while groups of high schoolers chat nearby and enjoy the sunny afternoon at the park.", "", {"n", "e", "w"}, {213, 200, 210, -1}},
-    {212, "First Street", "Empty Room # 212", "", {"e", "w"}, {-1, 200, 211, -1}},
-    {213, "Athletic Park", "Athletic Park is bustling with kids swinging, climbing, and racing across the grassy fields, enjoying the sunny day. Laughter and cheerful voices fill the air. There is a pickup game of baseball starting at the nearby ball diamond. A nearby sign marks the start of the frisbee golf course.", "[playball] Join in a pickup game of baseball.\r\n[throwdiscs] play a round of frisbee golf\r\n", {"playball", "throwdiscs", "s"}, {-1, -1, -1, 211}},
-    {214, "Lobby of Newton High School", "The lobby brings back nostalgia as you enter the doors and are drawn back to your high school days. Time to get to work. The school office lays before you.", "", {"n", "s"}, {215, -1, -1, 206}},
-    {215, "Office of Newton High School", "The Newton High School office is a busy hub, with the faint hum of conversation and ringing phones filling the air as staff members assist students and visitors. Behind the front desk, shelves are lined with neatly stacked papers and school memorabilia, while a bulletin board displays announcements and reminders in a mix of bright colors. The Secretary greets you with a smile and informs you that the Principal is in his office.", "", {"n", "e", "s"}, {216, 217, -1, 214}},
-    {216, "Principal's Office", "The Newton High School principal's office is tidy and organized, with framed certificates and school photos decorating the walls. The principal sits at his desk, reviewing paperwork, while a small stack of files and a nameplate neatly occupy the polished wooden surface.", "[talk] Talk to the Principal\r\n", {"talk", "s"}, {-1, -1, -1, 215}},
-    {217, "A Hall", "A Hall in the high school is lined with rows of gray lockers, their doors slightly scuffed from years of use. The fluorescent lights overhead cast a bright glow on the tiled floor, while a few classroom doors stand open, letting the sound of distant chatter and lessons drift into the corridor.", "", {"e", "w"}, {-1, 218, 215, -1}},
-    {218, "A Hall", "A Hall in the high school is lined with rows of gray lockers, their doors slightly scuffed from years of use. The fluorescent lights overhead cast a bright glow on the tiled floor, while a few classroom doors stand open, letting the sound of distant chatter and lessons drift into the corridor.", "", {"n", "w"}, {219, -1, 217, -1}},
-    {219, "Commons", "The high school Commons area is a spacious, open spot with clusters of tables and chairs where students gather to eat and socialize. Large windows let in plenty of natural light, brightening the space, while colorful school banners hang from the walls, adding a touch of school spirit. Today, however, the room stands empty save for the occasional passing staff member.", "", {"n", "e", "s"}, {220, 240, -1, 218}},
-    {220, "A Hall", "Just outside the IT Office in A Hall, the corridor is lined with a few bulletin boards displaying tech-related announcements and flyers. The area is quieter than the rest of the hall, with the faint sound of typing and the hum of computer equipment coming from behind the IT Office door.", "", {"n", "w", "s"}, {223, -1, 221, 219}},
-    {221, "IT Office", "The IT Office is a small, cluttered space with desks covered in computer parts, cables, and monitors. The walls are lined with shelves holding stacks of software manuals and spare equipment, while a couple of chairs sit in the corner for students seeking tech help.", "[talk] talk to the IT Specialist\r\n[lunch] Drop off lunch.\r\n", {"lunch", "talk", "e", "w"}, {-1, 220, 222, -1}},
-    {222, "Server Room", "This server room is more like a closet that someone mounted a rack in. Switches and servers are stacked to the ceiling, humming away. There is a KVM with one of the servers already logged in and on the desktop.", "[insert] eInsert USB into one of the servers\r\n", {"insert", "e"}, {-1, 221, -1, -1}},
-    {223, "Intersection of A Hall and B Hall", "At the intersection of A Hall and B Hall, where B Hall extends eastward, the tiled floor leads toward a row of lockers and classroom doors. The area is well-lit, with bright overhead lights reflecting off the polished surfaces and casting a steady glow down the corridors.", "", {"n", "e", "s"}, {226, 224, -1, 220}},
-    {224, "B Hall", "B Hall stretches toward the east, leading to the gym, with rows of lockers lining the walls and a few benches placed along the way. The bright overhead lights reflect off the polished tile floor, guiding the path toward the double doors at the gym entrance.", "", {"e", "w"}, {-1, 225, 223, -1}},
-    {225, "Gymnasium", "The high school gymnasium is a spacious, echoing room  with polished hardwood floors and bleachers that stretch along the walls. Banners in school colors hang from the rafters, while the large scoreboard and basketball hoops stand ready for the next game or practice. You notice an out of place piece of paper sitting on the bleachers.", "[pickup] pickup recovery instructions - page 3\r\n", {"pickup", "w"}, {-1, -1, 224, -1}},
-    {226, "Intersection of A Hall and C Hall", "At the intersection of A Hall and C Hall, the corridors branch off in different directions, with C Hall leading toward a quieter section of the school. The walls are lined with bulletin boards showcasing student achievements, and the floor tiles form a subtle pattern that guides the way through the well-lit space.", "", {"n", "w", "s"}, {230, -1, 227, 223}},
-    {227, "C Hall", "C Hall is a quieter corridor with fewer classrooms, where bulletin boards display posters for the upcoming play alongside student artwork. The soft lighting and neatly arranged lockers give it a calm atmosphere, leading gradually toward the less busy sections of the school", "", {"e", "w"}, {-1, 226, 228, -1}},
-    {228, "C Hall", "C Hall is a quieter corridor with fewer classrooms, where bulletin boards display posters for the upcoming play alongside student artwork. The soft lighting and neatly arranged lockers give it a calm atmosphere, leading gradually toward the less busy sections of the school. To the west, the Auditorium doors stand open.", "", {"e", "w"}, {-1, 227, 229, -1}},
-    {229, "Auditorium", "The auditorium is dimly lit, with rows of plush seats facing the stage, which is set for the upcoming play, The Wizard of Oz. The stage is adorned with colorful backdrops of a whimsical yellow brick road and vibrant green Emerald City, while props like a scarecrow and tin man stand ready in the wings, waiting for their turn in the spotlight. As you explore the stage you discover part of the recovery instructions disguised as a playbill.", "[pickup] pickup recovery instructions - page 2\r\n", {"pickup", "e"}, {-1, 228, -1, -1}},
-    {230, "Intersection of A Hall and D Hall", "A Hall and D Hall intersect at a busy corner where students often pause between classes, with D Hall leading toward the science labs. The walls are lined with educational posters and club announcements, while a few benches provide spots to sit beneath the bright overhead lights that illuminate the well-worn tiled floors.", "", {"n", "e", "s"}, {233, 231, -1, 226}},
-    {231, "D Hall", "D Hall is lined with science classrooms and labs, with posters of the periodic table and scientific diagrams decorating the walls. The bright lights overhead reflect off the tiled floor, leading the way down a corridor that feels focused and studious.", "", {"e", "w"}, {-1, 232, 230, -1}},
-    {232, "D Hall", "D Hall is lined with science classrooms and labs, with posters of the periodic table and scientific diagrams decorating the walls. The bright lights overhead reflect off the tiled floor, leading the way down a corridor that feels focused and studious.", "", {"w"}, {-1, -1, 231, -1}},
-    {233, "Intersection of A Hall and E Hall", "At the intersection of A Hall and E Hall, the atmosphere is lively, with E Hall extending toward the technology classrooms and labs. The walls are adorned with posters showcasing tech projects and innovations, while lockers line both sides of the corridor, creating a vibrant space filled with creativity and modern learning.", "", {"n", "w", "s"}, {238, -1, 234, 230}},
-    {234, "E Hall", "E Hall is a dynamic corridor dedicated to technology, lined with classrooms equipped for hands-on learning and innovation. Colorful posters featuring tech projects and coding concepts decorate the walls, while tables and workstations stand ready for future collaborations and creative projects in this energetic space.", "", {"e", "w"}, {-1, 233, 235, -1}},
-    {235, "Intersection of E Hall and Computer Lab Hallway", "At the intersection of E Hall and the Computer Lab hallway, the space buzzes with potential, featuring large windows that let in natural light. The walls are adorned with tech-related posters, while nearby doors lead to the computer labs, promising a hub of digital creativity and learning.", "", {"n", "e"}, {236, 234, -1, -1}},
-    {236, "Computer Lab Hallway", "At the intersection of E Hall and the Computer Lab hallway, the space buzzes with potential, featuring large windows that let in natural light. The walls are adorned with tech-related posters, while nearby doors lead to the computer labs, promising a hub of digital creativity and learning.", "", {"n", "s"}, {237, -1, -1, 235}},
-    {237, "Computer Lab", "The computer lab is a bright, modern space filled with rows of sleek desktop computers, each equipped with the latest software for students to use. Large windows provide ample natural light, while bulletin boards display coding tips and project guidelines, creating an inviting atmosphere for learning and collaboration. Attached to the whiteboard is a page of the recovery instructions.", "[pickup] pickup recovery instructions - page 1\r\n", {"pickup", "s"}, {-1, -1, -1, 236}},
-    {238, "Intersection of A Hall and F Hall", "At the intersection of A Hall and F Hall, the atmosphere shifts to a literary focus, with F Hall leading toward the English classrooms. The walls are decorated with inspiring quotes from famous authors and displays of student writing, creating a warm and inviting space for discussions about literature and language.", "", {"e", "s"}, {-1, 239, -1, 233}},
-    {239, "F Hall", "F Hall is a welcoming corridor dedicated to English studies, lined with classrooms adorned with posters of classic literature and contemporary authors. The walls feature displays of student writing and poetry, creating an inspiring atmosphere where creativity and critical thinking thrive, while cozy reading nooks invite quiet reflection.", "", {"w"}, {-1, -1, 238, -1}},
-    {240, "Lunch Room", "The high school lunchroom is quiet, with staff members scattered at the long tables, taking a break or catching up with each other. The room feels calm, with only the occasional murmur of conversation and the clink of coffee mugs breaking the stillness, while posters on the walls add a touch of color to the space. Brown bag lunches for the staff sit on one of the tables.", "[pickup] pickup lunch for IT Specialist\r\n", {"pickup", "e", "w"}, {-1, 241, 219, -1}},
-    {241, "Kitchen", "The high school kitchen is a bustling space with stainless steel counters, large ovens, and the hum of industrial appliances. Trays of food are prepared in neat rows, while the aroma of freshly cooked meals fills the air. A suspiciously out of place cookbook sits on the cutting board with a piece of paper sticking out.", "[pickup] pickup recovery instructions - page 4\r\n", {"pickup", "w"}, {-1, -1, 240, -1}},
-    {242, "Room 242", "Empty Room # 242", "", {}, {-1, -1, -1, -1}},
-    {243, "Room 243", "Empty Room # 243", "", {}, {-1, -1, -1, -1}},
-    {244, "Room 244", "Empty Room # 244", "", {}, {-1, -1, -1, -1}},
-    {245, "Room 245", "Empty Room # 245", "", {}, {-1, -1, -1, -1}},
-    {246, "Room 246", "Empty Room # 246", "", {}, {-1, -1, -1, -1}},
-    {247, "Room 247", "Empty Room # 247", "", {}, {-1, -1, -1, -1}},
-    {248, "Room 248", "Empty Room # 248", "", {}, {-1, -1, -1, -1}},
-    {249, "Room 249", "Empty Room # 249", "", {}, {-1, -1, -1, -1}}, // End of Newton
-    {250, "Highway to Wichita from Ellsworth", "You are on the highway leading from Ellsworth to Wichita. The open road stretches ahead, bordered by rolling plains and the occasional cluster of trees. The sun shines brightly, and a few cars pass by. At a nearby rest stop, travelers refill their water bottles, some of them grimacing at the odd taste and murmuring about the water quality in Ellsworth.", "", {"n", "s"}, {253, -1, -1, 478}},
-    {251, "Highway 70 to Goodland and Ellsworth", "You find yourself on Highway 70, heading west toward Goodland. The landscape is a mosaic of golden fields under a vast sky. Billboards advertise local attractions, but one catches your eye: 'Ellsworth Water Issues—Bottled Water Available Ahead.' A couple at a roadside stand discuss the strange taste of the water they've encountered.", "", {"e", "w"}, {-1, 289, 301, -1}},
-    {252, "Highway between Ellsworth and Topeka", "This stretch of Highway 70 leads east toward Topeka. The journey is serene, with miles of open road and distant horizons. A family pulls over to check their map, the kids complaining about the funny taste in their water bottles. The parents exchange worried glances, mentioning the recent news about Ellsworth's water supply.", "", {"e", "w"}, {-1, 77, 288, -1}},
-    {253, "Douglas Avenue", "Douglas Avenue serves as both a main street and a highway extending beyond the city center. The avenue is lined with quaint shops and historic buildings. Locals stroll along the sidewalks, though you notice some conversations are tinged with concern over the peculiar taste of the town's water. A dog refuses to drink from a puddle, sniffing it cautiously.", "", {"n", "s"}, {254, -1, -1, 250}},
-    {254, "Douglas and Main", "At the bustling intersection of Douglas and Main, small shops display colorful awnings and inviting window displays. The aroma of fresh bread wafts from a nearby bakery. People gather in small groups, some sipping from cups and grimacing. A passerby comments, 'Have you noticed something off about the water lately?'", "", {"n", "e", "w", "s"}, {255, 274, 287, 253}},
-    {255, "Douglas Avenue", "Continuing along Douglas Avenue, the heart of the town reveals its charm. Flower boxes adorn windows, and benches offer rest beneath shady trees. A few residents chat outside a café, but the usual cheer is dampened. 'My coffee tastes strange today,' one remarks. 'Must be something in the water.'", "", {"n", "s"}, {256, -1, -1, 254}},
-    {256, "Douglas Avenue", "Douglas continues to the north and south, to the east is the entrance of the Ellsoworth Municipal Water Supply administrative offices.", "", {"n", "e", "s"}, {258, 257, -1, 255}},
-    {257, "Ellsworth Water Supply", "You arrive at the modest administrative office of the city water company. The building is unassuming, with a simple sign above the door. Inside, employees are abuzz with activity, their faces etched with concern. A worker steps out, shaking his head as he takes a sip from a bottle. 'We need to fix this water issue soon,' he mutters. Papers are strewn across the desk, and a map of the city's water lines hangs on the wall. A green keycard lies conspicuously on the desk. The manager looks stressed, rubbing his temples. 'If only we could pinpoint the problem,' he sighs.", "[keycard] A green keycard is on the desk.\r\n", {"keycard", "w"}, {-1, -1, 256, -1}},
-    {258, "Douglas Avenue", "Douglas Avenue continues, with Second Street branching off to the east. The street is lively, but there's an undercurrent of unease. A group of teenagers gathers around a fountain, daring each other to taste the water. Their reactions range from disgust to concern, and they quickly move on.", "", {"n", "e", "s"}, {275, 259, -1, 256}},
-    {259, "Third Street", "Third Street is a quieter thoroughfare lined with modest homes and small businesses. Children play on the sidewalks, but you overhear a parent calling out, 'Don't drink from the hose today!' The kids nod, seemingly aware of the issue.", "", {"e", "w"}, {-1, 260, 258, -1}},
-    {260, "Lincoln Avenue", "Lincoln Avenue stretches north and south, serving as a boundary between residential areas and the industrial sector. To the west, behind a chain-link fence, is the water facility. To the east, the water treatment plant looms. A delivery truck pulls up, unloading cases of bottled water to meet the sudden demand.", "", {"n", "w", "s"}, {261, -1, 259, 273}},
-    {261, "Lincoln Avenue", "As you proceed along Lincoln Avenue, the fencing of the water treatment plant dominates the eastern side. A worker stands outside, speaking urgently into a phone. 'No, we haven't found the source yet,' he says. 'People are getting sick.' The gravity of the situation is palpable.", "", {"n", "s"}, {262, -1, -1, 260}},
-    {262, "Fourth Street", "At the intersection of Fourth Street and Lincoln Avenue, the traffic is sparse. The water treatment plant's proximity is evident, with pipes and machinery visible beyond the fence. A cyclist stops to refill his bottle at a public tap, but after one sip, he spits it out, disgusted.", "", {"e", "w", "s"}, {-1, 263, 277, 261}},
-    {263, "Fourth Street", "Fourth Street continues, lined with tall oaks that cast dappled shadows on the pavement. The usual sounds of the neighborhood are subdued. A utility worker checks a hydrant, shaking his head after testing the water. 'This isn't good,' he mutters.", "", {"e", "w"}, {-1, 264, 262, -1}},
-    {264, "Fourth Street", "Approaching the water treatment plant, you notice an increased security presence. The air carries a faint chemical scent. A jogger passes by, her face scrunched in discomfort as she sips from a water bottle. 'Tastes awful,' she exclaims to no one in particular.", "", {"e", "w", "s"}, {-1, 266, 263, 265}},
-    {265, "Ellsworth Water Treatment Plant", "Standing at the entrance to the water treatment plant, a security guard scrutinizes you. 'State your business,' he says firmly. Behind him, the facility buzzes with activity. Workers move hurriedly, and alarms can be faintly heard from within. 'We've got a situation here,' the guard adds.", "[checkin] Check in with the guard.\r\n", {"checkin", "n", "s"}, {264, -1, -1, 291}},
-    {266, "Fourth Street", "Fourth Street here is lined with cozy homes and well-tended gardens. Residents are out on their porches, discussing the latest news. 'I had to throw out my entire pot of soup,' one woman complains. 'The water made it taste terrible.' Her neighbor nods in sympathy.", "", {"e", "w"}, {-1, 267, 264, -1}},
-    {267, "Fourth and Washington", "At the intersection of Fourth Street and Washington Avenue, a small grocery store stands on the corner. A sign in the window reads, 'Bottled Water Sold Out.' A delivery truck unloads crates, but they're quickly snatched up by anxious customers.", "", {"w", "s"}, {-1, -1, 266, 268}},
-    {268, "Washington Avenue", "Washington Avenue runs north and south, lined with charming houses. A mail carrier makes his rounds, but pauses to take a sip from his flask. He grimaces, muttering about the water's odd taste. 'Maybe I should switch to coffee,' he jokes half-heartedly.", "", {"n", "s"}, {267, -1, -1, 269}},
-    {269, "Washington Avenue", "Continuing along Washington Avenue, you notice lawns turning brown despite the sprinklers running. 'I turned mine off,' a man says to his neighbor. 'No point in using bad water on the grass.' The neighbor agrees, mentioning his plants aren't faring well either.", "", {"n", "s"}, {268, -1, -1, 270}},
-    {270, "Washington and Main", "You arrive at the intersection of Washington Avenue and Main Street. The city park to the east beckons with lush greenery, but fewer people are enjoying it today. Conversations you overhear revolve around the water issue, with speculation about the cause.", "", {"n", "e", "w"}, {269, 271, 272, -1}},
-    {271, "Ellsworth City Park", "The city park is usually a haven of relaxation, with children playing and families picnicking. Today, the atmosphere is subdued. The groundskeeper diligently tends to the flowerbeds, but pauses frequently to wipe his brow. 'Can't even enjoy a drink of water on a day like this,' he laments.", "[soda] Offer a soda to the groundskeeper\r\n", {"soda", "w"}, {-1, -1, 270, -1}},
-    {272, "Main Street", "Main Street is lined with small businesses and cafés, but many have signs indicating early closures. A coffee shop has a notice: 'Closed due to water quality issues.' Patrons outside discuss traveling to nearby towns for supplies.", "", {"e", "w"}, {-1, 270, 273, -1}},
-    {273, "Main and Lincoln", "At the intersection of Main Street and Lincoln Avenue, the impact of the water issue is evident. A newspaper stand displays headlines about the crisis. A crowd gathers around a reporter conducting interviews. 'How has the water affected you?' she asks.", "", {"n", "e", "w"}, {260, 272, 274, -1}},
-    {274, "Main Street", "This section of Main Street is quieter than usual. Shopkeepers stand outside, watching the sparse foot traffic. A baker sweeps his doorstep, sighing. 'Can't bake without clean water,' he says to a passerby. The smell of fresh bread is notably absent.", "", {"e", "w"}, {-1, 273, 254, -1}},
-    {275, "Douglas Avenue", "Douglas Avenue continues northward, with Third Street branching off to the west. A water distribution truck is parked nearby, handing out supplies to grateful residents. 'Thank you,' a woman says, cradling a case of bottled water. 'We were down to our last drop.'", "", {"n", "w", "s"}, {276, -1, 282, 258}},
-    {276, "Douglas Avenue", "Further along Douglas Avenue, Fourth Street heads off to the east. The atmosphere grows more industrial, with warehouses and factories. Workers stand outside, discussing how the water issue has halted production. 'We can't operate under these conditions,' one says.", "", {"n", "e", "s"}, {278, 277, -1, 275}},
-    {277, "Fourth Street", "Fourth Street here is less traveled, leading toward the outskirts of town. A sign warns of roadwork ahead. The silence is broken only by the distant hum of machinery from the water treatment plant.", "", {"e", "w"}, {-1, 262, 276, -1}},
-    {278, "Douglas Avenue", "Douglas Avenue continues toward the northern edge of town, where it transitions into open highways. The Speedy Store gas station to the west is a hub of activity. Customers exit with bags of snacks but no beverages. 'All out of drinks,' one complains. 'Even the soda fountain is down.'", "", {"n", "w", "s"}, {280, -1, 279, 276}},
-    {279, "Ellsworth Speedy Store", "The gas station is bustling, but tension hangs in the air. The clerk informs customers that they've run out of bottled water and soft drinks. A sign on the door reads, 'Due to the water issue, we are unable to provide fountain drinks.' Patrons leave disappointed.", "[soda] Get a soda for only $0.88\r\n", {"soda", "e"}, {-1, 278, -1, -1}},
-    {280, "Douglas Avenue", "At the northern edge of Ellsworth, Douglas Avenue begins to merge into the highway. The open road beckons, but some travelers hesitate. A family debates whether to continue or return to town for supplies. 'I heard the next town over isn't affected,' one says hopefully.", "", {"n", "s"}, {281, -1, -1, 278}},
-    {281, "Highway 70", "You stand at the junction of Highway 70, a major east-west route across Kansas. An exit sign points south toward Ellsworth. The rest area here is crowded with vehicles. A vendor sells bottled water at inflated prices, taking advantage of the situation. Drivers grumble but purchase them nonetheless.", "", {"e", "w", "s"}, {-1, 288, 289, 280}},
-    {282, "Third Street", "Third Street here is lined with quaint houses and a small playground. The swings sway gently in the breeze, but no children are playing. A fountain in the park is taped off, a sign reading 'Do Not Use—Water Contaminated.' The stillness is eerie.", "", {"e", "w"}, {-1, 275, 283, -1}},
-    {283, "Third and Grand", "Third Street is closed further west, directing traffic south to Grand Avenue. Barricades block the way, and detour signs point the new route. A construction worker sits nearby, sipping from a canteen and grimacing. 'Can't even get a decent drink on the job,' he says.", "", {"e", "s"}, {-1, 282, -1, 284}},
-    {284, "Grand Avenue", "Grand Avenue is shaded by towering trees, offering a respite from the sun. The post office to the east is busier than usual. People queue up, many holding letters addressed to city officials, presumably voicing their concerns about the water.", "", {"n", "e", "s"}, {283, 285, -1, 286}},
-    {285, "Post Office", "Inside the small-town post office, the atmosphere is tense. The clerk sorts through piles of mail, glancing up as you enter. 'If you're here about the water notices, we just sent them out,' she says. A bulletin board lists updates on the situation.", "[pobox] Check your P.O. Box\r\n", {"pobox", "w"}, {-1, -1, 284, -1}},
-    {286, "Main Street", "Main Street resumes here, heading east toward the town center. The homes are charming, but many display signs reading 'No Water Available.' Neighbors converse on porches, sharing what little information they have. Hope mingles with frustration in their voices.", "", {"n", "e"}, {284, 287, -1, -1}},
-    {287, "First Street", "At the intersection of First Street and Main, the town feels almost deserted. Businesses are closed or operating on limited hours. A notice board is covered with flyers about water distribution points and safety precautions. The weight of the crisis is evident.", "", {"e", "w"}, {-1, 254, 286, -1}},
-    {288, "Highway 70", "Traveling east on Highway 70, the open road is a stark contrast to the troubled town behind you. Signs warn of 'Water Issues in Ellsworth—Stock Up Before Entering.' A truck loaded with bottled water speeds past, heading toward the town.", "", {"e", "w"}, {-1, 252, 281, -1}},
-    {289, "Highway 70", "Heading west on Highway 70, the scenery is a blur of fields and sky. A rest stop ahead advertises clean facilities and potable water—a relief for travelers. A family refills their bottles, relieved to find the water here tastes normal.", "", {"e", "w"}, {-1, 281, 251, -1}},
-    {290, "Office", "This small office belongs to the manager of the municipal water company. He sits at his desk, surrounded by stacks of reports and water sample analyses. His face is drawn with fatigue. 'We've never seen anything like this,' he says quietly. 'Someone is tampering with our system.'", "", {"w"}, {-1, -1, 256, -1}},
-    {291, "Lobby", "The lobby of the water treatment plant is a hive of activity. The receptionist handles a barrage of phone calls, her expression strained. 'We're doing everything we can,' she repeats to callers. The tension in the air is palpable.", "[talk] Talk to the receptionist\r\n", {"talk", "n", "e", "w"}, {265, 293, 295, -1}},
-    {292, "Hallway", "This unremarkable hallway is lined with doors leading to various offices. The walls are adorned with safety posters and procedural charts. A janitor mops the floor, whistling softly to break the silence.", "", {"w"}, {-1, -1, 291, -1}},
-    {293, "Hallway", "The hallway here is quieter, leading toward the plant manager's office to the south. A bulletin board displays memos and urgent notices. One catches your eye: 'Unauthorized Access Detected—Report Suspicious Activity Immediately.'", "", {"w", "s"}, {-1, -1, 291, 294}},
-    {294, "Plant Manager's Office", "The plant manager's office is cluttered with blueprints and technical manuals. He stands over a desk covered in charts, his eyes scanning for answers. 'We need to find the source of this hack,' he says determinedly. 'People are counting on us.'", "[talk] Talk to the plant manager.\r\n", {"talk", "n"}, {293, -1, -1, -1}},
-    {295, "Hallway", "This corridor leads to the control room to the south. The lighting flickers slightly, and the hum of machinery grows louder. A sense of urgency permeates the air. Technicians hurry past, their faces grim.", "", {"e", "s"}, {-1, 291, -1, 296}},
-    {296, "Control Room", "The control room is the nerve center of the water treatment plant. Monitors display a barrage of data, much of it flashing red alerts. The lead technician barely acknowledges your presence. 'Systems are compromised,' he says. 'Someone's manipulating the chemical levels remotely.'", "[talk] Talk to the lead technician.\r\n", {"talk", "n", "s"}, {295, -1, -1, 297}},
-    {297, "Quality Control", "In the quality assurance area, technicians scramble to analyze water samples. Test tubes and beakers clutter the workspaces. 'Contaminant levels are off the charts,' one exclaims. 'We have to shut down the supply before more people get sick.'", "[check] Check the levels\r\n", {"check", "n", "e"}, {296, 298, -1, -1}},
-    {298, "Additive Control Room", "This room controls the additives introduced into the water supply. Alarms beep incessantly, and control panels flash warnings. The network closet to the north is ajar, cables haphazardly connected. 'This isn't supposed to be open,' a technician remarks.", "[restore] Restore the levels to the previously known good configuration.\r\n", {"restore", "n", "w"}, {299, -1, 297, -1}},
-    {299, "Network Closet", "The small network closet is cramped and hot. Servers and routers blink methodically, but an unauthorized laptop is connected to the system. Lines of malicious code scroll across its screen. This is the source of the hack affecting the water treatment plant.", "[unplug] Unplug the suspicious laptop.\r\n", {"unplug", "s"}, {-1, -1, -1, 298}},
-    {300, "Goodland and Dodge City", "You are on the highway stretching between Goodland and Dodge City. The open road is flanked by vast expanses of prairie land, with the horizon stretching endlessly ahead. The sky is a brilliant blue, and occasional clusters of trees break the monotony of the flat landscape. The hum of distant traffic is faint, but you notice an unusual number of robot taxis zipping by, their sensors blinking as they navigate autonomously.", "", {"n", "s"}, {302, -1, -1, 350}},
-    {301, "Goodland and Ellsworth", "This is the highway that connects Goodland to Ellsworth. The road here is smooth, with freshly painted lines guiding the way. Fields of sunflowers sway gently in the breeze on either side. A few robot taxis pass by, their sleek designs reflecting the sunlight. They seem to be heading toward Goodland, joining the growing number of autonomous vehicles in the area.", "", {"e", "w"}, {-1, 251, 302, -1}},
-    {302, "Highway 70", "You find yourself on Highway 70, a major artery running east and west. Traffic is heavier here, but something unusual catches your attention—a robot taxi is stuck in the middle of the road, completely unmoving. Its hazard lights flash rhythmically, and an audible alert broadcasts from its speakers, echoing across the highway. Other vehicles cautiously maneuver around it, but the robot taxi remains unresponsive.", "[alert] An alert is being broadcast from the taxi.\r\n[taxi] Attempt to help the taxi.\r\n", {"alert", "taxi", "e", "w", "s"}, {-1, 301, 303, 300}},
-    {303, "Highway 70", "Highway 70 continues here, stretching into the distance both east and west. The flow of traffic is steady, with an assortment of vehicles, but robot taxis are noticeably prevalent. They move in coordinated patterns, their navigation systems seemingly synced. The hum of engines and the occasional honk create a symphony of highway sounds.", "", {"n", "e", "w"}, {304, 302, 305, -1}},
-    {304, "Caldwell Avenue", "Caldwell Avenue intersects here, with Highway 24 crossing to the north and Highway 70 to the south. To the east stands a colossal easel holding a massive reproduction of Vincent van Gogh's famous painting. The giant artwork towers above, its vibrant colors contrasting against the sky. Robot taxis occasionally pause nearby, as if programmed to appreciate the cultural landmark.", "[painting] Inspect the large Vincent van Gogh painting.\r\n", {"painting", "n", "s"}, {322, -1, -1, 303}},
-    {305, "Highway 70", "On this stretch of Highway 70, the cityscape of Goodland emerges to the north, while open fields extend to the south. The road is dotted with robot taxis, their presence becoming more concentrated as you approach the city. Some taxis seem to glitch, slowing down unexpectedly or swerving slightly before correcting their course.", "", {"e", "w"}, {-1, 303, 306, -1}},
-    {306, "Highway 70 and Commerce Road", "The highway here is partially closed further to the west, with barriers and warning signs indicating construction or an incident. To the east, Highway 70 remains open. An exit ramp to the north leads to Commerce Road, where clusters of small stores and shops can be seen. A few robot taxis take the exit, merging seamlessly onto Commerce Road.", "", {"n", "e"}, {307, 305, -1, -1}},
-    {307, "Commerce Road", "Commerce Road extends northward, lined with an array of small shops, restaurants, and fast-food outlets. The sidewalks are bustling with people, but the roads are dominated by robot taxis, weaving between human-driven cars with calculated precision. To the south, the major Highway 70 hums with constant traffic.", "", {"n", "s"}, {308, -1, -1, 306}},
-    {308, "Commerce Road and Highway 24", "At this busy intersection, Commerce Road continues north and south, while Highway 24 leads east through town. To the west, a large retailer and warehouse store looms, its parking lot filled with both conventional vehicles and idle robot taxis. The taxis seem to congregate here, some entering and exiting the parking area in an endless loop.", "", {"n", "e", "s"}, {309, 327, -1, 307}},
-    {309, "Commerce Road", "Commerce Road continues to stretch north and south, flanked by various shopping centers and eateries. The street is lively, but a sense of unease lingers as more robot taxis appear, some displaying erratic behavior—stopping abruptly or circling blocks repeatedly.", "", {"n", "s"}, {310, -1, -1, 308}},
-    {310, "Commerce Road", "This portion of Commerce Road is lined with specialty stores and boutique shops. Pedestrians window-shop, occasionally glancing warily at the increasing number of robot taxis passing by. A few taxis have pulled over, their hazard lights flashing, causing minor disruptions in traffic.", "", {"n", "s"}, {311, -1, -1, 309}},
-    {311, "Commerce Road", "Commerce Road here seems unusually congested. Robot taxis dominate the lanes, some moving at a crawl, others idling at odd angles. The storefronts reflect in their polished exteriors as they navigate the crowded street. Frustrated drivers honk horns, adding to the growing cacophony.", "", {"n", "s"}, {312, -1, -1, 310}},
-    {312, "Commerce and County Road", "At this junction, Commerce Road veers off to the northeast, but access is blocked by temporary roadblocks. Signs warn of road closures ahead. To the east, a small county road leads toward the airport. A line of robot taxis is queued up at the barricade, their engines idling as if awaiting new instructions.", "", {"e", "s"}, {-1, 313, -1, 311}},
-    {313, "County Road", "You travel along a quiet county road, flanked by sprawling farmland. Golden fields stretch to the horizon, interrupted only by the occasional farmhouse. In the distance to the east, the airport is visible, with small planes descending gracefully. A few robot taxis cruise along the road, seemingly out of place in this rural setting.", "", {"e", "w"}, {-1, 314, 312, -1}},
-    {314, "County Road and Main Avenue", "At this intersection, the county road branches south toward Main Avenue, leading into the town center. The area is serene, but you notice a cluster of robot taxis gathered near the crossroads, their movements synchronized as if following a shared directive.", "", {"e", "w", "s"}, {-1, 315, 313, 339}},
-    {315, "County Road", "Continuing east on the county road, the landscape begins to shift. The town becomes more prominent to the south, with rooftops and spires breaking the skyline. To the east, the airport grows nearer, and you can hear the distant roar of aircraft engines. A few robot taxis are parked along the roadside, their engines silent.", "", {"e", "w"}, {-1, 316, 314, -1}},
-    {316, "County Road", "The county road stretches westward behind you, while to the east lies Airport Road. To the south, Caldwell Avenue beckons with the promise of urban life. Robot taxis are more prevalent here, some heading toward the airport, others inexplicably looping back toward the town.", "", {"e", "w", "s"}, {-1, 317, 315, 318}},
-    {317, "Airport Road", "You arrive at the airport, where the parking lot is a chaotic scene. Dozens of automated self-driving taxis are gridlocked, each attempting to enter the taxi parking lot to the north. Their sensors seem confused, causing them to jostle for position without making progress. The air is filled with electronic chimes and the whirring of electric motors.", "[taxi] Attempt to help the taxi.\r\n[ticket] A discarded plane ticket is on the ground.\r\n", {"taxi", "ticket", "n", "w"}, {349, -1, 316, -1}},
-    {318, "Caldwell Avenue", "Caldwell Avenue continues southward from here, with the town becoming denser. To the west, the fairgrounds are visible, but unusually, the area is swarming with robot taxis. They move in seemingly random patterns, some circling the grounds while others remain stationary with hazard lights flashing.", "", {"n", "w", "s"}, {316, -1, 340, 319}},
-    {319, "Caldwell Avenue", "As you proceed along Caldwell Avenue, you notice a robot taxi stopped in the middle of the road, hazard lights blinking. It causes a minor traffic jam as other vehicles navigate around it. To the west, 5th Street branches off, leading deeper into the town.", "", {"n", "w", "s"}, {318, -1, 343, 320}},
-    {320, "Caldwell Avenue", "Caldwell Avenue continues here, intersecting with 10th Street to the west. The number of robot taxis increases noticeably. Some are parked haphazardly along the curbs, while others glide silently down the street. Pedestrians watch them with a mix of curiosity and concern.", "", {"n", "w", "s"}, {319, -1, 348, 321}},
-    {321, "Caldwell Avenue", "The avenue stretches north and south, but the atmosphere is tense. To the west, 13th Street offers a route away from the main thoroughfare. Robot taxis are clustered at the intersection, their movements erratic. One taxi circles the block repeatedly, while another idles indefinitely.", "", {"n", "w", "s"}, {320, -1, 329, 322}},
-    {322, "Caldwell and Highway 24", "You reach the major intersection of Caldwell Avenue and Highway 24. The crossroads is bustling, but robot taxis dominate the traffic. They move with mechanical precision yet lack the adaptability of human drivers, causing subtle disruptions. The townsfolk seem wary, casting uneasy glances at the autonomous vehicles.", "", {"n", "w", "s"}, {321, -1, 323, 304}},
-    {323, "Highway 24", "Highway 24 extends east and west here, lined with body shops, auto repair centers, and car dealerships. The businesses are busy, but many seem preoccupied with servicing robot taxis. The vehicles queue up outside garages, awaiting maintenance or repairs, their digital displays flashing diagnostic messages.", "", {"e", "w"}, {-1, 322, 324, -1}},
-    {324, "Highway 24", "This section of Highway 24 is particularly congested with robot taxis heading toward an auto repair shop to the north. The taxis enter and exit the facility in a steady stream. Mechanics and technicians work tirelessly, their faces showing signs of fatigue. The constant hum of electric motors fills the air.", "", {"n", "e", "w"}, {325, 323, 326, -1}},
-    {325, "Auto Repair Shop", "Inside the auto repair shop, the space has been transformed to accommodate electric and automated taxis. Advanced computer systems and electronic equipment occupy every corner. A robot taxi in the garage attempts to plug itself into a charging station, its connectors fumbling as if misaligned. Technicians rush about, managing repairs and software updates.", "[talk] Talk to the repair tech.\r\n", {"talk", "s"}, {-1, -1, -1, 324}},
-    {326, "Highway 24", "Highway 24 continues here, but the atmosphere is unsettling. Robot taxis dominate the roadway, some moving erratically. A few taxis have stopped altogether, their systems seemingly in standby mode. Other drivers navigate cautiously, unsure of the autonomous vehicles' next moves.", "", {"e", "w"}, {-1, 324, 327, -1}},
-    {327, "Highway 24", "At this point on Highway 24, to the north is a popular restaurant named 'The Kitchen.' The parking lot is filled, not just with patrons' cars but also with robot taxis, many of which have their hazard lights on. Some taxis block parking spaces or entrances, causing frustration among visitors.", "[taxi] Attempt to help the taxi.\r\n", {"taxi", "n", "e", "w"}, {328, 326, 308, -1}},
-    {328, "The Kitchen", "You step into 'The Kitchen,' a cozy restaurant known for its homestyle cooking. The aroma of freshly prepared meals fills the air. Despite the chaos outside, the interior is warm and inviting. Patrons discuss the unusual behavior of the robot taxis over hearty meals.", "", {"s"}, {-1, -1, -1, 327}},
-    {329, "13th Street", "13th Street extends westward from here. The street is quieter, but the presence of robot taxis is still notable. They glide along the road, occasionally pausing inexplicably before resuming their routes. Residents watch from their porches, uneasy about the growing number of autonomous vehicles.", "", {"e", "w"}, {-1, 321, 330, -1}},
-    {330, "13th Street", "On this stretch of 13th Street, a telecommunications services office building stands to the south. The building appears busy, with employees moving hurriedly inside. Some workers step outside to make calls, their expressions tense. Robot taxis occasionally pull up to the curb before driving off moments later.", "", {"e", "w", "s"}, {-1, 329, 332, 331}},
-    {331, "Telecom Services", "Inside the telecommunications office, the atmosphere is frantic. Employees dart between offices and cubicles, phones pressed to their ears. Multiple technicians juggle calls and monitor screens displaying network statuses. The surge in robot taxi activity seems to be straining communication networks.", "[talk] Talk to the technician.\r\n", {"talk", "n"}, {330, -1, -1, -1}},
-    {332, "13th and Broadway", "At the intersection of 13th Street and Broadway, traffic is heavier. Broadway runs north and south, serving as a main artery through town. Robot taxis are plentiful here, their presence causing subtle disruptions as they fail to adapt to changing traffic patterns as smoothly as human drivers.", "", {"n", "e", "w"}, {347, 330, 333, -1}},
-    {333, "13th Street", "13th Street continues, but the road ahead is partially blocked by a stalled robot taxi. Its hazard lights flash, and it emits a soft chime. Other vehicles maneuver around it carefully. The buildings along the street are a mix of residential homes and small businesses, their occupants observing the scene with concern.", "", {"e", "w"}, {-1, 332, 334, -1}},
-    {334, "Main and 13th Street", "You arrive at the corner of Main Avenue and 13th Street. The area is less congested, offering a brief respite from the robot taxi chaos. Trees line the sidewalks, and a few pedestrians stroll leisurely. The streetlights here have been retrofitted with sensors, possibly to accommodate the autonomous vehicles.", "", {"n", "e"}, {335, 333, -1, -1}},
-    {335, "Main Avenue", "Main Avenue stretches north and south, serving as one of the town's primary roads. The avenue is lined with office buildings and municipal services. The robot taxis are fewer here, but their presence is still noticeable. Some are parked along the street, engines idling silently.", "", {"n", "s"}, {336, -1, -1, 334}},
-    {336, "Main Avenue", "Continuing along Main Avenue, you reach the intersection with 10th Street to the east. The surroundings become more urban, with taller buildings and increased foot traffic. Robot taxis cruise by steadily, but here they seem to integrate more smoothly with traditional traffic.", "", {"n", "e", "s"}, {337, 346, -1, 335}},
-    {337, "Main Avenue", "This part of Main Avenue is lined with large office buildings and city service facilities. The architecture is modern, with glass facades and sleek designs. The sidewalks are busy with professionals, and robot taxis glide by, occasionally stopping to let passengers disembark. The integration of autonomous vehicles appears more seamless here.", "", {"n", "s"}, {339, -1, -1, 336}},
-    {338, "Room 338", "Empty Room #338", "", {}, {-1, -1, -1, -1}}, // Open room.
-    {339, "Main Avenue", "At this juncture, Main Avenue heads south, leading back toward the heart of the town. To the north, it connects with the county road that leads to the airport. Robot taxis are prevalent, many heading toward the airport or the town center. Their movements are methodical, but an undercurrent of unpredictability keeps people on edge.", "", {"n", "e", "s"}, {314, 341, -1, 337}},
-    {340, "The Fairgrounds", "The fairgrounds are alive with activity, hosting what appears to be a medieval-themed festival. People in elaborate costumes engage in mock battles, and vendors sell an array of foods and crafts. However, the festive atmosphere is marred by the presence of numerous robot taxis. They crowd the parking areas and even encroach upon pedestrian spaces, their hazard lights blinking as they attempt to navigate the congested grounds.", "[taxi] Attempt to help the taxi.\r\n[leg] Someone has left a perfectly intact turkey leg.\r\n", {"taxi", "leg", "e"}, {-1, 318, -1, -1}},
-    {341, "5th Street", "5th Street runs east and west here, serving as a quieter alternative to the busier main roads. The street is residential, with charming houses and well-kept lawns. Robot taxis occasionally pass by, but their numbers are fewer. Children play in yards under the watchful eyes of parents, who occasionally glance nervously at the autonomous vehicles.", "", {"e", "w"}, {-1, 342, 339, -1}},
-    {342, "5th and Broadway", "At the intersection of 5th Street and Broadway, the traffic intensifies. Broadway is bustling, and robot taxis are prominent once again. Some taxis hesitate at the intersection, causing minor delays. Pedestrians wait cautiously at crosswalks, ensuring the taxis come to complete stops before crossing.", "", {"e", "w", "s"}, {-1, 343, 341, 344}},
-    {343, "5th Street", "5th Street continues, connecting to Caldwell Avenue to the east and Broadway to the west. The road is moderately busy, but robot taxis are a common sight. One taxi appears to be circling the block repeatedly, its behavior drawing curious looks from bystanders.", "", {"e", "w"}, {-1, 319, 342, -1}},
-    {344, "Broadway", "Broadway here runs north and south, lined with shops, cafes, and businesses. The sidewalks are crowded, and the street is filled with both human-driven cars and robot taxis. The taxis move in organized patterns, but occasional glitches cause abrupt stops or unexpected turns.", "", {"n", "s"}, {342, -1, -1, 345}},
-    {345, "Broadway and 10th", "At the intersection of Broadway and 10th Street, the scene is chaotic. Robot taxis clog the intersection, some stalled with hazard lights flashing, others navigating unpredictably. Drivers honk in frustration, and pedestrians weave carefully through the congestion. The situation seems to be escalating.", "", {"n", "e", "w", "s"}, {344, 348, 346, 347}},
-    {346, "10th Street", "10th Street extends east and west, offering a respite from the congested Broadway. The street is less crowded, but robot taxis are still present. They move steadily, their routes seemingly unaffected by the disruptions elsewhere.", "", {"e", "w"}, {-1, 345, 336, -1}},
-    {347, "Broadway", "Broadway continues here, but the traffic is dense. Robot taxis are everywhere, and their numbers seem to be increasing. Some taxis have stopped altogether, causing bottlenecks. The air is filled with the sounds of idling engines and the occasional siren in the distance.", "", {"n", "s"}, {345, -1, -1, 332}},
-    {348, "10th Street", "On 10th Street, to the east is Caldwell Avenue, where robot taxis cluster in greater numbers. To the west is Broadway, currently congested with stalled taxis and frustrated drivers. The situation here is tense but slightly less chaotic.", "", {"e", "w"}, {-1, 320, 345, -1}},
-    {349, "Taxi Parking", "You arrive at a large taxi parking lot near the airport. The area is in disarray, with countless robot taxis vying for parking spaces. One taxi blocks the entrance entirely, its hazard lights flashing incessantly. Other taxis honk their electronic horns in a discordant symphony, their systems seemingly overwhelmed. The scene is a testament to the escalating issues with the autonomous fleet.", "[taxi] Attempt to help the taxi.\r\n", {"taxi", "s"}, {-1, -1, -1, 317}},
-    {350, "Welcome to Dodge City", "Welcome to Dodge City, where the spirit of the Old West thrives amidst modern times. Wooden facades of saloons and general stores line the dusty main street, evoking images of cowboys and outlaws. As you approach the town's welcome sign, you spot a dusty Flipper Zero device lying in the dirt, partially hidden under a tuft of dry grass. A tattered note is attached to it, the handwriting hurried: 'The Associate is in trouble. Use this to help him.' The device seems out of place in this rustic setting, its tiny screen flickering softly.", "[flipper] Take a look at the Flipper Zero\r\n", {"flipper", "n", "s"}, {300, -1, -1, 351}},
-    {351, "Main Street", "You step onto Main Street, the heart of Dodge City. The wooden boardwalk creaks underfoot, and the sun casts long shadows across the dusty road. To the west, the Sheriff's Office stands with its weathered sign swinging gently in the breeze. The scent of leather and gunpowder lingers in the air. In the distance to the southeast, the inviting glow of the saloon beckons travelers and locals alike. The town feels quiet but watchful, as if holding its breath.", "", {"n", "w", "s"}, {350, -1, 352, 354}},
-    {352, "Sheriff's Office", "The Sheriff's Office is a sturdy building of timber and stone, exuding authority. The front door is slightly ajar, and the interior is dimly lit. Inside, the desk is cluttered with wanted posters and a tarnished badge. An empty gun rack hangs on the wall. You notice the absence of the sheriff, but faint mumbling catches your attention from the jail cells to the west. The atmosphere is tense, as if secrets linger in the shadows.", "", {"e", "w"}, {-1, 351, 353, -1}},
-    {353, "Jail Block", "You enter the jail block, where iron bars separate freedom from captivity. The area is sparse, with only a small cot and a bucket in each cell. In one of the cells, a man sits quietly, dressed in a sharp black suit that contrasts with the rugged surroundings. He twiddles his thumbs thoughtfully. This must be 'The Associate.' He looks up as you approach, a glimmer of hope in his eyes. 'They've got me locked up,' he whispers. 'But with the right tools, perhaps you can set me free.'", "[replay] Replay a keycard with the Flipper Zero\r\n", {"replay", "e"}, {-1, 352, -1, -1}},
-    {354, "Main Street", "Back on Main Street, the town maintains its serene façade. The rustic buildings evoke a bygone era, but you notice subtle hints of modernity—a satellite dish discreetly mounted on a rooftop, an electric lamp post styled to look like gas lighting. The saloon to the east radiates warmth and the muffled sounds of piano music drift through its swinging doors. The path south leads further into the heart of Dodge City.", "", {"n", "e", "s"}, {351, 355, -1, 358}},
-    {355, "Saloon", "The saloon is a lively establishment that captures the essence of the Old West. Wooden tables and chairs fill the room, and a long bar runs along the eastern wall. Patrons clad in cowboy hats and boots converse over drinks, while a pianist plays a jaunty tune in the corner. At one of the tables, the sheriff sits engrossed in the local newspaper, a cup of coffee steaming beside him. He seems relaxed, unaware of any impending trouble. Doors lead east to the bar and south to the game room.", "[clone] Attempt to clone the sherrifs keycard.\r\n", {"clone", "e", "w", "s"}, {-1, 356, 354, 357}},
-    {356, "The Bar", "You approach the bar, where the bartender polishes glasses with a clean rag. Behind him, shelves are lined with bottles of whiskey, gin, and other spirits, their labels faded but the contents inviting. The bartender, a rugged man with a kind smile, nods as you approach. 'What'll it be, stranger?' he asks. The atmosphere is welcoming, a haven from the worries outside.", "[drink] Ask for a drink.\r\n", {"drink", "w"}, {-1, -1, 355, -1}},
-    {357, "Game Room", "The game room is filled with the chatter and laughter of patrons enjoying a respite. Round tables are scattered throughout, hosting various card and tabletop games. The scent of tobacco and spilled ale permeates the air. At one table, a group of players engages in a heated game of poker. One of them, a sharp-eyed gambler, catches your gaze and gestures for you to join. 'Care to test your luck?' he challenges with a sly grin.", "[play] You've been invited to play poker.\r\n", {"play", "n"}, {355, -1, -1, -1}},
-    {358, "Main Street", "Continuing along Main Street, the town's quiet charm envelops you. The buildings here are fewer, and the sounds from the saloon fade into the background. A tumbleweed rolls lazily across the path. The sky above stretches wide and clear, and you feel the weight of the Flipper Zero in your pocket, a reminder of your mission.", "", {"n", "s"}, {354, -1, -1, 359}},
-    {359, "Main and Wyatt Earp", "You arrive at the intersection of Main Street and Wyatt Earp Boulevard. The crossroads serves as a central point in Dodge City. To the east, Wyatt Earp Boulevard extends toward newer developments, while to the west, it leads back into the historic parts of town. The street signs creak slightly in the wind. The atmosphere feels charged, as if the town itself is waiting for something to happen.", "", {"n", "e", "w", "s"}, {358, 363, 360, 367}},
-    {360, "Wyatt Earp Boulevard", "Wyatt Earp Boulevard continues here, blending the old with the new. Modern streetlights contrast with the rustic architecture. The road is lined with small shops, though many appear closed. The distant sound of a train whistle echoes, reminding you of the outside world. A few townsfolk pass by, tipping their hats in greeting.", "", {"e", "w"}, {-1, 359, 362, -1}},
-    {361, "Abandoned Building", "An old, abandoned building stands here, its windows boarded up and walls weathered by time. Graffiti hints at past visitors, and the door hangs slightly ajar. Inside, shadows conceal whatever secrets might be hidden. The air smells of dust and forgotten memories.", "", {"e"}, {-1, 360, -1, -1}},
-    {362, "Road Closure", "The road here is closed off with wooden barriers and signs indicating construction ahead. Beyond the barriers, the pavement becomes uneven, and it's clear that the path is unsafe. A detour sign points back the way you came. The silence is unsettling, and you feel a slight chill despite the warm sun.", "", {"e"}, {-1, 360, -1, -1}},
-    {363, "Wyatt Earp Boulevard", "Wyatt Earp Boulevard continues eastward. The road becomes smoother, indicating recent maintenance. To the north, a gas station comes into view, its neon sign flickering. The modern convenience contrasts with the rest of the town's vintage aesthetic. A few cars are parked outside, and you can hear the faint hum of an air conditioner.", "", {"e", "w"}, {-1, 364, 359, -1}},
-    {364, "Side Street", "A narrow side street branches off here, leading toward the gas station. The pavement is cracked, and weeds sprout through the gaps. An old bicycle leans against a fence, forgotten. The area is quiet, save for the distant sound of a radio playing from the gas station.", "", {"n", "e", "w"}, {365, 366, 363, -1}},
-    {365, "Dodge the Po'boys Sandwiches and Fuel", "The gas station and sandwich shop is a small establishment with a friendly atmosphere. The scent of freshly made sandwiches wafts through the air. Inside, the clerk organizes shelves stocked with snacks and drinks. A cooler hums softly, filled with cold beverages. 'Hot day, isn't it?' the clerk remarks. 'An energy drink might do you good.'", "[drink] Grab an energy drink.\r\n", {"drink", "s"}, {-1, -1, -1, 364}},
-    {366, "Road Closure", "Further east, Wyatt Earp Boulevard is blocked by construction equipment. Large signs warn of road closures, and orange cones line the perimeter. Workers are nowhere to be seen, and the machinery sits idle. It seems the only way forward is back the way you came.", "", {"w"}, {-1, -1, 364, -1}},
-    {367, "Main Street", "Main Street continues southward, the buildings becoming sparser. The horizon opens up, and you can see the train station in the distance. The tracks glint in the sunlight, stretching toward the unknown. A sense of anticipation fills you, urging you to press on.", "", {"n", "s"}, {359, -1, -1, 368}},
-    {368, "Main Street", "At this point on Main Street, the town feels almost forgotten. To the east, a path leads toward the highway, while to the west, the entrance to the train station awaits. The distant sound of a train horn echoes, a low and haunting note. A gentle breeze stirs the dust at your feet.", "", {"n", "e", "w"}, {367, 369, 371, -1}},
-    {369, "Highway to Dodge City", "The highway stretches out, connecting Dodge City to the rest of Kansas. The road heading east toward Wichita is closed for construction, large barriers and signs directing travelers to seek alternative routes. On the ground, you notice another Flipper Zero device, identical to the one you found earlier. It has a note attached: 'You're on the right track. Keep going.' The message reinforces your resolve.", "[flipper] A Flipper Zero is on the ground, it has a note attached to it.\r\n", {"flipper", "w"}, {-1, -1, 368, -1}},
-    {370, "Train to Wichita", "You are inside a sleek, modern train bound for Wichita. The carriage is spacious, with comfortable seating upholstered in soft fabric. Large panoramic windows offer stunning views of the Kansas landscape as it rushes by—the golden hues of wheat fields and the vast open skies create a picturesque scene. Soft ambient lighting and the gentle rhythm of the train's motion provide a calming atmosphere. Passengers around you are engaged in quiet activities: some read books or newspapers, others work on laptops, and a few simply gaze out the windows lost in thought. An overhead announcement chimes, 'Now approaching Wichita. Please prepare to disembark.' To the east, a set of sliding doors leads toward the front of the train and will open onto the highway in Wichita upon arrival.", "", {"e", "w"}, {-1, 400, 372, -1}},
-    {371, "Train Station", "The Dodge City train station is a quaint building, reminiscent of a bygone era. Wooden benches line the platform, and a vintage clock hangs from the overhang, its hands frozen in time. Inside, the conductor dozes in a chair next to the ticket counter, his hat pulled low over his eyes. The rhythmic ticking of a nearby clock and the soft snores of the conductor create a peaceful ambiance.", "[clone] Attempt to clone the conductor's keycard.\r\n", {"clone", "e", "s"}, {-1, 368, -1, 372}},
-    {372, "Train Platform", "You stand on the train platform beside a sleek, modern train contrasting sharply with the station's old-fashioned charm. The train appears automated, humming quietly with latent energy. A sign next to the door indicates that a conductor's keycard is required for activation. The doors remain closed, awaiting authorization. The path north leads back to the station, while to the east lies an empty lot.", "[replay] Replay the conductor's keycard.\r\n", {"replay", "n", "e"}, {371, 370, -1, -1}},
-    {373, "Room 373", "Empty Room #373", "", {}, {-1, -1, -1, -1}},
-    {374, "Room 374", "Empty Room #374", "", {}, {-1, -1, -1, -1}},
-    {375, "Room 375", "Empty Room #375", "", {}, {-1, -1, -1, -1}},
-    {376, "Room 376", "Empty Room #376", "", {}, {-1, -1, -1, -1}},
-    {377, "Room 377", "Empty Room #377", "", {}, {-1, -1, -1, -1}},
-    {378, "Room 378", "Empty Room #378", "", {}, {-1, -1, -1, -1}},
-    {379, "Room 379", "Empty Room #379", "", {}, {-1, -1, -1, -1}},
-    {380, "Room 380", "Empty Room #380", "", {}, {-1, -1, -1, -1}},
-    {381, "Room 381", "Empty Room #381", "", {}, {-1, -1, -1, -1}},
-    {382, "Room 382", "Empty Room #382", "", {}, {-1, -1, -1, -1}},
-    {383, "Room 383", "Empty Room #383", "", {}, {-1, -1, -1, -1}},
-    {384, "Room 384", "Empty Room #384", "", {}, {-1, -1, -1, -1}},
-    {385, "Room 385", "Empty Room #385", "", {}, {-1, -1, -1, -1}},
-    {386, "Room 386", "Empty Room #386", "", {}, {-1, -1, -1, -1}},
-    {387, "Room 387", "Empty Room #387", "", {}, {-1, -1, -1, -1}},
-    {388, "Room 388", "Empty Room #388", "", {}, {-1, -1, -1, -1}},
-    {389, "Room 389", "Empty Room #389", "", {}, {-1, -1, -1, -1}},
-    {390, "Room 390", "Empty Room #390", "", {}, {-1, -1, -1, -1}},
-    {391, "Room 391", "Empty Room #391", "", {}, {-1, -1, -1, -1}},
-    {392, "Room 392", "Empty Room #392", "", {}, {-1, -1, -1, -1}},
-    {393, "Room 393", "Empty Room #393", "", {}, {-1, -1, -1, -1}},
-    {394, "Room 394", "Empty Room #394", "", {}, {-1, -1, -1, -1}},
-    {395, "Room 395", "Empty Room #395", "", {}, {-1, -1, -1, -1}},
-    {396, "Room 396", "Empty Room #396", "", {}, {-1, -1, -1, -1}},
-    {397, "Room 397", "Empty Room #397", "", {}, {-1, -1, -1, -1}},
-    {398, "Room 398", "Empty Room #398", "", {}, {-1, -1, -1, -1}},
-    {399, "Room 399", "Empty Room #399", "", {}, {-1, -1, -1, -1}},
-    {400, "Kellogg and 235", "You are at the bustling interchange of Kellogg Avenue and Interstate 235. The roar of traffic fills the air as cars and trucks zoom by on the multi-lane highways stretching in all directions. Green highway signs overhead point west toward Dodge City and east toward downtown Wichita, their reflective surfaces gleaming under the sunlight.", "", {"n", "e", "w"}, {480, 401, 369, -1}},
-    {401, "Kellogg", "Kellogg Avenue continues here as a wide expanse of concrete and asphalt, flanked by steel guardrails. To the east, the skyscrapers of downtown Wichita rise against the horizon, while to the west, the roadway stretches back toward the interchange. Overhead, aircraft ascend and descend toward the airport visible to the southeast, their engines leaving trails of sound across the sky.", "", {"e", "w"}, {-1, 402, 400, -1}},
-    {402, "Kellogg", "The highway hums with constant traffic as you approach an exit ramp leading south toward Wichita Internation Airport. Large blue signs display symbols of airplanes and terminal directions. To the east, Kellogg Avenue carries on toward the heart of the city, promising more exits and urban adventures.", "", {"e", "w", "s"}, {-1, 418, 401, 403}},
-    {403, "Airport Road", "You merge onto Airport Road, lined with neatly manicured landscaping and modern light poles. Billboards advertise car rentals and nearby hotels. The distant sound of jet engines grows louder as you head south toward the terminals. The road is smooth, reflecting the meticulous maintenance typical of an international airport.", "", {"n", "s"}, {402, -1, -1, 404}},
-    {404, "Airport Road", "Continuing along Airport Road, you pass the entrance to a sprawling short-term parking garage to the east, its levels stacked like a concrete labyrinth. Glass-enclosed walkways connect the parking structures to the terminals. To the south, the main terminals come into full view, their modern architecture featuring sweeping curves and large windows.", "", {"n", "e", "s"}, {403, 416, -1, 405}},
-    {405, "Airport Road", "As you draw nearer to the terminals, overhead signs guide you toward departures and arrivals just on the other side of the crosswalk. The roadway widens here, giving plenty of room for parked cars to load and unload without impeding traffic. The facade of the terminal building gleams with reflective glass and metal accents.", "", {"n", "s"}, {404, -1, -1, 406}},
-    {406, "Airport Road", "The speed limit drops significantly in this area, as you approach the main airport building with pedestrians crossing and walking all about. Flashing lights are seen in the distance.", "", {"n", "s"}, {405, -1, -1, 407}},
-    {407, "Airport Road", "An airport police cruiser is parked here, its lights flashing intermittently as an officer monitors the steady stream of vehicles. The officer, wearing a crisp uniform and aviator sunglasses, maintains a vigilant presence. To the east, arrivals and departures can be seen, with cars parked, standing, and stopping all along the road.", "", {"n", "e"}, {406, 408, -1, -1}},
-    {408, "Airport Road", "The road and traffic slows considerably here, as people stop to be let out or get in. The parking structure and rental cars can be seen to the north of here, and the road contineus to the east toward departures and arrivals.", "", {"e", "w", "s"}, {-1, 409, 407, 481}},
-    {409, "Airport Road", "A wide cross walk is painted along the road here, providing somewhat safe travel for pedestrians from the airport to the parking garage and rental car area. People exit the airport and wait around for their rides, while others are just arriving and entering the airport.", "", {"e", "w"}, {-1, 410, 408, -1}},
-    {410, "Airport Road", "To the south is the entrance, or is it the exit, of the departures area of the airport. Cars and trucks line the roadway here, picking up passengers. The road continues in both directions.", "", {"e", "w", "s"}, {-1, 411, 409, 482}},
-    {411, "Airport Road", "You are on the Airport Road circling around the central parking structures of the airport. The road here curves gently northward, lined with neatly trimmed shrubs and signs directing traffic toward the airport exits. To the north, the road continues toward the exit back onto Kellogg Avenue. To the west, the road leads back toward the arrivals and departures zones.", "", {"n", "w"}, {412, -1, 410, -1}},
-    {412, "Airport Road", "Continuing along the Airport Loop Road, you pass towering parking garages to your right, their levels marked with bright numbers for easy navigation. The road heads north, guiding you toward the exit ramps connecting back to Kellogg Avenue. To the south, the loop road leads back toward the main terminal areas.", "", {"n", "s"}, {413, -1, -1, 411}},
-    {413, "Airport Road", "At the northernmost point of the Airport Loop Road, the path begins to curve westward. Overhead signs indicate that the exit to Kellogg Avenue is ahead. To the west, the loop road continues, starting its return toward the terminals. To the south, you can retrace your path back toward the heart of the airport.", "", {"w", "s"}, {-1, -1, 414, 412}},
-    {414, "Airport Road", "You are at the western curve of the Airport Loop Road, completing the circle around the central parking areas. To the east, the road leads back toward the airport exit ramps. To the west, the road continues toward service areas and eventually reconnects with the main approach roads. To the south, the loop road returns toward the arrivals and departures zones.", "", {"e", "w", "s"}, {-1, 413, 416, 417}},
-    {415, "Storage Room", "You step into a dimly lit storage room tucked away behind the airport facilities. Stacks of old equipment, cardboard boxes, and unidentifiable machinery parts clutter the space. A faint smell of mildew and dust pervades the air. It seems long forgotten by the staff.", "", {}, {-1, -1, -1, -1}},
-    {416, "Airport Road", "This stretch of Airport Road is quieter, serving mainly as a connector between the main airport facilities and the outer service areas. The road is flanked by neatly trimmed hedges, and occasional lampposts stand ready to light the way after dusk. In the distance, you can hear the faint roar of aircraft taking off.", "", {"e", "w"}, {-1, 414, 404, -1}},
-    {417, "Staff Parking Area", "You find yourself in the airport's staff parking area, a vast lot filled with cars of various makes and models. A few employees can be seen heading to or from their vehicles, badges swinging from lanyards around their necks. The area is well-lit and monitored by security cameras mounted on tall poles.", "", {"n"}, {414, -1, -1, -1}},
-    {418, "Kellogg", "The expanse of Kellogg Avenue stretches endlessly east and west, a ribbon of asphalt cutting through the city's outskirts. The traffic is steady but less congested here. Billboards advertise upcoming attractions in Wichita, from museums to local diners. The horizon to the east hints at the skyscrapers of downtown, while to the west, the landscape becomes more open and rural.", "", {"e", "w"}, {-1, 419, 402, -1}},
-    {419, "Kellogg", "Approaching a major exit, you see signs indicating 'Downtown Wichita' with arrows pointing south. The highway ramps here spiral gracefully, allowing vehicles to descend toward the city center.", "", {"e", "w", "s"}, {-1, 420, 418, 471}},
-    {420, "Kellogg", "The highway continues eastward, becoming less urban as you leave the city's core behind. Roadside attractions become sparser, replaced by stretches of open fields and clusters of trees. The sky feels larger here, with the horizon stretching out in all directions.", "", {"e", "w"}, {-1, 421, 419, -1}},
-    {421, "Kellogg and 135", "At this major interchange, Kellogg Avenue intersects with Interstate 135. Signage directs travelers east toward the Kansas Turnpike and Topeka, north toward Newton, and west back into the heart of Wichita. The hum of traffic from multiple directions creates a constant backdrop of sound.", "", {"n", "e", "w"}, {423, 422, 420, -1}},
-    {422, "Highway to Topeka", "Heading east, the highway transitions into the Kansas Turnpike, a toll road that promises a smooth and direct route to Topeka. The surroundings become increasingly rural, with vast stretches of farmland on either side. Occasional rest stops and service areas break up the monotony of the drive.", "", {"e", "w"}, {-1, 72, 421, -1}},
-    {423, "Highway 135", "Interstate 135 stretches north and south here. To the north, signs indicate destinations like Newton and Chanute. To the south, the highway leads back toward downtown Wichita. The road is flanked by sound barriers decorated with artistic designs depicting Kansas landscapes.", "", {"n", "s"}, {424, -1, -1, 421}},
-    {424, "Highway 135", "The interstate continues its steady path. An exit ramp to the east provides access to Central Avenue, a major arterial road that cuts through Wichita's urban neighborhoods. Overhead signs alert drivers to upcoming services and points of interest.", "", {"n", "e", "s"}, {425, 428, -1, 423}},
-    {425, "Highway 135", "You are on an elevated section of the interstate, offering a panoramic view of the surrounding area. To the west, the cityscape of Wichita unfolds with its mix of modern buildings and historical architecture. The exit to Central Avenue is visible to the south, while the highway continues northward toward smaller towns.", "", {"n", "s"}, {426, -1, -1, 424}},
-    {426, "Highway 135 and Highway to Chanute", "At this junction, the interstate splits, with a branch leading east toward Chanute. Large overhead signs provide clear directions, and the roadways diverge gracefully. The landscape ahead becomes more wooded, hinting at the change from urban to rural environments.", "", {"n", "e", "s"}, {427, 137, -1, 425}},
-    {427, "Highway to Newton", "Traveling northward, the interstate heads toward Newton. The traffic thins out, and the open road ahead is inviting. To the south, Wichita's skyline is a distant silhouette against the sky. Roadside attractions become fewer, replaced by the simple beauty of Kansas's natural landscapes.", "", {"n", "s"}, {200, -1, -1, 426}},
-    {428, "Central Exit", "You take the exit ramp off Interstate 135 onto Central Avenue. The ramp curves smoothly, descending beneath the elevated highway. The sounds of the interstate fade, replaced by the more localized noises of city streets—honking horns, distant sirens, and the murmur of urban life.", "", {"n", "w"}, {429, -1, 424, -1}},
-    {429, "Central Avenue", "Central Avenue here passes under the towering structure of Interstate 135. The street is lined with modest homes and small businesses, each with its own character. Children play in front yards, and pedestrians walk along the sidewalks, adding a sense of community to the area.", "", {"w", "s"}, {-1, -1, 430, 428}},
-    {430, "Central Avenue", "This stretch of Central Avenue is vibrant, with a mix of old and new architecture. To the west, the Water Company HQ can be seen. Mead Street intersects here, leading south toward the Old Town district, known for its entertainment and nightlife.", "", {"e", "w", "s"}, {-1, 429, 444, 431}},
-    {431, "Mead Street", "You find yourself on Mead Street, a charming thoroughfare paved with red bricks and lined with renovated warehouses turned into lofts, galleries, and eateries. To the west, a lively farmers market is in full swing, vendors offering fresh produce and artisanal goods. To the east, a local craft brewery invites patrons with the scent of hops and the promise of cold beer.", "", {"n", "e", "w", "s"}, {430, 498, 499, 432}},
-    {432, "Mead Street", "Mead continues here, with the farmers market and brewery further to the north, and more downtown streets to the south. To the west lies the entrance of a local arcade, its neon lights flickering invitingly even during the day. The sounds of pinball machines and laughter spill into the street.", "", {"n", "w", "s"}, {431, -1, 497, 433}},
-    {433, "Douglas and Mead", "At the intersection of Douglas Avenue and Mead Street, the city's heartbeat is palpable. Douglas Avenue bustles with traffic, both vehicular and pedestrian. Street performers entertain passersby, and the aroma of coffee and baked goods wafts from nearby cafes. The historic Union Station building stands proudly to the west, a testament to the city's rich past.", "", {"n", "w", "s"}, {432, -1, 437, 435}},
-    {434, "The Orpheum Theatre", "You stand before the Orpheum Theatre, a beautifully restored venue dating back to the 1920s. Its marquee announces upcoming shows, and the ornate façade features intricate carvings and vintage lighting. Though the doors are currently closed, posters hint at the cultural events that breathe life into the city.", "", {"s"}, {-1, -1, -1, 444}},
-    {435, "Mead Street", "The southern end of Mead Street grows quieter, the hustle of downtown giving way to a more serene environment. Small, locally-owned shops offer antiques and curiosities. The street culminates in a cul-de-sac, beyond which lies a fenced-off area marked with 'No Trespassing' signs.", "", {"n", "s"}, {433, -1, -1, 436}},
-    {436, "Mead Street Dead End", "You've reached the end of Mead Street. A 'Road Closed' sign blocks further passage, and beyond it, an overgrown lot with the remnants of an old gas station stands silently. The building is boarded up, and graffiti adds color to its weathered walls.", "", {"n"}, {435, -1, -1, -1}},
-    {437, "Douglas Avenue", "Douglas Avenue here is lined with a mix of modern storefronts and historical buildings. To the east, the intersection with Mead Street leads back toward the city's nightlife. To the west, the avenue stretches toward the Arkansas River, where a large pedestrian bridge spans the water.", "", {"e", "w"}, {-1, 433, 438, -1}},
-    {438, "Mosley and Douglas", "At the crossroads of Mosley Street and Douglas Avenue, the energy is lively. Street art adorns the sides of buildings, and food trucks are parked along the curb, offering a variety of cuisines. Mosley Street leads north into a trendy district with art galleries, and south toward quieter neighborhoods.", "", {"n", "e", "w", "s"}, {441, 437, 458, 439}},
-    {439, "Mosley Street", "Heading south on Mosley Street, the surroundings become more residential. A vintage gas station to the east. Trees line the sidewalks, providing shade and a touch of nature amid the urban setting.", "", {"n", "e", "s"}, {438, 496, -1, 440}},
-    {440, "Mosley Street Dead End", "Mosley Street ends here in a quiet cul-de-sac surrounded by small homes with well-tended gardens. Children play in a nearby yard, their laughter filling the air. It's a peaceful contrast to the bustling city streets just a few blocks away.", "", {"n"}, {439, -1, -1, -1}},
-    {441, "Mosley Street", "Moving north on Mosley Street, you notice the buildings transition to creative spaces—art studios, independent theaters, and eclectic boutiques. The east side of the street is dominated by the back entrance of an arcade, its brick walls adorned with colorful murals depicting classic video game characters.", "", {"n", "s"}, {442, -1, -1, 438}},
-    {442, "Mosley Street", "The atmosphere here is vibrant. To the east, the Old Town Farmers Market is in full swing, offering fresh produce, handmade crafts, and live music. Central Avenue lies to the north, connecting you back to the main arteries of the city.", "", {"n", "e", "s"}, {443, 499, -1, 441}},
-    {443, "Central Avenue", "At the intersection of Central Avenue and Mosley Street, you're greeted by the sight of the Wichita Water Center to the west, an educational facility with interactive exhibits about water conservation. To the south, Mosley Street leads back toward the arts district. The farmers market buzzes to the southeast.", "", {"e", "w", "s"}, {-1, 444, 445, 442}},
-    {444, "Central Avenue", "This area of Central Avenue opens into a spacious plaza. The historic Orpheum Theatre stands proudly to the north, its classic architecture contrasting with the modern buildings nearby. To the south, an archway adorned with lights marks the entrance to the Old Town Farmers Market.", "", {"n", "e", "w", "s"}, {434, 430, 443, 499}},
-    {445, "Central Avenue", "Central Avenue continues east and west here, lined with a mix of office buildings and restaurants. To the west, the Wichita Water Center is visible, its reflective windows glinting in the sun. The distant hum of highway traffic can be heard faintly in the background.", "", {"e", "w"}, {-1, 443, 446, -1}},
-    {446, "Main and Central", "At the busy intersection of Main Street and Central Avenue, the city feels alive. Traffic lights control the flow of cars, and crosswalks are filled with pedestrians. A coffee shop on the corner beckons with the aroma of freshly roasted beans. The Water Company building located just to the west.", "", {"n", "e", "w", "s"}, {447, 445, 453, 455}},
-    {447, "Main Street", "Main Street narrows slightly here, taking on a more intimate feel. The buildings are older, with some dating back to the early 20th century, their brick façades telling stories of the past. The street curves northward, wrapping around the Wichita-Sedgwick County Historical Museum, a grand building with a clock tower.", "", {"n", "s"}, {448, -1, -1, 446}},
-    {448, "Main and Elm", "Main Street intersects with Elm Street at this quaint corner. Elm Street leads west toward the back of the Water Company. A small park with benches and shade trees invites passersby to pause and enjoy the surroundings.", "", {"w", "s"}, {-1, -1, 449, 447}},
-    {449, "Elm Street", "Elm Street here is quiet, lined with a mix of residential buildings and small offices. To the south, the back door of the Wichita Water Company stands ajar, propped open with a small stone.", "", {"e", "w", "s"}, {-1, 448, 450, 504}},
-    {450, "Elm Street", "Elm Street curves gently here, leading toward a large traffic circle to the south. The street is shaded by tall oak trees, their leaves rustling softly in the breeze. To the east, Elm Street wraps around, providing access back toward the city's core.", "", {"e", "s"}, {-1, 449, -1, 451}},
-    {451, "Central Circle", "You arrive at Central Circle, a large and elegantly designed roundabout adorned with a landscaped island in the center. The island features a towering sculpture made of intertwining metal arcs, symbolizing unity and progress. Streets radiate outward in all directions: Elm Street to the north, McLean Boulevard to the south, and Central Avenue stretching east and west.", "", {"n", "e", "w", "s"}, {450, 452, 477, 475}},
-    {452, "Central Avenue", "Central Avenue here is lined with upscale boutiques and art galleries, their windows showcasing local artists' works. The street is lively, with shoppers and art enthusiasts strolling along the sidewalks. To the east, Central Avenue continues toward the city's cultural district, while to the west, it leads back to the Central Circle.", "", {"n", "e", "w"}, {501, 453, 451, -1}},
-    {453, "Central Avenue", "This segment of Central Avenue is quieter, offering a blend of commercial offices and well-maintained apartment buildings. The Water Company is visible to the west, while to the south, a pathway leads toward 'The Keeper of the Plains' statue, a significant landmark where the Big and Little Arkansas rivers converge.", "", {"e", "w", "s"}, {-1, 446, 452, 454}},
-    {454, "The Keeper of the Plains", "You stand before the 'Keeper of the Plains,' a 44-foot tall steel sculpture of an Indigenous warrior, arms raised to the sky. The statue stands on a promontory at the confluence of the two rivers. Fire drums encircle the base, lit during evening rituals. Bridges connect the statue to the riverbanks, offering panoramic views of the city skyline.", "", {"n", "s"}, {453, -1, -1, 472}},
-    {455, "Main Street", "Main Street here is lined with historic buildings converted into modern businesses. A local bookstore with creaking wooden floors invites you to explore its shelves. To the south, the street continues toward residential neighborhoods, while the city center lies to the north.", "", {"n", "s"}, {446, -1, -1, 456}},
-    {456, "Main Street", "At this intersection, a small alley to the east leads to a hidden courtyard filled with cafés and artisan shops. The scent of fresh pastries and brewed coffee is enticing. Main Street continues north toward the bustling downtown and south toward quieter streets.", "", {"n", "e", "s"}, {455, 506, -1, 457}},
-    {457, "Main and Douglas", "You've reached the vibrant intersection of Main Street and Douglas Avenue. This is the heart of downtown Wichita, where modern skyscrapers meet historic facades. Street musicians perform on corners, and food vendors offer a variety of tempting treats. The area is alive with people working, shopping, and enjoying the city's offerings.", "", {"n", "e", "w", "s"}, {456, 458, 472, 459}},
-    {458, "Douglas Avenue", "Douglas Avenue here is a blend of the old and new. To the east, the street leads toward the historic Delano District, known for its unique shops and eateries. To the west, it heads back toward the city's core. The avenue is lined with mature trees, providing shade to pedestrians on the wide sidewalks.", "", {"e", "w"}, {-1, 438, 457, -1}},
-    {459, "Main Street", "Main Street begins to quiet down as you move southward. The buildings are shorter, and the pace of life seems a bit slower. Small parks and green spaces offer a respite from the urban environment. The street continues toward the city's residential areas.", "", {"n", "s"}, {457, -1, -1, 460}},
-    {460, "Main Street", "At this point, Main Street intersects with a quaint side street to the west, leading into a neighborhood of charming homes with well-kept lawns. The streetlights here are designed in a vintage style, adding to the area's welcoming atmosphere. To the south, the street slopes gently downward, hinting at the outskirts of the city.", "", {"n", "w", "s"}, {459, -1, 500, 470}},
-    {461, "Room 461", "Empty Room # 461", "", {}, {-1, -1, -1, -1}},
-    {462, "Room 462", "Empty Room # 462", "", {}, {-1, -1, -1, -1}},
-    {463, "Room 463", "Empty Room # 463", "", {}, {-1, -1, -1, -1}},
-    {464, "Room 464", "Empty Room # 464", "", {}, {-1, -1, -1, -1}},
-    {465, "Room 465", "Empty Room # 465", "", {}, {-1, -1, -1, -1}},
-    {466, "Room 466", "Empty Room # 466", "", {}, {-1, -1, -1, -1}},
-    {467, "Room 467", "Empty Room # 467", "", {}, {-1, -1, -1, -1}},
-    {468, "Room 468", "Empty Room # 468", "", {}, {-1, -1, -1, -1}},
-    {469, "Room 469", "Empty Room # 469", "", {}, {-1, -1, -1, -1}},
-    {470, "Main Street", "Main Street continues here, transitioning from the bustling downtown to quieter neighborhoods. The sidewalks are lined with trees whose leaves rustle softly in the breeze. To the north, the city's skyline is visible, while to the east, an exit ramp leads back onto the main highway.", "", {"n", "e"}, {460, 471, -1, -1}},
-    {471, "Main Street Exit", "You find yourself at the exit ramp connecting Main Street to the highway. Cars merge onto the ramp, accelerating as they join the flow of traffic. Overhead signs point toward downtown Wichita to the north and Kellogg Avenue to the east. The hum of vehicles is constant, yet there's a sense of openness here.", "", {"n", "w"}, {419, -1, 470, -1}},
-    {472, "Douglas Avenue", "Douglas Avenue here is vibrant with activity. Street lamps with ornate designs line the sidewalks, and boutique shops display colorful window arrangements. To the east, the avenue leads back toward the heart of downtown, while to the west, it approaches the Arkansas River.", "", {"n", "e", "w"}, {454, 457, 473, -1}},
-    {473, "Douglas Avenue", "This stretch of Douglas Avenue is quieter, with fewer pedestrians and a more relaxed atmosphere. Small cafes offer outdoor seating, where patrons sip coffee and watch the world go by. To the west, you can see the arches of a bridge crossing the river.", "", {"e", "w"}, {-1, 472, 474, -1}},
-    {474, "McLean Boulevard", "At the intersection of Douglas Avenue and McLean Boulevard, the city meets the riverfront. McLean Boulevard runs north and south along the east bank of the Arkansas River. To the north, riverfront parks offer green spaces and walking paths. To the south, the boulevard continues toward residential areas.", "", {"n", "e", "s"}, {475, 473, -1, 476}},
-    {475, "McLean Boulevard", "McLean Boulevard here offers scenic views of the Arkansas River. Joggers and cyclists share the pathways, and the sounds of the city are softened by the flowing water. The river sparkles under the sun, and occasional boats can be seen drifting along.", "", {"n", "s"}, {451, -1, -1, 474}},
-    {476, "McLean Boulevard", "Further south on McLean Boulevard, the surroundings become more tranquil. The urban landscape gives way to more natural scenery. A small pier extends into the river, where people fish or simply enjoy the serenity. The boulevard continues north back toward the city's attractions.", "", {"n"}, {474, -1, -1, -1}},
-    {477, "Central Avenue", "Central Avenue resumes here, crossing over McLean Boulevard via a sturdy bridge. The bridge offers panoramic views of the river and the city skyline. To the east, Central Avenue leads back into the urban core. To the west, it continues into quieter residential neighborhoods.", "", {"e", "w"}, {-1, 451, 478, -1}},
-    {478, "Highway 235", "You are at the on-ramp to Highway 235, which loops around the western edge of Wichita. To the north, the highway leads toward smaller towns like Ellsworth, with expansive fields and open skies along the way. The sound of traffic is a steady drone, and the wind carries the scent of the open road.", "", {"n", "e", "s"}, {250, 477, -1, 479}},
-    {479, "Highway 235", "Heading south on Highway 235, the cityscape begins to re-emerge. Billboards advertise upcoming exits and local businesses. The lanes are smooth and well-maintained, allowing for a comfortable drive. The highway curves gently, following the natural contours of the land.", "", {"n", "s"}, {478, -1, -1, 480}},
-    {480, "Highway 235", "Approaching the southern interchange, Highway 235 offers exits toward Kellogg Avenue and the main arteries of Wichita. The traffic increases as you near the city, with vehicles merging and diverging like the flow of a river. Overhead, signs guide drivers to their destinations.", "", {"n", "s"}, {479, -1, -1, 400}},
-    {481, "Departures", "You step into the Departures hall of Wichita Internation Airport. The area is expansive, with high ceilings and large windows that let in ample natural light. Digital displays show flight information, and travelers line up at ticket counters. The atmosphere is a mix of excitement and urgency.", "", {"n", "e"}, {409, 482, -1, -1}},
-    {482, "Arrivals", "The Arrivals hall is a place of reunions and welcomes. Families and friends wait eagerly near the baggage claim, scanning the crowd for familiar faces. Luggage carousels hum as bags begin to appear. A decorative installation—a lamp resembling a human figure—catches your eye, adding an artistic touch to the space.", "", {"n", "e", "w", "s"}, {409, 484, 481, 483}},
-    {483, "Information Services", "An information desk stands here, staffed by a friendly receptionist who looks eager to assist. Brochures and maps are neatly arranged on the counter. The scent of fresh flowers from a nearby vase adds a welcoming touch. The area is designed to make travelers feel at ease.", "", {"n", "s"}, {482, -1, -1, 485}},
-    {484, "Luggage Claim", "You arrive at the luggage claim area, where passengers wait for their bags. The space is functional yet comfortable, with seating areas and digital displays showing flight statuses. A unique art piece—a lamp shaped uncannily like a human body—adds intrigue to the otherwise utilitarian space.", "", {"w", "s"}, {-1, -1, 482, 486}},
-    {485, "Security Checkpoint", "The security checkpoint is ahead, with lanes designated for different traveler statuses. TSA agents attempt to efficiently guide passengers through the process. Behind the checkpoint, a large display screen seems to be malfunctioning, stuck in a loop of rebooting. This seems to be causing a delay in check in, as the line appears to be growing longer without moving.", "[reboot] A display behind the security checkpoint needs to be rebooted.\r\n[line] Join the security line.\r\n", {"reboot", "line", "n"}, {483, -1, -1, -1}},
-    {486, "Food Court", "The food court is a lively area filled with the aroma of various cuisines—freshly baked pizza, sizzling burgers, and aromatic coffee. Travelers relax at tables, enjoying meals before their flights. An Airport IT technician sits at a corner table, sipping coffee and looking thoughtfully at a tablet.", "[talk] An Airport IT technician is having a coffee.\r\n[drive] A USB drive is sitting on the table\r\n", {"drive", "talk", "n", "s"}, {484, -1, -1, 487}},
-    {487, "Terminal C", "Terminal C is bright and spacious, with floor-to-ceiling windows offering views of planes taxiing on the runway. Seating areas are equipped with charging stations. Passengers wait patiently, some engrossed in books or devices. Overhead announcements provide flight updates.", "", {"n", "e", "w"}, {486, 488, 492, -1}},
-    {488, "Terminal D", "You walk into Terminal D, where gates are bustling with activity. A kiosk nearby seems to be malfunctioning, its screen flickering as it attempts to reboot repeatedly. Passengers glance at it before moving on. The area is filled with the sounds of rolling suitcases and distant conversations.", "[reboot] A kiosk PC is rebooting constantly.\r\n", {"reboot", "e", "w"}, {-1, 489, 487, -1}},
-    {489, "Terminal E", "Terminal E is quieter, serving fewer flights at this time. Comfortable seating areas invite passengers to relax. Large artworks depicting Kansas landscapes adorn the walls. The terminal extends to the south, leading toward additional gates and facilities.", "", {"w", "s"}, {-1, -1, 488, 490}},
-    {490, "Terminal F", "At Terminal F, the atmosphere is calm. A few travelers are seated, waiting for boarding announcements. The lighting is soft, creating a relaxing environment. To the south, a discreet door labeled 'Authorized Personnel Only' piques your curiosity.", "", {"n", "s"}, {489, -1, -1, 491}},
-    {491, "Janitor's Closet", "You find yourself in a small janitor's closet, cluttered with cleaning supplies and equipment. A set of keys has been left on a cluttered desk, perhaps forgotten in haste. Behind the door, you notice a PC emitting a soft glow, stuck in a boot loop on a blue screen—a silent call for assistance.", "[key] A set of keys were left on the desk.\r\n[reboot] A PC sits behind the door, the screen stuck in a boot loop.\r\n", {"key", "reboot", "n"}, {490, -1, -1, -1}},
-    {492, "Terminal B", "Terminal B is lively, with several flights boarding soon. A large digital signage display is frozen, stuck in a boot loop and failing to provide crucial flight information. Airport staff seem unaware of the issue as they attend to passengers.", "[reboot] A digital signage PC is stuck in a boot loop.\r\n", {"reboot", "e", "w"}, {-1, 487, 493, -1}},
-    {493, "Terminal A", "Terminal A is one of the airport's main hubs. Shops and boutiques line the walkway, offering last-minute purchases to travelers. The scent of fresh cinnamon rolls from a nearby bakery is enticing. The terminal extends south toward restricted areas.", "", {"e", "s"}, {-1, 492, -1, 494}},
-    {494, "Tarmac Services", "You are at the entrance to the tarmac services area. Ground crew vehicles and equipment are visible through large windows. A heavy door labeled 'Network Closet' is secured with an electronic lock. The area is restricted, meant only for authorized personnel.", "[unlock] Unlock the network closet door.\r\n", {"unlock", "n", "e"}, {493, 495, -1, -1}},
-    {495, "Network Closet", "Inside the network closet, servers and networking equipment hum quietly. Cables are neatly organized, and indicator lights blink rhythmically. Under the bottom shelf, a PC catches your attention—its monitor displays a blue screen, indicating it needs attention.", "[reboot] A PC is tucked away under the bottom shelf, a nearby monitor has a blue screen.\r\n", {"reboot", "w"}, {-1, -1, 494, -1}},
-    {496, "Gas Station", "You enter a small gas station convenience store. The cool air conditioning is a welcome relief. Shelves are stocked with snacks, drinks, and miscellaneous travel items. A colorful display advertises the latest lottery jackpot. The cashier greets you with a nod.", "[ticket] Purchase a lottery ticket.\r\n[drink] Grab an energy drink.\r\n", {"ticket", "drink", "w"}, {-1, -1, 439, -1}},
-    {497, "The Arcade", "The arcade is a nostalgic haven filled with classic games. The sounds of pinball machines, electronic jingles, and enthusiastic players fill the air. Brightly colored lights flash in rhythm with the games.", "", {"e"}, {-1, 432, -1, -1}},
-    {498, "River Town Brewery", "You step into River Town Brewery, a warm and inviting space with rustic wooden décor. The aroma of brewing beer and savory dishes fills the air. Patrons sit at the bar and around tables, engaged in lively conversations. Large windows offer views of the river, enhancing the ambiance.", "", {"w"}, {-1, -1, 431, -1}},
-    {499, "Farmers Market", "The farmers market is a bustling open-air venue filled with stalls offering fresh produce, handmade crafts, and local delicacies. Vendors enthusiastically share information about their goods. A stall operator catches your eye, they seem to be asking people for financial advice.", "[pamphlet] Offer a pamphlet to the stall operator.\r\n", {"pamphlet", "n", "e", "w"}, {444, 431, 442, -1}},
-    {500, "Hotel", "You enter a modern hotel lobby filled with natural light and contemporary furnishings. A digital sign announces 'OzSec 2024,' indicating a cybersecurity conference is taking place. Professionals with badges and lanyards move about, engaging in discussions. The atmosphere is energetic and forward-looking.", "[sign] OzSec 2024\r\n[beacon] Set your beacon to this location.", {"sign", "beacon", "e"}, {-1, 460, -1, -1}},
-    {501, "Water Co. Reception", "The reception area of the Water Company HQ is sleek and professional. A large aquarium behind the receptionist's desk adds a calming presence, filled with colorful fish. The receptionist appears concerned, perhaps waiting for important news or dealing with an issue.", "[talk] A receptionist looks concerned.\r\n", {"talk", "n", "s"}, {502, -1, -1, 452}},
-    {502, "Hallway", "A quiet hallway stretches before you, illuminated by soft lighting. Framed photographs of local water sources and conservation efforts line the walls. The hallway leads to various departments within the company, each dedicated to ensuring the city's water quality.", "", {"n", "e", "w", "s"}, {504, 503, 505, 501}},
-    {503, "IT Office", "The IT office is filled with desks cluttered with monitors, keyboards, and sticky notes. The IT Manager sits at a workstation, looking worried as he types furiously. Servers blink in a corner, and network diagrams cover a whiteboard. The air is thick with the hum of equipment.", "[talk] The IT Manager looks worried.\r\n", {"talk", "w"}, {-1, -1, 502, -1}},
-    {504, "Water Co. Breakroom", "The breakroom is cozy, offering a respite for employees. A coffee machine gurgles as it brews a fresh pot. Comfortable chairs and a sofa invite relaxation. A bulletin board displays company announcements and community events.", "[coffee] Grab a cup of coffee.\r\n", {"coffee", "n", "s"}, {449, -1, -1, 502}},
-    {505, "Data Center", "You enter the data center, a secure room filled with racks of servers and storage devices. The air is cool, maintained by robust climate control systems. A tape backup drive sits open, waiting for a tape to be loaded. The quiet whir of fans underscores the importance of this room.", "[load] Load a tape into the backup drive.\r\n", {"load", "e"}, {-1, 502, -1, -1}},
-    {506, "Bank Lobby", "The bank lobby is elegant, with marble floors and high ceilings. Customers move about, attending to their financial needs. A grand chandelier hangs overhead, casting a warm glow. The atmosphere balances professionalism with a welcoming feel.", "", {"n", "e", "w", "s"}, {507, 508, 456, 509}},
-    {507, "Safe Deposit Boxes", "This secure room houses rows of safe deposit boxes. The air is hushed, emphasizing the confidentiality of the space. A bank officer stands by to assist customers accessing their valuables. The metallic sheen of the boxes reflects the soft lighting.", "[open] Open a safe deposit box.\r\n", {"open", "s"}, {-1, -1, -1, 506}},
-    {508, "Teller Line", "The teller line is staffed by friendly professionals ready to assist with transactions. Customers wait patiently in line, and the tellers efficiently handle each request. The scent of fresh paper and ink is noticeable here.", "[talk] Speak to a teller.\r\n", {"talk", "w"}, {-1, -1, 506, -1}},
-    {509, "Loan Office", "The loan office is a quiet space designed for in-depth consultations. Brochures comparing loan products are neatly arranged on a table, inviting you to learn more. A financial advisor is available to discuss options and answer questions.", "[pamphlet] A pamphlet comparing loan products is begging to be taken.\r\n", {"pamphlet", "n"}, {506, -1, -1, -1}},
-    {510, "Room 510", "Empty Room # 510", "", {}, {-1, -1, -1, -1}},
-    {511, "Room 511", "Empty Room # 511", "", {}, {-1, -1, -1, -1}},
-    {512, "Room 512", "Empty Room # 512", "", {}, {-1, -1, -1, -1}},
-    {513, "Room 513", "Empty Room # 513", "", {}, {-1, -1, -1, -1}},
-    {514, "Room 514", "Empty Room # 514", "", {}, {-1, -1, -1, -1}},
-    {515, "Room 515", "Empty Room # 515", "", {}, {-1, -1, -1, -1}},
-    {516, "Room 516", "Empty Room # 516", "", {}, {-1, -1, -1, -1}},
-    {517, "Room 517", "Empty Room # 517", "", {}, {-1, -1, -1, -1}},
-    {518, "Room 518", "Empty Room # 518", "", {}, {-1, -1, -1, -1}},
-    {519, "Room 519", "Empty Room # 519", "", {}, {-1, -1, -1, -1}},
-    {520, "Room 520", "Empty Room # 520", "", {}, {-1, -1, -1, -1}}};
\ No newline at end of file
+// Room text, decoded from the Huffman coded roomText one byte at a time.
+// Print it straight to the serial port, or read it byte by byte, nothing is decoded up front.
+class RoomText : public Printable
+{
+private:
+    const uint8_t *data; // Next coded byte, or NULL at the end
+    uint8_t bit;         // Next bit in *data, from 0x80 down
+    int next;            // Byte decoded ahead by peek(), or -2 if none
+
+public:
+    RoomText(const uint8_t *data);
+    int read();
+    int peek();
+    String toString() const;
+    size_t printTo(Print &out) const override;
+};
+
+// Room definitions, edit content/rooms.json to change them.
+// Ids without a room don't exist, their text is empty and they lead nowhere.
+class Rooms
+{
+private:
+public:
+    static bool exists(int id);
+    static int idCount();
+    static RoomText title(int id);
+    static RoomText description(int id);
+    static RoomText actions(int id);
+    static void printDescription(int id, Print &out, int width);
+    static int neighbor(int id, int direction);
+    static int optionCount(int id);
+    static const char *option(int id, int index);
+    static bool hasOption(int id, const char *option);
+};
+
+#endif
\ No newline at end of file
@@ -0,0 +1,53 @@
+#ifndef Storage_hpp
+#define Storage_hpp
+#include <Arduino.h>
+#include <Preferences.h>
+
+#define STORAGE_QUEUE_LENGTH 8   // Number of writes that can wait for the storage task
+#define STORAGE_TASK_STACK 4096  // Stack size in words for the storage task
+
+enum StorageJobType : uint8_t
+{
+    STORAGE_PUT_BYTES,  // Write data as a bytes key
+    STORAGE_PUT_STRING, // Write data as a string key, data is nul terminated
+    STORAGE_REMOVE,     // Remove a key
+    STORAGE_CLEAR,      // Remove every key in the namespace
+    STORAGE_SYNC        // Nothing, used to wait for the jobs before it
+};
+
+// Write for the storage task. Namespaces and keys must stay valid until the job is done,
+// string literals for example. Data is allocated with malloc() and freed by the storage task.
+struct StorageJob
+{
+    StorageJobType type;
+    const char *space;      // Preferences namespace
+    const char *key;        // Preferences key, unused by STORAGE_CLEAR and STORAGE_SYNC
+    uint8_t *data;          // Data to write, or NULL
+    size_t length;          // Length of data in bytes
+    bool wait;              // The game loop is waiting for this job
+};
+
+// Preferences writes run on a low priority storage task so the game loop never
+// waits on flash. Jobs run one at a time in the order they were queued.
+// Only call from the game loop.
+class Storage
+{
+private:
+public:
+    static void init();
+    static bool putBytes(const char *space, const char *key, uint8_t *data, size_t length);
+    static bool putString(const char *space, const char *key, const String &value);
+    static bool remove(const char *space, const char *key);
+    static bool clear(const char *space);
+    static bool sync();
+    static bool post(StorageJob &job);
+    static bool run(StorageJob &job);
+    static void task(void *parameter);
+    static unsigned long writes;        // Writes done by the storage task
+    static unsigned long failures;      // Jobs that failed or could not be queued
+    static unsigned long bytesWritten;  // Bytes written to NVS
+    static uint64_t writeTime;          // Total time in us the storage task spent on flash
+    static unsigned long writeMax;      // Longest time in us the storage task spent on one job
+};
+
+#endif
\ No newline at end of file
@@ -0,0 +1,21 @@
+#ifndef Timeline_hpp
+#define Timeline_hpp
+#include <Arduino.h>
+
+#define TIMELINE_LENGTH 96 // Number of timed lines that can be waiting to print
+
+// Timed output for the game. Lines and pauses are queued instead of calling sleep(),
+// and Adventure::loop() prints each line once it is due. Nothing else is shown and
+// input stays queued until the timeline is done.
+class Timeline
+{
+private:
+public:
+    static void println(String text);
+    static void pause(unsigned long ms);
+    static void run(unsigned long now);
+    static bool busy(unsigned long now);
+    static TickType_t wait(unsigned long now);
+};
+
+#endif
\ No newline at end of file
@@ -0,0 +1,45 @@
+#ifndef Wrap_hpp
+#define Wrap_hpp
+#include <Arduino.h>
+#include <ozsec/rooms.hpp>
+
+#define WRAP_WIDTH_MAX 160   // Widest wrap width, wider widths are wrapped at this width
+#define WRAP_LINE_BUFFER 128 // Output collected before it is written, lines are written whole up to this length
+
+// Word wrapper for the serial console, without any heap allocations.
+// Words are collected in a fixed buffer only until it is known whether they fit on the line,
+// output is collected in a second buffer and written a whole line at a time.
+// Wraps the same way as the old String based Adventure::printWithWrapping():
+// a word that does not fit starts a new line, a lone '\r' restarts the line count without
+// a line break, and '\n' only breaks the line again once a space was printed after the last break.
+class TextWrap
+{
+private:
+    Print &out;
+    int width;
+    char line[WRAP_LINE_BUFFER]; // Output not written yet
+    int lineUsed;
+    char word[WRAP_WIDTH_MAX]; // Start of the current word, until it is known to need a new line
+    int wordUsed;
+    int lineLength;     // Characters printed since the last line break
+    int wordLength;     // Characters in the current word
+    bool wordOnNewLine; // The current word did not fit, it has a line of its own and is printed as it comes
+    bool lastCharWasCR;
+    bool skipNewLine;
+
+    void write(const char *data, int length);
+    void newLine();
+    void checkWidth();
+    void addToWord(char c);
+    void endWord();
+    void add(char c, bool last);
+    void finish();
+
+public:
+    TextWrap(Print &out, int width);
+    void print(RoomText text);
+    void print(const char *text);
+    void printLines(RoomText text, const uint16_t *breaks);
+};
+
+#endif
\ No newline at end of file
@@ -1,12 +1,14 @@
 #include <Arduino.h>
-#include <OneButton.h>
 #include <Preferences.h>
 
 #include <ozsec/adventure.hpp>
 #include <ozsec/ble.hpp>
 #include <ozsec/update.hpp>
 #include <ozsec/lights.hpp>
-#include <ozsec/buttons.hpp> // Setup buttons
+#include <ozsec/buttons.hpp>
+#include <ozsec/input.hpp>
+#include <ozsec/storage.hpp>
+#include <ozsec/console.hpp>
 #include <config.hpp>
 
 Preferences preferences;
@@ -24,6 +26,8 @@ void BackgroundTaskCode(void *parameter); // Function prototype for the backgrou
 void setup()
 {
     Serial.begin(115200);
+    Console.init();
+    Input::init();
     bleInit = false;
     Lights::init();
     preferences.begin("badge-state", false);
@@ -62,30 +66,31 @@ void setup()
     }
 
     // Print some badge info to serial
-    Serial.printf("Badge: %s \r\nEvent: %s \r\nVersion: %s \r\n", preferences.getString("badge").c_str(), preferences.getString("event").c_str(), preferences.getString("version").c_str());
+    Console.printf("Badge: %s \r\nEvent: %s \r\nVersion: %s \r\n", preferences.getString("badge").c_str(), preferences.getString("event").c_str(), preferences.getString("version").c_str());
     preferences.end();
-    // Setup OneButton functions to call when a button is pressed
+    // Setup button functions to call when a button is pressed
     // Set up long press on BOOT to OTA
-    boot_button.setPressMs(1500);
-    boot_button.attachLongPressStart([]()
-                                     {
-        Serial.println("Starting OTA update...");
+    Buttons::onLongPress(BUTTON_BOOT, []()
+                         {
+        Console.println("Starting OTA update...");
         Update::checkForUpdate(); }); // Call the OTA update function
 
-    select_button.attachClick([]()
-                              {
-        adventure.processPromptResponse("select");; });
-    boot_button.attachClick([]()
-                            {
-        adventure.processPromptResponse("boot");; });
-    up_button.attachClick([]()
-                          { adventure.processPromptResponse("n"); });
-    right_button.attachClick([]()
-                             { adventure.processPromptResponse("e"); });
-    left_button.attachClick([]()
-                            { adventure.processPromptResponse("w"); });
-    down_button.attachClick([]()
-                            { adventure.processPromptResponse("s"); });
+    Buttons::onClick(BUTTON_SELECT, []()
+                     { adventure.processPromptResponse("select"); });
+    Buttons::onClick(BUTTON_BOOT, []()
+                     { adventure.processPromptResponse("boot"); });
+    Buttons::onClick(BUTTON_UP, []()
+                     { adventure.processPromptResponse("n"); });
+    Buttons::onClick(BUTTON_RIGHT, []()
+                     { adventure.processPromptResponse("e"); });
+    Buttons::onClick(BUTTON_LEFT, []()
+                     { adventure.processPromptResponse("w"); });
+    Buttons::onClick(BUTTON_DOWN, []()
+                     { adventure.processPromptResponse("s"); });
+    Buttons::init();
+
+    // Start the storage task before loading the game, saves are written there
+    Storage::init();
 
     // Adventure initialization code
     adventure.init();
@@ -104,16 +109,8 @@ void setup()
 void loop()
 {
 
-    // Run any relevant adventure loop code
+    // Run any relevant adventure loop code, this sleeps until there is input to handle
     adventure.loop();
-
-    // Button ticks to register presses. Part of the OneButton library.
-    boot_button.tick();
-    select_button.tick();
-    up_button.tick();
-    down_button.tick();
-    left_button.tick();
-    right_button.tick();
 }
 
 // This function runs on core 0 and is used to run background
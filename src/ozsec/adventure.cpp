@@ -1,6 +1,13 @@
 #include <ozsec/adventure.hpp>
 #include <ozsec/lights.hpp>
 #include <ozsec/ble.hpp>
+#include <ozsec/buttons.hpp>
+#include <ozsec/input.hpp>
+#include <ozsec/timeline.hpp>
+#include <ozsec/storage.hpp>
+#include <ozsec/notebook.hpp>
+#include <ozsec/console.hpp>
+#include <esp_rom_crc.h>
 
 // Player and game state variables
 CharacterState player;
@@ -17,9 +24,19 @@ bool showPrompt;
 
 LightMode lightMode = TWINKLE;
 
-String konamiStrings[10] = {"n", "n", "s", "s", "w", "e", "w", "e", "boot", "select"};
-int konamiIndex;
+extern TaskHandle_t BackgroundTask;
+
+// Game loop iterations, for stats
+unsigned long loopCount;
+
 #define KONAMI_INDEX_MAX 10
+const char *const konamiStrings[KONAMI_INDEX_MAX] = {"n", "n", "s", "s", "w", "e", "w", "e", "boot", "select"};
+int konamiIndex; // Position in the Konami code, see konamiNext()
+
+// Input resolution, for stats
+unsigned long resolveCount;
+uint64_t resolveCycles;        // Total CPU cycles spent in Adventure::resolve()
+unsigned long resolveCyclesMax; // Most CPU cycles for one input
 
 /// @brief Initialize the game state and load saved data.
 void Adventure::init()
@@ -37,12 +54,42 @@ void Adventure::init()
     setCallback(&Adventure::displayRoom);
 }
 
-/// @brief Main game loop
+/// @brief Main game loop, sleeps until there is input when there is nothing left to show
 void Adventure::loop()
 {
-    // Print "Press enter" every 5 seconds until we know serial is connected
     static unsigned long lastPrint = 0;
-    if (!serialConnected && millis() - lastPrint > 5000)
+    TickType_t timeout = 0;
+    InputEvent event;
+
+    loopCount++;
+
+    // Write any saved changes once the flush interval is up
+    flush(false);
+
+    // Timed output goes first, nothing else is shown and input stays queued until it is done
+    Timeline::run(millis());
+    if (Timeline::busy(millis()))
+    {
+        ledPublish();
+        Input::sleep(min(Timeline::wait(millis()), flushWait()));
+        return;
+    }
+
+    // Until serial is connected, only wake up for input or to print "Press enter" again
+    if (!pending())
+    {
+        unsigned long since = millis() - lastPrint;
+        timeout = serialConnected ? portMAX_DELAY : (since < 5000 ? pdMS_TO_TICKS(5000 - since) : 0);
+        timeout = min(timeout, flushWait());
+    }
+
+    if (Input::wait(&event, timeout) && event.source == INPUT_BUTTON)
+    {
+        Buttons::click((ButtonId)event.button);
+    }
+
+    // Print "Press enter" every 5 seconds until we know serial is connected
+    if (!serialConnected && millis() - lastPrint >= 5000)
     {
         printHelp();
         lastPrint = millis();
@@ -61,7 +108,7 @@ void Adventure::loop()
         {
             lightMode = ADVENTURE;
         }
-        Serial.println("Starting serial console...\n\n");
+        Console.println("Starting serial console...\n\n");
     }
 
     if (serialConnected)
@@ -75,302 +122,661 @@ void Adventure::loop()
         // Prompt for input
         prompt();
     }
+
+    // Let the background task know about any LED changes
+    ledPublish();
 }
 
 /// @brief This loop runs on core 0 along with the BLE scan.
 /// This loop will be delayed periodically during BLE scans.
 void Adventure::bgloop()
 {
+    static LightMode lastMode = TWINKLE;
+    static uint32_t shownLedState = 0;
+    static TickType_t lastFrame = xTaskGetTickCount();
+    uint32_t state;
+    uint32_t changed;
+    CRGB wichitaColor;
+
     // Handle LED mode
     switch (lightMode)
     {
     case TWINKLE:
-        Lights::twinkle();
-        if (ledTwinkleMode != 2)
+        if (lastMode != TWINKLE)
         {
-            if (game.qwichita)
-            {
-                Lights::stripOn(CRGB(0, 255, 0), 25);
-            }
-            else
-            {
-                Lights::stripOn(CRGB(255, 0, 0), 25);
-            }
+            lastFrame = xTaskGetTickCount();
+        }
+
+        wichitaColor = (Quests::snapshot() & questMask(QUEST_WICHITA)) ? CRGB(0, 255, 0) : CRGB(255, 0, 0);
+
+        // Twinkle 2 leaves the RGB alone, and the heartbeat sets its own RGB brightness
+        if (ledTwinkleMode == 3)
+        {
+            Lights::stripColor(wichitaColor);
+        }
+        else if (ledTwinkleMode != 2)
+        {
+            Lights::stripOn(wichitaColor, 25);
         }
+        Lights::frame(millis());
+
+        // Sleep until the next frame so core 0 is free for BLE in between
+        vTaskDelayUntil(&lastFrame, pdMS_TO_TICKS(LED_FRAME_PERIOD));
         break;
     case ADVENTURE:
-        ledMap();
-        delay(1000);
+        if (lastMode != ADVENTURE)
+        {
+            // Twinkling may have changed any of the LEDs, so redraw the whole map
+            state = ledMapState(Quests::snapshot());
+            changed = LED_MAP_ALL;
+        }
+        else
+        {
+            // Sleep until the game publishes a change, only waking every frame while LEDs are fading
+            xTaskNotifyWait(0, 0, NULL, Lights::isIdle() ? portMAX_DELAY : pdMS_TO_TICKS(LED_FRAME_PERIOD));
+            state = ledMapState(Quests::snapshot());
+            changed = state ^ shownLedState;
+        }
+        Lights::tick(millis());
+        ledMap(state, changed);
+        Lights::stripCommit();
+        shownLedState = state;
         break;
     }
+
+    lastMode = lightMode;
 }
 
-/// @brief Handles the LEDs when in ADVENTURE mode.
-void Adventure::ledMap()
+// Quest shown by each map LED, in all_leds order, then Wichita on the RGB strip
+const QuestFlag ledMapQuests[] = {QUEST_MODEL2023, QUEST_CHANUTE, QUEST_PITTSBURG, QUEST_KANSASCITY, QUEST_TOPEKA,
+                                  QUEST_GOODLAND, QUEST_DODGECITY, QUEST_NEWTON, QUEST_ELLSWORTH, QUEST_WICHITA};
+
+/// @brief Get the quest state shown on the LED map.
+/// @param quests Quest flags, from Quests::snapshot() on core 0
+/// @return Bit mask with one bit per map LED in all_leds order, and LED_MAP_WICHITA for the RGB strip
+uint32_t Adventure::ledMapState(uint64_t quests)
 {
-    if (game.qmodel2023)
-    {
-        // Turn on the LED
-        digitalWrite(all_leds[0], HIGH);
-    }
-    else
-    {
-        // Turn off the LED
-        digitalWrite(all_leds[0], LOW);
-    }
+    uint32_t state = 0;
 
-    // Chanute
-    if (game.qchanute)
+    for (size_t i = 0; i < sizeof(ledMapQuests) / sizeof(ledMapQuests[0]); i++)
     {
-        Lights::ledOn(all_leds[1], false);
-    }
-    else
-    {
-        Lights::ledOff(all_leds[1], false);
+        if (quests & questMask(ledMapQuests[i]))
+        {
+            state |= 1 << i;
+        }
     }
 
-    // Pittsburgh
-    if (game.qpittsburg)
-    {
-        Lights::ledOn(all_leds[2], false);
-    }
-    else
-    {
-        Lights::ledOff(all_leds[2], false);
-    }
+    return state;
+}
 
-    // Kansas City
-    if (game.qkansascity)
-    {
-        Lights::ledOn(all_leds[3], false);
-    }
-    else
-    {
-        Lights::ledOff(all_leds[3], false);
-    }
+/// @brief Publish the quest flags and wake the background task if they or the light mode changed.
+/// Called at the end of every game loop so quest completions show up immediately.
+void Adventure::ledPublish()
+{
+    static LightMode publishedMode = TWINKLE;
+    static uint64_t publishedQuests = 0;
 
-    // Topeka
-    if (game.qtopeka)
-    {
-        Lights::ledOn(all_leds[4], false);
-    }
-    else
+    if (game.quests.bits != publishedQuests || lightMode != publishedMode)
     {
-        Lights::ledOff(all_leds[4], false);
+        Quests::publish(game.quests.bits);
+        publishedQuests = game.quests.bits;
+        publishedMode = lightMode;
+        ledNotify();
     }
+}
 
-    // Goodland
-    if (game.qgoodland)
-    {
-        Lights::ledOn(all_leds[5], false);
-    }
-    else
+/// @brief Wake the background task so it handles LED changes right away.
+void Adventure::ledNotify()
+{
+    if (BackgroundTask != NULL)
     {
-        Lights::ledOff(all_leds[5], false);
+        xTaskNotify(BackgroundTask, 0, eNoAction);
     }
+}
 
-    // Dodge City
-    if (game.qdodgecity)
+/// @brief Update only the map LEDs whose quest state changed.
+/// @param state Quest state from Adventure::ledMapState()
+/// @param changed Bit mask of the LEDs to update
+void Adventure::ledMap(uint32_t state, uint32_t changed)
+{
+    // Model 2023 badge, a plain on/off LED
+    if (changed & 1)
     {
-        Lights::ledOn(all_leds[6], false);
+        digitalWrite(all_leds[0], (state & 1) ? HIGH : LOW);
     }
-    else
+
+    // Chanute, Pittsburg, Kansas City, Topeka, Goodland, Dodge City, Newton and Ellsworth
+    for (int i = 1; i < SIMPLE_NUM_LEDS; i++)
     {
-        Lights::ledOff(all_leds[6], false);
+        if (!(changed & (1 << i)))
+        {
+            continue;
+        }
+
+        if (state & (1 << i))
+        {
+            Lights::ledOn(i, false);
+        }
+        else
+        {
+            Lights::ledOff(i, false);
+        }
     }
 
-    // Newton
-    if (game.qnewton)
+    // Wichita
+    if (changed & LED_MAP_WICHITA)
     {
-        Lights::ledOn(all_leds[7], false);
+        if (state & LED_MAP_WICHITA)
+        {
+            // Turn on RGB strip
+            Lights::stripOn(CRGB(0, 255, 0), 25);
+        }
+        else
+        {
+            // Keep RGP strip red
+            Lights::stripOn(CRGB(255, 0, 0), 25);
+        }
     }
-    else
+}
+
+/// @brief Print help message to the serial console.
+void Adventure::printHelp()
+{
+    Console.println("\n\nHold BOOT to start OTA firmware update.");
+    Console.println("");
+    Console.println("Press enter to activate the serial console.");
+}
+
+// Quest flags saved one key each by the old save format, see Adventure::migrate()
+const char *legacyFlags[] = {"qmodel2023", "qtrainingvault", "qtraining", "qchanute", "qpittsburg", "qkansascity", "qtopeka", "qgoodland", "qdodgecity", "qnewton", "qellsworth", "qwichita"};
+const QuestFlag legacyFlagQuests[] = {QUEST_MODEL2023, QUEST_TRAININGVAULT, QUEST_TRAINING, QUEST_CHANUTE, QUEST_PITTSBURG, QUEST_KANSASCITY, QUEST_TOPEKA, QUEST_GOODLAND, QUEST_DODGECITY, QUEST_NEWTON, QUEST_ELLSWORTH, QUEST_WICHITA};
+
+/// @brief Append data to a save blob
+/// @param blob Buffer to write to, or NULL to only count the length
+/// @param pos Position to write at, moved past the data
+void blobWrite(uint8_t *blob, size_t &pos, const void *data, size_t length)
+{
+    if (blob != NULL)
     {
-        Lights::ledOff(all_leds[7], false);
+        memcpy(blob + pos, data, length);
     }
+    pos += length;
+}
 
-    // Ellsworth
-    if (game.qellsworth)
+/// @brief Read data from a save blob
+/// @param pos Position to read from, moved past the data
+/// @return false if the blob is too short
+bool blobRead(const uint8_t *blob, size_t length, size_t &pos, void *data, size_t size)
+{
+    if (pos + size > length)
     {
-        Lights::ledOn(all_leds[8], false);
+        return false;
     }
-    else
+    memcpy(data, blob + pos, size);
+    pos += size;
+    return true;
+}
+
+/// @brief Check the header of a save blob
+/// @return false if the blob is damaged or from an unknown version
+bool checkSave(const uint8_t *blob, size_t length)
+{
+    SaveHeader header;
+
+    if (length < sizeof(SaveHeader))
     {
-        Lights::ledOff(all_leds[8], false);
+        return false;
     }
+    memcpy(&header, blob, sizeof(header));
+    return header.version == SAVE_VERSION && header.length == length - sizeof(SaveHeader) &&
+           header.crc == esp_rom_crc32_le(0, blob + sizeof(SaveHeader), header.length);
+}
 
-    // Wichita
-    if (game.qwichita)
+// Save blob read from one of the slots
+struct SaveSlot
+{
+    uint8_t *blob; // Allocated with malloc(), or NULL if the slot is empty or damaged
+    size_t length;
+    uint32_t sequence;
+};
+
+// Parts of the game state changed since the last save blob write, see Adventure::flush()
+uint8_t saveDirty;
+unsigned long lastSaveWrite;
+uint32_t saveSequence; // Sequence of the last save blob loaded or queued
+
+// Save counters, for stats
+unsigned long saveCount;
+unsigned long saveRequests;
+unsigned long nvsReads;
+uint64_t saveTime;        // Total time in us the game loop spent handing save blobs to the storage task
+unsigned long saveTimeMax; // Longest time in us for one save blob
+
+/// @brief Read a save blob slot, preferences must be open on SAVE_NAMESPACE.
+SaveSlot readSlot(const char *key)
+{
+    SaveSlot slot = {NULL, preferences.getBytesLength(key), 0};
+    nvsReads++;
+
+    if (slot.length >= sizeof(SaveHeader))
     {
-        // Turn on RGB strip
-        Lights::stripOn(CRGB(0, 255, 0), 25);
+        slot.blob = (uint8_t *)malloc(slot.length);
+        nvsReads++;
+        if (slot.blob != NULL && (preferences.getBytes(key, slot.blob, slot.length) != slot.length || !checkSave(slot.blob, slot.length)))
+        {
+            free(slot.blob);
+            slot.blob = NULL;
+        }
     }
-    else
+    if (slot.blob != NULL)
     {
-        // Keep RGP strip red
-        Lights::stripOn(CRGB(255, 0, 0), 25);
+        slot.sequence = ((const SaveHeader *)slot.blob)->sequence;
     }
-}
-
-/// @brief Print help message to the serial console.
-void Adventure::printHelp()
-{
-    Serial.println("\n\nHold BOOT to start OTA firmware update.");
-    Serial.println("");
-    Serial.println("Press enter to activate the serial console.");
+    return slot;
 }
 
 /// @brief Load game and player state from memory.
 void Adventure::load()
 {
-    // Keep in sync with Adventure::save()
-    preferences.begin("game-data", false);
-    // Load game state from memory, with default values if not set.
+    bool loaded = false;
+
+    // Start from a new game, anything in the save replaces it
     game.playing = false;
     game.message = "";
     game.cheats = false;
+    game.quests.bits = 0;
 
-    // Quest data
-    game.qmodel2023 = preferences.getBool("qmodel2023", false);
-    game.qtrainingvault = preferences.getBool("qtrainingvault", false);
-    game.qtraining = preferences.getBool("qtraining", false);
-    game.qchanute = preferences.getBool("qchanute", false);
-    game.qpittsburg = preferences.getBool("qpittsburg", false);
-    game.qkansascity = preferences.getBool("qkansascity", false);
-    game.qtopeka = preferences.getBool("qtopeka", false);
-    game.qgoodland = preferences.getBool("qgoodland", false);
-    game.qdodgecity = preferences.getBool("qdodgecity", false);
-    game.qnewton = preferences.getBool("qnewton", false);
-    game.qellsworth = preferences.getBool("qellsworth", false);
-    game.qwichita = preferences.getBool("qwichita", false);
-
-    // Load player data
-    player.name = preferences.getString("playername", "User");
-    player.room = preferences.getInt("playerroom", TRAININGTENT);
-    player.previousRoom = preferences.getInt("playerroom", TRAININGTENT);
+    player.name = "User";
+    player.room = TRAININGTENT;
     player.npc = -1; // -1 means no NPC is being talked to
     player.dialogIndex = 0;
-    player.notebook = preferences.getString("playernotebook", "Your notebook has the following entries:\r\n\r\n");
-    player.beacon = preferences.getInt("playerbeacon", 1);
+    player.beacon = 1;
+    for (int i = 0; i < INVENTORY_ITEM_INDEX_COUNT; i++)
+    {
+        player.inventory[i] = 0;
+    }
+    addItem(INVENTORY_ITEM_LANTERN);
+    addItem(INVENTORY_ITEM_MAP);
+
+    // Read both save blob slots once any queued writes are done, newest first
+    Storage::sync();
+    preferences.begin(SAVE_NAMESPACE, true);
+    SaveSlot slots[2] = {readSlot(SAVE_KEY_A), readSlot(SAVE_KEY_B)};
     preferences.end();
+    if (slots[1].sequence > slots[0].sequence)
+    {
+        std::swap(slots[0], slots[1]);
+    }
 
-    // Player inventory is handled by the game-data-inventory preference namespace
-    preferences.begin("game-data-inventory", true);
-    bool inventoryInit = preferences.isKey("INIT");
-    if (inventoryInit == false)
+    // Load the newest save that is not damaged
+    saveSequence = 0;
+    for (int i = 0; i < 2; i++)
     {
-        preferences.end();
-        preferences.begin("game-data-inventory", false);
-        preferences.putBool("INIT", true);
-        for (int i = 0; i < INVENTORY_ITEM_INDEX_COUNT; i++)
+        if (!loaded && slots[i].blob != NULL && readSave(slots[i].blob, slots[i].length))
         {
-            preferences.putInt(InventoryItems[i], 0);
-            player.inventory[i] = 0;
+            loaded = true;
+            saveSequence = slots[i].sequence;
         }
-        preferences.end();
-        preferences.begin("game-data-inventory", true);
-        addItem(INVENTORY_ITEM_LANTERN);
-        addItem(INVENTORY_ITEM_MAP);
+        free(slots[i].blob);
     }
 
+    // Nothing has changed since the save that was just loaded
+    saveDirty = 0;
+    Notebook::load();
+
+    // Move a save in the old format over to the blob
+    if (!loaded && migrate())
+    {
+        save();
+        flush(true);
+    }
+
+    evaluateQuests();
+    player.previousRoom = player.room;
     konamiIndex = 0;
 }
 
 /// @brief Save game and player state to memory.
+/// The write is coalesced with any other changes, Adventure::flush() writes it within SAVE_FLUSH_INTERVAL.
 void Adventure::save()
 {
-    preferences.begin("game-data", false);
+    markDirty(SAVE_DIRTY_PLAYER);
+}
 
-    // Save specific variables we care about only if they have changed
-    if (preferences.getString("playername", "") != player.name)
+/// @brief Mark parts of the game state as changed so the next flush saves them
+/// @param fields SAVE_DIRTY_ bits
+void Adventure::markDirty(uint8_t fields)
+{
+    saveDirty |= fields;
+    saveRequests++;
+}
+
+// Quest flags set by game code rather than by a room action or a goal reward, for the reachability check in findRoomAction().
+// Keep in step with the setFlag() calls in the room action handlers, checkQuest() and displayRoom(),
+// test/test_quests plays every room and NPC and fails if a flag is listed here but never set.
+constexpr uint64_t QUESTS_SET_IN_CODE = questMask(QUEST_MODEL2023, QUEST_TRAINING, QUEST_CHANUTE, QUEST_PITTSBURG, QUEST_KANSASCITY,
+                                                  QUEST_TOPEKA, QUEST_GOODLAND, QUEST_DODGECITY, QUEST_NWTBALL, QUEST_NWTDISC,
+                                                  QUEST_NEWTON, QUEST_ICTWATERTAPE, QUEST_ICTWATER, QUEST_ICTAIRPORT);
+
+// The quest graph, one node per goal in QuestGoal order
+constexpr QuestNode questGraph[] = {
+    QuestNode(GOAL_VAULT_DOOR, questMask(QUEST_TRAININGVAULT)),
+    QuestNode(GOAL_KC_BUSES, QUESTS_KC_BUSES),
+    QuestNode(GOAL_TOPEKA_DRIVES, QUESTS_TOPEKA_DRIVES),
+    QuestNode(GOAL_PITTSBURG_ATTACK, QUESTS_PITTSBURG_ATTACK),
+    QuestNode(GOAL_GOODLAND_TAXIS, QUESTS_GOODLAND_TAXIS),
+    QuestNode(GOAL_ELLSWORTH_PLANT, questMask(QUEST_ELACCESS)),
+    QuestNode(GOAL_DODGECITY_TRAIN_DOOR, questMask(QUEST_DCCONDUCTOR)),
+    QuestNode(GOAL_DODGECITY_TRAIN, QUESTS_DODGECITY_TRAIN),
+    QuestNode(GOAL_WICHITA_ROADS, QUESTS_WICHITA_GATE),
+    QuestNode(GOAL_WICHITA_AIRPORT, QUESTS_WICHITA_AIRPORT),
+    QuestNode(GOAL_WICHITA_AIRPORT_DOOR, questMask(QUEST_ICTAIRUNLOCK)),
+    QuestNode(GOAL_WICHITA, questMask(QUEST_ICTWATER, QUEST_ICTAIRPORT))
+        .rewards(QUEST_WICHITA)
+        .says("\r\n\r\nCongratulations! You have completed all of the main quests in the game.\r\n\r\nHere is a flag for your accomplishments:")
+        .flag("OzSecCTF{Kan5@s_1s_s@f3_4_n0w}"),
+};
+
+static_assert(questGraphOrdered(questGraph), "The quest graph must have every goal once, in QuestGoal order");
+
+// Goals that need each quest flag, so a change only checks those again
+constexpr QuestDependents goalDependents = questDependents(questGraph);
+
+#define WICHITA_ROAD_CLOSED "As you approach there is a sign with 'Road Closed' and a law enforcement officer standing\r\nnearby. The officer tells you that this area is off limits as cities around the state\r\nare experiencing cyber related incidents and need assistance.\r\n\r\nYou are then escorted back where you came."
+
+// Rooms locked until a quest goal is met
+const RoomGate roomGates[] = {
+    {THEVAULT, GOAL_VAULT_DOOR, "The door is locked. Perhaps there's a key that can unlock it."}, // Training area vault
+    {291, GOAL_ELLSWORTH_PLANT, "The guard intercepts you, 'Sorry, you need to checkin first.'"}, // Ellsworth Water Treatment Plant
+    {370, GOAL_DODGECITY_TRAIN_DOOR, "The train door is locked."},                                // Dodge City Train
+    {429, GOAL_WICHITA_ROADS, WICHITA_ROAD_CLOSED},                                               // Roads into Wichita
+    {470, GOAL_WICHITA_ROADS, WICHITA_ROAD_CLOSED},
+    {404, GOAL_WICHITA_ROADS, WICHITA_ROAD_CLOSED},
+    {451, GOAL_WICHITA_ROADS, WICHITA_ROAD_CLOSED},
+    {495, GOAL_WICHITA_AIRPORT_DOOR, "The door is locked."},                                      // Wichita airport server room
+};
+
+// Quest goal updates, for stats
+unsigned long questUpdates; // Quest flag changes
+unsigned long questChecks;  // Goals checked again because of them
+
+/// @brief Set a quest flag, marking the save dirty and updating the quest goals if it changed
+/// @param flag Quest flag, for example QUEST_CHANUTE
+void Adventure::setFlag(QuestFlag flag, bool value)
+{
+    if (game.quests.has(flag) != value)
     {
-        preferences.putString("playername", player.name);
+        game.quests.set(flag, value);
+        markDirty(SAVE_DIRTY_FLAGS);
+        updateQuests(flag);
     }
+}
+
+/// @brief Check the goals that need a quest flag that just changed, then give the rewards of goals that are now met.
+/// @param flag Quest flag that changed
+void Adventure::updateQuests(QuestFlag flag)
+{
+    uint32_t before = game.goals.met;
+    uint32_t pending = goalDependents.goals[flag];
 
-    if (preferences.getInt("playerroom", TRAININGTENT) != player.room)
+    questUpdates++;
+    while (pending != 0)
     {
-        preferences.putInt("playerroom", player.room);
+        QuestGoal goal = (QuestGoal)__builtin_ctz(pending);
+        pending &= pending - 1;
+        game.goals.set(goal, game.quests.all(questGraph[goal].prerequisites));
+        questChecks++;
     }
 
-    if (preferences.getString("playernotebook", "") != player.notebook)
+    // A reward sets another flag, which updates the goals that need it in turn
+    uint32_t reached = game.goals.met & ~before;
+    while (reached != 0)
     {
-        preferences.putString("playernotebook", player.notebook);
+        const QuestNode &node = questGraph[__builtin_ctz(reached)];
+        reached &= reached - 1;
+        if (node.reward != -1 && !game.quests.has((QuestFlag)node.reward))
+        {
+            if (node.message != NULL)
+            {
+                Console.println(node.message);
+            }
+            if (node.ctf != NULL)
+            {
+                printFlag(node.ctf);
+            }
+            setFlag((QuestFlag)node.reward, true);
+        }
     }
+}
 
-    if (preferences.getInt("playerbeacon", 1) != player.beacon)
+/// @brief Check every quest goal from scratch, after the quest flags were loaded. Gives no rewards.
+void Adventure::evaluateQuests()
+{
+    for (int goal = 0; goal < GOAL_COUNT; goal++)
     {
-        preferences.putInt("playerbeacon", player.beacon);
+        game.goals.set((QuestGoal)goal, game.quests.all(questGraph[goal].prerequisites));
     }
+}
 
-    // Quest data
-    if (preferences.getBool("qmodel2023", false) != game.qmodel2023)
+/// @brief Get the time until the next save blob write is allowed
+/// @return Time in ms, 0 if a write is due now, or -1 if nothing needs saving
+long Adventure::flushDue()
+{
+    if (!saveDirty)
     {
-        preferences.putBool("qmodel2023", game.qmodel2023);
+        return -1;
     }
 
-    if (preferences.getBool("qtrainingvault", false) != game.qtrainingvault)
+    unsigned long since = millis() - lastSaveWrite;
+    return since >= SAVE_FLUSH_INTERVAL ? 0 : SAVE_FLUSH_INTERVAL - since;
+}
+
+/// @brief Get the time the game loop can sleep before it has to flush the save
+/// @return Time in ticks, portMAX_DELAY if nothing needs saving
+TickType_t Adventure::flushWait()
+{
+    long due = flushDue();
+    return due < 0 ? portMAX_DELAY : pdMS_TO_TICKS(due);
+}
+
+/// @brief Write the save blob if anything changed, at most once per SAVE_FLUSH_INTERVAL.
+/// The blob is handed to the storage task, the game loop does not wait for the write.
+/// @param force Write now even if the last write was less than SAVE_FLUSH_INTERVAL ago
+void Adventure::flush(bool force)
+{
+    if (!saveDirty || (!force && flushDue() != 0))
     {
-        preferences.putBool("qtrainingvault", game.qtrainingvault);
+        return;
     }
 
-    if (preferences.getBool("qtraining", false) != game.qtraining)
+    unsigned long start = micros();
+    lastSaveWrite = millis();
+
+    saveSequence++;
+    size_t length = writeSave(NULL);
+    uint8_t *blob = (uint8_t *)malloc(length);
+
+    if (blob == NULL)
     {
-        preferences.putBool("qtraining", game.qtraining);
+        saveSequence--;
+        return;
     }
+    writeSave(blob);
 
-    if (preferences.getBool("qchanute", false) != game.qchanute)
+    // Odd blobs go to slot A and even blobs to slot B, so the newest save is never overwritten.
+    // If the queue is full the changes stay dirty and are tried again after the flush interval.
+    if (!Storage::putBytes(SAVE_NAMESPACE, saveSequence % 2 ? SAVE_KEY_A : SAVE_KEY_B, blob, length))
     {
-        preferences.putBool("qchanute", game.qchanute);
+        saveSequence--;
+        return;
     }
 
-    if (preferences.getBool("qpittsburg", false) != game.qpittsburg)
+    unsigned long elapsed = micros() - start;
+    saveCount++;
+    saveDirty = 0;
+    saveTime += elapsed;
+    saveTimeMax = max(saveTimeMax, elapsed);
+}
+
+/// @brief Write the game and player state as a save blob.
+/// @param blob Buffer to write to, or NULL to only work out the length
+/// @return Length of the blob in bytes
+size_t Adventure::writeSave(uint8_t *blob)
+{
+    size_t length = sizeof(SaveHeader);
+    uint8_t nameLength = min(player.name.length(), (unsigned int)UINT8_MAX);
+    int16_t room = player.room;
+    int16_t beacon = player.beacon;
+
+    // Player
+    blobWrite(blob, length, &room, sizeof(room));
+    blobWrite(blob, length, &beacon, sizeof(beacon));
+
+    // Quest flags, one bit each in QuestFlag order
+    uint8_t flagCount = QUEST_COUNT;
+    blobWrite(blob, length, &flagCount, sizeof(flagCount));
+    for (int i = 0; i < QUEST_COUNT; i += 8)
     {
-        preferences.putBool("qpittsburg", game.qpittsburg);
+        uint8_t bits = game.quests.bits >> i;
+        blobWrite(blob, length, &bits, sizeof(bits));
     }
 
-    if (preferences.getBool("qkansascity", false) != game.qkansascity)
+    // Inventory, one count each
+    uint8_t itemCount = INVENTORY_ITEM_INDEX_COUNT;
+    blobWrite(blob, length, &itemCount, sizeof(itemCount));
+    for (int i = 0; i < INVENTORY_ITEM_INDEX_COUNT; i++)
     {
-        preferences.putBool("qkansascity", game.qkansascity);
+        uint8_t count = constrain(player.inventory[i], 0, UINT8_MAX);
+        blobWrite(blob, length, &count, sizeof(count));
     }
 
-    if (preferences.getBool("qtopeka", false) != game.qtopeka)
+    // Name
+    blobWrite(blob, length, &nameLength, sizeof(nameLength));
+    blobWrite(blob, length, player.name.c_str(), nameLength);
+
+    if (blob != NULL)
     {
-        preferences.putBool("qtopeka", game.qtopeka);
+        SaveHeader header = {SAVE_VERSION, saveSequence, (uint32_t)(length - sizeof(SaveHeader)), 0};
+        header.crc = esp_rom_crc32_le(0, blob + sizeof(SaveHeader), header.length);
+        memcpy(blob, &header, sizeof(header));
     }
 
-    if (preferences.getBool("qgoodland", false) != game.qgoodland)
+    return length;
+}
+
+/// @brief Check a save blob and load the game and player state from it.
+/// @return false if the blob is damaged or from an unknown version, nothing is loaded then
+bool Adventure::readSave(const uint8_t *blob, size_t length)
+{
+    size_t pos = sizeof(SaveHeader);
+    int16_t room;
+    int16_t beacon;
+    uint8_t flagCount;
+    uint8_t itemCount;
+    uint8_t nameLength;
+
+    if (!checkSave(blob, length))
     {
-        preferences.putBool("qgoodland", game.qgoodland);
+        return false;
     }
 
-    if (preferences.getBool("qdodgecity", false) != game.qdodgecity)
+    // Check every length before changing any state
+    if (!blobRead(blob, length, pos, &room, sizeof(room)) ||
+        !blobRead(blob, length, pos, &beacon, sizeof(beacon)) ||
+        !blobRead(blob, length, pos, &flagCount, sizeof(flagCount)))
     {
-        preferences.putBool("qdodgecity", game.qdodgecity);
+        return false;
+    }
+    const uint8_t *flags = blob + pos;
+    pos += (flagCount + 7) / 8;
+    if (!blobRead(blob, length, pos, &itemCount, sizeof(itemCount)))
+    {
+        return false;
     }
+    const uint8_t *items = blob + pos;
+    pos += itemCount;
+    if (!blobRead(blob, length, pos, &nameLength, sizeof(nameLength)) || pos + nameLength != length)
+    {
+        return false;
+    }
+    const char *name = (const char *)blob + pos;
 
-    if (preferences.getBool("qnewton", false) != game.qnewton)
+    player.room = room;
+    player.beacon = beacon;
+    for (int i = 0; i < QUEST_COUNT && i < flagCount; i++)
     {
-        preferences.putBool("qnewton", game.qnewton);
+        game.quests.set((QuestFlag)i, flags[i / 8] & (1 << (i % 8)));
     }
+    for (int i = 0; i < INVENTORY_ITEM_INDEX_COUNT && i < itemCount; i++)
+    {
+        player.inventory[i] = items[i];
+    }
+    player.name = String(name, nameLength);
+
+    return true;
+}
+
+/// @brief Load a save in the old one key per value format, then remove it.
+/// @return true if there was an old save
+bool Adventure::migrate()
+{
+    String notebook;
+
+    preferences.begin("game-data", false);
+    bool found = preferences.isKey("playername"); // Always written by the first save
+    nvsReads++;
 
-    if (preferences.getBool("qellsworth", false) != game.qellsworth)
+    if (found)
     {
-        preferences.putBool("qellsworth", game.qellsworth);
+        for (size_t i = 0; i < sizeof(legacyFlags) / sizeof(legacyFlags[0]); i++)
+        {
+            game.quests.set(legacyFlagQuests[i], preferences.getBool(legacyFlags[i], false));
+        }
+        player.name = preferences.getString("playername", "User");
+        player.room = preferences.getInt("playerroom", TRAININGTENT);
+        notebook = preferences.getString("playernotebook", "");
+        player.beacon = preferences.getInt("playerbeacon", 1);
+        nvsReads += sizeof(legacyFlags) / sizeof(legacyFlags[0]) + 4;
+        preferences.clear();
     }
+    preferences.end();
 
-    if (preferences.getBool("qwichita", false) != game.qwichita)
+    if (!found)
     {
-        preferences.putBool("qwichita", game.qwichita);
+        return false;
     }
 
-    preferences.end();
+    // The old notebook was one string, a title and a blank line then one entry per line.
+    // Wait for each entry so the storage queue never fills up.
+    int start = notebook.indexOf("\r\n\r\n");
+    start = start < 0 ? 0 : start + 4;
+    while (start < (int)notebook.length())
+    {
+        int end = notebook.indexOf('\n', start);
+        end = end < 0 ? notebook.length() : end;
+        String entry = notebook.substring(start, end);
+        entry.trim();
+        if (entry.length() > 0)
+        {
+            Notebook::add(entry);
+            Storage::sync();
+        }
+        start = end + 1;
+    }
 
     preferences.begin("game-data-inventory", false);
-    for (int i = 0; i < INVENTORY_ITEM_INDEX_COUNT; i++)
+    if (preferences.isKey("INIT"))
     {
-        preferences.putInt(InventoryItems[i], player.inventory[i]);
+        for (int i = 0; i < INVENTORY_ITEM_INDEX_COUNT; i++)
+        {
+            player.inventory[i] = preferences.getInt(InventoryItems[i], player.inventory[i]);
+        }
+        nvsReads += INVENTORY_ITEM_INDEX_COUNT;
     }
+    preferences.clear();
     preferences.end();
+
+    return true;
 }
 
 /// @brief Check if the player has a specific item in their inventory.
@@ -398,6 +804,7 @@ void Adventure::addItem(int item)
     if (item < INVENTORY_ITEM_INDEX_COUNT)
     {
         player.inventory[item]++;
+        markDirty(SAVE_DIRTY_INVENTORY);
     }
 
     return;
@@ -410,6 +817,7 @@ void Adventure::removeItem(int item)
         if (player.inventory[item] > 0)
         {
             player.inventory[item]--;
+            markDirty(SAVE_DIRTY_INVENTORY);
         }
     }
 
@@ -456,7 +864,7 @@ void Adventure::unsetCallback()
 
 void Adventure::completeTraining()
 {
-    game.qtraining = true;
+    setFlag(QUEST_TRAINING, true);
     save();
 
     setCallback(&Adventure::displayMessage);
@@ -466,7 +874,7 @@ void Adventure::completeTraining()
 void Adventure::setNickname(String response)
 {
     player.name = response;
-    preferences.putString("playername", player.name);
+    save();
     game.message = "Your nickname is now " + player.name + ".";
     setCallback(&Adventure::displayMessage);
     unsetPromptCallback();
@@ -494,7 +902,7 @@ void Adventure::confirmWifi(String response)
 void Adventure::setWifiSsid(String response)
 {
     wifiSsid = response;
-    preferences.putString("wifiSsid", wifiSsid);
+    Storage::putString("badge-state", "wifiSsid", wifiSsid);
     game.message = "WiFi SSID set to '" + response + "'\r\nPlease enter the password:";
     setCallback(&Adventure::displayMessage);
     setPromptCallback(&Adventure::setWifiPassword);
@@ -504,1475 +912,713 @@ void Adventure::setWifiSsid(String response)
 void Adventure::setWifiPassword(String response)
 {
     wifiPassword = response;
-    preferences.putString("wifiPassword", wifiPassword);
+    Storage::putString("badge-state", "wifiPassword", wifiPassword);
     game.message = "WiFi Password set.";
     setCallback(&Adventure::displayMessage);
     unsetPromptCallback();
 }
 
-/// @brief Handle room specific actions. This is the majority of the game world logic.
-void Adventure::roomAction(String action)
+/// @brief Konami code state machine, the position in the code after an action.
+/// Has no side effects, the position is kept in konamiIndex.
+/// @param index Position before the action
+/// @return KONAMI_INDEX_MAX once the whole code was entered, 0 if the action is not the next step
+static int konamiNext(int index, const char *action)
+{
+    return strcmp(action, konamiStrings[index]) == 0 ? index + 1 : 0;
+}
+
+/// @brief Work out what the player typed in one pass over the input, without changing any state.
+/// The input is checked against the Konami code in the Arcade, then the room's options once,
+/// then split into a command name and arguments.
+/// @param text Input, nul terminated
+/// @param length Length of the input
+PlayerAction Adventure::resolve(const char *text, size_t length)
 {
-    // Invalid directions will return -1
-    if (player.room == -1)
+    static const char directions[] = "news"; // Keys in the order of NORTH, EAST, WEST and SOUTH
+    PlayerAction action = {ACTION_UNKNOWN, -1, 0, NULL, NULL, ""};
+
+    if (promptCallback)
     {
-        player.room = player.previousRoom;
-        game.message = "You can't go that way.";
-        setCallback(&Adventure::displayMessage);
-        return;
+        action.type = ACTION_PROMPT;
+        return action;
     }
 
-    if (player.room < -1 || player.room >= sizeof(rooms) / sizeof(rooms[0]))
+    // Most of the Konami code isn't an option in the Arcade, so it goes first
+    if (player.room == 497)
     {
-        player.room = GRANDLOBBY;
-        game.message = "You found yourself somewhere dark and hazy, after taking a few steps you are in the Grand Lobby.";
-        setCallback(&Adventure::displayMessage);
-        return;
+        action.konami = konamiNext(konamiIndex, text);
+        if (action.konami > 0)
+        {
+            action.type = ACTION_KONAMI;
+            return action;
+        }
     }
 
-    player.previousRoom = player.room;
-
-    // Handle Konami code special case first
-    if (player.room == 497)
+    if (Rooms::hasOption(player.room, text))
     {
-        if (action == konamiStrings[konamiIndex])
+        const char *direction = length == 1 ? strchr(directions, text[0]) : NULL;
+        if (direction != NULL)
         {
-            konamiIndex++;
-            if (konamiIndex == KONAMI_INDEX_MAX)
-            {
-                printFlag("KONAMI - OzSecCTF{K0n@m1_C0nTr@_Gr@d1u5}");
-                konamiIndex = 0;
-                setCallback(&Adventure::displayRoom);
-            }
-            return;
+            action.type = ACTION_DIRECTION;
+            action.direction = direction - directions;
         }
         else
         {
-            konamiIndex = 0;
+            action.type = ACTION_ROOM;
+            action.roomAction = findRoomAction(player.room, text, length);
         }
+        return action;
     }
 
-    // Handle directions second
-    if (action == "n" || action == "e" || action == "w" || action == "s")
+    // System commands, the command name is everything up to the first space
+    const char *space = (const char *)memchr(text, ' ', length);
+    action.command = findCommand(text, space == NULL ? length : space - text);
+    if (action.command != NULL)
     {
-        if (action == "n")
-        {
-            player.room = rooms[player.room].neighbors[NORTH];
-            setCallback(&Adventure::displayRoom);
-            return;
-        }
-        else if (action == "e")
+        action.type = ACTION_COMMAND;
+        action.arguments = space == NULL ? "" : space + 1;
+    }
+    return action;
+}
+
+/// @brief Run a Konami code step, a direction or a room option, see findRoomAction().
+void Adventure::roomAction(const PlayerAction &action)
+{
+    player.previousRoom = player.room;
+
+    switch (action.type)
+    {
+    case ACTION_KONAMI:
+        konamiIndex = action.konami;
+        if (konamiIndex == KONAMI_INDEX_MAX)
         {
-            player.room = rooms[player.room].neighbors[EAST];
+            printFlag("KONAMI - OzSecCTF{K0n@m1_C0nTr@_Gr@d1u5}");
+            konamiIndex = 0;
             setCallback(&Adventure::displayRoom);
-            return;
         }
-        else if (action == "w")
+        break;
+
+    case ACTION_DIRECTION:
+        player.room = Rooms::neighbor(player.room, action.direction);
+        // Invalid directions return -1
+        if (player.room == -1)
         {
-            player.room = rooms[player.room].neighbors[WEST];
-            setCallback(&Adventure::displayRoom);
-            return;
+            player.room = player.previousRoom;
+            game.message = "You can't go that way.";
+            setCallback(&Adventure::displayMessage);
+            break;
         }
-        else if (action == "s")
+        setCallback(&Adventure::displayRoom);
+        break;
+
+    case ACTION_ROOM:
+        if (action.roomAction != NULL)
         {
-            player.room = rooms[player.room].neighbors[SOUTH];
-            setCallback(&Adventure::displayRoom);
-            return;
+            runRoomAction(*action.roomAction);
         }
-    }
-
-    // Handle other specific room actions.
-    for (int i = 0; i < MAX_ROOM_OPTIONS; i++)
-    {
-        if (action == rooms[player.room].options[i])
-        {
-            switch (player.room)
-            {
-            // BEGIN Training Area actions
-            case THEVAULT:
-                if (action == "flag")
-                {
-                    printFlag("OzSecCTF{V4u1t_hunt3r_h@cke2}");
-                    game.message = "You inspect the pennant and find a CTF flag written on the back.";
-                    setCallback(&Adventure::displayMessage);
-                }
-                else if (action == "talk")
-                {
-                    player.npc = 0; // ID of NPC we are talking to
-                    setCallback(&Adventure::displayDialog);
-                    setPromptCallback(&Adventure::talkToNPC); // Sets handler for responses
-                }
-                break;
-
-            case GRANDLOBBY:
-                if (action == "unlock")
-                {
-                    // Check that the key is available
-                    if (hasItem(INVENTORY_ITEM_RED_KEYCARD))
-                    {
-                        game.qtrainingvault = true;
-                        save();
-                        game.message = "You swipe the Red Keycard against the reader and the door beeps and a thunk can be heard as the door unlocks and swings open.";
-                        setCallback(&Adventure::displayMessage);
-                        return;
-                    }
-                    else
-                    {
-                        game.message = "You don't have any items that would work with this lock.";
-                        setCallback(&Adventure::displayMessage);
-                        return;
-                    }
-                }
-                break;
-
-            case GREATOUTDOORS:
-                if (action == "key")
-                {
-                    addItem(INVENTORY_ITEM_RED_KEYCARD);
-                    game.message = "You pick up the battered Red Keycard.";
-                    setCallback(&Adventure::displayMessage);
-                }
-                else if (action == "talk")
-                {
-                    player.npc = 1; // ID of NPC we are talking to
-                    setCallback(&Adventure::displayDialog);
-                    setPromptCallback(&Adventure::talkToNPC); // Sets handler for responses
-                }
-                else if (action == "button")
-                {
-                    if (game.qtraining)
-                    {
-                        Serial.println("You press the button embedded in the tree and feel a strange sensation as you are teleported away from the training area.");
-                        player.room = GAMESTART;
-                        setCallback(&Adventure::displayRoom);
-                    }
-                    else
-                    {
-                        Serial.println("You press the button, it makes a click, but nothing else happens.");
-                        setCallback(&Adventure::displayRoom);
-                    }
-                }
-                break;
-
-            case TRAININGTENT:
-                if (action == "paper")
-                {
-                    game.message = "The paper reads:\r\n\r\nWelcome to the text based adventure game!\r\n\r\nFirst off, you can type 'help' to get a list of all available commands. When you first enter a room, or when you 'look' you will see the title of the room, the description, and any actions in brackets (like [paper]) that you can type to interact with that object. Under that will be the available directions to go to a different room.\r\n\r\nTo move around, type the direction you want to go (n, e, w, s) if that direction is available.\r\n\r\nTo talk to NPCs, type 'talk'.\r\n\r\nTo see your inventory, type 'inventory' or 'i'.\r\n\r\nTo save your game, type 'save'.\r\n\r\nTo exit the game, type 'exit'.\r\n\r\nRemember to check out 'help' as there are more commands available.\r\n\r\nNext, let's try 'look'ing around, and then try talking to the janitor. When you're done, head out of the tent to the west to explore the world.";
-                    setCallback(&Adventure::displayMessage);
-                }
-                else if (action == "talk")
-                {
-                    player.npc = 0; // ID of NPC we are talking to
-                    setCallback(&Adventure::displayDialog);
-                    setPromptCallback(&Adventure::talkToNPC); // Sets handler for responses
-                }
-                break;
-            // END Training Area actions
-            // BEGIN Kansas City actions
-            case 11:
-                if (action == "talk")
-                {
-                    game.message = "Driver: Oh, you aren't supposed to be here. Go see the maintenance manager... and don't mention I brought you here.";
-                    setCallback(&Adventure::displayMessage);
-                }
-                else if (action == "load")
-                {
-                    game.qkcbus1024 = true;
-                    game.message = "You take one of the blank tapes and insert them into the tape drive.";
-                    setCallback(&Adventure::displayMessage);
-                }
-                break;
-
-            case 14:
-                if (action == "filter")
-                {
-                    game.qkcbus1138 = true;
-                    game.message = "You remove the filter and replace it the one sitting on the seat.";
-                    setCallback(&Adventure::displayMessage);
-                }
-                break;
-
-            case 16:
-                if (action == "tire")
-                {
-                    game.qkcbus2018 = true;
-                    game.message = "You check the spare tire pressure, it is good.";
-                    setCallback(&Adventure::displayMessage);
-                }
-                break;
-
-            case 19:
-                if (action == "talk")
-                {
-                    player.npc = 13;
-                    setCallback(&Adventure::displayDialog);
-                    setPromptCallback(&Adventure::talkToNPC);
-                }
-                break;
-
-            case 20:
-                if (action == "cheese")
-                {
-                    printFlag("OzSecCTF{Ch33s3_1s_L1f3}");
-                    game.message = "You pick up the slice of cheese, and see a flag printed on the back.";
-                    setCallback(&Adventure::displayMessage);
-                }
-                break;
-
-            case 21:
-                if (action == "bus")
-                {
-                    if (game.qkcbus1024 && game.qkcbus1138 && game.qkcbus2018 && hasItem(INVENTORY_ITEM_A_TICKET_TO_TOPEKA))
-                    {
-                        printFlag("OzSecCTF{Adv3nture_T1m3_1s_H3r3}");
-                        game.qkansascity = true;
-                        Serial.println("You board the bus and take off to Topeka");
-                        sleep(2);
-                        player.room = 61;
-                        setCallback(&Adventure::displayRoom);
-                    }
-                    else
-                    {
-                        game.message = "You need approval from the maintenance manager before you can leave.";
-                        setCallback(&Adventure::displayMessage);
-                    }
-                }
-                break;
-            // END Kansas City actions
-            // BEGIN Topeka
-            case 79:
-                if (action == "drive")
-                {
-                    game.qtpkdrive1 = true;
-                    game.message = "You pull the drive from the PC.";
-                    setCallback(&Adventure::displayMessage);
-                }
-                break;
-
-            case 81:
-                if (action == "donuts")
-                {
-                    if (hasItem(INVENTORY_ITEM_BOX_OF_DONUTS))
-                    {
-                        printFlag("OzSecCTF{D0nut5_4r3_d3lici0us}");
-                        game.message = "Everyone cheers as you hand out the donuts. You find a flag written on the bottom of the box.";
-                        setCallback(&Adventure::displayMessage);
-                    }
-                    else
-                    {
-                        game.message = "If only you had a new box of donuts to share.";
-                        setCallback(&Adventure::displayMessage);
-                    }
-                }
-                else if (action == "analyze")
-                {
-                    if (game.qtpkdrive1 && game.qtpkdrive2 && game.qtpkdrive3 && game.qtpkdrive4 && game.qtpkdrive5)
-                    {
-                        printFlag("OzSecCTF{4n@lyz3_Th3_D@t@}");
-                        game.qtopeka = true;
-                        game.message = "The technicians analyze the drives and identify the source of the malware. They are able to swiftly disable it and restore operations.";
-                        setCallback(&Adventure::displayMessage);
-                    }
-                    else
-                    {
-                        game.message = "Tech: We need all of the encrypted drives from inside the hospital to analyze and figure out this attack.";
-                        setCallback(&Adventure::displayMessage);
-                    }
-                }
-                break;
-
-            case 86:
-                if (action == "drive")
-                {
-                    game.qtpkdrive2 = true;
-                    game.message = "You pull the drive from the PC.";
-                    setCallback(&Adventure::displayMessage);
-                }
-                break;
-
-            case 87:
-                if (action == "donuts")
-                {
-                    addItem(INVENTORY_ITEM_BOX_OF_DONUTS);
-                    game.message = "You pick up the box of donuts.";
-                    setCallback(&Adventure::displayMessage);
-                }
-                break;
-
-            case 89:
-                if (action == "drive")
-                {
-                    game.qtpkdrive3 = true;
-                    game.message = "You pull the drive from the PC.";
-                    setCallback(&Adventure::displayMessage);
-                }
-                break;
-
-            case 90:
-                if (action == "drive")
-                {
-                    game.qtpkdrive4 = true;
-                    game.message = "You pull the drive from the PC.";
-                    setCallback(&Adventure::displayMessage);
-                }
-                break;
-
-            case 93:
-                if (action == "pi")
-                {
-                    addItem(INVENTORY_ITEM_A_RASPBERRY_PI);
-                    game.message = "You pick up the Raspberry Pi. Maybe someone would be interested in it?";
-                    setCallback(&Adventure::displayMessage);
-                }
-                break;
-
-            case 94:
-                if (action == "drive")
-                {
-                    game.qtpkdrive5 = true;
-                    game.message = "You pull the drive from the PC.";
-                    setCallback(&Adventure::displayMessage);
-                }
-                break;
-
-            case 98:
-                if (action == "pi")
-                {
-                    if (hasItem(INVENTORY_ITEM_A_RASPBERRY_PI))
-                    {
-                        printFlag("OzSecCTF{R@spb3rry_Pi}");
-                        removeItem(INVENTORY_ITEM_A_RASPBERRY_PI);
-                        game.message = "You hand the Raspberry Pi to the manager and they thank you. You find a flag written on the back of the Pi.";
-                        setCallback(&Adventure::displayMessage);
-                    }
-                    else
-                    {
-                        game.message = "If only you had a Raspberry Pi to add to their collection.";
-                        setCallback(&Adventure::displayMessage);
-                    }
-                }
-                break;
-            // END Topeka
-            // BEGIN Chanute actions
-            case 100:
-                if (action == "poster")
-                {
-                    game.message = "SEEKING INFORMATION\n====================\nLocal reporter seeks information on the history of Chanute.\n\nFor more information visit Town Hall.\n\n- Chanute Tribune";
-                    setCallback(&Adventure::displayMessage);
-                }
-                break;
-            case 103:
-                if (action == "coupon")
-                {
-                    if (hasItem(INVENTORY_ITEM_COFFEE_CONNECTION_BOGO_COUPON))
-                    {
-                        game.message = "You hand the coupon and some cash to the barista and they hand you two cups of coffee.";
-                        addItem(INVENTORY_ITEM_TWO_CUP_O_JOES);
-                        setCallback(&Adventure::displayMessage);
-                    }
-                    else
-                    {
-                        game.message = "You don't seem to have a valid coupon. The barista mentions that they put flyers around the town with the coupons if you can find one.";
-                        setCallback(&Adventure::displayMessage);
-                    }
-                }
-                else if (action == "beacon")
-                {
-                    player.beacon = player.room;
-                    game.message = "You set your beacon to this location.\r\nYou can return here at any time by typing 'beacon'";
-                    setCallback(&Adventure::displayMessage);
-                }
-                break;
-            case 118:
-                if (action == "talk")
-                {
-                    player.npc = 2; // ID of NPC we are talking to
-                    setCallback(&Adventure::displayDialog);
-                    setPromptCallback(&Adventure::talkToNPC); // Sets handler for responses
-                }
-                break;
-            case 122:
-                if (action == "sign")
-                {
-                    addItem(INVENTORY_ITEM_CHANOOGLE_SIGN);
-                    save(); // Save the flag and quest state
-                    game.message = "There is a rusty sign that reads 'Chanoogle' on it. This must be what Chanute was once named.\r\nAs you clear some dust off the sign it falls off, so you pick it up.";
-                    setCallback(&Adventure::displayMessage);
-                }
-                break;
-            case 127:
-                if (action == "sign")
-                {
-                    game.message = "Someone has printed out a sign describes the latest coffees available at Coffee Connection.\nIt has a tear-off [coupon], with only a couple left.\nThe coupon is for buy one get one.";
-                    setCallback(&Adventure::displayMessage);
-                }
-                else if (action == "coupon")
-                {
-                    addItem(INVENTORY_ITEM_COFFEE_CONNECTION_BOGO_COUPON);
-                    game.message = "You tear off a coupon from the sign.";
-                    setCallback(&Adventure::displayMessage);
-                }
-                break;
-            case 130:
-                if (action == "sign")
-                {
-                    game.message = "A sign reads 'Seeking information on Chanute history. Visit Town Hall for more information.' and is signed by the Chanute Tribune.";
-                    setCallback(&Adventure::displayMessage);
-                }
-                break;
-            case 137:
-                if (action == "leaflet")
-                {
-                    addItem(INVENTORY_ITEM_CHANUTE_TRIBUNE_LEAFLET);
-                    game.message = "You pick up a leaflet from the ground. It reads 'Chanute Tribune - Local News'\nOn the back side it has a request for information on the history of Chanute and mentions a reporter stationed at Town Hall.";
-                    setCallback(&Adventure::displayMessage);
-                }
-                // END Chanute actions
+        break;
 
-                // BEGIN Pittsburg actions
+    default:
+        break;
+    }
+}
 
-            case 150:
-                if (action == "billboard")
-                {
-                    game.message = "The digital sign appears to have been compromised by ransomware of some kind. It displays a crypto wallet address.";
-                    setCallback(&Adventure::displayMessage);
-                }
-                break;
+/// @brief Find the action for a room option with one hash table lookup.
+/// This table is the majority of the game world logic, actions that don't fit its effects run a handler.
+/// @param room Room ID
+/// @param verb The option typed, it does not need to be nul terminated
+/// @param length Length of the option
+/// @return The action, or NULL if the option does nothing in this room
+const RoomAction *Adventure::findRoomAction(int room, const char *verb, size_t length)
+{
+    static constexpr RoomAction actions[] = {
+        // BEGIN Training Area actions
+        RoomAction(THEVAULT, "flag")
+            .flag("OzSecCTF{V4u1t_hunt3r_h@cke2}")
+            .says("You inspect the pennant and find a CTF flag written on the back."),
+        RoomAction(THEVAULT, "talk").talk(0), // Not in the room's options, can't be reached yet
+        RoomAction(GRANDLOBBY, "unlock")
+            .needs(INVENTORY_ITEM_RED_KEYCARD, "You don't have any items that would work with this lock.")
+            .sets(QUEST_TRAININGVAULT)
+            .saves()
+            .says("You swipe the Red Keycard against the reader and the door beeps and a thunk can be heard as the door unlocks and swings open."),
+        RoomAction(GREATOUTDOORS, "key")
+            .gives(INVENTORY_ITEM_RED_KEYCARD)
+            .says("You pick up the battered Red Keycard."),
+        RoomAction(GREATOUTDOORS, "talk").talk(1),
+        RoomAction(GREATOUTDOORS, "button").runs(&Adventure::actionTrainingButton),
+        RoomAction(TRAININGTENT, "paper")
+            .says("The paper reads:\r\n\r\nWelcome to the text based adventure game!\r\n\r\nFirst off, you can type 'help' to get a list of all available commands. When you first enter a room, or when you 'look' you will see the title of the room, the description, and any actions in brackets (like [paper]) that you can type to interact with that object. Under that will be the available directions to go to a different room.\r\n\r\nTo move around, type the direction you want to go (n, e, w, s) if that direction is available.\r\n\r\nTo talk to NPCs, type 'talk'.\r\n\r\nTo see your inventory, type 'inventory' or 'i'.\r\n\r\nTo save your game, type 'save'.\r\n\r\nTo exit the game, type 'exit'.\r\n\r\nRemember to check out 'help' as there are more commands available.\r\n\r\nNext, let's try 'look'ing around, and then try talking to the janitor. When you're done, head out of the tent to the west to explore the world."),
+        RoomAction(TRAININGTENT, "talk").talk(0),
+        // END Training Area actions
+        // BEGIN Kansas City actions
+        RoomAction(11, "talk")
+            .says("Driver: Oh, you aren't supposed to be here. Go see the maintenance manager... and don't mention I brought you here."),
+        RoomAction(11, "load")
+            .sets(QUEST_KCBUS1024)
+            .says("You take one of the blank tapes and insert them into the tape drive."),
+        RoomAction(14, "filter")
+            .sets(QUEST_KCBUS1138)
+            .says("You remove the filter and replace it the one sitting on the seat."),
+        RoomAction(16, "tire").sets(QUEST_KCBUS2018).says("You check the spare tire pressure, it is good."),
+        RoomAction(19, "talk").talk(13),
+        RoomAction(20, "cheese")
+            .flag("OzSecCTF{Ch33s3_1s_L1f3}")
+            .says("You pick up the slice of cheese, and see a flag printed on the back."),
+        RoomAction(21, "bus").runs(&Adventure::actionBusToTopeka),
+        // END Kansas City actions
+        // BEGIN Topeka
+        RoomAction(79, "drive").sets(QUEST_TPKDRIVE1).says("You pull the drive from the PC."),
+        RoomAction(81, "donuts")
+            .needs(INVENTORY_ITEM_BOX_OF_DONUTS, "If only you had a new box of donuts to share.")
+            .flag("OzSecCTF{D0nut5_4r3_d3lici0us}")
+            .says("Everyone cheers as you hand out the donuts. You find a flag written on the bottom of the box."),
+        RoomAction(81, "analyze").runs(&Adventure::actionAnalyzeDrives),
+        RoomAction(86, "drive").sets(QUEST_TPKDRIVE2).says("You pull the drive from the PC."),
+        RoomAction(87, "donuts").gives(INVENTORY_ITEM_BOX_OF_DONUTS).says("You pick up the box of donuts."),
+        RoomAction(89, "drive").sets(QUEST_TPKDRIVE3).says("You pull the drive from the PC."),
+        RoomAction(90, "drive").sets(QUEST_TPKDRIVE4).says("You pull the drive from the PC."),
+        RoomAction(93, "pi")
+            .gives(INVENTORY_ITEM_A_RASPBERRY_PI)
+            .says("You pick up the Raspberry Pi. Maybe someone would be interested in it?"),
+        RoomAction(94, "drive").sets(QUEST_TPKDRIVE5).says("You pull the drive from the PC."),
+        RoomAction(98, "pi")
+            .needs(INVENTORY_ITEM_A_RASPBERRY_PI, "If only you had a Raspberry Pi to add to their collection.")
+            .takes(INVENTORY_ITEM_A_RASPBERRY_PI)
+            .flag("OzSecCTF{R@spb3rry_Pi}")
+            .says("You hand the Raspberry Pi to the manager and they thank you. You find a flag written on the back of the Pi."),
+        // END Topeka
+        // BEGIN Chanute actions
+        RoomAction(100, "poster")
+            .says("SEEKING INFORMATION\n====================\nLocal reporter seeks information on the history of Chanute.\n\nFor more information visit Town Hall.\n\n- Chanute Tribune"),
+        RoomAction(103, "coupon")
+            .needs(INVENTORY_ITEM_COFFEE_CONNECTION_BOGO_COUPON, "You don't seem to have a valid coupon. The barista mentions that they put flyers around the town with the coupons if you can find one.")
+            .gives(INVENTORY_ITEM_TWO_CUP_O_JOES)
+            .says("You hand the coupon and some cash to the barista and they hand you two cups of coffee."),
+        RoomAction(103, "beacon").runs(&Adventure::actionBeacon),
+        RoomAction(118, "talk").talk(2),
+        RoomAction(122, "sign")
+            .gives(INVENTORY_ITEM_CHANOOGLE_SIGN)
+            .saves()
+            .says("There is a rusty sign that reads 'Chanoogle' on it. This must be what Chanute was once named.\r\nAs you clear some dust off the sign it falls off, so you pick it up."),
+        RoomAction(127, "sign")
+            .says("Someone has printed out a sign describes the latest coffees available at Coffee Connection.\nIt has a tear-off [coupon], with only a couple left.\nThe coupon is for buy one get one."),
+        RoomAction(127, "coupon")
+            .gives(INVENTORY_ITEM_COFFEE_CONNECTION_BOGO_COUPON)
+            .says("You tear off a coupon from the sign."),
+        RoomAction(130, "sign")
+            .says("A sign reads 'Seeking information on Chanute history. Visit Town Hall for more information.' and is signed by the Chanute Tribune."),
+        RoomAction(137, "leaflet")
+            .gives(INVENTORY_ITEM_CHANUTE_TRIBUNE_LEAFLET)
+            .says("You pick up a leaflet from the ground. It reads 'Chanute Tribune - Local News'\nOn the back side it has a request for information on the history of Chanute and mentions a reporter stationed at Town Hall."),
+        // END Chanute actions
+        // BEGIN Pittsburg actions
+        RoomAction(150, "billboard")
+            .says("The digital sign appears to have been compromised by ransomware of some kind. It displays a crypto wallet address."),
+        RoomAction(153, "rose")
+            .gives(INVENTORY_ITEM_A_RED_ROSE)
+            .says("The shopkeeper offers you the rose.\r\nYou pick up the rose and it smells sweet."),
+        RoomAction(157, "coffee")
+            .gives(INVENTORY_ITEM_STACEYS_CUP_OF_COFFEE)
+            .says("You grab the coffee, maybe you'll run into Stacey later."),
+        RoomAction(157, "beacon").runs(&Adventure::actionBeacon),
+        RoomAction(161, "letter")
+            .gives(INVENTORY_ITEM_A_LETTER_TO_THE_PITTSBURG_COURTS)
+            .says("You pick up the letter."),
+        RoomAction(161, "talk").talk(6),
+        RoomAction(170, "talk").talk(7),
+        RoomAction(171, "talk").talk(8),
+        RoomAction(174, "drive")
+            .needs(INVENTORY_ITEM_A_USB_DRIVE_FROM_THE_PITTSBURG_PARK, "You don't have a USB drive.")
+            .flag("OzSecCTF{Gray_H@t_H@ck3r}")
+            .says("You plug the USB drive you found in the park into the PC.\r\nThis doesn't feel right..."),
+        RoomAction(178, "drive")
+            .gives(INVENTORY_ITEM_A_USB_DRIVE_FROM_THE_PITTSBURG_PARK)
+            .says("You pick up the USB drive and place it in your pocket."),
+        RoomAction(178, "plant")
+            .needs(INVENTORY_ITEM_A_RED_ROSE, "You don't have anything to plant.")
+            .flag("OzSecCTF{R0s3s_4r3_r3d}")
+            .says("You place the rose in the planter and it looks nice."),
+        RoomAction(193, "talk").talk(9),
+        RoomAction(195, "ladder").gives(INVENTORY_ITEM_A_LADDER).says("You pick up the ladder and carry it with you."),
+        RoomAction(198, "climb").runs(&Adventure::actionClimbLadder),
+        RoomAction(199, "shutdown")
+            .sets(QUEST_PTSSHUTDOWN)
+            .says("You shut down the laptop and appear to stop the cyber attack against Pittsburg for now."),
+        RoomAction(199, "unplug")
+            .needs(QUEST_PTSSHUTDOWN, "On second thought, you should shut down this laptop first.")
+            .sets(QUEST_PTSUNPLUG)
+            .says("You unplug the cables between the switches, preventing any further attacks from this location."),
+        // END Pittsburg actions
+        // BEGIN Newton actions
+        RoomAction(206, "pickup").gives(INVENTORY_ITEM_PARKING_LOT_DRIVE).says("You pick up the USB drive."), // pickup usb drive
+        RoomAction(213, "playball").runs(&Adventure::actionPlayBall), // games
+        RoomAction(213, "throwdiscs").runs(&Adventure::actionThrowDiscs),
+        RoomAction(216, "talk").talk(14), // talk to principal
+        RoomAction(221, "talk").talk(15), // talk to it specialist
+        RoomAction(221, "lunch")
+            .needs(INVENTORY_ITEM_NEWTON_LUNCH, "You don't have a lunch to give.")
+            .takes(INVENTORY_ITEM_NEWTON_LUNCH)
+            .flag("OzSecCTF{Lunch_T1m3}")
+            .says("You hand the IT specialist the lunch and they thank you."),
+        RoomAction(222, "insert") // insert drive
+            .flag("OzSecCTF{b@d_@ct0r}")
+            .says("You insert the USB drive you found in the parking lot. Was this a good idea?"),
+        RoomAction(225, "pickup").gives(INVENTORY_ITEM_NEWTON_RECOVERY_PAGE_3).says("You pick up the page."), // recovery page 3
+        RoomAction(229, "pickup").gives(INVENTORY_ITEM_NEWTON_RECOVERY_PAGE_2).says("You pick up the page."), // page 2
+        RoomAction(237, "pickup").gives(INVENTORY_ITEM_NEWTON_RECOVERY_PAGE_1).says("You pick up the page."), // page 1
+        RoomAction(240, "pickup").gives(INVENTORY_ITEM_NEWTON_LUNCH).says("You pick up the lunch."), // lunch
+        RoomAction(241, "pickup").gives(INVENTORY_ITEM_NEWTON_RECOVERY_PAGE_4).says("You pick up the page."), // page 4
+        // END Newton actions
+        // BEGIN Ellsworth actions
+        RoomAction(257, "keycard")
+            .gives(INVENTORY_ITEM_ELLSWORTH_WATER_TREATMENT_KEYCARD)
+            .says("You pick up the keycard."),
+        RoomAction(265, "checkin")
+            .needs(INVENTORY_ITEM_ELLSWORTH_WATER_TREATMENT_KEYCARD, "You don't have the keycard needed to gain access. Perhaps the water plant office on Douglas could help.")
+            .sets(QUEST_ELACCESS)
+            .says("You show the guard your keycard and they wave you on."),
+        RoomAction(271, "soda")
+            .needs(INVENTORY_ITEM_A_SODA, "You don't have a soda to give, maybe you could get one from a local fuel stop.")
+            .takes(INVENTORY_ITEM_A_SODA)
+            .flag("OzSecCTF{S0d@_P0p_S3ns8tion}")
+            .says("The groundskeeper thanks you as he enjoys the soda."),
+        RoomAction(279, "soda").gives(INVENTORY_ITEM_A_SODA).says("You pick up a soda."),
+        RoomAction(285, "pobox")
+            .flag("OzSecCTF{P0st@l_S3rv1c3}")
+            .says("You open the PO Box and find a postcard inside with a flag written on the back."),
+        RoomAction(291, "talk")
+            .says("Receptionist: We are all a bit busy trying to figure out why our water doesn't taste right. If you can help, check with the lead technician in the back."),
+        RoomAction(294, "talk")
+            .says("Plant Manager: Hello there. I'm a bit busy at the moment, but if you can help, check with the tech over in the control room."),
+        RoomAction(296, "talk")
+            .needs(QUEST_ELLEVELS, "Tech: I don't know why the water is tasting off, but it's not good. Can you check the levels in the Quality Control room?")
+            .sets(QUEST_ELLSWORTH)
+            .flag("OzSecCTF{W@t3r_F1ltr@t10n}")
+            .says("Tech: That fixed it! Our water is back to normal!"),
+        RoomAction(297, "check")
+            .needs(QUEST_ELLEVELS, "The water tastes wrong, and the levels are off.")
+            .says("The water tastes normal and the levels are good. Check with the lead technician next."),
+        RoomAction(298, "restore")
+            .needs(QUEST_ELLAPTOP, "As soon as the levels are restored, they go out of wack again immediately. Something else is changing them.")
+            .sets(QUEST_ELLEVELS)
+            .says("You restore the levels to normal. Check the quality of the water next."),
+        RoomAction(299, "unplug")
+            .sets(QUEST_ELLAPTOP)
+            .says("You unplug the laptop and appear to stop the cyber attack against Ellsworth for now."),
+        // END Ellsworth actions
+        // BEGIN Goodland actions
+        RoomAction(302, "alert")
+            .says("You listen in to the alert and hear that this taxi requires repair from the local auto repair shop.\r\nPerhaps you could find a way to get the taxi repaired."),
+        RoomAction(302, "taxi")
+            .needs(INVENTORY_ITEM_A_GOODLAND_TAXI_SERVICE_KEY, "You don't have a key to access the interior of the taxi.\r\nThere may be an auto repair shop somewhere in town.")
+            .needs(INVENTORY_ITEM_A_GTS_FIRMWARE_DRIVE, "You don't have the firmware drive to repair the taxi.\r\nPerhaps you should find the company supporting these robot taxis.")
+            .sets(QUEST_GTS1)
+            .says("You unlock the taxi, and insert the firmware update drive.\r\nAfter a few minutes the taxi reboots and is ready for service."),
+        RoomAction(304, "painting")
+            .flag("OzSecCTF{V1nc3nt_van_g00dl@nd}")
+            .says("This is a very large rendition of one of Vincent van Gogh's fameous paintings.\r\nIt's a beautiful piece of art."),
+        RoomAction(317, "ticket")
+            .gives(INVENTORY_ITEM_A_PLANE_TICKET_FROM_GOODLAND_MUNICPAL_AIRPORT)
+            .flag("OzSecCTF{f1y0ver}")
+            .says("You pick up the plane ticket, it's expired."),
+        RoomAction(317, "taxi")
+            .needs(INVENTORY_ITEM_A_GOODLAND_TAXI_SERVICE_KEY, "You don't have a key to access the interior of the taxi.\r\nThere may be an auto repair shop somewhere in town.")
+            .needs(INVENTORY_ITEM_A_GTS_FIRMWARE_DRIVE, "You don't have the firmware drive to repair the taxi.\r\nPerhaps you should find the company supporting these robot taxis.")
+            .sets(QUEST_GTS2)
+            .says("You unlock the taxi, and insert the firmware update drive.\r\nAfter a few minutes the taxi reboots and is ready for service."),
+        RoomAction(325, "talk").talk(11),
+        RoomAction(327, "taxi")
+            .needs(INVENTORY_ITEM_A_GOODLAND_TAXI_SERVICE_KEY, "You don't have a key to access the interior of the taxi.\r\nThere may be an auto repair shop somewhere in town.")
+            .needs(INVENTORY_ITEM_A_GTS_FIRMWARE_DRIVE, "You don't have the firmware drive to repair the taxi.\r\nPerhaps you should find the company supporting these robot taxis.")
+            .sets(QUEST_GTS3)
+            .says("You unlock the taxi, and insert the firmware update drive.\r\nAfter a few minutes the taxi reboots and is ready for service."),
+        RoomAction(331, "talk").talk(12),
+        RoomAction(340, "leg")
+            .gives(INVENTORY_ITEM_A_HUGE_TURKEY_LEG)
+            .flag("OzSecCTF{1ts_st1ll_g00d}")
+            .says("You pick up a huge turkey leg."),
+        RoomAction(340, "taxi")
+            .needs(INVENTORY_ITEM_A_GOODLAND_TAXI_SERVICE_KEY, "You don't have a key to access the interior of the taxi.\r\nThere may be an auto repair shop somewhere in town.")
+            .needs(INVENTORY_ITEM_A_GTS_FIRMWARE_DRIVE, "You don't have the firmware drive to repair the taxi.\r\nPerhaps you should find the company supporting these robot taxis.")
+            .sets(QUEST_GTS4)
+            .says("You unlock the taxi, and insert the firmware update drive.\r\nAfter a few minutes the taxi reboots and is ready for service."),
+        RoomAction(349, "taxi")
+            .needs(INVENTORY_ITEM_A_GOODLAND_TAXI_SERVICE_KEY, "You don't have a key to access the interior of the taxi.\r\nThere may be an auto repair shop somewhere in town.")
+            .needs(INVENTORY_ITEM_A_GTS_FIRMWARE_DRIVE, "You don't have the firmware drive to repair the taxi.\r\nPerhaps you should find the company supporting these robot taxis.")
+            .sets(QUEST_GTS5)
+            .says("You unlock the taxi, and insert the firmware update drive.\r\nAfter a few minutes the taxi reboots and is ready for service."),
+        // END Goodland actions
+        // BEGIN Dodge City actions
+        RoomAction(350, "flipper")
+            .gives(INVENTORY_ITEM_A_FLIPPER_ZERO)
+            .says("You pick up the Flipper Zero, and examin the note.\r\n\r\nTraveler, I have been captured by the local authorities. Please get me out of here.\r\nTake this Flipper Zero and use it to help me escape. - The Associate"),
+        RoomAction(353, "replay")
+            .needs(INVENTORY_ITEM_A_FLIPPER_ZERO, "You don't have a Flipper Zero to use. You think you saw one when you first entered town.")
+            .needs(QUEST_DCSHERRIF, "You look through the Flipper's recorded keycards, nothing seems to work on the cell door.")
+            .sets(QUEST_DCASSOCIATE)
+            .flag("OzSecCTF{Ag3nt_1337}")
+            .says("You replay the signal and the cell door unlocks. The Associate is free!\r\nThe Associate: I'll meet you on the train, find a way to get us to Wichita.\r\nThe Associate then bolts out the dodor."),
+        RoomAction(355, "clone")
+            .needs(INVENTORY_ITEM_A_FLIPPER_ZERO, "You don't have a Flipper Zero to clone the keycard. You might have seen one when you first entered town.")
+            .sets(QUEST_DCSHERRIF)
+            .says("You use the Flipper and slowly walk past the Sherrif. The Flipper beeps and you have a copy of the keycard."),
+        RoomAction(356, "drink")
+            .gives(INVENTORY_ITEM_A_GLASS_OF_THE_SALOON_SPECIAL)
+            .says("The bartender hands you a glass of the Saloon Special."),
+        RoomAction(357, "play").runs(&Adventure::actionSaloonGame),
+        RoomAction(365, "drink").gives(INVENTORY_ITEM_AN_ENERGY_DRINK).says("You pick up an energy drink."),
+        RoomAction(369, "flipper")
+            .gives(INVENTORY_ITEM_A_FLIPPER_ZERO)
+            .says("You pick up the Flipper Zero, and examin the note.\r\n\r\nTraveler, I have been captured by the local authorities. Please get me out of here.\r\nTake this Flipper Zero and use it to help me escape. - The Associate"),
+        RoomAction(371, "clone")
+            .needs(INVENTORY_ITEM_A_FLIPPER_ZERO, "You don't have a Flipper Zero to clone the keycard. You might have seen one when you first entered town.")
+            .sets(QUEST_DCCONDUCTOR)
+            .says("You use the Flipper slowly approach the conductor. The Flipper beeps and you now have a copy of his keycard."),
+        RoomAction(372, "replay")
+            .needs(INVENTORY_ITEM_A_FLIPPER_ZERO, "You don't have a Flipper Zero to use. You think you saw one when you first entered town.")
+            .needs(QUEST_DCCONDUCTOR, "You look through the Flipper's recorded keycards, nothing seems to work on the train.")
+            .sets(QUEST_DCASSOCIATE)
+            .flag("OzSecCTF{Tr@in_Unl0ck3d}")
+            .says("You replay the signal and the train door unlocks."),
+        // END Dodge City actions
+        // BEGIN Wichita actions
+        RoomAction(485, "line").runs(&Adventure::actionJoinLine),
+        RoomAction(485, "reboot")
+            .needs(INVENTORY_ITEM_A_RECOVERY_DRIVE, "You don't have the recovery drive to reboot the server.")
+            .sets(QUEST_ICTAIR1)
+            .says("You reboot the PC with the recovery drive inserted. It boots back into Windows successfully."),
+        RoomAction(486, "talk").talk(10),
+        RoomAction(486, "drive").gives(INVENTORY_ITEM_A_RECOVERY_DRIVE).says("You pick up the USB recovery drive."),
+        RoomAction(488, "reboot")
+            .needs(INVENTORY_ITEM_A_RECOVERY_DRIVE, "You don't have the recovery drive to reboot the server.")
+            .sets(QUEST_ICTAIR2)
+            .says("You reboot the PC with the recovery drive inserted. It boots back into Windows successfully."),
+        RoomAction(491, "key").gives(INVENTORY_ITEM_AIRPORT_KEYS).says("You pick up the keys."),
+        RoomAction(491, "reboot")
+            .needs(INVENTORY_ITEM_A_RECOVERY_DRIVE, "You don't have the recovery drive to reboot the server.")
+            .sets(QUEST_ICTAIR3)
+            .says("You reboot the PC with the recovery drive inserted. It boots back into Windows successfully."),
+        RoomAction(492, "reboot")
+            .needs(INVENTORY_ITEM_A_RECOVERY_DRIVE, "You don't have the recovery drive to reboot the server.")
+            .sets(QUEST_ICTAIR4)
+            .says("You reboot the PC with the recovery drive inserted. It boots back into Windows successfully."),
+        RoomAction(494, "unlock")
+            .needs(INVENTORY_ITEM_AIRPORT_KEYS, "You don't have the keys to unlock the door.")
+            .sets(QUEST_ICTAIRUNLOCK)
+            .says("You unlock the door with the airport keys."),
+        RoomAction(495, "reboot")
+            .needs(INVENTORY_ITEM_A_RECOVERY_DRIVE, "You don't have the recovery drive to reboot the server.")
+            .sets(QUEST_ICTAIR5)
+            .says("You reboot the PC with the recovery drive inserted. It boots back into Windows successfully."),
+        RoomAction(496, "ticket").runs(&Adventure::actionLotteryTicket),
+        RoomAction(496, "drink").runs(&Adventure::actionEnergyDrink),
+        RoomAction(497, "simon").runs(&Adventure::actionSimon), // Not in the room's options, can't be reached yet
+        RoomAction(499, "pamphlet")
+            .needs(INVENTORY_ITEM_A_LOAN_PAMPHLET, "You don't have anything to offer.")
+            .flag("OzSecCTF{Spr3@d_teh_l0ans}")
+            .says("You offer the loan pamphlet to the vendor."),
+        RoomAction(500, "sign")
+            .says("OzSec 2024! Wichita's Annual Cyber Security Conference!\n\nJoin us for a day of talks, workshops, and networking.\n\n"),
+        RoomAction(500, "beacon").runs(&Adventure::actionBeacon),
+        RoomAction(501, "talk").talk(4),
+        RoomAction(503, "talk").talk(3),
+        RoomAction(504, "coffee")
+            .gives(INVENTORY_ITEM_A_CUP_OF_COFFEE)
+            .says("You pick up a coffee mug and fill it with coffee from the pot."),
+        RoomAction(505, "load")
+            .needs(INVENTORY_ITEM_AN_HP_LTO8_TAPE, "You don't have the tapes to load.")
+            .sets(QUEST_ICTWATERLOADED)
+            .says("You load the tapes into the tape drive and press the button to begin restoration."),
+        RoomAction(507, "open")
+            .needs(INVENTORY_ITEM_SAFE_DEPOSIT_KEY, "You don't have the key to open the safe deposit box.")
+            .gives(INVENTORY_ITEM_AN_HP_LTO8_TAPE)
+            .says("You use the key to open the safe deposit box and retrieve a backup tape."),
+        RoomAction(508, "talk").talk(5),
+        RoomAction(509, "pamphlet")
+            .gives(INVENTORY_ITEM_A_LOAN_PAMPHLET)
+            .says("You pick up a loan pamphlet detailing all the avialable loans and offers."),
+        // END Wichita actions
+    };
+    static constexpr RoomActionTable table = roomActionTable(actions);
+    static_assert(sizeof(actions) / sizeof(actions[0]) < 256, "Room action slots only hold 255 actions");
+    static_assert(!table.duplicate, "Two room actions have the same room and verb");
+    static_assert(table.seed < ROOM_ACTION_SEED_LIMIT, "No hash seed keeps room action lookups short, raise ROOM_ACTION_SLOT_BITS");
+    static_assert(questsReachable(questGraph, roomActionQuests(actions) | QUESTS_SET_IN_CODE) == QUESTS_ALL, "A quest flag is never set, add it to a room action, a goal reward or QUESTS_SET_IN_CODE");
+    static_assert(questGoalsReachable(questGraph, roomActionQuests(actions) | QUESTS_SET_IN_CODE), "A quest goal can never be met");
+
+    uint32_t slot = roomActionSlot(room, verb, length, table.seed);
+    for (int i = 0; i < table.probes && table.slots[slot] != 0; i++)
+    {
+        const RoomAction *action = &actions[table.slots[slot] - 1];
+        if (action->room == room && strncmp(action->verb, verb, length) == 0 && action->verb[length] == '\0')
+        {
+            return action;
+        }
+        slot = (slot + 1) % ROOM_ACTION_SLOTS;
+    }
+    return NULL;
+}
 
-            case 153:
-                if (action == "rose")
-                {
-                    addItem(INVENTORY_ITEM_A_RED_ROSE);
-                    game.message = "The shopkeeper offers you the rose.\r\nYou pick up the rose and it smells sweet.";
-                    setCallback(&Adventure::displayMessage);
-                }
-                break;
+/// @brief Run a room action, or tell the player what it still needs
+void Adventure::runRoomAction(const RoomAction &action)
+{
+    if (action.handler != NULL)
+    {
+        (this->*action.handler)();
+        return;
+    }
 
-            case 157:
-                if (action == "coffee")
-                {
-                    addItem(INVENTORY_ITEM_STACEYS_CUP_OF_COFFEE);
-                    game.message = "You grab the coffee, maybe you'll run into Stacey later.";
-                    setCallback(&Adventure::displayMessage);
-                }
-                else if (action == "beacon")
-                {
-                    player.beacon = player.room;
-                    game.message = "You set your beacon to this location.\r\nYou can return here at any time by typing 'beacon'";
-                    setCallback(&Adventure::displayMessage);
-                }
-                break;
+    for (int i = 0; i < ROOM_ACTION_NEEDS && action.need[i].missing != NULL; i++)
+    {
+        const RoomNeed &need = action.need[i];
+        if ((need.item != -1 && !hasItem(need.item)) || (need.quest != -1 && !game.quests.has((QuestFlag)need.quest)))
+        {
+            game.message = need.missing;
+            setCallback(&Adventure::displayMessage);
+            return;
+        }
+    }
 
-            case 161:
-                if (action == "letter")
-                {
-                    addItem(INVENTORY_ITEM_A_LETTER_TO_THE_PITTSBURG_COURTS);
-                    game.message = "You pick up the letter.";
-                    setCallback(&Adventure::displayMessage);
-                }
-                else if (action == "talk")
-                {
-                    player.npc = 6;
-                    setCallback(&Adventure::displayDialog);
-                    setPromptCallback(&Adventure::talkToNPC);
-                }
-                break;
+    if (action.npc != -1)
+    {
+        player.npc = action.npc; // ID of NPC we are talking to
+        setCallback(&Adventure::displayDialog);
+        setPromptCallback(&Adventure::talkToNPC); // Sets handler for responses
+        return;
+    }
 
-            case 170:
-                if (action == "talk")
-                {
-                    player.npc = 7;
-                    setCallback(&Adventure::displayDialog);
-                    setPromptCallback(&Adventure::talkToNPC);
-                }
-                break;
+    if (action.removed != -1)
+    {
+        removeItem(action.removed);
+    }
+    if (action.added != -1)
+    {
+        addItem(action.added);
+    }
+    if (action.quest != -1)
+    {
+        setFlag((QuestFlag)action.quest, true);
+    }
+    if (action.saved)
+    {
+        save();
+    }
+    if (action.ctf != NULL)
+    {
+        printFlag(action.ctf);
+    }
+    if (action.message != NULL)
+    {
+        game.message = action.message;
+        setCallback(&Adventure::displayMessage);
+    }
+}
 
-            case 171:
-                if (action == "talk")
-                {
-                    player.npc = 8;
-                    setCallback(&Adventure::displayDialog);
-                    setPromptCallback(&Adventure::talkToNPC);
-                }
-                break;
+/// @brief Press the button in the tree that leaves the training area
+void Adventure::actionTrainingButton()
+{
+    if (game.quests.has(QUEST_TRAINING))
+    {
+        Console.println("You press the button embedded in the tree and feel a strange sensation as you are teleported away from the training area.");
+        player.room = GAMESTART;
+        setCallback(&Adventure::displayRoom);
+    }
+    else
+    {
+        Console.println("You press the button, it makes a click, but nothing else happens.");
+        setCallback(&Adventure::displayRoom);
+    }
+}
 
-            case 174:
-                if (action == "drive")
-                {
-                    if (hasItem(INVENTORY_ITEM_A_USB_DRIVE_FROM_THE_PITTSBURG_PARK))
-                    {
-                        printFlag("OzSecCTF{Gray_H@t_H@ck3r}");
-                        game.message = "You plug the USB drive you found in the park into the PC.\r\nThis doesn't feel right...";
-                    }
-                    else
-                    {
-                        game.message = "You don't have a USB drive.";
-                    }
-                    setCallback(&Adventure::displayMessage);
-                }
-                break;
+/// @brief Board the bus from Kansas City to Topeka once the buses are fixed
+void Adventure::actionBusToTopeka()
+{
+    if (game.goals.has(GOAL_KC_BUSES) && hasItem(INVENTORY_ITEM_A_TICKET_TO_TOPEKA))
+    {
+        printFlag("OzSecCTF{Adv3nture_T1m3_1s_H3r3}");
+        setFlag(QUEST_KANSASCITY, true);
+        Timeline::println("You board the bus and take off to Topeka");
+        Timeline::pause(2000);
+        player.room = 61;
+        setCallback(&Adventure::displayRoom);
+    }
+    else
+    {
+        game.message = "You need approval from the maintenance manager before you can leave.";
+        setCallback(&Adventure::displayMessage);
+    }
+}
 
-            case 178:
-                if (action == "drive")
-                {
-                    addItem(INVENTORY_ITEM_A_USB_DRIVE_FROM_THE_PITTSBURG_PARK);
-                    game.message = "You pick up the USB drive and place it in your pocket.";
-                }
-                else if (action == "plant")
-                {
-                    if (hasItem(INVENTORY_ITEM_A_RED_ROSE))
-                    {
-                        printFlag("OzSecCTF{R0s3s_4r3_r3d}");
-                        game.message = "You place the rose in the planter and it looks nice.";
-                    }
-                    else
-                    {
-                        game.message = "You don't have anything to plant.";
-                    }
-                }
-                setCallback(&Adventure::displayMessage);
-                break;
+/// @brief Hand the hospital drives to the technicians in Topeka
+void Adventure::actionAnalyzeDrives()
+{
+    if (game.goals.has(GOAL_TOPEKA_DRIVES))
+    {
+        printFlag("OzSecCTF{4n@lyz3_Th3_D@t@}");
+        setFlag(QUEST_TOPEKA, true);
+        game.message = "The technicians analyze the drives and identify the source of the malware. They are able to swiftly disable it and restore operations.";
+        setCallback(&Adventure::displayMessage);
+    }
+    else
+    {
+        game.message = "Tech: We need all of the encrypted drives from inside the hospital to analyze and figure out this attack.";
+        setCallback(&Adventure::displayMessage);
+    }
+}
 
-            case 193:
-                if (action == "talk")
-                {
-                    player.npc = 9;
-                    setCallback(&Adventure::displayDialog);
-                    setPromptCallback(&Adventure::talkToNPC);
-                }
-                break;
+/// @brief Set the beacon to the current room
+void Adventure::actionBeacon()
+{
+    player.beacon = player.room;
+    game.message = "You set your beacon to this location.\r\nYou can return here at any time by typing 'beacon'";
+    setCallback(&Adventure::displayMessage);
+}
 
-            case 195:
-                if (action == "ladder")
-                {
-                    addItem(INVENTORY_ITEM_A_LADDER);
-                    game.message = "You pick up the ladder and carry it with you.";
-                    setCallback(&Adventure::displayMessage);
-                }
-                break;
+/// @brief Climb over the wall into the Pittsburg computer lab
+void Adventure::actionClimbLadder()
+{
+    if (hasItem(INVENTORY_ITEM_A_LADDER))
+    {
+        Timeline::println("You prop the ladder against the eastern wall and climb up to the top.");
+        Timeline::pause(2000);
+        for (int j = 0; j < 5; j++)
+        {
+            for (int k = 0; k < 2; k++)
+            {
+                Timeline::println("||   ||");
+                Timeline::pause(5 * 1000 / 25);
+            }
+            Timeline::println("||===||");
+            Timeline::pause(5 * 1000 / 25);
+            for (int k = 0; k < 2; k++)
+            {
+                Timeline::println("||   ||");
+                Timeline::pause(5 * 1000 / 25);
+            }
+        }
+        Timeline::println("As you slide the ceiling tile out of the way, you can see the computer lab on the other side.");
+        Timeline::pause(2000);
+        for (int j = 0; j < 5; j++)
+        {
+            for (int k = 0; k < 2; k++)
+            {
+                Timeline::println("||   ||");
+                Timeline::pause(5 * 1000 / 25);
+            }
+            Timeline::println("||===||");
+            Timeline::pause(5 * 1000 / 25);
+            for (int k = 0; k < 2; k++)
+            {
+                Timeline::println("||   ||");
+                Timeline::pause(5 * 1000 / 25);
+            }
+        }
+        Timeline::println("You climb through the ceiling and over the wall, landing in the computer lab.");
+        Timeline::pause(2000);
+        for (int j = 0; j < 5; j++)
+        {
+            for (int k = 0; k < 2; k++)
+            {
+                Timeline::println("||   ||");
+                Timeline::pause(5 * 1000 / 25);
+            }
+            Timeline::println("||===||");
+            Timeline::pause(5 * 1000 / 25);
+            for (int k = 0; k < 2; k++)
+            {
+                Timeline::println("||   ||");
+                Timeline::pause(5 * 1000 / 25);
+            }
+        }
+        player.room = 199;
+        setCallback(&Adventure::displayRoom);
+    }
+    else
+    {
+        game.message = "You don't have a ladder.";
+        setCallback(&Adventure::displayMessage);
+    }
+}
 
-            case 198:
-                if (action == "climb")
-                {
-                    if (hasItem(INVENTORY_ITEM_A_LADDER))
-                    {
-                        Serial.println("You prop the ladder against the eastern wall and climb up to the top.");
-                        sleep(2);
-                        for (int j = 0; j < 5; j++)
-                        {
-                            for (int k = 0; k < 2; k++)
-                            {
-                                Serial.println("||   ||");
-                                usleep(5 * 1000 * 1000 / 25);
-                            }
-                            Serial.println("||===||");
-                            usleep(5 * 1000 * 1000 / 25);
-                            for (int k = 0; k < 2; k++)
-                            {
-                                Serial.println("||   ||");
-                                usleep(5 * 1000 * 1000 / 25);
-                            }
-                        }
-                        Serial.println("As you slide the ceiling tile out of the way, you can see the computer lab on the other side.");
-                        sleep(2);
-                        for (int j = 0; j < 5; j++)
-                        {
-                            for (int k = 0; k < 2; k++)
-                            {
-                                Serial.println("||   ||");
-                                usleep(5 * 1000 * 1000 / 25);
-                            }
-                            Serial.println("||===||");
-                            usleep(5 * 1000 * 1000 / 25);
-                            for (int k = 0; k < 2; k++)
-                            {
-                                Serial.println("||   ||");
-                                usleep(5 * 1000 * 1000 / 25);
-                            }
-                        }
-                        Serial.println("You climb through the ceiling and over the wall, landing in the computer lab.");
-                        sleep(2);
-                        for (int j = 0; j < 5; j++)
-                        {
-                            for (int k = 0; k < 2; k++)
-                            {
-                                Serial.println("||   ||");
-                                usleep(5 * 1000 * 1000 / 25);
-                            }
-                            Serial.println("||===||");
-                            usleep(5 * 1000 * 1000 / 25);
-                            for (int k = 0; k < 2; k++)
-                            {
-                                Serial.println("||   ||");
-                                usleep(5 * 1000 * 1000 / 25);
-                            }
-                        }
-                        player.room = 199;
-                        setCallback(&Adventure::displayRoom);
-                    }
-                    else
-                    {
-                        game.message = "You don't have a ladder.";
-                        setCallback(&Adventure::displayMessage);
-                    }
-                }
-                break;
-
-            case 199:
-                if (action == "shutdown")
-                {
-                    game.qptsshutdown = true;
-                    game.message = "You shut down the laptop and appear to stop the cyber attack against Pittsburg for now.";
-                }
-                else if (action == "unplug")
-                {
-                    if (game.qptsshutdown)
-                    {
-                        game.qptsunplug = true;
-                        game.message = "You unplug the cables between the switches, preventing any further attacks from this location.";
-                    }
-                    else
-                    {
-                        game.message = "On second thought, you should shut down this laptop first.";
-                    }
-                }
-                setCallback(&Adventure::displayMessage);
-                break;
-                // END Pittsburg actions
-
-                // BEGIN Newton actions
-
-            case 206: // pickup usb drive
-                if (action == "pickup")
-                {
-                    addItem(INVENTORY_ITEM_PARKING_LOT_DRIVE);
-                    game.message = "You pick up the USB drive.";
-                    setCallback(&Adventure::displayMessage);
-                }
-                break;
-
-            case 213: // games
-                if (action == "playball")
-                {
-                    if (game.qnwtdisc)
-                    {
-                        printFlag("OzSecCTF{mu1t1_sp0rt_@thl3t3}");
-                    }
-                    game.qnwtball = true;
-                    game.message = "You enjoy a quick game of baseball.";
-                    setCallback(&Adventure::displayMessage);
-                }
-                else if (action == "throwdiscs")
-                {
-                    if (game.qnwtball)
-                    {
-                        printFlag("OzSecCTF{mu1t1_sp0rt_@thl3t3}");
-                    }
-                    game.qnwtdisc = true;
-                    game.message = "You enjoy a quick game of disc golf.";
-                    setCallback(&Adventure::displayMessage);
-                }
-                break;
-
-            case 216: // talk to principal
-                if (action == "talk")
-                {
-                    player.npc = 14;
-                    setCallback(&Adventure::displayDialog);
-                    setPromptCallback(&Adventure::talkToNPC);
-                }
-                break;
-
-            case 221: // talk to it specialist
-                if (action == "talk")
-                {
-                    player.npc = 15;
-                    setCallback(&Adventure::displayDialog);
-                    setPromptCallback(&Adventure::talkToNPC);
-                }
-                else if (action == "lunch")
-                {
-                    if (hasItem(INVENTORY_ITEM_NEWTON_LUNCH))
-                    {
-                        printFlag("OzSecCTF{Lunch_T1m3}");
-                        game.message = "You hand the IT specialist the lunch and they thank you.";
-                        removeItem(INVENTORY_ITEM_NEWTON_LUNCH);
-                        setCallback(&Adventure::displayMessage);
-                    }
-                    else
-                    {
-                        game.message = "You don't have a lunch to give.";
-                        setCallback(&Adventure::displayMessage);
-                    }
-                }
-
-                break;
-
-            case 222: // insert drive
-                if (action == "insert")
-                {
-                    printFlag("OzSecCTF{b@d_@ct0r}");
-                    game.message = "You insert the USB drive you found in the parking lot. Was this a good idea?";
-                    setCallback(&Adventure::displayMessage);
-                }
-                break;
-
-            case 225: // recovery page 3
-                if (action == "pickup")
-                {
-                    addItem(INVENTORY_ITEM_NEWTON_RECOVERY_PAGE_3);
-                    game.message = "You pick up the page.";
-                    setCallback(&Adventure::displayMessage);
-                }
-                break;
-
-            case 229: // page 2
-                if (action == "pickup")
-                {
-                    addItem(INVENTORY_ITEM_NEWTON_RECOVERY_PAGE_2);
-                    game.message = "You pick up the page.";
-                    setCallback(&Adventure::displayMessage);
-                }
-                break;
-
-            case 237: // page 1
-                if (action == "pickup")
-                {
-                    addItem(INVENTORY_ITEM_NEWTON_RECOVERY_PAGE_1);
-                    game.message = "You pick up the page.";
-                    setCallback(&Adventure::displayMessage);
-                }
-                break;
-
-            case 240: // lunch
-                if (action == "pickup")
-                {
-                    addItem(INVENTORY_ITEM_NEWTON_LUNCH);
-                    game.message = "You pick up the lunch.";
-                    setCallback(&Adventure::displayMessage);
-                }
-                break;
-
-            case 241: // page 4
-                if (action == "pickup")
-                {
-                    addItem(INVENTORY_ITEM_NEWTON_RECOVERY_PAGE_4);
-                    game.message = "You pick up the page.";
-                    setCallback(&Adventure::displayMessage);
-                }
-                break;
-
-                // END Newton actions
-
-                // BEGIN Ellsworth actions
-            case 257:
-                if (action == "keycard")
-                {
-                    addItem(INVENTORY_ITEM_ELLSWORTH_WATER_TREATMENT_KEYCARD);
-                    game.message = "You pick up the keycard.";
-                    setCallback(&Adventure::displayMessage);
-                }
-                break;
-            case 265:
-                if (action == "checkin")
-                {
-                    if (hasItem(INVENTORY_ITEM_ELLSWORTH_WATER_TREATMENT_KEYCARD))
-                    {
-                        game.qelaccess = true;
-                        game.message = "You show the guard your keycard and they wave you on.";
-                        setCallback(&Adventure::displayMessage);
-                    }
-                    else
-                    {
-                        game.message = "You don't have the keycard needed to gain access. Perhaps the water plant office on Douglas could help.";
-                        setCallback(&Adventure::displayMessage);
-                    }
-                }
-                break;
-
-            case 271:
-                if (action == "soda")
-                {
-                    if (hasItem(INVENTORY_ITEM_A_SODA))
-                    {
-                        printFlag("OzSecCTF{S0d@_P0p_S3ns8tion}");
-                        game.message = "The groundskeeper thanks you as he enjoys the soda.";
-                        removeItem(INVENTORY_ITEM_A_SODA);
-                        setCallback(&Adventure::displayMessage);
-                    }
-                    else
-                    {
-                        game.message = "You don't have a soda to give, maybe you could get one from a local fuel stop.";
-                        setCallback(&Adventure::displayMessage);
-                    }
-                }
-                break;
-
-            case 279:
-                if (action == "soda")
-                {
-                    addItem(INVENTORY_ITEM_A_SODA);
-                    game.message = "You pick up a soda.";
-                    setCallback(&Adventure::displayMessage);
-                }
-                break;
-
-            case 285:
-                if (action == "pobox")
-                {
-                    printFlag("OzSecCTF{P0st@l_S3rv1c3}");
-                    game.message = "You open the PO Box and find a postcard inside with a flag written on the back.";
-                    setCallback(&Adventure::displayMessage);
-                }
-                break;
-
-            case 291:
-                if (action == "talk")
-                {
-                    game.message = "Receptionist: We are all a bit busy trying to figure out why our water doesn't taste right. If you can help, check with the lead technician in the back.";
-                    setCallback(&Adventure::displayMessage);
-                }
-                break;
-
-            case 294:
-                if (action == "talk")
-                {
-                    game.message = "Plant Manager: Hello there. I'm a bit busy at the moment, but if you can help, check with the tech over in the control room.";
-                    setCallback(&Adventure::displayMessage);
-                }
-                break;
-
-            case 296:
-                if (action == "talk")
-                {
-                    if (game.qellevels)
-                    {
-                        game.qellsworth = true;
-                        printFlag("OzSecCTF{W@t3r_F1ltr@t10n}");
-                        game.message = "Tech: That fixed it! Our water is back to normal!";
-                    }
-                    else
-                    {
-                        game.message = "Tech: I don't know why the water is tasting off, but it's not good. Can you check the levels in the Quality Control room?";
-                    }
-                    setCallback(&Adventure::displayMessage);
-                }
-                break;
-
-            case 297:
-                if (action == "check")
-                {
-                    if (game.qellevels)
-                    {
-                        game.message = "The water tastes normal and the levels are good. Check with the lead technician next.";
-                        setCallback(&Adventure::displayMessage);
-                    }
-                    else
-                    {
-                        game.message = "The water tastes wrong, and the levels are off.";
-                        setCallback(&Adventure::displayMessage);
-                    }
-                }
-                break;
-
-            case 298:
-                if (action == "restore")
-                {
-                    if (game.qellaptop)
-                    {
-                        game.qellevels = true;
-                        game.message = "You restore the levels to normal. Check the quality of the water next.";
-                        setCallback(&Adventure::displayMessage);
-                    }
-                    else
-                    {
-                        game.message = "As soon as the levels are restored, they go out of wack again immediately. Something else is changing them.";
-                        setCallback(&Adventure::displayMessage);
-                    }
-                }
-                break;
-
-            case 299:
-                if (action == "unplug")
-                {
-                    game.qellaptop = true;
-                    game.message = "You unplug the laptop and appear to stop the cyber attack against Ellsworth for now.";
-                    setCallback(&Adventure::displayMessage);
-                }
-                break;
-                // END Ellsworth actions
-
-                // BEGIN Goodland actions
-            case 302:
-                if (action == "alert")
-                {
-                    game.message = "You listen in to the alert and hear that this taxi requires repair from the local auto repair shop.\r\nPerhaps you could find a way to get the taxi repaired.";
-                    setCallback(&Adventure::displayMessage);
-                }
-                else if (action == "taxi")
-                {
-                    if (hasItem(INVENTORY_ITEM_A_GOODLAND_TAXI_SERVICE_KEY))
-                    {
-                        if (hasItem(INVENTORY_ITEM_A_GTS_FIRMWARE_DRIVE))
-                        {
-                            game.qgts1 = true;
-                            game.message = "You unlock the taxi, and insert the firmware update drive.\r\nAfter a few minutes the taxi reboots and is ready for service.";
-                            setCallback(&Adventure::displayMessage);
-                        }
-                        else
-                        {
-                            game.message = "You don't have the firmware drive to repair the taxi.\r\nPerhaps you should find the company supporting these robot taxis.";
-                            setCallback(&Adventure::displayMessage);
-                        }
-                    }
-                    else
-                    {
-                        game.message = "You don't have a key to access the interior of the taxi.\r\nThere may be an auto repair shop somewhere in town.";
-                        setCallback(&Adventure::displayMessage);
-                    }
-                }
-                break;
-            case 304:
-                if (action == "painting")
-                {
-                    printFlag("OzSecCTF{V1nc3nt_van_g00dl@nd}");
-                    game.message = "This is a very large rendition of one of Vincent van Gogh's fameous paintings.\r\nIt's a beautiful piece of art.";
-                    setCallback(&Adventure::displayMessage);
-                }
-                break;
-            case 317:
-                if (action == "ticket")
-                {
-                    addItem(INVENTORY_ITEM_A_PLANE_TICKET_FROM_GOODLAND_MUNICPAL_AIRPORT);
-                    printFlag("OzSecCTF{f1y0ver}");
-                    game.message = "You pick up the plane ticket, it's expired.";
-                    setCallback(&Adventure::displayMessage);
-                }
-                else
-                {
-                    if (action == "taxi")
-                    {
-                        if (hasItem(INVENTORY_ITEM_A_GOODLAND_TAXI_SERVICE_KEY))
-                        {
-                            if (hasItem(INVENTORY_ITEM_A_GTS_FIRMWARE_DRIVE))
-                            {
-                                game.qgts2 = true;
-                                game.message = "You unlock the taxi, and insert the firmware update drive.\r\nAfter a few minutes the taxi reboots and is ready for service.";
-                                setCallback(&Adventure::displayMessage);
-                            }
-                            else
-                            {
-                                game.message = "You don't have the firmware drive to repair the taxi.\r\nPerhaps you should find the company supporting these robot taxis.";
-                                setCallback(&Adventure::displayMessage);
-                            }
-                        }
-                        else
-                        {
-                            game.message = "You don't have a key to access the interior of the taxi.\r\nThere may be an auto repair shop somewhere in town.";
-                            setCallback(&Adventure::displayMessage);
-                        }
-                    }
-                }
-                break;
-            case 325:
-                if (action == "talk")
-                {
-                    player.npc = 11;
-                    setCallback(&Adventure::displayDialog);
-                    setPromptCallback(&Adventure::talkToNPC);
-                }
-                break;
-            case 327:
-                if (action == "taxi")
-                {
-                    if (hasItem(INVENTORY_ITEM_A_GOODLAND_TAXI_SERVICE_KEY))
-                    {
-                        if (hasItem(INVENTORY_ITEM_A_GTS_FIRMWARE_DRIVE))
-                        {
-                            game.qgts3 = true;
-                            game.message = "You unlock the taxi, and insert the firmware update drive.\r\nAfter a few minutes the taxi reboots and is ready for service.";
-                            setCallback(&Adventure::displayMessage);
-                        }
-                        else
-                        {
-                            game.message = "You don't have the firmware drive to repair the taxi.\r\nPerhaps you should find the company supporting these robot taxis.";
-                            setCallback(&Adventure::displayMessage);
-                        }
-                    }
-                    else
-                    {
-                        game.message = "You don't have a key to access the interior of the taxi.\r\nThere may be an auto repair shop somewhere in town.";
-                        setCallback(&Adventure::displayMessage);
-                    }
-                }
-                break;
-            case 331:
-                if (action == "talk")
-                {
-                    player.npc = 12;
-                    setCallback(&Adventure::displayDialog);
-                    setPromptCallback(&Adventure::talkToNPC);
-                }
-                break;
-            case 340:
-                if (action == "leg")
-                {
-                    addItem(INVENTORY_ITEM_A_HUGE_TURKEY_LEG);
-                    printFlag("OzSecCTF{1ts_st1ll_g00d}");
-                    game.message = "You pick up a huge turkey leg.";
-                    setCallback(&Adventure::displayMessage);
-                }
-                else
-                {
-                    if (action == "taxi")
-                    {
-                        if (hasItem(INVENTORY_ITEM_A_GOODLAND_TAXI_SERVICE_KEY))
-                        {
-                            if (hasItem(INVENTORY_ITEM_A_GTS_FIRMWARE_DRIVE))
-                            {
-                                game.qgts4 = true;
-                                game.message = "You unlock the taxi, and insert the firmware update drive.\r\nAfter a few minutes the taxi reboots and is ready for service.";
-                                setCallback(&Adventure::displayMessage);
-                            }
-                            else
-                            {
-                                game.message = "You don't have the firmware drive to repair the taxi.\r\nPerhaps you should find the company supporting these robot taxis.";
-                                setCallback(&Adventure::displayMessage);
-                            }
-                        }
-                        else
-                        {
-                            game.message = "You don't have a key to access the interior of the taxi.\r\nThere may be an auto repair shop somewhere in town.";
-                            setCallback(&Adventure::displayMessage);
-                        }
-                    }
-                }
-                break;
-            case 349:
-                if (action == "taxi")
-                {
-                    if (hasItem(INVENTORY_ITEM_A_GOODLAND_TAXI_SERVICE_KEY))
-                    {
-                        if (hasItem(INVENTORY_ITEM_A_GTS_FIRMWARE_DRIVE))
-                        {
-                            game.qgts5 = true;
-                            game.message = "You unlock the taxi, and insert the firmware update drive.\r\nAfter a few minutes the taxi reboots and is ready for service.";
-                            setCallback(&Adventure::displayMessage);
-                        }
-                        else
-                        {
-                            game.message = "You don't have the firmware drive to repair the taxi.\r\nPerhaps you should find the company supporting these robot taxis.";
-                            setCallback(&Adventure::displayMessage);
-                        }
-                    }
-                    else
-                    {
-                        game.message = "You don't have a key to access the interior of the taxi.\r\nThere may be an auto repair shop somewhere in town.";
-                        setCallback(&Adventure::displayMessage);
-                    }
-                }
-                break;
-                // END Goodland actions
-
-                // BEGIN Dodge City actions
-            case 350:
-                if (action == "flipper")
-                {
-                    addItem(INVENTORY_ITEM_A_FLIPPER_ZERO);
-                    game.message = "You pick up the Flipper Zero, and examin the note.\r\n\r\nTraveler, I have been captured by the local authorities. Please get me out of here.\r\nTake this Flipper Zero and use it to help me escape. - The Associate";
-                    setCallback(&Adventure::displayMessage);
-                }
-                break;
-
-            case 353:
-                if (action == "replay")
-                {
-                    if (hasItem(INVENTORY_ITEM_A_FLIPPER_ZERO))
-                    {
-                        if (game.qdcsherrif)
-                        {
-                            game.qdcassociate = true;
-                            printFlag("OzSecCTF{Ag3nt_1337}");
-                            game.message = "You replay the signal and the cell door unlocks. The Associate is free!\r\nThe Associate: I'll meet you on the train, find a way to get us to Wichita.\r\nThe Associate then bolts out the dodor.";
-                            setCallback(&Adventure::displayMessage);
-                        }
-                        else
-                        {
-                            game.message = "You look through the Flipper's recorded keycards, nothing seems to work on the cell door.";
-                            setCallback(&Adventure::displayMessage);
-                        }
-                    }
-                    else
-                    {
-                        game.message = "You don't have a Flipper Zero to use. You think you saw one when you first entered town.";
-                        setCallback(&Adventure::displayMessage);
-                    }
-                }
-                break;
-
-            case 355:
-                if (action == "clone")
-                {
-                    if (hasItem(INVENTORY_ITEM_A_FLIPPER_ZERO))
-                    {
-                        game.qdcsherrif = true;
-                        game.message = "You use the Flipper and slowly walk past the Sherrif. The Flipper beeps and you have a copy of the keycard.";
-                        setCallback(&Adventure::displayMessage);
-                    }
-                    else
-                    {
-                        game.message = "You don't have a Flipper Zero to clone the keycard. You might have seen one when you first entered town.";
-                        setCallback(&Adventure::displayMessage);
-                    }
-                }
-                break;
-
-            case 356:
-                if (action == "drink")
-                {
-                    addItem(INVENTORY_ITEM_A_GLASS_OF_THE_SALOON_SPECIAL);
-                    game.message = "The bartender hands you a glass of the Saloon Special.";
-                    setCallback(&Adventure::displayMessage);
-                }
-                break;
-
-            case 357:
-                if (action == "play")
-                {
-                    if (hasItem(INVENTORY_ITEM_A_GLASS_OF_THE_SALOON_SPECIAL))
-                    {
-                        printFlag("OzSecCTF{S@l00n_Sp3ci@l}");
-                        game.message = "The player takes the drink and downs it. He stands up and says 'Thanks! I'd offer you to take my place, but I just lost everything. Have a great day.'";
-                        setCallback(&Adventure::displayMessage);
-                    }
-                    else if (hasItem(INVENTORY_ITEM_AN_ENERGY_DRINK))
-                    {
-                        printFlag("OzSecCTF{S@l00n_Sp3ci@liz3d}");
-                        game.message = "The player takes the energy drink and downs it. He stands up and says 'Awesome! I feel great! I'll take my winnings and head out. Have a great day.'";
-                        setCallback(&Adventure::displayMessage);
-                    }
-                    else
-                    {
-                        game.message = "The player says 'Hey, I'm in a bind, and could use a drink of something to pick me up. I'll let you take my place if you can get me something.";
-                        setCallback(&Adventure::displayMessage);
-                    }
-                }
-                break;
-
-            case 365:
-                if (action == "drink")
-                {
-                    addItem(INVENTORY_ITEM_AN_ENERGY_DRINK);
-                    game.message = "You pick up an energy drink.";
-                    setCallback(&Adventure::displayMessage);
-                }
-                break;
-
-            case 369:
-                if (action == "flipper")
-                {
-                    addItem(INVENTORY_ITEM_A_FLIPPER_ZERO);
-                    game.message = "You pick up the Flipper Zero, and examin the note.\r\n\r\nTraveler, I have been captured by the local authorities. Please get me out of here.\r\nTake this Flipper Zero and use it to help me escape. - The Associate";
-                    setCallback(&Adventure::displayMessage);
-                }
-                break;
-
-            case 371:
-                if (action == "clone")
-                {
-                    if (hasItem(INVENTORY_ITEM_A_FLIPPER_ZERO))
-                    {
-                        game.qdcconductor = true;
-                        game.message = "You use the Flipper slowly approach the conductor. The Flipper beeps and you now have a copy of his keycard.";
-                        setCallback(&Adventure::displayMessage);
-                    }
-                    else
-                    {
-                        game.message = "You don't have a Flipper Zero to clone the keycard. You might have seen one when you first entered town.";
-                        setCallback(&Adventure::displayMessage);
-                    }
-                }
-                break;
-
-            case 372:
-                if (action == "replay")
-                {
-                    if (hasItem(INVENTORY_ITEM_A_FLIPPER_ZERO))
-                    {
-                        if (game.qdcconductor)
-                        {
-                            game.qdcassociate = true;
-                            printFlag("OzSecCTF{Tr@in_Unl0ck3d}");
-                            game.message = "You replay the signal and the train door unlocks.";
-                            setCallback(&Adventure::displayMessage);
-                        }
-                        else
-                        {
-                            game.message = "You look through the Flipper's recorded keycards, nothing seems to work on the train.";
-                            setCallback(&Adventure::displayMessage);
-                        }
-                    }
-                    else
-                    {
-                        game.message = "You don't have a Flipper Zero to use. You think you saw one when you first entered town.";
-                        setCallback(&Adventure::displayMessage);
-                    }
-                }
-                break;
-                // END Dodge City actions
-                // BEGIN Wichita actions
-            case 485:
-                if (action == "line")
-                {
-                    Serial.println("You join the line.");
-                    sleep(5);
-                    Serial.println("The line isn't moving.");
-                    sleep(5);
-                    game.message = "You decide to leave the line.";
-                    setCallback(&Adventure::displayMessage);
-                }
-                else if (action == "reboot")
-                {
-                    if (hasItem(INVENTORY_ITEM_A_RECOVERY_DRIVE))
-                    {
-                        game.qictair1 = true;
-                        game.message = "You reboot the PC with the recovery drive inserted. It boots back into Windows successfully.";
-                        setCallback(&Adventure::displayMessage);
-                    }
-                    else
-                    {
-                        game.message = "You don't have the recovery drive to reboot the server.";
-                        setCallback(&Adventure::displayMessage);
-                    }
-                }
-                break;
-            case 486:
-                if (action == "talk")
-                {
-                    player.npc = 10; // Airport IT Manager
-                    setCallback(&Adventure::displayDialog);
-                    setPromptCallback(&Adventure::talkToNPC);
-                }
-                else if (action == "drive")
-                {
-                    addItem(INVENTORY_ITEM_A_RECOVERY_DRIVE);
-                    game.message = "You pick up the USB recovery drive.";
-                    setCallback(&Adventure::displayMessage);
-                }
-                break;
-            case 488:
-                if (action == "reboot")
-                {
-                    if (hasItem(INVENTORY_ITEM_A_RECOVERY_DRIVE))
-                    {
-                        game.qictair2 = true;
-                        game.message = "You reboot the PC with the recovery drive inserted. It boots back into Windows successfully.";
-                        setCallback(&Adventure::displayMessage);
-                    }
-                    else
-                    {
-                        game.message = "You don't have the recovery drive to reboot the server.";
-                        setCallback(&Adventure::displayMessage);
-                    }
-                }
-                break;
-            case 491:
-                if (action == "key")
-                {
-                    addItem(INVENTORY_ITEM_AIRPORT_KEYS);
-                    game.message = "You pick up the keys.";
-                    setCallback(&Adventure::displayMessage);
-                }
-                else if (action == "reboot")
-                {
-                    if (hasItem(INVENTORY_ITEM_A_RECOVERY_DRIVE))
-                    {
-                        game.qictair3 = true;
-                        game.message = "You reboot the PC with the recovery drive inserted. It boots back into Windows successfully.";
-                        setCallback(&Adventure::displayMessage);
-                    }
-                    else
-                    {
-                        game.message = "You don't have the recovery drive to reboot the server.";
-                        setCallback(&Adventure::displayMessage);
-                    }
-                }
-                break;
-            case 492:
-                if (action == "reboot")
-                {
-                    if (hasItem(INVENTORY_ITEM_A_RECOVERY_DRIVE))
-                    {
-                        game.qictair4 = true;
-                        game.message = "You reboot the PC with the recovery drive inserted. It boots back into Windows successfully.";
-                        setCallback(&Adventure::displayMessage);
-                    }
-                    else
-                    {
-                        game.message = "You don't have the recovery drive to reboot the server.";
-                        setCallback(&Adventure::displayMessage);
-                    }
-                }
-                break;
-            case 494:
-                if (action == "unlock")
-                {
-                    if (hasItem(INVENTORY_ITEM_AIRPORT_KEYS))
-                    {
-                        game.qictairunlock = true;
-                        game.message = "You unlock the door with the airport keys.";
-                        setCallback(&Adventure::displayMessage);
-                    }
-                    else
-                    {
-                        game.message = "You don't have the keys to unlock the door.";
-                        setCallback(&Adventure::displayMessage);
-                    }
-                }
-                break;
-            case 495:
-                if (action == "reboot")
-                {
-                    if (hasItem(INVENTORY_ITEM_A_RECOVERY_DRIVE))
-                    {
-                        game.qictair5 = true;
-                        game.message = "You reboot the PC with the recovery drive inserted. It boots back into Windows successfully.";
-                        setCallback(&Adventure::displayMessage);
-                    }
-                    else
-                    {
-                        game.message = "You don't have the recovery drive to reboot the server.";
-                        setCallback(&Adventure::displayMessage);
-                    }
-                }
-                break;
-            case 496:
-                if (action == "ticket")
-                {
-                    Serial.println("You grab a lottery ticket.");
-                    addItem(INVENTORY_ITEM_A_LOTTERY_TICKET);
-                }
-                else if (action == "drink")
-                {
-                    Serial.println("You grab an energy drink.");
-                    addItem(INVENTORY_ITEM_AN_ENERGY_DRINK);
-                }
-                break;
-            case 497:
-                if (action == "simon")
-                {
-                    // @todo Implement simon says gamme
-                    Serial.println("If you found this, we want to chat with you. Come find the badge makers.");
-                    printFlag("OzSecCTF{S1m0n_s4ys_1s_fun}");
-                }
-                break;
-            case 499:
-                if (action == "pamphlet")
-                {
-                    if (hasItem(INVENTORY_ITEM_A_LOAN_PAMPHLET))
-                    {
-                        printFlag("OzSecCTF{Spr3@d_teh_l0ans}");
-                        game.message = "You offer the loan pamphlet to the vendor.";
-                        setCallback(&Adventure::displayMessage);
-                    }
-                    else
-                    {
-                        game.message = "You don't have anything to offer.";
-                        setCallback(&Adventure::displayMessage);
-                    }
-                }
-                break;
-            case 500:
-                if (action == "sign")
-                {
-                    game.message = "OzSec 2024! Wichita's Annual Cyber Security Conference!\n\nJoin us for a day of talks, workshops, and networking.\n\n";
-                    setCallback(&Adventure::displayMessage);
-                }
-                else if (action == "beacon")
-                {
-                    player.beacon = player.room;
-                    game.message = "You set your beacon to this location.\r\nYou can return here at any time by typing 'beacon'";
-                    setCallback(&Adventure::displayMessage);
-                }
-                break;
-            case 501:
-                if (action == "talk")
-                {
-                    player.npc = 4; // Water Co Receptionist
-                    setCallback(&Adventure::displayDialog);
-                    setPromptCallback(&Adventure::talkToNPC);
-                }
-                break;
-            case 503:
-                if (action == "talk")
-                {
-                    player.npc = 3; // Water Co IT Manager
-                    setCallback(&Adventure::displayDialog);
-                    setPromptCallback(&Adventure::talkToNPC);
-                }
-                break;
-            case 504:
-                if (action == "coffee")
-                {
-                    addItem(INVENTORY_ITEM_A_CUP_OF_COFFEE);
-                    game.message = "You pick up a coffee mug and fill it with coffee from the pot.";
-                    setCallback(&Adventure::displayMessage);
-                }
-                break;
-            case 505:
-                if (action == "load")
-                {
-                    if (hasItem(INVENTORY_ITEM_AN_HP_LTO8_TAPE))
-                    {
-                        game.ictwaterloaded = true;
-                        game.message = "You load the tapes into the tape drive and press the button to begin restoration.";
-                        setCallback(&Adventure::displayMessage);
-                    }
-                    else
-                    {
-                        game.message = "You don't have the tapes to load.";
-                        setCallback(&Adventure::displayMessage);
-                    }
-                }
-                break;
-            case 507:
-                if (action == "open")
-                {
-                    if (hasItem(INVENTORY_ITEM_SAFE_DEPOSIT_KEY))
-                    {
-                        game.message = "You use the key to open the safe deposit box and retrieve a backup tape.";
-                        addItem(INVENTORY_ITEM_AN_HP_LTO8_TAPE);
-                        setCallback(&Adventure::displayMessage);
-                    }
-                    else
-                    {
-                        game.message = "You don't have the key to open the safe deposit box.";
-                        setCallback(&Adventure::displayMessage);
-                    }
-                }
-                break;
-            case 508:
-                if (action == "talk")
-                {
-                    player.npc = 5; // Bank teller
-                    setCallback(&Adventure::displayDialog);
-                    setPromptCallback(&Adventure::talkToNPC);
-                }
-                break;
-            case 509:
-                if (action == "pamphlet")
-                {
-                    addItem(INVENTORY_ITEM_A_LOAN_PAMPHLET);
-                    game.message = "You pick up a loan pamphlet detailing all the avialable loans and offers.";
-                    setCallback(&Adventure::displayMessage);
-                }
-                break;
-                // END Wichita actions
-            }
-        }
+/// @brief Play baseball in Newton
+void Adventure::actionPlayBall()
+{
+    if (game.quests.has(QUEST_NWTDISC))
+    {
+        printFlag("OzSecCTF{mu1t1_sp0rt_@thl3t3}");
+    }
+    setFlag(QUEST_NWTBALL, true);
+    game.message = "You enjoy a quick game of baseball.";
+    setCallback(&Adventure::displayMessage);
+}
+
+/// @brief Play disc golf in Newton
+void Adventure::actionThrowDiscs()
+{
+    if (game.quests.has(QUEST_NWTBALL))
+    {
+        printFlag("OzSecCTF{mu1t1_sp0rt_@thl3t3}");
+    }
+    setFlag(QUEST_NWTDISC, true);
+    game.message = "You enjoy a quick game of disc golf.";
+    setCallback(&Adventure::displayMessage);
+}
+
+/// @brief Offer the card player in the Dodge City saloon a drink
+void Adventure::actionSaloonGame()
+{
+    if (hasItem(INVENTORY_ITEM_A_GLASS_OF_THE_SALOON_SPECIAL))
+    {
+        printFlag("OzSecCTF{S@l00n_Sp3ci@l}");
+        game.message = "The player takes the drink and downs it. He stands up and says 'Thanks! I'd offer you to take my place, but I just lost everything. Have a great day.'";
+        setCallback(&Adventure::displayMessage);
+    }
+    else if (hasItem(INVENTORY_ITEM_AN_ENERGY_DRINK))
+    {
+        printFlag("OzSecCTF{S@l00n_Sp3ci@liz3d}");
+        game.message = "The player takes the energy drink and downs it. He stands up and says 'Awesome! I feel great! I'll take my winnings and head out. Have a great day.'";
+        setCallback(&Adventure::displayMessage);
+    }
+    else
+    {
+        game.message = "The player says 'Hey, I'm in a bind, and could use a drink of something to pick me up. I'll let you take my place if you can get me something.";
+        setCallback(&Adventure::displayMessage);
     }
 }
 
+/// @brief Join the line that never moves
+void Adventure::actionJoinLine()
+{
+    Timeline::println("You join the line.");
+    Timeline::pause(5000);
+    Timeline::println("The line isn't moving.");
+    Timeline::pause(5000);
+    game.message = "You decide to leave the line.";
+    setCallback(&Adventure::displayMessage);
+}
+
+/// @brief Grab a lottery ticket
+void Adventure::actionLotteryTicket()
+{
+    Console.println("You grab a lottery ticket.");
+    addItem(INVENTORY_ITEM_A_LOTTERY_TICKET);
+}
+
+/// @brief Grab an energy drink
+void Adventure::actionEnergyDrink()
+{
+    Console.println("You grab an energy drink.");
+    addItem(INVENTORY_ITEM_AN_ENERGY_DRINK);
+}
+
+/// @brief Simon says, not implemented yet
+void Adventure::actionSimon()
+{
+    // @todo Implement simon says gamme
+    Console.println("If you found this, we want to chat with you. Come find the badge makers.");
+    printFlag("OzSecCTF{S1m0n_s4ys_1s_fun}");
+}
 /// @brief Display dialog with NPC
 void Adventure::displayDialog()
 {
@@ -1987,54 +1633,31 @@ void Adventure::displayDialog()
         setCallback(&Adventure::displayMessage);
         return;
     }
-    // Print dialog
-    Serial.println();
-    Serial.println(npc[player.npc].name + ": " + npc[player.npc].dialog[player.dialogIndex].text);
-    Serial.println("--");
+    // Print dialog straight from the flash tables, piece by piece
+    const Dialog &dialog = npc[player.npc].dialog[player.dialogIndex];
+    Console.println();
+    Console.print(npc[player.npc].name);
+    Console.print(": ");
+    Console.println(dialog.text);
+    Console.println("--");
     // Print valid options
-    if (npc[player.npc].dialog[player.dialogIndex].response1_id != -1)
+    if (dialog.response1_id != -1)
     {
-        Serial.println("1> " + npc[player.npc].dialog[player.dialogIndex].response1);
+        Console.print("1> ");
+        Console.println(dialog.response1);
     }
-    if (npc[player.npc].dialog[player.dialogIndex].response2_id != -1)
+    if (dialog.response2_id != -1)
     {
-        Serial.println("2> " + npc[player.npc].dialog[player.dialogIndex].response2);
+        Console.print("2> ");
+        Console.println(dialog.response2);
     }
-    Serial.println("0> Bye.");
+    Console.println("0> Bye.");
 
     // Set callback to handle responses
     showPrompt = true;
     setPromptCallback(&Adventure::talkToNPC);
 }
 
-/// @brief Check if the action is valid for the current room
-/// @param action
-/// @return bool
-bool Adventure::isRoomAction(String action)
-{
-    // Allow "n" when in the Arcade as it's the beginning of the Konami code
-    if (player.room == 497)
-    {
-        if (action == konamiStrings[konamiIndex])
-        {
-            return true;
-        }
-        else
-        {
-            konamiIndex = 0;
-        }
-    }
-    for (int i = 0; i < MAX_ROOM_OPTIONS; i++)
-    {
-        if (action == rooms[player.room].options[i])
-        {
-            return true;
-        }
-    }
-
-    return false;
-}
-
 /// @brief Display something to the player, using the storedCallback function.
 void Adventure::show()
 {
@@ -2057,7 +1680,9 @@ void Adventure::talkToNPC(String response)
         // 0 is exit
         if (response == "0")
         {
-            Serial.println("\n" + npc[player.npc].name + ": Thanks for talking to me! Bye!");
+            Console.print("\n");
+            Console.print(npc[player.npc].name);
+            Console.println(": Thanks for talking to me! Bye!");
             player.npc = -1;
             player.dialogIndex = 0;
             showPrompt = true;
@@ -2068,7 +1693,7 @@ void Adventure::talkToNPC(String response)
         {
             if (npc[player.npc].dialog[player.dialogIndex].response1_id == -1)
             {
-                Serial.println("Invalid response. Please try again.");
+                Console.println("Invalid response. Please try again.");
             }
             else
             {
@@ -2096,7 +1721,7 @@ void Adventure::talkToNPC(String response)
         {
             if (npc[player.npc].dialog[player.dialogIndex].response2_id == -1)
             {
-                Serial.println("Invalid response. Please try again.");
+                Console.println("Invalid response. Please try again.");
             }
             else
             {
@@ -2122,7 +1747,7 @@ void Adventure::talkToNPC(String response)
     }
     else
     {
-        Serial.println("Invalid response. Please try again.");
+        Console.println("Invalid response. Please try again.");
     }
     setCallback(&Adventure::displayDialog);
     setPromptCallback(&Adventure::talkToNPC);
@@ -2151,24 +1776,17 @@ bool Adventure::checkQuest(int npc)
         if (hasItem(INVENTORY_ITEM_CHANOOGLE_SIGN))
         {
             printFlag("OzSecCTF{1-800-CHAN00G-411}");
-            game.qchanute = true;
+            setFlag(QUEST_CHANUTE, true);
             return true;
         }
         break;
     case 3: // Wichita Water IT Manager
         // If you have the access card, you are returning because the tapes were loaded.
-        if (hasItem(INVENTORY_ITEM_WICHITA_WATER_DATACENTER_ACCESS_CARD) && game.ictwaterloaded)
+        if (hasItem(INVENTORY_ITEM_WICHITA_WATER_DATACENTER_ACCESS_CARD) && game.quests.has(QUEST_ICTWATERLOADED))
         {
-            // Complete this quest, is Wichita itself complete?
-            if (game.qictairport)
-            {
-                Serial.println("\r\n\r\nCongratulations! You have completed all of the main quests in the game.\r\n\r\nHere is a flag for your accomplishments:");
-                printFlag("OzSecCTF{Kan5@s_1s_s@f3_4_n0w}");
-                game.qwichita = true;
-            }
-
+            // Complete this quest, GOAL_WICHITA prints its reward first if the airport is done too
+            setFlag(QUEST_ICTWATER, true);
             printFlag("OzSecCTF{W@t3r_1s_L1f3}");
-            game.qictwater = true;
 
             return true;
         }
@@ -2177,7 +1795,7 @@ bool Adventure::checkQuest(int npc)
         {
             if (!hasItem(INVENTORY_ITEM_WICHITA_WATER_DATACENTER_ACCESS_CARD)) // Only add if it's not already there.
                 addItem(INVENTORY_ITEM_WICHITA_WATER_DATACENTER_ACCESS_CARD);
-            game.ictwatertape = true;
+            setFlag(QUEST_ICTWATERTAPE, true);
             return true;
         }
         break;
@@ -2186,10 +1804,10 @@ bool Adventure::checkQuest(int npc)
         return true;
         break;
     case 6: // Pittsburg Town Hall
-        if (game.qptsshutdown && game.qptsunplug)
+        if (game.goals.has(GOAL_PITTSBURG_ATTACK))
         {
             printFlag("OzSecCTF{P1tt$burg_ATT&CK_2an_$om3_W@re}");
-            game.qpittsburg = true;
+            setFlag(QUEST_PITTSBURG, true);
             return true;
         }
         break;
@@ -2208,16 +1826,11 @@ bool Adventure::checkQuest(int npc)
         }
         break;
     case 10: // Wichita Airport IT Guy
-        if (game.qictair1 && game.qictair2 && game.qictair3 && game.qictair4 && game.qictair5)
+        if (game.goals.has(GOAL_WICHITA_AIRPORT))
         {
-            if (game.qictwater)
-            {
-                Serial.println("\r\n\r\nCongratulations! You have completed all of the main quests in the game.\r\n\r\nHere is a flag for your accomplishments:");
-                printFlag("OzSecCTF{Kan5@s_1s_s@f3_4_n0w}");
-                game.qwichita = true;
-            }
+            // GOAL_WICHITA prints its reward first if the water is done too
+            setFlag(QUEST_ICTAIRPORT, true);
             printFlag("OzSecCTF{CRWD_S0urc3d_R3B00t_0verthym3}");
-            game.qictairport = true;
             return true;
         }
         break;
@@ -2229,15 +1842,15 @@ bool Adventure::checkQuest(int npc)
     case 12: // Goodland Telecom
         if (hasItem(INVENTORY_ITEM_A_GTS_FIRMWARE_DRIVE))
         {
-            if (game.qgts1 && game.qgts2 && game.qgts3 && game.qgts4 && game.qgts5)
+            if (game.goals.has(GOAL_GOODLAND_TAXIS))
             {
                 printFlag("OzSecCTF{R0b0t_T@xi_S3rv1c3}");
-                game.qgoodland = true;
+                setFlag(QUEST_GOODLAND, true);
                 return true;
             }
             else
             {
-                Serial.println("We are still showing some taxi's in the field that are stuck, go make sure you can fix all of them.");
+                Console.println("We are still showing some taxi's in the field that are stuck, go make sure you can fix all of them.");
             }
             return false;
         }
@@ -2245,12 +1858,12 @@ bool Adventure::checkQuest(int npc)
         {
             // No key, so this is the first visit.
             addItem(INVENTORY_ITEM_A_GTS_FIRMWARE_DRIVE);
-            Serial.println("Here's a firmware flash drive, get into the taxi and update the firmware. If you need a key, check with the auto repair shop on Highway 24.");
+            Console.println("Here's a firmware flash drive, get into the taxi and update the firmware. If you need a key, check with the auto repair shop on Highway 24.");
             return false;
         }
         break;
     case 13: // KC Bus Manager
-        if (game.qkcbus1024 && game.qkcbus2018 && game.qkcbus1138)
+        if (game.goals.has(GOAL_KC_BUSES))
         {
             addItem(INVENTORY_ITEM_A_TICKET_TO_TOPEKA);
             return true;
@@ -2259,7 +1872,7 @@ bool Adventure::checkQuest(int npc)
         if (hasItem(INVENTORY_ITEM_NEWTON_RECOVERY_PAGE_1) && hasItem(INVENTORY_ITEM_NEWTON_RECOVERY_PAGE_2) && hasItem(INVENTORY_ITEM_NEWTON_RECOVERY_PAGE_3) && hasItem(INVENTORY_ITEM_NEWTON_RECOVERY_PAGE_4))
         {
             printFlag("OzSecCTF{N3wton_R3c0v3r3d}");
-            game.qnewton = true;
+            setFlag(QUEST_NEWTON, true);
             return true;
         }
     default:
@@ -2271,7 +1884,7 @@ bool Adventure::checkQuest(int npc)
 /// @brief Display a message to the player. The message is stored in game state variables.
 void Adventure::displayMessage()
 {
-    Serial.println(game.message);
+    Console.println(game.message);
     game.message = "";
     showPrompt = true;
     unsetCallback();
@@ -2282,7 +1895,7 @@ void Adventure::displayRoom()
 {
     // Make sure player.room is valid
     // Send player to starting room if it's not.
-    if (player.room < 0 || player.room >= sizeof(rooms) / sizeof(rooms[0]))
+    if (!Rooms::exists(player.room))
     {
         player.room = GRANDLOBBY;
         game.message = "You found yourself somewhere dark and hazy, after taking a few steps you are in the Grand Lobby.";
@@ -2290,14 +1903,16 @@ void Adventure::displayRoom()
         return;
     }
 
-    // Special case for locked rooms
-    if (player.room == THEVAULT && !game.qtrainingvault)
+    // Rooms locked until a quest goal is met
+    for (size_t i = 0; i < sizeof(roomGates) / sizeof(roomGates[0]); i++)
     {
-        player.room = player.previousRoom;
-
-        Serial.println("The door is locked. Perhaps there's a key that can unlock it.");
-        showPrompt = true;
-        return;
+        if (roomGates[i].room == player.room && !game.goals.has(roomGates[i].goal))
+        {
+            player.room = player.previousRoom;
+            Console.println(roomGates[i].locked);
+            showPrompt = true;
+            return;
+        }
     }
 
     // The Pittsburg University Computer Lab is only accessible from the ceiling tiles.
@@ -2305,7 +1920,7 @@ void Adventure::displayRoom()
     {
         player.room = player.previousRoom;
 
-        Serial.println("The door is locked.");
+        Console.println("The door is locked.");
         showPrompt = true;
         return;
     }
@@ -2313,76 +1928,40 @@ void Adventure::displayRoom()
     // Computer lab is always locked.
     if (player.room == 192 && player.previousRoom == 199)
     {
-        Serial.println("As you exit the computer lab the door slams shut behind you and locks.");
-        showPrompt = true;
-        return;
-    }
-
-    // Ellsworth Water Treatment Plant
-    if (player.room == 291 && !game.qelaccess)
-    {
-        player.room = player.previousRoom;
-        Serial.println("The guard intercepts you, 'Sorry, you need to checkin first.'");
+        Console.println("As you exit the computer lab the door slams shut behind you and locks.");
         showPrompt = true;
         return;
     }
 
     // Dodge City Train
-    if (player.room == 370 && !game.qdcconductor)
-    {
-        player.room = player.previousRoom;
-        Serial.println("The train door is locked.");
-        showPrompt = true;
-        return;
-    }
-    if (player.room == 370 && game.qdcconductor && game.qdcassociate)
+    if (player.room == 370 && game.goals.has(GOAL_DODGECITY_TRAIN))
     {
-        game.qdodgecity = true;
-        Serial.println("The Associate thanks you for the assistance and heads out.");
+        setFlag(QUEST_DODGECITY, true);
+        Console.println("The Associate thanks you for the assistance and heads out.");
         printFlag("OzSecCTF{Th3_Ass0ci@t3_0f_D0dg3_C1ty}");
     }
 
-    // Ensure all other quests are completed before allowing you to enter Wichita.
-    if ((player.room == 429 || player.room == 470 || player.room == 404 || player.room == 451))
-    {
-        if (!(game.qkansascity && game.qtopeka && game.qgoodland && game.qdodgecity && game.qnewton && game.qellsworth && game.qpittsburg && game.qchanute))
-        {
-            player.room = player.previousRoom;
-            Serial.println("As you approach there is a sign with 'Road Closed' and a law enforcement officer standing\r\nnearby. The officer tells you that this area is off limits as cities around the state\r\nare experiencing cyber related incidents and need assistance.\r\n\r\nYou are then escorted back where you came.");
-            showPrompt = true;
-            return;
-        }
-    }
-
-    if (player.room == 495 && !game.qictairunlock)
-    {
-        player.room = player.previousRoom;
-        Serial.println("The door is locked.");
-        showPrompt = true;
-        return;
-    }
-
     // Wichita water data center locked door
     if (player.room == 505)
     {
         if (!hasItem(INVENTORY_ITEM_WICHITA_WATER_DATACENTER_ACCESS_CARD))
         {
             player.room = player.previousRoom;
-            Serial.println("The door is locked. You need an access card to enter.");
+            Console.println("The door is locked. You need an access card to enter.");
             showPrompt = true;
             return;
         }
         else
         {
-            Serial.println("You swipe the access card and the door unlocks as you walk in.");
+            Console.println("You swipe the access card and the door unlocks as you walk in.");
         }
     }
 
-    Serial.println();
-    Serial.println(rooms[player.room].title);
-    Serial.println("==================");
-    printWithWrapping(rooms[player.room].description, 100); // Adjust wrap width as necessary
-    Serial.println("==================");
+    Console.println();
+    Console.println(Rooms::title(player.room));
+    Console.println("==================");
+    Rooms::printDescription(player.room, Console, TERMINAL_WIDTH);
+    Console.println("==================");
     // Dynamically print directions
     for (int i = 0; i < MAX_ROOM_NEIGHBORS; i++)
     {
@@ -2402,133 +1981,32 @@ void Adventure::displayRoom()
             direction = "s";
             break;
         }
-        if (rooms[player.room].neighbors[i] != -1)
+        if (Rooms::neighbor(player.room, i) != -1)
         {
-            Serial.print("[" + direction + "] ");
-            Serial.println(rooms[rooms[player.room].neighbors[i]].title);
+            Console.print("[" + direction + "] ");
+            Console.println(Rooms::title(Rooms::neighbor(player.room, i)));
         }
     }
 
-    String tempString = String(rooms[player.room].actions);
+    String tempString = Rooms::actions(player.room).toString();
     while (tempString.indexOf("\n") != -1)
     {
         String stringToPrint = tempString.substring(0, tempString.indexOf("\n"));
-        Serial.println(stringToPrint);
+        Console.println(stringToPrint);
         tempString = tempString.substring(tempString.indexOf("\n") + 1);
     }
     unsetCallback();
     showPrompt = true;
 }
 
-void Adventure::printWithWrapping(String text, int width)
+/// @brief Check if the game loop has anything to do before it waits for input
+bool Adventure::pending()
 {
-    int currentLineLength = 0;
-    String currentWord = "";
-    bool lastCharWasCR = false; // To track if the last character was a carriage return
-    bool skipNewLine = false;   // To prevent extra newlines
-    char c;
-
-    for (int i = 0; i < text.length(); i++)
-    {
-        c = text[i];
-
-        // Check for newline '\n' or '\r\n' cases
-        if (c == '\r')
-        {
-            lastCharWasCR = true;
-        }
-        else if (c == '\n')
-        {
-            // If the previous character was '\r', this is part of a '\r\n' pair
-            if (lastCharWasCR)
-            {
-                lastCharWasCR = false;
-            }
-
-            // Print the last word if necessary
-            if (currentWord.length() > 0)
-            {
-                // Check if adding this word exceeds the width
-                if (currentLineLength + currentWord.length() > width)
-                {
-                    Serial.println();
-                    currentLineLength = 0;
-                }
-                Serial.print(currentWord);
-                currentLineLength = currentLineLength + currentWord.length();
-                currentWord = "";
-            }
-
-            // Only add a new line if the previous character was not another newline
-            if (!skipNewLine)
-            {
-                Serial.println();
-                skipNewLine = true;
-            }
-
-            currentLineLength = 0;
-        }
-        else
-        {
-            // Normal character
-            if (lastCharWasCR)
-            {
-                // '\r' was not followed by '\n', treat it as a line break
-                if (currentWord.length() > 0)
-                {
-                    // Check if adding this word exceeds the width
-                    if (currentLineLength + currentWord.length() > width)
-                    {
-                        Serial.println();
-                        currentLineLength = 0;
-                    }
-                    Serial.print(currentWord);
-                    currentLineLength = currentWord.length();
-                    currentWord = "";
-                }
-                currentLineLength = 0;
-                lastCharWasCR = false;
-            }
-
-            if (c == ' ' || i == text.length() - 1)
-            {
-                // Include the last character in the current word if we're at the end
-                if (i == text.length() - 1 && c != ' ')
-                {
-                    currentWord += c;
-                }
-
-                // Check if adding this word exceeds the width
-                if (currentLineLength + currentWord.length() > width)
-                {
-                    Serial.println();
-                    currentLineLength = 0;
-                }
-
-                // Print the current word and a space
-                Serial.print(currentWord + (c == ' ' ? " " : ""));
-                currentLineLength += currentWord.length() + (c == ' ' ? 1 : 0);
-                currentWord = "";
-                skipNewLine = false;
-            }
-            else
-            {
-                currentWord += c;
-            }
-        }
-    }
-
-    // Print any remaining word after the loop
-    if (currentWord.length() > 0)
+    if (Serial.available() > 0)
     {
-        if (currentLineLength + currentWord.length() > width)
-        {
-            Serial.println();
-        }
-        Serial.print(currentWord);
+        return true;
     }
-
-    Serial.println();
+    return serialConnected && (storedCallback != NULL || showPrompt);
 }
 
 /// @brief Handle input from the player and the prompt sent.
@@ -2541,7 +2019,7 @@ void Adventure::prompt()
     if (showPrompt)
     {
         showPrompt = false;
-        Serial.print("> ");
+        Console.print("> ");
     }
 
     // Read if there is data available
@@ -2558,14 +2036,14 @@ void Adventure::prompt()
                 response.remove(response.length() - 1); // Remove last character
 
                 // Move the cursor back, overwrite the last character with a space, and move the cursor back again
-                Serial.print("\b \b");
+                Console.print("\b \b");
             }
             break;
         }
         case '\r':
         case '\n':
         {
-            Serial.println(); // Move to the next line
+            Console.println(); // Move to the next line
 
             response.trim(); // Trim any extraneous spaces
 
@@ -2585,7 +2063,7 @@ void Adventure::prompt()
         {
             // Add the character to the response buffer and echo it back to the serial monitor
             response += incomingChar;
-            Serial.print(incomingChar);
+            Console.print(incomingChar);
             break;
         }
         }
@@ -2595,21 +2073,34 @@ void Adventure::prompt()
 /// @brief Process received input
 void Adventure::processPromptResponse(String promptResponse)
 {
-    // Check if callback is set
-    if (promptCallback)
-    {
-        (this->*promptCallback)(promptResponse);
-    }
-    else if (isRoomAction(promptResponse))
+    uint32_t start = ESP.getCycleCount();
+    PlayerAction action = resolve(promptResponse.c_str(), promptResponse.length());
+    uint32_t cycles = ESP.getCycleCount() - start;
+    resolveCount++;
+    resolveCycles += cycles;
+    resolveCyclesMax = max(resolveCyclesMax, (unsigned long)cycles);
+
+    // Anything but the next step starts the Konami code over
+    if (player.room == 497 && action.type != ACTION_PROMPT && action.type != ACTION_KONAMI)
     {
-        roomAction(promptResponse);
+        konamiIndex = 0;
     }
-    else
+
+    switch (action.type)
     {
-        systemCommand(promptResponse);
+    case ACTION_PROMPT:
+        (this->*promptCallback)(promptResponse);
+        break;
+    case ACTION_KONAMI:
+    case ACTION_DIRECTION:
+    case ACTION_ROOM:
+        roomAction(action);
+        break;
+    case ACTION_COMMAND:
+    case ACTION_UNKNOWN:
+        systemCommand(action);
+        break;
     }
-
-    return;
 }
 
 /// @brief Update game state based on various events.
@@ -2620,27 +2111,87 @@ void Adventure::stateUpdate()
 /// @brief System command to display help message.
 void Adventure::cmdHelp()
 {
-    Serial.println("Commands:");
-    Serial.println("help - Display this help message.");
-    Serial.println("save - Save your game.");
-    Serial.println("exit - Exit the game.");
-    Serial.println("notebook - Show your notebook, which includes any CTF Flags you've found.");
-    Serial.println("write - Write in your notebook."); // @todo Potentially remove this? Keep it a background function?
-    Serial.println("inventory - Display your inventory.");
-    Serial.println("look - Display the room description again.");
-    Serial.println("nickname - Change your name.");
-    Serial.println("whoami - Display your name.");
-    Serial.println("badge - Check your badge status.");
-    Serial.println("scan - Set your badge into scanning mode.");
-    Serial.println("n, s, e, w - Go in a direction.");
-    Serial.println("beacon - Call a BEACON taxi service and return to your specified beacon location.");
-    Serial.println("keyword - Perform action on keyword from room description.");
-    Serial.println("wifi - Configure WiFi settings.");
-    Serial.println("reset - Reset game state.");
-    Serial.println("debug - Show game state.");
-    Serial.println("twinkle - Toggle LED mode.");
-    Serial.println("toggle <led> - Toggle LED on or off in adventure led mode.");
-    Serial.println("LED's: 0, 1, 2, 3, 4, 5, 6, 7");
+    Console.println("Commands:");
+    Console.println("help - Display this help message.");
+    Console.println("save - Save your game.");
+    Console.println("exit - Exit the game.");
+    Console.println("notebook - Show your notebook, which includes any CTF Flags you've found.");
+    Console.println("write - Write in your notebook."); // @todo Potentially remove this? Keep it a background function?
+    Console.println("inventory - Display your inventory.");
+    Console.println("look - Display the room description again.");
+    Console.println("nickname - Change your name.");
+    Console.println("whoami - Display your name.");
+    Console.println("badge - Check your badge status.");
+    Console.println("scan - Set your badge into scanning mode.");
+    Console.println("n, s, e, w - Go in a direction.");
+    Console.println("beacon - Call a BEACON taxi service and return to your specified beacon location.");
+    Console.println("keyword - Perform action on keyword from room description.");
+    Console.println("wifi - Configure WiFi settings.");
+    Console.println("reset - Reset game state.");
+    Console.println("debug - Show game state.");
+    Console.println("twinkle - Toggle LED mode.");
+    Console.println("stats - Show badge performance counters.");
+    Console.println("toggle <led> - Toggle LED on or off in adventure led mode.");
+    Console.println("LED's: 0, 1, 2, 3, 4, 5, 6, 7");
+    showPrompt = true;
+    unsetCallback();
+}
+
+/// @brief System command to show performance counters since the last time it was run.
+void Adventure::cmdStats()
+{
+    static unsigned long statsSince = 0;
+    unsigned long elapsed = millis() - statsSince;
+    unsigned long ledBusy = Lights::frameBusy / 1000;
+    unsigned long gameIdle = Input::waitTime / 1000;
+
+    Console.println("Stats for the last " + String(elapsed / 1000.0, 1) + " seconds:");
+    Console.println("LED frames: " + String(Lights::frameCount) + " (" + String(Lights::frameOverruns) + " over budget)");
+    Console.println("LED core idle: " + String(elapsed > 0 && ledBusy < elapsed ? 100.0 * (elapsed - ledBusy) / elapsed : 100.0, 1) + "%");
+    Console.println("LED duty writes: " + String(Lights::dutyWrites));
+    Console.println("RGB shows: " + String(Lights::stripShows) + " (" + String(Lights::stripSkips) + " skipped, unchanged)");
+    Console.println("Game loop: " + String(elapsed > 0 ? 1000.0 * loopCount / elapsed : 0.0, 1) + " iterations/s");
+    Console.println("Game core idle: " + String(elapsed > 0 && gameIdle < elapsed ? 100.0 * gameIdle / elapsed : 100.0, 1) + "%");
+    Console.println("Saves: " + String(saveCount) + " written for " + String(saveRequests) + " changes (" + String(nvsReads) + " NVS reads, " + String(Storage::writes) + " NVS writes, " + String(Storage::bytesWritten) + " bytes written, " + String(Storage::failures) + " failed)");
+    Console.println("Save latency: game loop " + String(saveCount > 0 ? (unsigned long)(saveTime / saveCount) : 0UL) + " us avg, " + String(saveTimeMax) + " us max; storage task " + String(Storage::writes > 0 ? (unsigned long)(Storage::writeTime / Storage::writes) : 0UL) + " us avg, " + String(Storage::writeMax) + " us max");
+    Console.println("Quest goals: " + String(questChecks) + " checked for " + String(questUpdates) + " flag changes");
+    Console.println("Quest snapshots: " + String(Quests::reads) + " read by the LED task, " + String(Quests::retries) + " retried");
+    Console.println("Button edges: " + String(Buttons::edgeCount) + " (" + String(Buttons::edgeDropped) + " dropped)");
+    Console.println("Input: " + String(resolveCount) + " resolved, " + String(resolveCount > 0 ? (float)resolveCycles / resolveCount / ESP.getCpuFreqMHz() : 0.0, 2) + " us avg, " + String((float)resolveCyclesMax / ESP.getCpuFreqMHz(), 2) + " us max");
+    Console.println("Console: " + String(Console.queued) + " bytes queued, " + String(Console.dropped) + " dropped, " + String((unsigned long)(Console.blockedTime / 1000)) + " ms blocked");
+
+    Lights::frameCount = 0;
+    Lights::frameOverruns = 0;
+    Lights::frameBusy = 0;
+    Lights::dutyWrites = 0;
+    Lights::stripShows = 0;
+    Lights::stripSkips = 0;
+    Buttons::edgeCount = 0;
+    Buttons::edgeDropped = 0;
+    questUpdates = 0;
+    questChecks = 0;
+    Quests::reads = 0;
+    Quests::retries = 0;
+    loopCount = 0;
+    saveCount = 0;
+    saveRequests = 0;
+    nvsReads = 0;
+    saveTime = 0;
+    saveTimeMax = 0;
+    Storage::writes = 0;
+    Storage::failures = 0;
+    Storage::bytesWritten = 0;
+    Storage::writeTime = 0;
+    Storage::writeMax = 0;
+    Input::waitTime = 0;
+    resolveCount = 0;
+    resolveCycles = 0;
+    resolveCyclesMax = 0;
+    Console.queued = 0;
+    Console.dropped = 0;
+    Console.blockedTime = 0;
+    statsSince = millis();
+
     showPrompt = true;
     unsetCallback();
 }
@@ -2651,25 +2202,25 @@ void Adventure::cmdTwinkle()
     {
         lightMode = TWINKLE;
         ledTwinkleMode = 2;
-        Serial.println("LED mode set to TWINKLE 2.");
+        Console.println("LED mode set to TWINKLE 2.");
     }
     else if ((lightMode == TWINKLE) && (ledTwinkleMode == 2))
     {
         lightMode = TWINKLE;
         ledTwinkleMode = 3;
-        Serial.println("LED mode set to TWINKLE 3.");
+        Console.println("LED mode set to TWINKLE 3.");
     }
     else if ((lightMode == TWINKLE) && (ledTwinkleMode == 3))
     {
         lightMode = ADVENTURE;
         ledTwinkleMode = 1;
-        Serial.println("LED mode set to ADVENTURE.");
+        Console.println("LED mode set to ADVENTURE.");
     }
     else
     {
         lightMode = TWINKLE;
         ledTwinkleMode = 1;
-        Serial.println("LED mode set to TWINKLE 1.");
+        Console.println("LED mode set to TWINKLE 1.");
     }
     showPrompt = true;
     unsetCallback();
@@ -2679,7 +2230,8 @@ void Adventure::cmdTwinkle()
 void Adventure::cmdSave()
 {
     save();
-    Serial.println("Game saved.");
+    flush(true);
+    Console.println("Game saved.");
     showPrompt = true;
     unsetCallback();
 }
@@ -2687,7 +2239,7 @@ void Adventure::cmdSave()
 void Adventure::cmdLoad()
 {
     load();
-    Serial.println("Game state loaded.");
+    Console.println("Game state loaded.");
     showPrompt = true;
     unsetCallback();
 }
@@ -2707,15 +2259,15 @@ void Adventure::cmdScan()
 
     if (found)
     {
-        Serial.println("The badge you are carrying chirps and a green light has illuminated.");
-        game.qmodel2023 = true;
+        Console.println("The badge you are carrying chirps and a green light has illuminated.");
+        setFlag(QUEST_MODEL2023, true);
         save();
         digitalWrite(GPIO_NUM_17, HIGH);
     }
     else
     {
-        Serial.println("The badge you are holding beeps and a red light illuminates.");
-        game.qmodel2023 = false;
+        Console.println("The badge you are holding beeps and a red light illuminates.");
+        setFlag(QUEST_MODEL2023, false);
         save();
         digitalWrite(GPIO_NUM_17, LOW);
     }
@@ -2733,7 +2285,8 @@ void Adventure::cmdExit()
     }
     serialConnected = false;
     lightMode = TWINKLE;
-    Serial.println("Thanks for playing!");
+    flush(true);
+    Console.println("Thanks for playing!");
     setCallback(&Adventure::displayRoom);
 }
 
@@ -2752,7 +2305,7 @@ void Adventure::cmdInventory()
     {
         if (player.inventory[i] > 0)
         {
-            Serial.println(String(InventoryItems[i]) + " x " + String(player.inventory[i]));
+            Console.println(String(InventoryItems[i]) + " x " + String(player.inventory[i]));
         }
     }
     showPrompt = true;
@@ -2782,12 +2335,10 @@ void Adventure::cmdWhoami()
 /// @brief System command to reset the game state to defaults.
 void Adventure::cmdReset()
 {
-    preferences.begin("game-data-inventory", false);
-    preferences.clear();
-    preferences.end();
-    preferences.begin("game-data", false);
-    // Clear the preferences to reset the game state
-    if (preferences.clear())
+    // Clear the save and notebook to reset the game state, waiting so the reload below starts a new game
+    bool cleared = Storage::clear(SAVE_NAMESPACE) && Notebook::clear();
+
+    if (cleared)
     {
         digitalWrite(GPIO_NUM_17, LOW); // Turn off the 2023 led
         load();
@@ -2797,7 +2348,6 @@ void Adventure::cmdReset()
     {
         game.message = "Game state failed to reset.";
     }
-    preferences.end();
     setCallback(&Adventure::displayMessage);
 }
 
@@ -2805,31 +2355,27 @@ void Adventure::cmdReset()
 /// @brief System command to display debug information.
 void Adventure::cmdDebug()
 {
-    preferences.begin("game-data-inventory", true);
     game.message = "Inventory:\n";
     for (int i = 0; i < INVENTORY_ITEM_INDEX_COUNT; i++)
     {
         game.message += "  " + String(InventoryItems[i]) + " x " + String(player.inventory[i]) + "\n";
     }
-    preferences.end();
-    preferences.begin("game-data", true);
     game.message += "Current Room: " + String(player.room) + "\n";
     game.message += "Game state:\nName: " + player.name + "\n";
     game.message += "Room: " + String(player.room) + "\n";
     game.message += "Previous Room: " + String(player.previousRoom) + "\n";
     game.message += "Beacon: " + String(player.beacon) + "\n";
     // Add quest status
-    game.message += "\nQuests:\nRoom 0 unlocked: " + String(game.qtrainingvault) + "\nTraining complete: " + String(game.qtraining) + "\nChanute: " + String(game.qchanute) + "\nGoodland: " + String(game.qgoodland) + "\nTaxis: " + String(game.qgts1) + String(game.qgts2) + String(game.qgts3) + String(game.qgts4) + String(game.qgts5) + "\nDodge City: " + String(game.qdodgecity) + "\nNewton: " + String(game.qnewton) + "\nEllsworth: " + String(game.qellsworth) + "\nPittsburg: " + String(game.qpittsburg) + "\nWichita: " + String(game.qwichita);
-    preferences.end();
+    game.message += "\nQuests:\nRoom 0 unlocked: " + String(game.quests.has(QUEST_TRAININGVAULT)) + "\nTraining complete: " + String(game.quests.has(QUEST_TRAINING)) + "\nChanute: " + String(game.quests.has(QUEST_CHANUTE)) + "\nGoodland: " + String(game.quests.has(QUEST_GOODLAND)) + "\nTaxis: " + String(game.quests.has(QUEST_GTS1)) + String(game.quests.has(QUEST_GTS2)) + String(game.quests.has(QUEST_GTS3)) + String(game.quests.has(QUEST_GTS4)) + String(game.quests.has(QUEST_GTS5)) + "\nDodge City: " + String(game.quests.has(QUEST_DODGECITY)) + "\nNewton: " + String(game.quests.has(QUEST_NEWTON)) + "\nEllsworth: " + String(game.quests.has(QUEST_ELLSWORTH)) + "\nPittsburg: " + String(game.quests.has(QUEST_PITTSBURG)) + "\nWichita: " + String(game.quests.has(QUEST_WICHITA));
 
     // Display the ID's and titles of rooms that have actions
     // This was used to see what rooms needed actions added/tested.
     game.message += "\n\nRooms with actions:\n";
-    for (int i = 0; i < sizeof(rooms) / sizeof(rooms[0]); i++)
+    for (int i = 0; i < Rooms::idCount(); i++)
     {
-        if (rooms[i].actions != "")
+        if (Rooms::actions(i).peek() != -1)
         {
-            game.message += String(i) + ": " + rooms[i].title + "\n";
+            game.message += String(i) + ": " + Rooms::title(i).toString() + "\n";
         }
     }
 
@@ -2853,21 +2399,22 @@ void Adventure::cmdToggle(int led)
 
     int ledPin = all_leds[led];
 
-    if (Lights::getLedStatus(ledPin))
+    if (Lights::getLedStatus(led))
     {
-        Lights::ledOff(ledPin, true);
+        Lights::ledOff(led, true);
         game.message = "LED " + String(led) + " on pin " + String(ledPin) + " turned off.";
     }
     else
     {
-        Lights::ledOn(ledPin, true);
+        Lights::ledOn(led, true);
         game.message = "LED " + String(led) + " on pin " + String(ledPin) + " turned on.";
     }
+    ledNotify(); // Wake the background task to run the fade
     game.message += "\r\n";
     String ledStatusString;
     for (int i = 0; i < SIMPLE_NUM_LEDS; i++)
     {
-        if (Lights::getLedStatus(all_leds[i]))
+        if (Lights::getLedStatus(i))
         {
             ledStatusString = "ON";
         }
@@ -2885,7 +2432,7 @@ void Adventure::cmdToggle(int led)
 void Adventure::cmdBadge()
 {
     String badgeStatus;
-    if (game.qmodel2023)
+    if (game.quests.has(QUEST_MODEL2023))
     {
         badgeStatus = "green";
     }
@@ -2900,21 +2447,28 @@ void Adventure::cmdBadge()
 
 void Adventure::cmdNotebook()
 {
-    game.message = player.notebook;
-    setCallback(&Adventure::displayMessage);
+    Console.println("Your notebook has the following entries:\r\n");
+    Notebook::print(Console);
+    showPrompt = true;
 }
 
 void Adventure::cmdWriteNote(String note)
 {
-    player.notebook += note + "\r\n";
-    game.message = "You write '" + note + "' in your notebook.";
+    if (Notebook::add(note))
+    {
+        game.message = "You write '" + note + "' in your notebook.";
+    }
+    else
+    {
+        game.message = "You could not write '" + note + "' in your notebook, try again.";
+    }
     setCallback(&Adventure::displayMessage);
 }
 
 void Adventure::cmdBeacon()
 {
     player.room = player.beacon;
-    Serial.println("You call a BEACON taxi service and are dropped off.");
+    Console.println("You call a BEACON taxi service and are dropped off.");
     setCallback(&Adventure::displayRoom);
 }
 
@@ -2923,37 +2477,37 @@ void Adventure::cmdCompleteQuest(int quest)
     switch (quest)
     {
     case 0:
-        game.qtrainingvault = true;
+        setFlag(QUEST_TRAININGVAULT, true);
         break;
     case 1:
-        game.qtraining = true;
+        setFlag(QUEST_TRAINING, true);
         break;
     case 2:
-        game.qchanute = true;
+        setFlag(QUEST_CHANUTE, true);
         break;
     case 3:
-        game.qkansascity = true;
+        setFlag(QUEST_KANSASCITY, true);
         break;
     case 4:
-        game.qtopeka = true;
+        setFlag(QUEST_TOPEKA, true);
         break;
     case 5:
-        game.qgoodland = true;
+        setFlag(QUEST_GOODLAND, true);
         break;
     case 6:
-        game.qdodgecity = true;
+        setFlag(QUEST_DODGECITY, true);
         break;
     case 7:
-        game.qnewton = true;
+        setFlag(QUEST_NEWTON, true);
         break;
     case 8:
-        game.qellsworth = true;
+        setFlag(QUEST_ELLSWORTH, true);
         break;
     case 9:
-        game.qpittsburg = true;
+        setFlag(QUEST_PITTSBURG, true);
         break;
     case 10:
-        game.qwichita = true;
+        setFlag(QUEST_WICHITA, true);
         break;
     default:
         break;
@@ -2975,155 +2529,91 @@ void Adventure::cmdCheat(String code)
     setCallback(&Adventure::displayMessage);
 }
 
-/// @brief Handle system commands.
-void Adventure::systemCommand(String command)
+/// @brief Find a system command by name or alias with one hash table lookup.
+/// @param name Start of the name, it does not need to be nul terminated
+/// @param length Length of the name
+/// @return The command, or NULL if there is no command with this name
+const Command *Adventure::findCommand(const char *name, size_t length)
 {
+    static constexpr Command commands[] = {
+        Command("help", &Adventure::cmdHelp),
+        Command("save", &Adventure::cmdSave),
+        Command("load", &Adventure::cmdLoad),
+        Command("exit", &Adventure::cmdExit),
+        Command("wifi", &Adventure::cmdWifi),
+        Command("inventory", &Adventure::cmdInventory).shortName("i"),
+        Command("look", &Adventure::cmdLook).shortName("l"),
+        Command("nickname", &Adventure::cmdNickname),
+        Command("whoami", &Adventure::cmdWhoami),
+        Command("reset", &Adventure::cmdReset),
+        Command("twinkle", &Adventure::cmdTwinkle),
+        Command("stats", &Adventure::cmdStats),
+        Command("badge", &Adventure::cmdBadge),
+        Command("scan", &Adventure::cmdScan),
+        Command("notebook", &Adventure::cmdNotebook),
+        Command("write", &Adventure::cmdWriteNote),
+        Command("beacon", &Adventure::cmdBeacon),
+        Command("cheat", &Adventure::cmdCheat),
+        Command("debug", &Adventure::cmdDebug).cheatsOnly(),
+        Command("goto", &Adventure::cmdGoto).cheatsOnly(), // @todo Remove for production
+        Command("toggle", &Adventure::cmdToggle).cheatsOnly(),
+        Command("complete", &Adventure::cmdCompleteQuest).cheatsOnly(),
+    };
+    static constexpr CommandTable table = commandTable(commands);
+    static_assert(sizeof(commands) / sizeof(commands[0]) * 2 < 256, "Command slots only hold 127 commands");
+    static_assert(table.seed < COMMAND_SEED_LIMIT, "No hash seed gives every command name its own slot, raise COMMAND_SLOTS");
+
+    uint8_t slot = table.slots[commandSlot(name, length, table.seed)];
+    if (slot == 0)
+    {
+        return NULL;
+    }
+
+    const Command *command = &commands[(slot - 1) / 2];
+    const char *found = (slot - 1) % 2 == 0 ? command->name : command->alias;
+    if (strncmp(found, name, length) != 0 || found[length] != '\0')
+    {
+        return NULL;
+    }
+    return command;
+}
 
-    String program = "";
-    String arguments = "";
+/// @brief Run a system command found by resolve().
+void Adventure::systemCommand(const PlayerAction &action)
+{
+    const Command *found = action.command;
 
-    // Split command on spaces
-    if (command.indexOf(' ') == -1)
-    {
-        program = command;
-    }
-    else
+    if (found == NULL)
     {
-        int spaceIndex = command.indexOf(' ');
-        if (spaceIndex != -1)
-        {
-            program = command.substring(0, spaceIndex);
-            arguments = command.substring(spaceIndex + 1);
-        }
+        game.message = "Unknown command.";
+        setCallback(&Adventure::displayMessage);
+        return;
     }
 
-    // If tree because switch statements can't switch on strings.
-    if (program == "help")
-    {
-        cmdHelp();
-    }
-    else if (program == "save")
-    {
-        cmdSave();
-    }
-    else if (program == "load")
-    {
-        cmdLoad();
-    }
-    else if (program == "exit")
-    {
-        cmdExit();
-    }
-    else if (program == "wifi")
-    {
-        cmdWifi();
-    }
-    else if (program == "inventory" || program == "i")
-    {
-        cmdInventory();
-    }
-    else if (program == "look" || program == "l")
-    {
-        cmdLook();
-    }
-    else if (program == "nickname")
-    {
-        cmdNickname();
-    }
-    else if (program == "whoami")
-    {
-        cmdWhoami();
-    }
-    else if (program == "reset")
-    {
-        cmdReset();
-    }
-    else if (program == "twinkle")
-    {
-        cmdTwinkle();
-    }
-    else if (program == "badge")
-    {
-        cmdBadge();
-    }
-    else if (program == "scan")
-    {
-        cmdScan();
-    }
-    else if (program == "notebook")
-    {
-        cmdNotebook();
-    }
-    else if (program == "write")
-    {
-        cmdWriteNote(arguments);
-    }
-    else if (program == "beacon")
-    {
-        cmdBeacon();
-    }
-    else if (program == "cheat")
-    {
-        cmdCheat(arguments);
-    }
-    else if (program == "debug")
-    {
-        if (game.cheats)
-        {
-            cmdDebug();
-        }
-        else
-        {
-            game.message = "Cheat code required to use this command.";
-            setCallback(&Adventure::displayMessage);
-        }
-    }
-    else if (program == "goto") // @todo Remove for production
-    {
-        if (game.cheats)
-        {
-            cmdGoto(arguments.toInt());
-        }
-        else
-        {
-            game.message = "Cheat code required to use this command.";
-            setCallback(&Adventure::displayMessage);
-        }
-    }
-    else if (program == "toggle")
-    {
-        if (game.cheats)
-        {
-            cmdToggle(arguments.toInt());
-        }
-        else
-        {
-            game.message = "Cheat code required to use this command.";
-            setCallback(&Adventure::displayMessage);
-        }
-    }
-    else if (program == "complete")
+    if (found->cheat && !game.cheats)
     {
-        if (game.cheats)
-        {
-            cmdCompleteQuest(arguments.toInt());
-        }
-        else
-        {
-            game.message = "Cheat code required to use this command.";
-            setCallback(&Adventure::displayMessage);
-        }
+        game.message = "Cheat code required to use this command.";
+        setCallback(&Adventure::displayMessage);
+        return;
     }
-    else
+
+    switch (found->argument)
     {
-        game.message = "Unknown command.";
-        setCallback(&Adventure::displayMessage);
+    case COMMAND_NO_ARGUMENT:
+        (this->*found->run)();
+        break;
+    case COMMAND_TEXT:
+        (this->*found->runText)(action.arguments);
+        break;
+    case COMMAND_NUMBER:
+        (this->*found->runNumber)(atoi(action.arguments));
+        break;
     }
 }
 
 void Adventure::printFlag(String flag)
 {
-    Serial.println("Flag: " + flag);
+    Timeline::println("Flag: " + flag);
     cmdWriteNote("Flag: " + flag);
-    sleep(3);
+    Timeline::pause(3000);
 }
\ No newline at end of file
@@ -0,0 +1,176 @@
+#include <ozsec/buttons.hpp>
+#include <ozsec/input.hpp>
+
+// Edge seen by the button interrupt, handled by the input task
+struct ButtonEdge
+{
+    uint8_t button;
+    unsigned long time; // Time in ms of the edge
+};
+
+// Debounce and long press state of a button, only used by the input task
+struct ButtonState
+{
+    bool pressed;          // Debounced state
+    bool settling;         // An edge was seen and the button has not been still for BUTTON_DEBOUNCE yet
+    bool held;             // Long press already fired for this press
+    unsigned long changed; // Time of the last edge
+    unsigned long down;    // Time the current press started
+};
+
+QueueHandle_t buttonEdges; // Edges from the interrupt to the input task
+TaskHandle_t InputTask;
+ButtonState buttonStates[BUTTON_COUNT];
+void (*clickHandlers[BUTTON_COUNT])();
+void (*longPressHandlers[BUTTON_COUNT])();
+
+unsigned long Buttons::edgeCount;
+unsigned long Buttons::edgeDropped;
+
+/// @brief Setup the button pins and interrupts, and start the input task on core 1.
+/// Set up handlers with Buttons::onClick() and Buttons::onLongPress(), and call Input::init() before calling this.
+void Buttons::init()
+{
+    buttonEdges = xQueueCreate(BUTTON_QUEUE_LENGTH, sizeof(ButtonEdge));
+
+    for (int i = 0; i < BUTTON_COUNT; i++)
+    {
+        pinMode(button_pins[i], INPUT_PULLUP);
+        buttonStates[i] = {digitalRead(button_pins[i]) == LOW, false, false, 0, 0};
+        attachInterruptArg(button_pins[i], Buttons::isr, (void *)(uintptr_t)i, CHANGE);
+    }
+
+    // Run above loop() so presses are timed correctly while the game is busy
+    xTaskCreatePinnedToCore(
+        Buttons::task,     /* Function to run the task */
+        "InputTask",       /* Name of the task */
+        BUTTON_TASK_STACK, /* Stack size in words */
+        NULL,              /* Task input parameter */
+        2,                 /* Priority of the task */
+        &InputTask,        /* Task handle. */
+        1);                /* Core where the task should run */
+}
+
+/// @brief Set the function to call from the game loop when a button is clicked
+void Buttons::onClick(ButtonId button, void (*handler)())
+{
+    clickHandlers[button] = handler;
+}
+
+/// @brief Set the function to call when a button is held for BUTTON_LONG_PRESS.
+/// It runs on the input task straight away, even while the game loop is busy.
+void Buttons::onLongPress(ButtonId button, void (*handler)())
+{
+    longPressHandlers[button] = handler;
+}
+
+/// @brief Run the click handler of a button. Called by the game loop for button input.
+void Buttons::click(ButtonId button)
+{
+    if (button < BUTTON_COUNT && clickHandlers[button])
+    {
+        clickHandlers[button]();
+    }
+}
+
+/// @brief Button interrupt, passes the edge and its time on to the input task
+void IRAM_ATTR Buttons::isr(void *arg)
+{
+    ButtonEdge edge = {(uint8_t)(uintptr_t)arg, millis()};
+    BaseType_t woken = pdFALSE;
+
+    edgeCount++;
+    if (xQueueSendFromISR(buttonEdges, &edge, &woken) != pdTRUE)
+    {
+        edgeDropped++;
+    }
+    if (woken)
+    {
+        portYIELD_FROM_ISR();
+    }
+}
+
+/// @brief Input task, debounces the edges from the interrupt and turns them into clicks and long presses.
+/// Sleeps until an edge arrives or a debounce or long press time is up.
+void Buttons::task(void *parameter)
+{
+    ButtonEdge edge;
+
+    while (true)
+    {
+        // Work out how long until a button needs looking at again
+        unsigned long now = millis();
+        TickType_t wait = portMAX_DELAY;
+
+        for (int i = 0; i < BUTTON_COUNT; i++)
+        {
+            ButtonState *state = &buttonStates[i];
+            long due;
+
+            if (state->settling)
+            {
+                due = (long)(state->changed + BUTTON_DEBOUNCE - now);
+            }
+            else if (state->pressed && !state->held && longPressHandlers[i])
+            {
+                due = (long)(state->down + BUTTON_LONG_PRESS - now);
+            }
+            else
+            {
+                continue;
+            }
+
+            if (due < 0)
+            {
+                due = 0;
+            }
+            if (pdMS_TO_TICKS(due) < wait)
+            {
+                wait = pdMS_TO_TICKS(due);
+            }
+        }
+
+        // Any edge restarts the debounce time of its button
+        if (xQueueReceive(buttonEdges, &edge, wait) == pdTRUE)
+        {
+            buttonStates[edge.button].settling = true;
+            buttonStates[edge.button].changed = edge.time;
+            continue;
+        }
+
+        now = millis();
+        for (int i = 0; i < BUTTON_COUNT; i++)
+        {
+            ButtonState *state = &buttonStates[i];
+
+            if (state->settling && now - state->changed >= BUTTON_DEBOUNCE)
+            {
+                bool pressed = digitalRead(button_pins[i]) == LOW;
+                state->settling = false;
+
+                if (pressed && !state->pressed)
+                {
+                    state->pressed = true;
+                    state->held = false;
+                    state->down = state->changed;
+                }
+                else if (!pressed && state->pressed)
+                {
+                    // Click on release, unless it was already a long press
+                    state->pressed = false;
+                    if (!state->held)
+                    {
+                        InputEvent event = {INPUT_BUTTON, (uint8_t)i, state->down};
+                        Input::post(event);
+                    }
+                }
+            }
+
+            if (state->pressed && !state->held && longPressHandlers[i] && now - state->down >= BUTTON_LONG_PRESS)
+            {
+                state->held = true;
+                longPressHandlers[i]();
+            }
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,136 @@
+#include <ozsec/console.hpp>
+
+ConsoleOutput Console;
+TaskHandle_t ConsoleTask;
+
+/// @brief Create the output buffer and start the console task on core 0.
+/// Call right after Serial.begin(), output before this goes straight to Serial.
+void ConsoleOutput::init()
+{
+    policy = CONSOLE_POLICY;
+    cut = false;
+    lock = xSemaphoreCreateMutex();
+    buffer = xStreamBufferCreate(CONSOLE_BUFFER, 1);
+
+    // Run beside the lights on core 0, waiting on a slow host only holds up this task
+    xTaskCreatePinnedToCore(
+        ConsoleOutput::task, /* Function to run the task */
+        "ConsoleTask",       /* Name of the task */
+        CONSOLE_TASK_STACK,  /* Stack size in words */
+        NULL,                /* Task input parameter */
+        1,                   /* Priority of the task */
+        &ConsoleTask,        /* Task handle. */
+        0);                  /* Core where the task should run */
+}
+
+/// @brief Put output in the buffer for the console task.
+size_t ConsoleOutput::send(const uint8_t *data, size_t length, TickType_t timeout)
+{
+    return xStreamBufferSend(buffer, data, length, timeout);
+}
+
+size_t ConsoleOutput::write(uint8_t c)
+{
+    return write(&c, 1);
+}
+
+/// @brief Queue output for the host, following the policy when the buffer is full.
+/// @return Bytes queued, the rest was dropped
+size_t ConsoleOutput::write(const uint8_t *data, size_t length)
+{
+    size_t reserve = policy == CONSOLE_DROP ? 0 : strlen(CONSOLE_MARKER); // Room always left for the marker
+    size_t sent = 0;
+
+    if (buffer == NULL)
+    {
+        return Serial.write(data, length);
+    }
+
+    xSemaphoreTake(lock, portMAX_DELAY);
+
+    // After a cut, wait for the host to catch up before printing more
+    if (cut && xStreamBufferSpacesAvailable(buffer) >= CONSOLE_BUFFER / 2)
+    {
+        cut = false;
+    }
+
+    if (!cut)
+    {
+        if (policy == CONSOLE_BLOCK && xStreamBufferSpacesAvailable(buffer) < length + reserve)
+        {
+            unsigned long start = millis();
+            unsigned long startUs = micros();
+            while (xStreamBufferSpacesAvailable(buffer) < length + reserve && millis() - start < CONSOLE_BLOCK_TIMEOUT)
+            {
+                vTaskDelay(1);
+            }
+            blockedTime += micros() - startUs;
+        }
+
+        size_t space = xStreamBufferSpacesAvailable(buffer);
+        if (space >= length + reserve)
+        {
+            sent = send(data, length, 0);
+        }
+        else if (policy != CONSOLE_DROP && space >= reserve)
+        {
+            // Print what fits, then the marker so the reader knows output is missing
+            sent = send(data, space - reserve, 0);
+            send((const uint8_t *)CONSOLE_MARKER, reserve, 0);
+            cut = true;
+        }
+    }
+
+    queued += sent;
+    dropped += length - sent;
+    xSemaphoreGive(lock);
+    return sent;
+}
+
+/// @brief Room left in the buffer
+int ConsoleOutput::availableForWrite()
+{
+    return buffer == NULL ? Serial.availableForWrite() : xStreamBufferSpacesAvailable(buffer);
+}
+
+/// @brief Wait until the console task took all buffered output, at most CONSOLE_BLOCK_TIMEOUT.
+/// Use before a restart so the last messages are seen.
+void ConsoleOutput::flush()
+{
+    unsigned long start = millis();
+
+    while (buffer != NULL && !xStreamBufferIsEmpty(buffer) && millis() - start < CONSOLE_BLOCK_TIMEOUT)
+    {
+        vTaskDelay(1);
+    }
+}
+
+/// @brief Hand the next buffered output to the serial port, retrying until the host took all of it.
+/// @param timeout Time in ticks to wait for output
+/// @return Bytes written
+size_t ConsoleOutput::drain(TickType_t timeout)
+{
+    uint8_t chunk[CONSOLE_CHUNK];
+    size_t length = xStreamBufferReceive(buffer, chunk, sizeof(chunk), timeout);
+    size_t written = 0;
+
+    while (written < length)
+    {
+        size_t count = Serial.write(chunk + written, length - written);
+        if (count == 0)
+        {
+            vTaskDelay(pdMS_TO_TICKS(CONSOLE_RETRY));
+        }
+        written += count;
+    }
+    return written;
+}
+
+/// @brief Console task, writes buffered output to the serial port as the host reads it.
+void ConsoleOutput::task(void *parameter)
+{
+    while (true)
+    {
+        Console.drain(portMAX_DELAY);
+    }
+}
\ No newline at end of file
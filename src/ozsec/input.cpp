@@ -0,0 +1,77 @@
+#include <ozsec/input.hpp>
+
+QueueHandle_t inputEvents;  // Input from the serial port and buttons to the game loop
+volatile bool serialPending; // A serial event is already waiting in the queue
+bool serialCallback;         // The serial port wakes the game loop itself, no polling needed
+
+uint64_t Input::waitTime;
+
+/// @brief Create the input queue and hook up the serial receive callback.
+/// Call after Serial.begin() and before Buttons::init().
+void Input::init()
+{
+    inputEvents = xQueueCreate(INPUT_QUEUE_LENGTH, sizeof(InputEvent));
+    serialPending = false;
+
+#if ARDUINO_USB_CDC_ON_BOOT && ARDUINO_USB_MODE
+    // USB serial on the ESP32-S3 built-in USB port
+    Serial.onEvent(ARDUINO_HW_CDC_RX_EVENT, Input::serialReceived);
+    serialCallback = true;
+#else
+    serialCallback = false;
+#endif
+}
+
+/// @brief Queue input for the game loop. Input is dropped if the game loop is far behind.
+void Input::post(const InputEvent &event)
+{
+    xQueueSend(inputEvents, &event, 0);
+}
+
+/// @brief Wait for the next input for the game loop.
+/// @param event Set to the input received
+/// @param timeout Time in ticks to wait, 0 only checks for input already waiting
+/// @return true if there was input, false on timeout
+bool Input::wait(InputEvent *event, TickType_t timeout)
+{
+    unsigned long start = micros();
+    bool received;
+
+    // Without a receive callback, check the serial port every so often instead
+    if (!serialCallback && timeout > pdMS_TO_TICKS(INPUT_POLL_PERIOD))
+    {
+        timeout = pdMS_TO_TICKS(INPUT_POLL_PERIOD);
+    }
+
+    received = xQueueReceive(inputEvents, event, timeout) == pdTRUE;
+    if (received && event->source == INPUT_SERIAL)
+    {
+        // Serial data is read after this, so any data arriving from now on needs a new event
+        serialPending = false;
+    }
+
+    waitTime += micros() - start;
+    return received;
+}
+
+/// @brief Sleep the game loop without taking any input, input keeps queueing until the next Input::wait()
+/// @param timeout Time in ticks to sleep
+void Input::sleep(TickType_t timeout)
+{
+    unsigned long start = micros();
+
+    vTaskDelay(timeout);
+
+    waitTime += micros() - start;
+}
+
+/// @brief Serial receive callback, wakes the game loop once per batch of received data
+void Input::serialReceived(void *arg, esp_event_base_t base, int32_t id, void *data)
+{
+    if (!serialPending)
+    {
+        InputEvent event = {INPUT_SERIAL, 0, millis()};
+        serialPending = true;
+        post(event);
+    }
+}
\ No newline at end of file
@@ -1,272 +1,490 @@
 #include <ozsec/lights.hpp>
+#include <ozsec/patterns.hpp>
+#include <ozsec/gamma.hpp>
+
+static_assert(LED_GAMMA_BITS == LED_PWM_BITS, "Regenerate gamma.hpp with tools/gamma.py after changing LED_PWM_BITS");
+static_assert(LED_GAMMA_LEVELS == LED_MAX_BRIGHTNESS + 1, "The gamma table needs an entry for every LED level");
+static_assert(SIMPLE_NUM_LEDS - 1 <= 8, "The map LEDs after the first need one of the 8 LEDC channels each");
 
 struct CRGB leds[STRIP_NUM_LEDS];
 int ledTwinkleMode;
 
-// Array to keep track of the status of the map LEDs
+// Arrays to keep track of the status and fade state of the map LEDs
 int Lights::ledStatus[SIMPLE_NUM_LEDS];
+int Lights::ledLevel[SIMPLE_NUM_LEDS];
+int Lights::ledFadeTime[SIMPLE_NUM_LEDS];
+unsigned long Lights::ledLastStep[SIMPLE_NUM_LEDS];
 bool ledFadingDirection[SIMPLE_NUM_LEDS];
+unsigned long ledStepCarry[SIMPLE_NUM_LEDS]; // Time since the last fade step not yet used for a step, in ms * LED_MAX_BRIGHTNESS
+uint16_t ledDuty[SIMPLE_NUM_LEDS]; // LEDC duty last written to each LED
+
+// Animation frame counters
+unsigned long Lights::frameCount;
+unsigned long Lights::frameOverruns;
+uint64_t Lights::frameBusy;
+unsigned long Lights::dutyWrites;
+unsigned long Lights::stripShows;
+unsigned long Lights::stripSkips;
+
+// RGB strip frame, setters change the pending frame and Lights::stripCommit() shows it
+CRGB stripPending;
+uint8_t stripPendingBrightness;
+CRGB stripShown;
+uint8_t stripShownBrightness;
+bool stripDirty;
+SemaphoreHandle_t stripLock; // Held while the strip frame is changed or shown, the game and background loop both use it
 
 /// @brief Setup the LED pins and RGB strip as needed
 void Lights::init()
 {
-    // Setup simple LEDs
-    for (int i = 0; i < SIMPLE_NUM_LEDS; i++)
+    // Setup simple LEDs, the model 2023 LED is a plain on/off LED and the rest get their own LEDC channel
+    pinMode(all_leds[0], OUTPUT);
+    for (int i = 1; i < SIMPLE_NUM_LEDS; i++)
     {
-        pinMode(all_leds[i], OUTPUT);
+        ledcSetup(i - 1, LED_PWM_FREQ, LED_PWM_BITS);
+        ledcAttachPin(all_leds[i], i - 1);
     }
 
     // Setup RGB strip
     FastLED.addLeds<WS2812B, STRIP_DATA_PIN, GRB>(leds, STRIP_NUM_LEDS);
     FastLED.setBrightness(64);
+    stripPending = stripShown = CRGB(0, 0, 0);
+    stripPendingBrightness = stripShownBrightness = 64;
+    stripDirty = false;
+    stripLock = xSemaphoreCreateMutex();
 
     // Default ledStatus to false/off
     for (int i = 0; i < SIMPLE_NUM_LEDS; i++)
     {
         ledStatus[i] = 0;
+        ledLevel[i] = 0;
+        ledFadeTime[i] = LED_FADE_TIME;
+        ledLastStep[i] = 0;
+        ledStepCarry[i] = 0;
+        ledDuty[i] = 0;
         ledFadingDirection[i] = true;
     }
 
     ledTwinkleMode = 1;
 }
 
-// Get the known status of the specified LED pin
-int Lights::getLedStatus(int led)
+/// @brief Advance every fading LED towards its target brightness.
+/// Called periodically from the background loop, a full fade takes the LED's fade time.
+/// @param now Current time in ms
+void Lights::tick(unsigned long now)
 {
-    int ledIndex;
-
-    ledIndex = getLedIndex(led);
-    if (ledIndex != -1)
+    for (int i = 0; i < SIMPLE_NUM_LEDS; i++)
     {
-        return ledStatus[ledIndex];
+        if (ledLevel[i] == ledStatus[i])
+        {
+            continue;
+        }
+
+        // Catch up on any steps missed since the last tick, the part of a step left over counts towards the next one
+        unsigned long elapsed = (now - ledLastStep[i]) * LED_MAX_BRIGHTNESS + ledStepCarry[i];
+        unsigned long steps = elapsed / ledFadeTime[i];
+        ledStepCarry[i] = elapsed % ledFadeTime[i];
+        ledLastStep[i] = now;
+        if (steps == 0)
+        {
+            continue;
+        }
+
+        int distance = abs(ledStatus[i] - ledLevel[i]);
+        if (steps > (unsigned long)distance)
+        {
+            steps = distance;
+        }
+
+        if (ledLevel[i] < ledStatus[i])
+        {
+            ledLevel[i] += steps;
+        }
+        else
+        {
+            ledLevel[i] -= steps;
+        }
+        ledOutput(i, ledLevel[i]);
     }
-    else
+}
+
+// Get the known status of the specified LED channel
+int Lights::getLedStatus(int channel)
+{
+    if (channel < 0 || channel >= SIMPLE_NUM_LEDS)
     {
         return 0;
     }
+    return ledStatus[channel];
+}
+
+// Function to set the LED status, the LED is not faded
+void Lights::setLedStatus(int channel, int status)
+{
+    if (channel >= 0 && channel < SIMPLE_NUM_LEDS)
+    {
+        ledStatus[channel] = status; // Update the status
+        ledLevel[channel] = status;
+    }
 }
 
-// Function to set the LED status
-void Lights::setLedStatus(int led, int status)
+/// @brief Start fading the specified LED channel to a brightness. Returns immediately, Lights::tick() does the fading.
+/// @param channel
+/// @param brightness
+/// @param fadeTime Time in ms a fade from fully off to fully on would take
+void Lights::ledFade(int channel, int brightness, int fadeTime)
 {
-    int index = getLedIndex(led); // Get the index corresponding to the pin number
-    if (index != -1)
+    if (channel < 0 || channel >= SIMPLE_NUM_LEDS || ledStatus[channel] == brightness)
+    {
+        return;
+    }
+
+    // Restart the step timer if the LED was idle, otherwise keep the fade going smoothly
+    if (ledLevel[channel] == ledStatus[channel])
     {
-        ledStatus[index] = status; // Update the status
+        ledLastStep[channel] = millis();
+        ledStepCarry[channel] = 0;
     }
+    ledFadeTime[channel] = fadeTime > 0 ? fadeTime : 1;
+    ledStatus[channel] = brightness;
 }
 
-/// @brief Get the index of specified LED pin
-int Lights::getLedIndex(int led)
+/// @brief Check if the specified LED channel is still fading towards its target
+bool Lights::isFading(int channel)
+{
+    if (channel < 0 || channel >= SIMPLE_NUM_LEDS)
+    {
+        return false;
+    }
+    return ledLevel[channel] != ledStatus[channel];
+}
+
+/// @brief Check if all LEDs have finished fading
+bool Lights::isIdle()
 {
     for (int i = 0; i < SIMPLE_NUM_LEDS; i++)
     {
-        if (all_leds[i] == led)
+        if (ledLevel[i] != ledStatus[i])
         {
-            return i; // Return the index corresponding to the pin number
+            return false;
         }
     }
-    return -1; // Return -1 if the pin is not found
+    return true;
 }
 
-/// @brief Turn on the specified LED pin
-/// @param led
-void Lights::ledOn(int led, bool fade = true)
+/// @brief Turn on the specified LED channel
+/// @param channel
+void Lights::ledOn(int channel, bool fade = true)
 {
     if (fade)
     {
-        // If the LED is already on, don't do anything
-        // Otherwise the LED would be turned off abruptly then faded back on
-        if (getLedStatus(led))
-            return;
-
-        // Fade LED from off to max brightness
-        for (int i = 0; i <= LED_MAX_BRIGHTNESS; i++)
-        {
-            analogWrite(led, i);
-            delay(LED_FADE_DELAY);
-        }
+        // Fade LED from its current brightness to max brightness
+        ledFade(channel, LED_MAX_BRIGHTNESS, LED_FADE_TIME);
     }
-    else
+    else if (channel >= 0 && channel < SIMPLE_NUM_LEDS)
     {
         // Turn on the LED fully
-        analogWrite(led, LED_MAX_BRIGHTNESS);
+        ledOutput(channel, LED_MAX_BRIGHTNESS);
+        setLedStatus(channel, LED_MAX_BRIGHTNESS);
     }
-    setLedStatus(led, true);
 }
 
-/// @brief Turn off the specified LED pin
-/// @param led
-void Lights::ledOff(int led, bool fade = true)
+/// @brief Turn off the specified LED channel
+/// @param channel
+void Lights::ledOff(int channel, bool fade = true)
 {
     if (fade)
     {
-        // If the LED is already off, don't do anything
-        // Otherwise the LED would be turned on fully then faded off
-        if (getLedStatus(led) == false)
-            return;
-
-        // Fade LED from max brightness to off
-        for (int i = LED_MAX_BRIGHTNESS; i >= 0; i--)
-        {
-            analogWrite(led, i);
-            delay(LED_FADE_DELAY);
-        }
+        // Fade LED from its current brightness to off
+        ledFade(channel, 0, LED_FADE_TIME);
     }
-    else
+    else if (channel >= 0 && channel < SIMPLE_NUM_LEDS)
     {
         // Turn off the LED fully
-        analogWrite(led, 0);
+        ledOutput(channel, 0);
+        setLedStatus(channel, 0);
     }
-    setLedStatus(led, false);
 }
 
-/// @brief Turn on the RGB strip with a specific color
+/// @brief Turn on the RGB strip with a specific color, shown on the next Lights::stripCommit()
 /// @param color
 void Lights::stripOn(CRGB color, int brightness = 64)
 {
-    FastLED.setBrightness(brightness);
-    leds[0] = color;
-    FastLED.show();
+    xSemaphoreTake(stripLock, portMAX_DELAY);
+    stripPending = color;
+    stripPendingBrightness = brightness;
+    stripDirty = true;
+    xSemaphoreGive(stripLock);
+}
+
+/// @brief Set the RGB color without changing the brightness, shown on the next Lights::stripCommit()
+void Lights::stripColor(CRGB color)
+{
+    xSemaphoreTake(stripLock, portMAX_DELAY);
+    stripPending = color;
+    stripDirty = true;
+    xSemaphoreGive(stripLock);
 }
 
-/// @brief Turn off the RGB
+/// @brief Turn off the RGB, shown on the next Lights::stripCommit()
 void Lights::stripOff()
 {
-    leds[0] = CRGB(0, 0, 0);
-    FastLED.show();
+    stripColor(CRGB(0, 0, 0));
 }
 
-/// @brief Set the RGB brightness without changing the color
+/// @brief Set the RGB brightness without changing the color, shown on the next Lights::stripCommit()
 void Lights::stripBrightness(int brightness)
 {
-    FastLED.setBrightness(brightness);
-    FastLED.show();
+    xSemaphoreTake(stripLock, portMAX_DELAY);
+    stripPendingBrightness = brightness;
+    stripDirty = true;
+    xSemaphoreGive(stripLock);
+}
+
+/// @brief Turn on the RGB strip with a specific color and show it right away.
+/// For code that blocks the background loop, like the firmware update.
+void Lights::stripShow(CRGB color, int brightness)
+{
+    stripOn(color, brightness);
+    stripCommit();
+}
+
+/// @brief Push the pending RGB frame to the strip, only if the color or brightness changed since the last show.
+/// Called once per animation frame.
+void Lights::stripCommit()
+{
+    xSemaphoreTake(stripLock, portMAX_DELAY);
+    if (stripDirty)
+    {
+        if (stripPending != stripShown || stripPendingBrightness != stripShownBrightness)
+        {
+            leds[0] = stripPending;
+            FastLED.setBrightness(stripPendingBrightness);
+            FastLED.show();
+            stripShown = stripPending;
+            stripShownBrightness = stripPendingBrightness;
+            stripShows++;
+        }
+        else
+        {
+            stripSkips++;
+        }
+        stripDirty = false;
+    }
+    xSemaphoreGive(stripLock);
 }
 
-void Lights::heartbeat()
+/// @brief Run one animation frame of the current twinkle mode and advance any fades.
+/// Called by the background task once every LED_FRAME_PERIOD ms.
+/// @param now Current time in ms
+void Lights::frame(unsigned long now)
 {
-    int i, j;
-    int ledArray[8] = {7,8,1,4,2,6,3,5};
-    int rgbBrightness;
-    //heartbeat
-    for (i = 0; i < (64+32); i++)
+    unsigned long start = micros();
+
+    twinkle(now);
+    tick(now);
+    stripCommit();
+
+    unsigned long busy = micros() - start;
+    frameBusy += busy;
+    frameCount++;
+    if (busy > LED_FRAME_BUDGET)
     {
-        Lights::stripBrightness(i);
-        rgbBrightness = i;
-        delay(1);
+        frameOverruns++;
     }
-    for (i = 0; i < 8; i++)
+}
+
+/// @brief Write a brightness to the specified LED channel, skipping the write if it is unchanged.
+void Lights::ledWrite(int channel, int level)
+{
+    if (ledLevel[channel] != level || ledStatus[channel] != level)
     {
-        for (j = 0; j < 10; j++)
+        ledOutput(channel, level);
+        setLedStatus(channel, level);
+    }
+}
+
+/// @brief Drive the specified LED channel at a level through the board's gamma table.
+/// Levels that map to the duty already on the pin are not written again.
+void Lights::ledOutput(int channel, int level)
+{
+    // Model 2023 badge, a plain on/off LED
+    if (channel == 0)
+    {
+        digitalWrite(all_leds[0], level > 0 ? HIGH : LOW);
+        return;
+    }
+
+    uint16_t duty = ledGamma[constrain(level, 0, LED_MAX_BRIGHTNESS)];
+    if (duty != ledDuty[channel])
+    {
+        ledcWrite(channel - 1, duty);
+        ledDuty[channel] = duty;
+        dutyWrites++;
+    }
+}
+
+/// @brief Play one frame of a keyframe pattern.
+/// @param pattern
+/// @param now Current time in ms
+void Lights::play(const Pattern &pattern, unsigned long now)
+{
+    unsigned long t = now % pattern.duration;
+    int i = 0;
+
+    // Hold the last frame once all loops have played
+    if (t < (unsigned long)pattern.loops * pattern.period)
+    {
+        t = t % pattern.period;
+    }
+    else
+    {
+        t = pattern.period - 1;
+    }
+
+    while (i < pattern.count)
+    {
+        uint8_t channel = pattern.keyframes[i].channel;
+        const Keyframe *from = &pattern.keyframes[i];
+        const Keyframe *to = NULL;
+
+        // Find the keyframes either side of t for this channel
+        for (; i < pattern.count && pattern.keyframes[i].channel == channel; i++)
+        {
+            if (pattern.keyframes[i].time <= t)
+            {
+                from = &pattern.keyframes[i];
+            }
+            else if (to == NULL)
+            {
+                to = &pattern.keyframes[i];
+            }
+        }
+
+        long brightness = from->brightness;
+        if (to != NULL && from->time <= t)
         {
-            if (i == 0)
+            long delta = to->brightness - from->brightness;
+            long span = to->time - from->time;
+            long elapsed = t - from->time;
+
+            switch (to->easing)
             {
-                if (rgbBrightness > 64)
-                {
-                    rgbBrightness -= 3;
-                    Lights::stripBrightness(rgbBrightness);
-                }
+            case EASE_LINEAR:
+                brightness += delta * elapsed / span;
+                break;
+            case EASE_IN:
+                brightness += delta * elapsed * elapsed / (span * span);
+                break;
+            case EASE_OUT:
+                brightness = to->brightness - delta * (span - elapsed) * (span - elapsed) / (span * span);
+                break;
+            default:
+                break;
             }
-            analogWrite(all_leds[ledArray[i]], j);
-            delay(1);
+        }
+
+        if (channel == PATTERN_STRIP)
+        {
+            stripBrightness(brightness);
+        }
+        else if (channel < SIMPLE_NUM_LEDS)
+        {
+            ledWrite(channel, brightness * LED_MAX_BRIGHTNESS / 255);
         }
     }
-    // fade out
-    for (i = rgbBrightness; i >= 0; i--)
+}
+
+/// @brief Twinkle animation frame, moves one random LED a step brighter or dimmer.
+void Lights::twinkleStep()
+{
+    int ledIndex = random(1, SIMPLE_NUM_LEDS);
+    int ledStatus = getLedStatus(ledIndex);
+
+    if (ledFadingDirection[ledIndex] == true)
     {
-        Lights::stripBrightness(i);
-        delay(1);
+        if (ledStatus < LED_MAX_BRIGHTNESS)
+        {
+            ledWrite(ledIndex, min(ledStatus + LED_TWINKLE_STEP, LED_MAX_BRIGHTNESS));
+        }
+        else
+        {
+            ledFadingDirection[ledIndex] = false;
+        }
     }
-    rgbBrightness = 0;
-    for (i = 0; i < 8; i++)
+    else
     {
-        for (j = 10; j >= 0; j--)
+        if (ledStatus > 0)
+        {
+            ledWrite(ledIndex, max(ledStatus - LED_TWINKLE_STEP, 0));
+        }
+        else
         {
-            analogWrite(all_leds[ledArray[i]], j);
+            ledFadingDirection[ledIndex] = true;
         }
     }
 }
 
-/// @brief Twinkle the front LEDs randomly
-void Lights::twinkle()
+/// @brief Twinkle animation frame, randomly fades idle LEDs on or off.
+void Lights::twinkleRandom()
 {
-    int led;
-    int ledIndex;
-    int ledStatus;
+    // Each idle LED has a 1/4 chance of changing once per fade duration
+    const long chance = 4L * LED_FADE_TIME / LED_FRAME_PERIOD;
 
-    switch (ledTwinkleMode)
+    for (int ledIndex = 1; ledIndex < SIMPLE_NUM_LEDS; ledIndex++)
     {
-        case 2:
+        // Let a running fade finish before changing it again
+        if (isFading(ledIndex))
+            continue;
+
+        if (random(0, chance) == 0)
         {
-            ledIndex = random(0, SIMPLE_NUM_LEDS) + 1;
-            led = all_leds[ledIndex];
-            ledStatus = getLedStatus(led);
-            if (ledFadingDirection[ledIndex] == true)
+            if (getLedStatus(ledIndex))
             {
-                if (ledStatus < LED_MAX_BRIGHTNESS)
-                {
-                    analogWrite(led, ledStatus+1);
-                    setLedStatus(led, ledStatus+1);
-                }
-                else
-                {
-                    ledFadingDirection[ledIndex] = false;
-                    delay(LED_FADE_DELAY);
-                }
+                ledOff(ledIndex);
             }
             else
             {
-                if (ledStatus > 0)
-                {
-                    analogWrite(led, ledStatus-1);
-                    setLedStatus(led, ledStatus-1);
-                }
-                else
-                {
-                    ledFadingDirection[ledIndex] = true;
-                    delay(LED_FADE_DELAY);
-                }
+                ledOn(ledIndex);
             }
-            break;
-        }
-        case 3:
-        {
-            Lights::heartbeat();
-            delay(1);
-            Lights::heartbeat();
-            delay(500);
-            break;
         }
-        default:
+    }
+}
+
+// Twinkle modes, either a generator run every frame or a keyframe pattern
+struct TwinkleMode
+{
+    int mode;
+    void (*generator)();
+    const Pattern *pattern;
+};
+
+const TwinkleMode twinkleModes[] = {
+    {1, Lights::twinkleRandom, NULL},
+    {2, Lights::twinkleStep, NULL},
+    {3, NULL, &heartbeatPattern}};
+
+/// @brief Twinkle the front LEDs using the current twinkle mode
+/// @param now Current time in ms
+void Lights::twinkle(unsigned long now)
+{
+    // Unknown modes fall back to the first one
+    const TwinkleMode *twinkleMode = &twinkleModes[0];
+
+    for (size_t i = 0; i < sizeof(twinkleModes) / sizeof(twinkleModes[0]); i++)
+    {
+        if (twinkleModes[i].mode == ledTwinkleMode)
         {
-            for (ledIndex = 1; ledIndex <= SIMPLE_NUM_LEDS; ledIndex++)
-            {
-                // 1/4 chance of changing
-                if (random(0, 4) == 1)
-                {
-                    led = all_leds[ledIndex];
-                    if (getLedStatus(led))
-                    {
-                        ledOff(led);
-                    }
-                    else
-                    {
-                        ledOn(led);
-                    }
-                    delay(LED_FADE_DELAY);
-                }
-            }
-            break;
+            twinkleMode = &twinkleModes[i];
         }
     }
 
-    // Randomly change the color of the RGB strip
-    // uint8_t red = random(256);
-    // uint8_t green = random(256);
-    // uint8_t blue = random(256);
-
-    // leds[0] = CRGB(red, green, blue);
-    // FastLED.setBrightness(5);
-    // FastLED.show();
+    if (twinkleMode->pattern != NULL)
+    {
+        play(*twinkleMode->pattern, now);
+    }
+    else
+    {
+        twinkleMode->generator();
+    }
 }
\ No newline at end of file
@@ -0,0 +1,99 @@
+#include <ozsec/notebook.hpp>
+#include <ozsec/storage.hpp>
+
+extern Preferences preferences;
+
+char notebookKeys[NOTEBOOK_ENTRIES][4]; // Preferences key of each slot, "n0" and up
+uint32_t notebookNext;                  // Sequence of the next entry
+
+/// @brief Find the newest notebook entry.
+/// Call when the game loads with no writes queued, before adding or printing entries.
+void Notebook::load()
+{
+    NotebookEntry entry;
+    size_t length;
+
+    static_assert(NOTEBOOK_ENTRIES <= 100, "Notebook keys only have room for two digits");
+    for (int i = 0; i < NOTEBOOK_ENTRIES; i++)
+    {
+        snprintf(notebookKeys[i], sizeof(notebookKeys[i]), "n%d", i);
+    }
+
+    notebookNext = 1;
+    preferences.begin(NOTEBOOK_NAMESPACE, true);
+    for (int i = 0; i < NOTEBOOK_ENTRIES; i++)
+    {
+        length = preferences.getBytes(notebookKeys[i], &entry, sizeof(entry));
+        if (length >= sizeof(entry.sequence) && entry.sequence >= notebookNext)
+        {
+            notebookNext = entry.sequence + 1;
+        }
+    }
+    preferences.end();
+}
+
+/// @brief Add an entry to the notebook, replacing the oldest entry once the notebook is full.
+/// The entry is queued for the storage task, only its own slot is written.
+/// @return false if the entry could not be queued, the next entry takes its place then
+bool Notebook::add(const String &text)
+{
+    size_t length = min(text.length(), (unsigned int)NOTEBOOK_ENTRY_LENGTH);
+    NotebookEntry *entry = (NotebookEntry *)malloc(sizeof(entry->sequence) + length);
+
+    if (entry == NULL)
+    {
+        return false;
+    }
+    entry->sequence = notebookNext;
+    memcpy(entry->text, text.c_str(), length);
+
+    if (!Storage::putBytes(NOTEBOOK_NAMESPACE, notebookKeys[(entry->sequence - 1) % NOTEBOOK_ENTRIES], (uint8_t *)entry, sizeof(entry->sequence) + length))
+    {
+        return false;
+    }
+    notebookNext++;
+    return true;
+}
+
+/// @brief Read one notebook entry, preferences must be open on NOTEBOOK_NAMESPACE.
+/// @param length Set to the length of the text
+/// @return false if the entry was replaced or never written
+bool readEntry(uint32_t sequence, NotebookEntry *entry, size_t *length)
+{
+    *length = preferences.getBytes(notebookKeys[(sequence - 1) % NOTEBOOK_ENTRIES], entry, sizeof(*entry));
+    if (*length < sizeof(entry->sequence) || entry->sequence != sequence)
+    {
+        return false;
+    }
+    *length -= sizeof(entry->sequence);
+    return true;
+}
+
+/// @brief Print every notebook entry, oldest first, one line each.
+void Notebook::print(Print &out)
+{
+    NotebookEntry entry;
+    size_t length;
+    uint32_t first = notebookNext > NOTEBOOK_ENTRIES ? notebookNext - NOTEBOOK_ENTRIES : 1;
+
+    // Entries added just before may still be waiting for the storage task
+    Storage::sync();
+    preferences.begin(NOTEBOOK_NAMESPACE, true);
+    for (uint32_t sequence = first; sequence < notebookNext; sequence++)
+    {
+        if (readEntry(sequence, &entry, &length))
+        {
+            out.write((const uint8_t *)entry.text, length);
+            out.println();
+        }
+    }
+    preferences.end();
+}
+
+/// @brief Remove every notebook entry, waiting until they are gone.
+/// @return true if the notebook was cleared
+bool Notebook::clear()
+{
+    notebookNext = 1;
+    return Storage::clear(NOTEBOOK_NAMESPACE);
+}
\ No newline at end of file
@@ -0,0 +1,44 @@
+#include <ozsec/quests.hpp>
+
+std::atomic<uint32_t> Quests::sequence(0);
+std::atomic<uint32_t> Quests::low(0);
+std::atomic<uint32_t> Quests::high(0);
+unsigned long Quests::reads;
+unsigned long Quests::retries;
+
+/// @brief Publish the quest flags for readers on the other core. Only call from the game loop.
+void Quests::publish(uint64_t bits)
+{
+    uint32_t start = sequence.load(std::memory_order_relaxed);
+
+    sequence.store(start + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    low.store((uint32_t)bits, std::memory_order_relaxed);
+    high.store((uint32_t)(bits >> 32), std::memory_order_relaxed);
+    sequence.store(start + 2, std::memory_order_release);
+}
+
+/// @brief Read the last published quest flags, from any core.
+/// @return Quest flags, test them with questMask()
+uint64_t Quests::snapshot()
+{
+    uint32_t start;
+    uint32_t lowBits;
+    uint32_t highBits;
+
+    reads++;
+    while (true)
+    {
+        start = sequence.load(std::memory_order_acquire);
+        lowBits = low.load(std::memory_order_relaxed);
+        highBits = high.load(std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (!(start & 1) && sequence.load(std::memory_order_relaxed) == start)
+        {
+            break;
+        }
+        retries++;
+    }
+
+    return (uint64_t)highBits << 32 | lowBits;
+}
\ No newline at end of file
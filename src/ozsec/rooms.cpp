@@ -0,0 +1,228 @@
+#include <ozsec/rooms.hpp>
+#include <ozsec/roomdata.hpp>
+#include <ozsec/wrap.hpp>
+
+/// @brief Get the packed record of a room
+/// @return NULL if there is no room with this id
+const RoomRecord *roomRecord(int id)
+{
+    if (id < 0 || id >= ROOM_ID_COUNT || roomSlots[id] == ROOM_NONE)
+    {
+        return NULL;
+    }
+    return &roomRecords[roomSlots[id]];
+}
+
+/// @brief Check if a room id has a room
+bool Rooms::exists(int id)
+{
+    return roomRecord(id) != NULL;
+}
+
+/// @brief Get the number of room ids, rooms are 0 to this minus one
+int Rooms::idCount()
+{
+    return ROOM_ID_COUNT;
+}
+
+/// @brief Get the title of a room
+/// @return Empty text if there is no room
+RoomText Rooms::title(int id)
+{
+    const RoomRecord *room = roomRecord(id);
+    return RoomText(room == NULL ? NULL : roomText + room->text);
+}
+
+/// @brief Get the description of a room
+/// @return Empty text if there is no room
+RoomText Rooms::description(int id)
+{
+    const RoomRecord *room = roomRecord(id);
+    return RoomText(room == NULL ? NULL : roomText + room->text + room->description);
+}
+
+/// @brief Get the actions of a room, one "[option] text" line each
+/// @return Empty text if there is no room
+RoomText Rooms::actions(int id)
+{
+    const RoomRecord *room = roomRecord(id);
+    return RoomText(room == NULL ? NULL : roomText + room->text + room->actions);
+}
+
+/// @brief Print the description of a room wrapped to a width.
+/// At ROOM_WRAP_WIDTH the line breaks worked out by tools/rooms.py are used, other widths are wrapped while printing.
+void Rooms::printDescription(int id, Print &out, int width)
+{
+    const RoomRecord *room = roomRecord(id);
+    TextWrap wrap(out, width);
+
+    if (room == NULL || width != ROOM_WRAP_WIDTH)
+    {
+        wrap.print(description(id));
+        return;
+    }
+    wrap.printLines(description(id), roomBreaks + room->breaks);
+}
+
+/// @brief Start decoding room text
+/// @param data First coded byte of the text, or NULL for empty text
+RoomText::RoomText(const uint8_t *data) : data(data), bit(0x80), next(-2)
+{
+}
+
+/// @brief Decode the next byte of the text.
+/// Walks the canonical code one bit at a time, at most ROOM_CODE_BITS steps per byte.
+/// @return The byte, or -1 at the end of the text
+int RoomText::read()
+{
+    int code = 0;  // Bits read so far
+    int first = 0; // First code of the current length
+    int index = 0; // Index in roomCodeSymbols of the first code of the current length
+
+    if (next != -2)
+    {
+        int c = next;
+        next = -2;
+        return c;
+    }
+    if (data == NULL)
+    {
+        return -1;
+    }
+
+    for (int length = 1; length <= ROOM_CODE_BITS; length++)
+    {
+        code |= (*data & bit) ? 1 : 0;
+        bit >>= 1;
+        if (bit == 0)
+        {
+            data++;
+            bit = 0x80;
+        }
+
+        int count = roomCodeCounts[length];
+        if (code - first < count)
+        {
+            uint8_t c = roomCodeSymbols[index + code - first];
+            if (c == 0)
+            {
+                data = NULL; // End of the text
+                return -1;
+            }
+            return c;
+        }
+        index += count;
+        first = (first + count) << 1;
+        code <<= 1;
+    }
+
+    data = NULL; // Damaged text, stop here
+    return -1;
+}
+
+/// @brief Get the next byte of the text without moving past it
+/// @return The byte, or -1 at the end of the text
+int RoomText::peek()
+{
+    if (next == -2)
+    {
+        next = read();
+    }
+    return next;
+}
+
+/// @brief Decode the whole text into a String, for short text like titles
+String RoomText::toString() const
+{
+    RoomText text = *this;
+    String result;
+    int c;
+
+    while ((c = text.read()) != -1)
+    {
+        result += (char)c;
+    }
+    return result;
+}
+
+/// @brief Decode the text straight to a Print, so Serial.print() works on room text
+size_t RoomText::printTo(Print &out) const
+{
+    RoomText text = *this;
+    uint8_t buffer[64]; // Decoded bytes are written in chunks, not one at a time
+    size_t length = 0;
+    size_t written = 0;
+    int c;
+
+    while ((c = text.read()) != -1)
+    {
+        buffer[length++] = c;
+        if (length == sizeof(buffer))
+        {
+            written += out.write(buffer, length);
+            length = 0;
+        }
+    }
+    if (length > 0)
+    {
+        written += out.write(buffer, length);
+    }
+    return written;
+}
+
+/// @brief Get the room in a direction
+/// @param direction NORTH, EAST, WEST or SOUTH
+/// @return Room id, or -1 if there is no way to go
+int Rooms::neighbor(int id, int direction)
+{
+    const RoomRecord *room = roomRecord(id);
+
+    if (room == NULL || direction < 0 || direction >= MAX_ROOM_NEIGHBORS)
+    {
+        return -1;
+    }
+
+    // Neighbours are only listed for directions in the mask, skip the ones before this direction
+    const uint16_t *list = roomLists + room->lists;
+    uint16_t mask = list[list[0] + 1];
+    if (!(mask & (1 << direction)))
+    {
+        return -1;
+    }
+    return list[list[0] + 2 + __builtin_popcount(mask & ((1 << direction) - 1))];
+}
+
+/// @brief Get the number of options that can be typed in a room
+int Rooms::optionCount(int id)
+{
+    const RoomRecord *room = roomRecord(id);
+    return room == NULL ? 0 : roomLists[room->lists];
+}
+
+/// @brief Get an option that can be typed in a room
+/// @param index Option from 0 to Rooms::optionCount() - 1
+const char *Rooms::option(int id, int index)
+{
+    return roomWords + roomLists[roomRecord(id)->lists + 1 + index];
+}
+
+/// @brief Check if an option can be typed in a room
+bool Rooms::hasOption(int id, const char *option)
+{
+    const RoomRecord *room = roomRecord(id);
+
+    if (room == NULL)
+    {
+        return false;
+    }
+
+    const uint16_t *list = roomLists + room->lists;
+    for (int i = 1; i <= list[0]; i++)
+    {
+        if (strcmp(option, roomWords + list[i]) == 0)
+        {
+            return true;
+        }
+    }
+    return false;
+}
\ No newline at end of file
@@ -0,0 +1,167 @@
+#include <ozsec/storage.hpp>
+
+QueueHandle_t storageJobs;      // Writes from the game loop to the storage task
+SemaphoreHandle_t storageDone;  // Given by the storage task when a job the game loop waits on is done
+bool storageResult;             // Result of the last job the game loop waited on
+Preferences storagePreferences; // Only used by the storage task, the game loop keeps using preferences
+TaskHandle_t StorageTask;
+
+unsigned long Storage::writes;
+unsigned long Storage::failures;
+unsigned long Storage::bytesWritten;
+uint64_t Storage::writeTime;
+unsigned long Storage::writeMax;
+
+/// @brief Create the job queue and start the storage task on core 0.
+/// Call before Adventure::init(), loading the game waits for queued writes.
+void Storage::init()
+{
+    storageJobs = xQueueCreate(STORAGE_QUEUE_LENGTH, sizeof(StorageJob));
+    storageDone = xSemaphoreCreateBinary();
+
+    // Run beside the lights on core 0, the game loop on core 1 only hands over the data
+    xTaskCreatePinnedToCore(
+        Storage::task,      /* Function to run the task */
+        "StorageTask",      /* Name of the task */
+        STORAGE_TASK_STACK, /* Stack size in words */
+        NULL,               /* Task input parameter */
+        1,                  /* Priority of the task */
+        &StorageTask,       /* Task handle. */
+        0);                 /* Core where the task should run */
+}
+
+/// @brief Queue a bytes key write.
+/// @param data Data allocated with malloc(), the storage task frees it once written
+/// @return false if the write could not be queued, data is freed then
+bool Storage::putBytes(const char *space, const char *key, uint8_t *data, size_t length)
+{
+    StorageJob job = {STORAGE_PUT_BYTES, space, key, data, length, false};
+    return post(job);
+}
+
+/// @brief Queue a string key write, the value is copied.
+/// @return false if the write could not be queued
+bool Storage::putString(const char *space, const char *key, const String &value)
+{
+    uint8_t *data = (uint8_t *)malloc(value.length() + 1);
+
+    if (data == NULL)
+    {
+        failures++;
+        return false;
+    }
+    memcpy(data, value.c_str(), value.length() + 1);
+
+    StorageJob job = {STORAGE_PUT_STRING, space, key, data, value.length() + 1, false};
+    return post(job);
+}
+
+/// @brief Queue removing a key.
+/// @return false if the removal could not be queued
+bool Storage::remove(const char *space, const char *key)
+{
+    StorageJob job = {STORAGE_REMOVE, space, key, NULL, 0, false};
+    return post(job);
+}
+
+/// @brief Remove every key in a namespace, waiting for it and any writes queued before it.
+/// @return true if the namespace was cleared
+bool Storage::clear(const char *space)
+{
+    StorageJob job = {STORAGE_CLEAR, space, NULL, NULL, 0, true};
+    return post(job);
+}
+
+/// @brief Wait for every queued write to finish, so reads see them.
+/// @return true once the queue is empty
+bool Storage::sync()
+{
+    StorageJob job = {STORAGE_SYNC, NULL, NULL, NULL, 0, true};
+    return post(job);
+}
+
+/// @brief Queue a job for the storage task.
+/// Jobs the game loop waits on block until done, other jobs are dropped if the queue is full.
+/// @return Result of the job if waited on, otherwise true if the job was queued
+bool Storage::post(StorageJob &job)
+{
+    if (xQueueSend(storageJobs, &job, job.wait ? portMAX_DELAY : 0) != pdTRUE)
+    {
+        free(job.data);
+        failures++;
+        return false;
+    }
+
+    if (job.wait)
+    {
+        xSemaphoreTake(storageDone, portMAX_DELAY);
+        return storageResult;
+    }
+    return true;
+}
+
+/// @brief Run a job on the storage task and free its data.
+/// @return true if the job succeeded
+bool Storage::run(StorageJob &job)
+{
+    unsigned long start = micros();
+    bool result = true;
+
+    if (job.type != STORAGE_SYNC)
+    {
+        if (!storagePreferences.begin(job.space, false))
+        {
+            result = false;
+        }
+        else
+        {
+            switch (job.type)
+            {
+            case STORAGE_PUT_BYTES:
+                result = storagePreferences.putBytes(job.key, job.data, job.length) == job.length;
+                break;
+            case STORAGE_PUT_STRING:
+                result = storagePreferences.putString(job.key, (const char *)job.data) == job.length - 1;
+                break;
+            case STORAGE_REMOVE:
+                result = storagePreferences.remove(job.key);
+                break;
+            case STORAGE_CLEAR:
+                result = storagePreferences.clear();
+                break;
+            default:
+                break;
+            }
+            storagePreferences.end();
+        }
+
+        unsigned long elapsed = micros() - start;
+        writes++;
+        bytesWritten += result ? job.length : 0;
+        failures += result ? 0 : 1;
+        writeTime += elapsed;
+        writeMax = max(writeMax, elapsed);
+    }
+
+    free(job.data);
+    return result;
+}
+
+/// @brief Storage task, runs queued jobs one at a time in order.
+void Storage::task(void *parameter)
+{
+    StorageJob job;
+
+    while (true)
+    {
+        if (xQueueReceive(storageJobs, &job, portMAX_DELAY) == pdTRUE)
+        {
+            bool result = run(job);
+            if (job.wait)
+            {
+                storageResult = result;
+                xSemaphoreGive(storageDone);
+            }
+        }
+    }
+}
\ No newline at end of file
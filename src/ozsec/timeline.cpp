@@ -0,0 +1,86 @@
+#include <ozsec/timeline.hpp>
+#include <ozsec/console.hpp>
+
+// Line waiting to be printed
+struct TimelineEntry
+{
+    unsigned long due; // Time in ms to print the line
+    String text;
+};
+
+// Ring buffer of lines waiting to be printed, in the order they were queued
+TimelineEntry timeline[TIMELINE_LENGTH];
+int timelineHead;
+int timelineCount;
+unsigned long timelineEnd; // Time in ms the last queued line or pause ends
+
+/// @brief Print a line after everything already on the timeline.
+/// Prints straight away if the timeline is idle.
+void Timeline::println(String text)
+{
+    unsigned long now = millis();
+
+    if (!busy(now))
+    {
+        Console.println(text);
+        return;
+    }
+
+    // Print the oldest line early rather than lose any output
+    if (timelineCount == TIMELINE_LENGTH)
+    {
+        Console.println(timeline[timelineHead].text);
+        timeline[timelineHead].text = "";
+        timelineHead = (timelineHead + 1) % TIMELINE_LENGTH;
+        timelineCount--;
+    }
+
+    TimelineEntry *entry = &timeline[(timelineHead + timelineCount) % TIMELINE_LENGTH];
+    entry->due = timelineEnd;
+    entry->text = text;
+    timelineCount++;
+}
+
+/// @brief Wait before the next line on the timeline, or before the game carries on.
+/// @param ms Time in ms to wait
+void Timeline::pause(unsigned long ms)
+{
+    unsigned long now = millis();
+
+    if (!busy(now))
+    {
+        timelineEnd = now;
+    }
+    timelineEnd += ms;
+}
+
+/// @brief Print every line that is due.
+/// @param now Current time in ms
+void Timeline::run(unsigned long now)
+{
+    while (timelineCount > 0 && (long)(now - timeline[timelineHead].due) >= 0)
+    {
+        Console.println(timeline[timelineHead].text);
+        timeline[timelineHead].text = ""; // Free the line
+        timelineHead = (timelineHead + 1) % TIMELINE_LENGTH;
+        timelineCount--;
+    }
+}
+
+/// @brief Check if there are lines or a pause still to come
+/// @param now Current time in ms
+bool Timeline::busy(unsigned long now)
+{
+    return timelineCount > 0 || (long)(timelineEnd - now) > 0;
+}
+
+/// @brief Get the time until the next line is due or the last pause ends
+/// @param now Current time in ms
+/// @return Time in ticks, 0 if something is already due
+TickType_t Timeline::wait(unsigned long now)
+{
+    unsigned long next = timelineCount > 0 ? timeline[timelineHead].due : timelineEnd;
+    long due = (long)(next - now);
+
+    return due > 0 ? pdMS_TO_TICKS(due) : 0;
+}
\ No newline at end of file
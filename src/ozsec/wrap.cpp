@@ -0,0 +1,200 @@
+#include <ozsec/wrap.hpp>
+
+/// @brief Start wrapping text to a width
+/// @param out Where the wrapped text is printed, usually Serial
+/// @param width Line width in characters, at most WRAP_WIDTH_MAX
+TextWrap::TextWrap(Print &out, int width) : out(out), width(min(width, WRAP_WIDTH_MAX)), lineUsed(0), wordUsed(0), lineLength(0),
+                                            wordLength(0), wordOnNewLine(false), lastCharWasCR(false), skipNewLine(false)
+{
+}
+
+/// @brief Add text to the current line, writing the line out when the buffer is full
+void TextWrap::write(const char *data, int length)
+{
+    while (length > 0)
+    {
+        int count = min(length, WRAP_LINE_BUFFER - lineUsed);
+        memcpy(line + lineUsed, data, count);
+        lineUsed += count;
+        data += count;
+        length -= count;
+
+        if (lineUsed == WRAP_LINE_BUFFER)
+        {
+            out.write((const uint8_t *)line, lineUsed);
+            lineUsed = 0;
+        }
+    }
+}
+
+/// @brief End the line and write it out
+void TextWrap::newLine()
+{
+    write("\r\n", 2);
+    out.write((const uint8_t *)line, lineUsed);
+    lineUsed = 0;
+    lineLength = 0;
+}
+
+/// @brief Start a new line for the current word once it no longer fits.
+/// The word can only get longer, so this is decided as soon as it is too long.
+void TextWrap::checkWidth()
+{
+    if (!wordOnNewLine && lineLength + wordLength > width)
+    {
+        newLine();
+        wordOnNewLine = true;
+        write(word, wordUsed);
+        wordUsed = 0;
+    }
+}
+
+/// @brief Add a character to the current word
+void TextWrap::addToWord(char c)
+{
+    wordLength++;
+    checkWidth();
+    if (wordOnNewLine)
+    {
+        write(&c, 1);
+    }
+    else
+    {
+        word[wordUsed++] = c;
+    }
+}
+
+/// @brief Print the current word and start the next one
+void TextWrap::endWord()
+{
+    checkWidth();
+    write(word, wordUsed);
+    lineLength += wordLength;
+    wordUsed = 0;
+    wordLength = 0;
+    wordOnNewLine = false;
+}
+
+/// @brief Wrap the next character of the text
+/// @param last True for the last character of the text
+void TextWrap::add(char c, bool last)
+{
+    // Check for newline '\n' or '\r\n' cases
+    if (c == '\r')
+    {
+        lastCharWasCR = true;
+    }
+    else if (c == '\n')
+    {
+        lastCharWasCR = false;
+        if (wordLength > 0)
+        {
+            endWord();
+        }
+
+        // Only add a new line if the previous character was not another newline
+        if (!skipNewLine)
+        {
+            newLine();
+            skipNewLine = true;
+        }
+        lineLength = 0;
+    }
+    else
+    {
+        if (lastCharWasCR)
+        {
+            // '\r' was not followed by '\n', it only restarts the line count
+            if (wordLength > 0)
+            {
+                endWord();
+            }
+            lineLength = 0;
+            lastCharWasCR = false;
+        }
+
+        if (c == ' ' || last)
+        {
+            // Include the last character in the current word if we're at the end
+            if (c != ' ')
+            {
+                addToWord(c);
+            }
+            endWord();
+            if (c == ' ')
+            {
+                write(" ", 1);
+                lineLength++;
+            }
+            skipNewLine = false;
+        }
+        else
+        {
+            addToWord(c);
+        }
+    }
+}
+
+/// @brief Print any remaining word and end the last line
+void TextWrap::finish()
+{
+    if (wordLength > 0)
+    {
+        endWord();
+    }
+    newLine();
+}
+
+/// @brief Print room text wrapped, decoding it as it goes
+void TextWrap::print(RoomText text)
+{
+    int c;
+
+    while ((c = text.read()) != -1)
+    {
+        add(c, text.peek() == -1);
+    }
+    finish();
+}
+
+/// @brief Print text wrapped
+void TextWrap::print(const char *text)
+{
+    for (; *text != '\0'; text++)
+    {
+        add(*text, text[1] == '\0');
+    }
+    finish();
+}
+
+/// @brief Print room text that was wrapped ahead of time by tools/rooms.py.
+/// The text is printed without '\r' and '\n', with a line break before each offset in breaks.
+/// @param breaks Number of line breaks, then the offset in the text of each break
+void TextWrap::printLines(RoomText text, const uint16_t *breaks)
+{
+    int count = *breaks++;
+    int offset = 0;
+    int c;
+
+    while ((c = text.read()) != -1)
+    {
+        while (count > 0 && *breaks == offset)
+        {
+            newLine();
+            breaks++;
+            count--;
+        }
+        if (c != '\r' && c != '\n')
+        {
+            char b = c;
+            write(&b, 1);
+        }
+        offset++;
+    }
+
+    // Line breaks at the end of the text
+    for (; count > 0; count--)
+    {
+        newLine();
+    }
+}
\ No newline at end of file
@@ -0,0 +1,227 @@
+#ifndef Arduino_h
+#define Arduino_h
+// Host stand-in for the parts of the Arduino ESP32 core the game uses, see native.hpp for the test hooks.
+#include <algorithm>
+#include <cmath>
+#include <cstdarg>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/queue.h"
+#include "freertos/semphr.h"
+
+using std::max;
+using std::min;
+
+#define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+#define IRAM_ATTR
+#define HIGH 1
+#define LOW 0
+#define INPUT 0x01
+#define OUTPUT 0x03
+#define INPUT_PULLUP 0x05
+#define RISING 0x01
+#define FALLING 0x02
+#define CHANGE 0x03
+#define digitalPinToInterrupt(p) (p)
+#define ARDUINO_USB_MODE 1
+
+typedef bool boolean;
+typedef uint8_t byte;
+
+enum gpio_num_t
+{
+    GPIO_NUM_0, GPIO_NUM_1, GPIO_NUM_2, GPIO_NUM_3, GPIO_NUM_4, GPIO_NUM_5, GPIO_NUM_6, GPIO_NUM_7,
+    GPIO_NUM_8, GPIO_NUM_9, GPIO_NUM_10, GPIO_NUM_11, GPIO_NUM_12, GPIO_NUM_13, GPIO_NUM_14, GPIO_NUM_15,
+    GPIO_NUM_16, GPIO_NUM_17, GPIO_NUM_18, GPIO_NUM_19, GPIO_NUM_20, GPIO_NUM_21, GPIO_NUM_22, GPIO_NUM_23,
+    GPIO_NUM_24, GPIO_NUM_25, GPIO_NUM_26, GPIO_NUM_27, GPIO_NUM_28, GPIO_NUM_29, GPIO_NUM_30, GPIO_NUM_31,
+    GPIO_NUM_32, GPIO_NUM_33, GPIO_NUM_34, GPIO_NUM_35, GPIO_NUM_36, GPIO_NUM_37, GPIO_NUM_38, GPIO_NUM_39,
+    GPIO_NUM_40, GPIO_NUM_41, GPIO_NUM_42, GPIO_NUM_43, GPIO_NUM_44, GPIO_NUM_45, GPIO_NUM_46, GPIO_NUM_47,
+    GPIO_NUM_48, GPIO_NUM_MAX
+};
+
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+void delayMicroseconds(unsigned int us);
+int64_t esp_timer_get_time();
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t value);
+int digitalRead(uint8_t pin);
+int gpio_get_level(gpio_num_t pin);
+void analogWrite(uint8_t pin, int value);
+uint32_t ledcSetup(uint8_t channel, uint32_t freq, uint8_t bits);
+void ledcAttachPin(uint8_t pin, uint8_t channel);
+void ledcWrite(uint8_t channel, uint32_t duty);
+void attachInterrupt(uint8_t pin, void (*handler)(void), int mode);
+void attachInterruptArg(uint8_t pin, void (*handler)(void *), void *arg, int mode);
+void randomSeed(unsigned long seed);
+long random(long high);
+long random(long low, long high);
+
+// Arduino String, on top of std::string
+class String
+{
+private:
+    std::string s;
+
+public:
+    String() {}
+    String(const char *c) : s(c ? c : "") {}
+    String(const char *c, unsigned int length) : s(c, length) {}
+    String(const std::string &x) : s(x) {}
+    explicit String(char c) : s(1, c) {}
+    String(int v) : s(std::to_string(v)) {}
+    String(unsigned int v) : s(std::to_string(v)) {}
+    String(long v) : s(std::to_string(v)) {}
+    String(unsigned long v) : s(std::to_string(v)) {}
+    String(long long v) : s(std::to_string(v)) {}
+    String(unsigned long long v) : s(std::to_string(v)) {}
+    String(float v, unsigned int decimals = 2) : String((double)v, decimals) {}
+    String(double v, unsigned int decimals = 2)
+    {
+        char text[64];
+        snprintf(text, sizeof(text), "%.*f", decimals, v);
+        s = text;
+    }
+
+    unsigned int length() const { return s.size(); }
+    const char *c_str() const { return s.c_str(); }
+    char operator[](unsigned int i) const { return i < s.size() ? s[i] : 0; }
+    char &operator[](unsigned int i) { return s[i]; }
+    char charAt(unsigned int i) const { return (*this)[i]; }
+    String &operator+=(const String &other) { s += other.s; return *this; }
+    String &operator+=(const char *other) { s += other; return *this; }
+    String &operator+=(char c) { s += c; return *this; }
+    bool concat(const char *c, unsigned int length) { s.append(c, length); return true; }
+    bool operator==(const String &other) const { return s == other.s; }
+    bool operator==(const char *other) const { return s == (other ? other : ""); }
+    bool operator!=(const String &other) const { return s != other.s; }
+    bool operator!=(const char *other) const { return !(*this == other); }
+    bool equals(const char *other) const { return *this == other; }
+    bool startsWith(const String &prefix) const { return s.compare(0, prefix.s.size(), prefix.s) == 0; }
+    int indexOf(char c, unsigned int from = 0) const { return find(s.find(c, from)); }
+    int indexOf(const char *text, unsigned int from = 0) const { return find(s.find(text, from)); }
+    String substring(unsigned int from) const { return from >= s.size() ? String() : String(s.substr(from)); }
+    String substring(unsigned int from, unsigned int to) const { return from >= s.size() || to <= from ? String() : String(s.substr(from, to - from)); }
+    long toInt() const { return atol(s.c_str()); }
+    void toLowerCase() { for (char &c : s) c = tolower(c); }
+    void remove(unsigned int from) { if (from < s.size()) s.erase(from); }
+    void remove(unsigned int from, unsigned int count) { if (from < s.size()) s.erase(from, count); }
+    bool reserve(unsigned int size) { s.reserve(size); return true; }
+    void clear() { s.clear(); }
+    void trim()
+    {
+        size_t first = s.find_first_not_of(" \t\r\n");
+        size_t last = s.find_last_not_of(" \t\r\n");
+        s = first == std::string::npos ? std::string() : s.substr(first, last - first + 1);
+    }
+
+private:
+    static int find(size_t position) { return position == std::string::npos ? -1 : (int)position; }
+};
+
+inline String operator+(const String &a, const String &b) { String sum = a; sum += b; return sum; }
+inline String operator+(const String &a, const char *b) { String sum = a; sum += b; return sum; }
+inline String operator+(const char *a, const String &b) { String sum = a; sum += b; return sum; }
+inline String operator+(const String &a, char b) { String sum = a; sum += b; return sum; }
+inline bool operator==(const char *a, const String &b) { return b == a; }
+
+class Print;
+
+class Printable
+{
+public:
+    virtual size_t printTo(Print &p) const = 0;
+    virtual ~Printable() {}
+};
+
+class Print
+{
+public:
+    virtual size_t write(uint8_t c) = 0;
+    virtual size_t write(const uint8_t *buffer, size_t size)
+    {
+        size_t n = 0;
+        while (size-- && write(*buffer++))
+        {
+            n++;
+        }
+        return n;
+    }
+    size_t write(const char *text) { return text == NULL ? 0 : write((const uint8_t *)text, strlen(text)); }
+    size_t write(const char *buffer, size_t size) { return write((const uint8_t *)buffer, size); }
+    virtual int availableForWrite() { return 0; }
+    virtual void flush() {}
+    virtual ~Print() {}
+
+    size_t print(const char *text) { return write(text); }
+    size_t print(const String &text) { return write(text.c_str(), text.length()); }
+    size_t print(char c) { return write((uint8_t)c); }
+    size_t print(int v) { return print(String(v)); }
+    size_t print(unsigned int v) { return print(String(v)); }
+    size_t print(long v) { return print(String(v)); }
+    size_t print(unsigned long v) { return print(String(v)); }
+    size_t print(double v, int decimals = 2) { return print(String(v, decimals)); }
+    size_t print(const Printable &x) { return x.printTo(*this); }
+    size_t println() { return write("\r\n"); }
+    template <typename T>
+    size_t println(const T &v) { size_t n = print(v); return n + println(); }
+    size_t println(double v, int decimals) { size_t n = print(v, decimals); return n + println(); }
+    size_t printf(const char *format, ...) __attribute__((format(printf, 2, 3)));
+};
+
+class Stream : public Print
+{
+public:
+    virtual int available() = 0;
+    virtual int read() = 0;
+    virtual int peek() { return -1; }
+};
+
+typedef const char *esp_event_base_t;
+typedef void (*esp_event_handler_t)(void *, esp_event_base_t, int32_t, void *);
+enum arduino_hw_cdc_event_t
+{
+    ARDUINO_HW_CDC_ANY_EVENT,
+    ARDUINO_HW_CDC_CONNECTED_EVENT,
+    ARDUINO_HW_CDC_BUS_RESET_EVENT,
+    ARDUINO_HW_CDC_RX_EVENT,
+    ARDUINO_HW_CDC_TX_EVENT
+};
+
+// USB serial, output goes to Native::serialOut at the pace of Native::hostRoom
+class HWCDC : public Stream
+{
+public:
+    void begin(unsigned long baud) {}
+    void setTxTimeoutMs(uint32_t timeout) {}
+    void onEvent(arduino_hw_cdc_event_t event, esp_event_handler_t handler) {}
+    operator bool() const { return true; }
+    int available() override;
+    int read() override;
+    size_t write(uint8_t c) override;
+    size_t write(const uint8_t *buffer, size_t size) override;
+    int availableForWrite() override;
+    using Print::write;
+};
+
+extern HWCDC Serial;
+
+class EspClass
+{
+public:
+    void restart();
+    uint32_t getCycleCount();
+    uint32_t getCpuFreqMHz() { return 240; }
+    uint32_t getFreeHeap() { return 200000; }
+    uint32_t getHeapSize() { return 320000; }
+};
+
+extern EspClass ESP;
+
+#endif
\ No newline at end of file
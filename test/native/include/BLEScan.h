@@ -0,0 +1,5 @@
+#ifndef BLEScan_h
+#define BLEScan_h
+// Host stand-in, the native environment builds the game without src/ozsec/ble.cpp
+
+#endif
\ No newline at end of file
@@ -0,0 +1,53 @@
+#ifndef FastLED_h
+#define FastLED_h
+// Host stand-in for FastLED, only keeps what would be shown
+#include <cstdint>
+
+struct CRGB
+{
+    uint8_t r;
+    uint8_t g;
+    uint8_t b;
+
+    enum HTMLColorCode : uint32_t
+    {
+        Black = 0x000000,
+        Blue = 0x0000FF,
+        Green = 0x008000,
+        Purple = 0x800080,
+        Red = 0xFF0000,
+        White = 0xFFFFFF
+    };
+
+    CRGB() : r(0), g(0), b(0) {}
+    CRGB(uint8_t r, uint8_t g, uint8_t b) : r(r), g(g), b(b) {}
+    CRGB(HTMLColorCode code) : r(code >> 16), g(code >> 8), b(code) {}
+    bool operator==(const CRGB &other) const { return r == other.r && g == other.g && b == other.b; }
+    bool operator!=(const CRGB &other) const { return !(*this == other); }
+};
+
+enum EOrder
+{
+    RGB,
+    GRB
+};
+
+#define WS2812B 0
+
+class CFastLED
+{
+public:
+    unsigned long shows = 0; // Times show() was called
+    uint8_t brightness = 255;
+    CRGB *leds = nullptr;
+
+    template <int CHIPSET, int DATA_PIN, EOrder ORDER>
+    void addLeds(CRGB *data, int count) { leds = data; }
+    void setBrightness(uint8_t scale) { brightness = scale; }
+    uint8_t getBrightness() { return brightness; }
+    void show() { shows++; }
+};
+
+extern CFastLED FastLED;
+
+#endif
\ No newline at end of file
@@ -0,0 +1,39 @@
+#ifndef Preferences_h
+#define Preferences_h
+// Host stand-in for the ESP32 Preferences library, namespaces are kept in memory and counted in Native
+#include <Arduino.h>
+
+class Preferences
+{
+private:
+    std::string space;
+    bool started = false;
+    bool readOnly = false;
+
+    size_t put(const char *key, const void *value, size_t length);
+    size_t get(const char *key, void *value, size_t length, bool exact);
+
+public:
+    bool begin(const char *name, bool readOnly = false);
+    void end();
+    bool clear();
+    bool remove(const char *key);
+    bool isKey(const char *key);
+    size_t freeEntries();
+
+    size_t putBool(const char *key, bool value);
+    size_t putInt(const char *key, int32_t value);
+    size_t putUInt(const char *key, uint32_t value);
+    size_t putString(const char *key, const char *value);
+    size_t putString(const char *key, const String &value);
+    size_t putBytes(const char *key, const void *value, size_t length);
+
+    bool getBool(const char *key, bool defaultValue = false);
+    int32_t getInt(const char *key, int32_t defaultValue = 0);
+    uint32_t getUInt(const char *key, uint32_t defaultValue = 0);
+    String getString(const char *key, String defaultValue = String());
+    size_t getBytesLength(const char *key);
+    size_t getBytes(const char *key, void *buffer, size_t length);
+};
+
+#endif
\ No newline at end of file
@@ -0,0 +1,7 @@
+#ifndef esp_rom_crc_h
+#define esp_rom_crc_h
+#include <cstdint>
+
+uint32_t esp_rom_crc32_le(uint32_t crc, const uint8_t *buffer, uint32_t length);
+
+#endif
\ No newline at end of file
@@ -0,0 +1,23 @@
+#ifndef FreeRTOS_h
+#define FreeRTOS_h
+// Host stand-in for FreeRTOS, tasks are threads and one tick is one ms
+#include <cstddef>
+#include <cstdint>
+
+typedef uint32_t TickType_t;
+typedef int BaseType_t;
+typedef unsigned int UBaseType_t;
+
+#define pdFALSE 0
+#define pdTRUE 1
+#define pdFAIL 0
+#define pdPASS 1
+#define portMAX_DELAY 0xFFFFFFFFu
+#define portTICK_PERIOD_MS 1
+#define pdMS_TO_TICKS(ms) ((TickType_t)(ms))
+#define portYIELD_FROM_ISR(...) \
+    do                          \
+    {                           \
+    } while (0)
+
+#endif
\ No newline at end of file
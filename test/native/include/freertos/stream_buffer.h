@@ -0,0 +1,14 @@
+#ifndef stream_buffer_h
+#define stream_buffer_h
+#include "FreeRTOS.h"
+
+typedef void *StreamBufferHandle_t;
+
+StreamBufferHandle_t xStreamBufferCreate(size_t size, size_t triggerLevel);
+size_t xStreamBufferSend(StreamBufferHandle_t buffer, const void *data, size_t length, TickType_t ticks);
+size_t xStreamBufferReceive(StreamBufferHandle_t buffer, void *data, size_t length, TickType_t ticks);
+size_t xStreamBufferSpacesAvailable(StreamBufferHandle_t buffer);
+size_t xStreamBufferBytesAvailable(StreamBufferHandle_t buffer);
+BaseType_t xStreamBufferIsEmpty(StreamBufferHandle_t buffer);
+
+#endif
\ No newline at end of file
@@ -0,0 +1,36 @@
+#ifndef Native_hpp
+#define Native_hpp
+#include <Arduino.h>
+#include <atomic>
+#include <mutex>
+#include <string>
+
+// Hooks into the host stand-ins, for tests to drive the clock, the serial host and to read the counters.
+class Native
+{
+public:
+    static std::atomic<unsigned long> now; // Virtual time in ms, millis() returns it unless realTime is set
+    static bool realTime;                  // millis() and delay() follow the host clock instead
+
+    static std::mutex serialLock;     // Held while serialOut changes, the console task writes from its own thread
+    static std::string serialOut;     // Everything written to Serial
+    static std::string serialIn;      // Input for Serial.read()
+    static std::atomic<long> hostRoom; // Bytes the serial host still takes, -1 for a host that keeps up
+
+    static uint16_t pins[GPIO_NUM_MAX];   // Level last written to each pin
+    static uint32_t ledcDuty[16];         // Duty last written to each LEDC channel
+    static std::atomic<unsigned long> ledcWrites;
+
+    static std::atomic<unsigned long> nvsReads;  // Preferences reads, including key lookups
+    static std::atomic<unsigned long> nvsWrites; // Preferences writes, removes and clears
+    static std::atomic<unsigned long> nvsBytes;  // Bytes written to NVS
+    static std::atomic<bool> nvsStalled;         // Writes wait while set, like flash busy with a long erase
+    static void nvsErase();                      // Forget every namespace
+
+    static bool bleFound; // What OzSecBLE::scan() reports
+
+    static void advance(unsigned long ms);
+    static std::string takeSerial();
+};
+
+#endif
\ No newline at end of file
@@ -0,0 +1,222 @@
+#include <native.hpp>
+#include <FastLED.h>
+#include <esp_rom_crc.h>
+#include <chrono>
+#include <thread>
+
+std::atomic<unsigned long> Native::now(0);
+bool Native::realTime;
+std::mutex Native::serialLock;
+std::string Native::serialOut;
+std::string Native::serialIn;
+std::atomic<long> Native::hostRoom(-1);
+uint16_t Native::pins[GPIO_NUM_MAX];
+uint32_t Native::ledcDuty[16];
+std::atomic<unsigned long> Native::ledcWrites(0);
+bool Native::bleFound;
+
+HWCDC Serial;
+EspClass ESP;
+CFastLED FastLED;
+
+static const std::chrono::steady_clock::time_point started = std::chrono::steady_clock::now();
+static uint32_t randomState = 1;
+
+/// @brief Move the virtual clock forward
+void Native::advance(unsigned long ms)
+{
+    now += ms;
+}
+
+/// @brief Get and clear everything written to Serial so far
+std::string Native::takeSerial()
+{
+    std::lock_guard<std::mutex> guard(serialLock);
+    std::string out;
+    out.swap(serialOut);
+    return out;
+}
+
+static uint64_t hostMicros()
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - started).count();
+}
+
+unsigned long millis()
+{
+    return Native::realTime ? hostMicros() / 1000 : Native::now.load();
+}
+
+unsigned long micros()
+{
+    return Native::realTime ? hostMicros() : Native::now.load() * 1000;
+}
+
+void delay(unsigned long ms)
+{
+    if (Native::realTime)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+    }
+    else
+    {
+        Native::advance(ms);
+    }
+}
+
+void delayMicroseconds(unsigned int us)
+{
+    std::this_thread::sleep_for(std::chrono::microseconds(us));
+}
+
+int64_t esp_timer_get_time()
+{
+    return micros();
+}
+
+void pinMode(uint8_t pin, uint8_t mode)
+{
+}
+
+void digitalWrite(uint8_t pin, uint8_t value)
+{
+    Native::pins[pin] = value;
+}
+
+int digitalRead(uint8_t pin)
+{
+    return HIGH; // Buttons are pulled up and never pressed
+}
+
+int gpio_get_level(gpio_num_t pin)
+{
+    return HIGH;
+}
+
+void analogWrite(uint8_t pin, int value)
+{
+    Native::pins[pin] = value;
+}
+
+uint32_t ledcSetup(uint8_t channel, uint32_t freq, uint8_t bits)
+{
+    return freq;
+}
+
+void ledcAttachPin(uint8_t pin, uint8_t channel)
+{
+}
+
+void ledcWrite(uint8_t channel, uint32_t duty)
+{
+    Native::ledcDuty[channel] = duty;
+    Native::ledcWrites++;
+}
+
+void attachInterrupt(uint8_t pin, void (*handler)(void), int mode)
+{
+}
+
+void attachInterruptArg(uint8_t pin, void (*handler)(void *), void *arg, int mode)
+{
+}
+
+// A fixed generator rather than rand(), so runs give the same numbers on every host
+void randomSeed(unsigned long seed)
+{
+    randomState = seed != 0 ? seed : 1;
+}
+
+long random(long high)
+{
+    randomState = randomState * 1103515245u + 12345u;
+    return high > 0 ? (randomState >> 8) % high : 0;
+}
+
+long random(long low, long high)
+{
+    return high > low ? low + random(high - low) : low;
+}
+
+size_t Print::printf(const char *format, ...)
+{
+    char text[512];
+    va_list args;
+
+    va_start(args, format);
+    int length = vsnprintf(text, sizeof(text), format, args);
+    va_end(args);
+    return write((const uint8_t *)text, min(length, (int)sizeof(text) - 1));
+}
+
+int HWCDC::available()
+{
+    std::lock_guard<std::mutex> guard(Native::serialLock);
+    return Native::serialIn.size();
+}
+
+int HWCDC::read()
+{
+    std::lock_guard<std::mutex> guard(Native::serialLock);
+    if (Native::serialIn.empty())
+    {
+        return -1;
+    }
+    int c = (uint8_t)Native::serialIn[0];
+    Native::serialIn.erase(0, 1);
+    return c;
+}
+
+size_t HWCDC::write(uint8_t c)
+{
+    return write(&c, 1);
+}
+
+/// @brief Like the USB serial driver, waits up to 100 ms for the host to take some of the output
+size_t HWCDC::write(const uint8_t *buffer, size_t size)
+{
+    if (Native::hostRoom >= 0)
+    {
+        for (int i = 0; i < 100 && Native::hostRoom == 0; i++)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        size = min(size, (size_t)Native::hostRoom.load());
+        Native::hostRoom -= size;
+    }
+
+    std::lock_guard<std::mutex> guard(Native::serialLock);
+    Native::serialOut.append((const char *)buffer, size);
+    return size;
+}
+
+int HWCDC::availableForWrite()
+{
+    return Native::hostRoom < 0 ? 4096 : Native::hostRoom.load();
+}
+
+void EspClass::restart()
+{
+    fprintf(stderr, "ESP.restart() called\n");
+    exit(1);
+}
+
+/// @brief Host time in cycles of a 240 MHz core
+uint32_t EspClass::getCycleCount()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - started).count() * 240 / 1000;
+}
+
+uint32_t esp_rom_crc32_le(uint32_t crc, const uint8_t *buffer, uint32_t length)
+{
+    crc = ~crc;
+    while (length--)
+    {
+        crc ^= *buffer++;
+        for (int bit = 0; bit < 8; bit++)
+        {
+            crc = crc & 1 ? (crc >> 1) ^ 0xEDB88320 : crc >> 1;
+        }
+    }
+    return ~crc;
+}
\ No newline at end of file
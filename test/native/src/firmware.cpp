@@ -0,0 +1,31 @@
+// What src/main.cpp and src/ozsec/ble.cpp give the rest of the firmware, they are left out of the native build
+#include <native.hpp>
+#include <ozsec/ble.hpp>
+
+Preferences preferences;
+String wifiSsid;
+String wifiPassword;
+
+// Stands in for the LED task, takes its notifications and does nothing with them
+static void backgroundTask(void *parameter)
+{
+    while (true)
+    {
+        xTaskNotifyWait(0, UINT32_MAX, NULL, portMAX_DELAY);
+    }
+}
+
+TaskHandle_t BackgroundTask = [] {
+    TaskHandle_t task;
+    xTaskCreatePinnedToCore(backgroundTask, "BackgroundTask", 0, NULL, 1, &task, 0);
+    return task;
+}();
+
+void OzSecBLE::init()
+{
+}
+
+bool OzSecBLE::scan()
+{
+    return Native::bleFound;
+}
\ No newline at end of file
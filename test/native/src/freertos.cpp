@@ -0,0 +1,378 @@
+#include <Arduino.h>
+#include <freertos/stream_buffer.h>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Notification state of a task, every thread gets one the first time it asks
+struct NativeTask
+{
+    std::mutex lock;
+    std::condition_variable changed;
+    uint32_t value = 0;
+    bool pending = false;
+};
+
+struct NativeQueue
+{
+    std::mutex lock;
+    std::condition_variable changed;
+    size_t length;
+    size_t itemSize;
+    std::deque<std::vector<uint8_t>> items;
+};
+
+struct NativeSemaphore
+{
+    std::mutex lock;
+    std::condition_variable changed;
+    int count;
+};
+
+struct NativeStreamBuffer
+{
+    std::mutex lock;
+    std::condition_variable changed;
+    size_t size;
+    std::deque<uint8_t> data;
+};
+
+static thread_local NativeTask *currentTask;
+
+/// @brief Wait on a condition for some ticks, portMAX_DELAY waits forever
+template <typename Ready>
+static bool waitFor(std::unique_lock<std::mutex> &guard, std::condition_variable &changed, TickType_t ticks, Ready ready)
+{
+    if (ticks == portMAX_DELAY)
+    {
+        changed.wait(guard, ready);
+        return true;
+    }
+    return changed.wait_for(guard, std::chrono::milliseconds(ticks), ready);
+}
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t code, const char *name, uint32_t stack, void *parameter, UBaseType_t priority, TaskHandle_t *handle, BaseType_t core)
+{
+    NativeTask *task = new NativeTask();
+
+    if (handle != NULL)
+    {
+        *handle = task;
+    }
+    std::thread([=]() {
+        currentTask = task;
+        code(parameter);
+    }).detach();
+    return pdPASS;
+}
+
+BaseType_t xTaskCreate(TaskFunction_t code, const char *name, uint32_t stack, void *parameter, UBaseType_t priority, TaskHandle_t *handle)
+{
+    return xTaskCreatePinnedToCore(code, name, stack, parameter, priority, handle, 0);
+}
+
+TaskHandle_t xTaskGetCurrentTaskHandle()
+{
+    if (currentTask == NULL)
+    {
+        currentTask = new NativeTask();
+    }
+    return currentTask;
+}
+
+void vTaskDelay(TickType_t ticks)
+{
+    std::this_thread::sleep_for(std::chrono::milliseconds(ticks));
+}
+
+void vTaskDelayUntil(TickType_t *previous, TickType_t ticks)
+{
+    TickType_t now = xTaskGetTickCount();
+
+    *previous += ticks;
+    if ((int32_t)(*previous - now) > 0)
+    {
+        vTaskDelay(*previous - now);
+    }
+}
+
+TickType_t xTaskGetTickCount()
+{
+    return millis();
+}
+
+TickType_t xTaskGetTickCountFromISR()
+{
+    return millis();
+}
+
+BaseType_t xTaskNotify(TaskHandle_t handle, uint32_t value, eNotifyAction action)
+{
+    NativeTask *task = (NativeTask *)handle;
+    std::lock_guard<std::mutex> guard(task->lock);
+
+    if (action == eSetValueWithoutOverwrite && task->pending)
+    {
+        return pdFAIL;
+    }
+    switch (action)
+    {
+    case eSetBits:
+        task->value |= value;
+        break;
+    case eIncrement:
+        task->value++;
+        break;
+    case eSetValueWithOverwrite:
+    case eSetValueWithoutOverwrite:
+        task->value = value;
+        break;
+    default:
+        break;
+    }
+    task->pending = true;
+    task->changed.notify_all();
+    return pdPASS;
+}
+
+BaseType_t xTaskNotifyFromISR(TaskHandle_t task, uint32_t value, eNotifyAction action, BaseType_t *woken)
+{
+    return xTaskNotify(task, value, action);
+}
+
+BaseType_t xTaskNotifyGive(TaskHandle_t task)
+{
+    return xTaskNotify(task, 0, eIncrement);
+}
+
+BaseType_t xTaskNotifyWait(uint32_t clearOnEntry, uint32_t clearOnExit, uint32_t *value, TickType_t ticks)
+{
+    NativeTask *task = (NativeTask *)xTaskGetCurrentTaskHandle();
+    std::unique_lock<std::mutex> guard(task->lock);
+
+    if (!task->pending)
+    {
+        task->value &= ~clearOnEntry;
+    }
+    if (!waitFor(guard, task->changed, ticks, [task] { return task->pending; }))
+    {
+        return pdFALSE;
+    }
+    if (value != NULL)
+    {
+        *value = task->value;
+    }
+    task->value &= ~clearOnExit;
+    task->pending = false;
+    return pdTRUE;
+}
+
+uint32_t ulTaskNotifyTake(BaseType_t clearOnExit, TickType_t ticks)
+{
+    NativeTask *task = (NativeTask *)xTaskGetCurrentTaskHandle();
+    std::unique_lock<std::mutex> guard(task->lock);
+
+    waitFor(guard, task->changed, ticks, [task] { return task->value != 0; });
+    uint32_t value = task->value;
+    task->value = clearOnExit || value == 0 ? 0 : value - 1;
+    task->pending = task->value != 0;
+    return value;
+}
+
+QueueHandle_t xQueueCreate(UBaseType_t length, UBaseType_t itemSize)
+{
+    NativeQueue *queue = new NativeQueue();
+
+    queue->length = length;
+    queue->itemSize = itemSize;
+    return queue;
+}
+
+BaseType_t xQueueSend(QueueHandle_t handle, const void *item, TickType_t ticks)
+{
+    NativeQueue *queue = (NativeQueue *)handle;
+    std::unique_lock<std::mutex> guard(queue->lock);
+
+    if (!waitFor(guard, queue->changed, ticks, [queue] { return queue->items.size() < queue->length; }))
+    {
+        return pdFALSE;
+    }
+    const uint8_t *data = (const uint8_t *)item;
+    queue->items.emplace_back(data, data + queue->itemSize);
+    queue->changed.notify_all();
+    return pdTRUE;
+}
+
+BaseType_t xQueueSendToBack(QueueHandle_t queue, const void *item, TickType_t ticks)
+{
+    return xQueueSend(queue, item, ticks);
+}
+
+BaseType_t xQueueSendFromISR(QueueHandle_t queue, const void *item, BaseType_t *woken)
+{
+    return xQueueSend(queue, item, 0);
+}
+
+BaseType_t xQueueOverwrite(QueueHandle_t handle, const void *item)
+{
+    NativeQueue *queue = (NativeQueue *)handle;
+    std::lock_guard<std::mutex> guard(queue->lock);
+    const uint8_t *data = (const uint8_t *)item;
+
+    queue->items.clear();
+    queue->items.emplace_back(data, data + queue->itemSize);
+    queue->changed.notify_all();
+    return pdTRUE;
+}
+
+static BaseType_t queueTake(QueueHandle_t handle, void *item, TickType_t ticks, bool remove)
+{
+    NativeQueue *queue = (NativeQueue *)handle;
+    std::unique_lock<std::mutex> guard(queue->lock);
+
+    if (!waitFor(guard, queue->changed, ticks, [queue] { return !queue->items.empty(); }))
+    {
+        return pdFALSE;
+    }
+    memcpy(item, queue->items.front().data(), queue->itemSize);
+    if (remove)
+    {
+        queue->items.pop_front();
+        queue->changed.notify_all();
+    }
+    return pdTRUE;
+}
+
+BaseType_t xQueueReceive(QueueHandle_t queue, void *item, TickType_t ticks)
+{
+    return queueTake(queue, item, ticks, true);
+}
+
+BaseType_t xQueuePeek(QueueHandle_t queue, void *item, TickType_t ticks)
+{
+    return queueTake(queue, item, ticks, false);
+}
+
+UBaseType_t uxQueueMessagesWaiting(QueueHandle_t handle)
+{
+    NativeQueue *queue = (NativeQueue *)handle;
+    std::lock_guard<std::mutex> guard(queue->lock);
+    return queue->items.size();
+}
+
+UBaseType_t uxQueueSpacesAvailable(QueueHandle_t handle)
+{
+    NativeQueue *queue = (NativeQueue *)handle;
+    std::lock_guard<std::mutex> guard(queue->lock);
+    return queue->length - queue->items.size();
+}
+
+BaseType_t xQueueReset(QueueHandle_t handle)
+{
+    NativeQueue *queue = (NativeQueue *)handle;
+    std::lock_guard<std::mutex> guard(queue->lock);
+
+    queue->items.clear();
+    queue->changed.notify_all();
+    return pdPASS;
+}
+
+SemaphoreHandle_t xSemaphoreCreateMutex()
+{
+    NativeSemaphore *semaphore = new NativeSemaphore();
+
+    semaphore->count = 1;
+    return semaphore;
+}
+
+SemaphoreHandle_t xSemaphoreCreateBinary()
+{
+    NativeSemaphore *semaphore = new NativeSemaphore();
+
+    semaphore->count = 0;
+    return semaphore;
+}
+
+BaseType_t xSemaphoreTake(SemaphoreHandle_t handle, TickType_t ticks)
+{
+    NativeSemaphore *semaphore = (NativeSemaphore *)handle;
+    std::unique_lock<std::mutex> guard(semaphore->lock);
+
+    if (!waitFor(guard, semaphore->changed, ticks, [semaphore] { return semaphore->count > 0; }))
+    {
+        return pdFALSE;
+    }
+    semaphore->count--;
+    return pdTRUE;
+}
+
+BaseType_t xSemaphoreGive(SemaphoreHandle_t handle)
+{
+    NativeSemaphore *semaphore = (NativeSemaphore *)handle;
+    std::lock_guard<std::mutex> guard(semaphore->lock);
+
+    if (semaphore->count > 0)
+    {
+        return pdFALSE;
+    }
+    semaphore->count++;
+    semaphore->changed.notify_all();
+    return pdTRUE;
+}
+
+StreamBufferHandle_t xStreamBufferCreate(size_t size, size_t triggerLevel)
+{
+    NativeStreamBuffer *buffer = new NativeStreamBuffer();
+
+    buffer->size = size;
+    return buffer;
+}
+
+size_t xStreamBufferSend(StreamBufferHandle_t handle, const void *data, size_t length, TickType_t ticks)
+{
+    NativeStreamBuffer *buffer = (NativeStreamBuffer *)handle;
+    std::unique_lock<std::mutex> guard(buffer->lock);
+
+    waitFor(guard, buffer->changed, ticks, [buffer, length] { return buffer->size - buffer->data.size() >= length; });
+    length = min(length, buffer->size - buffer->data.size());
+    buffer->data.insert(buffer->data.end(), (const uint8_t *)data, (const uint8_t *)data + length);
+    buffer->changed.notify_all();
+    return length;
+}
+
+size_t xStreamBufferReceive(StreamBufferHandle_t handle, void *data, size_t length, TickType_t ticks)
+{
+    NativeStreamBuffer *buffer = (NativeStreamBuffer *)handle;
+    std::unique_lock<std::mutex> guard(buffer->lock);
+
+    waitFor(guard, buffer->changed, ticks, [buffer] { return !buffer->data.empty(); });
+    length = min(length, buffer->data.size());
+    std::copy(buffer->data.begin(), buffer->data.begin() + length, (uint8_t *)data);
+    buffer->data.erase(buffer->data.begin(), buffer->data.begin() + length);
+    buffer->changed.notify_all();
+    return length;
+}
+
+size_t xStreamBufferSpacesAvailable(StreamBufferHandle_t handle)
+{
+    NativeStreamBuffer *buffer = (NativeStreamBuffer *)handle;
+    std::lock_guard<std::mutex> guard(buffer->lock);
+    return buffer->size - buffer->data.size();
+}
+
+size_t xStreamBufferBytesAvailable(StreamBufferHandle_t handle)
+{
+    NativeStreamBuffer *buffer = (NativeStreamBuffer *)handle;
+    std::lock_guard<std::mutex> guard(buffer->lock);
+    return buffer->data.size();
+}
+
+BaseType_t xStreamBufferIsEmpty(StreamBufferHandle_t handle)
+{
+    NativeStreamBuffer *buffer = (NativeStreamBuffer *)handle;
+    std::lock_guard<std::mutex> guard(buffer->lock);
+    return buffer->data.empty();
+}
\ No newline at end of file
@@ -0,0 +1,207 @@
+#include <native.hpp>
+#include <Preferences.h>
+#include <chrono>
+#include <map>
+#include <thread>
+#include <vector>
+
+#define NVS_KEY_LENGTH 15 // Longest key NVS takes
+
+std::atomic<unsigned long> Native::nvsReads(0);
+std::atomic<unsigned long> Native::nvsWrites(0);
+std::atomic<unsigned long> Native::nvsBytes(0);
+std::atomic<bool> Native::nvsStalled(false);
+
+// Every namespace, the storage task and the game loop both use it
+static std::mutex nvsLock;
+static std::map<std::string, std::map<std::string, std::vector<uint8_t>>> nvs;
+
+void Native::nvsErase()
+{
+    std::lock_guard<std::mutex> guard(nvsLock);
+    nvs.clear();
+}
+
+/// @brief Open a namespace, like NVS a namespace that was never written can't be opened read only
+bool Preferences::begin(const char *name, bool readOnly)
+{
+    std::lock_guard<std::mutex> guard(nvsLock);
+
+    if (started || (readOnly && nvs.count(name) == 0))
+    {
+        return false;
+    }
+    space = name;
+    started = true;
+    this->readOnly = readOnly;
+    if (!readOnly)
+    {
+        nvs[space];
+    }
+    return true;
+}
+
+void Preferences::end()
+{
+    started = false;
+}
+
+bool Preferences::clear()
+{
+    std::lock_guard<std::mutex> guard(nvsLock);
+
+    if (!started || readOnly)
+    {
+        return false;
+    }
+    Native::nvsWrites++;
+    nvs[space].clear();
+    return true;
+}
+
+bool Preferences::remove(const char *key)
+{
+    std::lock_guard<std::mutex> guard(nvsLock);
+
+    if (!started || readOnly)
+    {
+        return false;
+    }
+    Native::nvsWrites++;
+    return nvs[space].erase(key) > 0;
+}
+
+bool Preferences::isKey(const char *key)
+{
+    std::lock_guard<std::mutex> guard(nvsLock);
+
+    if (!started)
+    {
+        return false;
+    }
+    Native::nvsReads++;
+    return nvs[space].count(key) > 0;
+}
+
+size_t Preferences::freeEntries()
+{
+    return 500;
+}
+
+size_t Preferences::put(const char *key, const void *value, size_t length)
+{
+    while (Native::nvsStalled)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    std::lock_guard<std::mutex> guard(nvsLock);
+
+    if (!started || readOnly || strlen(key) > NVS_KEY_LENGTH)
+    {
+        return 0;
+    }
+    Native::nvsWrites++;
+    Native::nvsBytes += length;
+    nvs[space][key].assign((const uint8_t *)value, (const uint8_t *)value + length);
+    return length;
+}
+
+/// @brief Copy a value out
+/// @param exact Only copy values of exactly length bytes, like the fixed size getters
+/// @return Bytes copied, 0 if missing or too long
+size_t Preferences::get(const char *key, void *value, size_t length, bool exact)
+{
+    std::lock_guard<std::mutex> guard(nvsLock);
+
+    if (!started)
+    {
+        return 0;
+    }
+    Native::nvsReads++;
+    auto &keys = nvs[space];
+    auto found = keys.find(key);
+    if (found == keys.end() || found->second.size() > length || (exact && found->second.size() != length))
+    {
+        return 0;
+    }
+    if (value != NULL)
+    {
+        memcpy(value, found->second.data(), found->second.size());
+    }
+    return found->second.size();
+}
+
+size_t Preferences::putBool(const char *key, bool value)
+{
+    uint8_t byte = value;
+    return put(key, &byte, 1);
+}
+
+size_t Preferences::putInt(const char *key, int32_t value)
+{
+    return put(key, &value, sizeof(value));
+}
+
+size_t Preferences::putUInt(const char *key, uint32_t value)
+{
+    return put(key, &value, sizeof(value));
+}
+
+size_t Preferences::putString(const char *key, const char *value)
+{
+    return put(key, value, strlen(value) + 1) ? strlen(value) : 0;
+}
+
+size_t Preferences::putString(const char *key, const String &value)
+{
+    return putString(key, value.c_str());
+}
+
+size_t Preferences::putBytes(const char *key, const void *value, size_t length)
+{
+    return put(key, value, length);
+}
+
+bool Preferences::getBool(const char *key, bool defaultValue)
+{
+    uint8_t byte;
+    return get(key, &byte, 1, true) ? byte : defaultValue;
+}
+
+int32_t Preferences::getInt(const char *key, int32_t defaultValue)
+{
+    int32_t value;
+    return get(key, &value, sizeof(value), true) ? value : defaultValue;
+}
+
+uint32_t Preferences::getUInt(const char *key, uint32_t defaultValue)
+{
+    uint32_t value;
+    return get(key, &value, sizeof(value), true) ? value : defaultValue;
+}
+
+String Preferences::getString(const char *key, String defaultValue)
+{
+    char text[4000];
+    return get(key, text, sizeof(text), false) ? String(text) : defaultValue;
+}
+
+size_t Preferences::getBytesLength(const char *key)
+{
+    std::lock_guard<std::mutex> guard(nvsLock);
+
+    if (!started)
+    {
+        return 0;
+    }
+    Native::nvsReads++;
+    auto &keys = nvs[space];
+    auto found = keys.find(key);
+    return found == keys.end() ? 0 : found->second.size();
+}
+
+size_t Preferences::getBytes(const char *key, void *buffer, size_t length)
+{
+    return get(key, buffer, length, false);
+}
\ No newline at end of file
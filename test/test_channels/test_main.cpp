@@ -0,0 +1,90 @@
+// LED channel lookup, the constexpr GPIO table against the all_leds scan it replaced, and what each way of reaching an LED's status costs
+#include <unity.h>
+#include <native.hpp>
+#include <ozsec/lights.hpp>
+#include <chrono>
+
+#define BENCH_ROUNDS 2000000 // Times every LED's status is read for the timing
+
+/// @brief Lights::getLedIndex() as it was before the table, a scan of all_leds
+static int scanIndex(int led)
+{
+    for (int i = 0; i < SIMPLE_NUM_LEDS; i++)
+    {
+        if (all_leds[i] == led)
+        {
+            return i;
+        }
+    }
+    return -1;
+}
+
+/// @return Time in ns one status read takes. Mode 0 scans for the pin, 1 looks the pin up in the table, 2 takes the channel.
+static double nanosecondsPerRead(int mode)
+{
+    volatile int pins[SIMPLE_NUM_LEDS];
+    volatile int sink = 0;
+
+    for (int i = 0; i < SIMPLE_NUM_LEDS; i++)
+    {
+        pins[i] = all_leds[i];
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    for (int round = 0; round < BENCH_ROUNDS; round++)
+    {
+        for (int i = 0; i < SIMPLE_NUM_LEDS; i++)
+        {
+            if (mode == 0)
+            {
+                int index = scanIndex(pins[i]);
+                sink = sink + (index != -1 ? Lights::ledStatus[index] : 0);
+            }
+            else if (mode == 1)
+            {
+                sink = sink + Lights::getLedStatus(Lights::getLedIndex(pins[i]));
+            }
+            else
+            {
+                sink = sink + Lights::getLedStatus(i);
+            }
+        }
+    }
+    return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / BENCH_ROUNDS / SIMPLE_NUM_LEDS;
+}
+
+void setUp()
+{
+}
+
+void tearDown()
+{
+}
+
+void test_table_matches_the_scan()
+{
+    for (int pin = -1; pin <= GPIO_NUM_MAX; pin++)
+    {
+        TEST_ASSERT_EQUAL_MESSAGE(scanIndex(pin), Lights::getLedIndex(pin), String(pin).c_str());
+    }
+}
+
+void test_lookup_cost()
+{
+    const char *names[] = {"scan of all_leds", "GPIO table", "channel"};
+    char report[128];
+
+    for (int mode = 0; mode < 3; mode++)
+    {
+        snprintf(report, sizeof(report), "status by %s: %.2f ns per LED on the host", names[mode], nanosecondsPerRead(mode));
+        TEST_MESSAGE(report);
+    }
+}
+
+int main()
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_table_matches_the_scan);
+    RUN_TEST(test_lookup_cost);
+    return UNITY_END();
+}
\ No newline at end of file
@@ -0,0 +1,133 @@
+// System command lookup, every name finds its command and what a dispatch costs against the old String split and if chain
+#include <unity.h>
+#include <native.hpp>
+#include <ozsec/adventure.hpp>
+#include <chrono>
+#include <vector>
+
+#define BENCH_ROUNDS 200000 // Times each input is dispatched for the timing
+
+struct AdventureProbe
+{
+    static const Command *findCommand(const char *name, size_t length)
+    {
+        return Adventure::findCommand(name, length);
+    }
+};
+
+// Every command name and alias, in the order of the old if chain in systemCommand()
+const char *commandNames[] = {"help", "save", "load", "exit", "wifi", "inventory", "i", "look", "l", "nickname", "whoami", "reset",
+                              "twinkle", "stats", "badge", "scan", "notebook", "write", "beacon", "cheat", "debug", "goto", "toggle", "complete"};
+
+// Words that are not commands, what most room input looks like to the lookup
+const char *otherWords[] = {"north", "xyzzy", "select", "boot", "flag", "take", "hel", "helpp", "Help", "inv", ""};
+
+/// @brief How systemCommand() found a command before the hash table, split with Strings then compare each name
+/// @return Index in commandNames, or -1
+static int ifChain(const String &command)
+{
+    String program = command;
+    String arguments = "";
+    int spaceIndex = command.indexOf(' ');
+
+    if (spaceIndex != -1)
+    {
+        program = command.substring(0, spaceIndex);
+        arguments = command.substring(spaceIndex + 1);
+    }
+    for (size_t i = 0; i < sizeof(commandNames) / sizeof(commandNames[0]); i++)
+    {
+        if (program == commandNames[i])
+        {
+            return i;
+        }
+    }
+    return -1;
+}
+
+/// @brief Look a command up the way resolve() does, the name is everything up to the first space
+static const Command *hashTable(const String &command)
+{
+    const char *text = command.c_str();
+    const char *space = strchr(text, ' ');
+
+    return AdventureProbe::findCommand(text, space == NULL ? command.length() : space - text);
+}
+
+static double dispatchesPerSecond(const std::vector<String> &inputs, bool table)
+{
+    volatile uintptr_t sink = 0;
+    auto start = std::chrono::steady_clock::now();
+
+    for (int round = 0; round < BENCH_ROUNDS; round++)
+    {
+        for (const String &input : inputs)
+        {
+            sink = sink + (table ? (uintptr_t)hashTable(input) : (uintptr_t)ifChain(input));
+        }
+    }
+    return BENCH_ROUNDS * inputs.size() / std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+void setUp()
+{
+}
+
+void tearDown()
+{
+}
+
+void test_every_name_finds_its_command()
+{
+    for (const char *name : commandNames)
+    {
+        const Command *command = AdventureProbe::findCommand(name, strlen(name));
+        TEST_ASSERT_NOT_NULL(command);
+        TEST_ASSERT_TRUE_MESSAGE(strcmp(command->name, name) == 0 || (command->alias != NULL && strcmp(command->alias, name) == 0), name);
+    }
+
+    // Only the name counts, whatever follows it
+    const Command *write = AdventureProbe::findCommand("write a note", 5);
+    TEST_ASSERT_NOT_NULL(write);
+    TEST_ASSERT_EQUAL_STRING("write", write->name);
+    TEST_ASSERT_EQUAL(COMMAND_TEXT, write->argument);
+}
+
+void test_other_words_find_nothing()
+{
+    for (const char *word : otherWords)
+    {
+        TEST_ASSERT_NULL(AdventureProbe::findCommand(word, strlen(word)));
+        TEST_ASSERT_EQUAL(-1, ifChain(word));
+    }
+}
+
+void test_dispatch_rate()
+{
+    std::vector<String> commands(commandNames, commandNames + sizeof(commandNames) / sizeof(commandNames[0]));
+    std::vector<String> others(otherWords, otherWords + sizeof(otherWords) / sizeof(otherWords[0]));
+    commands.push_back("write a note");
+    commands.push_back("goto 12");
+
+    for (const String &input : commands)
+    {
+        TEST_ASSERT_EQUAL(hashTable(input) != NULL, ifChain(input) != -1);
+    }
+
+    char report[160];
+    snprintf(report, sizeof(report), "commands: %.1f M dispatches/s with the hash table, %.1f M/s with the if chain",
+             dispatchesPerSecond(commands, true) / 1e6, dispatchesPerSecond(commands, false) / 1e6);
+    TEST_MESSAGE(report);
+    snprintf(report, sizeof(report), "other words: %.1f M dispatches/s with the hash table, %.1f M/s with the if chain",
+             dispatchesPerSecond(others, true) / 1e6, dispatchesPerSecond(others, false) / 1e6);
+    TEST_MESSAGE(report);
+}
+
+int main()
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_every_name_finds_its_command);
+    RUN_TEST(test_other_words_find_nothing);
+    RUN_TEST(test_dispatch_rate);
+    return UNITY_END();
+}
\ No newline at end of file
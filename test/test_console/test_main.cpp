@@ -0,0 +1,166 @@
+// Console output to a serial host that is slow or stopped reading, for each CONSOLE_POLICY.
+// Runs on the host clock, the console task and the writer really wait on each other.
+#include <unity.h>
+#include <native.hpp>
+#include <ozsec/console.hpp>
+#include <chrono>
+#include <thread>
+
+#define LINE_LENGTH 64                           // Bytes in each test line, "\r\n" included
+#define LINES (3 * CONSOLE_BUFFER / LINE_LENGTH) // Lines written, three buffers worth
+#define HOST_STALL 300                           // Time in ms a slow host stops reading for
+
+/// @brief Write test lines one write each, numbered so missing and cut lines show
+/// @return Time in ms the writes took
+static unsigned long writeLines(int lines = LINES)
+{
+    char line[LINE_LENGTH];
+    auto start = std::chrono::steady_clock::now();
+
+    for (int i = 0; i < lines; i++)
+    {
+        int length = snprintf(line, sizeof(line), "line %04d ", i);
+        memset(line + length, '.', LINE_LENGTH - 2 - length);
+        memcpy(line + LINE_LENGTH - 2, "\r\n", 2);
+        Console.write((const uint8_t *)line, LINE_LENGTH);
+    }
+    return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+}
+
+/// @brief Let the host read everything left and get the output
+static std::string hostReadsAll()
+{
+    Native::hostRoom = -1;
+    Console.flush();
+    std::this_thread::sleep_for(std::chrono::milliseconds(50)); // The last chunk the console task took
+    return Native::takeSerial();
+}
+
+/// @brief Count the lines that came out whole
+static int wholeLines(const std::string &out)
+{
+    int lines = 0;
+
+    for (size_t start = 0, end; (end = out.find("\r\n", start)) != std::string::npos; start = end + 2)
+    {
+        if (end - start == LINE_LENGTH - 2 && out.compare(start, 5, "line ") == 0)
+        {
+            lines++;
+        }
+    }
+    return lines;
+}
+
+void setUp()
+{
+    hostReadsAll();
+    Console.queued = 0;
+    Console.dropped = 0;
+    Console.blockedTime = 0;
+}
+
+void tearDown()
+{
+    hostReadsAll();
+    Console.policy = CONSOLE_POLICY;
+}
+
+void test_burst_that_fits_is_not_cut()
+{
+    // Even with the host stopped, output that fits in the buffer waits there whole
+    Console.policy = CONSOLE_TRUNCATE;
+    Native::hostRoom = 0;
+    writeLines(CONSOLE_BUFFER / LINE_LENGTH - 1);
+    std::string out = hostReadsAll();
+
+    TEST_ASSERT_EQUAL(CONSOLE_BUFFER / LINE_LENGTH - 1, wholeLines(out));
+    TEST_ASSERT_EQUAL(out.size(), Console.queued);
+    TEST_ASSERT_EQUAL(0, Console.dropped);
+}
+
+void test_drop_keeps_whole_writes()
+{
+    Console.policy = CONSOLE_DROP;
+    Native::hostRoom = 0;
+    unsigned long elapsed = writeLines();
+    std::string out = hostReadsAll();
+
+    // The writer never waits, writes that did not fit are gone whole and nothing marks the gap
+    TEST_ASSERT_LESS_THAN(CONSOLE_BLOCK_TIMEOUT / 2, elapsed);
+    TEST_ASSERT_EQUAL(LINES * LINE_LENGTH, Console.queued + Console.dropped);
+    TEST_ASSERT_GREATER_THAN(0, Console.dropped);
+    TEST_ASSERT_EQUAL(0, Console.dropped % LINE_LENGTH);
+    TEST_ASSERT_EQUAL(Console.queued, out.size());
+    TEST_ASSERT_EQUAL(Console.queued / LINE_LENGTH, wholeLines(out));
+    TEST_ASSERT_TRUE(out.find("[...]") == std::string::npos);
+}
+
+void test_truncate_marks_the_cut()
+{
+    Console.policy = CONSOLE_TRUNCATE;
+    Native::hostRoom = 0;
+    unsigned long elapsed = writeLines();
+    std::string out = hostReadsAll();
+
+    // Output up to the cut, the marker, then nothing until the host reads again
+    TEST_ASSERT_LESS_THAN(CONSOLE_BLOCK_TIMEOUT / 2, elapsed);
+    TEST_ASSERT_EQUAL(LINES * LINE_LENGTH, Console.queued + Console.dropped);
+    TEST_ASSERT_GREATER_THAN(0, Console.dropped);
+    size_t marker = out.find(CONSOLE_MARKER);
+    TEST_ASSERT_TRUE(marker != std::string::npos);
+    TEST_ASSERT_EQUAL(out.size() - strlen(CONSOLE_MARKER), marker);
+    TEST_ASSERT_EQUAL(0, out.compare(0, 10, "line 0000 "));
+    TEST_ASSERT_LESS_OR_EQUAL(CONSOLE_BUFFER + CONSOLE_CHUNK, out.size());
+}
+
+void test_block_pauses_the_writer()
+{
+    Console.policy = CONSOLE_BLOCK;
+    Native::hostRoom = 0;
+
+    // The host stops reading for a while, then reads everything
+    std::thread host([] {
+        std::this_thread::sleep_for(std::chrono::milliseconds(HOST_STALL));
+        Native::hostRoom = -1;
+    });
+    unsigned long elapsed = writeLines();
+    host.join();
+    std::string out = hostReadsAll();
+
+    TEST_ASSERT_GREATER_OR_EQUAL(HOST_STALL - 20, elapsed);
+    TEST_ASSERT_GREATER_OR_EQUAL((HOST_STALL - 20) * 1000, Console.blockedTime);
+    TEST_ASSERT_LESS_THAN(CONSOLE_BLOCK_TIMEOUT * 1000, Console.blockedTime);
+    TEST_ASSERT_EQUAL(0, Console.dropped);
+    TEST_ASSERT_EQUAL(LINES, wholeLines(out));
+    TEST_ASSERT_TRUE(out.find("[...]") == std::string::npos);
+}
+
+void test_block_gives_up_on_a_stopped_host()
+{
+    Console.policy = CONSOLE_BLOCK;
+    Native::hostRoom = 0;
+    unsigned long elapsed = writeLines();
+    std::string out = hostReadsAll();
+
+    // One write waits CONSOLE_BLOCK_TIMEOUT, then the output is cut like CONSOLE_TRUNCATE.
+    // millis() counts whole ms, so the wait can end up to 1 ms short of the timeout on the host clock.
+    TEST_ASSERT_GREATER_OR_EQUAL(CONSOLE_BLOCK_TIMEOUT - 1, elapsed);
+    TEST_ASSERT_LESS_THAN(2 * CONSOLE_BLOCK_TIMEOUT, elapsed);
+    TEST_ASSERT_GREATER_OR_EQUAL((CONSOLE_BLOCK_TIMEOUT - 1) * 1000, Console.blockedTime);
+    TEST_ASSERT_GREATER_THAN(0, Console.dropped);
+    TEST_ASSERT_EQUAL(out.size() - strlen(CONSOLE_MARKER), out.find(CONSOLE_MARKER));
+}
+
+int main()
+{
+    Native::realTime = true;
+    Console.init();
+
+    UNITY_BEGIN();
+    RUN_TEST(test_burst_that_fits_is_not_cut);
+    RUN_TEST(test_drop_keeps_whole_writes);
+    RUN_TEST(test_truncate_marks_the_cut);
+    RUN_TEST(test_block_pauses_the_writer);
+    RUN_TEST(test_block_gives_up_on_a_stopped_host);
+    return UNITY_END();
+}
\ No newline at end of file
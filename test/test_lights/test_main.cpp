@@ -0,0 +1,132 @@
+// LED fade timing against the virtual clock, Lights::tick() is called with the time the test picks
+#include <unity.h>
+#include <native.hpp>
+#include <ozsec/gamma.hpp>
+#include <ozsec/lights.hpp>
+
+#define FADE_START 1000 // Virtual time the fades start at
+#define FADE_LED 1      // A PWM map LED, LEDC channel 0
+
+/// @brief Level a fade from 0 should have reached after some time, a fade never runs ahead of this
+static int expectedLevel(unsigned long elapsed, int fadeTime)
+{
+    return min((int)(elapsed * LED_MAX_BRIGHTNESS / fadeTime), LED_MAX_BRIGHTNESS);
+}
+
+/// @brief Tick every period ms until the LED stops fading, checking the level after each tick
+/// @return Time the fade finished at
+static unsigned long runFade(unsigned long period, int fadeTime)
+{
+    while (Lights::isFading(FADE_LED))
+    {
+        Native::advance(period);
+        Lights::tick(Native::now);
+
+        unsigned long elapsed = Native::now - FADE_START;
+        int level = Lights::ledLevel[FADE_LED];
+        TEST_ASSERT_LESS_OR_EQUAL(expectedLevel(elapsed, fadeTime), level);
+        TEST_ASSERT_GREATER_OR_EQUAL(expectedLevel(elapsed, fadeTime) - 1, level);
+        TEST_ASSERT_LESS_OR_EQUAL_MESSAGE(FADE_START + fadeTime + period, Native::now, "fade ran long");
+    }
+    return Native::now;
+}
+
+void setUp()
+{
+    Native::now = FADE_START;
+    Lights::init();
+}
+
+void tearDown()
+{
+}
+
+void test_fade_steps_every_tick()
+{
+    Lights::ledOn(FADE_LED, true);
+    TEST_ASSERT_EQUAL(0, Lights::ledLevel[FADE_LED]); // ledOn() returns before any step
+
+    // One step every LED_FADE_TIME / 255 ms, a 1 ms tick sees each one
+    unsigned long finished = runFade(1, LED_FADE_TIME);
+    TEST_ASSERT_EQUAL(FADE_START + LED_FADE_TIME, finished);
+    TEST_ASSERT_EQUAL(LED_MAX_BRIGHTNESS, Lights::ledLevel[FADE_LED]);
+    TEST_ASSERT_EQUAL(ledGamma[LED_MAX_BRIGHTNESS], Native::ledcDuty[FADE_LED - 1]);
+}
+
+void test_fade_catches_up_on_late_ticks()
+{
+    Lights::ledOn(FADE_LED, true);
+
+    // A background loop that falls behind, one late tick covers every step it missed
+    Native::advance(200);
+    Lights::tick(Native::now);
+    TEST_ASSERT_EQUAL(expectedLevel(200, LED_FADE_TIME), Lights::ledLevel[FADE_LED]);
+
+    unsigned long finished = runFade(37, LED_FADE_TIME);
+    TEST_ASSERT_EQUAL(LED_MAX_BRIGHTNESS, Lights::ledLevel[FADE_LED]);
+    TEST_ASSERT_EQUAL(ledGamma[LED_MAX_BRIGHTNESS], Native::ledcDuty[FADE_LED - 1]);
+    TEST_ASSERT_LESS_THAN(FADE_START + LED_FADE_TIME + 37, finished);
+}
+
+void test_tick_after_fade_time_lands_on_target()
+{
+    Lights::ledOn(FADE_LED, true);
+
+    // Far past the fade time, the level stops at the target instead of running past it
+    Native::advance(10 * LED_FADE_TIME);
+    Lights::tick(Native::now);
+    TEST_ASSERT_EQUAL(LED_MAX_BRIGHTNESS, Lights::ledLevel[FADE_LED]);
+    TEST_ASSERT_FALSE(Lights::isFading(FADE_LED));
+
+    Lights::ledOff(FADE_LED, true);
+    Native::advance(10 * LED_FADE_TIME);
+    Lights::tick(Native::now);
+    TEST_ASSERT_EQUAL(0, Lights::ledLevel[FADE_LED]);
+    TEST_ASSERT_EQUAL(ledGamma[0], Native::ledcDuty[FADE_LED - 1]);
+}
+
+void test_retarget_keeps_fading_from_current_level()
+{
+    Lights::ledOn(FADE_LED, true);
+    Native::advance(LED_FADE_TIME / 2);
+    Lights::tick(Native::now);
+    int halfway = Lights::ledLevel[FADE_LED];
+
+    // Turning off mid fade goes back down from where it got to, at the same pace
+    Lights::ledOff(FADE_LED, true);
+    Native::advance(LED_FADE_TIME / 4);
+    Lights::tick(Native::now);
+    int level = Lights::ledLevel[FADE_LED];
+    TEST_ASSERT_LESS_OR_EQUAL(halfway - expectedLevel(LED_FADE_TIME / 4, LED_FADE_TIME) + 1, level);
+    TEST_ASSERT_GREATER_OR_EQUAL(halfway - expectedLevel(LED_FADE_TIME / 4, LED_FADE_TIME) - 1, level);
+
+    while (Lights::isFading(FADE_LED))
+    {
+        Native::advance(16);
+        Lights::tick(Native::now);
+    }
+    TEST_ASSERT_EQUAL(0, Lights::ledLevel[FADE_LED]);
+}
+
+void test_idle_leds_are_not_written()
+{
+    unsigned long writes = Native::ledcWrites;
+
+    for (int i = 0; i < 100; i++)
+    {
+        Native::advance(LED_FRAME_PERIOD);
+        Lights::tick(Native::now);
+    }
+    TEST_ASSERT_EQUAL(writes, Native::ledcWrites);
+}
+
+int main()
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_fade_steps_every_tick);
+    RUN_TEST(test_fade_catches_up_on_late_ticks);
+    RUN_TEST(test_tick_after_fade_time_lands_on_target);
+    RUN_TEST(test_retarget_keeps_fading_from_current_level);
+    RUN_TEST(test_idle_leds_are_not_written);
+    return UNITY_END();
+}
\ No newline at end of file
@@ -0,0 +1,188 @@
+// NPC dialog tables in flash, static initialisation allocates nothing, against what copying every line into Strings at boot cost
+#include <unity.h>
+#include <native.hpp>
+#include <ozsec/adventure.hpp>
+#include <chrono>
+#include <new>
+#include <vector>
+
+#define BOOT_COPIES 2          // Translation units on the badge that include npcs.hpp, main.cpp and adventure.cpp
+#define BENCH_PASSES 1000      // Times the old tables are built for the timing
+#define STAND_IN_ALLOCATIONS 2 // Allocations test/native makes before main(), starting the BackgroundTask thread
+
+static unsigned long allocations; // Heap allocations made through new, counted from before static initialisation
+static unsigned long allocatedBytes;
+static unsigned long allocationsBeforeMain;
+
+void *operator new(size_t size)
+{
+    allocations++;
+    allocatedBytes += size;
+    void *p = malloc(size);
+    if (p == NULL)
+    {
+        throw std::bad_alloc();
+    }
+    return p;
+}
+
+void operator delete(void *p) noexcept
+{
+    free(p);
+}
+
+void operator delete(void *p, size_t size) noexcept
+{
+    free(p);
+}
+
+// Dialog as it was before the tables moved to flash, static initialisation copied each line into a String
+struct StringDialog
+{
+    int id;
+    String text;
+    String response1;
+    int response1_id;
+    String response2;
+    int response2_id;
+};
+
+struct StringNpc
+{
+    int id;
+    String name;
+    std::vector<StringDialog> dialog;
+};
+
+struct DialogTable
+{
+    const Dialog *dialog;
+    size_t length;
+};
+
+#define DIALOG_TABLE(name) {name, sizeof(name) / sizeof(name[0])}
+
+// Every dialog table in npcs.hpp
+const DialogTable dialogTables[] = {
+    DIALOG_TABLE(dialogSimon), DIALOG_TABLE(dialogBob), DIALOG_TABLE(dialogChanuteReporter), DIALOG_TABLE(dialogWaterManager),
+    DIALOG_TABLE(dialogWaterReceptionist), DIALOG_TABLE(dialogBankTeller), DIALOG_TABLE(dialogPittsburgTownHall),
+    DIALOG_TABLE(dialogPittsburgCourthouse), DIALOG_TABLE(dialogPittsburgStacey), DIALOG_TABLE(dialogPittsburgDean),
+    DIALOG_TABLE(dialogWichitaAirport), DIALOG_TABLE(dialogGoodlandRepair), DIALOG_TABLE(dialogGoodlandTelecom),
+    DIALOG_TABLE(dialogBusManager), DIALOG_TABLE(dialogPrincipal), DIALOG_TABLE(dialogitSpecialist)};
+
+/// @brief Find the length of an NPC's dialog table
+static size_t dialogLength(const Dialog *dialog)
+{
+    for (const DialogTable &table : dialogTables)
+    {
+        if (table.dialog == dialog)
+        {
+            return table.length;
+        }
+    }
+    return 0;
+}
+
+/// @brief Do what static initialisation did for one copy of the old tables, the StringNpc vector stands in for the arrays
+static void buildStringTables(std::vector<StringNpc> &npcs)
+{
+    for (const Npc &entry : npc)
+    {
+        StringNpc copy = {entry.id, entry.name, {}};
+        for (size_t i = 0; i < dialogLength(entry.dialog); i++)
+        {
+            const Dialog &line = entry.dialog[i];
+            copy.dialog.push_back({line.id, line.text, line.response1, line.response1_id, line.response2, line.response2_id});
+        }
+        npcs.push_back(std::move(copy));
+    }
+}
+
+void setUp()
+{
+}
+
+void tearDown()
+{
+}
+
+void test_every_npc_dialog_is_listed()
+{
+    for (const Npc &entry : npc)
+    {
+        TEST_ASSERT_GREATER_THAN_MESSAGE(0, dialogLength(entry.dialog), entry.name);
+    }
+}
+
+void test_static_initialisation_copies_no_text()
+{
+    char report[128];
+    snprintf(report, sizeof(report), "static initialisation: %lu allocations before main(), %d of them by test/native",
+             allocationsBeforeMain, STAND_IN_ALLOCATIONS);
+    TEST_MESSAGE(report);
+
+    TEST_ASSERT_LESS_OR_EQUAL(STAND_IN_ALLOCATIONS, allocationsBeforeMain);
+}
+
+void test_string_tables_cost()
+{
+    unsigned long lines = 0;
+    unsigned long textBytes = 0;
+    unsigned long stringAllocations;
+    unsigned long stringBytes;
+
+    // Count the Strings alone, reserved up front so only the copies of the text allocate
+    std::vector<String> texts;
+    texts.reserve(sizeof(npc) / sizeof(npc[0]) * 64);
+    unsigned long before = allocations;
+    unsigned long beforeBytes = allocatedBytes;
+    for (const Npc &entry : npc)
+    {
+        texts.emplace_back(entry.name);
+        textBytes += strlen(entry.name) + 1;
+        for (size_t i = 0; i < dialogLength(entry.dialog); i++)
+        {
+            const Dialog &line = entry.dialog[i];
+            for (const char *text : {line.text, line.response1, line.response2})
+            {
+                texts.emplace_back(text);
+                textBytes += strlen(text) + 1;
+            }
+            lines++;
+        }
+    }
+    stringAllocations = allocations - before;
+    stringBytes = allocatedBytes - beforeBytes;
+    TEST_ASSERT_EQUAL(sizeof(npc) / sizeof(npc[0]) * 64, texts.capacity()); // Nothing was counted for growing the vector
+
+    // Time building whole copies, as setup() waited for before
+    auto start = std::chrono::steady_clock::now();
+    for (int pass = 0; pass < BENCH_PASSES; pass++)
+    {
+        std::vector<StringNpc> copy;
+        copy.reserve(sizeof(npc) / sizeof(npc[0]));
+        buildStringTables(copy);
+    }
+    double microseconds = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count() / BENCH_PASSES;
+
+    char report[160];
+    snprintf(report, sizeof(report), "String tables: %lu dialog lines, %lu bytes of text, %lu heap allocations holding %lu bytes per copy",
+             lines, textBytes, stringAllocations, stringBytes);
+    TEST_MESSAGE(report);
+    snprintf(report, sizeof(report), "String tables: %d copies at boot cost %lu allocations, %lu heap bytes and %.1f us on the host, now none",
+             BOOT_COPIES, BOOT_COPIES * stringAllocations, BOOT_COPIES * stringBytes, BOOT_COPIES * microseconds);
+    TEST_MESSAGE(report);
+
+    TEST_ASSERT_GREATER_THAN(0, stringAllocations);
+}
+
+int main()
+{
+    allocationsBeforeMain = allocations;
+
+    UNITY_BEGIN();
+    RUN_TEST(test_every_npc_dialog_is_listed);
+    RUN_TEST(test_static_initialisation_copies_no_text);
+    RUN_TEST(test_string_tables_cost);
+    return UNITY_END();
+}
\ No newline at end of file
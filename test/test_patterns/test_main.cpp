@@ -0,0 +1,79 @@
+// Keyframe playback, what Lights::play() writes and what one animation frame of it costs on the host
+#include <unity.h>
+#include <native.hpp>
+#include <ozsec/lights.hpp>
+#include <ozsec/patterns.hpp>
+#include <chrono>
+
+#define BENCH_FRAMES 200000 // Frames played for the timing, spread over the whole pattern
+
+void setUp()
+{
+    Native::now = 0;
+    Lights::init();
+}
+
+void tearDown()
+{
+}
+
+void test_keyframes_are_hit()
+{
+    // Part way up a map LED's ramp, and at the top of it
+    Lights::play(heartbeatPattern, 100);
+    TEST_ASSERT_EQUAL(PATTERN_LED_ON * 4 / 9 * LED_MAX_BRIGHTNESS / 255, Lights::ledLevel[7]);
+    Lights::play(heartbeatPattern, 105);
+    TEST_ASSERT_EQUAL(PATTERN_LED_ON * LED_MAX_BRIGHTNESS / 255, Lights::ledLevel[7]);
+    TEST_ASSERT_EQUAL(0, Lights::ledLevel[5]);
+    Lights::play(heartbeatPattern, 175);
+    TEST_ASSERT_EQUAL(PATTERN_LED_ON * LED_MAX_BRIGHTNESS / 255, Lights::ledLevel[5]);
+
+    // Everything is off again at the end of a loop and while the pattern rests
+    Lights::play(heartbeatPattern, 242);
+    for (int i = 1; i < SIMPLE_NUM_LEDS; i++)
+    {
+        TEST_ASSERT_EQUAL(0, Lights::ledLevel[i]);
+    }
+}
+
+void test_rest_writes_nothing()
+{
+    Lights::play(heartbeatPattern, heartbeatPattern.loops * heartbeatPattern.period);
+    unsigned long writes = Native::ledcWrites;
+
+    for (unsigned long t = heartbeatPattern.loops * heartbeatPattern.period; t < heartbeatPattern.duration; t++)
+    {
+        Lights::play(heartbeatPattern, t);
+    }
+    TEST_ASSERT_EQUAL(writes, Native::ledcWrites);
+}
+
+void test_frame_cost()
+{
+    unsigned long writes = Native::ledcWrites;
+    auto start = std::chrono::steady_clock::now();
+
+    for (unsigned long frame = 0; frame < BENCH_FRAMES; frame++)
+    {
+        Lights::play(heartbeatPattern, frame * LED_FRAME_PERIOD);
+    }
+
+    double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / BENCH_FRAMES;
+    double dutyWrites = (double)(Native::ledcWrites - writes) / BENCH_FRAMES;
+    char report[128];
+    snprintf(report, sizeof(report), "play(): %.0f ns per frame on the host, %.2f LEDC writes per frame", ns, dutyWrites);
+    TEST_MESSAGE(report);
+
+    // Far inside the frame budget even on a slow host, a frame over it means play() does much more work than it should
+    TEST_ASSERT_LESS_THAN(LED_FRAME_BUDGET * 1000.0 / 100, ns);
+    TEST_ASSERT_LESS_THAN(SIMPLE_NUM_LEDS, dutyWrites);
+}
+
+int main()
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_keyframes_are_hit);
+    RUN_TEST(test_rest_writes_nothing);
+    RUN_TEST(test_frame_cost);
+    return UNITY_END();
+}
\ No newline at end of file
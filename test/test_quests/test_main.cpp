@@ -0,0 +1,262 @@
+// Quest flags and goals. Playing the game reaches every quest, goals kept up as flags change match a full evaluation,
+// and a reader on another thread never sees half of one published update and half of the next.
+// The seqlock stress run only races on a host with more than one core, the half published update is checked on any host.
+#include <unity.h>
+#include <native.hpp>
+#include <ozsec/adventure.hpp>
+#include <ozsec/quests.hpp>
+#include <ozsec/storage.hpp>
+#include <ozsec/timeline.hpp>
+#include <atomic>
+#include <chrono>
+#include <random>
+#include <thread>
+
+#define PUBLISHES 2000000   // Updates the writer thread publishes while the reader takes snapshots
+#define READER_WAIT 50      // Time in ms a reader is given to return a half published update
+#define FLAG_CHANGES 200000 // Random quest flag changes checked against a full evaluation
+#define DIALOG_DEPTH 8      // Most answers given in a row when trying an NPC's dialog
+#define PLAY_SWEEPS 10      // Most times every room is played through before giving up on a quest
+
+extern unsigned long questUpdates;
+extern unsigned long questChecks;
+
+struct AdventureProbe
+{
+    static CharacterState &player(Adventure &adventure)
+    {
+        return adventure.player;
+    }
+    static void show(Adventure &adventure)
+    {
+        adventure.show();
+    }
+    static void setFlag(Adventure &adventure, QuestFlag flag, bool value)
+    {
+        adventure.setFlag(flag, value);
+    }
+    static void evaluateQuests(Adventure &adventure)
+    {
+        adventure.evaluateQuests();
+    }
+};
+
+struct QuestsProbe
+{
+    /// @brief Publish like Quests::publish() up to the first half, as if the game loop was interrupted there
+    static void publishLow(uint64_t bits)
+    {
+        Quests::sequence++;
+        Quests::low = (uint32_t)bits;
+    }
+    static void publishHigh(uint64_t bits)
+    {
+        Quests::high = (uint32_t)(bits >> 32);
+        Quests::sequence++;
+    }
+};
+
+Adventure adventure;
+
+/// @brief Play one command the way prompt() would and let its timed output finish
+static void play(const std::string &command)
+{
+    adventure.processPromptResponse(command.c_str());
+    AdventureProbe::show(adventure);
+    while (Timeline::busy(millis()))
+    {
+        Native::advance(Timeline::wait(millis()));
+        Timeline::run(millis());
+    }
+    Native::takeSerial();
+}
+
+/// @brief Give every answer an NPC takes, following each one as deep as DIALOG_DEPTH
+/// @param answers Answers that lead to this point in the dialog
+static void tryDialog(int room, const char *option, const std::string &answers)
+{
+    CharacterState &player = AdventureProbe::player(adventure);
+
+    for (const char *answer : {"1", "2"})
+    {
+        play("goto " + std::to_string(room));
+        play(option);
+        for (char earlier : answers)
+        {
+            play(std::string(1, earlier));
+        }
+        int dialogIndex = player.dialogIndex;
+        play(answer);
+        bool more = player.npc != -1 && player.dialogIndex != dialogIndex;
+        if (player.npc != -1)
+        {
+            play("0");
+        }
+        if (more && answers.size() + 1 < DIALOG_DEPTH)
+        {
+            tryDialog(room, option, answers + answer);
+        }
+    }
+}
+
+void setUp()
+{
+}
+
+void tearDown()
+{
+}
+
+void test_reader_waits_out_a_half_published_update()
+{
+    const uint64_t before = 0x1111111122222222;
+    const uint64_t after = 0x3333333344444444;
+    std::atomic<bool> read(false);
+    uint64_t bits = 0;
+
+    Quests::publish(before);
+    QuestsProbe::publishLow(after);
+    std::thread reader([&] {
+        bits = Quests::snapshot();
+        read = true;
+    });
+
+    // The low half is new and the high half old, the reader has to keep trying
+    std::this_thread::sleep_for(std::chrono::milliseconds(READER_WAIT));
+    bool readEarly = read;
+    QuestsProbe::publishHigh(after);
+    reader.join();
+
+    TEST_ASSERT_FALSE(readEarly);
+    TEST_ASSERT_TRUE(bits == after);
+}
+
+void test_playing_reaches_every_quest()
+{
+    // Only goto is used to get around, the quests are done by the room actions and NPCs themselves
+    Native::nvsErase();
+    Native::bleFound = true;
+    adventure.init();
+    AdventureProbe::show(adventure);
+    play("cheat motherlode");
+    play("scan");
+
+    // Try every option of every room and every answer to every NPC until no more quests get done
+    CharacterState &player = AdventureProbe::player(adventure);
+    uint64_t before = ~adventure.game.quests.bits;
+    int sweeps = 0;
+    while (adventure.game.quests.bits != before && sweeps < PLAY_SWEEPS)
+    {
+        before = adventure.game.quests.bits;
+        sweeps++;
+        for (int room = 0; room < Rooms::idCount(); room++)
+        {
+            for (int i = 0; Rooms::exists(room) && i < Rooms::optionCount(room); i++)
+            {
+                const char *option = Rooms::option(room, i);
+                play("goto " + std::to_string(room));
+                if (player.room != room)
+                {
+                    break; // Locked until a goal is met
+                }
+                play(option);
+                if (player.npc != -1)
+                {
+                    play("0");
+                    tryDialog(room, option, "");
+                }
+            }
+        }
+    }
+    Storage::sync();
+
+    char report[128];
+    snprintf(report, sizeof(report), "quests: %d of %d flags set and %d of %d goals met after %d sweeps",
+             __builtin_popcountll(adventure.game.quests.bits), QUEST_COUNT, __builtin_popcount(adventure.game.goals.met), GOAL_COUNT, sweeps);
+    TEST_MESSAGE(report);
+
+    for (int flag = 0; flag < QUEST_COUNT; flag++)
+    {
+        TEST_ASSERT_TRUE_MESSAGE(adventure.game.quests.has((QuestFlag)flag), ("quest flag " + std::to_string(flag) + " is never set").c_str());
+    }
+    for (int goal = 0; goal < GOAL_COUNT; goal++)
+    {
+        TEST_ASSERT_TRUE_MESSAGE(adventure.game.goals.has((QuestGoal)goal), ("quest goal " + std::to_string(goal) + " is never met").c_str());
+    }
+}
+
+void test_goals_kept_up_match_a_full_evaluation()
+{
+    std::mt19937 random(25);
+    unsigned long updates = questUpdates;
+    unsigned long checks = questChecks;
+
+    adventure.game.quests.bits = 0;
+    AdventureProbe::evaluateQuests(adventure);
+    for (int i = 0; i < FLAG_CHANGES; i++)
+    {
+        // Mostly set flags so the goals near the end of the game get met too
+        QuestFlag flag = (QuestFlag)(random() % QUEST_COUNT);
+        AdventureProbe::setFlag(adventure, flag, random() % 4 != 0);
+        Native::takeSerial();
+
+        uint32_t kept = adventure.game.goals.met;
+        AdventureProbe::evaluateQuests(adventure);
+        TEST_ASSERT_EQUAL_MESSAGE(adventure.game.goals.met, kept, std::to_string(i).c_str());
+    }
+
+    char report[128];
+    snprintf(report, sizeof(report), "goals: %lu checked for %lu flag changes, a full evaluation each time checks %lu",
+             questChecks - checks, questUpdates - updates, (questUpdates - updates) * GOAL_COUNT);
+    TEST_MESSAGE(report);
+}
+
+void test_snapshot_is_never_torn()
+{
+    // Both halves of each update hold the same count, so a torn read has halves that differ
+    std::atomic<bool> done(false);
+    Quests::publish(0);
+    std::thread writer([&done] {
+        for (uint64_t i = 1; i <= PUBLISHES; i++)
+        {
+            Quests::publish(i << 32 | i);
+        }
+        done = true;
+    });
+
+    unsigned long reads = Quests::reads;
+    unsigned long retries = Quests::retries;
+    unsigned long torn = 0;
+    unsigned long backwards = 0;
+    uint32_t last = 0;
+    while (!done)
+    {
+        uint64_t bits = Quests::snapshot();
+        uint32_t low = (uint32_t)bits;
+        torn += (uint32_t)(bits >> 32) != low;
+        backwards += low < last;
+        last = low;
+    }
+    writer.join();
+
+    char report[128];
+    snprintf(report, sizeof(report), "seqlock: %lu snapshots during %d publishes, %lu read again", Quests::reads - reads, PUBLISHES,
+             Quests::retries - retries);
+    TEST_MESSAGE(report);
+
+    TEST_ASSERT_EQUAL(0, torn);
+    TEST_ASSERT_EQUAL(0, backwards);
+    TEST_ASSERT_TRUE(Quests::snapshot() == ((uint64_t)PUBLISHES << 32 | PUBLISHES));
+}
+
+int main()
+{
+    Storage::init();
+
+    UNITY_BEGIN();
+    RUN_TEST(test_playing_reaches_every_quest);
+    RUN_TEST(test_goals_kept_up_match_a_full_evaluation);
+    RUN_TEST(test_reader_waits_out_a_half_published_update);
+    RUN_TEST(test_snapshot_is_never_torn);
+    return UNITY_END();
+}
\ No newline at end of file
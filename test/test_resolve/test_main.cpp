@@ -0,0 +1,142 @@
+// Input resolution, what each kind of input resolves to and how long resolve() takes per input against the two pass lookup it replaced
+#include <unity.h>
+#include <native.hpp>
+#include <ozsec/adventure.hpp>
+#include <chrono>
+
+#define BENCH_ROUNDS 1000000 // Times each input is resolved for the timing
+
+extern int konamiIndex;
+
+struct AdventureProbe
+{
+    static PlayerAction resolve(Adventure &adventure, int room, const char *text)
+    {
+        adventure.player.room = room;
+        return adventure.resolve(text, strlen(text));
+    }
+    static const RoomAction *findRoomAction(int room, const char *verb, size_t length)
+    {
+        return Adventure::findRoomAction(room, verb, length);
+    }
+    static const Command *findCommand(const char *name, size_t length)
+    {
+        return Adventure::findCommand(name, length);
+    }
+};
+
+// One input of each kind, the Konami code only counts in the Arcade
+struct ResolveCase
+{
+    int room;
+    const char *text;
+    ActionType type;
+} cases[] = {
+    {340, "e", ACTION_DIRECTION},
+    {340, "taxi", ACTION_ROOM},
+    {340, "leg", ACTION_ROOM},
+    {340, "inventory", ACTION_COMMAND},
+    {340, "write hello there", ACTION_COMMAND},
+    {340, "xyzzy", ACTION_UNKNOWN},
+    {497, "n", ACTION_KONAMI},
+    {497, "e", ACTION_DIRECTION},
+};
+
+Adventure adventure;
+
+/// @brief How processPromptResponse() got to the same place before resolve(), the input as a String,
+/// isRoomAction() then roomAction() each scanning the room's options, then the command split
+static uintptr_t twoPass(int room, const char *text)
+{
+    String action = text;
+
+    if (Rooms::hasOption(room, action.c_str()))
+    {
+        if (Rooms::hasOption(room, action.c_str()))
+        {
+            if (action == "n" || action == "e" || action == "w" || action == "s")
+            {
+                return 1;
+            }
+            return (uintptr_t)AdventureProbe::findRoomAction(room, action.c_str(), action.length());
+        }
+    }
+
+    String program = action;
+    int spaceIndex = action.indexOf(' ');
+    if (spaceIndex != -1)
+    {
+        program = action.substring(0, spaceIndex);
+    }
+    return (uintptr_t)AdventureProbe::findCommand(program.c_str(), program.length());
+}
+
+/// @return Time in ns one input takes, resolve() or the two pass lookup
+static double nanosecondsPerInput(const ResolveCase &input, bool single)
+{
+    volatile uintptr_t sink = 0;
+    auto start = std::chrono::steady_clock::now();
+
+    for (int round = 0; round < BENCH_ROUNDS; round++)
+    {
+        sink = sink + (single ? AdventureProbe::resolve(adventure, input.room, input.text).type : twoPass(input.room, input.text));
+    }
+    return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / BENCH_ROUNDS;
+}
+
+void setUp()
+{
+    konamiIndex = 0;
+}
+
+void tearDown()
+{
+}
+
+void test_inputs_resolve_to_their_type()
+{
+    for (const ResolveCase &input : cases)
+    {
+        TEST_ASSERT_EQUAL_MESSAGE(input.type, AdventureProbe::resolve(adventure, input.room, input.text).type, input.text);
+    }
+
+    PlayerAction action = AdventureProbe::resolve(adventure, 340, "write hello there");
+    TEST_ASSERT_EQUAL_STRING("write", action.command->name);
+    TEST_ASSERT_EQUAL_STRING("hello there", action.arguments);
+    TEST_ASSERT_EQUAL(EAST, AdventureProbe::resolve(adventure, 340, "e").direction);
+    TEST_ASSERT_NOT_NULL(AdventureProbe::resolve(adventure, 340, "taxi").roomAction);
+}
+
+void test_resolve_leaves_the_konami_code_alone()
+{
+    // Resolving says where the code would be, only running the action moves it
+    TEST_ASSERT_EQUAL(1, AdventureProbe::resolve(adventure, 497, "n").konami);
+    TEST_ASSERT_EQUAL(1, AdventureProbe::resolve(adventure, 497, "n").konami);
+    TEST_ASSERT_EQUAL(0, konamiIndex);
+
+    konamiIndex = 2;
+    TEST_ASSERT_EQUAL(3, AdventureProbe::resolve(adventure, 497, "s").konami);
+    TEST_ASSERT_EQUAL(ACTION_DIRECTION, AdventureProbe::resolve(adventure, 497, "e").type);
+    TEST_ASSERT_EQUAL(2, konamiIndex);
+}
+
+void test_resolve_latency()
+{
+    char report[160];
+
+    for (const ResolveCase &input : cases)
+    {
+        snprintf(report, sizeof(report), "room %d '%s': %.1f ns with resolve(), %.1f ns with the two pass lookup",
+                 input.room, input.text, nanosecondsPerInput(input, true), nanosecondsPerInput(input, false));
+        TEST_MESSAGE(report);
+    }
+}
+
+int main()
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_inputs_resolve_to_their_type);
+    RUN_TEST(test_resolve_leaves_the_konami_code_alone);
+    RUN_TEST(test_resolve_latency);
+    return UNITY_END();
+}
\ No newline at end of file
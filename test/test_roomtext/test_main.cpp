@@ -0,0 +1,107 @@
+// Huffman coded room text, every room decodes the same through each reader, and what decoding costs on the host
+#include <unity.h>
+#include <native.hpp>
+#include <ozsec/rooms.hpp>
+#include <ozsec/roomdata.hpp>
+#include <chrono>
+
+#define BENCH_PASSES 50 // Times every room's text is decoded for the timing
+
+// Collects printed output
+class Capture : public Print
+{
+public:
+    std::string text;
+    size_t write(uint8_t c) override
+    {
+        text += (char)c;
+        return 1;
+    }
+};
+
+/// @brief Decode room text with read(), checking peek() sees each byte first
+static std::string readAll(RoomText text)
+{
+    std::string out;
+    int c;
+
+    while ((c = text.peek()) != -1)
+    {
+        TEST_ASSERT_EQUAL(c, text.read());
+        out += (char)c;
+    }
+    TEST_ASSERT_EQUAL(-1, text.read());
+    return out;
+}
+
+void setUp()
+{
+}
+
+void tearDown()
+{
+}
+
+void test_readers_agree()
+{
+    for (int id = 0; id < Rooms::idCount(); id++)
+    {
+        RoomText texts[] = {Rooms::title(id), Rooms::description(id), Rooms::actions(id)};
+        for (RoomText &text : texts)
+        {
+            Capture printed;
+            printed.print(text);
+            std::string read = readAll(text);
+            TEST_ASSERT_EQUAL_STRING(read.c_str(), printed.text.c_str());
+            TEST_ASSERT_EQUAL_STRING(read.c_str(), text.toString().c_str());
+        }
+
+        if (Rooms::exists(id))
+        {
+            TEST_ASSERT_GREATER_THAN(0, readAll(Rooms::title(id)).size());
+        }
+        else
+        {
+            TEST_ASSERT_EQUAL(0, readAll(Rooms::description(id)).size());
+        }
+    }
+}
+
+void test_decode_throughput()
+{
+    unsigned long decoded = 0;
+    auto start = std::chrono::steady_clock::now();
+
+    for (int pass = 0; pass < BENCH_PASSES; pass++)
+    {
+        for (int id = 0; id < Rooms::idCount(); id++)
+        {
+            RoomText texts[] = {Rooms::title(id), Rooms::description(id), Rooms::actions(id)};
+            for (RoomText &text : texts)
+            {
+                while (text.read() != -1)
+                {
+                    decoded++;
+                }
+            }
+        }
+    }
+
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    unsigned long plain = decoded / BENCH_PASSES;
+    double ratio = (double)sizeof(roomText) / plain;
+    char report[160];
+    snprintf(report, sizeof(report), "room text: %lu bytes coded as %u (%.1f%%), decoded at %.1f MB/s on the host",
+             plain, (unsigned)sizeof(roomText), ratio * 100, decoded / seconds / 1e6);
+    TEST_MESSAGE(report);
+
+    TEST_ASSERT_LESS_THAN(0.75, ratio);
+}
+
+int main()
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_readers_agree);
+    RUN_TEST(test_decode_throughput);
+    return UNITY_END();
+}
\ No newline at end of file
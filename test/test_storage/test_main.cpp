@@ -0,0 +1,186 @@
+// Saving through the storage task, counting the NVS operations and bytes each save costs
+#include <unity.h>
+#include <native.hpp>
+#include <ozsec/adventure.hpp>
+#include <ozsec/notebook.hpp>
+#include <ozsec/storage.hpp>
+#include <vector>
+
+#define LEGACY_SAVE_OPS 58 // NVS operations one save took in the old one key per value format
+
+Adventure adventure;
+
+/// @brief Read a key straight from NVS, the way the badge would see it after a restart
+static std::vector<uint8_t> readKey(const char *space, const char *key)
+{
+    Preferences nvs;
+    std::vector<uint8_t> value;
+
+    if (nvs.begin(space, true))
+    {
+        value.resize(nvs.getBytesLength(key));
+        nvs.getBytes(key, value.data(), value.size());
+        nvs.end();
+    }
+    return value;
+}
+
+static bool hasKey(const char *space, const char *key)
+{
+    Preferences nvs;
+    bool found = nvs.begin(space, true) && nvs.isKey(key);
+
+    nvs.end();
+    return found;
+}
+
+void setUp()
+{
+    Native::nvsErase();
+    Native::takeSerial();
+}
+
+void tearDown()
+{
+}
+
+void test_legacy_save_is_migrated()
+{
+    // A save as the old firmware wrote it
+    Preferences nvs;
+    nvs.begin("game-data", false);
+    nvs.putString("playername", "Zed");
+    nvs.putInt("playerroom", 61);
+    nvs.putString("playernotebook", "Notebook\r\n\r\nFlag: one\r\nFlag: two\r\n");
+    nvs.putInt("playerbeacon", 5);
+    nvs.putBool("qchanute", true);
+    nvs.putBool("qwichita", true);
+    nvs.end();
+    nvs.begin("game-data-inventory", false);
+    nvs.putBool("INIT", true);
+    nvs.putInt("a ladder", 1);
+    nvs.end();
+
+    adventure.init();
+    Storage::sync();
+
+    TEST_ASSERT_TRUE(adventure.game.quests.has(QUEST_CHANUTE));
+    TEST_ASSERT_TRUE(adventure.game.quests.has(QUEST_WICHITA));
+    TEST_ASSERT_FALSE(adventure.game.quests.has(QUEST_TOPEKA));
+
+    // The old keys are gone and the blob holds the player
+    TEST_ASSERT_FALSE(hasKey("game-data", "playername"));
+    TEST_ASSERT_FALSE(hasKey("game-data-inventory", "INIT"));
+    std::vector<uint8_t> blob = readKey(SAVE_NAMESPACE, SAVE_KEY_A);
+    TEST_ASSERT_GREATER_THAN(0, blob.size());
+    TEST_ASSERT_TRUE(std::string(blob.begin(), blob.end()).find("Zed") != std::string::npos);
+
+    // Each notebook line became an entry of its own
+    String notes;
+    class : public Print
+    {
+    public:
+        String *out;
+        size_t write(uint8_t c) override
+        {
+            *out += (char)c;
+            return 1;
+        }
+    } printer;
+    printer.out = &notes;
+    Notebook::print(printer);
+    TEST_ASSERT_EQUAL_STRING("Flag: one\r\nFlag: two\r\n", notes.c_str());
+}
+
+void test_save_is_one_write()
+{
+    adventure.init();
+    Storage::sync();
+    adventure.processPromptResponse("save"); // The first save writes slot A
+    Storage::sync();
+
+    unsigned long reads = Native::nvsReads;
+    unsigned long writes = Native::nvsWrites;
+    unsigned long bytes = Native::nvsBytes;
+    adventure.processPromptResponse("save");
+    Storage::sync();
+    reads = Native::nvsReads - reads;
+    writes = Native::nvsWrites - writes;
+    bytes = Native::nvsBytes - bytes;
+
+    char report[128];
+    snprintf(report, sizeof(report), "save: %lu NVS ops (%lu reads, %lu writes), %lu bytes, the old format took %d ops",
+             reads + writes, reads, writes, bytes, LEGACY_SAVE_OPS);
+    TEST_MESSAGE(report);
+
+    TEST_ASSERT_EQUAL(0, reads);
+    TEST_ASSERT_EQUAL(1, writes);
+    TEST_ASSERT_EQUAL(readKey(SAVE_NAMESPACE, SAVE_KEY_B).size(), bytes);
+
+    // Slots are written in turn, the older one is still there if this write is lost
+    TEST_ASSERT_GREATER_THAN(0, readKey(SAVE_NAMESPACE, SAVE_KEY_A).size());
+}
+
+void test_damaged_blob_falls_back_to_the_other_slot()
+{
+    adventure.init();
+    adventure.processPromptResponse("save");
+    adventure.game.quests.set(QUEST_TOPEKA, true);
+    adventure.processPromptResponse("save");
+    Storage::sync();
+
+    adventure.processPromptResponse("load");
+    TEST_ASSERT_TRUE(adventure.game.quests.has(QUEST_TOPEKA));
+
+    // Flip a bit in the newest slot, loading has to pick the older one
+    Preferences nvs;
+    std::vector<uint8_t> blob = readKey(SAVE_NAMESPACE, SAVE_KEY_B);
+    blob.back() ^= 1;
+    nvs.begin(SAVE_NAMESPACE, false);
+    nvs.putBytes(SAVE_KEY_B, blob.data(), blob.size());
+    nvs.end();
+
+    adventure.processPromptResponse("load");
+    TEST_ASSERT_FALSE(adventure.game.quests.has(QUEST_TOPEKA));
+}
+
+void test_notebook_entry_that_could_not_be_queued()
+{
+    adventure.init();
+    Storage::sync();
+
+    // Flash is busy, fill the storage queue with notes until one does not fit
+    Native::nvsStalled = true;
+    int queued = 0;
+    while (Notebook::add("note " + String(queued)))
+    {
+        queued++;
+        TEST_ASSERT_LESS_OR_EQUAL(STORAGE_QUEUE_LENGTH + 1, queued);
+    }
+    adventure.processPromptResponse("write lost");
+    TEST_ASSERT_EQUAL_STRING("You could not write 'lost' in your notebook, try again.", adventure.game.message.c_str());
+    Native::nvsStalled = false;
+    Storage::sync();
+
+    // The failed notes left no gap, the next one goes in the slot right after the last note queued
+    adventure.processPromptResponse("write kept");
+    TEST_ASSERT_EQUAL_STRING("You write 'kept' in your notebook.", adventure.game.message.c_str());
+    Storage::sync();
+    char key[4];
+    snprintf(key, sizeof(key), "n%d", queued);
+    std::vector<uint8_t> entry = readKey(NOTEBOOK_NAMESPACE, key);
+    TEST_ASSERT_EQUAL(queued + 1, entry.size() >= sizeof(uint32_t) ? *(uint32_t *)entry.data() : 0);
+    TEST_ASSERT_EQUAL_STRING("kept", std::string(entry.begin() + sizeof(uint32_t), entry.end()).c_str());
+}
+
+int main()
+{
+    Storage::init();
+
+    UNITY_BEGIN();
+    RUN_TEST(test_legacy_save_is_migrated);
+    RUN_TEST(test_save_is_one_write);
+    RUN_TEST(test_damaged_blob_falls_back_to_the_other_slot);
+    RUN_TEST(test_notebook_entry_that_could_not_be_queued);
+    return UNITY_END();
+}
\ No newline at end of file
@@ -0,0 +1,143 @@
+// Timed output against the virtual clock, the console is not started so lines go straight to Serial
+#include <unity.h>
+#include <native.hpp>
+#include <ozsec/timeline.hpp>
+#include <vector>
+
+static unsigned long start; // Virtual time the test started at, the clock only moves forward
+
+struct Printed
+{
+    unsigned long time;
+    std::string text;
+};
+
+/// @brief Run the timeline until it is done, jumping the clock to whatever is due next like Adventure::loop() sleeps
+static std::vector<Printed> runTimeline()
+{
+    std::vector<Printed> printed;
+    std::string pending;
+
+    while (true)
+    {
+        Timeline::run(Native::now);
+        pending += Native::takeSerial();
+        for (size_t end; (end = pending.find("\r\n")) != std::string::npos; pending.erase(0, end + 2))
+        {
+            printed.push_back({Native::now.load(), pending.substr(0, end)});
+        }
+        if (!Timeline::busy(Native::now))
+        {
+            return printed;
+        }
+        TickType_t wait = Timeline::wait(Native::now);
+        Native::advance(wait > 0 ? wait : 1);
+    }
+}
+
+void setUp()
+{
+    Native::advance(1000);
+    start = Native::now;
+    Native::takeSerial();
+}
+
+void tearDown()
+{
+    runTimeline();
+}
+
+void test_idle_prints_right_away()
+{
+    Timeline::println("now");
+    TEST_ASSERT_EQUAL_STRING("now\r\n", Native::takeSerial().c_str());
+    TEST_ASSERT_FALSE(Timeline::busy(Native::now));
+}
+
+void test_lines_print_after_their_pause()
+{
+    Timeline::println("Flag: A");
+    Timeline::pause(3000);
+    Timeline::println("Flag: B");
+    Timeline::pause(3000);
+    Timeline::println("board");
+    Timeline::pause(2000);
+
+    TEST_ASSERT_EQUAL(3000, Timeline::wait(Native::now));
+    std::vector<Printed> printed = runTimeline();
+    TEST_ASSERT_EQUAL(3, printed.size());
+    TEST_ASSERT_EQUAL_STRING("Flag: A", printed[0].text.c_str());
+    TEST_ASSERT_EQUAL(start, printed[0].time);
+    TEST_ASSERT_EQUAL_STRING("Flag: B", printed[1].text.c_str());
+    TEST_ASSERT_EQUAL(start + 3000, printed[1].time);
+    TEST_ASSERT_EQUAL_STRING("board", printed[2].text.c_str());
+    TEST_ASSERT_EQUAL(start + 6000, printed[2].time);
+
+    // The last pause still holds the game after the last line
+    TEST_ASSERT_EQUAL(start + 8000, Native::now);
+}
+
+void test_println_during_pending_pause_waits_for_it()
+{
+    // Only a pause is queued, the line must not jump ahead of it
+    Timeline::pause(500);
+    Native::advance(200);
+    Timeline::println("after the pause");
+    Timeline::println("right behind it");
+    TEST_ASSERT_EQUAL(0, Native::takeSerial().size());
+
+    std::vector<Printed> printed = runTimeline();
+    TEST_ASSERT_EQUAL(2, printed.size());
+    TEST_ASSERT_EQUAL_STRING("after the pause", printed[0].text.c_str());
+    TEST_ASSERT_EQUAL(start + 500, printed[0].time);
+    TEST_ASSERT_EQUAL_STRING("right behind it", printed[1].text.c_str());
+    TEST_ASSERT_EQUAL(start + 500, printed[1].time);
+
+    // Once the pause is over the timeline is idle again
+    Timeline::println("idle");
+    TEST_ASSERT_EQUAL_STRING("idle\r\n", Native::takeSerial().c_str());
+}
+
+void test_pause_during_pending_pause_adds_up()
+{
+    Timeline::pause(500);
+    Native::advance(100);
+    Timeline::pause(500);
+    Timeline::println("late");
+
+    std::vector<Printed> printed = runTimeline();
+    TEST_ASSERT_EQUAL(1, printed.size());
+    TEST_ASSERT_EQUAL(start + 1000, printed[0].time);
+}
+
+void test_full_timeline_keeps_every_line_in_order()
+{
+    Timeline::pause(100);
+    for (int i = 0; i < TIMELINE_LENGTH + 20; i++)
+    {
+        Timeline::println(String(i));
+        Timeline::pause(10);
+    }
+
+    // The oldest lines are printed early to make room, nothing is lost
+    std::vector<Printed> printed = runTimeline();
+    TEST_ASSERT_EQUAL(TIMELINE_LENGTH + 20, printed.size());
+    for (int i = 0; i < TIMELINE_LENGTH + 20; i++)
+    {
+        TEST_ASSERT_EQUAL_STRING(String(i).c_str(), printed[i].text.c_str());
+    }
+    TEST_ASSERT_EQUAL(start, printed[19].time);
+    TEST_ASSERT_EQUAL(start + 100 + 20 * 10, printed[20].time);
+    TEST_ASSERT_EQUAL(start + 100 + (TIMELINE_LENGTH + 19) * 10, printed.back().time);
+}
+
+int main()
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_idle_prints_right_away);
+    RUN_TEST(test_lines_print_after_their_pause);
+    RUN_TEST(test_println_during_pending_pause_waits_for_it);
+    RUN_TEST(test_pause_during_pending_pause_adds_up);
+    RUN_TEST(test_full_timeline_keeps_every_line_in_order);
+    return UNITY_END();
+}
\ No newline at end of file
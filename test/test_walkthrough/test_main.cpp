@@ -0,0 +1,155 @@
+// Replays a walkthrough that tries every action of every room and checks the game says what it said when walkthrough.txt was recorded.
+// Exits are walked in the training area and the arcade only, every room shown again would make the transcript several times larger.
+// Set WALKTHROUGH_RECORD=1 to record walkthrough.txt again from the current code.
+#include <unity.h>
+#include <native.hpp>
+#include <ozsec/adventure.hpp>
+#include <ozsec/storage.hpp>
+#include <ozsec/timeline.hpp>
+#include <fstream>
+#include <sstream>
+#include <vector>
+
+#define TRANSCRIPT "walkthrough.txt" // Recorded output, next to this file
+
+struct AdventureProbe
+{
+    static CharacterState &player(Adventure &adventure)
+    {
+        return adventure.player;
+    }
+    static void show(Adventure &adventure)
+    {
+        adventure.show();
+    }
+};
+
+Adventure adventure;
+static std::string transcript;
+
+/// @brief Play one command the way prompt() would and let its timed output finish
+static void play(const std::string &command)
+{
+    transcript += "> " + command + "\n";
+    adventure.processPromptResponse(command.c_str());
+    AdventureProbe::show(adventure);
+    while (Timeline::busy(millis()))
+    {
+        Native::advance(Timeline::wait(millis()));
+        Timeline::run(millis());
+    }
+    Storage::sync();
+
+    // Line ends as "\n" so the transcript reads and diffs like any text file
+    for (char c : Native::takeSerial())
+    {
+        if (c != '\r')
+        {
+            transcript += c;
+        }
+    }
+}
+
+static void play(std::initializer_list<const char *> commands)
+{
+    for (const char *command : commands)
+    {
+        play(command);
+    }
+}
+
+static std::string transcriptPath()
+{
+    std::string file = __FILE__;
+    size_t slash = file.find_last_of("/\\");
+
+    return (slash == std::string::npos ? "" : file.substr(0, slash + 1)) + TRANSCRIPT;
+}
+
+void setUp()
+{
+}
+
+void tearDown()
+{
+}
+
+void test_walkthrough_matches_the_recording()
+{
+    Native::nvsErase();
+    adventure.init();
+    AdventureProbe::show(adventure);
+    Native::takeSerial();
+
+    // The training area by its exits, then the rest of the map with cheats on
+    play({"look", "w", "n", "unlock", "s", "key", "button", "talk", "1", "1", "0", "n", "unlock", "w", "flag", "e", "s", "e"});
+    play("cheat motherlode");
+    CharacterState &player = AdventureProbe::player(adventure);
+    for (int room = 0; room < Rooms::idCount(); room++)
+    {
+        if (!Rooms::exists(room) || Rooms::optionCount(room) == 0)
+        {
+            continue;
+        }
+        play("goto " + std::to_string(room));
+        for (int i = 0; i < Rooms::optionCount(room); i++)
+        {
+            const char *option = Rooms::option(room, i);
+            if (strlen(option) == 1 && strchr("news", option[0]) != NULL)
+            {
+                continue;
+            }
+            play(option);
+            if (player.npc != -1)
+            {
+                play("0");
+            }
+            if (player.room != room)
+            {
+                play("goto " + std::to_string(room));
+            }
+        }
+        play("bogus");
+    }
+
+    // The arcade cabinet code, wrong and right, then what the player ends up with
+    play({"goto 497", "n", "n", "s", "s", "w", "e", "e", "goto 497", "n", "i", "n"});
+    play({"goto 497", "n", "n", "s", "s", "w", "e", "w", "e", "boot", "look", "select"});
+    play({"goto 497", "n", "n", "s", "s", "w", "e", "w", "e", "boot", "select", "e", "w"});
+    play({"goto 3", "talk", "n", "0", "n", "beacon", "i", "notebook"});
+
+    std::string path = transcriptPath();
+    const char *record = getenv("WALKTHROUGH_RECORD");
+    if (record != NULL && strcmp(record, "1") == 0)
+    {
+        std::ofstream(path, std::ios::binary) << transcript;
+        TEST_MESSAGE(("recorded " + path).c_str());
+    }
+
+    std::ifstream file(path, std::ios::binary);
+    TEST_ASSERT_TRUE_MESSAGE(file.good(), path.c_str());
+    std::stringstream recorded;
+    recorded << file.rdbuf();
+
+    // Report the first line that differs rather than the whole transcript
+    std::istringstream expected(recorded.str()), actual(transcript);
+    std::string expectedLine, actualLine;
+    for (int line = 1; std::getline(expected, expectedLine); line++)
+    {
+        if (!std::getline(actual, actualLine))
+        {
+            actualLine = "(end of output)";
+        }
+        TEST_ASSERT_EQUAL_STRING_MESSAGE(expectedLine.c_str(), actualLine.c_str(), (TRANSCRIPT " line " + std::to_string(line)).c_str());
+    }
+    TEST_ASSERT_FALSE_MESSAGE(std::getline(actual, actualLine), "more output than " TRANSCRIPT);
+}
+
+int main()
+{
+    Storage::init();
+
+    UNITY_BEGIN();
+    RUN_TEST(test_walkthrough_matches_the_recording);
+    return UNITY_END();
+}
\ No newline at end of file
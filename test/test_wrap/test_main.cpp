@@ -0,0 +1,276 @@
+// Word wrapping, TextWrap against the String based wrapper it replaced, and what a render costs on the host
+#include <unity.h>
+#include <native.hpp>
+#include <ozsec/roomdata.hpp>
+#include <ozsec/wrap.hpp>
+#include <chrono>
+#include <new>
+#include <random>
+#include <vector>
+
+#define RANDOM_TEXTS 20000 // Random texts wrapped by both wrappers
+#define BENCH_PASSES 200   // Times every room description is rendered for the timing
+
+static unsigned long allocations; // Heap allocations made through new, the Strings of the old wrapper included
+
+void *operator new(size_t size)
+{
+    allocations++;
+    void *p = malloc(size);
+    if (p == NULL)
+    {
+        throw std::bad_alloc();
+    }
+    return p;
+}
+
+void operator delete(void *p) noexcept
+{
+    free(p);
+}
+
+void operator delete(void *p, size_t size) noexcept
+{
+    free(p);
+}
+
+// Collects printed output and counts the writes
+class Capture : public Print
+{
+public:
+    std::string text;
+    unsigned long writes = 0;
+    size_t write(uint8_t c) override
+    {
+        writes++;
+        text += (char)c;
+        return 1;
+    }
+    size_t write(const uint8_t *data, size_t length) override
+    {
+        writes++;
+        text.append((const char *)data, length);
+        return length;
+    }
+};
+
+/// @brief Adventure::printWithWrapping() as it was before TextWrap, printing to any Print
+static void stringWrap(Print &out, const char *text, int width)
+{
+    int currentLineLength = 0;
+    String currentWord = "";
+    bool lastCharWasCR = false;
+    bool skipNewLine = false;
+
+    for (; *text != 0; text++)
+    {
+        char c = *text;
+        bool last = text[1] == 0;
+        if (c == '\r')
+        {
+            lastCharWasCR = true;
+        }
+        else if (c == '\n')
+        {
+            lastCharWasCR = false;
+            if (currentWord.length() > 0)
+            {
+                if (currentLineLength + (int)currentWord.length() > width)
+                {
+                    out.println();
+                    currentLineLength = 0;
+                }
+                out.print(currentWord);
+                currentWord = "";
+            }
+            if (!skipNewLine)
+            {
+                out.println();
+                skipNewLine = true;
+            }
+            currentLineLength = 0;
+        }
+        else
+        {
+            if (lastCharWasCR)
+            {
+                if (currentWord.length() > 0)
+                {
+                    if (currentLineLength + (int)currentWord.length() > width)
+                    {
+                        out.println();
+                    }
+                    out.print(currentWord);
+                    currentWord = "";
+                }
+                currentLineLength = 0;
+                lastCharWasCR = false;
+            }
+            if (c == ' ' || last)
+            {
+                if (last && c != ' ')
+                {
+                    currentWord += c;
+                }
+                if (currentLineLength + (int)currentWord.length() > width)
+                {
+                    out.println();
+                    currentLineLength = 0;
+                }
+                out.print(currentWord + (c == ' ' ? " " : ""));
+                currentLineLength += currentWord.length() + (c == ' ' ? 1 : 0);
+                currentWord = "";
+                skipNewLine = false;
+            }
+            else
+            {
+                currentWord += c;
+            }
+        }
+    }
+    if (currentWord.length() > 0)
+    {
+        if (currentLineLength + (int)currentWord.length() > width)
+        {
+            out.println();
+        }
+        out.print(currentWord);
+    }
+    out.println();
+}
+
+static std::vector<std::string> descriptions;
+
+void setUp()
+{
+}
+
+void tearDown()
+{
+}
+
+void test_rooms_wrap_like_the_string_wrapper()
+{
+    for (int id = 0; id < Rooms::idCount(); id++)
+    {
+        Capture old, coded, plain;
+        stringWrap(old, descriptions[id].c_str(), 100);
+        TextWrap(coded, 100).print(Rooms::description(id));
+        TextWrap(plain, 100).print(descriptions[id].c_str());
+        TEST_ASSERT_EQUAL_STRING_MESSAGE(old.text.c_str(), coded.text.c_str(), String(id).c_str());
+        TEST_ASSERT_EQUAL_STRING_MESSAGE(old.text.c_str(), plain.text.c_str(), String(id).c_str());
+    }
+}
+
+void test_random_text_wraps_like_the_string_wrapper()
+{
+    // Long words, runs of spaces, lone '\r' and '\n' and "\r\n", at every width
+    std::mt19937 random(18);
+    const char alphabet[] = "aaaaabbcdeeeefghiijklmnooopqrstuvwxyz      \r\n.,";
+
+    for (int n = 0; n < RANDOM_TEXTS; n++)
+    {
+        std::string text;
+        int length = random() % 400;
+        for (int i = 0; i < length; i++)
+        {
+            text += random() % 50 == 0 ? std::string(random() % 200, 'x') : std::string(1, alphabet[random() % (sizeof(alphabet) - 1)]);
+        }
+        int width = random() % (WRAP_WIDTH_MAX + 1);
+
+        Capture old, wrapped;
+        stringWrap(old, text.c_str(), width);
+        TextWrap(wrapped, width).print(text.c_str());
+        TEST_ASSERT_EQUAL_STRING_MESSAGE(old.text.c_str(), wrapped.text.c_str(), String(n).c_str());
+    }
+}
+
+void test_prewrapped_rooms_match_wrapping_while_printing()
+{
+    // ROOM_WRAP_WIDTH prints the line breaks from tools/rooms.py, the other widths wrap as they print
+    const int widths[] = {20, 60, ROOM_WRAP_WIDTH - 1, ROOM_WRAP_WIDTH, ROOM_WRAP_WIDTH + 1, WRAP_WIDTH_MAX};
+
+    for (int id = 0; id < Rooms::idCount(); id++)
+    {
+        for (int width : widths)
+        {
+            Capture wrapped, printed;
+            TextWrap(wrapped, width).print(Rooms::description(id));
+            Rooms::printDescription(id, printed, width);
+            TEST_ASSERT_EQUAL_STRING_MESSAGE(wrapped.text.c_str(), printed.text.c_str(), (String(id) + " at width " + String(width)).c_str());
+        }
+    }
+}
+
+void test_render_cost()
+{
+    const char *names[] = {"String wrapper", "TextWrap, C string", "TextWrap, RoomText", "Prewrapped RoomText"};
+    unsigned long chars = 0;
+    char report[160];
+
+    for (const std::string &text : descriptions)
+    {
+        chars += text.size();
+    }
+
+    for (int mode = 0; mode < 4; mode++)
+    {
+        unsigned long renderAllocations = 0;
+        unsigned long writes = 0;
+        auto start = std::chrono::steady_clock::now();
+
+        for (int pass = 0; pass < BENCH_PASSES; pass++)
+        {
+            for (int id = 0; id < Rooms::idCount(); id++)
+            {
+                Capture out;
+                out.text.reserve(4096);
+                unsigned long before = allocations;
+                if (mode == 0)
+                {
+                    stringWrap(out, descriptions[id].c_str(), 100);
+                }
+                else if (mode == 1)
+                {
+                    TextWrap(out, 100).print(descriptions[id].c_str());
+                }
+                else if (mode == 2)
+                {
+                    TextWrap(out, 100).print(Rooms::description(id));
+                }
+                else
+                {
+                    Rooms::printDescription(id, out, ROOM_WRAP_WIDTH);
+                }
+                renderAllocations += allocations - before;
+                writes += out.writes;
+            }
+        }
+
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        int renders = BENCH_PASSES * Rooms::idCount();
+        snprintf(report, sizeof(report), "%s: %.2f allocations per render, %.2f writes per render, %.1f M chars/s on the host",
+                 names[mode], (double)renderAllocations / renders, (double)writes / renders, chars * BENCH_PASSES / seconds / 1e6);
+        TEST_MESSAGE(report);
+
+        if (mode > 0)
+        {
+            TEST_ASSERT_EQUAL(0, renderAllocations);
+        }
+    }
+}
+
+int main()
+{
+    for (int id = 0; id < Rooms::idCount(); id++)
+    {
+        descriptions.push_back(Rooms::description(id).toString().c_str());
+    }
+
+    UNITY_BEGIN();
+    RUN_TEST(test_rooms_wrap_like_the_string_wrapper);
+    RUN_TEST(test_random_text_wraps_like_the_string_wrapper);
+    RUN_TEST(test_prewrapped_rooms_match_wrapping_while_printing);
+    RUN_TEST(test_render_cost);
+    return UNITY_END();
+}
\ No newline at end of file
@@ -0,0 +1,66 @@
+#!/usr/bin/env python3
+"""Generate include/ozsec/gamma.hpp, the brightness curves for the map LEDs.
+
+Each table maps a logical LED level (0 - 255) to an LEDC duty. The top level
+matches the old analogWrite() maximum of LED_MAX_DUTY / 255 so the LEDs are no
+brighter than before, the curve only adds the steps in between.
+
+Run from the repository root after changing a board below:
+    python3 tools/gamma.py
+"""
+
+PWM_BITS = 14     # LEDC resolution, must match LED_PWM_BITS in lights.hpp
+LED_MAX_DUTY = 10 # Old 8-bit analogWrite() maximum for the map LEDs
+LEVELS = 256
+
+# Board define, gamma, description
+BOARDS = [
+    ("BOARD_SIMON", 2.5, "OzSec 2023 badge, used for testing"),
+    (None, 2.2, "OzSec 2024 badge"),
+]
+
+OUTPUT = "include/ozsec/gamma.hpp"
+
+
+def table(gamma):
+    top = LED_MAX_DUTY * ((1 << PWM_BITS) - 1) / 255
+    return [round((level / (LEVELS - 1)) ** gamma * top) for level in range(LEVELS)]
+
+
+def rows(values, per_row=16):
+    for i in range(0, len(values), per_row):
+        yield "    " + ", ".join("%d" % v for v in values[i:i + per_row]) + ","
+
+
+def main():
+    out = []
+    out.append("#ifndef Gamma_hpp")
+    out.append("#define Gamma_hpp")
+    out.append("#include <Arduino.h>")
+    out.append("")
+    out.append("// Generated by tools/gamma.py, do not edit by hand.")
+    out.append("// LEDC duty for each logical map LED level, at %d-bit resolution." % PWM_BITS)
+    out.append("")
+    out.append("#define LED_GAMMA_BITS %d    // PWM resolution the tables were generated for" % PWM_BITS)
+    out.append("#define LED_GAMMA_LEVELS %d // Number of logical LED levels" % LEVELS)
+    out.append("")
+
+    for i, (define, gamma, description) in enumerate(BOARDS):
+        if define is not None:
+            out.append("#%s %s" % ("ifdef" if i == 0 else "elif defined", define))
+        else:
+            out.append("#else")
+        out.append("// %s, gamma %.1f" % (description, gamma))
+        out.append("constexpr uint16_t ledGamma[LED_GAMMA_LEVELS] = {")
+        out.extend(rows(table(gamma)))
+        out.append("};")
+    out.append("#endif")
+    out.append("")
+    out.append("#endif")
+
+    with open(OUTPUT, "w") as f:
+        f.write("\n".join(out))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,371 @@
+#!/usr/bin/env python3
+"""Generate include/ozsec/roomdata.hpp, the packed room table, from content/rooms.json.
+
+Rooms are stored without the unused ids in between:
+  roomSlots    room id -> slot in roomRecords, ROOM_NONE for ids without a room
+  roomRecords  offsets of each room's text, lists and line breaks
+  roomText     title, description and actions of every room, Huffman coded
+  roomBreaks   per room: line break count, then where each break goes in the description
+  roomWords    option words, each once, nul terminated
+  roomLists    per room: option count, option word offsets, neighbour mask, neighbour ids
+
+Room text is coded with one canonical Huffman code for the whole corpus. Each
+string starts on a byte boundary, bits are read from the top bit of each byte
+down, and byte 0 marks the end of a string. roomCodeCounts holds the number of
+codes of each length and roomCodeSymbols the bytes in code order, see
+RoomText::read() for the decoder.
+
+Descriptions are also wrapped here at WRAP_WIDTH, the width the game prints
+them at, with a copy of TextWrap from src/ozsec/wrap.cpp. The wrapped text is
+the description without '\r' and '\n' plus "\r\n" line breaks, so only the
+offsets of the breaks are stored and the game prints the lines without
+wrapping them again. Change wrap() together with TextWrap.
+
+Run from the repository root after changing content/rooms.json:
+    python3 tools/rooms.py
+PlatformIO also runs it before each build (extra_scripts in platformio.ini),
+it then only regenerates the header when the JSON is newer.
+"""
+
+import heapq
+import json
+import os
+import sys
+
+INPUT = "content/rooms.json"
+OUTPUT = "include/ozsec/roomdata.hpp"
+
+DIRECTIONS = 4         # n, e, w, s, must match MAX_ROOM_NEIGHBORS in rooms.hpp
+ROOM_NONE = 0xFFFF     # Must match ROOM_NONE in rooms.hpp
+UINT16_MAX = 0xFFFF
+MAX_CODE_BITS = 24     # Longest Huffman code RoomText::read() can decode
+WRAP_WIDTH = 100       # Width descriptions are wrapped at, TERMINAL_WIDTH in adventure.hpp
+
+
+def fail(message):
+    sys.exit("tools/rooms.py: %s" % message)
+
+
+def literal(data):
+    """C string literal for UTF-8 bytes, octal escapes can't run into the next character."""
+    out = []
+    for b in data:
+        c = chr(b)
+        if c == "\\" or c == '"':
+            out.append("\\" + c)
+        elif c == "\n":
+            out.append("\\n")
+        elif c == "\r":
+            out.append("\\r")
+        elif 32 <= b < 127:
+            out.append(c)
+        else:
+            out.append("\\%03o" % b)
+    return '"' + "".join(out) + '"'
+
+
+def code_lengths(counts):
+    """Huffman code length of each byte value that occurs."""
+    heap = [(count, symbol, [symbol]) for symbol, count in counts.items()]
+    heapq.heapify(heap)
+    lengths = {symbol: 0 for symbol in counts}
+    while len(heap) > 1:
+        count_a, tie_a, symbols_a = heapq.heappop(heap)
+        count_b, tie_b, symbols_b = heapq.heappop(heap)
+        for symbol in symbols_a + symbols_b:
+            lengths[symbol] += 1
+        heapq.heappush(heap, (count_a + count_b, min(tie_a, tie_b), symbols_a + symbols_b))
+    return lengths
+
+
+def canonical(lengths):
+    """Canonical codes, shorter codes first and by byte value within a length."""
+    codes = {}
+    code = 0
+    previous = 0
+    for symbol in sorted(lengths, key=lambda s: (lengths[s], s)):
+        code <<= lengths[symbol] - previous
+        previous = lengths[symbol]
+        codes[symbol] = (code, lengths[symbol])
+        code += 1
+    return codes
+
+
+class BitWriter:
+    def __init__(self):
+        self.data = bytearray()
+        self.bits = 0
+
+    def write(self, code, length):
+        for i in range(length - 1, -1, -1):
+            if self.bits == 0:
+                self.data.append(0)
+            if code & (1 << i):
+                self.data[-1] |= 0x80 >> self.bits
+            self.bits = (self.bits + 1) % 8
+
+    def align(self):
+        self.bits = 0
+
+
+def wrap(text, width):
+    """Wrap text like TextWrap::print() does, returning the bytes it prints."""
+    out = bytearray()
+    line_length = 0
+    word = bytearray()
+    last_char_was_cr = False
+    skip_new_line = False
+
+    def print_word():
+        nonlocal line_length
+        if line_length + len(word) > width:
+            out.extend(b"\r\n")
+            line_length = 0
+        out.extend(word)
+        line_length += len(word)
+        word.clear()
+
+    for i, c in enumerate(text):
+        last = i == len(text) - 1
+        if c == 13:
+            last_char_was_cr = True
+        elif c == 10:
+            last_char_was_cr = False
+            if word:
+                print_word()
+            if not skip_new_line:
+                out.extend(b"\r\n")
+                skip_new_line = True
+            line_length = 0
+        else:
+            if last_char_was_cr:
+                if word:
+                    print_word()
+                line_length = 0
+                last_char_was_cr = False
+            if c == 32 or last:
+                if c != 32:
+                    word.append(c)
+                print_word()
+                if c == 32:
+                    out.append(c)
+                    line_length += 1
+                skip_new_line = False
+            else:
+                word.append(c)
+
+    if word:
+        print_word()
+    out.extend(b"\r\n")
+    return bytes(out)
+
+
+def line_breaks(text, width):
+    """Offsets in text where wrapping it puts a line break, each before the byte at that offset."""
+    wrapped = wrap(text, width)
+    kept = [i for i, c in enumerate(text) if c not in (10, 13)]
+    breaks = []
+    n = 0
+    i = 0
+    while i < len(wrapped):
+        if wrapped[i:i + 2] == b"\r\n":
+            breaks.append(kept[n] if n < len(kept) else len(text))
+            i += 2
+        else:
+            n += 1
+            i += 1
+
+    # Printing the breaks must give back the wrapped text, see TextWrap::printLines()
+    printed = bytearray()
+    pending = list(breaks)
+    for offset, c in enumerate(text):
+        while pending and pending[0] == offset:
+            printed.extend(b"\r\n")
+            pending.pop(0)
+        if c not in (10, 13):
+            printed.append(c)
+    printed.extend(b"\r\n" * len(pending))
+    if bytes(printed) != wrapped:
+        fail("line breaks do not reproduce the wrapped text")
+    return breaks
+
+
+def rows(values, per_row=16):
+    for i in range(0, len(values), per_row):
+        yield "    " + ", ".join("%d" % v for v in values[i:i + per_row]) + ","
+
+
+def load(path):
+    with open(path, encoding="utf-8") as f:
+        rooms = json.load(f)["rooms"]
+
+    ids = set()
+    for room in rooms:
+        if room["id"] in ids:
+            fail("room %d is defined twice" % room["id"])
+        if room["id"] < 0 or room["id"] >= ROOM_NONE:
+            fail("room id %d is out of range" % room["id"])
+        if len(room["neighbors"]) != DIRECTIONS:
+            fail("room %d needs %d neighbours" % (room["id"], DIRECTIONS))
+        ids.add(room["id"])
+    for room in rooms:
+        for neighbor in room["neighbors"]:
+            if neighbor != -1 and neighbor not in ids:
+                fail("room %d leads to room %d, which does not exist" % (room["id"], neighbor))
+
+    return sorted(rooms, key=lambda room: room["id"])
+
+
+def generate(rooms):
+    id_count = rooms[-1]["id"] + 1
+    slots = [ROOM_NONE] * id_count
+    records = []
+    text = bytearray()
+    words = bytearray()
+    word_offsets = {}
+    lists = []
+    breaks = []
+
+    for slot, room in enumerate(rooms):
+        slots[room["id"]] = slot
+
+        # Title, description and actions back to back
+        title = room["title"].encode("utf-8")
+        description = room["description"].encode("utf-8")
+        actions = room["actions"].encode("utf-8")
+        start = len(text)
+        for part in (title, description, actions):
+            text += part + b"\0"
+        if len(text) - start > UINT16_MAX:
+            fail("room %d has too much text" % room["id"])
+
+        # Options, then the neighbours that exist in n, e, w, s order
+        list_start = len(lists)
+        lists.append(len(room["options"]))
+        for option in room["options"]:
+            if option not in word_offsets:
+                word_offsets[option] = len(words)
+                words += option.encode("utf-8") + b"\0"
+            lists.append(word_offsets[option])
+        mask = 0
+        for direction, neighbor in enumerate(room["neighbors"]):
+            if neighbor != -1:
+                mask |= 1 << direction
+        lists.append(mask)
+        lists.extend(n for n in room["neighbors"] if n != -1)
+
+        # Line breaks of the description at WRAP_WIDTH
+        break_start = len(breaks)
+        offsets = line_breaks(description, WRAP_WIDTH)
+        breaks.append(len(offsets))
+        breaks.extend(offsets)
+
+        records.append((start, len(title) + 1, len(title) + 1 + len(description) + 1, list_start, break_start, room))
+
+    if len(lists) > UINT16_MAX or len(words) > UINT16_MAX or len(breaks) > UINT16_MAX:
+        fail("room lists are too large for 16-bit offsets")
+
+    # Huffman code the text, each string on its own byte boundary
+    counts = {}
+    for b in text:
+        counts[b] = counts.get(b, 0) + 1
+    lengths = code_lengths(counts)
+    codes = canonical(lengths)
+    max_bits = max(lengths.values())
+    if max_bits > MAX_CODE_BITS:
+        fail("room text needs %d bit codes, the decoder handles %d" % (max_bits, MAX_CODE_BITS))
+    writer = BitWriter()
+    packed = {}
+    for i, b in enumerate(text):
+        if i == 0 or text[i - 1] == 0:
+            writer.align()
+            packed[i] = len(writer.data)
+        writer.write(*codes[b])
+    for n, (start, description, actions, list_start, break_start, room) in enumerate(records):
+        title_at = packed[start]
+        description_at = packed[start + description] - title_at
+        actions_at = packed[start + actions] - title_at
+        if actions_at > UINT16_MAX:
+            fail("room %d has too much text" % room["id"])
+        records[n] = (title_at, description_at, actions_at, list_start, break_start, room)
+    code_counts = [0] * (max_bits + 1)
+    for length in lengths.values():
+        code_counts[length] += 1
+    code_symbols = sorted(lengths, key=lambda s: (lengths[s], s))
+
+    out = []
+    out.append("#ifndef RoomData_hpp")
+    out.append("#define RoomData_hpp")
+    out.append("#include <ozsec/rooms.hpp>")
+    out.append("")
+    out.append("// Generated by tools/rooms.py from %s, do not edit by hand." % INPUT)
+    out.append("// %d rooms, %d bytes of text coded into %d bytes (%.1f%%), %d option words, %d list entries, %d line breaks."
+               % (len(rooms), len(text), len(writer.data), 100.0 * len(writer.data) / len(text), len(word_offsets), len(lists),
+                  len(breaks) - len(rooms)))
+    out.append("")
+    out.append("#define ROOM_ID_COUNT %d // Room ids are 0 to ROOM_ID_COUNT - 1" % id_count)
+    out.append("#define ROOM_COUNT %d    // Rooms that exist" % len(rooms))
+    out.append("#define ROOM_CODE_BITS %d // Longest Huffman code in bits" % max_bits)
+    out.append("#define ROOM_WRAP_WIDTH %d // Width of the line breaks in roomBreaks" % WRAP_WIDTH)
+    out.append("")
+    out.append("// Slot in roomRecords of each room id, ROOM_NONE if there is no room")
+    out.append("constexpr uint16_t roomSlots[ROOM_ID_COUNT] = {")
+    out.extend(rows(slots))
+    out.append("};")
+    out.append("")
+    out.append("constexpr RoomRecord roomRecords[ROOM_COUNT] = {")
+    for start, description, actions, list_start, break_start, room in records:
+        out.append("    {%d, %d, %d, %d, %d}, // %d %s" % (start, description, actions, list_start, break_start, room["id"], room["title"]))
+    out.append("};")
+    out.append("")
+    out.append("// Number of Huffman codes of each length in bits")
+    out.append("constexpr uint16_t roomCodeCounts[ROOM_CODE_BITS + 1] = {")
+    out.extend(rows(code_counts))
+    out.append("};")
+    out.append("")
+    out.append("// Byte of each Huffman code, in code order")
+    out.append("constexpr uint8_t roomCodeSymbols[] = {")
+    out.extend(rows(code_symbols))
+    out.append("};")
+    out.append("")
+    out.append("constexpr uint8_t roomText[] = {")
+    out.extend(rows(writer.data, 24))
+    out.append("};")
+    out.append("")
+    out.append("constexpr char roomWords[] =")
+    for word in sorted(word_offsets, key=word_offsets.get):
+        out.append("    %s \"\\0\"" % literal(word.encode("utf-8")))
+    out[-1] += ";"
+    out.append("")
+    out.append("constexpr uint16_t roomLists[] = {")
+    out.extend(rows(lists))
+    out.append("};")
+    out.append("")
+    out.append("constexpr uint16_t roomBreaks[] = {")
+    out.extend(rows(breaks))
+    out.append("};")
+    out.append("")
+    out.append("#endif")
+    return "\n".join(out)
+
+
+def main(root, only_if_stale=False):
+    source = os.path.join(root, INPUT)
+    target = os.path.join(root, OUTPUT)
+    if only_if_stale and os.path.exists(target) and os.path.getmtime(target) >= os.path.getmtime(source):
+        return
+
+    with open(target, "w", encoding="utf-8", newline="\n") as f:
+        f.write(generate(load(source)))
+    print("Wrote %s" % OUTPUT)
+
+
+try:
+    Import("env")  # noqa: F821, defined when PlatformIO runs this as a pre script
+except NameError:
+    env = None
+
+if env is not None:
+    main(env.subst("$PROJECT_DIR"), only_if_stale=True)
+elif __name__ == "__main__":
+    main(os.getcwd())